@@ -11,12 +11,15 @@
 #define BASE_NUMERICS_BASIC_OPS_IMPL_H_
 
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <span>
 #include <type_traits>
 
+#include "base/numerics/safe_conversions_impl.h"
+
 namespace base::numerics_internal {
 
 // The correct type to perform math operations on given values of type `T`. This
@@ -84,6 +87,54 @@ template <class T>
 inline constexpr std::array<uint8_t, sizeof(T)> ToLittleEndian(T val) {
   return ToLittleEndian(static_cast<std::make_unsigned_t<T>>(val));
 }
+
+// The unsigned integer type of the same size as the arithmetic type `T`,
+// which holds its encoding.
+template <class T>
+  requires(std::is_arithmetic_v<T>)
+using EncodingType = std::conditional_t<
+    sizeof(T) == 1u,
+    uint8_t,
+    std::conditional_t<
+        sizeof(T) == 2u,
+        uint16_t,
+        std::conditional_t<sizeof(T) == 4u, uint32_t, uint64_t>>>;
+
+// Converts from a byte array holding big-endian encodings to an array of
+// numbers, which must hold all of them. Each value is loaded and swapped in
+// the same way, so that the compiler vectorizes the loop into byte shuffles.
+template <class T>
+  requires(std::is_arithmetic_v<T>)
+inline void FromBigEndianArray(std::span<const uint8_t> bytes,
+                               std::span<T> values) {
+  using Unsigned = EncodingType<T>;
+  static_assert(sizeof(Unsigned) == sizeof(T));
+  if (bytes.size() != values.size_bytes()) {
+    CheckOnFailure::template HandleFailure<void>();
+  }
+  for (size_t i = 0u; i < values.size(); ++i) {
+    values[i] = std::bit_cast<T>(std::byteswap(FromLittleEndian<Unsigned>(
+        bytes.subspan(i * sizeof(T)).template first<sizeof(T)>())));
+  }
+}
+
+// Converts to a byte array, which must hold exactly their encodings, from an
+// array of numbers, encoded in big endian. The inverse of
+// FromBigEndianArray().
+template <class T>
+  requires(std::is_arithmetic_v<T>)
+inline void ToBigEndianArray(std::span<const T> values,
+                             std::span<uint8_t> bytes) {
+  using Unsigned = EncodingType<T>;
+  if (bytes.size() != values.size_bytes()) {
+    CheckOnFailure::template HandleFailure<void>();
+  }
+  for (size_t i = 0u; i < values.size(); ++i) {
+    const std::array<uint8_t, sizeof(T)> encoding =
+        ToLittleEndian(std::byteswap(std::bit_cast<Unsigned>(values[i])));
+    memcpy(bytes.subspan(i * sizeof(T)).data(), encoding.data(), sizeof(T));
+  }
+}
 }  // namespace base::numerics_internal
 
 #endif  // BASE_NUMERICS_BASIC_OPS_IMPL_H_
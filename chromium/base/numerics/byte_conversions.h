@@ -376,6 +376,46 @@ inline constexpr double DoubleFromBigEndian(
   return std::bit_cast<double>(U64FromBigEndian(bytes));
 }
 
+// Decodes the big-endian encodings in `bytes` into `values`, as a loop of
+// U16FromBigEndian() would. `bytes` must hold exactly `values.size()`
+// encodings.
+//
+// This is suitable for parsing large tables in network order, such as in font
+// files, where the whole table is converted with vectorized byte swaps. Use
+// U16FromBigEndian() for single values and in constant expressions.
+inline void U16sFromBigEndian(std::span<const uint8_t> bytes,
+                              std::span<uint16_t> values) {
+  numerics_internal::FromBigEndianArray(bytes, values);
+}
+// Decodes the big-endian encodings in `bytes` into `values`, as a loop of
+// U32FromBigEndian() would. `bytes` must hold exactly `values.size()`
+// encodings.
+inline void U32sFromBigEndian(std::span<const uint8_t> bytes,
+                              std::span<uint32_t> values) {
+  numerics_internal::FromBigEndianArray(bytes, values);
+}
+// Decodes the big-endian encodings in `bytes` into `values`, as a loop of
+// U64FromBigEndian() would. `bytes` must hold exactly `values.size()`
+// encodings.
+inline void U64sFromBigEndian(std::span<const uint8_t> bytes,
+                              std::span<uint64_t> values) {
+  numerics_internal::FromBigEndianArray(bytes, values);
+}
+// Decodes the big-endian encodings in `bytes` into `values`, as a loop of
+// FloatFromBigEndian() would. `bytes` must hold exactly `values.size()`
+// encodings.
+inline void FloatsFromBigEndian(std::span<const uint8_t> bytes,
+                                std::span<float> values) {
+  numerics_internal::FromBigEndianArray(bytes, values);
+}
+// Decodes the big-endian encodings in `bytes` into `values`, as a loop of
+// DoubleFromBigEndian() would. `bytes` must hold exactly `values.size()`
+// encodings.
+inline void DoublesFromBigEndian(std::span<const uint8_t> bytes,
+                                 std::span<double> values) {
+  numerics_internal::FromBigEndianArray(bytes, values);
+}
+
 // Returns a byte array holding the value of a uint8_t encoded as the native
 // endian encoding of the integer for the machine.
 //
@@ -701,6 +741,42 @@ inline constexpr std::array<uint8_t, 8u> DoubleToBigEndian(double val) {
       std::byteswap(std::bit_cast<uint64_t>(val)));
 }
 
+// Encodes `values` in big endian into `bytes`, as a loop of U16ToBigEndian()
+// would. `bytes` must hold exactly `values.size()` encodings.
+//
+// This is suitable for writing large tables in network order, where the whole
+// table is converted with vectorized byte swaps. Use U16ToBigEndian() for
+// single values and in constant expressions.
+inline void U16sToBigEndian(std::span<const uint16_t> values,
+                            std::span<uint8_t> bytes) {
+  numerics_internal::ToBigEndianArray(values, bytes);
+}
+// Encodes `values` in big endian into `bytes`, as a loop of U32ToBigEndian()
+// would. `bytes` must hold exactly `values.size()` encodings.
+inline void U32sToBigEndian(std::span<const uint32_t> values,
+                            std::span<uint8_t> bytes) {
+  numerics_internal::ToBigEndianArray(values, bytes);
+}
+// Encodes `values` in big endian into `bytes`, as a loop of U64ToBigEndian()
+// would. `bytes` must hold exactly `values.size()` encodings.
+inline void U64sToBigEndian(std::span<const uint64_t> values,
+                            std::span<uint8_t> bytes) {
+  numerics_internal::ToBigEndianArray(values, bytes);
+}
+// Encodes `values` in big endian into `bytes`, as a loop of FloatToBigEndian()
+// would. `bytes` must hold exactly `values.size()` encodings.
+inline void FloatsToBigEndian(std::span<const float> values,
+                              std::span<uint8_t> bytes) {
+  numerics_internal::ToBigEndianArray(values, bytes);
+}
+// Encodes `values` in big endian into `bytes`, as a loop of
+// DoubleToBigEndian() would. `bytes` must hold exactly `values.size()`
+// encodings.
+inline void DoublesToBigEndian(std::span<const double> values,
+                               std::span<uint8_t> bytes) {
+  numerics_internal::ToBigEndianArray(values, bytes);
+}
+
 }  // namespace base
 
 #endif  // BASE_NUMERICS_BYTE_CONVERSIONS_H_
@@ -8,6 +8,7 @@
 #include <bit>
 #include <concepts>
 #include <cstdint>
+#include <span>
 
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -265,6 +266,90 @@ TEST(NumericsTest, FromBigEndian) {
   }
 }
 
+TEST(NumericsTest, ArraysFromBigEndian) {
+  // More values than fit in a vector register, so that there's a remainder.
+  std::array<uint8_t, 72u> bytes;
+  for (size_t i = 0u; i < bytes.size(); ++i) {
+    bytes[i] = static_cast<uint8_t>(i * 37u + 1u);
+  }
+  const std::span<const uint8_t> all_bytes(bytes);
+
+  std::array<uint16_t, 36u> u16s;
+  U16sFromBigEndian(all_bytes, u16s);
+  for (size_t i = 0u; i < u16s.size(); ++i) {
+    EXPECT_EQ(u16s[i], U16FromBigEndian(all_bytes.subspan(i * 2u).first<2u>()));
+  }
+
+  std::array<uint32_t, 18u> u32s;
+  U32sFromBigEndian(all_bytes, u32s);
+  std::array<float, 18u> floats;
+  FloatsFromBigEndian(all_bytes, floats);
+  for (size_t i = 0u; i < u32s.size(); ++i) {
+    const auto value_bytes = all_bytes.subspan(i * 4u).first<4u>();
+    EXPECT_EQ(u32s[i], U32FromBigEndian(value_bytes));
+    EXPECT_EQ(std::bit_cast<uint32_t>(floats[i]),
+              std::bit_cast<uint32_t>(FloatFromBigEndian(value_bytes)));
+  }
+
+  std::array<uint64_t, 9u> u64s;
+  U64sFromBigEndian(all_bytes, u64s);
+  std::array<double, 9u> doubles;
+  DoublesFromBigEndian(all_bytes, doubles);
+  for (size_t i = 0u; i < u64s.size(); ++i) {
+    const auto value_bytes = all_bytes.subspan(i * 8u).first<8u>();
+    EXPECT_EQ(u64s[i], U64FromBigEndian(value_bytes));
+    EXPECT_EQ(std::bit_cast<uint64_t>(doubles[i]),
+              std::bit_cast<uint64_t>(DoubleFromBigEndian(value_bytes)));
+  }
+
+  U32sFromBigEndian({}, {});
+}
+
+TEST(NumericsTest, ArraysToBigEndian) {
+  std::array<uint16_t, 9u> u16s;
+  std::array<uint32_t, 9u> u32s;
+  std::array<uint64_t, 9u> u64s;
+  std::array<float, 9u> floats;
+  std::array<double, 9u> doubles;
+  for (size_t i = 0u; i < u16s.size(); ++i) {
+    u64s[i] = 0x0123456789abcdefu * (i + 1u);
+    u32s[i] = static_cast<uint32_t>(u64s[i]);
+    u16s[i] = static_cast<uint16_t>(u64s[i]);
+    floats[i] = static_cast<float>(i) * -1.75f;
+    doubles[i] = static_cast<double>(i) * 1e100;
+  }
+
+  std::array<uint8_t, 9u * 2u> u16_bytes;
+  U16sToBigEndian(u16s, u16_bytes);
+  std::array<uint8_t, 9u * 4u> u32_bytes;
+  U32sToBigEndian(u32s, u32_bytes);
+  std::array<uint8_t, 9u * 4u> float_bytes;
+  FloatsToBigEndian(floats, float_bytes);
+  std::array<uint8_t, 9u * 8u> u64_bytes;
+  U64sToBigEndian(u64s, u64_bytes);
+  std::array<uint8_t, 9u * 8u> double_bytes;
+  DoublesToBigEndian(doubles, double_bytes);
+  for (size_t i = 0u; i < u16s.size(); ++i) {
+    EXPECT_EQ(
+        U16FromBigEndian(std::span(u16_bytes).subspan(i * 2u).first<2u>()),
+        u16s[i]);
+    EXPECT_EQ(
+        U32FromBigEndian(std::span(u32_bytes).subspan(i * 4u).first<4u>()),
+        u32s[i]);
+    EXPECT_EQ(
+        FloatFromBigEndian(std::span(float_bytes).subspan(i * 4u).first<4u>()),
+        floats[i]);
+    EXPECT_EQ(
+        U64FromBigEndian(std::span(u64_bytes).subspan(i * 8u).first<8u>()),
+        u64s[i]);
+    EXPECT_EQ(DoubleFromBigEndian(
+                  std::span(double_bytes).subspan(i * 8u).first<8u>()),
+              doubles[i]);
+  }
+
+  U32sToBigEndian({}, {});
+}
+
 TEST(NumericsTest, ToNativeEndian) {
   // The implementation of ToNativeEndian and ToLittleEndian assumes the native
   // endian is little. If support of big endian is desired, compile-time
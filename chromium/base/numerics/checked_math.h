@@ -8,6 +8,8 @@
 #include <stdint.h>
 
 #include <limits>
+#include <optional>
+#include <span>
 #include <type_traits>
 
 #include "base/numerics/checked_math_impl.h"  // IWYU pragma: export
@@ -383,12 +385,61 @@ L* operator-(L* lhs, StrictNumeric<R> rhs) {
   return reinterpret_cast<L*>(result);
 }
 
+// Reductions of arrays, e.g. of buffer sizes or of the sides of sizes, which
+// are done in T with the overflow builtins and a single validity flag for the
+// whole array, instead of a CheckedNumeric for each value. They return
+// std::nullopt if any of the operations overflows.
+template <typename T>
+  requires std::integral<T>
+constexpr std::optional<T> CheckedSum(std::span<const T> values) {
+  T sum = 0;
+  bool is_valid = true;
+  for (T value : values) {
+    // The flag is checked once at the end, so that the loop has no branch.
+    is_valid &= CheckedAddOp<T, T>::Do(sum, value, &sum);
+  }
+  return is_valid ? std::optional<T>(sum) : std::nullopt;
+}
+
+template <typename T>
+  requires std::integral<T>
+constexpr std::optional<T> CheckedProduct(std::span<const T> values) {
+  T product = 1;
+  bool is_valid = true;
+  for (T value : values) {
+    is_valid &= CheckedMulOp<T, T>::Do(product, value, &product);
+  }
+  return is_valid ? std::optional<T>(product) : std::nullopt;
+}
+
+// The sum of the products of the values at the same index of |lhs| and |rhs|,
+// or std::nullopt if they don't have the same size.
+template <typename T>
+  requires std::integral<T>
+constexpr std::optional<T> CheckedDot(std::span<const T> lhs,
+                                      std::span<const T> rhs) {
+  if (lhs.size() != rhs.size()) {
+    return std::nullopt;
+  }
+  T sum = 0;
+  bool is_valid = true;
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    T product = 0;
+    is_valid &= CheckedMulOp<T, T>::Do(lhs[i], rhs[i], &product);
+    is_valid &= CheckedAddOp<T, T>::Do(sum, product, &sum);
+  }
+  return is_valid ? std::optional<T>(sum) : std::nullopt;
+}
+
 }  // namespace numerics_internal
 
 using numerics_internal::CheckAdd;
 using numerics_internal::CheckAnd;
 using numerics_internal::CheckDiv;
+using numerics_internal::CheckedDot;
 using numerics_internal::CheckedNumeric;
+using numerics_internal::CheckedProduct;
+using numerics_internal::CheckedSum;
 using numerics_internal::CheckLsh;
 using numerics_internal::CheckMax;
 using numerics_internal::CheckMin;
@@ -0,0 +1,66 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/numerics/checked_math.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+TEST(CheckedMathTest, CheckedSum) {
+  constexpr std::array<int, 4> kValues = {1, -2, 30, 400};
+  static_assert(CheckedSum(std::span<const int>(kValues)) == 429);
+  EXPECT_EQ(CheckedSum(std::span<const int>()), 0);
+
+  constexpr int kMax = std::numeric_limits<int>::max();
+  const std::array<int, 3> overflow = {kMax, 1, -1};
+  EXPECT_EQ(CheckedSum(std::span<const int>(overflow)), std::nullopt);
+  const std::array<int, 3> no_overflow = {kMax, -1, 1};
+  EXPECT_EQ(CheckedSum(std::span<const int>(no_overflow)), kMax);
+
+  const std::array<uint32_t, 2> unsigned_overflow = {0xffffffffu, 1};
+  EXPECT_EQ(CheckedSum(std::span<const uint32_t>(unsigned_overflow)),
+            std::nullopt);
+}
+
+TEST(CheckedMathTest, CheckedProduct) {
+  constexpr std::array<int64_t, 3> kValues = {-3, 5, 7};
+  static_assert(CheckedProduct(std::span<const int64_t>(kValues)) == -105);
+  EXPECT_EQ(CheckedProduct(std::span<const int64_t>()), 1);
+
+  const std::array<int, 3> overflow = {1 << 16, 1 << 15, 0};
+  EXPECT_EQ(CheckedProduct(std::span<const int>(overflow)), std::nullopt);
+  const std::array<int, 2> min = {std::numeric_limits<int>::min(), -1};
+  EXPECT_EQ(CheckedProduct(std::span<const int>(min)), std::nullopt);
+}
+
+TEST(CheckedMathTest, CheckedDot) {
+  // The areas of 3x4 and 5x6 sizes.
+  constexpr std::array<int, 2> kWidths = {3, 5};
+  constexpr std::array<int, 2> kHeights = {4, 6};
+  static_assert(CheckedDot(std::span<const int>(kWidths),
+                           std::span<const int>(kHeights)) == 42);
+
+  const std::array<int, 2> large = {1 << 16, 1};
+  const std::array<int, 2> overflow = {1 << 15, 1};
+  EXPECT_EQ(CheckedDot(std::span<const int>(large),
+                       std::span<const int>(overflow)),
+            std::nullopt);
+  const std::array<int, 2> sum_overflow = {1 << 15, 1 << 15};
+  const std::array<int, 2> factors = {1 << 15, 1 << 15};
+  EXPECT_EQ(CheckedDot(std::span<const int>(sum_overflow),
+                       std::span<const int>(factors)),
+            std::nullopt);
+  EXPECT_EQ(CheckedDot(std::span<const int>(kWidths),
+                       std::span<const int>(kHeights).first(1u)),
+            std::nullopt);
+}
+
+}  // namespace base
@@ -0,0 +1,175 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_NUMERICS_CLAMPED_VEC_H_
+#define BASE_NUMERICS_CLAMPED_VEC_H_
+
+#include <stddef.h>
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "base/numerics/clamped_math.h"
+
+namespace base {
+namespace numerics_internal {
+
+// The integer type of twice the size of T, with the same signedness, which
+// holds any product of two T.
+template <typename T>
+using ClampedVecWideType = std::conditional_t<
+    sizeof(T) == 1u,
+    std::conditional_t<std::is_signed_v<T>, int16_t, uint16_t>,
+    std::conditional_t<
+        sizeof(T) == 2u,
+        std::conditional_t<std::is_signed_v<T>, int32_t, uint32_t>,
+        std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>>>;
+
+// The vector extension types of N lanes of T and of its wide and unsigned
+// types. They're declared outside of ClampedVec, so that GCC doesn't confuse
+// them with T while parsing it.
+template <typename T, size_t N>
+struct ClampedVecTypes {
+  typedef T Vector __attribute__((vector_size(N * sizeof(T))));
+  typedef ClampedVecWideType<T> WideVector
+      __attribute__((vector_size(N * sizeof(ClampedVecWideType<T>))));
+  typedef std::make_unsigned_t<T> UnsignedVector
+      __attribute__((vector_size(N * sizeof(T))));
+};
+
+// N lanes of T, with the semantics of ClampAdd(), ClampSub(), ClampMul() and
+// of negating a ClampedNumeric in each lane. The lanes are a vector extension
+// type, which the compiler maps to the SIMD registers of the target. With
+// clang, addition and subtraction use the saturating instructions of the
+// target where it has them, e.g. SSE2 paddsw or NEON sqadd; otherwise the
+// overflows are detected and replaced with selects.
+template <typename T, size_t N>
+  requires(std::integral<T> && !std::same_as<T, bool> &&
+           std::has_single_bit(N) && N * sizeof(T) <= 64u)
+class ClampedVec {
+ public:
+  using type = T;
+  using Vector = typename ClampedVecTypes<T, N>::Vector;
+
+  static constexpr size_t kLanes = N;
+
+  constexpr ClampedVec() = default;
+  constexpr explicit ClampedVec(Vector lanes) : lanes_(lanes) {}
+  // Each lane holds |value|.
+  constexpr explicit ClampedVec(T value) : lanes_(Vector{} + value) {}
+
+  static ClampedVec Load(std::span<const T, N> values) {
+    Vector lanes;
+    for (size_t i = 0u; i < N; ++i) {
+      lanes[i] = values[i];
+    }
+    return ClampedVec(lanes);
+  }
+  void Store(std::span<T, N> values) const {
+    for (size_t i = 0u; i < N; ++i) {
+      values[i] = lanes_[i];
+    }
+  }
+
+  constexpr T operator[](size_t lane) const { return lanes_[lane]; }
+  constexpr Vector lanes() const { return lanes_; }
+
+  friend ClampedVec operator+(ClampedVec a, ClampedVec b) {
+#if __has_builtin(__builtin_elementwise_add_sat)
+    return ClampedVec(__builtin_elementwise_add_sat(a.lanes_, b.lanes_));
+#else
+    const Vector sum = std::bit_cast<Vector>(
+        std::bit_cast<UnsignedVector>(a.lanes_) +
+        std::bit_cast<UnsignedVector>(b.lanes_));
+    if constexpr (std::is_signed_v<T>) {
+      // The sum overflowed if its sign differs from those of both operands.
+      const auto overflowed = ((a.lanes_ ^ sum) & (b.lanes_ ^ sum)) < 0;
+      return ClampedVec(overflowed ? Saturated(a.lanes_) : sum);
+    } else {
+      return ClampedVec(sum < a.lanes_ ? Vector{} + kMax : sum);
+    }
+#endif
+  }
+
+  friend ClampedVec operator-(ClampedVec a, ClampedVec b) {
+#if __has_builtin(__builtin_elementwise_sub_sat)
+    return ClampedVec(__builtin_elementwise_sub_sat(a.lanes_, b.lanes_));
+#else
+    const Vector difference = std::bit_cast<Vector>(
+        std::bit_cast<UnsignedVector>(a.lanes_) -
+        std::bit_cast<UnsignedVector>(b.lanes_));
+    if constexpr (std::is_signed_v<T>) {
+      // The difference overflowed if the operands have different signs, and
+      // it doesn't have the sign of |a|.
+      const auto overflowed =
+          ((a.lanes_ ^ b.lanes_) & (a.lanes_ ^ difference)) < 0;
+      return ClampedVec(overflowed ? Saturated(a.lanes_) : difference);
+    } else {
+      return ClampedVec(a.lanes_ < b.lanes_ ? Vector{} : difference);
+    }
+#endif
+  }
+
+  friend ClampedVec operator*(ClampedVec a, ClampedVec b) {
+    if constexpr (sizeof(T) < sizeof(uint64_t)) {
+      // The products are exact in the wide type, and are clamped to T.
+      using Wide = ClampedVecWideType<T>;
+      using WideVector = typename ClampedVecTypes<T, N>::WideVector;
+      WideVector product = __builtin_convertvector(a.lanes_, WideVector) *
+                           __builtin_convertvector(b.lanes_, WideVector);
+      const WideVector max = WideVector{} + Wide{kMax};
+      const WideVector lowest = WideVector{} + Wide{kLowest};
+      product = product > max ? max : product;
+      product = product < lowest ? lowest : product;
+      return ClampedVec(__builtin_convertvector(product, Vector));
+    } else {
+      Vector product;
+      for (size_t i = 0u; i < N; ++i) {
+        product[i] = ClampMul(a.lanes_[i], b.lanes_[i]);
+      }
+      return ClampedVec(product);
+    }
+  }
+
+  ClampedVec operator-() const {
+    if constexpr (std::is_signed_v<T>) {
+      const Vector negated = std::bit_cast<Vector>(
+          UnsignedVector{} - std::bit_cast<UnsignedVector>(lanes_));
+      return ClampedVec(lanes_ == kLowest ? Vector{} + kMax : negated);
+    } else {
+      // Negating an unsigned value is 0, or would underflow to 0.
+      return ClampedVec();
+    }
+  }
+
+  ClampedVec& operator+=(ClampedVec other) { return *this = *this + other; }
+  ClampedVec& operator-=(ClampedVec other) { return *this = *this - other; }
+  ClampedVec& operator*=(ClampedVec other) { return *this = *this * other; }
+
+ private:
+  using UnsignedVector = typename ClampedVecTypes<T, N>::UnsignedVector;
+
+  static constexpr T kMax = std::numeric_limits<T>::max();
+  static constexpr T kLowest = std::numeric_limits<T>::lowest();
+
+  // The limit that a signed sum or difference that overflowed saturates to,
+  // given the lanes of its first operand, whose sign it has.
+  static Vector Saturated(Vector a) {
+    return (a >> T{std::numeric_limits<T>::digits}) ^ kMax;
+  }
+
+  Vector lanes_ = {};
+};
+
+}  // namespace numerics_internal
+
+using numerics_internal::ClampedVec;
+
+}  // namespace base
+
+#endif  // BASE_NUMERICS_CLAMPED_VEC_H_
@@ -0,0 +1,101 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/numerics/clamped_vec.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+namespace {
+
+// Values around the limits of T, and small ones of each sign.
+template <typename T>
+std::vector<T> TestValues() {
+  using Limits = std::numeric_limits<T>;
+  std::vector<T> values = {T{0},
+                           T{1},
+                           T{2},
+                           T{3},
+                           T{100},
+                           Limits::max(),
+                           static_cast<T>(Limits::max() - 1),
+                           static_cast<T>(Limits::max() / 2),
+                           static_cast<T>(Limits::max() / 2 + 1),
+                           Limits::lowest(),
+                           static_cast<T>(Limits::lowest() + 1)};
+  if constexpr (std::is_signed_v<T>) {
+    values.insert(values.end(), {T{-1}, T{-2}, T{-100},
+                                 static_cast<T>(Limits::lowest() / 2)});
+  }
+  return values;
+}
+
+// Checks each lane of the operations on ClampedVecs of each pair of test
+// values against ClampedNumeric.
+template <typename T, size_t N>
+void ExpectSameAsClampedNumeric() {
+  const std::vector<T> values = TestValues<T>();
+  for (size_t first = 0u; first < values.size(); first += N) {
+    std::array<T, N> a;
+    for (size_t i = 0u; i < N; ++i) {
+      a[i] = values[(first + i) % values.size()];
+    }
+    const ClampedVec<T, N> vec_a = ClampedVec<T, N>::Load(a);
+    const ClampedVec<T, N> negated = -vec_a;
+    for (size_t i = 0u; i < N; ++i) {
+      EXPECT_EQ(static_cast<T>(-ClampedNumeric<T>(a[i])), negated[i]) << +a[i];
+    }
+
+    for (T b : values) {
+      const ClampedVec<T, N> vec_b(b);
+      const ClampedVec<T, N> sum = vec_a + vec_b;
+      const ClampedVec<T, N> difference = vec_a - vec_b;
+      const ClampedVec<T, N> product = vec_a * vec_b;
+      for (size_t i = 0u; i < N; ++i) {
+        EXPECT_EQ(static_cast<T>(ClampAdd(a[i], b)), sum[i]) << +a[i] << +b;
+        EXPECT_EQ(static_cast<T>(ClampSub(a[i], b)), difference[i])
+            << +a[i] << +b;
+        EXPECT_EQ(static_cast<T>(ClampMul(a[i], b)), product[i])
+            << +a[i] << +b;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ClampedVecTest, Signed) {
+  ExpectSameAsClampedNumeric<int8_t, 16>();
+  ExpectSameAsClampedNumeric<int16_t, 8>();
+  ExpectSameAsClampedNumeric<int32_t, 4>();
+  ExpectSameAsClampedNumeric<int32_t, 8>();
+  ExpectSameAsClampedNumeric<int64_t, 2>();
+}
+
+TEST(ClampedVecTest, Unsigned) {
+  ExpectSameAsClampedNumeric<uint8_t, 16>();
+  ExpectSameAsClampedNumeric<uint16_t, 8>();
+  ExpectSameAsClampedNumeric<uint32_t, 4>();
+  ExpectSameAsClampedNumeric<uint64_t, 4>();
+}
+
+TEST(ClampedVecTest, LoadStoreAndAssign) {
+  constexpr std::array<int16_t, 4> kValues = {1, -2, 30000, -30000};
+  ClampedVec<int16_t, 4> vec = ClampedVec<int16_t, 4>::Load(kValues);
+  vec += ClampedVec<int16_t, 4>(int16_t{10000});
+  vec *= ClampedVec<int16_t, 4>(int16_t{2});
+  vec -= ClampedVec<int16_t, 4>(int16_t{1});
+
+  std::array<int16_t, 4> results;
+  vec.Store(results);
+  EXPECT_EQ(results, (std::array<int16_t, 4>{20001, 19995, 32766, -32768}));
+}
+
+}  // namespace base
@@ -0,0 +1,363 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Microbenchmarks of the checked and clamped arithmetic and of the casts of
+// base/numerics, for the base_perftests target. Each arithmetic benchmark runs
+// for every integer width, for pairs of operands of which a given percentage
+// overflow, in random order. The *Portable benchmarks call the portable
+// implementations of checked_math_impl.h directly, so that they can be
+// compared against the builtins of safe_math_clang_gcc_impl.h, or the asm of
+// safe_math_arm_impl.h and safe_math_x86_impl.h, that the target selects. In
+// the same way, BM_SaturatedCastGeneric is the generic saturated_cast<>() that
+// the fast paths of safe_conversions_*_impl.h are compared against. Each
+// reports the time per operation in the time_per_op counter. Run with
+// --benchmark_format=json to get results that can be diffed across versions
+// or platforms, e.g. with tools/compare.py of google_benchmark.
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "base/numerics/checked_math.h"
+#include "base/numerics/clamped_math.h"
+#include "base/numerics/safe_conversions.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace base {
+
+namespace {
+
+constexpr size_t kNumOperands = 1024;
+
+template <typename T>
+struct Operands {
+  std::vector<T> a;
+  std::vector<T> b;
+};
+
+enum class Operation { kAdd, kSub, kMul, kDiv };
+
+// Returns operands of which |overflow_percentage| percent overflow |operation|,
+// and the others are small values of either sign, which are never zero, and
+// whose products don't overflow either. The quotients that overflow are those
+// of a division by zero, or of the lowest value by -1.
+template <typename T>
+Operands<T> MakeOperands(Operation operation, int overflow_percentage) {
+  using Limits = std::numeric_limits<T>;
+  // A fixed seed, so that runs are comparable.
+  std::mt19937_64 generator(42);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::uniform_int_distribution<int> sign(0, 1);
+  std::uniform_int_distribution<int64_t> small(
+      1, std::min<int64_t>(100, (int64_t{1} << (Limits::digits / 2)) - 1));
+  // The values above Limits::max() / 2 + 1, whose sums overflow even when
+  // negated, and the values above the square root of Limits::max(), whose
+  // products do.
+  std::uniform_int_distribution<uint64_t> large_addend(
+      Limits::max() / 2 + 2, Limits::max());
+  const uint64_t min_large_factor = uint64_t{1}
+                                    << ((Limits::digits + 1) / 2);
+  std::uniform_int_distribution<uint64_t> large_factor(min_large_factor,
+                                                       Limits::max());
+
+  Operands<T> operands;
+  for (size_t i = 0; i < kNumOperands; ++i) {
+    const bool overflow = percent(generator) < overflow_percentage;
+    const bool negative = std::is_signed_v<T> && sign(generator);
+    T a = static_cast<T>(small(generator));
+    T b = static_cast<T>(small(generator));
+    if (!overflow) {
+      // Unsigned differences of small values underflow, so those are ordered.
+      if (operation == Operation::kSub && !std::is_signed_v<T> && a < b) {
+        std::swap(a, b);
+      }
+      if (negative) {
+        a = static_cast<T>(T{0} - a);
+      }
+    } else {
+      switch (operation) {
+        case Operation::kAdd:
+          a = static_cast<T>(large_addend(generator));
+          b = static_cast<T>(large_addend(generator));
+          break;
+        case Operation::kSub:
+          // A large value minus one of the opposite sign, or a small unsigned
+          // value minus a larger one.
+          a = static_cast<T>(large_addend(generator));
+          b = std::is_signed_v<T> ? static_cast<T>(T{0} - a)
+                                  : static_cast<T>(a + 1u);
+          if constexpr (!std::is_signed_v<T>) {
+            a = static_cast<T>(small(generator));
+          }
+          break;
+        case Operation::kMul:
+          a = static_cast<T>(large_factor(generator));
+          b = static_cast<T>(large_factor(generator));
+          break;
+        case Operation::kDiv:
+          if (std::is_signed_v<T> && negative) {
+            a = Limits::lowest();
+            b = static_cast<T>(-1);
+          } else {
+            b = T{0};
+          }
+          break;
+      }
+      // Signed operands that overflow have the same sign, so both may be
+      // negated.
+      if (operation != Operation::kDiv && negative) {
+        a = static_cast<T>(T{0} - a);
+        b = static_cast<T>(T{0} - b);
+      }
+    }
+    operands.a.push_back(a);
+    operands.b.push_back(b);
+  }
+  return operands;
+}
+
+// Returns doubles of which |overflow_percentage| percent are out of the range
+// of T, and the others are in it, with fractions.
+template <typename T>
+std::vector<double> MakeDoubles(int overflow_percentage) {
+  using Limits = std::numeric_limits<T>;
+  std::mt19937_64 generator(42);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::uniform_real_distribution<double> in_range(
+      static_cast<double>(Limits::lowest()) / 2,
+      static_cast<double>(Limits::max()) / 2);
+  std::uniform_real_distribution<double> out_of_range(
+      static_cast<double>(Limits::max()) * 2,
+      static_cast<double>(Limits::max()) * 4 + 4);
+  std::uniform_int_distribution<int> sign(0, 1);
+  std::vector<double> values;
+  for (size_t i = 0; i < kNumOperands; ++i) {
+    if (percent(generator) < overflow_percentage) {
+      values.push_back((sign(generator) ? 1 : -1) * out_of_range(generator));
+    } else {
+      values.push_back(in_range(generator));
+    }
+  }
+  return values;
+}
+
+// Returns int64_t values in the range of T, or out of it for
+// |overflow_percentage| percent of them, if T doesn't hold all of them.
+template <typename T>
+std::vector<int64_t> MakeInt64s(int overflow_percentage) {
+  using Limits = std::numeric_limits<T>;
+  using Int64Limits = std::numeric_limits<int64_t>;
+  std::mt19937_64 generator(42);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::uniform_int_distribution<int64_t> in_range(
+      static_cast<int64_t>(Limits::lowest()),
+      static_cast<int64_t>(
+          std::min<uint64_t>(Limits::max(), Int64Limits::max())));
+  // The values below the range of T, which int64_t holds unless T is signed
+  // and as wide.
+  constexpr bool kHasOutOfRange = !std::is_signed_v<T> || sizeof(T) < 8u;
+  std::uniform_int_distribution<int64_t> out_of_range(
+      Int64Limits::lowest(), [] {
+        if constexpr (kHasOutOfRange) {
+          return static_cast<int64_t>(Limits::lowest()) - 1;
+        } else {
+          return Int64Limits::lowest();
+        }
+      }());
+  std::vector<int64_t> values;
+  for (size_t i = 0; i < kNumOperands; ++i) {
+    values.push_back(kHasOutOfRange && percent(generator) < overflow_percentage
+                         ? out_of_range(generator)
+                         : in_range(generator));
+  }
+  return values;
+}
+
+// The same limits as SaturationDefaultLimits, as a different type, so that
+// saturated_cast<>() takes the generic path with them.
+template <typename T>
+struct GenericDefaultLimits
+    : public numerics_internal::SaturationDefaultLimits<T> {};
+
+void SetTimePerOp(benchmark::State& state) {
+  state.counters["time_per_op"] = benchmark::Counter(
+      kNumOperands, benchmark::Counter::kIsIterationInvariantRate |
+                        benchmark::Counter::kInvert);
+}
+
+// Each iteration applies the operation to all the operands, so that the cost
+// of the loop is amortized.
+#define DEFINE_ARITHMETIC_BENCHMARK(NAME, OPERATION, EXPRESSION) \
+  template <typename T>                                          \
+  void BM_##NAME(benchmark::State& state) {                      \
+    const Operands<T> operands =                                 \
+        MakeOperands<T>(Operation::OPERATION, state.range(0));   \
+    for (auto _ : state) {                                       \
+      for (size_t i = 0; i < kNumOperands; ++i) {                \
+        const T a = operands.a[i];                               \
+        const T b = operands.b[i];                               \
+        benchmark::DoNotOptimize(EXPRESSION);                    \
+      }                                                          \
+    }                                                            \
+    SetTimePerOp(state);                                         \
+  }
+
+// The checked operations report whether they're valid as well as the result,
+// as their callers branch on it.
+template <typename T>
+struct CheckedResult {
+  bool is_valid;
+  T value;
+};
+
+#define CHECKED(EXPRESSION)         \
+  [&] {                             \
+    CheckedResult<T> result = {};   \
+    result.is_valid = (EXPRESSION); \
+    return result;                  \
+  }()
+
+DEFINE_ARITHMETIC_BENCHMARK(
+    CheckedAdd,
+    kAdd,
+    CHECKED(CheckAdd(a, b).AssignIfValid(&result.value)))
+DEFINE_ARITHMETIC_BENCHMARK(
+    CheckedSub,
+    kSub,
+    CHECKED(CheckSub(a, b).AssignIfValid(&result.value)))
+DEFINE_ARITHMETIC_BENCHMARK(
+    CheckedMul,
+    kMul,
+    CHECKED(CheckMul(a, b).AssignIfValid(&result.value)))
+DEFINE_ARITHMETIC_BENCHMARK(
+    CheckedDiv,
+    kDiv,
+    CHECKED(CheckDiv(a, b).AssignIfValid(&result.value)))
+DEFINE_ARITHMETIC_BENCHMARK(
+    CheckedAddPortable,
+    kAdd,
+    CHECKED(numerics_internal::CheckedAddImpl(a, b, &result.value)))
+DEFINE_ARITHMETIC_BENCHMARK(
+    CheckedSubPortable,
+    kSub,
+    CHECKED(numerics_internal::CheckedSubImpl(a, b, &result.value)))
+DEFINE_ARITHMETIC_BENCHMARK(
+    CheckedMulPortable,
+    kMul,
+    CHECKED(numerics_internal::CheckedMulImpl(a, b, &result.value)))
+DEFINE_ARITHMETIC_BENCHMARK(ClampedAdd, kAdd, static_cast<T>(ClampAdd(a, b)))
+DEFINE_ARITHMETIC_BENCHMARK(ClampedSub, kSub, static_cast<T>(ClampSub(a, b)))
+DEFINE_ARITHMETIC_BENCHMARK(ClampedMul, kMul, static_cast<T>(ClampMul(a, b)))
+DEFINE_ARITHMETIC_BENCHMARK(ClampedDiv, kDiv, static_cast<T>(ClampDiv(a, b)))
+
+#undef CHECKED
+#undef DEFINE_ARITHMETIC_BENCHMARK
+
+template <typename T>
+void BM_SaturatedCast(benchmark::State& state) {
+  const std::vector<double> values = MakeDoubles<T>(state.range(0));
+  for (auto _ : state) {
+    for (double value : values) {
+      benchmark::DoNotOptimize(saturated_cast<T>(value));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+template <typename T>
+void BM_SaturatedCastGeneric(benchmark::State& state) {
+  const std::vector<double> values = MakeDoubles<T>(state.range(0));
+  for (auto _ : state) {
+    for (double value : values) {
+      benchmark::DoNotOptimize(saturated_cast<T, GenericDefaultLimits>(value));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+template <typename T>
+void BM_SaturatedCastFromInt64(benchmark::State& state) {
+  const std::vector<int64_t> values = MakeInt64s<T>(state.range(0));
+  for (auto _ : state) {
+    for (int64_t value : values) {
+      benchmark::DoNotOptimize(saturated_cast<T>(value));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+// checked_cast<>() crashes on values out of range, so it only runs for values
+// in range, and the range checks that it branches on run for the others.
+template <typename T>
+void BM_CheckedCast(benchmark::State& state) {
+  const std::vector<int64_t> values = MakeInt64s<T>(0);
+  for (auto _ : state) {
+    for (int64_t value : values) {
+      benchmark::DoNotOptimize(checked_cast<T>(value));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+template <typename T>
+void BM_IsValueInRange(benchmark::State& state) {
+  const std::vector<int64_t> values = MakeInt64s<T>(state.range(0));
+  for (auto _ : state) {
+    for (int64_t value : values) {
+      benchmark::DoNotOptimize(IsValueInRangeForNumericType<T>(value));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+void OverflowPercentages(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"overflow_percentage"});
+  for (int percentage : {0, 1, 10, 50}) {
+    benchmark->Args({percentage});
+  }
+}
+
+#define BENCHMARK_INTEGER_WIDTHS(NAME)                            \
+  BENCHMARK_TEMPLATE(NAME, int8_t)->Apply(OverflowPercentages);   \
+  BENCHMARK_TEMPLATE(NAME, uint8_t)->Apply(OverflowPercentages);  \
+  BENCHMARK_TEMPLATE(NAME, int16_t)->Apply(OverflowPercentages);  \
+  BENCHMARK_TEMPLATE(NAME, uint16_t)->Apply(OverflowPercentages); \
+  BENCHMARK_TEMPLATE(NAME, int32_t)->Apply(OverflowPercentages);  \
+  BENCHMARK_TEMPLATE(NAME, uint32_t)->Apply(OverflowPercentages); \
+  BENCHMARK_TEMPLATE(NAME, int64_t)->Apply(OverflowPercentages);  \
+  BENCHMARK_TEMPLATE(NAME, uint64_t)->Apply(OverflowPercentages)
+
+BENCHMARK_INTEGER_WIDTHS(BM_CheckedAdd);
+BENCHMARK_INTEGER_WIDTHS(BM_CheckedAddPortable);
+BENCHMARK_INTEGER_WIDTHS(BM_CheckedSub);
+BENCHMARK_INTEGER_WIDTHS(BM_CheckedSubPortable);
+BENCHMARK_INTEGER_WIDTHS(BM_CheckedMul);
+BENCHMARK_INTEGER_WIDTHS(BM_CheckedMulPortable);
+BENCHMARK_INTEGER_WIDTHS(BM_CheckedDiv);
+BENCHMARK_INTEGER_WIDTHS(BM_ClampedAdd);
+BENCHMARK_INTEGER_WIDTHS(BM_ClampedSub);
+BENCHMARK_INTEGER_WIDTHS(BM_ClampedMul);
+BENCHMARK_INTEGER_WIDTHS(BM_ClampedDiv);
+BENCHMARK_INTEGER_WIDTHS(BM_SaturatedCast);
+BENCHMARK_INTEGER_WIDTHS(BM_SaturatedCastGeneric);
+BENCHMARK_INTEGER_WIDTHS(BM_SaturatedCastFromInt64);
+BENCHMARK_INTEGER_WIDTHS(BM_IsValueInRange);
+BENCHMARK_TEMPLATE(BM_CheckedCast, int8_t);
+BENCHMARK_TEMPLATE(BM_CheckedCast, uint8_t);
+BENCHMARK_TEMPLATE(BM_CheckedCast, int16_t);
+BENCHMARK_TEMPLATE(BM_CheckedCast, uint16_t);
+BENCHMARK_TEMPLATE(BM_CheckedCast, int32_t);
+BENCHMARK_TEMPLATE(BM_CheckedCast, uint32_t);
+BENCHMARK_TEMPLATE(BM_CheckedCast, int64_t);
+BENCHMARK_TEMPLATE(BM_CheckedCast, uint64_t);
+
+#undef BENCHMARK_INTEGER_WIDTHS
+
+}  // namespace
+
+}  // namespace base
@@ -10,13 +10,18 @@
 #include <cmath>
 #include <concepts>
 #include <limits>
+#include <span>
 #include <type_traits>
 
 #include "base/numerics/safe_conversions_impl.h"  // IWYU pragma: export
+#include "base/numerics/saturation_counters.h"
 
 #if defined(__ARMEL__)
 #include "base/numerics/safe_conversions_arm_impl.h"  // IWYU pragma: export
 #define BASE_HAS_OPTIMIZED_SAFE_CONVERSIONS (1)
+#elif (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#include "base/numerics/safe_conversions_x86_impl.h"  // IWYU pragma: export
+#define BASE_HAS_OPTIMIZED_SAFE_CONVERSIONS (1)
 #else
 #define BASE_HAS_OPTIMIZED_SAFE_CONVERSIONS (0)
 #endif
@@ -140,6 +145,10 @@ struct SaturationDefaultLimits : public std::numeric_limits<T> {
 
 template <typename Dst, template <typename> class S, typename Src>
 constexpr Dst saturated_cast_impl(Src value, RangeCheck constraint) {
+  if (!constraint.IsValid()) {
+    CountSaturation<S<Dst>>(constraint.IsOverflowFlagSet(),
+                            constraint.IsUnderflowFlagSet());
+  }
   // For some reason clang generates much better code when the branch is
   // structured exactly this way, rather than a sequence of checks.
   return !constraint.IsOverflowFlagSet()
@@ -152,8 +161,9 @@ constexpr Dst saturated_cast_impl(Src value, RangeCheck constraint) {
 }
 
 // We can reduce the number of conditions and get slightly better performance
-// for normal signed and unsigned integer ranges. And in the specific case of
-// Arm, we can use the optimized saturation instructions.
+// for normal signed and unsigned integer ranges. And in the specific cases of
+// Arm and of floating point values on x86, we can use the optimized
+// saturation instructions.
 template <typename Dst, typename Src>
 struct SaturateFastOp {
   static constexpr bool is_supported = false;
@@ -173,6 +183,16 @@ struct SaturateFastOp<Dst, Src> {
   }
 };
 
+template <typename Dst, typename Src>
+  requires(std::floating_point<Src> && std::integral<Dst> &&
+           SaturateFastAsmOp<Dst, Src>::is_supported)
+struct SaturateFastOp<Dst, Src> {
+  static constexpr bool is_supported = true;
+  static constexpr Dst Do(Src value) {
+    return SaturateFastAsmOp<Dst, Src>::Do(value);
+  }
+};
+
 template <typename Dst, typename Src>
   requires(std::integral<Src> && std::integral<Dst> &&
            !SaturateFastAsmOp<Dst, Src>::is_supported)
@@ -202,7 +222,8 @@ template <typename Dst,
 constexpr Dst saturated_cast(Src value) {
   using SrcType = UnderlyingType<Src>;
   const auto underlying_value = static_cast<SrcType>(value);
-  return !std::is_constant_evaluated() &&
+  // The fast paths don't count saturations.
+  return !std::is_constant_evaluated() && !kCountSaturations &&
                  SaturateFastOp<Dst, SrcType>::is_supported &&
                  std::is_same_v<SaturationHandler<Dst>,
                                 SaturationDefaultLimits<Dst>>
@@ -213,6 +234,75 @@ constexpr Dst saturated_cast(Src value) {
                        underlying_value));
 }
 
+// saturated_cast<>() of each of the floating point |values| into |results|,
+// which must have the same size. The bounds are checked with selects rather
+// than branches, so that the compiler can vectorize the loop with SIMD
+// compares and blends, e.g. for batches of mapped points.
+template <typename Dst,
+          template <typename> class SaturationHandler = SaturationDefaultLimits,
+          typename Src>
+  requires(std::floating_point<Src> && std::floating_point<Dst>)
+constexpr void SaturatedCastSpan(std::span<const Src> values,
+                                 std::span<Dst> results) {
+  if (values.size() != results.size()) {
+    CheckOnFailure::template HandleFailure<void>();
+  }
+  // The bounds are compared in the wider type, so that they don't overflow.
+  using Common = std::common_type_t<Src, Dst>;
+  using Handler = SaturationHandler<Dst>;
+  for (size_t i = 0; i < values.size(); ++i) {
+    const Common value = values[i];
+    if constexpr (kCountSaturations) {
+      const bool is_overflow = !(value <= static_cast<Common>(Handler::max()));
+      const bool is_underflow =
+          !(value >= static_cast<Common>(Handler::lowest()));
+      if (is_overflow || is_underflow) {
+        CountSaturation<Handler>(is_overflow, is_underflow);
+      }
+    }
+    const Dst in_range = static_cast<Dst>(value);
+    results[i] =
+        value != value
+            ? Handler::NaN()
+            : (value > static_cast<Common>(Handler::max())
+                   ? Handler::Overflow()
+                   : (value < static_cast<Common>(Handler::lowest())
+                          ? Handler::Underflow()
+                          : in_range));
+  }
+}
+
+// As above, for integral |results| with the default limits, so NaN becomes 0.
+template <typename Dst, typename Src>
+  requires(std::floating_point<Src> && std::integral<Dst>)
+constexpr void SaturatedCastSpan(std::span<const Src> values,
+                                 std::span<Dst> results) {
+  if (values.size() != results.size()) {
+    CheckOnFailure::template HandleFailure<void>();
+  }
+  // The bounds of the values that truncate into Dst, which are exact powers
+  // of two in Src. Values beyond them saturate.
+  constexpr Src kUpper =
+      static_cast<Src>(std::numeric_limits<Dst>::max() / 2 + 1) * 2;
+  constexpr Src kLower = static_cast<Src>(std::numeric_limits<Dst>::lowest());
+  for (size_t i = 0; i < values.size(); ++i) {
+    const Src value = values[i];
+    // NaN fails both comparisons, and is replaced by 0 before the conversion.
+    const bool is_in_range = (value < kUpper) & (value >= kLower);
+    if constexpr (kCountSaturations) {
+      if (!is_in_range) {
+        CountSaturation<SaturationDefaultLimits<Dst>>(!(value < kUpper),
+                                                      !(value >= kLower));
+      }
+    }
+    const Dst in_range = static_cast<Dst>(is_in_range ? value : Src(0));
+    results[i] = value >= kUpper ? std::numeric_limits<Dst>::max()
+                                 : (value < kLower
+                                        ? std::numeric_limits<Dst>::lowest()
+                                        : in_range);
+  }
+}
+
 // strict_cast<> is analogous to static_cast<> for numeric types, except that
 // it will cause a compile failure if the destination type is not large enough
 // to contain any value in the source type. It performs no runtime checking.
@@ -335,6 +425,7 @@ using numerics_internal::kIsTypeInRangeForNumericType;
 using numerics_internal::MakeStrictNum;
 using numerics_internal::SafeUnsignedAbs;
 using numerics_internal::saturated_cast;
+using numerics_internal::SaturatedCastSpan;
 using numerics_internal::strict_cast;
 using numerics_internal::StrictNumeric;
 
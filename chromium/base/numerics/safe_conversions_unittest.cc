@@ -0,0 +1,100 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/numerics/safe_conversions.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+namespace {
+
+// Values around the limits of each type, and the ones that don't saturate.
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+constexpr std::array<double, 17> kDoubles = {
+    0.0,
+    -0.0,
+    1.5,
+    -2.75,
+    kNaN,
+    kInfinity,
+    -kInfinity,
+    2147483647.0,
+    2147483647.5,
+    2147483648.0,
+    -2147483648.0,
+    -2147483648.75,
+    -2147483649.0,
+    static_cast<double>(std::numeric_limits<float>::max()) * 1.0000001,
+    -static_cast<double>(std::numeric_limits<float>::max()),
+    1e300,
+    -1e-300};
+
+template <typename Dst, typename Src, size_t N>
+void ExpectSameAsSaturatedCast(const std::array<Src, N>& values) {
+  std::array<Dst, N> results;
+  SaturatedCastSpan(std::span<const Src>(values), std::span<Dst>(results));
+  for (size_t i = 0; i < N; ++i) {
+    const Dst expected = saturated_cast<Dst>(values[i]);
+    if (expected != expected) {
+      EXPECT_NE(results[i], results[i]) << values[i];
+    } else {
+      EXPECT_EQ(expected, results[i]) << values[i];
+    }
+  }
+}
+
+// The same limits as SaturationDefaultLimits, as a different type, so that
+// saturated_cast<>() takes the generic path with them.
+template <typename T>
+struct GenericDefaultLimits
+    : public numerics_internal::SaturationDefaultLimits<T> {};
+
+}  // namespace
+
+TEST(SafeConversionsTest, SaturatedCastFloatToInt) {
+  // The fast paths of some targets convert first and check the range after,
+  // so these are around the limits of the conversions.
+  for (double value : kDoubles) {
+    EXPECT_EQ(saturated_cast<int32_t>(value),
+              (saturated_cast<int32_t, GenericDefaultLimits>(value)))
+        << value;
+    EXPECT_EQ(saturated_cast<int64_t>(value),
+              (saturated_cast<int64_t, GenericDefaultLimits>(value)))
+        << value;
+    const float float_value = static_cast<float>(value);
+    EXPECT_EQ(saturated_cast<int32_t>(float_value),
+              (saturated_cast<int32_t, GenericDefaultLimits>(float_value)))
+        << float_value;
+  }
+  EXPECT_EQ(saturated_cast<int64_t>(-9223372036854775808.0),
+            std::numeric_limits<int64_t>::lowest());
+  EXPECT_EQ(saturated_cast<int64_t>(9223372036854775808.0),
+            std::numeric_limits<int64_t>::max());
+}
+
+TEST(SafeConversionsTest, SaturatedCastSpanToFloat) {
+  ExpectSameAsSaturatedCast<float>(kDoubles);
+}
+
+TEST(SafeConversionsTest, SaturatedCastSpanToInt) {
+  ExpectSameAsSaturatedCast<int32_t>(kDoubles);
+  ExpectSameAsSaturatedCast<uint8_t>(kDoubles);
+  ExpectSameAsSaturatedCast<int64_t>(kDoubles);
+
+  std::array<float, kDoubles.size()> floats;
+  for (size_t i = 0; i < kDoubles.size(); ++i) {
+    floats[i] = static_cast<float>(kDoubles[i]);
+  }
+  ExpectSameAsSaturatedCast<int32_t>(floats);
+  ExpectSameAsSaturatedCast<uint32_t>(floats);
+}
+
+}  // namespace base
@@ -0,0 +1,69 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_NUMERICS_SAFE_CONVERSIONS_X86_IMPL_H_
+#define BASE_NUMERICS_SAFE_CONVERSIONS_X86_IMPL_H_
+
+// IWYU pragma: private, include "base/numerics/safe_conversions.h"
+
+#include <emmintrin.h>
+#include <stdint.h>
+
+#include <concepts>
+#include <limits>
+#include <type_traits>
+
+#include "base/numerics/safe_conversions_impl.h"
+
+namespace base {
+namespace numerics_internal {
+
+// Fast saturation of a float or double to a 32-bit or, on x86-64, a 64-bit
+// signed integer. The SSE2 truncating conversions round toward zero as
+// static_cast does, and give the lowest value of the destination (the
+// "integer indefinite" value) for NaN and for values out of range, so the
+// range is only checked when that is the result.
+template <typename Dst, typename Src>
+struct SaturateFastAsmOp {
+  static constexpr bool is_supported =
+      kEnableAsmCode &&
+      (std::same_as<Src, float> || std::same_as<Src, double>) &&
+      std::signed_integral<Dst> &&
+#if defined(__x86_64__)
+      (sizeof(Dst) == sizeof(int32_t) || sizeof(Dst) == sizeof(int64_t));
+#else
+      sizeof(Dst) == sizeof(int32_t);
+#endif
+
+  __attribute__((always_inline)) static Dst Do(Src value) {
+    Dst result;
+    if constexpr (sizeof(Dst) == sizeof(int32_t)) {
+      if constexpr (std::same_as<Src, float>) {
+        result = static_cast<Dst>(_mm_cvttss_si32(_mm_set_ss(value)));
+      } else {
+        result = static_cast<Dst>(_mm_cvttsd_si32(_mm_set_sd(value)));
+      }
+    } else {
+#if defined(__x86_64__)
+      if constexpr (std::same_as<Src, float>) {
+        result = static_cast<Dst>(_mm_cvttss_si64(_mm_set_ss(value)));
+      } else {
+        result = static_cast<Dst>(_mm_cvttsd_si64(_mm_set_sd(value)));
+      }
+#endif
+    }
+    if (result != std::numeric_limits<Dst>::lowest()) [[likely]] {
+      return result;
+    }
+    // The lowest value is also the conversion of the values that truncate to
+    // it, which are negative.
+    return value > 0 ? std::numeric_limits<Dst>::max()
+                     : (value < 0 ? std::numeric_limits<Dst>::lowest() : 0);
+  }
+};
+
+}  // namespace numerics_internal
+}  // namespace base
+
+#endif  // BASE_NUMERICS_SAFE_CONVERSIONS_X86_IMPL_H_
@@ -17,6 +17,9 @@
 #if defined(__ARMEL__)
 #include "base/numerics/safe_math_arm_impl.h"  // IWYU pragma: export
 #define BASE_HAS_ASSEMBLER_SAFE_MATH (1)
+#elif defined(__x86_64__) || defined(__i386__)
+#include "base/numerics/safe_math_x86_impl.h"  // IWYU pragma: export
+#define BASE_HAS_ASSEMBLER_SAFE_MATH (1)
 #else
 #define BASE_HAS_ASSEMBLER_SAFE_MATH (0)
 #endif
@@ -0,0 +1,94 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_NUMERICS_SAFE_MATH_X86_IMPL_H_
+#define BASE_NUMERICS_SAFE_MATH_X86_IMPL_H_
+
+// IWYU pragma: private
+
+#include <stdint.h>
+
+#include "base/numerics/safe_conversions.h"
+
+namespace base::numerics_internal {
+
+// x86 has no scalar saturating arithmetic, but its flags make the overflow
+// builtins a single instruction and a branch, so checked multiplication
+// keeps using them.
+template <typename T, typename U>
+struct CheckedMulFastAsmOp {
+  static const bool is_supported = false;
+  template <typename V>
+  static constexpr bool Do(T, U, V*) {
+    // Force a compile failure if instantiated.
+    return CheckOnFailure::template HandleFailure<bool>();
+  }
+};
+
+// The clamped operations on types of up to 32 bits are done exactly in a
+// signed type of twice the width, which x86-64 and x86 (in a register pair)
+// compute directly, and the result is saturated with compares and
+// conditional moves instead of a branch on the overflow flag.
+template <typename T, typename U>
+using ClampedFastAsmPromotion =
+    TwiceWiderInteger<MaxExponentPromotion<T, U>, true>;
+
+template <typename T, typename U>
+struct ClampedAddFastAsmOp {
+  static constexpr bool is_supported =
+      kEnableAsmCode && kIsFastIntegerArithmeticPromotionContained<T, U>;
+
+  template <typename V>
+  __attribute__((always_inline)) static V Do(T x, U y) {
+    if constexpr (kIsFastIntegerArithmeticPromotionContained<T, U>) {
+      using Promotion = ClampedFastAsmPromotion<T, U>;
+      return saturated_cast<V>(static_cast<Promotion>(x) +
+                               static_cast<Promotion>(y));
+    } else {
+      // Force a compile failure if instantiated.
+      return CheckOnFailure::template HandleFailure<V>();
+    }
+  }
+};
+
+template <typename T, typename U>
+struct ClampedSubFastAsmOp {
+  static constexpr bool is_supported =
+      kEnableAsmCode && kIsFastIntegerArithmeticPromotionContained<T, U>;
+
+  template <typename V>
+  __attribute__((always_inline)) static V Do(T x, U y) {
+    if constexpr (kIsFastIntegerArithmeticPromotionContained<T, U>) {
+      using Promotion = ClampedFastAsmPromotion<T, U>;
+      return saturated_cast<V>(static_cast<Promotion>(x) -
+                               static_cast<Promotion>(y));
+    } else {
+      // Force a compile failure if instantiated.
+      return CheckOnFailure::template HandleFailure<V>();
+    }
+  }
+};
+
+template <typename T, typename U>
+struct ClampedMulFastAsmOp {
+  static constexpr bool is_supported =
+      kEnableAsmCode && kIsFastIntegerArithmeticPromotionContained<T, U>;
+
+  template <typename V>
+  __attribute__((always_inline)) static V Do(T x, U y) {
+    if constexpr (kIsFastIntegerArithmeticPromotionContained<T, U>) {
+      // Unsigned products of 32 bits only fit in an unsigned promotion.
+      using Promotion = FastIntegerArithmeticPromotion<T, U>;
+      return saturated_cast<V>(static_cast<Promotion>(x) *
+                               static_cast<Promotion>(y));
+    } else {
+      // Force a compile failure if instantiated.
+      return CheckOnFailure::template HandleFailure<V>();
+    }
+  }
+};
+
+}  // namespace base::numerics_internal
+
+#endif  // BASE_NUMERICS_SAFE_MATH_X86_IMPL_H_
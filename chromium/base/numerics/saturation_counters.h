@@ -0,0 +1,100 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_NUMERICS_SATURATION_COUNTERS_H_
+#define BASE_NUMERICS_SATURATION_COUNTERS_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <type_traits>
+
+// Counts of the values that saturated_cast<>() saturates or replaces for NaN,
+// for each saturation handler and destination type, e.g.
+// SaturationDefaultLimits<int> or gfx::FloatGeometrySaturationHandler<float>.
+// They show which handlers, and so which kinds of arithmetic, keep falling
+// off their fast paths.
+//
+// Counting is off unless BASE_NUMERICS_COUNT_SATURATIONS is defined to 1 for
+// the whole build, as it disables the fast saturated_cast<>() paths and adds
+// an atomic increment to every saturation. When it's off, nothing is counted
+// and ForEachSaturationCounts() finds no counts.
+#if !defined(BASE_NUMERICS_COUNT_SATURATIONS)
+#define BASE_NUMERICS_COUNT_SATURATIONS 0
+#endif
+
+namespace base {
+namespace numerics_internal {
+
+inline constexpr bool kCountSaturations = BASE_NUMERICS_COUNT_SATURATIONS;
+
+// The counts of one saturation handler, for a destination type.
+struct SaturationCounts {
+  // The signature of the function template that counts for the handler,
+  // which names it and the destination type.
+  const char* handler;
+  std::atomic<uint64_t> overflows{0};
+  std::atomic<uint64_t> underflows{0};
+  std::atomic<uint64_t> nans{0};
+  // The counts of the handler that was next to saturate for the first time.
+  SaturationCounts* next = nullptr;
+};
+
+// The counts of the handlers that have saturated, newest first.
+inline std::atomic<SaturationCounts*> g_saturation_counts{nullptr};
+
+// Returns the counts of |Handler|, added to |g_saturation_counts| the first
+// time that it saturates. They are never freed, so that they can be dumped at
+// any time.
+template <typename Handler>
+SaturationCounts& GetSaturationCounts() {
+  static SaturationCounts* const counts = [] {
+    SaturationCounts* new_counts =
+        new SaturationCounts{.handler = __PRETTY_FUNCTION__};
+    new_counts->next = g_saturation_counts.load(std::memory_order_relaxed);
+    while (!g_saturation_counts.compare_exchange_weak(
+        new_counts->next, new_counts, std::memory_order_release,
+        std::memory_order_relaxed)) {
+    }
+    return new_counts;
+  }();
+  return *counts;
+}
+
+// Counts a saturation by |Handler|, given the flags of the failed range check.
+// Both flags are set for NaN.
+template <typename Handler>
+constexpr void CountSaturation(bool is_overflow, bool is_underflow) {
+  if constexpr (kCountSaturations) {
+    if (std::is_constant_evaluated()) {
+      return;
+    }
+    SaturationCounts& counts = GetSaturationCounts<Handler>();
+    std::atomic<uint64_t>& count =
+        is_overflow ? (is_underflow ? counts.nans : counts.overflows)
+                    : counts.underflows;
+    count.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+// Calls |function| with the counts of each handler that has saturated, e.g.
+// to log them at the end of a test run or of a page load.
+template <typename Function>
+void ForEachSaturationCounts(Function function) {
+  for (const SaturationCounts* counts =
+           g_saturation_counts.load(std::memory_order_acquire);
+       counts; counts = counts->next) {
+    function(*counts);
+  }
+}
+
+}  // namespace numerics_internal
+
+using numerics_internal::CountSaturation;
+using numerics_internal::ForEachSaturationCounts;
+using numerics_internal::SaturationCounts;
+
+}  // namespace base
+
+#endif  // BASE_NUMERICS_SATURATION_COUNTERS_H_
@@ -0,0 +1,69 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/numerics/saturation_counters.h"
+
+#include <stdint.h>
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <span>
+
+#include "base/numerics/safe_conversions.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+namespace {
+
+// Limits that only this test uses, so that their counts are its own.
+template <typename T>
+struct CountedTestLimits
+    : public numerics_internal::SaturationDefaultLimits<T> {};
+
+}  // namespace
+
+TEST(SaturationCountersTest, CountsEachKind) {
+  // Constant evaluation never counts.
+  static_assert(saturated_cast<int8_t, CountedTestLimits>(1000) == 127);
+
+  EXPECT_EQ((saturated_cast<int8_t, CountedTestLimits>(1000)), 127);
+  EXPECT_EQ((saturated_cast<int8_t, CountedTestLimits>(200.5)), 127);
+  EXPECT_EQ((saturated_cast<int8_t, CountedTestLimits>(-1000)), -128);
+  EXPECT_EQ((saturated_cast<int8_t, CountedTestLimits>(
+                std::numeric_limits<double>::quiet_NaN())),
+            0);
+  EXPECT_EQ((saturated_cast<int8_t, CountedTestLimits>(12)), 12);
+
+  const std::array<double, 3> values = {
+      -1e300, 1.0, std::numeric_limits<double>::infinity()};
+  std::array<float, 3> results;
+  SaturatedCastSpan<float, CountedTestLimits>(std::span<const double>(values),
+                                              std::span<float>(results));
+
+  // The int8_t and the float limits are counted separately.
+  size_t handlers = 0;
+  uint64_t overflows = 0;
+  uint64_t underflows = 0;
+  uint64_t nans = 0;
+  ForEachSaturationCounts([&](const SaturationCounts& counts) {
+    if (strstr(counts.handler, "CountedTestLimits")) {
+      ++handlers;
+      overflows += counts.overflows;
+      underflows += counts.underflows;
+      nans += counts.nans;
+    }
+  });
+  if (!numerics_internal::kCountSaturations) {
+    EXPECT_EQ(handlers, 0u);
+    return;
+  }
+  EXPECT_EQ(handlers, 2u);
+  EXPECT_EQ(overflows, 3u);
+  EXPECT_EQ(underflows, 2u);
+  EXPECT_EQ(nans, 1u);
+}
+
+}  // namespace base
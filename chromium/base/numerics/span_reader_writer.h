@@ -0,0 +1,297 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_NUMERICS_SPAN_READER_WRITER_H_
+#define BASE_NUMERICS_SPAN_READER_WRITER_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+#include "base/numerics/basic_ops_impl.h"
+#include "base/numerics/byte_conversions.h"
+
+namespace base {
+
+namespace numerics_internal {
+
+// The numbers that SpanReader and SpanWriter decode and encode.
+template <class T>
+concept SpanEncodable = std::is_arithmetic_v<T> && !std::same_as<T, bool>;
+
+template <SpanEncodable T>
+constexpr T ValueFromBytes(std::span<const uint8_t, sizeof(T)> bytes,
+                           std::endian endian) {
+  EncodingType<T> encoding = FromLittleEndian<EncodingType<T>>(bytes);
+  if (endian == std::endian::big) {
+    encoding = std::byteswap(encoding);
+  }
+  return std::bit_cast<T>(encoding);
+}
+
+template <SpanEncodable T>
+constexpr std::array<uint8_t, sizeof(T)> ValueToBytes(T value,
+                                                      std::endian endian) {
+  EncodingType<T> encoding = std::bit_cast<EncodingType<T>>(value);
+  if (endian == std::endian::big) {
+    encoding = std::byteswap(encoding);
+  }
+  return ToLittleEndian(encoding);
+}
+
+}  // namespace numerics_internal
+
+// Reads bytes and numbers from the front of a span of bytes, in sequence,
+// e.g. to parse a message or a file format:
+//
+//   SpanReader reader(bytes);
+//   uint32_t count;
+//   std::array<double, 16> matrix;
+//   if (!reader.ReadBigEndian(count) || !reader.ReadDoublesBigEndian(matrix)) {
+//     return false;
+//   }
+//
+// Each read that needs more bytes than remain fails, returning false or
+// nullopt without moving past any of them, so reads never go out of bounds.
+// Read() returns views of the bytes, without copying them.
+//
+// Each read checks its bounds once, so arrays of numbers are best read with
+// the bulk functions, e.g. ReadFloatsBigEndian(), which decode them in
+// vectorized loops. Records of a fixed layout can also be read with a single
+// check: Read<N>() returns a fixed-size span, from whose subspans of fixed
+// offsets the functions of byte_conversions.h decode the fields.
+class SpanReader {
+ public:
+  constexpr explicit SpanReader(std::span<const uint8_t> bytes)
+      : remaining_(bytes) {}
+
+  // Returns the next `n` bytes and moves past them, or nullopt if fewer than
+  // `n` remain.
+  constexpr std::optional<std::span<const uint8_t>> Read(size_t n) {
+    if (n > remaining_.size()) {
+      return std::nullopt;
+    }
+    const std::span<const uint8_t> bytes = remaining_.first(n);
+    remaining_ = remaining_.subspan(n);
+    num_read_ += n;
+    return bytes;
+  }
+  template <size_t N>
+  constexpr std::optional<std::span<const uint8_t, N>> Read() {
+    std::optional<std::span<const uint8_t>> bytes = Read(N);
+    if (!bytes) {
+      return std::nullopt;
+    }
+    return bytes->template first<N>();
+  }
+
+  // Moves past the next `n` bytes, and returns whether as many remained.
+  constexpr bool Skip(size_t n) { return Read(n).has_value(); }
+
+  // Reads the next number from its big-endian, little-endian or native-endian
+  // encoding into `value`, and returns whether there were enough bytes. On
+  // failure, `value` is left unchanged.
+  template <numerics_internal::SpanEncodable T>
+  constexpr bool ReadBigEndian(T& value) {
+    return ReadValue(value, std::endian::big);
+  }
+  template <numerics_internal::SpanEncodable T>
+  constexpr bool ReadLittleEndian(T& value) {
+    return ReadValue(value, std::endian::little);
+  }
+  template <numerics_internal::SpanEncodable T>
+  constexpr bool ReadNativeEndian(T& value) {
+    return ReadValue(value, std::endian::native);
+  }
+
+  // Reads the next `values.size()` numbers from their encodings into
+  // `values`, and returns whether there were enough bytes for all of them.
+  // On failure, nothing is read.
+  bool ReadFloatsBigEndian(std::span<float> values) {
+    return ReadValues(values, std::endian::big);
+  }
+  bool ReadDoublesBigEndian(std::span<double> values) {
+    return ReadValues(values, std::endian::big);
+  }
+  bool ReadFloatsLittleEndian(std::span<float> values) {
+    return ReadValues(values, std::endian::little);
+  }
+  bool ReadDoublesLittleEndian(std::span<double> values) {
+    return ReadValues(values, std::endian::little);
+  }
+  bool ReadFloatsNativeEndian(std::span<float> values) {
+    return ReadValues(values, std::endian::native);
+  }
+  bool ReadDoublesNativeEndian(std::span<double> values) {
+    return ReadValues(values, std::endian::native);
+  }
+
+  // The bytes that haven't been read yet.
+  constexpr std::span<const uint8_t> remaining_span() const {
+    return remaining_;
+  }
+  constexpr size_t remaining() const { return remaining_.size(); }
+  constexpr size_t num_read() const { return num_read_; }
+
+ private:
+  template <class T>
+  constexpr bool ReadValue(T& value, std::endian endian) {
+    std::optional<std::span<const uint8_t, sizeof(T)>> bytes =
+        Read<sizeof(T)>();
+    if (!bytes) {
+      return false;
+    }
+    value = numerics_internal::ValueFromBytes<T>(*bytes, endian);
+    return true;
+  }
+
+  template <class T>
+  bool ReadValues(std::span<T> values, std::endian endian) {
+    std::optional<std::span<const uint8_t>> bytes = Read(values.size_bytes());
+    if (!bytes) {
+      return false;
+    }
+    // Chromium only runs on little-endian machines, see byte_conversions.h,
+    // so the little-endian and native encodings are plain copies.
+    if (endian == std::endian::big) {
+      numerics_internal::FromBigEndianArray(*bytes, values);
+    } else if (!values.empty()) {
+      memcpy(values.data(), bytes->data(), bytes->size());
+    }
+    return true;
+  }
+
+  std::span<const uint8_t> remaining_;
+  size_t num_read_ = 0u;
+};
+
+// Writes bytes and numbers into the front of a span of bytes, in sequence,
+// e.g. to serialize a message into a buffer:
+//
+//   SpanWriter writer(buffer);
+//   if (!writer.WriteBigEndian(uint32_t{16}) ||
+//       !writer.WriteDoublesBigEndian(matrix)) {
+//     return false;
+//   }
+//   Send(buffer.first(writer.num_written()));
+//
+// Each write that needs more bytes than remain fails, returning false or
+// nullopt without writing any of them, so writes never go out of bounds.
+// Skip() returns views of the skipped bytes, e.g. to fill them in place, or
+// later with the length of what follows them.
+//
+// As with SpanReader, each write checks its bounds once, so arrays of numbers
+// are best written with the bulk functions, e.g. WriteFloatsBigEndian().
+class SpanWriter {
+ public:
+  constexpr explicit SpanWriter(std::span<uint8_t> bytes) : remaining_(bytes) {}
+
+  // Copies `bytes` and moves past them, and returns whether they all fit.
+  constexpr bool Write(std::span<const uint8_t> bytes) {
+    std::optional<std::span<uint8_t>> destination = Skip(bytes.size());
+    if (!destination) {
+      return false;
+    }
+    for (size_t i = 0u; i < bytes.size(); ++i) {
+      (*destination)[i] = bytes[i];
+    }
+    return true;
+  }
+
+  // Returns the next `n` bytes and moves past them, unchanged, or nullopt if
+  // fewer than `n` remain.
+  constexpr std::optional<std::span<uint8_t>> Skip(size_t n) {
+    if (n > remaining_.size()) {
+      return std::nullopt;
+    }
+    const std::span<uint8_t> bytes = remaining_.first(n);
+    remaining_ = remaining_.subspan(n);
+    num_written_ += n;
+    return bytes;
+  }
+  template <size_t N>
+  constexpr std::optional<std::span<uint8_t, N>> Skip() {
+    std::optional<std::span<uint8_t>> bytes = Skip(N);
+    if (!bytes) {
+      return std::nullopt;
+    }
+    return bytes->template first<N>();
+  }
+
+  // Writes the big-endian, little-endian or native-endian encoding of
+  // `value`, and returns whether it fit.
+  template <numerics_internal::SpanEncodable T>
+  constexpr bool WriteBigEndian(T value) {
+    return WriteValue(value, std::endian::big);
+  }
+  template <numerics_internal::SpanEncodable T>
+  constexpr bool WriteLittleEndian(T value) {
+    return WriteValue(value, std::endian::little);
+  }
+  template <numerics_internal::SpanEncodable T>
+  constexpr bool WriteNativeEndian(T value) {
+    return WriteValue(value, std::endian::native);
+  }
+
+  // Writes the encodings of `values`, and returns whether they all fit. On
+  // failure, nothing is written.
+  bool WriteFloatsBigEndian(std::span<const float> values) {
+    return WriteValues(values, std::endian::big);
+  }
+  bool WriteDoublesBigEndian(std::span<const double> values) {
+    return WriteValues(values, std::endian::big);
+  }
+  bool WriteFloatsLittleEndian(std::span<const float> values) {
+    return WriteValues(values, std::endian::little);
+  }
+  bool WriteDoublesLittleEndian(std::span<const double> values) {
+    return WriteValues(values, std::endian::little);
+  }
+  bool WriteFloatsNativeEndian(std::span<const float> values) {
+    return WriteValues(values, std::endian::native);
+  }
+  bool WriteDoublesNativeEndian(std::span<const double> values) {
+    return WriteValues(values, std::endian::native);
+  }
+
+  // The bytes that haven't been written yet.
+  constexpr std::span<uint8_t> remaining_span() const { return remaining_; }
+  constexpr size_t remaining() const { return remaining_.size(); }
+  constexpr size_t num_written() const { return num_written_; }
+
+ private:
+  template <class T>
+  constexpr bool WriteValue(T value, std::endian endian) {
+    return Write(numerics_internal::ValueToBytes(value, endian));
+  }
+
+  template <class T>
+  bool WriteValues(std::span<const T> values, std::endian endian) {
+    std::optional<std::span<uint8_t>> bytes = Skip(values.size_bytes());
+    if (!bytes) {
+      return false;
+    }
+    // The little-endian and native encodings are plain copies, as above.
+    if (endian == std::endian::big) {
+      numerics_internal::ToBigEndianArray(values, *bytes);
+    } else if (!values.empty()) {
+      memcpy(bytes->data(), values.data(), bytes->size());
+    }
+    return true;
+  }
+
+  std::span<uint8_t> remaining_;
+  size_t num_written_ = 0u;
+};
+
+}  // namespace base
+
+#endif  // BASE_NUMERICS_SPAN_READER_WRITER_H_
@@ -0,0 +1,138 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/numerics/span_reader_writer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "base/numerics/byte_conversions.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+TEST(SpanReaderWriterTest, Values) {
+  std::array<uint8_t, 32u> buffer = {};
+  SpanWriter writer(buffer);
+  EXPECT_TRUE(writer.WriteBigEndian(uint16_t{0x0102}));
+  EXPECT_TRUE(writer.WriteLittleEndian(int32_t{-2}));
+  EXPECT_TRUE(writer.WriteNativeEndian(uint8_t{7}));
+  EXPECT_TRUE(writer.WriteBigEndian(1.5f));
+  EXPECT_TRUE(writer.WriteBigEndian(-0.25));
+  EXPECT_TRUE(writer.Write(std::array<uint8_t, 3u>{9u, 8u, 7u}));
+  EXPECT_EQ(writer.num_written(), 22u);
+  EXPECT_EQ(writer.remaining(), 10u);
+
+  // The encodings are those of byte_conversions.h.
+  EXPECT_EQ(U16FromBigEndian(std::span(buffer).first<2u>()), 0x0102u);
+  EXPECT_EQ(I32FromLittleEndian(std::span(buffer).subspan<2u, 4u>()), -2);
+  EXPECT_EQ(FloatFromBigEndian(std::span(buffer).subspan<7u, 4u>()), 1.5f);
+  EXPECT_EQ(DoubleFromBigEndian(std::span(buffer).subspan<11u, 8u>()), -0.25);
+
+  SpanReader reader(buffer);
+  uint16_t u16 = 0u;
+  int32_t i32 = 0;
+  uint8_t u8 = 0u;
+  float f = 0.0f;
+  double d = 0.0;
+  EXPECT_TRUE(reader.ReadBigEndian(u16));
+  EXPECT_TRUE(reader.ReadLittleEndian(i32));
+  EXPECT_TRUE(reader.ReadNativeEndian(u8));
+  EXPECT_TRUE(reader.ReadBigEndian(f));
+  EXPECT_TRUE(reader.ReadBigEndian(d));
+  EXPECT_EQ(u16, 0x0102u);
+  EXPECT_EQ(i32, -2);
+  EXPECT_EQ(u8, 7u);
+  EXPECT_EQ(f, 1.5f);
+  EXPECT_EQ(d, -0.25);
+
+  std::optional<std::span<const uint8_t, 3u>> bytes = reader.Read<3u>();
+  ASSERT_TRUE(bytes);
+  EXPECT_EQ(bytes->data(), buffer.data() + 19u);
+  EXPECT_EQ((*bytes)[0u], 9u);
+  EXPECT_EQ(reader.num_read(), 22u);
+  EXPECT_EQ(reader.remaining(), 10u);
+}
+
+TEST(SpanReaderWriterTest, Arrays) {
+  // A column-major matrix, as from gfx::Transform::GetColMajor().
+  std::array<double, 16u> matrix;
+  std::array<float, 5u> floats;
+  for (size_t i = 0u; i < matrix.size(); ++i) {
+    matrix[i] = static_cast<double>(i) * -1.25;
+  }
+  for (size_t i = 0u; i < floats.size(); ++i) {
+    floats[i] = static_cast<float>(i) + 0.5f;
+  }
+
+  std::array<uint8_t, 16u * 8u * 2u + 5u * 4u * 2u> buffer;
+  SpanWriter writer(buffer);
+  EXPECT_TRUE(writer.WriteDoublesBigEndian(matrix));
+  EXPECT_TRUE(writer.WriteFloatsBigEndian(floats));
+  EXPECT_TRUE(writer.WriteDoublesNativeEndian(matrix));
+  EXPECT_TRUE(writer.WriteFloatsLittleEndian(floats));
+  EXPECT_EQ(writer.remaining(), 0u);
+  for (size_t i = 0u; i < matrix.size(); ++i) {
+    const auto bytes = std::span(buffer).subspan(i * 8u).first<8u>();
+    EXPECT_EQ(DoubleFromBigEndian(bytes), matrix[i]);
+  }
+
+  SpanReader reader(buffer);
+  std::array<double, 16u> big_endian_matrix;
+  std::array<float, 5u> big_endian_floats;
+  std::array<double, 16u> native_matrix;
+  std::array<float, 5u> little_endian_floats;
+  EXPECT_TRUE(reader.ReadDoublesBigEndian(big_endian_matrix));
+  EXPECT_TRUE(reader.ReadFloatsBigEndian(big_endian_floats));
+  EXPECT_TRUE(reader.ReadDoublesNativeEndian(native_matrix));
+  EXPECT_TRUE(reader.ReadFloatsLittleEndian(little_endian_floats));
+  EXPECT_EQ(big_endian_matrix, matrix);
+  EXPECT_EQ(native_matrix, matrix);
+  EXPECT_EQ(big_endian_floats, floats);
+  EXPECT_EQ(little_endian_floats, floats);
+  EXPECT_EQ(reader.remaining(), 0u);
+
+}
+
+TEST(SpanReaderWriterTest, OutOfBounds) {
+  std::array<uint8_t, 6u> buffer = {1u, 2u, 3u, 4u, 5u, 6u};
+  SpanReader reader(buffer);
+  uint32_t u32 = 0u;
+  EXPECT_TRUE(reader.ReadBigEndian(u32));
+  EXPECT_EQ(u32, 0x01020304u);
+
+  // The reads that fail leave the reader and the values as they were.
+  uint64_t u64 = 42u;
+  std::array<float, 1u> floats = {3.0f};
+  EXPECT_FALSE(reader.ReadBigEndian(u32));
+  EXPECT_FALSE(reader.ReadLittleEndian(u64));
+  EXPECT_FALSE(reader.ReadFloatsBigEndian(floats));
+  EXPECT_FALSE(reader.Read(3u));
+  EXPECT_FALSE(reader.Skip(3u));
+  EXPECT_EQ(u32, 0x01020304u);
+  EXPECT_EQ(u64, 42u);
+  EXPECT_EQ(floats[0u], 3.0f);
+  EXPECT_EQ(reader.remaining(), 2u);
+  EXPECT_TRUE(reader.Skip(2u));
+  EXPECT_TRUE(reader.Read(0u));
+  EXPECT_EQ(reader.num_read(), 6u);
+
+  SpanWriter writer(buffer);
+  std::optional<std::span<uint8_t, 2u>> length = writer.Skip<2u>();
+  ASSERT_TRUE(length);
+  EXPECT_FALSE(writer.WriteBigEndian(uint64_t{0}));
+  EXPECT_FALSE(writer.WriteDoublesBigEndian(std::array<double, 1u>{1.0}));
+  EXPECT_FALSE(writer.Write(std::array<uint8_t, 5u>{}));
+  EXPECT_EQ(buffer, (std::array<uint8_t, 6u>{1u, 2u, 3u, 4u, 5u, 6u}));
+  EXPECT_TRUE(writer.WriteLittleEndian(uint32_t{0}));
+  EXPECT_FALSE(writer.WriteNativeEndian(uint8_t{0}));
+  std::ranges::copy(U16ToBigEndian(4u), length->begin());
+  EXPECT_EQ(buffer, (std::array<uint8_t, 6u>{0u, 4u, 0u, 0u, 0u, 0u}));
+  EXPECT_EQ(writer.num_written(), 6u);
+}
+
+}  // namespace base
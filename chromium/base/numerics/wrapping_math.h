@@ -5,6 +5,7 @@
 #ifndef BASE_NUMERICS_WRAPPING_MATH_H_
 #define BASE_NUMERICS_WRAPPING_MATH_H_
 
+#include <bit>
 #include <type_traits>
 
 namespace base {
@@ -17,8 +18,8 @@ inline constexpr T WrappingAdd(T a, T b) {
   // Unsigned arithmetic wraps, so convert to the corresponding unsigned type.
   // Note that, if `T` is smaller than `int`, e.g. `int16_t`, the values are
   // promoted to `int`, which brings us back to undefined overflow. This is fine
-  // here because the sum of any two `int16_t`s fits in `int`, but `WrappingMul`
-  // will need a more complex implementation.
+  // here because the sum of any two `int16_t`s fits in `int`, unlike their
+  // product, see `WrappingMul`.
   using Unsigned = std::make_unsigned_t<T>;
   return static_cast<T>(static_cast<Unsigned>(a) + static_cast<Unsigned>(b));
 }
@@ -31,12 +32,43 @@ inline constexpr T WrappingSub(T a, T b) {
   // Unsigned arithmetic wraps, so convert to the corresponding unsigned type.
   // Note that, if `T` is smaller than `int`, e.g. `int16_t`, the values are
   // promoted to `int`, which brings us back to undefined overflow. This is fine
-  // here because the difference of any two `int16_t`s fits in `int`, but
-  // `WrappingMul` will need a more complex implementation.
+  // here because the difference of any two `int16_t`s fits in `int`, unlike
+  // their product, see `WrappingMul`.
   using Unsigned = std::make_unsigned_t<T>;
   return static_cast<T>(static_cast<Unsigned>(a) - static_cast<Unsigned>(b));
 }
 
+// Returns `a * b` with overflow defined to wrap around, i.e. modulo 2^N where N
+// is the bit width of `T`.
+template <typename T>
+inline constexpr T WrappingMul(T a, T b) {
+  static_assert(std::is_integral_v<T>);
+  // As above, but the product of two `uint16_t`s promoted to `int` may
+  // overflow it, so types smaller than `unsigned int` are multiplied as it.
+  using Unsigned = std::make_unsigned_t<T>;
+  using Promoted = std::conditional_t<(sizeof(T) < sizeof(unsigned int)),
+                                      unsigned int, Unsigned>;
+  return static_cast<T>(static_cast<Promoted>(a) * static_cast<Promoted>(b));
+}
+
+// Returns the bits of `a` rotated left by `shift`, i.e. shifted left with the
+// high bits that are shifted out wrapping around into the low bits. `shift` is
+// modulo the bit width of `T`, and may be negative to rotate right.
+template <typename T>
+inline constexpr T RotateLeft(T a, int shift) {
+  static_assert(std::is_integral_v<T>);
+  using Unsigned = std::make_unsigned_t<T>;
+  return static_cast<T>(std::rotl(static_cast<Unsigned>(a), shift));
+}
+
+// Returns the bits of `a` rotated right by `shift`. See `RotateLeft`.
+template <typename T>
+inline constexpr T RotateRight(T a, int shift) {
+  static_assert(std::is_integral_v<T>);
+  using Unsigned = std::make_unsigned_t<T>;
+  return static_cast<T>(std::rotr(static_cast<Unsigned>(a), shift));
+}
+
 }  // namespace base
 
 #endif  // BASE_NUMERICS_WRAPPING_MATH_H_
@@ -0,0 +1,136 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef BASE_NUMERICS_WRAPPING_VEC_H_
+#define BASE_NUMERICS_WRAPPING_VEC_H_
+
+#include <stddef.h>
+
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include "base/numerics/wrapping_math.h"
+
+namespace base {
+namespace numerics_internal {
+
+// The vector extension type of N unsigned lanes of the size of T. It's
+// declared outside of WrappingVec, so that GCC doesn't confuse it with T while
+// parsing it.
+template <typename T, size_t N>
+struct WrappingVecTypes {
+  typedef std::make_unsigned_t<T> UnsignedVector
+      __attribute__((vector_size(N * sizeof(T))));
+};
+
+// N lanes of T, with the semantics of WrappingAdd(), WrappingSub(),
+// WrappingMul(), RotateLeft() and RotateRight() in each lane, e.g. to mix the
+// fields of geometry keys into hashes four at a time. The lanes are a vector
+// extension type, which the compiler maps to the SIMD registers of the target,
+// and are unsigned whatever T is, so that signed lanes wrap without undefined
+// behavior.
+template <typename T, size_t N>
+  requires(std::integral<T> && !std::same_as<T, bool> &&
+           std::has_single_bit(N) && N * sizeof(T) <= 64u)
+class WrappingVec {
+ public:
+  using type = T;
+
+  static constexpr size_t kLanes = N;
+
+  constexpr WrappingVec() = default;
+  // Each lane holds |value|.
+  constexpr explicit WrappingVec(T value)
+      : lanes_(UnsignedVector{} + static_cast<Unsigned>(value)) {}
+
+  static WrappingVec Load(std::span<const T, N> values) {
+    WrappingVec vec;
+    for (size_t i = 0u; i < N; ++i) {
+      vec.lanes_[i] = static_cast<Unsigned>(values[i]);
+    }
+    return vec;
+  }
+  void Store(std::span<T, N> values) const {
+    for (size_t i = 0u; i < N; ++i) {
+      values[i] = static_cast<T>(lanes_[i]);
+    }
+  }
+
+  constexpr T operator[](size_t lane) const {
+    return static_cast<T>(lanes_[lane]);
+  }
+
+  friend WrappingVec operator+(WrappingVec a, WrappingVec b) {
+    return WrappingVec(a.lanes_ + b.lanes_);
+  }
+  friend WrappingVec operator-(WrappingVec a, WrappingVec b) {
+    return WrappingVec(a.lanes_ - b.lanes_);
+  }
+  friend WrappingVec operator*(WrappingVec a, WrappingVec b) {
+    // Unlike scalars, the lanes aren't promoted to int, so the products of
+    // small lanes wrap in them too.
+    return WrappingVec(a.lanes_ * b.lanes_);
+  }
+  friend WrappingVec operator^(WrappingVec a, WrappingVec b) {
+    return WrappingVec(a.lanes_ ^ b.lanes_);
+  }
+  friend WrappingVec operator&(WrappingVec a, WrappingVec b) {
+    return WrappingVec(a.lanes_ & b.lanes_);
+  }
+  friend WrappingVec operator|(WrappingVec a, WrappingVec b) {
+    return WrappingVec(a.lanes_ | b.lanes_);
+  }
+  WrappingVec operator-() const {
+    return WrappingVec(UnsignedVector{} - lanes_);
+  }
+
+  // Shifts the bits of each lane, as unsigned values, by `shift`, which must
+  // be less than the bit width of T.
+  WrappingVec operator<<(int shift) const {
+    return WrappingVec(lanes_ << static_cast<Unsigned>(shift));
+  }
+  WrappingVec operator>>(int shift) const {
+    return WrappingVec(lanes_ >> static_cast<Unsigned>(shift));
+  }
+
+  // Rotates the bits of each lane by `shift`, modulo the bit width of T, as
+  // RotateLeft() and RotateRight() do.
+  WrappingVec RotateLeft(int shift) const {
+    const Unsigned left = static_cast<Unsigned>(shift) & kShiftMask;
+    const Unsigned right = static_cast<Unsigned>(kBits - left) & kShiftMask;
+    return WrappingVec((lanes_ << left) | (lanes_ >> right));
+  }
+  WrappingVec RotateRight(int shift) const {
+    return RotateLeft(
+        static_cast<int>(kBits - (static_cast<Unsigned>(shift) & kShiftMask)));
+  }
+
+  WrappingVec& operator+=(WrappingVec other) { return *this = *this + other; }
+  WrappingVec& operator-=(WrappingVec other) { return *this = *this - other; }
+  WrappingVec& operator*=(WrappingVec other) { return *this = *this * other; }
+  WrappingVec& operator^=(WrappingVec other) { return *this = *this ^ other; }
+
+ private:
+  using Unsigned = std::make_unsigned_t<T>;
+  using UnsignedVector = typename WrappingVecTypes<T, N>::UnsignedVector;
+
+  static constexpr Unsigned kBits = std::numeric_limits<Unsigned>::digits;
+  static constexpr Unsigned kShiftMask = kBits - 1u;
+
+  constexpr explicit WrappingVec(UnsignedVector lanes) : lanes_(lanes) {}
+
+  UnsignedVector lanes_ = {};
+};
+
+}  // namespace numerics_internal
+
+using numerics_internal::WrappingVec;
+
+}  // namespace base
+
+#endif  // BASE_NUMERICS_WRAPPING_VEC_H_
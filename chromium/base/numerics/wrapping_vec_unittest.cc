@@ -0,0 +1,127 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/numerics/wrapping_vec.h"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "base/numerics/wrapping_math.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace base {
+
+namespace {
+
+// Values around the limits of T, and ones with many bits set.
+template <typename T>
+std::vector<T> TestValues() {
+  using Limits = std::numeric_limits<T>;
+  return {T{0},
+          T{1},
+          T{3},
+          T{100},
+          static_cast<T>(-1),
+          static_cast<T>(-100),
+          Limits::max(),
+          static_cast<T>(Limits::max() / 3),
+          Limits::lowest(),
+          static_cast<T>(Limits::lowest() + 1),
+          static_cast<T>(0x5a5a5a5a5a5a5a5aull),
+          static_cast<T>(0x0123456789abcdefull)};
+}
+
+// Checks each lane of the operations on WrappingVecs of each pair of test
+// values against the scalar functions of wrapping_math.h.
+template <typename T, size_t N>
+void ExpectSameAsScalar() {
+  const std::vector<T> values = TestValues<T>();
+  for (size_t first = 0u; first < values.size(); first += N) {
+    std::array<T, N> a;
+    for (size_t i = 0u; i < N; ++i) {
+      a[i] = values[(first + i) % values.size()];
+    }
+    const WrappingVec<T, N> vec_a = WrappingVec<T, N>::Load(a);
+    const WrappingVec<T, N> negated = -vec_a;
+    for (int shift : {0, 1, 7, std::numeric_limits<T>::digits, -5, 100}) {
+      const WrappingVec<T, N> left = vec_a.RotateLeft(shift);
+      const WrappingVec<T, N> right = vec_a.RotateRight(shift);
+      for (size_t i = 0u; i < N; ++i) {
+        EXPECT_EQ(RotateLeft(a[i], shift), left[i]) << +a[i] << " " << shift;
+        EXPECT_EQ(RotateRight(a[i], shift), right[i]) << +a[i] << " " << shift;
+      }
+    }
+    for (size_t i = 0u; i < N; ++i) {
+      EXPECT_EQ(WrappingSub(T{0}, a[i]), negated[i]) << +a[i];
+    }
+
+    for (T b : values) {
+      const WrappingVec<T, N> vec_b(b);
+      const WrappingVec<T, N> sum = vec_a + vec_b;
+      const WrappingVec<T, N> difference = vec_a - vec_b;
+      const WrappingVec<T, N> product = vec_a * vec_b;
+      for (size_t i = 0u; i < N; ++i) {
+        EXPECT_EQ(WrappingAdd(a[i], b), sum[i]) << +a[i] << " " << +b;
+        EXPECT_EQ(WrappingSub(a[i], b), difference[i]) << +a[i] << " " << +b;
+        EXPECT_EQ(WrappingMul(a[i], b), product[i]) << +a[i] << " " << +b;
+      }
+    }
+  }
+}
+
+}  // namespace
+
+TEST(WrappingVecTest, Scalar) {
+  static_assert(WrappingMul(uint16_t{0xffff}, uint16_t{0xffff}) == 1u);
+  static_assert(WrappingMul(int8_t{-128}, int8_t{-1}) == -128);
+  static_assert(WrappingMul(int32_t{0x10000}, int32_t{0x10000}) == 0);
+  constexpr uint64_t kHighBit = uint64_t{1} << 63;
+  static_assert(WrappingMul(kHighBit, uint64_t{3}) == kHighBit);
+  static_assert(RotateLeft(uint8_t{0x81}, 1) == 0x03u);
+  static_assert(RotateLeft(int16_t{-32768}, 1) == 1);
+  static_assert(RotateRight(uint32_t{1}, 1) == 0x80000000u);
+  static_assert(RotateRight(uint32_t{1}, -1) == 2u);
+}
+
+TEST(WrappingVecTest, Unsigned) {
+  ExpectSameAsScalar<uint32_t, 4>();
+  ExpectSameAsScalar<uint64_t, 2>();
+  ExpectSameAsScalar<uint8_t, 16>();
+  ExpectSameAsScalar<uint16_t, 8>();
+}
+
+TEST(WrappingVecTest, Signed) {
+  ExpectSameAsScalar<int32_t, 4>();
+  ExpectSameAsScalar<int64_t, 2>();
+  ExpectSameAsScalar<int8_t, 16>();
+  ExpectSameAsScalar<int16_t, 8>();
+}
+
+TEST(WrappingVecTest, Hash) {
+  // A multiply-rotate hash of four fields at a time, as of the edges of a
+  // rect, matches the same hash of each field.
+  constexpr std::array<int32_t, 4> kFields = {-10, 20, 1 << 30, -1};
+  constexpr uint32_t kMultiplier = 0x9e3779b1u;
+  WrappingVec<uint32_t, 4> hash(0x12345678u);
+  std::array<uint32_t, 4> fields;
+  for (size_t i = 0u; i < fields.size(); ++i) {
+    fields[i] = static_cast<uint32_t>(kFields[i]);
+  }
+  hash ^= WrappingVec<uint32_t, 4>::Load(fields);
+  hash *= WrappingVec<uint32_t, 4>(kMultiplier);
+  hash = hash.RotateLeft(13) + (hash >> 7);
+
+  std::array<uint32_t, 4> results;
+  hash.Store(results);
+  for (size_t i = 0u; i < fields.size(); ++i) {
+    const uint32_t expected =
+        WrappingMul(0x12345678u ^ fields[i], kMultiplier);
+    EXPECT_EQ(WrappingAdd(RotateLeft(expected, 13), expected >> 7),
+              results[i]);
+  }
+}
+
+}  // namespace base
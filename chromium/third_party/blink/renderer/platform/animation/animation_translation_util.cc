@@ -24,6 +24,9 @@
 
 #include "third_party/blink/renderer/platform/animation/animation_translation_util.h"
 
+#include "third_party/blink/renderer/platform/heap/collection_support/heap_vector.h"
+#include "third_party/blink/renderer/platform/heap/garbage_collected.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
 #include "third_party/blink/renderer/platform/transforms/interpolated_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/matrix_3d_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/matrix_transform_operation.h"
@@ -33,12 +36,17 @@
 #include "third_party/blink/renderer/platform/transforms/skew_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/transform_operations.h"
 #include "third_party/blink/renderer/platform/transforms/translate_transform_operation.h"
+#include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
+#include "ui/gfx/geometry/shared_transform_operations.h"
 #include "ui/gfx/geometry/transform.h"
 #include "ui/gfx/geometry/transform_operations.h"
 
 namespace blink {
 
-void ToGfxTransformOperations(
+namespace {
+
+void ConvertTransformOperations(
     const TransformOperations& transform_operations,
     gfx::TransformOperations* out_transform_operations,
     const gfx::SizeF& box_size) {
@@ -143,4 +151,143 @@ void ToGfxTransformOperations(
   }    // for each operation
 }
 
+scoped_refptr<const gfx::SharedTransformOperations> ConvertToShared(
+    const TransformOperations& transform_operations,
+    const gfx::SizeF& box_size) {
+  gfx::TransformOperations converted;
+  ConvertTransformOperations(transform_operations, &converted, box_size);
+  return gfx::SharedTransformOperations::Create(converted);
+}
+
+// The conversions of the most recently converted operation lists, so that
+// starting animations of the same keyframes again doesn't convert them again.
+// Lists are identified by their operations, which are immutable once shared,
+// and the box dimensions that they depend on.
+class GfxTransformOperationsCache final
+    : public GarbageCollected<GfxTransformOperationsCache> {
+ public:
+  static constexpr wtf_size_t kCapacity = 8;
+
+  class Entry final : public GarbageCollected<Entry> {
+   public:
+    Entry(const TransformOperations& operations, const gfx::SizeF& box_size)
+        : operations_(operations),
+          box_size_(box_size),
+          dependencies_(operations.BoxSizeDependencies()),
+          converted_(ConvertToShared(operations_, box_size_)) {}
+
+    bool Matches(const TransformOperations& operations,
+                 const gfx::SizeF& box_size) const {
+      if ((dependencies_ & TransformOperation::kDependsWidth) &&
+          box_size_.width() != box_size.width()) {
+        return false;
+      }
+      if ((dependencies_ & TransformOperation::kDependsHeight) &&
+          box_size_.height() != box_size.height()) {
+        return false;
+      }
+      if (operations_.size() != operations.size()) {
+        return false;
+      }
+      for (wtf_size_t i = 0; i < operations.size(); ++i) {
+        if (operations_.at(i) != operations.at(i)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    const gfx::TransformOperations& converted() const {
+      return converted_->operations();
+    }
+    const scoped_refptr<const gfx::SharedTransformOperations>& shared() const {
+      return converted_;
+    }
+
+    void Trace(Visitor* visitor) const { visitor->Trace(operations_); }
+
+   private:
+    // Holding a copy keeps the operations alive, so that they can't be
+    // reallocated for another list.
+    const TransformOperations operations_;
+    const gfx::SizeF box_size_;
+    const TransformOperation::BoxSizeDependency dependencies_;
+    // Shared with the compositor, so that the conversion and its caches
+    // aren't copied for each animation.
+    const scoped_refptr<const gfx::SharedTransformOperations> converted_;
+  };
+
+  const Entry& Get(const TransformOperations& operations,
+                   const gfx::SizeF& box_size) {
+    wtf_size_t index = 0;
+    while (index < entries_.size() &&
+           !entries_[index]->Matches(operations, box_size)) {
+      ++index;
+    }
+    Entry* entry;
+    if (index < entries_.size()) {
+      entry = entries_[index];
+      entries_.EraseAt(index);
+    } else {
+      entry = MakeGarbageCollected<Entry>(operations, box_size);
+      if (entries_.size() == kCapacity) {
+        entries_.pop_back();
+      }
+    }
+    // Keep the most recently used entry first.
+    entries_.push_front(entry);
+    return *entry;
+  }
+
+  void Trace(Visitor* visitor) const { visitor->Trace(entries_); }
+
+ private:
+  HeapVector<Member<Entry>, kCapacity> entries_;
+};
+
+GfxTransformOperationsCache& GetGfxTransformOperationsCache() {
+  DCHECK(IsMainThread());
+  DEFINE_STATIC_LOCAL(Persistent<GfxTransformOperationsCache>, cache,
+                      (MakeGarbageCollected<GfxTransformOperationsCache>()));
+  return *cache;
+}
+
+}  // namespace
+
+void ToGfxTransformOperations(
+    const TransformOperations& transform_operations,
+    gfx::TransformOperations* out_transform_operations,
+    const gfx::SizeF& box_size) {
+  // A single operation is as cheap to convert as to look up.
+  if (transform_operations.size() < 2 || !IsMainThread()) {
+    ConvertTransformOperations(transform_operations, out_transform_operations,
+                               box_size);
+    return;
+  }
+
+  const gfx::TransformOperations& converted =
+      GetGfxTransformOperationsCache()
+          .Get(transform_operations, box_size)
+          .converted();
+  if (!out_transform_operations->size()) {
+    // Copying also shares the decompositions cached by |converted|.
+    *out_transform_operations = converted;
+    return;
+  }
+  for (size_t i = 0; i < converted.size(); ++i) {
+    out_transform_operations->Append(converted.at(i));
+  }
+}
+
+scoped_refptr<const gfx::SharedTransformOperations> ToGfxTransformOperations(
+    const TransformOperations& transform_operations,
+    const gfx::SizeF& box_size) {
+  if (transform_operations.size() < 2 || !IsMainThread()) {
+    return ConvertToShared(transform_operations, box_size);
+  }
+  return GetGfxTransformOperationsCache()
+      .Get(transform_operations, box_size)
+      .shared();
+}
+
 }  // namespace blink
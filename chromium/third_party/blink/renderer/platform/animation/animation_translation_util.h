@@ -31,9 +31,11 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_ANIMATION_TRANSLATION_UTIL_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_ANIMATION_TRANSLATION_UTIL_H_
 
+#include "base/memory/scoped_refptr.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 
 namespace gfx {
+class SharedTransformOperations;
 class SizeF;
 class TransformOperations;
 }
@@ -47,6 +49,14 @@ PLATFORM_EXPORT void ToGfxTransformOperations(
     gfx::TransformOperations* out_operations,
     const gfx::SizeF& box_size);
 
+// Returns the conversion as an immutable snapshot, which can be handed to the
+// compositor thread without copying. On the main thread, the recently
+// converted lists are cached, so that converting one again returns the same
+// snapshot.
+PLATFORM_EXPORT scoped_refptr<const gfx::SharedTransformOperations>
+ToGfxTransformOperations(const TransformOperations& in_operations,
+                         const gfx::SizeF& box_size);
+
 }  // namespace blink
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_ANIMATION_TRANSLATION_UTIL_H_
@@ -31,6 +31,7 @@
 #include "third_party/blink/renderer/platform/transforms/scale_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/transform_operations.h"
 #include "third_party/blink/renderer/platform/transforms/translate_transform_operation.h"
+#include "ui/gfx/geometry/shared_transform_operations.h"
 #include "ui/gfx/geometry/test/geometry_util.h"
 #include "ui/gfx/geometry/transform_operations.h"
 
@@ -110,4 +111,65 @@ TEST(AnimationTranslationUtilTest, RelativeInterpolated) {
   EXPECT_TRANSFORM_NEAR(op0.matrix, ops_expected.at(0).matrix, 1e-6f);
 }
 
+TEST(AnimationTranslationUtilTest, RepeatedConversions) {
+  TransformOperations ops;
+  ops.Operations().push_back(MakeGarbageCollected<TranslateTransformOperation>(
+      Length::Percent(50), Length::Fixed(10), TransformOperation::kTranslate));
+  ops.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      30, TransformOperation::kRotate));
+
+  // The conversion depends on the width but not on the height.
+  for (const gfx::SizeF& size :
+       {gfx::SizeF(200, 100), gfx::SizeF(200, 300), gfx::SizeF(400, 100),
+        gfx::SizeF(200, 100)}) {
+    gfx::TransformOperations out_ops;
+    ToGfxTransformOperations(ops, &out_ops, size);
+    ASSERT_EQ(out_ops.size(), 2u);
+    EXPECT_EQ(out_ops.at(0).translate.x, size.width() / 2);
+    EXPECT_EQ(out_ops.at(0).translate.y, 10.0f);
+    EXPECT_EQ(out_ops.at(1).rotate.angle, 30.0f);
+  }
+
+  // Converted operations are appended to existing ones.
+  gfx::TransformOperations out_ops;
+  out_ops.AppendScale(2, 2, 1);
+  ToGfxTransformOperations(ops, &out_ops, gfx::SizeF(200, 100));
+  ASSERT_EQ(out_ops.size(), 3u);
+  EXPECT_EQ(gfx::TransformOperation::TRANSFORM_OPERATION_SCALE,
+            out_ops.at(0).type);
+  EXPECT_EQ(out_ops.at(1).translate.x, 100.0f);
+
+  // A list with other operations is converted again.
+  TransformOperations other_ops = ops;
+  other_ops.Operations()[1] = MakeGarbageCollected<RotateTransformOperation>(
+      60, TransformOperation::kRotate);
+  gfx::TransformOperations other_out_ops;
+  ToGfxTransformOperations(other_ops, &other_out_ops, gfx::SizeF(200, 100));
+  ASSERT_EQ(other_out_ops.size(), 2u);
+  EXPECT_EQ(other_out_ops.at(1).rotate.angle, 60.0f);
+}
+
+TEST(AnimationTranslationUtilTest, SharedConversions) {
+  TransformOperations ops;
+  ops.Operations().push_back(MakeGarbageCollected<TranslateTransformOperation>(
+      Length::Percent(50), Length::Fixed(10), TransformOperation::kTranslate));
+  ops.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      30, TransformOperation::kRotate));
+
+  scoped_refptr<const gfx::SharedTransformOperations> shared =
+      ToGfxTransformOperations(ops, gfx::SizeF(200, 100));
+  ASSERT_EQ(shared->operations().size(), 2u);
+  EXPECT_EQ(shared->operations().at(0).translate.x, 100.0f);
+  EXPECT_EQ(shared->operations().at(1).rotate.angle, 30.0f);
+  EXPECT_EQ(shared->Apply(), shared->operations().Apply());
+
+  // Converting the same list again shares the snapshot.
+  EXPECT_EQ(shared, ToGfxTransformOperations(ops, gfx::SizeF(200, 300)));
+  EXPECT_NE(shared, ToGfxTransformOperations(ops, gfx::SizeF(400, 100)));
+
+  gfx::TransformOperations out_ops;
+  ToGfxTransformOperations(ops, &out_ops, gfx::SizeF(200, 100));
+  EXPECT_TRUE(out_ops.ApproximatelyEqual(shared->operations(), 0));
+}
+
 }  // namespace blink
@@ -96,10 +96,48 @@ void CompositorAnimation::AbortKeyframeModel(int keyframe_model_id) {
   animation_->AbortKeyframeModel(keyframe_model_id);
 }
 
+void CompositorAnimation::AddKeyframeModels(
+    Vector<std::unique_ptr<cc::KeyframeModel>> keyframe_models) {
+  for (auto& keyframe_model : keyframe_models) {
+    AddKeyframeModel(std::move(keyframe_model));
+  }
+}
+
+void CompositorAnimation::RemoveKeyframeModels(
+    base::span<const int> keyframe_model_ids) {
+  for (int keyframe_model_id : keyframe_model_ids) {
+    animation_->RemoveKeyframeModel(keyframe_model_id);
+  }
+}
+
+void CompositorAnimation::PauseKeyframeModels(
+    base::span<const int> keyframe_model_ids,
+    base::TimeDelta time_offset) {
+  for (int keyframe_model_id : keyframe_model_ids) {
+    animation_->PauseKeyframeModel(keyframe_model_id, time_offset);
+  }
+}
+
+void CompositorAnimation::AbortKeyframeModels(
+    base::span<const int> keyframe_model_ids) {
+  for (int keyframe_model_id : keyframe_model_ids) {
+    animation_->AbortKeyframeModel(keyframe_model_id);
+  }
+}
+
 void CompositorAnimation::UpdatePlaybackRate(double playback_rate) {
   cc::ToWorkletAnimation(animation_.get())->UpdatePlaybackRate(playback_rate);
 }
 
+// static
+void CompositorAnimation::UpdatePlaybackRates(
+    base::span<CompositorAnimation* const> animations,
+    double playback_rate) {
+  for (CompositorAnimation* animation : animations) {
+    animation->UpdatePlaybackRate(playback_rate);
+  }
+}
+
 void CompositorAnimation::NotifyAnimationStarted(base::TimeTicks monotonic_time,
                                                  int target_property,
                                                  int group) {
@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 
+#include "base/containers/span.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/scoped_refptr.h"
 #include "cc/animation/animation.h"
@@ -16,6 +17,7 @@
 #include "third_party/blink/renderer/platform/graphics/compositor_element_id.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace gfx {
 class AnimationCurve;
@@ -64,7 +66,22 @@ class PLATFORM_EXPORT CompositorAnimation : public cc::AnimationDelegate {
   void PauseKeyframeModel(int keyframe_model_id, base::TimeDelta time_offset);
   void AbortKeyframeModel(int keyframe_model_id);
 
+  // Same as the above for each of many keyframe models, e.g. those of a
+  // staggered animation of the items of a long list, in order. Empty batches
+  // do nothing.
+  void AddKeyframeModels(Vector<std::unique_ptr<cc::KeyframeModel>>);
+  void RemoveKeyframeModels(base::span<const int> keyframe_model_ids);
+  void PauseKeyframeModels(base::span<const int> keyframe_model_ids,
+                           base::TimeDelta time_offset);
+  void AbortKeyframeModels(base::span<const int> keyframe_model_ids);
+
   void UpdatePlaybackRate(double playback_rate);
+  // Same as UpdatePlaybackRate() for each of |animations|, e.g. when the rate
+  // of all the animations of a page changes at once for slow motion or
+  // scrubbing a timeline, in one pass.
+  static void UpdatePlaybackRates(
+      base::span<CompositorAnimation* const> animations,
+      double playback_rate);
 
  private:
   // cc::AnimationDelegate implementation.
@@ -0,0 +1,96 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/animation/compositor_animation_element_registry.h"
+
+#include "base/check_op.h"
+#include "third_party/blink/renderer/platform/animation/compositor_animation.h"
+
+namespace blink {
+
+CompositorAnimationElementRegistry::CompositorAnimationElementRegistry() =
+    default;
+
+CompositorAnimationElementRegistry::~CompositorAnimationElementRegistry() =
+    default;
+
+void CompositorAnimationElementRegistry::AttachElement(
+    CompositorAnimation& animation,
+    const CompositorElementId& id) {
+  DCHECK(id);
+  const CompositorElementId attached_id =
+      animation.CcAnimation()->element_id();
+  if (attached_id == id) {
+    return;
+  }
+  if (attached_id) {
+    Remove(animation, attached_id);
+    animation.DetachElement();
+  }
+  animation.AttachElement(id);
+  animations_.insert(id, Vector<raw_ptr<CompositorAnimation>>())
+      .stored_value->value.push_back(&animation);
+}
+
+void CompositorAnimationElementRegistry::DetachElement(
+    CompositorAnimation& animation) {
+  const CompositorElementId attached_id =
+      animation.CcAnimation()->element_id();
+  if (!attached_id) {
+    return;
+  }
+  Remove(animation, attached_id);
+  animation.DetachElement();
+}
+
+void CompositorAnimationElementRegistry::AttachElements(
+    base::span<CompositorAnimation* const> animations,
+    base::span<const CompositorElementId> ids) {
+  CHECK_EQ(animations.size(), ids.size());
+  for (size_t i = 0; i < animations.size(); ++i) {
+    AttachElement(*animations[i], ids[i]);
+  }
+}
+
+void CompositorAnimationElementRegistry::DetachElements(
+    base::span<const CompositorElementId> ids) {
+  for (const CompositorElementId& id : ids) {
+    auto it = animations_.find(id);
+    if (it == animations_.end()) {
+      continue;
+    }
+    for (CompositorAnimation* animation : it->value) {
+      animation->DetachElement();
+    }
+    animations_.erase(it);
+  }
+}
+
+base::span<const raw_ptr<CompositorAnimation>>
+CompositorAnimationElementRegistry::AnimationsAttachedTo(
+    const CompositorElementId& id) const {
+  auto it = animations_.find(id);
+  if (it == animations_.end()) {
+    return {};
+  }
+  return it->value;
+}
+
+void CompositorAnimationElementRegistry::Remove(
+    CompositorAnimation& animation,
+    const CompositorElementId& id) {
+  auto it = animations_.find(id);
+  CHECK(it != animations_.end());
+  Vector<raw_ptr<CompositorAnimation>>& attached = it->value;
+  const wtf_size_t index = attached.Find(&animation);
+  CHECK_NE(index, kNotFound);
+  // The order doesn't matter, so move the last animation into the slot.
+  attached[index] = attached.back();
+  attached.pop_back();
+  if (attached.empty()) {
+    animations_.erase(it);
+  }
+}
+
+}  // namespace blink
@@ -0,0 +1,64 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_COMPOSITOR_ANIMATION_ELEMENT_REGISTRY_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_COMPOSITOR_ANIMATION_ELEMENT_REGISTRY_H_
+
+#include "base/containers/span.h"
+#include "base/memory/raw_ptr.h"
+#include "third_party/blink/renderer/platform/graphics/compositor_element_id.h"
+#include "third_party/blink/renderer/platform/platform_export.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+class CompositorAnimation;
+
+// Attaches CompositorAnimations to elements and indexes them by element id, so
+// that all the animations of an element, or of many elements, e.g. the items
+// of a virtualized list that scrolled out of view, are found and detached
+// with one lookup per element rather than one check per animation. The
+// animations aren't owned; each one must be detached through the registry
+// before it's destroyed, and shouldn't be attached or detached other than
+// through the registry while it's in it.
+class PLATFORM_EXPORT CompositorAnimationElementRegistry {
+ public:
+  CompositorAnimationElementRegistry();
+  CompositorAnimationElementRegistry(
+      const CompositorAnimationElementRegistry&) = delete;
+  CompositorAnimationElementRegistry& operator=(
+      const CompositorAnimationElementRegistry&) = delete;
+  ~CompositorAnimationElementRegistry();
+
+  // Attaches |animation| to the element |id|, which must be valid, detaching
+  // it first from the element it's attached to, if any.
+  void AttachElement(CompositorAnimation& animation,
+                     const CompositorElementId& id);
+  // Detaches |animation| if it's attached.
+  void DetachElement(CompositorAnimation& animation);
+
+  // Attaches each animations[i] to ids[i], as AttachElement(). Both spans must
+  // have the same size.
+  void AttachElements(base::span<CompositorAnimation* const> animations,
+                      base::span<const CompositorElementId> ids);
+  // Detaches all the animations attached to each of |ids|.
+  void DetachElements(base::span<const CompositorElementId> ids);
+
+  // Returns the animations attached to |id|, in no particular order.
+  base::span<const raw_ptr<CompositorAnimation>> AnimationsAttachedTo(
+      const CompositorElementId& id) const;
+  // Returns the number of elements with attached animations.
+  wtf_size_t element_count() const { return animations_.size(); }
+
+ private:
+  void Remove(CompositorAnimation& animation, const CompositorElementId& id);
+
+  HashMap<CompositorElementId, Vector<raw_ptr<CompositorAnimation>>>
+      animations_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_COMPOSITOR_ANIMATION_ELEMENT_REGISTRY_H_
@@ -0,0 +1,94 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/animation/compositor_animation_element_registry.h"
+
+#include <memory>
+
+#include "testing/gmock/include/gmock/gmock.h"
+#include "third_party/blink/renderer/platform/animation/compositor_animation.h"
+#include "third_party/blink/renderer/platform/testing/compositor_test.h"
+
+namespace blink {
+
+using testing::UnorderedElementsAre;
+
+class CompositorAnimationElementRegistryTest : public CompositorTest {};
+
+TEST_F(CompositorAnimationElementRegistryTest, AttachAndDetach) {
+  std::unique_ptr<CompositorAnimation> a = CompositorAnimation::Create();
+  std::unique_ptr<CompositorAnimation> b = CompositorAnimation::Create();
+  const CompositorElementId id1(1);
+  const CompositorElementId id2(2);
+
+  CompositorAnimationElementRegistry registry;
+  registry.AttachElement(*a, id1);
+  registry.AttachElement(*b, id1);
+  EXPECT_TRUE(a->IsElementAttached());
+  EXPECT_EQ(id1, b->CcAnimation()->element_id());
+  EXPECT_THAT(registry.AnimationsAttachedTo(id1),
+              UnorderedElementsAre(a.get(), b.get()));
+  EXPECT_EQ(1u, registry.element_count());
+
+  // Moves |a| to another element.
+  registry.AttachElement(*a, id2);
+  EXPECT_EQ(id2, a->CcAnimation()->element_id());
+  EXPECT_THAT(registry.AnimationsAttachedTo(id1),
+              UnorderedElementsAre(b.get()));
+  EXPECT_THAT(registry.AnimationsAttachedTo(id2),
+              UnorderedElementsAre(a.get()));
+
+  registry.DetachElement(*b);
+  EXPECT_FALSE(b->IsElementAttached());
+  EXPECT_TRUE(registry.AnimationsAttachedTo(id1).empty());
+  EXPECT_EQ(1u, registry.element_count());
+  registry.DetachElement(*b);
+
+  registry.DetachElement(*a);
+  EXPECT_FALSE(a->IsElementAttached());
+  EXPECT_EQ(0u, registry.element_count());
+}
+
+TEST_F(CompositorAnimationElementRegistryTest, Bulk) {
+  constexpr wtf_size_t kCount = 100;
+  Vector<std::unique_ptr<CompositorAnimation>> owners;
+  Vector<CompositorAnimation*> animations;
+  Vector<CompositorElementId> ids;
+  for (wtf_size_t i = 0; i < kCount; ++i) {
+    owners.push_back(CompositorAnimation::Create());
+    animations.push_back(owners.back().get());
+    // Two animations per element.
+    ids.push_back(CompositorElementId(1 + i / 2));
+  }
+
+  CompositorAnimationElementRegistry registry;
+  registry.AttachElements(animations, ids);
+  EXPECT_EQ(kCount / 2, registry.element_count());
+  for (wtf_size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(ids[i], animations[i]->CcAnimation()->element_id());
+  }
+
+  // Detaches the first half of the list, and an element without animations.
+  Vector<CompositorElementId> detached;
+  for (wtf_size_t i = 0; i < kCount / 2; i += 2) {
+    detached.push_back(ids[i]);
+  }
+  detached.push_back(CompositorElementId(kCount));
+  registry.DetachElements(detached);
+  EXPECT_EQ(kCount / 4, registry.element_count());
+  for (wtf_size_t i = 0; i < kCount; ++i) {
+    EXPECT_EQ(i >= kCount / 2, animations[i]->IsElementAttached()) << i;
+  }
+
+  // Re-attaches the whole list.
+  registry.AttachElements(animations, ids);
+  EXPECT_EQ(kCount / 2, registry.element_count());
+  registry.DetachElements(ids);
+  EXPECT_EQ(0u, registry.element_count());
+  for (CompositorAnimation* animation : animations) {
+    EXPECT_FALSE(animation->IsElementAttached());
+  }
+}
+
+}  // namespace blink
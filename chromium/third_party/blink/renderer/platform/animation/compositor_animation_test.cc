@@ -4,6 +4,7 @@
 
 #include "third_party/blink/renderer/platform/animation/compositor_animation.h"
 
+#include <array>
 #include <memory>
 
 #include "base/time/time.h"
@@ -149,4 +150,64 @@ TEST_F(CompositorAnimationTest,
   EXPECT_FALSE(timeline->GetAnimationById(cc_animation->id()));
 }
 
+TEST_F(CompositorAnimationTest, KeyframeModelBatches) {
+  std::unique_ptr<CompositorAnimation> animation =
+      CompositorAnimation::Create();
+  cc::Animation* cc_animation = animation->CcAnimation();
+
+  Vector<std::unique_ptr<cc::KeyframeModel>> keyframe_models;
+  Vector<int> keyframe_model_ids;
+  for (int group = 1; group <= 3; ++group) {
+    keyframe_models.push_back(cc::KeyframeModel::Create(
+        gfx::KeyframedFloatAnimationCurve::Create(),
+        cc::AnimationIdProvider::NextKeyframeModelId(), group,
+        cc::KeyframeModel::TargetPropertyId(cc::TargetProperty::OPACITY)));
+    keyframe_model_ids.push_back(keyframe_models.back()->id());
+  }
+  animation->AddKeyframeModels(std::move(keyframe_models));
+  for (int id : keyframe_model_ids) {
+    cc::KeyframeModel* keyframe_model =
+        cc_animation->keyframe_effect()->GetKeyframeModelById(id);
+    ASSERT_TRUE(keyframe_model);
+    EXPECT_TRUE(keyframe_model->needs_synchronized_start_time());
+  }
+
+  animation->AbortKeyframeModels(base::span(keyframe_model_ids).first(1u));
+  EXPECT_EQ(cc::KeyframeModel::ABORTED,
+            cc_animation->keyframe_effect()
+                ->GetKeyframeModelById(keyframe_model_ids[0])
+                ->run_state());
+
+  animation->RemoveKeyframeModels(keyframe_model_ids);
+  for (int id : keyframe_model_ids) {
+    EXPECT_FALSE(cc_animation->keyframe_effect()->GetKeyframeModelById(id));
+  }
+  animation->RemoveKeyframeModels({});
+}
+
+TEST_F(CompositorAnimationTest, UpdatePlaybackRates) {
+  Vector<std::unique_ptr<CompositorAnimation>> animations;
+  for (int id = 1; id <= 3; ++id) {
+    animations.push_back(CompositorAnimation::CreateWorkletAnimation(
+        cc::WorkletAnimationId{1, id}, "test", 1, nullptr, nullptr));
+  }
+  auto playback_rate = [&](wtf_size_t i) {
+    return cc::ToWorkletAnimation(animations[i]->CcAnimation())
+        ->playback_rate();
+  };
+
+  // The same animation may appear more than once in a batch.
+  const std::array<CompositorAnimation*, 3> batch = {
+      animations[0].get(), animations[1].get(), animations[0].get()};
+  CompositorAnimation::UpdatePlaybackRates(batch, 2);
+  EXPECT_EQ(2, playback_rate(0));
+  EXPECT_EQ(2, playback_rate(1));
+  EXPECT_EQ(1, playback_rate(2));
+
+  CompositorAnimation::UpdatePlaybackRates({}, 3);
+  EXPECT_EQ(2, playback_rate(0));
+  EXPECT_EQ(2, playback_rate(1));
+  EXPECT_EQ(1, playback_rate(2));
+}
+
 }  // namespace blink
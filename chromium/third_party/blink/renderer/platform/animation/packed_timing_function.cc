@@ -0,0 +1,212 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/animation/packed_timing_function.h"
+
+#include <cmath>
+#include <vector>
+
+#include "base/notreached.h"
+#include "base/numerics/safe_conversions.h"
+#include "ui/gfx/geometry/cubic_bezier.h"
+
+namespace blink {
+
+namespace {
+
+using Packed = PackedTimingFunction;
+
+// The x values of the curve are within this of the fraction after solving, or
+// the solver gives up after kMaxSolverIterations.
+constexpr float kSolverEpsilon = 1e-6f;
+constexpr int kMaxSolverIterations = 16;
+
+void PackCubicBezier(const gfx::CubicBezier& bezier, Packed& packed) {
+  const double x1 = bezier.GetX1();
+  const double y1 = bezier.GetY1();
+  const double x2 = bezier.GetX2();
+  const double y2 = bezier.GetY2();
+  // As gfx::CubicBezier::InitCoefficients().
+  const double cx = 3 * x1;
+  const double bx = 3 * (x2 - x1) - cx;
+  const double cy = 3 * y1;
+  const double by = 3 * (y2 - y1) - cy;
+  packed.data[Packed::kAx] = static_cast<float>(1 - cx - bx);
+  packed.data[Packed::kBx] = static_cast<float>(bx);
+  packed.data[Packed::kCx] = static_cast<float>(cx);
+  packed.data[Packed::kAy] = static_cast<float>(1 - cy - by);
+  packed.data[Packed::kBy] = static_cast<float>(by);
+  packed.data[Packed::kCy] = static_cast<float>(cy);
+  // The gradients aren't exposed, but the curve extrapolates with them.
+  packed.data[Packed::kStartGradient] =
+      static_cast<float>(-bezier.SolveWithEpsilon(-1, 0));
+  packed.data[Packed::kEndGradient] =
+      static_cast<float>(bezier.SolveWithEpsilon(2, 0) - 1);
+  for (size_t i = 0; i < Packed::kSplineSamples; ++i) {
+    const double t = static_cast<double>(i) / (Packed::kSplineSamples - 1);
+    packed.data[Packed::kFirstSplineSample + i] =
+        static_cast<float>(bezier.SampleCurveX(t));
+  }
+}
+
+float SampleCurve(const Packed& packed, size_t a, float t) {
+  // The coefficients of y follow those of x in the same order.
+  return ((packed.data[a] * t + packed.data[a + 1]) * t + packed.data[a + 2]) *
+         t;
+}
+
+float EvaluateCubicBezier(const Packed& packed, float fraction) {
+  if (fraction < 0) {
+    return packed.data[Packed::kStartGradient] * fraction;
+  }
+  if (fraction > 1) {
+    return 1 + packed.data[Packed::kEndGradient] * (fraction - 1);
+  }
+
+  // Bracket the parameter between the spline samples around |fraction|, and
+  // start from their linear interpolation.
+  constexpr float kSampleDelta = 1.0f / (Packed::kSplineSamples - 1);
+  const auto sample = [&packed](size_t i) {
+    return packed.data[Packed::kFirstSplineSample + i];
+  };
+  size_t i = 0;
+  while (i + 2 < Packed::kSplineSamples && sample(i + 1) <= fraction) {
+    ++i;
+  }
+  float t0 = static_cast<float>(i) * kSampleDelta;
+  float t1 = t0 + kSampleDelta;
+  float t = t0;
+  if (sample(i + 1) > sample(i)) {
+    t += kSampleDelta * (fraction - sample(i)) / (sample(i + 1) - sample(i));
+  }
+
+  // Newton's method, falling back to bisection when a step would leave the
+  // bracket.
+  for (int iteration = 0; iteration < kMaxSolverIterations; ++iteration) {
+    const float error = SampleCurve(packed, Packed::kAx, t) - fraction;
+    if (std::fabs(error) < kSolverEpsilon) {
+      break;
+    }
+    if (error > 0) {
+      t1 = t;
+    } else {
+      t0 = t;
+    }
+    const float derivative =
+        (3 * packed.data[Packed::kAx] * t + 2 * packed.data[Packed::kBx]) * t +
+        packed.data[Packed::kCx];
+    const float next = derivative != 0 ? t - error / derivative : t0;
+    t = next > t0 && next < t1 ? next : (t0 + t1) / 2;
+  }
+  return SampleCurve(packed, Packed::kAy, t);
+}
+
+float EvaluateLinear(const Packed& packed, float fraction) {
+  if (packed.count == 0) {
+    return fraction;
+  }
+  // The segment starts at the last point whose input is at most |fraction|,
+  // clamped to the first and last segments to extrapolate, as
+  // LinearTimingFunction::EvaluatePoints() with the right limit.
+  const auto input = [&packed](uint32_t i) { return packed.data[2 * i]; };
+  const auto output = [&packed](uint32_t i) { return packed.data[2 * i + 1]; };
+  uint32_t segment = 0;
+  while (segment + 2 < packed.count && input(segment + 1) <= fraction) {
+    ++segment;
+  }
+  if (input(segment) == input(segment + 1)) {
+    return output(segment + 1);
+  }
+  const float progress = (fraction - input(segment)) /
+                         (input(segment + 1) - input(segment));
+  return output(segment) + (output(segment + 1) - output(segment)) * progress;
+}
+
+float EvaluateSteps(const Packed& packed, float fraction) {
+  // As TimingFunctionEvaluator::Steps::Evaluate() with the right limit.
+  const float steps = static_cast<float>(packed.count);
+  float current_step =
+      std::floor(fraction * steps + (packed.jump_at_start ? 1 : 0));
+  if (fraction >= 0 && current_step < 0) {
+    current_step = 0;
+  }
+  if (fraction <= 1 && current_step > packed.jumps) {
+    current_step = packed.jumps;
+  }
+  return current_step / packed.jumps;
+}
+
+}  // namespace
+
+std::optional<PackedTimingFunction> PackTimingFunction(
+    const TimingFunction& function) {
+  PackedTimingFunction packed;
+  switch (function.GetType()) {
+    case TimingFunction::Type::LINEAR: {
+      const auto& linear = To<LinearTimingFunction>(function);
+      packed.type = PackedTimingFunction::Type::kLinear;
+      if (linear.IsTrivial()) {
+        break;
+      }
+      const std::vector<gfx::LinearEasingPoint>& points = linear.Points();
+      if (points.size() > PackedTimingFunction::kMaxLinearPoints) {
+        return std::nullopt;
+      }
+      packed.count = base::checked_cast<uint32_t>(points.size());
+      for (size_t i = 0; i < points.size(); ++i) {
+        packed.data[2 * i] = static_cast<float>(points[i].input / 100);
+        packed.data[2 * i + 1] = static_cast<float>(points[i].output);
+      }
+      break;
+    }
+    case TimingFunction::Type::CUBIC_BEZIER:
+      packed.type = PackedTimingFunction::Type::kCubicBezier;
+      PackCubicBezier(To<CubicBezierTimingFunction>(function).bezier(),
+                      packed);
+      break;
+    case TimingFunction::Type::STEPS: {
+      // The jumps are counted as TimingFunctionEvaluator does.
+      const auto& steps = To<StepsTimingFunction>(function);
+      int jumps = steps.NumberOfSteps();
+      bool start = false;
+      switch (steps.GetStepPosition()) {
+        case StepsTimingFunction::StepPosition::START:
+        case StepsTimingFunction::StepPosition::JUMP_START:
+          start = true;
+          break;
+        case StepsTimingFunction::StepPosition::JUMP_BOTH:
+          start = true;
+          jumps += 1;
+          break;
+        case StepsTimingFunction::StepPosition::JUMP_NONE:
+          jumps -= 1;
+          break;
+        case StepsTimingFunction::StepPosition::END:
+        case StepsTimingFunction::StepPosition::JUMP_END:
+          break;
+      }
+      packed.type = PackedTimingFunction::Type::kSteps;
+      packed.count = base::checked_cast<uint32_t>(steps.NumberOfSteps());
+      packed.jumps = static_cast<float>(jumps);
+      packed.jump_at_start = start ? 1 : 0;
+      break;
+    }
+  }
+  return packed;
+}
+
+float EvaluatePackedTimingFunction(const PackedTimingFunction& packed,
+                                   float fraction) {
+  switch (packed.type) {
+    case PackedTimingFunction::Type::kLinear:
+      return EvaluateLinear(packed, fraction);
+    case PackedTimingFunction::Type::kCubicBezier:
+      return EvaluateCubicBezier(packed, fraction);
+    case PackedTimingFunction::Type::kSteps:
+      return EvaluateSteps(packed, fraction);
+  }
+  NOTREACHED();
+}
+
+}  // namespace blink
@@ -0,0 +1,79 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_PACKED_TIMING_FUNCTION_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_PACKED_TIMING_FUNCTION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <optional>
+
+#include "third_party/blink/renderer/platform/animation/timing_function.h"
+#include "third_party/blink/renderer/platform/platform_export.h"
+
+namespace blink {
+
+// A timing function packed into a fixed-size record of 32-bit values, so that
+// the timing functions of many animations can be uploaded to a uniform or
+// storage buffer and eased by a shader. Every member is a 4-byte scalar and
+// they come in groups of 4, so the layout is the same for std140 and std430
+// arrays of vec4s. EvaluatePackedTimingFunction() is the reference of the
+// evaluation in a shader, in float arithmetic.
+struct PackedTimingFunction {
+  static constexpr size_t kMaxLinearPoints = 16;
+  static constexpr size_t kSplineSamples = 11;
+
+  enum class Type : uint32_t { kLinear = 0, kCubicBezier = 1, kSteps = 2 };
+
+  // The offsets in |data| of a cubic bezier: its polynomial coefficients and
+  // end gradients as in gfx::CubicBezier, then kSplineSamples x values of the
+  // curve at evenly spaced parameters, for the initial guess of the solver.
+  static constexpr size_t kAx = 0;
+  static constexpr size_t kBx = 1;
+  static constexpr size_t kCx = 2;
+  static constexpr size_t kAy = 3;
+  static constexpr size_t kBy = 4;
+  static constexpr size_t kCy = 5;
+  static constexpr size_t kStartGradient = 6;
+  static constexpr size_t kEndGradient = 7;
+  static constexpr size_t kFirstSplineSample = 8;
+
+  Type type = Type::kLinear;
+  // The number of points of a linear function, 0 for the identity, or the
+  // number of steps.
+  uint32_t count = 0;
+  // The number of jumps of steps, which is the denominator of their outputs.
+  float jumps = 0;
+  // 1 if steps jump at the start, 0 otherwise.
+  uint32_t jump_at_start = 0;
+  // The cubic bezier at the offsets above, or the input and output of each
+  // point of a linear function, one after the other. The inputs are fractions
+  // rather than the percentages of gfx::LinearEasingPoint.
+  std::array<float, 2 * kMaxLinearPoints> data = {};
+};
+
+static_assert(sizeof(PackedTimingFunction) % 16 == 0);
+static_assert(PackedTimingFunction::kFirstSplineSample +
+                  PackedTimingFunction::kSplineSamples <=
+              2 * PackedTimingFunction::kMaxLinearPoints);
+
+// Returns |function| packed, or nullopt for a linear function with more than
+// kMaxLinearPoints points. A cubic bezier is packed from its curve, even if
+// it's evaluated with a lookup table.
+PLATFORM_EXPORT std::optional<PackedTimingFunction> PackTimingFunction(
+    const TimingFunction& function);
+
+// Returns the output of |packed| at |fraction|, with the right limit at
+// discontinuities, which is TimingFunction::Evaluate() with
+// LimitDirection::RIGHT up to the precision of float. This only uses loops of
+// a fixed maximum length and no tables besides |packed|, as a shader would.
+PLATFORM_EXPORT float EvaluatePackedTimingFunction(
+    const PackedTimingFunction& packed,
+    float fraction);
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_PACKED_TIMING_FUNCTION_H_
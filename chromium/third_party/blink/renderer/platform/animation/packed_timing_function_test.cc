@@ -0,0 +1,77 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/animation/packed_timing_function.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/testing/task_environment.h"
+
+namespace blink {
+
+namespace {
+
+void ExpectEvaluatesAsFunction(const TimingFunction& function) {
+  SCOPED_TRACE(function.ToString().Utf8());
+  const std::optional<PackedTimingFunction> packed =
+      PackTimingFunction(function);
+  ASSERT_TRUE(packed);
+  // The fractions step by 1 / 128 so that they're exact in float, and reach
+  // past both ends to extrapolate.
+  for (int i = -64; i <= 192; ++i) {
+    const double fraction = i / 128.0;
+    EXPECT_NEAR(
+        function.Evaluate(fraction, TimingFunction::LimitDirection::RIGHT),
+        EvaluatePackedTimingFunction(*packed, static_cast<float>(fraction)),
+        1e-4)
+        << fraction;
+  }
+}
+
+}  // namespace
+
+TEST(PackedTimingFunctionTest, EvaluatesAsTimingFunctions) {
+  test::TaskEnvironment task_environment;
+  using EaseType = CubicBezierTimingFunction::EaseType;
+  using StepPosition = StepsTimingFunction::StepPosition;
+
+  ExpectEvaluatesAsFunction(*LinearTimingFunction::Shared());
+  ExpectEvaluatesAsFunction(*LinearTimingFunction::Create(
+      std::vector<gfx::LinearEasingPoint>{
+          {0, 0}, {25, 0.5}, {25, 0.75}, {50, 0.75}, {100, 1}}));
+  ExpectEvaluatesAsFunction(*LinearTimingFunction::Create(
+      std::vector<gfx::LinearEasingPoint>{{20, 1}, {80, -1}}));
+
+  for (EaseType ease_type :
+       {EaseType::EASE, EaseType::EASE_IN, EaseType::EASE_OUT,
+        EaseType::EASE_IN_OUT}) {
+    ExpectEvaluatesAsFunction(*CubicBezierTimingFunction::Preset(ease_type));
+  }
+  ExpectEvaluatesAsFunction(
+      *CubicBezierTimingFunction::Create(0.1, -0.6, 0.2, 2.5));
+  ExpectEvaluatesAsFunction(*CubicBezierTimingFunction::Create(0, 1, 0, 1));
+
+  for (StepPosition position :
+       {StepPosition::START, StepPosition::END, StepPosition::JUMP_START,
+        StepPosition::JUMP_END, StepPosition::JUMP_BOTH,
+        StepPosition::JUMP_NONE}) {
+    ExpectEvaluatesAsFunction(*StepsTimingFunction::Create(4, position));
+  }
+}
+
+TEST(PackedTimingFunctionTest, TooManyLinearPoints) {
+  test::TaskEnvironment task_environment;
+  std::vector<gfx::LinearEasingPoint> points;
+  for (size_t i = 0; i < PackedTimingFunction::kMaxLinearPoints; ++i) {
+    points.push_back({100.0 * i / (PackedTimingFunction::kMaxLinearPoints - 1),
+                      (i % 2) ? 1.0 : 0.0});
+  }
+  ExpectEvaluatesAsFunction(*LinearTimingFunction::Create(points));
+
+  points.push_back({100, 1});
+  EXPECT_FALSE(PackTimingFunction(*LinearTimingFunction::Create(points)));
+}
+
+}  // namespace blink
@@ -5,8 +5,14 @@
 #include "third_party/blink/renderer/platform/animation/timing_function.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 
+#include "base/no_destructor.h"
 #include "base/notreached.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "third_party/blink/renderer/platform/wtf/text/strcat.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
 #include "ui/gfx/animation/keyframe/timing_function.h"
@@ -38,6 +44,69 @@ double LinearTimingFunction::Evaluate(
   return linear_->GetValue(fraction, limit_direction);
 }
 
+LinearTimingFunction::Evaluator::Evaluator(
+    scoped_refptr<const LinearTimingFunction> function)
+    : function_(std::move(function)) {}
+
+LinearTimingFunction::Evaluator::~Evaluator() = default;
+
+double LinearTimingFunction::Evaluator::Evaluate(
+    double fraction,
+    LimitDirection limit_direction) {
+  if (function_->IsTrivial()) {
+    return fraction;
+  }
+  return EvaluatePoints(function_->Points(), fraction, limit_direction,
+                        segment_);
+}
+
+// static
+double LinearTimingFunction::EvaluatePoints(
+    const std::vector<gfx::LinearEasingPoint>& points,
+    double fraction,
+    LimitDirection limit_direction,
+    size_t& segment) {
+  // https://drafts.csswg.org/css-easing-2/#linear-easing-function-output
+  // The segment starts at the last point whose input is before |input|, or
+  // at it for the right limit, and it is clamped to the first and last
+  // segments to extrapolate.
+  const double input = 100 * fraction;
+  const auto is_before = [input, limit_direction](
+                             const gfx::LinearEasingPoint& point) {
+    return limit_direction == LimitDirection::RIGHT ? point.input <= input
+                                                    : point.input < input;
+  };
+  const size_t last_segment = points.size() - 2;
+
+  // Walk a few segments from the last one.
+  constexpr int kMaxSteps = 4;
+  segment = std::min(segment, last_segment);
+  int steps = 0;
+  while (steps < kMaxSteps && segment > 0 && !is_before(points[segment])) {
+    --segment;
+    ++steps;
+  }
+  while (steps < kMaxSteps && segment < last_segment &&
+         is_before(points[segment + 1])) {
+    ++segment;
+    ++steps;
+  }
+  if (steps == kMaxSteps) {
+    auto it = std::partition_point(points.begin() + 1, points.end() - 1,
+                                   is_before);
+    segment = std::distance(points.begin(), it) - 1;
+  }
+
+  const gfx::LinearEasingPoint& point_a = points[segment];
+  const gfx::LinearEasingPoint& point_b = points[segment + 1];
+  if (point_a.input == point_b.input) {
+    return point_b.output;
+  }
+  const double progress =
+      (input - point_a.input) / (point_b.input - point_a.input);
+  return point_a.output + (point_b.output - point_a.output) * progress;
+}
+
 void LinearTimingFunction::Range(double* min_value, double* max_value) const {
   if (IsTrivial()) {
     return;
@@ -76,10 +145,104 @@ void LinearTimingFunction::Range(double* min_value, double* max_value) const {
   *max_value = std::max({min_val, max_val, max->output});
 }
 
+double LinearTimingFunction::NextOutputChange(double fraction) const {
+  if (IsTrivial()) {
+    return fraction;
+  }
+  // Find the segment of the right limit at |fraction| as EvaluatePoints()
+  // does, and skip it and the following ones while they're flat. The last
+  // segment extrapolates, so if it's flat the output never changes again.
+  const std::vector<gfx::LinearEasingPoint>& points = Points();
+  const double input = 100 * fraction;
+  auto it = std::partition_point(
+      points.begin() + 1, points.end() - 1,
+      [input](const gfx::LinearEasingPoint& point) {
+        return point.input <= input;
+      });
+  const size_t first_segment = std::distance(points.begin(), it) - 1;
+  size_t segment = first_segment;
+  while (points[segment].output == points[segment + 1].output) {
+    if (segment + 2 == points.size()) {
+      return std::numeric_limits<double>::infinity();
+    }
+    ++segment;
+  }
+  if (segment == first_segment) {
+    return fraction;
+  }
+  return std::max(fraction, points[segment].input / 100);
+}
+
 std::unique_ptr<gfx::TimingFunction> LinearTimingFunction::CloneToCC() const {
   return linear_->Clone();
 }
 
+namespace {
+
+// The custom cubic bezier timing functions by control points. The table holds
+// a reference to each of them, and drops the ones that nothing else references
+// whenever it has doubled in size since it last did.
+struct CubicBezierInternTable {
+  static constexpr size_t kMinPurgeSize = 64;
+
+  static CubicBezierInternTable& Get() {
+    static base::NoDestructor<CubicBezierInternTable> table;
+    return *table;
+  }
+
+  base::Lock lock;
+  base::flat_map<std::array<double, 4>,
+                 scoped_refptr<CubicBezierTimingFunction>>
+      functions GUARDED_BY(lock);
+  size_t purge_size GUARDED_BY(lock) = kMinPurgeSize;
+};
+
+}  // namespace
+
+// static
+scoped_refptr<CubicBezierTimingFunction> CubicBezierTimingFunction::Create(
+    double x1,
+    double y1,
+    double x2,
+    double y2) {
+  CubicBezierInternTable& table = CubicBezierInternTable::Get();
+  base::AutoLock locker(table.lock);
+  scoped_refptr<CubicBezierTimingFunction>& entry =
+      table.functions[{x1, y1, x2, y2}];
+  if (entry) {
+    return entry;
+  }
+
+  scoped_refptr<CubicBezierTimingFunction> function =
+      base::AdoptRef(new CubicBezierTimingFunction(x1, y1, x2, y2));
+  entry = function;
+  if (table.functions.size() >= table.purge_size) {
+    // Only the table can hand out new references, so an entry that has no
+    // other reference can't get one while the lock is held.
+    base::EraseIf(table.functions,
+                  [](const auto& item) { return item.second->HasOneRef(); });
+    table.purge_size = std::max(CubicBezierInternTable::kMinPurgeSize,
+                                2 * table.functions.size());
+  }
+  return function;
+}
+
+// static
+scoped_refptr<CubicBezierTimingFunction>
+CubicBezierTimingFunction::CreateWithLookupTable(
+    double x1,
+    double y1,
+    double x2,
+    double y2,
+    wtf_size_t lookup_table_size,
+    gfx::CubicBezierLUT::Interpolation interpolation) {
+  scoped_refptr<CubicBezierTimingFunction> function =
+      base::AdoptRef(new CubicBezierTimingFunction(x1, y1, x2, y2));
+  function->lookup_table_ = std::make_unique<gfx::CubicBezierLUT>(
+      function->bezier_->bezier(), lookup_table_size, interpolation);
+  return function;
+}
+
 CubicBezierTimingFunction* CubicBezierTimingFunction::Preset(
     EaseType ease_type) {
   DEFINE_STATIC_REF(
@@ -132,6 +295,9 @@ String CubicBezierTimingFunction::ToString() const {
 double CubicBezierTimingFunction::Evaluate(
     double fraction,
     TimingFunction::LimitDirection limit_direction) const {
+  if (lookup_table_) {
+    return lookup_table_->Solve(fraction);
+  }
   return bezier_->bezier().Solve(fraction);
 }
 
@@ -152,6 +318,19 @@ void CubicBezierTimingFunction::Range(double* min_value,
   *max_value = std::max(std::max(*max_value, solution1), solution2);
 }
 
+double CubicBezierTimingFunction::NextOutputChange(double fraction) const {
+  // Outside [0, 1], the curve is extended by its end gradients, with or
+  // without a lookup table, so it's flat there if the gradient is 0.
+  const gfx::CubicBezier& curve = bezier_->bezier();
+  if (fraction < 0 && curve.Solve(-1) == 0) {
+    return 0;
+  }
+  if (fraction > 1 && curve.Solve(2) == 1) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return fraction;
+}
+
 std::unique_ptr<gfx::TimingFunction> CubicBezierTimingFunction::CloneToCC()
     const {
   return bezier_->Clone();
@@ -206,6 +385,16 @@ double StepsTimingFunction::Evaluate(double fraction,
   return steps_->GetValue(fraction, limit_direction);
 }
 
+double StepsTimingFunction::NextOutputChange(double fraction) const {
+  if (!std::isfinite(fraction)) {
+    return fraction;
+  }
+  // The output can only change at multiples of the step length, whatever the
+  // step position.
+  const double steps = NumberOfSteps();
+  return std::max(fraction, (std::floor(fraction * steps) + 1) / steps);
+}
+
 std::unique_ptr<gfx::TimingFunction> StepsTimingFunction::CloneToCC() const {
   return steps_->Clone();
 }
@@ -303,4 +492,134 @@ bool operator==(const TimingFunction& lhs, const TimingFunction& rhs) {
   }
 }
 
+TimingFunctionEvaluator::TimingFunctionEvaluator(const TimingFunction& function)
+    : function_(Linear()) {
+  switch (function.GetType()) {
+    case TimingFunction::Type::LINEAR: {
+      const auto& linear = To<LinearTimingFunction>(function);
+      if (!linear.IsTrivial()) {
+        function_.emplace<Linear>(Linear{linear.Points()});
+      }
+      break;
+    }
+    case TimingFunction::Type::CUBIC_BEZIER: {
+      const auto& cubic = To<CubicBezierTimingFunction>(function);
+      if (cubic.lookup_table()) {
+        function_.emplace<gfx::CubicBezierLUT>(*cubic.lookup_table());
+      } else {
+        function_.emplace<gfx::CubicBezier>(cubic.bezier());
+      }
+      break;
+    }
+    case TimingFunction::Type::STEPS: {
+      const auto& steps = To<StepsTimingFunction>(function);
+      int jumps = steps.NumberOfSteps();
+      bool start = false;
+      switch (steps.GetStepPosition()) {
+        case StepsTimingFunction::StepPosition::START:
+        case StepsTimingFunction::StepPosition::JUMP_START:
+          start = true;
+          break;
+        case StepsTimingFunction::StepPosition::JUMP_BOTH:
+          start = true;
+          jumps += 1;
+          break;
+        case StepsTimingFunction::StepPosition::JUMP_NONE:
+          jumps -= 1;
+          break;
+        case StepsTimingFunction::StepPosition::END:
+        case StepsTimingFunction::StepPosition::JUMP_END:
+          break;
+      }
+      function_.emplace<Steps>(
+          Steps{static_cast<double>(steps.NumberOfSteps()),
+                static_cast<double>(jumps), start});
+      break;
+    }
+  }
+}
+
+TimingFunctionEvaluator::TimingFunctionEvaluator(
+    const TimingFunctionEvaluator& other) = default;
+
+TimingFunctionEvaluator::TimingFunctionEvaluator(
+    TimingFunctionEvaluator&& other) = default;
+
+TimingFunctionEvaluator::~TimingFunctionEvaluator() = default;
+
+TimingFunctionOutputTracker::TimingFunctionOutputTracker(
+    scoped_refptr<const TimingFunction> function)
+    : function_(std::move(function)), evaluator_(*function_) {}
+
+TimingFunctionOutputTracker::~TimingFunctionOutputTracker() = default;
+
+bool TimingFunctionOutputTracker::Update(double fraction) {
+  if (has_output_ && fraction >= fraction_ &&
+      fraction < next_change_fraction_) {
+    return false;
+  }
+  const double output =
+      evaluator_.Evaluate(fraction, TimingFunction::LimitDirection::RIGHT);
+  const bool changed = !has_output_ || output != output_;
+  has_output_ = true;
+  fraction_ = fraction;
+  output_ = output;
+  next_change_fraction_ = function_->NextOutputChange(fraction);
+  return changed;
+}
+
+TimingFunctionBatch::CubicGroup::CubicGroup(
+    scoped_refptr<const CubicBezierTimingFunction> function)
+    : function(std::move(function)) {}
+
+TimingFunctionBatch::CubicGroup::CubicGroup(CubicGroup&& other) = default;
+
+TimingFunctionBatch::CubicGroup::~CubicGroup() = default;
+
+TimingFunctionBatch::TimingFunctionBatch() = default;
+
+TimingFunctionBatch::~TimingFunctionBatch() = default;
+
+size_t TimingFunctionBatch::Add(scoped_refptr<const TimingFunction> function) {
+  DCHECK(function);
+  const size_t index = size_++;
+  if (function->GetType() == TimingFunction::Type::CUBIC_BEZIER) {
+    const auto* cubic = To<CubicBezierTimingFunction>(function.get());
+    // Functions with lookup tables are cheaper one by one.
+    if (!cubic->lookup_table()) {
+      auto [it, inserted] =
+          cubic_group_indices_.try_emplace(cubic, cubic_groups_.size());
+      if (inserted) {
+        cubic_groups_.emplace_back(scoped_refptr(cubic));
+      }
+      cubic_groups_[it->second].indices.push_back(index);
+      return index;
+    }
+  }
+  others_.push_back(Other{index, TimingFunctionEvaluator(*function)});
+  return index;
+}
+
+void TimingFunctionBatch::Evaluate(base::span<const double> fractions,
+                                   base::span<double> values) {
+  CHECK_EQ(fractions.size(), size_);
+  CHECK_EQ(values.size(), size_);
+
+  for (CubicGroup& group : cubic_groups_) {
+    const size_t group_size = group.indices.size();
+    group.fractions.resize(group_size);
+    group.values.resize(group_size);
+    for (size_t i = 0; i < group_size; ++i) {
+      group.fractions[i] = fractions[group.indices[i]];
+    }
+    group.function->bezier().SolveMany(group.fractions, group.values);
+    for (size_t i = 0; i < group_size; ++i) {
+      values[group.indices[i]] = group.values[i];
+    }
+  }
+  for (Other& other : others_) {
+    values[other.index] = other.evaluator.Evaluate(fractions[other.index]);
+  }
+}
+
 }  // namespace blink
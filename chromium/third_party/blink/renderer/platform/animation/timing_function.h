@@ -26,9 +26,14 @@
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_TIMING_FUNCTION_H_
 
 #include <algorithm>
+#include <cmath>
+#include <memory>
+#include <variant>
 #include <vector>
 
 #include "base/check_op.h"
+#include "base/containers/flat_map.h"
+#include "base/containers/span.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/notreached.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
@@ -37,6 +42,7 @@
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 #include "third_party/blink/renderer/platform/wtf/thread_safe_ref_counted.h"
 #include "ui/gfx/animation/keyframe/timing_function.h"
+#include "ui/gfx/geometry/cubic_bezier.h"
 
 namespace blink {
 
@@ -62,6 +68,15 @@ class PLATFORM_EXPORT TimingFunction
   // calling evaluate();
   virtual void Range(double* min_value, double* max_value) const = 0;
 
+  // Returns a hint of the next fraction, at least |fraction|, at which the
+  // output can change: Evaluate() with the right limit returns the same for
+  // every fraction from |fraction| up to, but not including, the result, so
+  // frames in between don't need to be evaluated. This is the next step for
+  // steps, the end of a flat segment for linear functions, and infinity for
+  // an end that stays flat forever. Where the output changes continuously,
+  // it's |fraction| itself.
+  virtual double NextOutputChange(double fraction) const = 0;
+
   // Create CC instance.
   virtual std::unique_ptr<gfx::TimingFunction> CloneToCC() const = 0;
 
@@ -100,6 +115,7 @@ class PLATFORM_EXPORT LinearTimingFunction final : public TimingFunction {
       double fraction,
       LimitDirection limit_direction = LimitDirection::RIGHT) const override;
   void Range(double* min_value, double* max_value) const override;
+  double NextOutputChange(double fraction) const override;
   std::unique_ptr<gfx::TimingFunction> CloneToCC() const override;
 
   const std::vector<gfx::LinearEasingPoint>& Points() const {
@@ -111,6 +127,34 @@ class PLATFORM_EXPORT LinearTimingFunction final : public TimingFunction {
     return std::ranges::equal(Points(), other.Points());
   }
 
+  // Evaluates a function at a sequence of fractions, such as the progress of
+  // an animation on successive frames. Each search for the segment of the
+  // points starts from the segment of the previous fraction and walks to the
+  // adjacent ones, and only falls back to a binary search on a larger jump,
+  // so that functions with many points are cheap to evaluate every frame.
+  class PLATFORM_EXPORT Evaluator {
+   public:
+    explicit Evaluator(scoped_refptr<const LinearTimingFunction> function);
+    ~Evaluator();
+
+    // Returns the same as function->Evaluate().
+    double Evaluate(double fraction,
+                    LimitDirection limit_direction = LimitDirection::RIGHT);
+
+   private:
+    scoped_refptr<const LinearTimingFunction> function_;
+    // The index of the first point of the last segment.
+    size_t segment_ = 0;
+  };
+
+  // Evaluates a non-trivial function with |points| at |fraction|. The search
+  // for the segment starts from |segment|, which is set to the segment found.
+  static double EvaluatePoints(
+      const std::vector<gfx::LinearEasingPoint>& points,
+      double fraction,
+      LimitDirection limit_direction,
+      size_t& segment);
+
  private:
   LinearTimingFunction()
       : TimingFunction(Type::LINEAR),
@@ -125,12 +169,25 @@ class PLATFORM_EXPORT CubicBezierTimingFunction final : public TimingFunction {
  public:
   using EaseType = gfx::CubicBezierTimingFunction::EaseType;
 
+  // Returns the same instance for the same control points while it is
+  // referenced, so that elements with the same cubic-bezier() value share its
+  // precomputed spline.
   static scoped_refptr<CubicBezierTimingFunction> Create(double x1,
                                                          double y1,
                                                          double x2,
-                                                         double y2) {
-    return base::AdoptRef(new CubicBezierTimingFunction(x1, y1, x2, y2));
-  }
+                                                         double y2);
+
+  // Same as Create(), but Evaluate() interpolates a gfx::CubicBezierLUT of
+  // |lookup_table_size| entries instead of solving the curve, which is cheaper
+  // but not exact. Other methods, and the clone for the compositor, still use
+  // the exact curve. The instance is not shared.
+  static scoped_refptr<CubicBezierTimingFunction> CreateWithLookupTable(
+      double x1,
+      double y1,
+      double x2,
+      double y2,
+      wtf_size_t lookup_table_size,
+      gfx::CubicBezierLUT::Interpolation interpolation);
 
   static CubicBezierTimingFunction* Preset(EaseType);
 
@@ -142,6 +199,7 @@ class PLATFORM_EXPORT CubicBezierTimingFunction final : public TimingFunction {
       double fraction,
       LimitDirection limit_direction = LimitDirection::RIGHT) const override;
   void Range(double* min_value, double* max_value) const override;
+  double NextOutputChange(double fraction) const override;
   std::unique_ptr<gfx::TimingFunction> CloneToCC() const override;
 
   double X1() const {
@@ -161,6 +219,12 @@ class PLATFORM_EXPORT CubicBezierTimingFunction final : public TimingFunction {
     return y2_;
   }
   EaseType GetEaseType() const { return bezier_->ease_type(); }
+  const gfx::CubicBezier& bezier() const { return bezier_->bezier(); }
+
+  // Null unless created by CreateWithLookupTable().
+  const gfx::CubicBezierLUT* lookup_table() const {
+    return lookup_table_.get();
+  }
 
  private:
   explicit CubicBezierTimingFunction(EaseType ease_type)
@@ -180,6 +244,7 @@ class PLATFORM_EXPORT CubicBezierTimingFunction final : public TimingFunction {
         y2_(y2) {}
 
   std::unique_ptr<gfx::CubicBezierTimingFunction> bezier_;
+  std::unique_ptr<const gfx::CubicBezierLUT> lookup_table_;
 
   // TODO(loyso): Get these values from m_bezier->bezier_ (gfx::CubicBezier)
   const double x1_;
@@ -219,6 +284,7 @@ class PLATFORM_EXPORT StepsTimingFunction final : public TimingFunction {
                   LimitDirection limit_direction) const override;
 
   void Range(double* min_value, double* max_value) const override;
+  double NextOutputChange(double fraction) const override;
   std::unique_ptr<gfx::TimingFunction> CloneToCC() const override;
 
   int NumberOfSteps() const { return steps_->steps(); }
@@ -263,6 +329,163 @@ struct DowncastTraits<StepsTimingFunction> {
   }
 };
 
+// A copy of a TimingFunction that evaluates it without virtual calls, and
+// without referencing it, for code that evaluates many timing functions in a
+// loop.
+class PLATFORM_EXPORT TimingFunctionEvaluator {
+ public:
+  using LimitDirection = TimingFunction::LimitDirection;
+
+  explicit TimingFunctionEvaluator(const TimingFunction& function);
+  TimingFunctionEvaluator(const TimingFunctionEvaluator& other);
+  TimingFunctionEvaluator(TimingFunctionEvaluator&& other);
+  ~TimingFunctionEvaluator();
+
+  // gfx::CubicBezier and gfx::CubicBezierLUT aren't assignable.
+  TimingFunctionEvaluator& operator=(const TimingFunctionEvaluator&) = delete;
+
+  // Returns the same as TimingFunction::Evaluate(). Successive evaluations of
+  // linear functions start searching from the last segment, as with
+  // LinearTimingFunction::Evaluator.
+  double Evaluate(double fraction,
+                  LimitDirection limit_direction = LimitDirection::RIGHT) {
+    if (auto* cubic = std::get_if<gfx::CubicBezier>(&function_)) {
+      return cubic->Solve(fraction);
+    }
+    if (auto* lookup_table = std::get_if<gfx::CubicBezierLUT>(&function_)) {
+      return lookup_table->Solve(fraction);
+    }
+    if (auto* steps = std::get_if<Steps>(&function_)) {
+      return steps->Evaluate(fraction, limit_direction);
+    }
+    Linear& linear = std::get<Linear>(function_);
+    if (linear.points.empty()) {
+      return fraction;
+    }
+    return LinearTimingFunction::EvaluatePoints(
+        linear.points, fraction, limit_direction, linear.segment);
+  }
+
+ private:
+  struct Linear {
+    // Empty for trivial functions.
+    std::vector<gfx::LinearEasingPoint> points;
+    size_t segment = 0;
+  };
+
+  struct Steps {
+    // https://drafts.csswg.org/css-easing-1/#step-easing-algo, computed as
+    // gfx::StepsTimingFunction does.
+    double Evaluate(double fraction, LimitDirection limit_direction) const {
+      double current_step = std::floor(fraction * steps + (start ? 1 : 0));
+      if (limit_direction == LimitDirection::LEFT &&
+          fraction * steps - std::floor(fraction * steps) == 0) {
+        current_step -= 1;
+      }
+      if (fraction >= 0 && current_step < 0) {
+        current_step = 0;
+      }
+      if (fraction <= 1 && current_step > jumps) {
+        current_step = jumps;
+      }
+      return current_step / jumps;
+    }
+
+    double steps;
+    double jumps;
+    // Whether there is a jump at the start.
+    bool start;
+  };
+
+  std::variant<Linear, gfx::CubicBezier, gfx::CubicBezierLUT, Steps> function_;
+};
+
+// Tracks the output of a timing function over the frames of an animation, so
+// that the work that depends on it, such as blending keyframes and
+// invalidating, can be skipped on frames where it doesn't change. Frames
+// before next_change_fraction() aren't evaluated at all, so an animation can
+// also sleep until then.
+class PLATFORM_EXPORT TimingFunctionOutputTracker {
+ public:
+  explicit TimingFunctionOutputTracker(
+      scoped_refptr<const TimingFunction> function);
+  TimingFunctionOutputTracker(const TimingFunctionOutputTracker&) = delete;
+  TimingFunctionOutputTracker& operator=(const TimingFunctionOutputTracker&) =
+      delete;
+  ~TimingFunctionOutputTracker();
+
+  // Updates output() to the output at |fraction|, and returns true if it
+  // changed. The first update always returns true. The function isn't
+  // evaluated if |fraction| is between the last evaluated fraction and
+  // next_change_fraction().
+  bool Update(double fraction);
+
+  double output() const {
+    DCHECK(has_output_);
+    return output_;
+  }
+  double next_change_fraction() const {
+    DCHECK(has_output_);
+    return next_change_fraction_;
+  }
+
+ private:
+  scoped_refptr<const TimingFunction> function_;
+  TimingFunctionEvaluator evaluator_;
+  bool has_output_ = false;
+  // The last evaluated fraction, and the output there.
+  double fraction_ = 0;
+  double output_ = 0;
+  double next_change_fraction_ = 0;
+};
+
+// Evaluates many timing functions at once, such as those of all the running
+// animations on a frame, in structure-of-arrays form. The fractions of each
+// shared cubic bezier function (presets, and those from
+// CubicBezierTimingFunction::Create(), are shared) are solved together with
+// gfx::CubicBezier::SolveMany(), and the other functions are evaluated one by
+// one with TimingFunctionEvaluators.
+class PLATFORM_EXPORT TimingFunctionBatch {
+ public:
+  TimingFunctionBatch();
+  TimingFunctionBatch(const TimingFunctionBatch&) = delete;
+  TimingFunctionBatch& operator=(const TimingFunctionBatch&) = delete;
+  ~TimingFunctionBatch();
+
+  // Adds |function|, and returns its index in the fractions and values of
+  // Evaluate().
+  size_t Add(scoped_refptr<const TimingFunction> function);
+  size_t size() const { return size_; }
+
+  // Sets each values[i] to the Evaluate(fractions[i]) of the i-th function.
+  // Both spans must have size() elements.
+  void Evaluate(base::span<const double> fractions, base::span<double> values);
+
+ private:
+  struct CubicGroup {
+    explicit CubicGroup(scoped_refptr<const CubicBezierTimingFunction> function);
+    CubicGroup(CubicGroup&& other);
+    ~CubicGroup();
+
+    scoped_refptr<const CubicBezierTimingFunction> function;
+    std::vector<size_t> indices;
+    // Scratch space for Evaluate().
+    std::vector<double> fractions;
+    std::vector<double> values;
+  };
+
+  struct Other {
+    size_t index;
+    TimingFunctionEvaluator evaluator;
+  };
+
+  size_t size_ = 0;
+  std::vector<CubicGroup> cubic_groups_;
+  base::flat_map<const CubicBezierTimingFunction*, size_t>
+      cubic_group_indices_;
+  std::vector<Other> others_;
+};
+
 }  // namespace blink
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_TIMING_FUNCTION_H_
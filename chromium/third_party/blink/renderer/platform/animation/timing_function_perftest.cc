@@ -0,0 +1,214 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Microbenchmarks of the evaluation of timing functions, for the
+// blink_platform_perftests target. Each benchmark runs for every function in
+// FunctionKind, with the fractions sampled in random order and in increasing
+// order (as an animation samples them on successive frames), and reports the
+// time per evaluation in the time_per_eval counter. Run with
+// --benchmark_format=json to get results that can be diffed across versions,
+// e.g. with tools/compare.py of google_benchmark.
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "base/memory/scoped_refptr.h"
+#include "third_party/blink/renderer/platform/animation/timing_function.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+#include "ui/gfx/animation/keyframe/timing_function.h"
+#include "ui/gfx/geometry/cubic_bezier.h"
+
+namespace blink {
+
+namespace {
+
+enum class FunctionKind {
+  kLinear2,
+  kLinear200,
+  kEase,
+  kEaseIn,
+  kEaseOut,
+  kEaseInOut,
+  // Custom curves whose x slope vanishes at some t, where Newton's method
+  // fails and the solver falls back to bisection.
+  kFlatMiddle,
+  kFlatEnds,
+  // kFlatMiddle, from a lookup table.
+  kFlatMiddleLookupTable,
+  kStepsStart,
+  kStepsEnd,
+  kStepsJumpBoth,
+  kStepsJumpEnd,
+  kStepsJumpNone,
+  kStepsJumpStart,
+};
+constexpr int kNumFunctionKinds = 15;
+
+enum class AccessPattern {
+  kRandom,
+  kMonotonic,
+};
+
+const char* FunctionKindName(FunctionKind kind) {
+  switch (kind) {
+    case FunctionKind::kLinear2:
+      return "linear_2";
+    case FunctionKind::kLinear200:
+      return "linear_200";
+    case FunctionKind::kEase:
+      return "ease";
+    case FunctionKind::kEaseIn:
+      return "ease_in";
+    case FunctionKind::kEaseOut:
+      return "ease_out";
+    case FunctionKind::kEaseInOut:
+      return "ease_in_out";
+    case FunctionKind::kFlatMiddle:
+      return "flat_middle";
+    case FunctionKind::kFlatEnds:
+      return "flat_ends";
+    case FunctionKind::kFlatMiddleLookupTable:
+      return "flat_middle_lookup_table";
+    case FunctionKind::kStepsStart:
+      return "steps_start";
+    case FunctionKind::kStepsEnd:
+      return "steps_end";
+    case FunctionKind::kStepsJumpBoth:
+      return "steps_jump_both";
+    case FunctionKind::kStepsJumpEnd:
+      return "steps_jump_end";
+    case FunctionKind::kStepsJumpNone:
+      return "steps_jump_none";
+    case FunctionKind::kStepsJumpStart:
+      return "steps_jump_start";
+  }
+}
+
+std::vector<gfx::LinearEasingPoint> MakeLinearPoints(int count) {
+  std::vector<gfx::LinearEasingPoint> points;
+  for (int i = 0; i < count; ++i) {
+    double input = 100.0 * i / (count - 1);
+    // A wavy output, so that segments differ.
+    points.push_back({input, input / 100 + (i % 2 ? 0.1 : -0.1)});
+  }
+  points.front().output = 0;
+  points.back().output = 1;
+  return points;
+}
+
+scoped_refptr<TimingFunction> MakeFunction(FunctionKind kind) {
+  using EaseType = CubicBezierTimingFunction::EaseType;
+  using StepPosition = StepsTimingFunction::StepPosition;
+  switch (kind) {
+    case FunctionKind::kLinear2:
+      return LinearTimingFunction::Create(MakeLinearPoints(2));
+    case FunctionKind::kLinear200:
+      return LinearTimingFunction::Create(MakeLinearPoints(200));
+    case FunctionKind::kEase:
+      return CubicBezierTimingFunction::Preset(EaseType::EASE);
+    case FunctionKind::kEaseIn:
+      return CubicBezierTimingFunction::Preset(EaseType::EASE_IN);
+    case FunctionKind::kEaseOut:
+      return CubicBezierTimingFunction::Preset(EaseType::EASE_OUT);
+    case FunctionKind::kEaseInOut:
+      return CubicBezierTimingFunction::Preset(EaseType::EASE_IN_OUT);
+    case FunctionKind::kFlatMiddle:
+      return CubicBezierTimingFunction::Create(1, 0, 0, 1);
+    case FunctionKind::kFlatEnds:
+      return CubicBezierTimingFunction::Create(0, 0.5, 1, 0.5);
+    case FunctionKind::kFlatMiddleLookupTable:
+      return CubicBezierTimingFunction::CreateWithLookupTable(
+          1, 0, 0, 1, 65, gfx::CubicBezierLUT::Interpolation::kCubicHermite);
+    case FunctionKind::kStepsStart:
+      return StepsTimingFunction::Create(4, StepPosition::START);
+    case FunctionKind::kStepsEnd:
+      return StepsTimingFunction::Create(4, StepPosition::END);
+    case FunctionKind::kStepsJumpBoth:
+      return StepsTimingFunction::Create(4, StepPosition::JUMP_BOTH);
+    case FunctionKind::kStepsJumpEnd:
+      return StepsTimingFunction::Create(4, StepPosition::JUMP_END);
+    case FunctionKind::kStepsJumpNone:
+      return StepsTimingFunction::Create(4, StepPosition::JUMP_NONE);
+    case FunctionKind::kStepsJumpStart:
+      return StepsTimingFunction::Create(4, StepPosition::JUMP_START);
+  }
+}
+
+constexpr size_t kNumFractions = 1024;
+
+// Returns the fractions to evaluate in order, all in [0, 1].
+std::vector<double> MakeFractions(AccessPattern pattern) {
+  std::vector<double> fractions(kNumFractions);
+  if (pattern == AccessPattern::kMonotonic) {
+    for (size_t i = 0; i < kNumFractions; ++i) {
+      fractions[i] = static_cast<double>(i) / (kNumFractions - 1);
+    }
+    return fractions;
+  }
+  // A fixed seed, so that runs are comparable.
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0, 1);
+  for (double& fraction : fractions) {
+    fraction = distribution(generator);
+  }
+  return fractions;
+}
+
+FunctionKind GetKind(benchmark::State& state) {
+  auto kind = static_cast<FunctionKind>(state.range(0));
+  auto pattern = static_cast<AccessPattern>(state.range(1));
+  const char* pattern_name =
+      pattern == AccessPattern::kRandom ? "random" : "monotonic";
+  state.SetLabel(std::string(FunctionKindName(kind)) + "/" + pattern_name);
+  return kind;
+}
+
+void SetTimePerEval(benchmark::State& state) {
+  state.counters["time_per_eval"] = benchmark::Counter(
+      kNumFractions, benchmark::Counter::kIsIterationInvariantRate |
+                         benchmark::Counter::kInvert);
+}
+
+// Each iteration evaluates all the fractions, so that the cost of the loop
+// is amortized.
+void BM_Evaluate(benchmark::State& state) {
+  scoped_refptr<TimingFunction> function = MakeFunction(GetKind(state));
+  const std::vector<double> fractions =
+      MakeFractions(static_cast<AccessPattern>(state.range(1)));
+  for (auto _ : state) {
+    for (double fraction : fractions) {
+      benchmark::DoNotOptimize(function->Evaluate(fraction));
+    }
+  }
+  SetTimePerEval(state);
+}
+
+void BM_TimingFunctionEvaluator(benchmark::State& state) {
+  scoped_refptr<TimingFunction> function = MakeFunction(GetKind(state));
+  TimingFunctionEvaluator evaluator(*function);
+  const std::vector<double> fractions =
+      MakeFractions(static_cast<AccessPattern>(state.range(1)));
+  for (auto _ : state) {
+    for (double fraction : fractions) {
+      benchmark::DoNotOptimize(evaluator.Evaluate(fraction));
+    }
+  }
+  SetTimePerEval(state);
+}
+
+void FunctionKindsAndPatterns(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"kind", "pattern"});
+  for (int kind = 0; kind < kNumFunctionKinds; ++kind) {
+    benchmark->Args({kind, static_cast<int>(AccessPattern::kRandom)});
+    benchmark->Args({kind, static_cast<int>(AccessPattern::kMonotonic)});
+  }
+}
+
+BENCHMARK(BM_Evaluate)->Apply(FunctionKindsAndPatterns);
+BENCHMARK(BM_TimingFunctionEvaluator)->Apply(FunctionKindsAndPatterns);
+
+}  // namespace
+
+}  // namespace blink
@@ -30,6 +30,8 @@
 
 #include "third_party/blink/renderer/platform/animation/timing_function.h"
 
+#include <cmath>
+#include <limits>
 #include <sstream>
 #include <string>
 #include "testing/gmock/include/gmock/gmock.h"
@@ -282,6 +284,52 @@ TEST_F(TimingFunctionTest, LinearEvaluate) {
   EXPECT_EQ(-.5, linear_timing_complex->Evaluate(-.25));
 }
 
+TEST_F(TimingFunctionTest, LinearEvaluator) {
+  // Many points, like the ones generated for springs, and a jump at 50%.
+  std::vector<gfx::LinearEasingPoint> points;
+  for (int i = 0; i <= 50; ++i) {
+    points.push_back({i * 1.0, std::sin(i * 0.3)});
+  }
+  for (int i = 50; i <= 100; ++i) {
+    points.push_back({i * 1.0, 2 + std::sin(i * 0.3)});
+  }
+  scoped_refptr<LinearTimingFunction> linear_timing =
+      LinearTimingFunction::Create(std::move(points));
+
+  LinearTimingFunction::Evaluator evaluator(linear_timing);
+  // Forward and backward in small steps, then large jumps, and outside
+  // [0, 1].
+  std::vector<double> fractions;
+  for (int i = 0; i <= 200; ++i) {
+    fractions.push_back(i / 200.0);
+  }
+  for (int i = 200; i >= 0; --i) {
+    fractions.push_back(i / 200.0 + 0.001);
+  }
+  for (double fraction : {0.9, 0.1, 0.55, 0.05, -0.5, 1.5, 0.5, 0.333}) {
+    fractions.push_back(fraction);
+  }
+  for (double fraction : fractions) {
+    EXPECT_DOUBLE_EQ(linear_timing->Evaluate(fraction),
+                     evaluator.Evaluate(fraction))
+        << fraction;
+  }
+
+  // The limit direction picks the side of the jump.
+  EXPECT_DOUBLE_EQ(
+      std::sin(15.0),
+      evaluator.Evaluate(0.5, TimingFunction::LimitDirection::LEFT));
+  EXPECT_DOUBLE_EQ(
+      2 + std::sin(15.0),
+      evaluator.Evaluate(0.5, TimingFunction::LimitDirection::RIGHT));
+
+  // Trivial functions return the fraction.
+  LinearTimingFunction::Evaluator trivial_evaluator(
+      LinearTimingFunction::Shared());
+  EXPECT_EQ(0.2, trivial_evaluator.Evaluate(0.2));
+  EXPECT_EQ(1.6, trivial_evaluator.Evaluate(1.6));
+}
+
 TEST_F(TimingFunctionTest, LinearRange) {
   double start = 0;
   double end = 1;
@@ -434,6 +482,187 @@ TEST_F(TimingFunctionTest, CubicEvaluate) {
   EXPECT_NEAR(-0.335, cubic_custom_timing->Evaluate(0.75), tolerance);
 }
 
+TEST_F(TimingFunctionTest, CubicCreateSharesInstances) {
+  scoped_refptr<CubicBezierTimingFunction> a =
+      CubicBezierTimingFunction::Create(0.17, 0.67, 1, -1.73);
+  scoped_refptr<CubicBezierTimingFunction> b =
+      CubicBezierTimingFunction::Create(0.17, 0.67, 1, -1.73);
+  scoped_refptr<CubicBezierTimingFunction> c =
+      CubicBezierTimingFunction::Create(0.17, 0.67, 1, -1.7);
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_EQ(CubicBezierTimingFunction::EaseType::CUSTOM, a->GetEaseType());
+
+  // Curves with lookup tables are never shared.
+  scoped_refptr<CubicBezierTimingFunction> d =
+      CubicBezierTimingFunction::CreateWithLookupTable(
+          0.17, 0.67, 1, -1.73, 16,
+          gfx::CubicBezierLUT::Interpolation::kLinear);
+  EXPECT_NE(a, d);
+  EXPECT_FALSE(a->lookup_table());
+
+  // Unreferenced curves are dropped as more are created, and the referenced
+  // ones are still shared.
+  for (int i = 0; i < 1000; ++i) {
+    CubicBezierTimingFunction::Create(0.5, i, 0.5, 1);
+  }
+  EXPECT_EQ(a, CubicBezierTimingFunction::Create(0.17, 0.67, 1, -1.73));
+}
+
+TEST_F(TimingFunctionTest, CubicEvaluateWithLookupTable) {
+  scoped_refptr<CubicBezierTimingFunction> exact =
+      CubicBezierTimingFunction::Create(0.17, 0.67, 1, -1.73);
+  scoped_refptr<CubicBezierTimingFunction> approximate =
+      CubicBezierTimingFunction::CreateWithLookupTable(
+          0.17, 0.67, 1, -1.73, 64,
+          gfx::CubicBezierLUT::Interpolation::kCubicHermite);
+  EXPECT_FALSE(exact->lookup_table());
+  ASSERT_TRUE(approximate->lookup_table());
+  EXPECT_EQ(*exact, *approximate);
+
+  double tolerance = approximate->lookup_table()->MaxError();
+  EXPECT_LT(tolerance, 1e-4);
+  for (double fraction : {-0.5, 0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0, 1.5}) {
+    EXPECT_NEAR(exact->Evaluate(fraction), approximate->Evaluate(fraction),
+                tolerance);
+  }
+}
+
+TEST_F(TimingFunctionTest, TimingFunctionEvaluator) {
+  using StepPosition = StepsTimingFunction::StepPosition;
+  Vector<scoped_refptr<TimingFunction>> functions = {
+      LinearTimingFunction::Shared(),
+      LinearTimingFunction::Create(
+          std::vector<gfx::LinearEasingPoint>{{0, 0}, {50, 1}, {60, .5},
+                                              {100, 1}}),
+      CubicBezierTimingFunction::Preset(
+          CubicBezierTimingFunction::EaseType::EASE_IN_OUT),
+      CubicBezierTimingFunction::Create(0.17, 0.67, 1, -1.73),
+      CubicBezierTimingFunction::CreateWithLookupTable(
+          0.17, 0.67, 1, -1.73, 32,
+          gfx::CubicBezierLUT::Interpolation::kLinear),
+      StepsTimingFunction::Create(3, StepPosition::START),
+      StepsTimingFunction::Create(3, StepPosition::END),
+      StepsTimingFunction::Create(4, StepPosition::JUMP_BOTH),
+      StepsTimingFunction::Create(4, StepPosition::JUMP_END),
+      StepsTimingFunction::Create(4, StepPosition::JUMP_NONE),
+      StepsTimingFunction::Create(4, StepPosition::JUMP_START)};
+
+  for (const auto& function : functions) {
+    TimingFunctionEvaluator evaluator(*function);
+    for (int i = -20; i <= 120; ++i) {
+      double fraction = i / 100.0;
+      for (auto limit_direction : {TimingFunction::LimitDirection::LEFT,
+                                   TimingFunction::LimitDirection::RIGHT}) {
+        EXPECT_DOUBLE_EQ(function->Evaluate(fraction, limit_direction),
+                         evaluator.Evaluate(fraction, limit_direction))
+            << function->ToString() << " at " << fraction;
+      }
+    }
+  }
+
+  // The evaluator doesn't reference the function.
+  scoped_refptr<TimingFunction> function =
+      StepsTimingFunction::Create(2, StepPosition::END);
+  TimingFunctionEvaluator evaluator(*function);
+  function = nullptr;
+  EXPECT_EQ(0.5, evaluator.Evaluate(0.75));
+}
+
+TEST_F(TimingFunctionTest, TimingFunctionBatch) {
+  using EaseType = CubicBezierTimingFunction::EaseType;
+  Vector<scoped_refptr<TimingFunction>> functions = {
+      CubicBezierTimingFunction::Preset(EaseType::EASE),
+      LinearTimingFunction::Shared(),
+      CubicBezierTimingFunction::Create(0.17, 0.67, 1, -1.73),
+      CubicBezierTimingFunction::Preset(EaseType::EASE),
+      StepsTimingFunction::Create(3, StepsTimingFunction::StepPosition::START),
+      CubicBezierTimingFunction::CreateWithLookupTable(
+          0.17, 0.67, 1, -1.73, 32,
+          gfx::CubicBezierLUT::Interpolation::kLinear),
+      CubicBezierTimingFunction::Create(0.17, 0.67, 1, -1.73)};
+
+  TimingFunctionBatch batch;
+  for (wtf_size_t i = 0; i < functions.size(); ++i) {
+    EXPECT_EQ(i, batch.Add(functions[i]));
+  }
+  EXPECT_EQ(functions.size(), batch.size());
+
+  std::vector<double> fractions(functions.size());
+  std::vector<double> values(functions.size());
+  for (int step = -2; step <= 12; ++step) {
+    for (wtf_size_t i = 0; i < functions.size(); ++i) {
+      fractions[i] = step / 10.0 + i / 100.0;
+    }
+    batch.Evaluate(fractions, values);
+    for (wtf_size_t i = 0; i < functions.size(); ++i) {
+      EXPECT_DOUBLE_EQ(functions[i]->Evaluate(fractions[i]), values[i])
+          << functions[i]->ToString() << " at " << fractions[i];
+    }
+  }
+}
+
+TEST_F(TimingFunctionTest, NextOutputChange) {
+  using EaseType = CubicBezierTimingFunction::EaseType;
+  constexpr double kInfinity = std::numeric_limits<double>::infinity();
+
+  scoped_refptr<TimingFunction> steps =
+      StepsTimingFunction::Create(4, StepsTimingFunction::StepPosition::END);
+  EXPECT_EQ(0.25, steps->NextOutputChange(0.1));
+  EXPECT_EQ(0.5, steps->NextOutputChange(0.25));
+  EXPECT_EQ(-0.25, steps->NextOutputChange(-0.3));
+  EXPECT_EQ(1.25, steps->NextOutputChange(1));
+
+  // Ease-in is flat before its start, and ease-out after its end.
+  const TimingFunction* ease_in =
+      CubicBezierTimingFunction::Preset(EaseType::EASE_IN);
+  EXPECT_EQ(0, ease_in->NextOutputChange(-0.5));
+  EXPECT_EQ(0.5, ease_in->NextOutputChange(0.5));
+  EXPECT_EQ(1.5, ease_in->NextOutputChange(1.5));
+  const TimingFunction* ease_out =
+      CubicBezierTimingFunction::Preset(EaseType::EASE_OUT);
+  EXPECT_EQ(-0.5, ease_out->NextOutputChange(-0.5));
+  EXPECT_EQ(1, ease_out->NextOutputChange(1));
+  EXPECT_EQ(kInfinity, ease_out->NextOutputChange(1.5));
+
+  EXPECT_EQ(0.5, LinearTimingFunction::Shared()->NextOutputChange(0.5));
+  scoped_refptr<TimingFunction> linear = LinearTimingFunction::Create(
+      std::vector<gfx::LinearEasingPoint>{
+          {0, 0}, {25, 0.5}, {75, 0.5}, {100, 1}});
+  EXPECT_EQ(0.1, linear->NextOutputChange(0.1));
+  EXPECT_EQ(0.75, linear->NextOutputChange(0.25));
+  EXPECT_EQ(0.75, linear->NextOutputChange(0.3));
+  EXPECT_EQ(0.8, linear->NextOutputChange(0.8));
+  scoped_refptr<TimingFunction> flat_end = LinearTimingFunction::Create(
+      std::vector<gfx::LinearEasingPoint>{{0, 0}, {50, 1}, {100, 1}});
+  EXPECT_EQ(kInfinity, flat_end->NextOutputChange(0.6));
+  EXPECT_EQ(kInfinity, flat_end->NextOutputChange(1.5));
+}
+
+TEST_F(TimingFunctionTest, TimingFunctionOutputTracker) {
+  TimingFunctionOutputTracker steps(
+      StepsTimingFunction::Create(4, StepsTimingFunction::StepPosition::END));
+  EXPECT_TRUE(steps.Update(0));
+  EXPECT_EQ(0, steps.output());
+  EXPECT_EQ(0.25, steps.next_change_fraction());
+  EXPECT_FALSE(steps.Update(0.1));
+  EXPECT_FALSE(steps.Update(0.2));
+  EXPECT_TRUE(steps.Update(0.25));
+  EXPECT_EQ(0.25, steps.output());
+  EXPECT_FALSE(steps.Update(0.3));
+  // Going back evaluates again.
+  EXPECT_TRUE(steps.Update(0.1));
+  EXPECT_EQ(0, steps.output());
+
+  TimingFunctionOutputTracker ease_out(CubicBezierTimingFunction::Preset(
+      CubicBezierTimingFunction::EaseType::EASE_OUT));
+  EXPECT_TRUE(ease_out.Update(0.5));
+  EXPECT_TRUE(ease_out.Update(0.6));
+  EXPECT_TRUE(ease_out.Update(1.5));
+  EXPECT_EQ(1, ease_out.output());
+  EXPECT_FALSE(ease_out.Update(3));
+}
+
 TEST_F(TimingFunctionTest, StepsEvaluate) {
   TimingFunction::LimitDirection left = TimingFunction::LimitDirection::LEFT;
   TimingFunction::LimitDirection right = TimingFunction::LimitDirection::RIGHT;
@@ -0,0 +1,125 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/animation/transform_keyframe_batch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "base/check_op.h"
+#include "base/functional/bind.h"
+#include "base/task/post_job.h"
+#include "base/task/task_traits.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace blink {
+
+namespace {
+
+// The number of keyframe pairs of each chunk blended by a worker.
+constexpr size_t kKeyframesPerParallelChunk = 32;
+
+// Calls Blend(begin, end) for each chunk of [0, size) with a job, which the
+// calling thread joins. Each worker takes the next chunk that no other worker
+// took.
+template <typename BlendFunction>
+class ParallelChunkBlending {
+  STACK_ALLOCATED();
+
+ public:
+  ParallelChunkBlending(size_t size, const BlendFunction& blend)
+      : size_(size),
+        chunk_count_((size + kKeyframesPerParallelChunk - 1) /
+                     kKeyframesPerParallelChunk),
+        blend_(blend) {}
+
+  void Run() {
+    base::PostJob(
+        FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+        base::BindRepeating(&ParallelChunkBlending::BlendChunks,
+                            base::Unretained(this)),
+        base::BindRepeating(&ParallelChunkBlending::GetMaxConcurrency,
+                            base::Unretained(this)))
+        .Join();
+  }
+
+ private:
+  void BlendChunks(base::JobDelegate* delegate) {
+    while (!delegate->ShouldYield()) {
+      const size_t chunk = next_chunk_.fetch_add(1);
+      if (chunk >= chunk_count_) {
+        return;
+      }
+      const size_t begin = chunk * kKeyframesPerParallelChunk;
+      blend_(begin, std::min(begin + kKeyframesPerParallelChunk, size_));
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t) const {
+    return chunk_count_ - std::min(next_chunk_.load(), chunk_count_);
+  }
+
+  const size_t size_;
+  const size_t chunk_count_;
+  const BlendFunction& blend_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+}  // namespace
+
+TransformKeyframeBatch::Keyframes::Keyframes(
+    scoped_refptr<const gfx::SharedTransformOperations> from,
+    scoped_refptr<const gfx::SharedTransformOperations> to)
+    : from(std::move(from)), to(std::move(to)) {}
+
+TransformKeyframeBatch::Keyframes::Keyframes(Keyframes&& other) = default;
+
+TransformKeyframeBatch::Keyframes& TransformKeyframeBatch::Keyframes::operator=(
+    Keyframes&& other) = default;
+
+TransformKeyframeBatch::Keyframes::~Keyframes() = default;
+
+TransformKeyframeBatch::TransformKeyframeBatch() = default;
+
+TransformKeyframeBatch::~TransformKeyframeBatch() = default;
+
+size_t TransformKeyframeBatch::Add(
+    scoped_refptr<const gfx::SharedTransformOperations> from,
+    scoped_refptr<const gfx::SharedTransformOperations> to,
+    scoped_refptr<const TimingFunction> timing_function) {
+  DCHECK(from);
+  DCHECK(to);
+  const size_t index = timing_functions_.Add(std::move(timing_function));
+  DCHECK_EQ(index, keyframes_.size());
+  keyframes_.emplace_back(std::move(from), std::move(to));
+  return index;
+}
+
+void TransformKeyframeBatch::Evaluate(
+    base::span<const double> fractions,
+    base::span<gfx::TransformOperations> results) {
+  CHECK_EQ(fractions.size(), size());
+  CHECK_EQ(results.size(), size());
+
+  progress_.resize(size());
+  timing_functions_.Evaluate(fractions, progress_);
+
+  // The keyframes are only read, and each result is only written by the
+  // worker that blends it.
+  auto blend = [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const Keyframes& keyframes = keyframes_[i];
+      results[i] = keyframes.to->operations().Blend(
+          keyframes.from->operations(), progress_[i]);
+    }
+  };
+  if (size() < kMinSizeForParallelBlending) {
+    blend(0, size());
+    return;
+  }
+  ParallelChunkBlending<decltype(blend)>(size(), blend).Run();
+}
+
+}  // namespace blink
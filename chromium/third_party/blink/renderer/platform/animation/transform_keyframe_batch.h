@@ -0,0 +1,74 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_TRANSFORM_KEYFRAME_BATCH_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_TRANSFORM_KEYFRAME_BATCH_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "base/containers/span.h"
+#include "base/memory/scoped_refptr.h"
+#include "third_party/blink/renderer/platform/animation/timing_function.h"
+#include "third_party/blink/renderer/platform/platform_export.h"
+#include "ui/gfx/geometry/shared_transform_operations.h"
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace blink {
+
+// Blends the keyframes of many transform animations at once, such as all the
+// running ones of a frame. The timing functions are evaluated together with a
+// TimingFunctionBatch, and then batches of at least
+// kMinSizeForParallelBlending keyframe pairs are split into chunks, which
+// workers of the thread pool take one at a time while the calling thread joins
+// them. Each pair is blended into its own slot of the results, so the results
+// don't depend on which worker took which chunk. Smaller batches are blended on
+// the calling thread. The keyframes are SharedTransformOperations, which can be
+// blended on several threads at once, e.g. those of
+// ToGfxTransformOperations().
+class PLATFORM_EXPORT TransformKeyframeBatch {
+ public:
+  static constexpr size_t kMinSizeForParallelBlending = 256;
+
+  TransformKeyframeBatch();
+  TransformKeyframeBatch(const TransformKeyframeBatch&) = delete;
+  TransformKeyframeBatch& operator=(const TransformKeyframeBatch&) = delete;
+  ~TransformKeyframeBatch();
+
+  // Adds the keyframes |from| and |to| and the timing function between them,
+  // and returns their index in the fractions and results of Evaluate().
+  size_t Add(scoped_refptr<const gfx::SharedTransformOperations> from,
+             scoped_refptr<const gfx::SharedTransformOperations> to,
+             scoped_refptr<const TimingFunction> timing_function);
+  size_t size() const { return keyframes_.size(); }
+
+  // Sets each results[i] to the i-th |to| blended from |from| with the
+  // progress of the i-th timing function at fractions[i], as
+  // gfx::TransformOperations::Blend() does. Both spans must have size()
+  // elements.
+  void Evaluate(base::span<const double> fractions,
+                base::span<gfx::TransformOperations> results);
+
+ private:
+  struct Keyframes {
+    Keyframes(scoped_refptr<const gfx::SharedTransformOperations> from,
+              scoped_refptr<const gfx::SharedTransformOperations> to);
+    Keyframes(Keyframes&& other);
+    Keyframes& operator=(Keyframes&& other);
+    ~Keyframes();
+
+    scoped_refptr<const gfx::SharedTransformOperations> from;
+    scoped_refptr<const gfx::SharedTransformOperations> to;
+  };
+
+  TimingFunctionBatch timing_functions_;
+  std::vector<Keyframes> keyframes_;
+  // Scratch space for Evaluate().
+  std::vector<double> progress_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_ANIMATION_TRANSFORM_KEYFRAME_BATCH_H_
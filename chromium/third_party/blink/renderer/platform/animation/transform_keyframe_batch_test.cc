@@ -0,0 +1,72 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/animation/transform_keyframe_batch.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/testing/task_environment.h"
+#include "ui/gfx/geometry/shared_transform_operations.h"
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace blink {
+
+namespace {
+
+scoped_refptr<const gfx::SharedTransformOperations> MakeKeyframe(size_t i) {
+  const float x = static_cast<float>(i);
+  gfx::TransformOperations operations;
+  operations.AppendTranslate(x, 2 * x, 0);
+  if (i % 3) {
+    operations.AppendRotate(0, 0, 1, x);
+  } else {
+    // Doesn't match the types of |to|, so it's blended by matrix.
+    operations.AppendScale(1 + x / 100, 2, 1);
+  }
+  return gfx::SharedTransformOperations::Create(operations);
+}
+
+void ExpectBlends(wtf_size_t size) {
+  using EaseType = CubicBezierTimingFunction::EaseType;
+  const scoped_refptr<TimingFunction> functions[] = {
+      LinearTimingFunction::Shared(),
+      CubicBezierTimingFunction::Preset(EaseType::EASE),
+      StepsTimingFunction::Create(4, StepsTimingFunction::StepPosition::END)};
+
+  TransformKeyframeBatch batch;
+  std::vector<double> fractions;
+  std::vector<gfx::TransformOperations> expected;
+  const scoped_refptr<const gfx::SharedTransformOperations> to =
+      MakeKeyframe(1);
+  for (wtf_size_t i = 0; i < size; ++i) {
+    const scoped_refptr<TimingFunction>& function = functions[i % 3];
+    scoped_refptr<const gfx::SharedTransformOperations> from =
+        MakeKeyframe(i);
+    fractions.push_back((i % 11) / 10.0);
+    expected.push_back(to->operations().Blend(
+        from->operations(), function->Evaluate(fractions.back())));
+    EXPECT_EQ(i, batch.Add(std::move(from), to, function));
+  }
+  ASSERT_EQ(size, batch.size());
+
+  std::vector<gfx::TransformOperations> results(size);
+  batch.Evaluate(fractions, results);
+  for (wtf_size_t i = 0; i < size; ++i) {
+    EXPECT_TRUE(results[i].ApproximatelyEqual(expected[i], 0)) << i;
+  }
+}
+
+}  // namespace
+
+TEST(TransformKeyframeBatchTest, Serial) {
+  ExpectBlends(TransformKeyframeBatch::kMinSizeForParallelBlending - 1);
+}
+
+TEST(TransformKeyframeBatchTest, Parallel) {
+  test::TaskEnvironment task_environment;
+  ExpectBlends(4 * TransformKeyframeBatch::kMinSizeForParallelBlending + 5);
+}
+
+}  // namespace blink
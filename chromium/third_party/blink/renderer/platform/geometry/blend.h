@@ -5,6 +5,8 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_BLEND_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_BLEND_H_
 
+#include "base/check_op.h"
+#include "base/containers/span.h"
 #include "third_party/blink/renderer/platform/geometry/layout_unit.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
@@ -46,6 +48,22 @@ inline gfx::PointF Blend(const gfx::PointF& from,
                      Blend(from.y(), to.y(), progress));
 }
 
+// Blends each of |from| with the value at the same index of |to| into |out|,
+// e.g. the channels of a keyframe, which must all have the same size. The
+// results are the same as those of Blend() of each value. The loop has no
+// dependency between the values, which lets the compiler vectorize it.
+template <typename T>
+void BlendMany(base::span<const T> from,
+               base::span<const T> to,
+               double progress,
+               base::span<T> out) {
+  CHECK_EQ(from.size(), to.size());
+  CHECK_EQ(from.size(), out.size());
+  for (size_t i = 0; i < out.size(); ++i) {
+    out[i] = Blend(from[i], to[i], progress);
+  }
+}
+
 }  // namespace blink
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_BLEND_H_
@@ -0,0 +1,46 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/blend.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+namespace {
+
+template <typename T>
+void ExpectBlendMany(const Vector<T>& from, const Vector<T>& to) {
+  for (double progress : {0.0, 0.25, 0.5, 1.0, -0.5, 1.5}) {
+    Vector<T> out(from.size());
+    BlendMany<T>(from, to, progress, out);
+    for (wtf_size_t i = 0; i < from.size(); ++i) {
+      EXPECT_EQ(Blend(from[i], to[i], progress), out[i])
+          << i << " at " << progress;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(BlendTest, BlendMany) {
+  ExpectBlendMany<int>({0, -3, 100, 7, 1}, {10, 4, -100, 7, 2});
+  ExpectBlendMany<float>({0, -3.5f, 1e6f, 0.1f, 1}, {1, 2.25f, -1e6f, 0.3f, 1});
+  ExpectBlendMany<double>({0, -3.5, 1e12, 0.1}, {1, 2.25, -1e12, 0.3});
+  ExpectBlendMany<LayoutUnit>(
+      {LayoutUnit(), LayoutUnit(1.5), LayoutUnit::Max(), LayoutUnit::Min()},
+      {LayoutUnit(10), LayoutUnit(-2.25), LayoutUnit::Min(),
+       LayoutUnit::Max()});
+  ExpectBlendMany<gfx::PointF>({gfx::PointF(0, 1), gfx::PointF(-2, 3.5)},
+                               {gfx::PointF(4, -1), gfx::PointF(2, 3.5)});
+}
+
+TEST(BlendTest, BlendManyEmpty) {
+  Vector<double> out;
+  BlendMany<double>({}, {}, 0.5, out);
+  EXPECT_TRUE(out.empty());
+}
+
+}  // namespace blink
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <cfloat>
 #include <numeric>
+#include <optional>
 
 #include "base/notreached.h"
 #include "third_party/blink/renderer/platform/geometry/length.h"
@@ -34,7 +35,8 @@ bool CalculationExpressionNumberNode::Equals(
 
 const CalculationExpressionNode* CalculationExpressionNumberNode::Zoom(
     double) const {
-  return MakeGarbageCollected<CalculationExpressionNumberNode>(value_);
+  // Numbers aren't lengths, and nodes are immutable.
+  return this;
 }
 
 // ------ CalculationExpressionSizingKeywordNode ------
@@ -50,6 +52,12 @@ CalculationExpressionSizingKeywordNode::CalculationExpressionSizingKeywordNode(
       has_stretch_ = true;
     } else {
       has_content_or_intrinsic_ = true;
+      has_min_content_ = keyword == Keyword::kMinContent ||
+                         keyword == Keyword::kWebkitMinContent;
+      has_max_content_ = keyword == Keyword::kMaxContent ||
+                         keyword == Keyword::kWebkitMaxContent;
+      has_fit_content_ = keyword == Keyword::kFitContent ||
+                         keyword == Keyword::kWebkitFitContent;
     }
   }
 }
@@ -160,6 +168,9 @@ bool CalculationExpressionPixelsAndPercentNode::Equals(
 
 const CalculationExpressionNode*
 CalculationExpressionPixelsAndPercentNode::Zoom(double factor) const {
+  if (factor == 1 || !value_.pixels) {
+    return this;
+  }
   PixelsAndPercent result(value_.pixels * factor, value_.percent,
                           value_.has_explicit_pixels,
                           value_.has_explicit_percent);
@@ -176,6 +187,93 @@ bool ShouldConvertRad2DegForOperator(CalculationOperator op) {
          op == CalculationOperator::kTan;
 }
 
+bool IsAddOrSubtract(CalculationOperator op) {
+  return op == CalculationOperator::kAdd ||
+         op == CalculationOperator::kSubtract;
+}
+
+// For |lhs| |op| |rhs|, where |op| is kAdd or kSubtract, one of the operands
+// is a pixels and percent value, and the other is a sum or difference with
+// one, returns the sum or difference of the two values and the remaining
+// operand. E.g. (min(10px, 20%) + 5px) - 10% becomes (5px - 10%) +
+// min(10px, 20%). Returns nullptr otherwise.
+const CalculationExpressionNode* MergePixelsAndPercentTerms(
+    const CalculationExpressionNode& lhs,
+    const CalculationExpressionNode& rhs,
+    CalculationOperator op) {
+  const bool lhs_is_value = lhs.IsPixelsAndPercent();
+  const auto* value = DynamicTo<CalculationExpressionPixelsAndPercentNode>(
+      lhs_is_value ? lhs : rhs);
+  const auto* operation =
+      DynamicTo<CalculationExpressionOperationNode>(lhs_is_value ? rhs : lhs);
+  if (!value || !operation || !IsAddOrSubtract(operation->GetOperator())) {
+    return nullptr;
+  }
+  const auto& children = operation->GetChildren();
+  DCHECK_EQ(children.size(), 2u);
+  const wtf_size_t inner_index = children[0]->IsPixelsAndPercent() ? 0 : 1;
+  const auto* inner_value =
+      DynamicTo<CalculationExpressionPixelsAndPercentNode>(
+          *children[inner_index]);
+  if (!inner_value) {
+    return nullptr;
+  }
+
+  // Whether each operand is subtracted in the whole expression.
+  const bool subtract = op == CalculationOperator::kSubtract;
+  const bool negate_value = subtract && !lhs_is_value;
+  const bool negate_operation = subtract && lhs_is_value;
+  const bool inner_subtract =
+      operation->GetOperator() == CalculationOperator::kSubtract;
+  const bool negate_inner_value =
+      negate_operation != (inner_subtract && inner_index == 1);
+  const bool negate_other =
+      negate_operation != (inner_subtract && inner_index == 0);
+
+  PixelsAndPercent merged(0, 0, /*has_explicit_pixels=*/false,
+                          /*has_explicit_percent=*/false);
+  if (negate_value) {
+    merged -= value->GetPixelsAndPercent();
+  } else {
+    merged += value->GetPixelsAndPercent();
+  }
+  if (negate_inner_value) {
+    merged -= inner_value->GetPixelsAndPercent();
+  } else {
+    merged += inner_value->GetPixelsAndPercent();
+  }
+  return CalculationExpressionOperationNode::CreateSimplified(
+      CalculationExpressionOperationNode::Children(
+          {MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+               merged),
+           children[1 - inner_index]}),
+      negate_other ? CalculationOperator::kSubtract
+                   : CalculationOperator::kAdd);
+}
+
+// If |children| are all pixels and percent values with the same percent,
+// returns that percent, sets |pixels| to their pixels, and sets
+// |has_explicit_pixels| if any of them has explicit pixels.
+std::optional<float> GetCommonPercent(
+    const CalculationExpressionOperationNode::Children& children,
+    Vector<float, 3>& pixels,
+    bool& has_explicit_pixels) {
+  std::optional<float> percent;
+  has_explicit_pixels = false;
+  for (const auto& child : children) {
+    const auto* pixels_and_percent =
+        DynamicTo<CalculationExpressionPixelsAndPercentNode>(*child);
+    if (!pixels_and_percent ||
+        (percent && pixels_and_percent->Percent() != *percent)) {
+      return std::nullopt;
+    }
+    percent = pixels_and_percent->Percent();
+    pixels.push_back(pixels_and_percent->Pixels());
+    has_explicit_pixels |= pixels_and_percent->HasExplicitPixels();
+  }
+  return percent;
+}
+
 }  // namespace
 
 // static
@@ -186,8 +284,24 @@ CalculationExpressionOperationNode::CreateSimplified(Children&& children,
     case CalculationOperator::kAdd:
     case CalculationOperator::kSubtract: {
       DCHECK_EQ(children.size(), 2u);
+      const auto* left_number =
+          DynamicTo<CalculationExpressionNumberNode>(*children[0]);
+      const auto* right_number =
+          DynamicTo<CalculationExpressionNumberNode>(*children[1]);
+      if (left_number && right_number) {
+        return MakeGarbageCollected<CalculationExpressionNumberNode>(
+            op == CalculationOperator::kAdd
+                ? left_number->Value() + right_number->Value()
+                : left_number->Value() - right_number->Value());
+      }
       if (!children[0]->IsPixelsAndPercent() ||
           !children[1]->IsPixelsAndPercent()) {
+        // Terms that aren't next to each other are merged too, although that
+        // changes the order of the additions.
+        if (const CalculationExpressionNode* merged =
+                MergePixelsAndPercentTerms(*children[0], *children[1], op)) {
+          return merged;
+        }
         return MakeGarbageCollected<CalculationExpressionOperationNode>(
             Children({std::move(children[0]), std::move(children[1])}), op);
       }
@@ -209,6 +323,11 @@ CalculationExpressionOperationNode::CreateSimplified(Children&& children,
       DCHECK_EQ(children.size(), 2u);
       const CalculationExpressionNode& lhs = *children[0];
       const CalculationExpressionNode& rhs = *children[1];
+      if (lhs.IsNumber() && rhs.IsNumber()) {
+        return MakeGarbageCollected<CalculationExpressionNumberNode>(
+            To<CalculationExpressionNumberNode>(lhs).Value() *
+            To<CalculationExpressionNumberNode>(rhs).Value());
+      }
       const bool lhs_is_number = lhs.IsNumber();
       const auto* number_node =
           DynamicTo<CalculationExpressionNumberNode>(lhs_is_number ? lhs : rhs);
@@ -236,63 +355,40 @@ CalculationExpressionOperationNode::CreateSimplified(Children&& children,
           Children({std::move(children[0])}), op);
     }
     case CalculationOperator::kMin:
-    case CalculationOperator::kMax: {
-      DCHECK(children.size());
-      float simplified_px;
-      bool can_simplify = true;
-      for (wtf_size_t i = 0; i < children.size(); ++i) {
-        const auto* pixels_and_percent =
-            DynamicTo<CalculationExpressionPixelsAndPercentNode>(*children[i]);
-        if (!pixels_and_percent || pixels_and_percent->Percent()) {
-          can_simplify = false;
-          break;
-        }
-        if (!i) {
-          simplified_px = pixels_and_percent->Pixels();
-        } else {
-          if (op == CalculationOperator::kMin) {
-            simplified_px =
-                std::min(simplified_px, pixels_and_percent->Pixels());
-          } else {
-            simplified_px =
-                std::max(simplified_px, pixels_and_percent->Pixels());
-          }
-        }
-      }
-      if (can_simplify) {
-        return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
-            PixelsAndPercent(simplified_px));
-      }
-      return MakeGarbageCollected<CalculationExpressionOperationNode>(
-          std::move(children), op);
-    }
+    case CalculationOperator::kMax:
     case CalculationOperator::kClamp: {
-      DCHECK_EQ(children.size(), 3u);
-      Vector<float> operand_pixels;
-      operand_pixels.reserve(children.size());
-      bool can_simplify = true;
-      for (auto& child : children) {
-        const auto* pixels_and_percent =
-            DynamicTo<CalculationExpressionPixelsAndPercentNode>(*child);
-        if (!pixels_and_percent || pixels_and_percent->Percent()) {
-          can_simplify = false;
-          break;
-        }
-        operand_pixels.push_back(pixels_and_percent->Pixels());
+      DCHECK(children.size());
+      DCHECK(op != CalculationOperator::kClamp || children.size() == 3u);
+      // These commute with adding the same percent to each operand.
+      Vector<float, 3> operand_pixels;
+      bool has_explicit_pixels;
+      std::optional<float> percent =
+          GetCommonPercent(children, operand_pixels, has_explicit_pixels);
+      if (!percent) {
+        return MakeGarbageCollected<CalculationExpressionOperationNode>(
+            std::move(children), op);
       }
-      if (can_simplify) {
+      float simplified_px;
+      if (op == CalculationOperator::kMin) {
+        simplified_px = std::ranges::min(operand_pixels);
+      } else if (op == CalculationOperator::kMax) {
+        simplified_px = std::ranges::max(operand_pixels);
+      } else {
         float min_px = operand_pixels[0];
         float val_px = operand_pixels[1];
         float max_px = operand_pixels[2];
         // clamp(MIN, VAL, MAX) is identical to max(MIN, min(VAL, MAX))
         // according to the spec,
         // https://drafts.csswg.org/css-values-4/#funcdef-clamp.
-        float clamped_px = std::max(min_px, std::min(val_px, max_px));
+        simplified_px = std::max(min_px, std::min(val_px, max_px));
+      }
+      if (!*percent) {
         return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
-            PixelsAndPercent(clamped_px));
+            PixelsAndPercent(simplified_px));
       }
-      return MakeGarbageCollected<CalculationExpressionOperationNode>(
-          std::move(children), op);
+      return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+          PixelsAndPercent(simplified_px, *percent, has_explicit_pixels,
+                           /*has_explicit_percent=*/true));
     }
     case CalculationOperator::kRoundNearest:
     case CalculationOperator::kRoundUp:
@@ -485,6 +581,7 @@ CalculationExpressionOperationNode::CalculationExpressionOperationNode(
     Children&& children,
     CalculationOperator op)
     : children_(std::move(children)), operator_(op) {
+  GeometryAllocationStats::CountCalculationOperation(op);
   if (op == CalculationOperator::kCalcSize) {
     // "A calc-size() is treated, in all respects, as if it were its
     // calc-size basis."  This is particularly relevant for ignoring the
@@ -495,6 +592,9 @@ CalculationExpressionOperationNode::CalculationExpressionOperationNode(
     has_auto_ = basis->HasAuto();
     has_percent_ = basis->HasPercent();
     has_stretch_ = basis->HasStretch();
+    has_min_content_ = basis->HasMinContent();
+    has_max_content_ = basis->HasMaxContent();
+    has_fit_content_ = basis->HasFitContent();
 #if DCHECK_IS_ON()
     {
       const auto& calculation = children_[1];
@@ -695,93 +795,19 @@ bool CalculationExpressionOperationNode::Equals(
 
 const CalculationExpressionNode* CalculationExpressionOperationNode::Zoom(
     double factor) const {
-  switch (operator_) {
-    case CalculationOperator::kAdd:
-    case CalculationOperator::kSubtract:
-      DCHECK_EQ(children_.size(), 2u);
-      return CreateSimplified(
-          Children({children_[0]->Zoom(factor), children_[1]->Zoom(factor)}),
-          operator_);
-    case CalculationOperator::kMultiply: {
-      DCHECK_EQ(children_.size(), 2u);
-      auto& number = children_[0]->IsNumber() ? children_[0] : children_[1];
-      auto& pixels_and_percent =
-          children_[0]->IsNumber() ? children_[1] : children_[0];
-      return CreateSimplified(
-          Children({pixels_and_percent->Zoom(factor), number}), operator_);
-    }
-    case CalculationOperator::kInvert: {
-      DCHECK_EQ(children_.size(), 1u);
-      return CreateSimplified(Children({children_[0]->Zoom(factor)}),
-                              operator_);
-    }
-    case CalculationOperator::kCalcSize: {
-      DCHECK_EQ(children_.size(), 2u);
-      return CreateSimplified(
-          Children({children_[0], children_[1]->Zoom(factor)}), operator_);
-    }
-    case CalculationOperator::kMin:
-    case CalculationOperator::kMax:
-    case CalculationOperator::kClamp:
-    case CalculationOperator::kRoundNearest:
-    case CalculationOperator::kRoundUp:
-    case CalculationOperator::kRoundDown:
-    case CalculationOperator::kRoundToZero:
-    case CalculationOperator::kMod:
-    case CalculationOperator::kRem:
-    case CalculationOperator::kHypot:
-    case CalculationOperator::kAbs:
-    case CalculationOperator::kLog:
-    case CalculationOperator::kExp:
-    case CalculationOperator::kSqrt:
-    case CalculationOperator::kSign:
-    case CalculationOperator::kProgress:
-    case CalculationOperator::kMediaProgress:
-    case CalculationOperator::kContainerProgress:
-    case CalculationOperator::kSin:
-    case CalculationOperator::kCos:
-    case CalculationOperator::kTan:
-    case CalculationOperator::kAsin:
-    case CalculationOperator::kAcos:
-    case CalculationOperator::kAtan:
-    case CalculationOperator::kAtan2:
-    case CalculationOperator::kPow:
-    case CalculationOperator::kRandom: {
-      DCHECK(children_.size());
-      HeapVector<Member<const CalculationExpressionNode>> cloned_operands;
-      cloned_operands.reserve(children_.size());
-      for (const auto& child : children_)
-        cloned_operands.push_back(child->Zoom(factor));
-      return CreateSimplified(std::move(cloned_operands), operator_);
+  DCHECK(children_.size());
+  Children zoomed_children;
+  zoomed_children.reserve(children_.size());
+  for (wtf_size_t i = 0; i < children_.size(); ++i) {
+    // The basis of a calc-size() isn't zoomed. The other children that are
+    // unchanged by the zoom, like numbers, are shared with this node.
+    if (operator_ == CalculationOperator::kCalcSize && i == 0) {
+      zoomed_children.push_back(children_[i]);
+    } else {
+      zoomed_children.push_back(children_[i]->Zoom(factor));
     }
   }
-}
-
-bool CalculationExpressionOperationNode::HasMinContent() const {
-  if (operator_ != CalculationOperator::kCalcSize) {
-    return false;
-  }
-  CHECK_EQ(children_.size(), 2u);
-  const auto& basis = children_[0];
-  return basis->HasMinContent();
-}
-
-bool CalculationExpressionOperationNode::HasMaxContent() const {
-  if (operator_ != CalculationOperator::kCalcSize) {
-    return false;
-  }
-  CHECK_EQ(children_.size(), 2u);
-  const auto& basis = children_[0];
-  return basis->HasMaxContent();
-}
-
-bool CalculationExpressionOperationNode::HasFitContent() const {
-  if (operator_ != CalculationOperator::kCalcSize) {
-    return false;
-  }
-  CHECK_EQ(children_.size(), 2u);
-  const auto& basis = children_[0];
-  return basis->HasFitContent();
+  return CreateSimplified(std::move(zoomed_children), operator_);
 }
 
 }  // namespace blink
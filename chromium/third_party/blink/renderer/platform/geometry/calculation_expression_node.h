@@ -7,6 +7,7 @@
 
 #include "base/check_op.h"
 #include "third_party/blink/renderer/platform/geometry/color_channel_keyword.h"
+#include "third_party/blink/renderer/platform/geometry/geometry_allocation_stats.h"
 #include "third_party/blink/renderer/platform/geometry/length.h"
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_vector.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
@@ -78,9 +79,10 @@ class PLATFORM_EXPORT CalculationExpressionNode
   bool HasPercentOrStretch() const { return has_percent_ || has_stretch_; }
   bool HasColorChannelKeyword() const { return has_color_channel_keyword_; }
 
-  virtual bool HasMinContent() const { return false; }
-  virtual bool HasMaxContent() const { return false; }
-  virtual bool HasFitContent() const { return false; }
+  // Like the above, these are computed once, when the node is created.
+  bool HasMinContent() const { return has_min_content_; }
+  bool HasMaxContent() const { return has_max_content_; }
+  bool HasFitContent() const { return has_fit_content_; }
 
   virtual bool IsNumber() const { return false; }
   virtual bool IsIdentifier() const { return false; }
@@ -101,12 +103,17 @@ class PLATFORM_EXPORT CalculationExpressionNode
   bool has_percent_ = false;
   bool has_stretch_ = false;
   bool has_color_channel_keyword_ = false;
+  bool has_min_content_ = false;
+  bool has_max_content_ = false;
+  bool has_fit_content_ = false;
 };
 
 class PLATFORM_EXPORT CalculationExpressionNumberNode final
     : public CalculationExpressionNode {
  public:
-  explicit CalculationExpressionNumberNode(float value) : value_(value) {}
+  explicit CalculationExpressionNumberNode(float value) : value_(value) {
+    GeometryAllocationStats::CountCalculationNumber();
+  }
 
   float Value() const { return value_; }
 
@@ -200,19 +207,6 @@ class PLATFORM_EXPORT CalculationExpressionSizingKeywordNode final
   }
   bool IsSizingKeyword() const final { return true; }
 
-  bool HasMinContent() const final {
-    return keyword_ == Keyword::kMinContent ||
-           keyword_ == Keyword::kWebkitMinContent;
-  }
-  bool HasMaxContent() const final {
-    return keyword_ == Keyword::kMaxContent ||
-           keyword_ == Keyword::kWebkitMaxContent;
-  }
-  bool HasFitContent() const final {
-    return keyword_ == Keyword::kFitContent ||
-           keyword_ == Keyword::kWebkitFitContent;
-  }
-
  private:
   Keyword keyword_;
 };
@@ -261,6 +255,7 @@ class PLATFORM_EXPORT CalculationExpressionPixelsAndPercentNode final
  public:
   explicit CalculationExpressionPixelsAndPercentNode(PixelsAndPercent value)
       : value_(value) {
+    GeometryAllocationStats::CountCalculationPixelsAndPercent();
     if (value.has_explicit_percent) {
       has_percent_ = true;
     }
@@ -315,9 +310,6 @@ class PLATFORM_EXPORT CalculationExpressionOperationNode final
   bool Equals(const CalculationExpressionNode& other) const final;
   const CalculationExpressionNode* Zoom(double factor) const final;
   bool IsOperation() const final { return true; }
-  bool HasMinContent() const final;
-  bool HasMaxContent() const final;
-  bool HasFitContent() const final;
   ~CalculationExpressionOperationNode() final = default;
 
  private:
@@ -196,6 +196,160 @@ TEST(CalculationExpressionOperationNodeTest, NonExplicitPixelsAndPercent) {
   EXPECT_FALSE(pixels_and_percent_node->HasExplicitPercent());
 }
 
+TEST(CalculationExpressionOperationNodeTest, MergePixelsAndPercentTerms) {
+  const auto* percent =
+      MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+          PixelsAndPercent(0.0f, 20.0f, /*has_explicit_pixels=*/false,
+                           /*has_explicit_percent=*/true));
+  const CalculationExpressionNode* min =
+      CalculationExpressionOperationNode::CreateSimplified(
+          {MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+               PixelsAndPercent(10.0f)),
+           percent},
+          CalculationOperator::kMin);
+  ASSERT_TRUE(min->IsOperation());
+
+  // (min(10px, 20%) + 5px) - 20% is (5px - 20%) + min(10px, 20%).
+  const CalculationExpressionNode* sum =
+      CalculationExpressionOperationNode::CreateSimplified(
+          {min, MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+                    PixelsAndPercent(5.0f))},
+          CalculationOperator::kAdd);
+  const auto* difference = DynamicTo<CalculationExpressionOperationNode>(
+      CalculationExpressionOperationNode::CreateSimplified(
+          {sum, percent}, CalculationOperator::kSubtract));
+  ASSERT_TRUE(difference);
+  EXPECT_EQ(CalculationOperator::kAdd, difference->GetOperator());
+  const auto& children = difference->GetChildren();
+  ASSERT_TRUE(children[0]->IsPixelsAndPercent());
+  EXPECT_EQ(
+      5.0f,
+      To<CalculationExpressionPixelsAndPercentNode>(*children[0]).Pixels());
+  EXPECT_EQ(
+      -20.0f,
+      To<CalculationExpressionPixelsAndPercentNode>(*children[0]).Percent());
+  EXPECT_EQ(*min, *children[1]);
+  EXPECT_EQ(-5.0f, difference->Evaluate(100, {}));
+
+  // 5px - (min(10px, 20%) - 20%) is (5px + 20%) - min(10px, 20%).
+  const auto* nested = DynamicTo<CalculationExpressionOperationNode>(
+      CalculationExpressionOperationNode::CreateSimplified(
+          {MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+               PixelsAndPercent(5.0f)),
+           MakeGarbageCollected<CalculationExpressionOperationNode>(
+               CalculationExpressionOperationNode::Children({min, percent}),
+               CalculationOperator::kSubtract)},
+          CalculationOperator::kSubtract));
+  ASSERT_TRUE(nested);
+  EXPECT_EQ(CalculationOperator::kSubtract, nested->GetOperator());
+  EXPECT_EQ(15.0f, nested->Evaluate(100, {}));
+}
+
+TEST(CalculationExpressionOperationNodeTest, FoldCommonPercent) {
+  auto pixels_and_percent = [](float pixels, float percent) {
+    return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+        PixelsAndPercent(pixels, percent, /*has_explicit_pixels=*/true,
+                         /*has_explicit_percent=*/true));
+  };
+  const auto* min = DynamicTo<CalculationExpressionPixelsAndPercentNode>(
+      CalculationExpressionOperationNode::CreateSimplified(
+          {pixels_and_percent(10, 50), pixels_and_percent(20, 50)},
+          CalculationOperator::kMin));
+  ASSERT_TRUE(min);
+  EXPECT_EQ(10.0f, min->Pixels());
+  EXPECT_EQ(50.0f, min->Percent());
+
+  const auto* clamp = DynamicTo<CalculationExpressionPixelsAndPercentNode>(
+      CalculationExpressionOperationNode::CreateSimplified(
+          {pixels_and_percent(10, 50), pixels_and_percent(30, 50),
+           pixels_and_percent(20, 50)},
+          CalculationOperator::kClamp));
+  ASSERT_TRUE(clamp);
+  EXPECT_EQ(20.0f, clamp->Pixels());
+  EXPECT_EQ(50.0f, clamp->Percent());
+
+  EXPECT_TRUE(CalculationExpressionOperationNode::CreateSimplified(
+                  {pixels_and_percent(10, 50), pixels_and_percent(20, 40)},
+                  CalculationOperator::kMax)
+                  ->IsOperation());
+
+  const auto* product = DynamicTo<CalculationExpressionNumberNode>(
+      CalculationExpressionOperationNode::CreateSimplified(
+          {MakeGarbageCollected<CalculationExpressionNumberNode>(3),
+           MakeGarbageCollected<CalculationExpressionNumberNode>(4)},
+          CalculationOperator::kMultiply));
+  ASSERT_TRUE(product);
+  EXPECT_EQ(12.0f, product->Value());
+}
+
+TEST(CalculationExpressionOperationNodeTest, ZoomSharesUnchangedNodes) {
+  const auto* number =
+      MakeGarbageCollected<CalculationExpressionNumberNode>(2.f);
+  EXPECT_EQ(number->Zoom(3), number);
+
+  const auto* percent =
+      MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+          PixelsAndPercent(0, 50, /*has_explicit_pixels=*/false,
+                           /*has_explicit_percent=*/true));
+  EXPECT_EQ(percent->Zoom(3), percent);
+  const auto* pixels =
+      MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+          PixelsAndPercent(10));
+  EXPECT_EQ(pixels->Zoom(1), pixels);
+  EXPECT_NE(pixels->Zoom(3), pixels);
+
+  // max(10px, 50%) * 2
+  const auto* operation = MakeGarbageCollected<
+      CalculationExpressionOperationNode>(
+      CalculationExpressionOperationNode::Children(
+          {MakeGarbageCollected<CalculationExpressionOperationNode>(
+               CalculationExpressionOperationNode::Children({pixels, percent}),
+               CalculationOperator::kMax),
+           number}),
+      CalculationOperator::kMultiply);
+  const auto* zoomed =
+      To<CalculationExpressionOperationNode>(operation->Zoom(3));
+  EXPECT_EQ(zoomed->GetChildren()[1], number);
+  const auto* zoomed_max =
+      To<CalculationExpressionOperationNode>(zoomed->GetChildren()[0].Get());
+  EXPECT_EQ(zoomed_max->GetChildren()[1], percent);
+  EXPECT_EQ(operation->Evaluate(10, {}), 20);
+  EXPECT_EQ(zoomed->Evaluate(10, {}), 60);
+}
+
+TEST(CalculationExpressionOperationNodeTest, CalcSizeBasisKeywords) {
+  using Keyword = CalculationExpressionSizingKeywordNode::Keyword;
+  auto calc_size = [](const CalculationExpressionNode* basis) {
+    const CalculationExpressionNode* size =
+        MakeGarbageCollected<CalculationExpressionSizingKeywordNode>(
+            Keyword::kSize);
+    return MakeGarbageCollected<CalculationExpressionOperationNode>(
+        CalculationExpressionOperationNode::Children({basis, size}),
+        CalculationOperator::kCalcSize);
+  };
+  // calc-size(calc-size(min-content, size), size)
+  const CalculationExpressionNode* min_content = calc_size(
+      calc_size(MakeGarbageCollected<CalculationExpressionSizingKeywordNode>(
+          Keyword::kWebkitMinContent)));
+  EXPECT_TRUE(min_content->HasContentOrIntrinsicSize());
+  EXPECT_TRUE(min_content->HasMinContent());
+  EXPECT_FALSE(min_content->HasMaxContent());
+  EXPECT_FALSE(min_content->HasFitContent());
+
+  const CalculationExpressionNode* fit_content =
+      calc_size(MakeGarbageCollected<CalculationExpressionSizingKeywordNode>(
+          Keyword::kFitContent));
+  EXPECT_FALSE(fit_content->HasMinContent());
+  EXPECT_TRUE(fit_content->HasFitContent());
+
+  // A stretch basis isn't content or intrinsic.
+  const CalculationExpressionNode* stretch =
+      calc_size(MakeGarbageCollected<CalculationExpressionSizingKeywordNode>(
+          Keyword::kStretch));
+  EXPECT_FALSE(stretch->HasContentOrIntrinsicSize());
+  EXPECT_FALSE(stretch->HasMaxContent());
+}
+
 TEST(CalculationExpressionOperationNodeTest, ProgressNotation) {
   EXPECT_EQ(BuildOperationNode({3.f, 0.f, 1.f}, CalculationOperator::kProgress)
                 ->Evaluate(FLT_MAX, {}),
@@ -0,0 +1,279 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/calculation_program.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+#include "base/check_op.h"
+#include "base/containers/span.h"
+#include "base/notreached.h"
+#include "third_party/blink/renderer/platform/geometry/math_functions.h"
+#include "third_party/blink/renderer/platform/wtf/math_extras.h"
+
+namespace blink {
+
+namespace {
+
+// The same as CalculationExpressionOperationNode::Evaluate() with the values
+// of the children in |operands|.
+float EvaluateOperation(CalculationOperator op,
+                        bool convert_rad2deg,
+                        base::span<const float> operands) {
+  switch (op) {
+    case CalculationOperator::kAdd:
+      return operands[0] + operands[1];
+    case CalculationOperator::kSubtract:
+      return operands[0] - operands[1];
+    case CalculationOperator::kMultiply:
+      return operands[0] * operands[1];
+    case CalculationOperator::kInvert:
+      return 1.0 / operands[0];
+    case CalculationOperator::kMin: {
+      float minimum = operands[0];
+      for (float operand : operands) {
+        minimum = std::min(minimum, operand);
+      }
+      return minimum;
+    }
+    case CalculationOperator::kMax: {
+      float maximum = operands[0];
+      for (float operand : operands) {
+        maximum = std::max(maximum, operand);
+      }
+      return maximum;
+    }
+    case CalculationOperator::kClamp:
+      // clamp(MIN, VAL, MAX) is identical to max(MIN, min(VAL, MAX))
+      return std::max(operands[0], std::min(operands[1], operands[2]));
+    case CalculationOperator::kRoundNearest:
+    case CalculationOperator::kRoundUp:
+    case CalculationOperator::kRoundDown:
+    case CalculationOperator::kRoundToZero:
+    case CalculationOperator::kMod:
+    case CalculationOperator::kRem:
+      return EvaluateSteppedValueFunction(op, operands[0], operands[1]);
+    case CalculationOperator::kLog:
+      return operands.size() == 1u
+                 ? std::log(operands[0])
+                 : std::log2(operands[0]) / std::log2(operands[1]);
+    case CalculationOperator::kHypot: {
+      float value = 0;
+      for (float operand : operands) {
+        value = std::hypot(value, operand);
+      }
+      return value;
+    }
+    case CalculationOperator::kAbs:
+      return std::abs(operands[0]);
+    case CalculationOperator::kExp:
+      return std::exp(operands[0]);
+    case CalculationOperator::kSqrt:
+      return std::sqrt(operands[0]);
+    case CalculationOperator::kSign:
+      return EvaluateSignFunction(operands[0]);
+    case CalculationOperator::kProgress:
+    case CalculationOperator::kMediaProgress:
+    case CalculationOperator::kContainerProgress: {
+      float progress_value =
+          (operands[0] - operands[1]) / (operands[2] - operands[1]);
+      return std::clamp(progress_value, 0.f, 1.f);
+    }
+    case CalculationOperator::kPow:
+      return std::pow(operands[0], operands[1]);
+    case CalculationOperator::kSin:
+    case CalculationOperator::kCos:
+    case CalculationOperator::kTan:
+    case CalculationOperator::kAsin:
+    case CalculationOperator::kAcos:
+    case CalculationOperator::kAtan:
+    case CalculationOperator::kAtan2: {
+      float a = convert_rad2deg ? Rad2deg(operands[0]) : operands[0];
+      std::optional<float> b = op == CalculationOperator::kAtan2
+                                   ? std::optional<float>(operands[1])
+                                   : std::nullopt;
+      return EvaluateTrigonometricFunction(op, a, b);
+    }
+    case CalculationOperator::kCalcSize:
+    case CalculationOperator::kRandom:
+      // These depend on the EvaluationInput, and aren't lowered.
+      break;
+  }
+  NOTREACHED();
+}
+
+// The number of max values evaluated together by EvaluateMany().
+constexpr wtf_size_t kLanes = 4;
+
+}  // namespace
+
+// static
+CalculationProgram CalculationProgram::Create(
+    const CalculationExpressionNode& expression) {
+  CalculationProgram program;
+  wtf_size_t stack_size = 0;
+  if (!program.Lower(expression, stack_size)) {
+    return CalculationProgram();
+  }
+  DCHECK_EQ(stack_size, 1u);
+  program.instructions_.shrink_to_fit();
+  return program;
+}
+
+bool CalculationProgram::Lower(const CalculationExpressionNode& node,
+                               wtf_size_t& stack_size) {
+  if (const auto* number = DynamicTo<CalculationExpressionNumberNode>(node)) {
+    instructions_.push_back(
+        Instruction{.opcode = Instruction::Opcode::kNumber,
+                    .pixels = number->Value()});
+  } else if (const auto* pixels_and_percent =
+                 DynamicTo<CalculationExpressionPixelsAndPercentNode>(node)) {
+    instructions_.push_back(
+        Instruction{.opcode = Instruction::Opcode::kPixelsAndPercent,
+                    .pixels = pixels_and_percent->Pixels(),
+                    .percent = pixels_and_percent->Percent()});
+  } else if (const auto* operation =
+                 DynamicTo<CalculationExpressionOperationNode>(node)) {
+    const CalculationOperator op = operation->GetOperator();
+    if (op == CalculationOperator::kCalcSize ||
+        op == CalculationOperator::kRandom) {
+      return false;
+    }
+    const auto& children = operation->GetChildren();
+    for (const auto& child : children) {
+      if (!Lower(*child, stack_size)) {
+        return false;
+      }
+    }
+    instructions_.push_back(Instruction{
+        .opcode = Instruction::Opcode::kOperation,
+        .op = op,
+        .convert_rad2deg = (op == CalculationOperator::kSin ||
+                            op == CalculationOperator::kCos ||
+                            op == CalculationOperator::kTan) &&
+                           children.front()->IsNumber(),
+        .operand_count = children.size()});
+    stack_size -= children.size();
+  } else {
+    // Keywords and identifiers.
+    return false;
+  }
+  ++stack_size;
+  max_stack_size_ = std::max(max_stack_size_, stack_size);
+  return true;
+}
+
+float CalculationProgram::Evaluate(float max_value) const {
+  DCHECK(!IsEmpty());
+  Vector<float, 16> stack(max_stack_size_);
+  wtf_size_t stack_size = 0;
+  for (const Instruction& instruction : instructions_) {
+    switch (instruction.opcode) {
+      case Instruction::Opcode::kNumber:
+        stack[stack_size++] = instruction.pixels;
+        break;
+      case Instruction::Opcode::kPixelsAndPercent:
+        stack[stack_size++] =
+            instruction.pixels + instruction.percent / 100 * max_value;
+        break;
+      case Instruction::Opcode::kOperation: {
+        stack_size -= instruction.operand_count;
+        stack[stack_size] = EvaluateOperation(
+            instruction.op, instruction.convert_rad2deg,
+            base::span(stack).subspan(stack_size, instruction.operand_count));
+        ++stack_size;
+        break;
+      }
+    }
+  }
+  DCHECK_EQ(stack_size, 1u);
+  return stack[0];
+}
+
+void CalculationProgram::EvaluateMany(base::span<const float> max_values,
+                                      base::span<float> results) const {
+  DCHECK(!IsEmpty());
+  CHECK_EQ(max_values.size(), results.size());
+  // Each value on the stack has kLanes consecutive floats, one for each of
+  // the max values.
+  Vector<float, 16 * kLanes> stack(max_stack_size_ * kLanes);
+  auto lanes = [&stack](wtf_size_t index) {
+    return base::span(stack).subspan(index * kLanes, kLanes);
+  };
+  size_t begin = 0;
+  for (; begin + kLanes <= max_values.size(); begin += kLanes) {
+    base::span<const float> group_max_values =
+        max_values.subspan(begin, kLanes);
+    wtf_size_t stack_size = 0;
+    for (const Instruction& instruction : instructions_) {
+      switch (instruction.opcode) {
+        case Instruction::Opcode::kNumber:
+          std::ranges::fill(lanes(stack_size++), instruction.pixels);
+          break;
+        case Instruction::Opcode::kPixelsAndPercent: {
+          base::span<float> values = lanes(stack_size++);
+          for (wtf_size_t lane = 0; lane < kLanes; ++lane) {
+            values[lane] = instruction.pixels +
+                           instruction.percent / 100 * group_max_values[lane];
+          }
+          break;
+        }
+        case Instruction::Opcode::kOperation: {
+          stack_size -= instruction.operand_count;
+          // The most common operators are applied to all the lanes at once.
+          if (instruction.op == CalculationOperator::kAdd ||
+              instruction.op == CalculationOperator::kSubtract ||
+              instruction.op == CalculationOperator::kMultiply) {
+            base::span<float> lhs = lanes(stack_size);
+            base::span<const float> rhs = lanes(stack_size + 1);
+            for (wtf_size_t lane = 0; lane < kLanes; ++lane) {
+              if (instruction.op == CalculationOperator::kAdd) {
+                lhs[lane] += rhs[lane];
+              } else if (instruction.op == CalculationOperator::kSubtract) {
+                lhs[lane] -= rhs[lane];
+              } else {
+                lhs[lane] *= rhs[lane];
+              }
+            }
+            ++stack_size;
+            break;
+          }
+          Vector<float, 4> operands(instruction.operand_count);
+          // Overwriting the first operand is fine, since each lane only
+          // reads its own operands.
+          base::span<float> values = lanes(stack_size);
+          for (wtf_size_t lane = 0; lane < kLanes; ++lane) {
+            for (wtf_size_t i = 0; i < instruction.operand_count; ++i) {
+              operands[i] = lanes(stack_size + i)[lane];
+            }
+            values[lane] = EvaluateOperation(
+                instruction.op, instruction.convert_rad2deg, operands);
+          }
+          ++stack_size;
+          break;
+        }
+      }
+    }
+    DCHECK_EQ(stack_size, 1u);
+    results.subspan(begin, kLanes).copy_from(lanes(0));
+  }
+  for (size_t i = begin; i < max_values.size(); ++i) {
+    results[i] = Evaluate(max_values[i]);
+  }
+}
+
+CalculationProgram CalculationProgram::Zoom(double factor) const {
+  CalculationProgram program(*this);
+  for (Instruction& instruction : program.instructions_) {
+    // Only the pixels of lengths are zoomed, not numbers or percentages.
+    if (instruction.opcode == Instruction::Opcode::kPixelsAndPercent) {
+      instruction.pixels = instruction.pixels * factor;
+    }
+  }
+  return program;
+}
+
+}  // namespace blink
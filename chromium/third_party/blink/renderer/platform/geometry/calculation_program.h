@@ -0,0 +1,79 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_CALCULATION_PROGRAM_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_CALCULATION_PROGRAM_H_
+
+#include <stdint.h>
+
+#include "base/containers/span.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_expression_node.h"
+#include "third_party/blink/renderer/platform/platform_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+// A CalculationExpressionNode lowered to a flat program in postfix order,
+// which evaluates it with a loop over the instructions and a stack of values,
+// instead of recursive virtual calls over the tree. Only the expressions that
+// don't depend on the EvaluationInput can be lowered, i.e. those without
+// keywords, identifiers, calc-size() or random().
+class PLATFORM_EXPORT CalculationProgram {
+  DISALLOW_NEW();
+
+ public:
+  CalculationProgram() = default;
+
+  // Returns an empty program if |expression| can't be lowered.
+  static CalculationProgram Create(const CalculationExpressionNode& expression);
+
+  bool IsEmpty() const { return instructions_.empty(); }
+
+  // The same as Evaluate() of the expression the program was created from,
+  // which doesn't use the EvaluationInput. The program must not be empty.
+  float Evaluate(float max_value) const;
+  // Sets each of |results| to Evaluate() of the max value at the same index
+  // of |max_values|, which must have the same size. The instructions are run
+  // once for each few max values.
+  void EvaluateMany(base::span<const float> max_values,
+                    base::span<float> results) const;
+
+  // Returns the program of the expression zoomed by |factor|, as by
+  // CalculationExpressionNode::Zoom(), without rebuilding the expression.
+  CalculationProgram Zoom(double factor) const;
+
+ private:
+  struct Instruction {
+    enum class Opcode : uint8_t {
+      // Pushes |pixels|.
+      kNumber,
+      // Pushes |pixels| + |percent| of |max_value|.
+      kPixelsAndPercent,
+      // Replaces the last |operand_count| values with the result of |op|.
+      kOperation,
+    };
+
+    Opcode opcode;
+    CalculationOperator op = CalculationOperator::kAdd;
+    // Whether the operand of a trigonometric function is a number, in
+    // radians, rather than an angle, in degrees.
+    bool convert_rad2deg = false;
+    uint32_t operand_count = 0;
+    float pixels = 0;
+    float percent = 0;
+  };
+
+  // Appends the instructions for |node|, which leave one more value on the
+  // stack of |stack_size| values. Returns false if |node| can't be lowered.
+  bool Lower(const CalculationExpressionNode& node, wtf_size_t& stack_size);
+
+  Vector<Instruction> instructions_;
+  // The most values on the stack during Evaluate().
+  wtf_size_t max_stack_size_ = 0;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_CALCULATION_PROGRAM_H_
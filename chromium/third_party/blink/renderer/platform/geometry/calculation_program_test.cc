@@ -0,0 +1,106 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/calculation_program.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/geometry/evaluation_input.h"
+
+namespace blink {
+
+namespace {
+
+const CalculationExpressionNode* Number(float value) {
+  return MakeGarbageCollected<CalculationExpressionNumberNode>(value);
+}
+
+const CalculationExpressionNode* PixelsAndPercentNode(float pixels,
+                                                      float percent) {
+  return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+      PixelsAndPercent(pixels, percent, /*has_explicit_pixels=*/true,
+                       /*has_explicit_percent=*/true));
+}
+
+const CalculationExpressionNode* Operation(
+    CalculationExpressionOperationNode::Children&& children,
+    CalculationOperator op) {
+  return MakeGarbageCollected<CalculationExpressionOperationNode>(
+      std::move(children), op);
+}
+
+}  // namespace
+
+TEST(CalculationProgramTest, EvaluatesAsTree) {
+  // clamp(10px, 50% - 3px * 2, max(20px, 10% + 5px, 30%)) + hypot(3, 4)
+  const CalculationExpressionNode* clamp = Operation(
+      {PixelsAndPercentNode(10, 0),
+       Operation({PixelsAndPercentNode(0, 50),
+                  Operation({PixelsAndPercentNode(3, 0), Number(2)},
+                            CalculationOperator::kMultiply)},
+                 CalculationOperator::kSubtract),
+       Operation({PixelsAndPercentNode(20, 0), PixelsAndPercentNode(5, 10),
+                  PixelsAndPercentNode(0, 30)},
+                 CalculationOperator::kMax)},
+      CalculationOperator::kClamp);
+  const CalculationExpressionNode* expression = Operation(
+      {clamp, Operation({Number(3), Number(4)}, CalculationOperator::kHypot)},
+      CalculationOperator::kAdd);
+
+  CalculationProgram program = CalculationProgram::Create(*expression);
+  ASSERT_FALSE(program.IsEmpty());
+  for (float max_value : {0.f, 10.f, 50.f, 100.f, 400.f, -1.f}) {
+    EXPECT_EQ(expression->Evaluate(max_value, {}), program.Evaluate(max_value))
+        << max_value;
+  }
+}
+
+TEST(CalculationProgramTest, Functions) {
+  const CalculationExpressionNode* expressions[] = {
+      Operation({Number(1)}, CalculationOperator::kSin),
+      Operation({PixelsAndPercentNode(30, 0)}, CalculationOperator::kCos),
+      Operation({Number(1), Number(2)}, CalculationOperator::kAtan2),
+      Operation({PixelsAndPercentNode(17, 0), PixelsAndPercentNode(5, 0)},
+                CalculationOperator::kMod),
+      Operation({PixelsAndPercentNode(0, 50), PixelsAndPercentNode(0, 0),
+                 PixelsAndPercentNode(100, 0)},
+                CalculationOperator::kProgress),
+      Operation({Number(8), Number(2)}, CalculationOperator::kLog),
+      Operation({Number(-2)}, CalculationOperator::kSign),
+      Operation({Number(4)}, CalculationOperator::kInvert),
+  };
+  for (const CalculationExpressionNode* expression : expressions) {
+    CalculationProgram program = CalculationProgram::Create(*expression);
+    ASSERT_FALSE(program.IsEmpty());
+    EXPECT_EQ(expression->Evaluate(100, {}), program.Evaluate(100));
+  }
+}
+
+TEST(CalculationProgramTest, NotLowered) {
+  const CalculationExpressionNode* keyword =
+      MakeGarbageCollected<CalculationExpressionSizingKeywordNode>(
+          CalculationExpressionSizingKeywordNode::Keyword::kSize);
+  EXPECT_TRUE(
+      CalculationProgram::Create(
+          *Operation({PixelsAndPercentNode(0, 100),
+                      Operation({keyword, Number(2)},
+                                CalculationOperator::kMultiply)},
+                     CalculationOperator::kCalcSize))
+          .IsEmpty());
+  EXPECT_TRUE(
+      CalculationProgram::Create(
+          *Operation({Number(0.5), PixelsAndPercentNode(0, 0),
+                      PixelsAndPercentNode(10, 0)},
+                     CalculationOperator::kRandom))
+          .IsEmpty());
+  EXPECT_TRUE(
+      CalculationProgram::Create(
+          *Operation({Number(1),
+                      MakeGarbageCollected<
+                          CalculationExpressionColorChannelKeywordNode>(
+                          ColorChannelKeyword::kAlpha)},
+                     CalculationOperator::kAdd))
+          .IsEmpty());
+}
+
+}  // namespace blink
@@ -4,13 +4,94 @@
 
 #include "third_party/blink/renderer/platform/geometry/calculation_value.h"
 
+#include <algorithm>
+
+#include "base/check_op.h"
 #include "base/memory/values_equivalent.h"
 #include "third_party/blink/renderer/platform/geometry/blend.h"
 #include "third_party/blink/renderer/platform/geometry/calculation_expression_node.h"
+#include "third_party/blink/renderer/platform/wtf/hash_functions.h"
 #include "third_party/blink/renderer/platform/wtf/size_assertions.h"
+#include "ui/gfx/geometry/double4.h"
 
 namespace blink {
 
+namespace {
+
+// Whether |expression| may be simplified to other than an operation when it's
+// zoomed, e.g. if it was created without CreateSimplified(). Those have to be
+// rebuilt by the zoom, so that IsExpression() is the same as before.
+bool MaySimplifyWhenZoomed(const CalculationExpressionNode& expression) {
+  const auto* operation =
+      DynamicTo<CalculationExpressionOperationNode>(expression);
+  return operation &&
+         std::ranges::all_of(operation->GetChildren(), [](const auto& child) {
+           return child->IsNumber() || child->IsPixelsAndPercent();
+         });
+}
+
+void AddPixelsAndPercentToHash(unsigned& hash, const PixelsAndPercent& value) {
+  AddFloatToHash(hash, value.pixels);
+  AddFloatToHash(hash, value.percent);
+  AddIntToHash(hash, value.has_explicit_pixels);
+  AddIntToHash(hash, value.has_explicit_percent);
+}
+
+void AddExpressionToHash(unsigned& hash,
+                         const CalculationExpressionNode& expression) {
+  if (const auto* number =
+          DynamicTo<CalculationExpressionNumberNode>(expression)) {
+    AddFloatToHash(hash, number->Value());
+  } else if (const auto* pixels_and_percent =
+                 DynamicTo<CalculationExpressionPixelsAndPercentNode>(
+                     expression)) {
+    AddPixelsAndPercentToHash(hash, pixels_and_percent->GetPixelsAndPercent());
+  } else if (const auto* operation =
+                 DynamicTo<CalculationExpressionOperationNode>(expression)) {
+    AddIntToHash(hash, static_cast<unsigned>(operation->GetOperator()));
+    for (const auto& child : operation->GetChildren()) {
+      AddExpressionToHash(hash, *child);
+    }
+  } else if (const auto* sizing_keyword =
+                 DynamicTo<CalculationExpressionSizingKeywordNode>(
+                     expression)) {
+    AddIntToHash(hash, static_cast<unsigned>(sizing_keyword->Value()));
+  } else if (const auto* color_channel_keyword =
+                 DynamicTo<CalculationExpressionColorChannelKeywordNode>(
+                     expression)) {
+    AddIntToHash(hash, static_cast<unsigned>(color_channel_keyword->Value()));
+  } else if (const auto* identifier =
+                 DynamicTo<CalculationExpressionIdentifierNode>(expression)) {
+    AddIntToHash(hash, identifier->Value().Hash());
+  }
+}
+
+// Whether the equal expressions |a| and |b| have the same explicit pixels
+// and percentages, which Equals() doesn't compare.
+bool HaveSameExplicitTerms(const CalculationExpressionNode& a,
+                           const CalculationExpressionNode& b) {
+  if (const auto* pixels_and_percent =
+          DynamicTo<CalculationExpressionPixelsAndPercentNode>(a)) {
+    const auto& other = To<CalculationExpressionPixelsAndPercentNode>(b);
+    return pixels_and_percent->HasExplicitPixels() ==
+               other.HasExplicitPixels() &&
+           pixels_and_percent->HasExplicitPercent() ==
+               other.HasExplicitPercent();
+  }
+  if (const auto* operation =
+          DynamicTo<CalculationExpressionOperationNode>(a)) {
+    return std::ranges::equal(
+        operation->GetChildren(),
+        To<CalculationExpressionOperationNode>(b).GetChildren(),
+        [](const auto& a_child, const auto& b_child) {
+          return HaveSameExplicitTerms(*a_child, *b_child);
+        });
+  }
+  return true;
+}
+
+}  // namespace
+
 // static
 const CalculationValue* CalculationValue::CreateSimplified(
     const CalculationExpressionNode* expression,
@@ -30,33 +111,128 @@ CalculationValue::CalculationValue(PassKey,
     : expression_(expression),
       is_non_negative_(range == Length::ValueRange::kNonNegative) {
   CHECK(expression);
+  program_ = CalculationProgram::Create(*expression);
+  GeometryAllocationStats::CountCalculationValue();
+}
+
+CalculationValue::CalculationValue(PassKey,
+                                   const CalculationValue& value,
+                                   double factor)
+    : expression_(value.expression_),
+      zoom_(value.zoom_ * factor),
+      is_non_negative_(value.is_non_negative_) {
+  CHECK(expression_);
+  program_ = value.program_.Zoom(factor);
+  GeometryAllocationStats::CountCalculationValue();
 }
 
 CalculationValue::~CalculationValue() = default;
 
 void CalculationValue::Trace(Visitor* visitor) const {
   visitor->Trace(expression_);
+  visitor->Trace(zoomed_expression_);
 }
 
 float CalculationValue::Evaluate(float max_value,
                                  const EvaluationInput& input) const {
-  float value =
-      ClampTo<float>(expression_ ? expression_->Evaluate(max_value, input)
-                                 : Pixels() + Percent() / 100 * max_value);
-  return (IsNonNegative() && value < 0) ? 0 : value;
+  auto clamp_value = [this](float value) {
+    value = ClampTo<float>(value);
+    return (IsNonNegative() && value < 0) ? 0 : value;
+  };
+  if (!expression_) {
+    return clamp_value(Pixels() + Percent() / 100 * max_value);
+  }
+  if (program_.IsEmpty()) {
+    return clamp_value(expression_->Evaluate(max_value, input));
+  }
+  if (max_value != last_max_value_) {
+    last_max_value_ = max_value;
+    last_value_ = clamp_value(program_.Evaluate(max_value));
+  }
+  return last_value_;
+}
+
+void CalculationValue::EvaluateMany(base::span<const float> max_values,
+                                    base::span<float> results,
+                                    const EvaluationInput& input) const {
+  CHECK_EQ(max_values.size(), results.size());
+  if (!expression_) {
+    size_t i = 0;
+    const gfx::Float4 pixels = {Pixels(), Pixels(), Pixels(), Pixels()};
+    const float percent = Percent() / 100;
+    const gfx::Float4 scale = {percent, percent, percent, percent};
+    for (; i + 4 <= max_values.size(); i += 4) {
+      const gfx::Float4 values =
+          pixels + scale * gfx::Float4{max_values[i], max_values[i + 1],
+                                       max_values[i + 2], max_values[i + 3]};
+      for (size_t lane = 0; lane < 4; ++lane) {
+        results[i + lane] = values[lane];
+      }
+    }
+    for (; i < max_values.size(); ++i) {
+      results[i] = Pixels() + Percent() / 100 * max_values[i];
+    }
+  } else if (!program_.IsEmpty()) {
+    program_.EvaluateMany(max_values, results);
+  } else {
+    for (size_t i = 0; i < max_values.size(); ++i) {
+      results[i] = expression_->Evaluate(max_values[i], input);
+    }
+  }
+  for (float& result : results) {
+    result = ClampTo<float>(result);
+    if (IsNonNegative() && result < 0) {
+      result = 0;
+    }
+  }
 }
 
 bool CalculationValue::operator==(const CalculationValue& other) const {
+  if (zoom_ != other.zoom_) {
+    // Only expressions are zoomed lazily.
+    return expression_ && other.expression_ &&
+           is_non_negative_ == other.is_non_negative_ &&
+           *GetOrCreateExpression() == *other.GetOrCreateExpression();
+  }
   return value_.pixels == other.value_.pixels &&
          value_.percent == other.value_.percent &&
          base::ValuesEquivalent(expression_, other.expression_) &&
          is_non_negative_ == other.is_non_negative_;
 }
 
+bool CalculationValue::IsIdentical(const CalculationValue& other) const {
+  if (zoom_ != other.zoom_ || !(*this == other)) {
+    return false;
+  }
+  if (!expression_) {
+    return HasExplicitPixels() == other.HasExplicitPixels() &&
+           HasExplicitPercent() == other.HasExplicitPercent();
+  }
+  return HaveSameExplicitTerms(*expression_, *other.expression_);
+}
+
+unsigned CalculationValue::GetHash() const {
+  unsigned hash = 0;
+  AddIntToHash(hash, is_non_negative_);
+  if (!expression_) {
+    AddPixelsAndPercentToHash(hash, value_);
+    return hash;
+  }
+  AddFloatToHash(hash, static_cast<float>(zoom_));
+  AddExpressionToHash(hash, *expression_);
+  return hash;
+}
+
 const CalculationExpressionNode* CalculationValue::GetOrCreateExpression()
     const {
   if (expression_) {
-    return expression_.Get();
+    if (zoom_ == 1) {
+      return expression_.Get();
+    }
+    if (!zoomed_expression_) {
+      zoomed_expression_ = expression_->Zoom(zoom_);
+    }
+    return zoomed_expression_.Get();
   }
   return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
       GetPixelsAndPercent());
@@ -131,7 +307,11 @@ const CalculationValue* CalculationValue::Add(
 
 const CalculationValue* CalculationValue::Zoom(double factor) const {
   if (expression_) {
-    return CreateSimplified(expression_->Zoom(factor), GetValueRange());
+    if (!program_.IsEmpty() && !MaySimplifyWhenZoomed(*expression_)) {
+      return MakeGarbageCollected<CalculationValue>(PassKey(), *this, factor);
+    }
+    return CreateSimplified(GetOrCreateExpression()->Zoom(factor),
+                            GetValueRange());
   }
   PixelsAndPercent result(Pixels() * factor, Percent(), HasExplicitPixels(),
                           HasExplicitPercent());
@@ -169,21 +349,15 @@ bool CalculationValue::HasStretch() const {
 }
 
 bool CalculationValue::HasMinContent() const {
-  // `HasContentOrIntrinsicSize` is comparatively faster than `HasMinContent`.
-  return expression_ && expression_->HasContentOrIntrinsicSize() &&
-         expression_->HasMinContent();
+  return expression_ && expression_->HasMinContent();
 }
 
 bool CalculationValue::HasMaxContent() const {
-  // `HasContentOrIntrinsicSize` is comparatively faster than `HasMaxContent`.
-  return expression_ && expression_->HasContentOrIntrinsicSize() &&
-         expression_->HasMaxContent();
+  return expression_ && expression_->HasMaxContent();
 }
 
 bool CalculationValue::HasFitContent() const {
-  // `HasContentOrIntrinsicSize` is comparatively faster than `HasFitContent`.
-  return expression_ && expression_->HasContentOrIntrinsicSize() &&
-         expression_->HasFitContent();
+  return expression_ && expression_->HasFitContent();
 }
 
 bool CalculationValue::HasOnlyFixedAndPercent() const {
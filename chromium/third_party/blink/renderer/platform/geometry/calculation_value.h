@@ -31,7 +31,12 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_CALCULATION_VALUE_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_CALCULATION_VALUE_H_
 
+#include <limits>
+
+#include "base/containers/span.h"
 #include "base/types/pass_key.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_program.h"
+#include "third_party/blink/renderer/platform/geometry/geometry_allocation_stats.h"
 #include "third_party/blink/renderer/platform/geometry/length.h"
 #include "third_party/blink/renderer/platform/geometry/length_functions.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
@@ -47,12 +52,17 @@ class PLATFORM_EXPORT CalculationValue
  public:
   CalculationValue(PixelsAndPercent value, Length::ValueRange range)
       : value_(value),
-        is_non_negative_(range == Length::ValueRange::kNonNegative) {}
+        is_non_negative_(range == Length::ValueRange::kNonNegative) {
+    GeometryAllocationStats::CountCalculationValue();
+  }
 
   using PassKey = base::PassKey<CalculationValue>;
   CalculationValue(PassKey,
                    const CalculationExpressionNode* expression,
                    Length::ValueRange range);
+  // |value| zoomed by |factor|, which shares the expression of |value|. See
+  // Zoom().
+  CalculationValue(PassKey, const CalculationValue& value, double factor);
 
   // If |expression| simply wraps a |PixelsAndPercent| value, this function
   // takes that value directly and discards |expression|.
@@ -65,7 +75,19 @@ class PLATFORM_EXPORT CalculationValue
   void Trace(Visitor* visitor) const;
 
   float Evaluate(float max_value, const EvaluationInput& = {}) const;
+  // Sets each of |results| to Evaluate() of the max value at the same index
+  // of |max_values|, which must have the same size, e.g. for the tracks of a
+  // grid.
+  void EvaluateMany(base::span<const float> max_values,
+                    base::span<float> results,
+                    const EvaluationInput& = {}) const;
   bool operator==(const CalculationValue& o) const;
+  // Whether |other| can be used in place of this value: it's equal, and also
+  // has the same explicit pixels and percentages (see PixelsAndPercent) and
+  // the same lazy zoom. Identical values have the same GetHash(), so that
+  // Lengths can share them.
+  bool IsIdentical(const CalculationValue& other) const;
+  unsigned GetHash() const;
   bool IsExpression() const { return expression_; }
   bool IsNonNegative() const { return is_non_negative_; }
   Length::ValueRange GetValueRange() const {
@@ -115,12 +137,26 @@ class PLATFORM_EXPORT CalculationValue
                                 Length::ValueRange) const;
   const CalculationValue* SubtractFromOneHundredPercent() const;
   const CalculationValue* Add(const CalculationValue&) const;
+  // Expressions that are lowered to a program are zoomed lazily: the zoom is
+  // applied to the program, and the expression is only rebuilt if it's
+  // needed by GetOrCreateExpression().
   const CalculationValue* Zoom(double factor) const;
 
  private:
   // `value_` and `expression_` are mutually exclusive.
   PixelsAndPercent value_;
   Member<const CalculationExpressionNode> expression_ = nullptr;
+  // The zoom that isn't applied to `expression_`, but is to `program_`, and
+  // the expression zoomed by it, once GetOrCreateExpression() needs it.
+  double zoom_ = 1;
+  mutable Member<const CalculationExpressionNode> zoomed_expression_;
+  // `expression_` lowered once, if it can be, for Evaluate().
+  CalculationProgram program_;
+  // The last result of Evaluate() with `program_`, which doesn't depend on
+  // the EvaluationInput, since the same CalculationValue is often evaluated
+  // again with the same `max_value` during layout.
+  mutable float last_max_value_ = std::numeric_limits<float>::quiet_NaN();
+  mutable float last_value_ = 0;
   const bool is_non_negative_;
 };
 
@@ -4,12 +4,21 @@
 
 #include "third_party/blink/renderer/platform/geometry/contoured_rect.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
 #include <numbers>
 
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "third_party/blink/renderer/platform/geometry/path.h"
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
 #include "third_party/blink/renderer/platform/wtf/text/strcat.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/outsets_f.h"
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/quad_f.h"
@@ -21,6 +30,95 @@ using Corner = ContouredRect::Corner;
 using CornerCurvature = ContouredRect::CornerCurvature;
 
 namespace {
+
+// Beyond this, the corner turns too sharply at the half corner for the table
+// to be accurate, and the superellipse is evaluated exactly.
+constexpr float kMaxTabulatedCurvature = 8;
+
+// The quadrant y = (1 - x^k)^(1/k) of a unit convex superellipse with
+// curvature k, sampled for the x from 0 to the half corner, where its slope is
+// between -1 and 0, so that it's accurately interpolated. The quadrant is
+// symmetric in y = x, so beyond the half corner it's evaluated by inverting the
+// table.
+class SuperellipseTable {
+ public:
+  static constexpr wtf_size_t kSegments = 128;
+
+  explicit SuperellipseTable(float curvature)
+      : curvature_(curvature),
+        half_corner_(Corner::HalfCornerForCurvature(curvature)) {
+    DCHECK_GE(curvature, CornerCurvature::kBevel);
+    for (wtf_size_t i = 0; i <= kSegments; ++i) {
+      const float x = half_corner_ * i / kSegments;
+      values_[i] = std::pow(1 - std::pow(x, curvature), 1 / curvature);
+    }
+  }
+
+  float curvature() const { return curvature_; }
+
+  float Evaluate(float x) const {
+    x = ClampTo<float>(x, 0, 1);
+    if (x <= half_corner_) {
+      const float position = x / half_corner_ * kSegments;
+      const wtf_size_t i =
+          std::min(static_cast<wtf_size_t>(position), kSegments - 1);
+      return values_[i] + (values_[i + 1] - values_[i]) * (position - i);
+    }
+    // The values decrease from 1 to the half corner. Find the segment whose
+    // values span x, and interpolate its position.
+    auto it = std::partition_point(values_.begin() + 1, values_.end(),
+                                   [x](float value) { return value > x; });
+    const wtf_size_t i =
+        std::min(static_cast<wtf_size_t>(it - values_.begin()), kSegments) - 1;
+    const float span = values_[i] - values_[i + 1];
+    const float fraction =
+        span > 0 ? ClampTo<float>((values_[i] - x) / span, 0, 1) : 0;
+    return half_corner_ * (i + fraction) / kSegments;
+  }
+
+ private:
+  float curvature_;
+  float half_corner_;
+  std::array<float, kSegments + 1> values_;
+};
+
+// The tables of the most recently used curvatures. The named curvatures and
+// the few author values of a page share them.
+struct SuperellipseTableCache {
+  static constexpr wtf_size_t kSize = 8;
+
+  static SuperellipseTableCache& Get() {
+    static base::NoDestructor<SuperellipseTableCache> cache;
+    return *cache;
+  }
+
+  base::Lock lock;
+  // The most recently used first.
+  Vector<SuperellipseTable, kSize> tables GUARDED_BY(lock);
+};
+
+// Returns y = (1 - x^k)^(1/k) for the convex |curvature| k, for the x from 0
+// to 1.
+float NormalizedSuperellipseIntercept(float x, float curvature) {
+  DCHECK_GE(curvature, CornerCurvature::kBevel);
+  if (curvature > kMaxTabulatedCurvature) {
+    return std::pow(1 - std::pow(x, curvature), 1 / curvature);
+  }
+  SuperellipseTableCache& cache = SuperellipseTableCache::Get();
+  base::AutoLock locker(cache.lock);
+  auto* it = std::ranges::find(cache.tables, curvature,
+                               &SuperellipseTable::curvature);
+  if (it == cache.tables.end()) {
+    if (cache.tables.size() == SuperellipseTableCache::kSize) {
+      cache.tables.pop_back();
+    }
+    cache.tables.push_front(SuperellipseTable(curvature));
+  } else {
+    std::rotate(cache.tables.begin(), it, it + 1);
+  }
+  return cache.tables.front().Evaluate(x);
+}
+
 float CornerRectIntercept(float y,
                           const gfx::RectF& corner_rect,
                           float curvature) {
@@ -42,10 +140,19 @@ float CornerRectIntercept(float y,
                                                      1 / curvature);
   }
   return corner_rect.width() *
-         std::pow(1 - std::pow(y / corner_rect.height(), curvature),
-                  1 / curvature);
+         NormalizedSuperellipseIntercept(y / corner_rect.height(), curvature);
 }
 
+using gfx::Float4;
+using gfx::FloatBoolean4;
+
+// The lanes of the corners of ContouredRect::Corners.
+constexpr FloatBoolean4 kIsRightCorner = {-1, -1, 0, 0};
+constexpr FloatBoolean4 kIsTopCorner = {-1, 0, 0, -1};
+// The directions of the outer points from the centers.
+constexpr Float4 kOuterDirectionX = {1, 1, -1, -1};
+constexpr Float4 kOuterDirectionY = {-1, 1, 1, -1};
+
 void ApplyOutsetAsTransform(FloatRoundedRect& rect,
                             const gfx::OutsetsF& outsets) {
   if (rect.IsEmpty()) {
@@ -90,6 +197,22 @@ bool ContouredRect::IntersectsQuad(const gfx::QuadF& quad) const {
                              : GetPath().Intersects(quad);
 }
 
+bool ContouredRect::Contains(const gfx::PointF& point) const {
+  if (HasRoundCurvature()) {
+    return rect_.Contains(point);
+  }
+  // The corners of inner rects are aligned to the origin rect, and those of
+  // rects with overlapping corners intersect each other, so their paths aren't
+  // just a rect with its corners cut.
+  if (IsInnerRect() || !IsRenderable()) {
+    return GetPath().Contains(point);
+  }
+  if (!Rect().InclusiveContains(point)) {
+    return false;
+  }
+  return Corners(*this).Contains(point);
+}
+
 void ContouredRect::OutsetWithCornerCorrection(const gfx::OutsetsF& outsets) {
   if (RuntimeEnabledFeatures::ShadowContourFollowsBorderEnabled()) {
     rect_.OutsetWithCornerCorrection(outsets);
@@ -235,6 +358,121 @@ Corner ContouredRect::Corner::AlignedToOrigin(const Corner& origin,
                 curvature};
 }
 
+ContouredRect::Corners::Corners(const ContouredRect& contoured_rect) {
+  if (contoured_rect.IsInnerRect()) {
+    // The corners are aligned to those of the origin rect one at a time.
+    const std::array<Corner, kCount> corners = {
+        contoured_rect.TopRightCorner(), contoured_rect.BottomRightCorner(),
+        contoured_rect.BottomLeftCorner(), contoured_rect.TopLeftCorner()};
+    for (size_t i = 0; i < kCount; ++i) {
+      outer_x_[i] = corners[i].Outer().x();
+      outer_y_[i] = corners[i].Outer().y();
+      center_x_[i] = corners[i].Center().x();
+      center_y_[i] = corners[i].Center().y();
+      curvature_[i] = corners[i].Curvature();
+    }
+    return;
+  }
+
+  const gfx::RectF& rect = contoured_rect.Rect();
+  const FloatRoundedRect::Radii& radii = contoured_rect.GetRadii();
+  const Float4 widths = {radii.TopRight().width(), radii.BottomRight().width(),
+                         radii.BottomLeft().width(), radii.TopLeft().width()};
+  const Float4 heights = {
+      radii.TopRight().height(), radii.BottomRight().height(),
+      radii.BottomLeft().height(), radii.TopLeft().height()};
+  // The corner rects of FloatRoundedRect::TopRightCorner() etc., with the same
+  // arithmetic, so that the corners are the same as those of Corner(rect,
+  // rotation, curvature).
+  const Float4 left =
+      kIsRightCorner ? rect.right() - widths : Float4{} + rect.x();
+  const Float4 top =
+      kIsTopCorner ? Float4{} + rect.y() : rect.bottom() - heights;
+  const Float4 right = left + widths;
+  const Float4 bottom = top + heights;
+  gfx::StoreFloat4(kIsRightCorner ? right : left, outer_x_.data());
+  gfx::StoreFloat4(kIsTopCorner ? top : bottom, outer_y_.data());
+  gfx::StoreFloat4(kIsRightCorner ? left : right, center_x_.data());
+  gfx::StoreFloat4(kIsTopCorner ? bottom : top, center_y_.data());
+
+  const CornerCurvature& curvature = contoured_rect.GetCornerCurvature();
+  const Float4 curvatures = {curvature.TopRight(), curvature.BottomRight(),
+                             curvature.BottomLeft(), curvature.TopLeft()};
+  const Float4 min_curvature = Float4{} + CornerCurvature::kNotch;
+  const Float4 max_curvature = Float4{} + CornerCurvature::kStraight;
+  gfx::StoreFloat4(
+      curvatures < min_curvature
+          ? min_curvature
+          : (curvatures > max_curvature ? max_curvature : curvatures),
+      curvature_.data());
+}
+
+void ContouredRect::Corners::Outset(const gfx::OutsetsF& outsets) {
+  const Float4 outsets_x = {outsets.right(), outsets.right(), outsets.left(),
+                            outsets.left()};
+  const Float4 outsets_y = {outsets.top(), outsets.bottom(), outsets.bottom(),
+                            outsets.top()};
+  const Float4 outer_x =
+      gfx::LoadFloat4(outer_x_.data()) + kOuterDirectionX * outsets_x;
+  const Float4 outer_y =
+      gfx::LoadFloat4(outer_y_.data()) + kOuterDirectionY * outsets_y;
+  Float4 radii_x =
+      (gfx::LoadFloat4(outer_x_.data()) - gfx::LoadFloat4(center_x_.data())) *
+      kOuterDirectionX;
+  Float4 radii_y =
+      (gfx::LoadFloat4(outer_y_.data()) - gfx::LoadFloat4(center_y_.data())) *
+      kOuterDirectionY;
+  // Zero radii are kept zero, so that sharp corners stay sharp, and the others
+  // are clamped to zero as gfx::SizeF clamps them.
+  constexpr float kTrivialRadius = 8.f * std::numeric_limits<float>::epsilon();
+  radii_x = radii_x > 0.f ? radii_x + outsets_x : radii_x;
+  radii_x = radii_x > kTrivialRadius ? radii_x : Float4{};
+  radii_y = radii_y > 0.f ? radii_y + outsets_y : radii_y;
+  radii_y = radii_y > kTrivialRadius ? radii_y : Float4{};
+  gfx::StoreFloat4(outer_x, outer_x_.data());
+  gfx::StoreFloat4(outer_y, outer_y_.data());
+  gfx::StoreFloat4(outer_x - kOuterDirectionX * radii_x, center_x_.data());
+  gfx::StoreFloat4(outer_y - kOuterDirectionY * radii_y, center_y_.data());
+}
+
+bool ContouredRect::Corners::Contains(const gfx::PointF& point) const {
+  const Float4 outer_x = gfx::LoadFloat4(outer_x_.data());
+  const Float4 outer_y = gfx::LoadFloat4(outer_y_.data());
+  const Float4 center_x = gfx::LoadFloat4(center_x_.data());
+  const Float4 center_y = gfx::LoadFloat4(center_y_.data());
+  const Float4 curvature = gfx::LoadFloat4(curvature_.data());
+
+  // The normalized coordinates of the point, from which Corner::MapPoint()
+  // would map it, from the center towards the outer point. They're swapped for
+  // the corners that start vertically, which doesn't matter to the
+  // superellipses, which are symmetric.
+  const Float4 x = (point.x() - center_x) / (outer_x - center_x);
+  const Float4 y = (point.y() - center_y) / (outer_y - center_y);
+  // In the bounding box, edges included, and not empty.
+  const FloatBoolean4 in_corner = (x >= 0.f) & (x <= 1.f) & (y >= 0.f) &
+                                  (y <= 1.f) & (outer_x != center_x) &
+                                  (outer_y != center_y);
+  if (!gfx::AllTrue(in_corner == 0)) {
+    // A concave superellipse is a mirror image of the convex version, around
+    // the outer point, and the point must be outside of that.
+    const FloatBoolean4 is_concave = curvature < 1.f;
+    const Float4 superellipse =
+        is_concave
+            ? gfx::PowFloat4(1.f - x, 1.f / curvature) +
+                  gfx::PowFloat4(1.f - y, 1.f / curvature)
+            : gfx::PowFloat4(x, curvature) + gfx::PowFloat4(y, curvature);
+    const FloatBoolean4 in_curve =
+        curvature == CornerCurvature::kBevel ? x + y <= 1.f
+        : curvature == CornerCurvature::kRound
+            ? x * x + y * y <= 1.f
+            : (is_concave ? superellipse >= 1.f : superellipse <= 1.f);
+    if (!gfx::AllTrue((in_corner & ~in_curve) == 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // static
 float ContouredRect::Corner::CurvatureForHalfCorner(float half_corner) {
   return half_corner >= 1   ? ContouredRect::CornerCurvature::kStraight
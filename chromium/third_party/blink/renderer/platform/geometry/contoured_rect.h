@@ -201,6 +201,60 @@ class PLATFORM_EXPORT ContouredRect {
     float curvature_;
   };
 
+  // The four corners of a contoured rect, as TopRightCorner(),
+  // BottomRightCorner(), BottomLeftCorner() and TopLeftCorner() return them,
+  // packed with the coordinates of their outer points, their centers and their
+  // curvatures side by side, so that they're built, moved and hit-tested
+  // together in SIMD lanes. The corners are axis-aligned, so their start and
+  // end points take their coordinates from those.
+  class PLATFORM_EXPORT Corners {
+    DISALLOW_NEW();
+
+   public:
+    // The indices of the corners, clockwise from the top-right, in the order
+    // that the path of the contoured rect draws them.
+    enum Index : size_t { kTopRight, kBottomRight, kBottomLeft, kTopLeft };
+    static constexpr size_t kCount = 4;
+
+    explicit Corners(const ContouredRect&);
+
+    // The curvature is clamped as by the Corner constructors that take the
+    // vertices.
+    Corner operator[](size_t index) const {
+      const gfx::PointF outer(outer_x_[index], outer_y_[index]);
+      const gfx::PointF center(center_x_[index], center_y_[index]);
+      // The top-right and bottom-left corners start on the horizontal side.
+      const bool starts_horizontally = index % 2 == 0;
+      const gfx::PointF start =
+          starts_horizontally ? gfx::PointF(center.x(), outer.y())
+                              : gfx::PointF(outer.x(), center.y());
+      const gfx::PointF end = starts_horizontally
+                                  ? gfx::PointF(outer.x(), center.y())
+                                  : gfx::PointF(center.x(), outer.y());
+      return Corner({start, outer, end, center}, curvature_[index]);
+    }
+
+    // Moves the corners as FloatRoundedRect::Outset() moves those of its
+    // rect: the outer points by the |outsets| of their sides, and the centers
+    // of the corners with zero radii along with them. The radii that aren't
+    // zero grow by the outsets, and shrink to no less than zero.
+    void Outset(const gfx::OutsetsF& outsets);
+    void Inset(const gfx::InsetsF& insets) { Outset(insets.ToOutsets()); }
+
+    // Whether |point| is on the side of the curves of the corners towards
+    // their centers, or outside of their bounding boxes, as
+    // ContouredRect::Contains() tests it once it's in the rect.
+    bool Contains(const gfx::PointF& point) const;
+
+   private:
+    std::array<float, kCount> outer_x_;
+    std::array<float, kCount> outer_y_;
+    std::array<float, kCount> center_x_;
+    std::array<float, kCount> center_y_;
+    // Clamped by Corner::ClampCurvature().
+    std::array<float, kCount> curvature_;
+  };
+
   constexpr ContouredRect() = default;
   constexpr explicit ContouredRect(const FloatRoundedRect& rect)
       : rect_(rect) {}
@@ -261,6 +315,11 @@ class PLATFORM_EXPORT ContouredRect {
 
   bool IntersectsQuad(const gfx::QuadF&) const;
 
+  // Tests whether the point is in the contoured rect, edges included, without
+  // building its path. Points in a corner are tested against the superellipse
+  // of its curvature, and those elsewhere in the rect are inside.
+  bool Contains(const gfx::PointF&) const;
+
   // Whether the radii are constrained in the size of rect().
   bool IsRenderable() const { return rect_.IsRenderable(); }
   String ToString() const;
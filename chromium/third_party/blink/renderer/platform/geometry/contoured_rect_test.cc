@@ -4,6 +4,8 @@
 
 #include "third_party/blink/renderer/platform/geometry/contoured_rect.h"
 
+#include <cmath>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/platform/geometry/infinite_int_rect.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
@@ -142,6 +144,140 @@ TEST(ContouredRectTest, ellipticalCorners) {
       ContouredRect(r).XInterceptsAtY(101, min_x_intercept, max_x_intercept));
 }
 
+TEST(ContouredRectTest, SuperellipseIntercepts) {
+  const FloatRoundedRect r(gfx::RectF(0, 0, 100, 100), 50);
+  const auto superellipse = [](float x, float curvature) {
+    return std::pow(1 - std::pow(x, curvature), 1 / curvature);
+  };
+  // Tabulated convex and concave curvatures, and one evaluated exactly.
+  for (float curvature : {1.5f, 3.f, 8.f, 0.75f, 100.f}) {
+    SCOPED_TRACE(curvature);
+    const ContouredRect contoured_rect(
+        r, ContouredRect::CornerCurvature(curvature, curvature, curvature,
+                                          curvature));
+    for (float y = 0; y < 50; y += 0.5) {
+      SCOPED_TRACE(y);
+      const float expected_max_x =
+          curvature >= 1 ? 50 + 50 * superellipse((50 - y) / 50, curvature)
+                         : 100 - 50 * superellipse(y / 50, 1 / curvature);
+      float min_x_intercept;
+      float max_x_intercept;
+      ASSERT_TRUE(contoured_rect.XInterceptsAtY(y, min_x_intercept,
+                                                max_x_intercept));
+      EXPECT_NEAR(expected_max_x, max_x_intercept, 0.1);
+      EXPECT_NEAR(100 - expected_max_x, min_x_intercept, 0.1);
+    }
+  }
+}
+
+TEST(ContouredRectTest, Contains) {
+  const FloatRoundedRect r(gfx::RectF(0, 0, 100, 100), 50);
+  const auto make = [&r](float curvature) {
+    return ContouredRect(r, ContouredRect::CornerCurvature(
+                                curvature, curvature, curvature, curvature));
+  };
+
+  const ContouredRect bevel = make(ContouredRect::CornerCurvature::kBevel);
+  EXPECT_TRUE(bevel.Contains(gfx::PointF(50, 50)));
+  EXPECT_TRUE(bevel.Contains(gfx::PointF(50, 0)));
+  EXPECT_TRUE(bevel.Contains(gfx::PointF(25, 25)));
+  EXPECT_TRUE(bevel.Contains(gfx::PointF(30, 30)));
+  EXPECT_FALSE(bevel.Contains(gfx::PointF(10, 10)));
+  EXPECT_FALSE(bevel.Contains(gfx::PointF(90, 90)));
+  EXPECT_FALSE(bevel.Contains(gfx::PointF(50, 101)));
+
+  const ContouredRect squircle = make(4);
+  EXPECT_TRUE(squircle.Contains(gfx::PointF(10, 10)));
+  EXPECT_TRUE(squircle.Contains(gfx::PointF(90, 10)));
+  EXPECT_FALSE(squircle.Contains(gfx::PointF(5, 5)));
+  EXPECT_FALSE(squircle.Contains(gfx::PointF(95, 95)));
+
+  const ContouredRect scoop = make(ContouredRect::CornerCurvature::kScoop);
+  EXPECT_TRUE(scoop.Contains(gfx::PointF(40, 40)));
+  EXPECT_TRUE(scoop.Contains(gfx::PointF(50, 0)));
+  EXPECT_FALSE(scoop.Contains(gfx::PointF(30, 30)));
+  EXPECT_FALSE(scoop.Contains(gfx::PointF(45, 10)));
+  EXPECT_FALSE(scoop.Contains(gfx::PointF(60, 90)));
+
+  const ContouredRect notch = make(ContouredRect::CornerCurvature::kNotch);
+  EXPECT_TRUE(notch.Contains(gfx::PointF(50, 50)));
+  EXPECT_FALSE(notch.Contains(gfx::PointF(25, 25)));
+
+  // Round corners are tested as a FloatRoundedRect.
+  const ContouredRect round = make(ContouredRect::CornerCurvature::kRound);
+  EXPECT_TRUE(round.Contains(gfx::PointF(20, 20)));
+  EXPECT_FALSE(round.Contains(gfx::PointF(10, 10)));
+}
+
+TEST(ContouredRectTest, Corners) {
+  ContouredRect contoured_rect(
+      FloatRoundedRect(gfx::RectF(10.5f, 20, 100, 80),
+                       FloatRoundedRect::Radii(
+                           gfx::SizeF(10, 20), gfx::SizeF(30.25f, 5),
+                           gfx::SizeF(0, 15), gfx::SizeF(40, 40))),
+      ContouredRect::CornerCurvature(4, 0.5, 1, 2));
+  const auto expect_corners = [](const ContouredRect& contoured_rect) {
+    const ContouredRect::Corners corners(contoured_rect);
+    EXPECT_EQ(contoured_rect.TopRightCorner(),
+              corners[ContouredRect::Corners::kTopRight]);
+    EXPECT_EQ(contoured_rect.BottomRightCorner(),
+              corners[ContouredRect::Corners::kBottomRight]);
+    EXPECT_EQ(contoured_rect.BottomLeftCorner(),
+              corners[ContouredRect::Corners::kBottomLeft]);
+    EXPECT_EQ(contoured_rect.TopLeftCorner(),
+              corners[ContouredRect::Corners::kTopLeft]);
+  };
+  expect_corners(contoured_rect);
+
+  // Inner rects, with their corners aligned to the origin rect.
+  ContouredRect inner_rect = contoured_rect;
+  inner_rect.SetOriginRect(contoured_rect.AsRoundedRect());
+  inner_rect.Inset(gfx::InsetsF(5));
+  expect_corners(inner_rect);
+
+  // Outset and inset as the rect, with the sharp corner kept sharp and the
+  // radii that shrink beyond zero clamped to zero.
+  for (const gfx::OutsetsF& outsets :
+       {gfx::OutsetsF().set_left(4).set_top(2).set_right(8).set_bottom(16),
+        gfx::OutsetsF(-10)}) {
+    ContouredRect::Corners corners(contoured_rect);
+    corners.Outset(outsets);
+    ContouredRect outset_rect = contoured_rect;
+    outset_rect.Outset(outsets);
+    expect_corners(outset_rect);
+    const ContouredRect::Corners outset_corners(outset_rect);
+    for (size_t i = 0; i < ContouredRect::Corners::kCount; ++i) {
+      SCOPED_TRACE(i);
+      EXPECT_EQ(outset_corners[i], corners[i]);
+    }
+  }
+}
+
+TEST(ContouredRectTest, CornersContains) {
+  // A round top-left corner, a squircle, a scoop and a bevel.
+  const ContouredRect contoured_rect(
+      FloatRoundedRect(gfx::RectF(0, 0, 100, 100), 50),
+      ContouredRect::CornerCurvature(2, 4, 0.5, 1));
+  const ContouredRect::Corners corners(contoured_rect);
+  // Top-right.
+  EXPECT_TRUE(corners.Contains(gfx::PointF(90, 10)));
+  EXPECT_FALSE(corners.Contains(gfx::PointF(95, 5)));
+  // Bottom-right.
+  EXPECT_TRUE(corners.Contains(gfx::PointF(60, 60)));
+  EXPECT_FALSE(corners.Contains(gfx::PointF(70, 70)));
+  EXPECT_FALSE(corners.Contains(gfx::PointF(90, 55)));
+  // Bottom-left.
+  EXPECT_TRUE(corners.Contains(gfx::PointF(30, 70)));
+  EXPECT_FALSE(corners.Contains(gfx::PointF(10, 90)));
+  // Top-left.
+  EXPECT_TRUE(corners.Contains(gfx::PointF(20, 20)));
+  EXPECT_FALSE(corners.Contains(gfx::PointF(10, 10)));
+  // The ends of the corners.
+  EXPECT_TRUE(corners.Contains(gfx::PointF(50, 0)));
+  EXPECT_TRUE(corners.Contains(gfx::PointF(100, 50)));
+  EXPECT_TRUE(corners.Contains(gfx::PointF(0, 50)));
+}
+
 TEST(ContouredRectTest, ToString) {
   gfx::SizeF corner_rect(1, 2);
   ContouredRect rect_with_curvature(
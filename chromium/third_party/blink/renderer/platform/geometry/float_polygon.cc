@@ -29,8 +29,14 @@
 
 #include "third_party/blink/renderer/platform/geometry/float_polygon.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <optional>
+
+#include "third_party/blink/renderer/platform/transforms/affine_transform.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
+#include "ui/gfx/geometry/line_f.h"
 
 namespace blink {
 
@@ -133,57 +139,138 @@ FloatPolygon::FloatPolygon(Vector<gfx::PointF> vertices)
   if (empty_)
     return;
 
-  for (unsigned i = 0; i < edges_.size(); ++i) {
-    FloatPolygonEdge* edge = &edges_[i];
-    edge_tree_.Add(EdgeInterval(edge->MinY(), edge->MaxY(), edge));
+  edge_intervals_.resize(edges_.size());
+  for (wtf_size_t i = 0; i < edges_.size(); ++i)
+    edge_intervals_[i].edge_index = i;
+  UpdateEdgeIntervals(/*sort=*/true);
+}
+
+void FloatPolygon::Transform(const AffineTransform& transform) {
+  DCHECK((!transform.B() && !transform.C()) ||
+         (!transform.A() && !transform.D()));
+  DCHECK_GT(transform.Det(), 0);
+
+  for (gfx::PointF& vertex : vertices_)
+    vertex = transform.MapPoint(vertex);
+  // As in the constructor, the bounds are those of the first vertex and of
+  // the vertices of the edges.
+  if (!vertices_.empty())
+    bounding_box_ = gfx::RectF(VertexAt(0), gfx::SizeF());
+  if (NumberOfVertices() >= 3) {
+    for (const FloatPolygonEdge& edge : edges_)
+      bounding_box_.UnionEvenIfEmpty(gfx::RectF(edge.Vertex1(), gfx::SizeF()));
   }
+
+  // Without a flip, the edges keep their vertices and their order. The order
+  // of their min y only changes if y is mapped from x, or reversed.
+  if (!empty_)
+    UpdateEdgeIntervals(/*sort=*/transform.B() || transform.D() < 0);
+}
+
+void FloatPolygon::UpdateEdgeIntervals(bool sort) {
+  for (EdgeInterval& interval : edge_intervals_) {
+    const FloatPolygonEdge& edge = edges_[interval.edge_index];
+    interval.min_y = edge.MinY();
+    interval.max_y = edge.MaxY();
+  }
+  if (sort) {
+    std::sort(edge_intervals_.begin(), edge_intervals_.end(),
+              [](const EdgeInterval& a, const EdgeInterval& b) {
+                return a.min_y < b.min_y;
+              });
+  }
+  BuildEdgeIntervalTree(0, edge_intervals_.size());
+}
+
+float FloatPolygon::BuildEdgeIntervalTree(wtf_size_t begin, wtf_size_t end) {
+  if (begin == end)
+    return -std::numeric_limits<float>::infinity();
+  wtf_size_t mid = begin + (end - begin) / 2;
+  EdgeInterval& node = edge_intervals_[mid];
+  node.subtree_max_y =
+      std::max({node.max_y, BuildEdgeIntervalTree(begin, mid),
+                BuildEdgeIntervalTree(mid + 1, end)});
+  return node.subtree_max_y;
 }
 
 bool FloatPolygon::OverlappingEdges(
     float min_y,
     float max_y,
     Vector<const FloatPolygonEdge*>& result) const {
-  Vector<FloatPolygon::EdgeInterval> overlapping_edge_intervals;
-  edge_tree_.AllOverlaps(FloatPolygon::EdgeInterval(min_y, max_y, 0),
-                         overlapping_edge_intervals);
-  unsigned overlapping_edge_intervals_size = overlapping_edge_intervals.size();
-  result.resize(overlapping_edge_intervals_size);
-  for (unsigned i = 0; i < overlapping_edge_intervals_size; ++i) {
-    const FloatPolygonEdge* edge = static_cast<const FloatPolygonEdge*>(
-        overlapping_edge_intervals[i].Data());
-    DCHECK(edge);
-    result[i] = edge;
-  }
-  return overlapping_edge_intervals_size > 0;
+  result.clear();
+  CollectOverlappingEdges(min_y, max_y, 0, edge_intervals_.size(), result);
+  return !result.empty();
 }
 
-bool VertexPair::Intersection(const VertexPair& other,
-                              gfx::PointF& point) const {
-  // See: http://paulbourke.net/geometry/pointlineplane/,
-  // "Intersection point of two lines in 2 dimensions"
+void FloatPolygon::CollectOverlappingEdges(
+    float min_y,
+    float max_y,
+    wtf_size_t begin,
+    wtf_size_t end,
+    Vector<const FloatPolygonEdge*>& result) const {
+  // Recurses into the left subtrees, and loops into the right ones.
+  while (begin < end) {
+    wtf_size_t mid = begin + (end - begin) / 2;
+    const EdgeInterval& node = edge_intervals_[mid];
+    if (node.subtree_max_y < min_y)
+      return;
+    CollectOverlappingEdges(min_y, max_y, begin, mid, result);
+    // The node and its right subtree start below the range.
+    if (node.min_y > max_y)
+      return;
+    if (node.max_y >= min_y)
+      result.push_back(&edges_[node.edge_index]);
+    begin = mid + 1;
+  }
+}
 
-  gfx::Vector2dF this_delta = Vertex2() - Vertex1();
-  gfx::Vector2dF other_delta = other.Vertex2() - other.Vertex1();
-  float denominator = gfx::CrossProduct(this_delta, other_delta);
-  if (!denominator)
-    return false;
+FloatPolygon::ScanlineCursor::ScanlineCursor(const FloatPolygon& polygon)
+    : polygon_(polygon) {}
 
-  // The two line segments: "this" vertex1,vertex2 and "other" vertex1,vertex2,
-  // have been defined in parametric form. Each point on the line segment is:
-  // vertex1 + u * (vertex2 - vertex1), when 0 <= u <= 1. We're computing the
-  // values of u for each line at their intersection point.
+bool FloatPolygon::ScanlineCursor::OverlappingEdges(
+    float min_y,
+    float max_y,
+    Vector<const FloatPolygonEdge*>& result) {
+#if DCHECK_IS_ON()
+  DCHECK_GE(min_y, last_min_y_);
+  DCHECK_GE(max_y, last_max_y_);
+  last_min_y_ = min_y;
+  last_max_y_ = max_y;
+#endif
+  // The intervals are sorted by min_y, so the edges that start by max_y are
+  // the next ones. Those that end before min_y are skipped, since no later
+  // range can overlap them either.
+  const Vector<EdgeInterval>& intervals = polygon_.edge_intervals_;
+  for (; next_interval_ < intervals.size() &&
+         intervals[next_interval_].min_y <= max_y;
+       ++next_interval_) {
+    const EdgeInterval& interval = intervals[next_interval_];
+    if (interval.max_y >= min_y) {
+      active_edges_.push_back(
+          ActiveEdge{interval.max_y, &polygon_.edges_[interval.edge_index]});
+    }
+  }
 
-  gfx::Vector2dF vertex1_delta = Vertex1() - other.Vertex1();
-  float u_this_line =
-      gfx::CrossProduct(other_delta, vertex1_delta) / denominator;
-  float u_other_line =
-      gfx::CrossProduct(this_delta, vertex1_delta) / denominator;
+  result.clear();
+  wtf_size_t num_active_edges = 0;
+  for (const ActiveEdge& active_edge : active_edges_) {
+    if (active_edge.max_y < min_y)
+      continue;
+    active_edges_[num_active_edges++] = active_edge;
+    result.push_back(active_edge.edge);
+  }
+  active_edges_.Shrink(num_active_edges);
+  return !result.empty();
+}
 
-  if (u_this_line < 0 || u_other_line < 0 || u_this_line > 1 ||
-      u_other_line > 1)
+bool VertexPair::Intersection(const VertexPair& other,
+                              gfx::PointF& point) const {
+  std::optional<gfx::PointF> intersection =
+      gfx::LineF{Vertex1(), Vertex2()}.SegmentIntersectionWith(
+          gfx::LineF{other.Vertex1(), other.Vertex2()});
+  if (!intersection)
     return false;
-
-  point = Vertex1() + gfx::ScaleVector2d(this_delta, u_this_line);
+  point = *intersection;
   return true;
 }
 
@@ -30,17 +30,20 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_FLOAT_POLYGON_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_FLOAT_POLYGON_H_
 
+#include <limits>
+
 #include "base/check_op.h"
+#include "base/dcheck_is_on.h"
 #include "base/memory/raw_ptr.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
-#include "third_party/blink/renderer/platform/wtf/pod_interval_tree.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/rect_f.h"
 
 namespace blink {
 
+class AffineTransform;
 class FloatPolygonEdge;
 
 class PLATFORM_EXPORT FloatPolygon {
@@ -63,17 +66,83 @@ class PLATFORM_EXPORT FloatPolygon {
                         Vector<const FloatPolygonEdge*>& result) const;
   bool IsEmpty() const { return empty_; }
 
+  // Maps the vertices by |transform|, which must be invertible, preserve axis
+  // alignment and not flip the polygon, e.g. a scale and a translation. The
+  // result is the same as a polygon of the mapped vertices, but the edges are
+  // kept and the interval tree is updated in place, without allocating.
+  void Transform(const AffineTransform& transform);
+
+  // Finds the edges overlapping successive y ranges, as for the lines of text
+  // wrapped around the polygon, by keeping the edges that overlap the last
+  // range, so that a scan of all of the polygon costs O(edges + ranges) rather
+  // than a walk of the interval tree per range.
+  class PLATFORM_EXPORT ScanlineCursor {
+    STACK_ALLOCATED();
+
+   public:
+    explicit ScanlineCursor(const FloatPolygon& polygon);
+    ScanlineCursor(const ScanlineCursor&) = delete;
+    ScanlineCursor& operator=(const ScanlineCursor&) = delete;
+
+    // Same as FloatPolygon::OverlappingEdges(), except that neither |min_y|
+    // nor |max_y| may be less than in the previous call, and that the edges
+    // are in order of their min y.
+    bool OverlappingEdges(float min_y,
+                          float max_y,
+                          Vector<const FloatPolygonEdge*>& result);
+
+   private:
+    struct ActiveEdge {
+      float max_y;
+      const FloatPolygonEdge* edge;
+    };
+
+    const FloatPolygon& polygon_;
+    // The first of polygon_.edge_intervals_ that isn't in active_edges_ yet.
+    wtf_size_t next_interval_ = 0;
+    // The edges that overlapped the last range, in order of their min y.
+    Vector<ActiveEdge> active_edges_;
+#if DCHECK_IS_ON()
+    float last_min_y_ = -std::numeric_limits<float>::infinity();
+    float last_max_y_ = -std::numeric_limits<float>::infinity();
+#endif
+  };
+
  private:
-  using EdgeInterval = PodInterval<float, FloatPolygonEdge*>;
-  using EdgeIntervalTree = PodIntervalTree<float, FloatPolygonEdge*>;
+  // The y range of an edge, as a node of the implicit interval tree of
+  // edge_intervals_.
+  struct EdgeInterval {
+    float min_y;
+    float max_y;
+    // The largest max_y in the subtree rooted at this node.
+    float subtree_max_y;
+    wtf_size_t edge_index;
+  };
+
+  // Sets the y ranges of edge_intervals_ from the edges, sorts them by min_y
+  // if |sort|, and rebuilds the tree.
+  void UpdateEdgeIntervals(bool sort);
+  // Sets the subtree_max_y of the subtree of edge_intervals_ from |begin| to
+  // |end|, and returns it.
+  float BuildEdgeIntervalTree(wtf_size_t begin, wtf_size_t end);
+  // Appends the edges of the subtree from |begin| to |end| that overlap
+  // |min_y| to |max_y| to |result|.
+  void CollectOverlappingEdges(float min_y,
+                               float max_y,
+                               wtf_size_t begin,
+                               wtf_size_t end,
+                               Vector<const FloatPolygonEdge*>& result) const;
 
   Vector<gfx::PointF> vertices_;
   gfx::RectF bounding_box_;
   bool empty_;
   Vector<FloatPolygonEdge> edges_;
-  EdgeIntervalTree edge_tree_;  // Each EdgeIntervalTree node stores minY, maxY,
-                                // and a ("UserData") pointer to a
-                                // FloatPolygonEdge.
+  // The y ranges of the edges, sorted by min_y, in one buffer. It's an
+  // implicit interval tree: the root of each subtree is the middle of its
+  // range, and the halves on each side are its subtrees. Queries skip the
+  // subtrees whose subtree_max_y is less than their min_y, and the nodes
+  // after any node whose min_y is greater than their max_y.
+  Vector<EdgeInterval> edge_intervals_;
 };
 
 class PLATFORM_EXPORT VertexPair {
@@ -136,18 +205,6 @@ class PLATFORM_EXPORT FloatPolygonEdge final : public VertexPair {
   raw_ptr<const FloatPolygon> polygon_;
 };
 
-// These structures are used by PodIntervalTree for debugging.
-#ifndef NDEBUG
-template <>
-struct ValueToString<FloatPolygonEdge*> {
-  STATIC_ONLY(ValueToString);
-  static String ToString(const FloatPolygonEdge* edge) {
-    return String::Format("%p (%f,%f %f,%f)", edge, edge->Vertex1().x(),
-                          edge->Vertex1().y(), edge->Vertex2().x(),
-                          edge->Vertex2().y());
-  }
-};
-#endif
 }  // namespace blink
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_FLOAT_POLYGON_H_
@@ -29,10 +29,13 @@
 
 #include "third_party/blink/renderer/platform/geometry/float_polygon.h"
 
+#include <cmath>
 #include <memory>
+#include <numbers>
 
 #include "base/containers/span.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/transforms/affine_transform.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 
 namespace blink {
@@ -202,4 +205,108 @@ TEST(FloatPolygonTest, emptyPolygons) {
   TEST_EMPTY(kEmptyCoordinates6);
 }
 
+// Checks OverlappingEdges() of a polygon with many edges against a linear
+// scan of its edges.
+TEST(FloatPolygonTest, overlappingEdgesOfStar) {
+  constexpr unsigned kNumPoints = 97;
+  Vector<gfx::PointF> vertices;
+  for (unsigned i = 0; i < 2 * kNumPoints; ++i) {
+    float radius = i % 2 ? 40 : 100;
+    float angle = std::numbers::pi_v<float> * i / kNumPoints;
+    vertices.push_back(
+        gfx::PointF(radius * std::cos(angle), radius * std::sin(angle)));
+  }
+  FloatPolygon star(std::move(vertices));
+  ASSERT_EQ(2 * kNumPoints, star.NumberOfEdges());
+
+  for (float min_y = -110; min_y <= 110; min_y += 7.5f) {
+    for (float height : {0.f, 0.5f, 10.f, 250.f}) {
+      float max_y = min_y + height;
+      Vector<const FloatPolygonEdge*> expected;
+      for (unsigned i = 0; i < star.NumberOfEdges(); ++i) {
+        const FloatPolygonEdge& edge = star.EdgeAt(i);
+        if (edge.MaxY() >= min_y && edge.MinY() <= max_y)
+          expected.push_back(&edge);
+      }
+      EXPECT_EQ(expected, SortedOverlappingEdges(star, min_y, max_y))
+          << min_y << " " << max_y;
+    }
+  }
+}
+
+// Checks ScanlineCursor against OverlappingEdges() over scans of lines of
+// different heights, down a polygon with many edges.
+TEST(FloatPolygonTest, scanlineCursor) {
+  constexpr unsigned kNumPoints = 61;
+  Vector<gfx::PointF> vertices;
+  for (unsigned i = 0; i < 2 * kNumPoints; ++i) {
+    float radius = i % 2 ? 30 : 100;
+    float angle = std::numbers::pi_v<float> * i / kNumPoints;
+    vertices.push_back(
+        gfx::PointF(radius * std::cos(angle), radius * std::sin(angle)));
+  }
+  FloatPolygon star(std::move(vertices));
+
+  for (float line_height : {0.f, 0.25f, 3.f, 16.f, 500.f}) {
+    FloatPolygon::ScanlineCursor cursor(star);
+    Vector<const FloatPolygonEdge*> result;
+    for (float min_y = -120; min_y <= 120; min_y += line_height + 1.5f) {
+      float max_y = min_y + line_height;
+      EXPECT_EQ(!SortedOverlappingEdges(star, min_y, max_y).empty(),
+                cursor.OverlappingEdges(min_y, max_y, result));
+      std::sort(result.begin(), result.end(), CompareEdgeIndex);
+      EXPECT_EQ(SortedOverlappingEdges(star, min_y, max_y), result)
+          << min_y << " " << max_y;
+    }
+  }
+}
+
+// Checks that transforming a polygon gives the same edges, bounds and
+// overlapping edges as a polygon of the transformed vertices.
+TEST(FloatPolygonTest, transform) {
+  const float kCoordinates[] = {0,  0,  50, 0,  100, 0,   100, 30, 60, 40,
+                                60, 80, 20, 70, 0,   100, -10, 40};
+  // The identity, translations, scales, and rotations by 90, 180 and 270
+  // degrees.
+  for (const AffineTransform& transform :
+       {AffineTransform(), AffineTransform(1, 0, 0, 1, -7.5, 12),
+        AffineTransform(0.5, 0, 0, 3, 4, 8), AffineTransform(0, 2, -2, 0, 0, 0),
+        AffineTransform(-1, 0, 0, -1, 0, 0),
+        AffineTransform(0, -1, 1, 0, 1, 1)}) {
+    SCOPED_TRACE(transform.ToString().Utf8());
+    Vector<gfx::PointF> vertices;
+    for (size_t i = 0; i < std::size(kCoordinates); i += 2) {
+      vertices.push_back(gfx::PointF(kCoordinates[i], kCoordinates[i + 1]));
+    }
+    FloatPolygon transformed(vertices);
+    transformed.Transform(transform);
+    for (gfx::PointF& vertex : vertices)
+      vertex = transform.MapPoint(vertex);
+    FloatPolygon expected(std::move(vertices));
+
+    EXPECT_EQ(expected.BoundingBox(), transformed.BoundingBox());
+    ASSERT_EQ(expected.NumberOfEdges(), transformed.NumberOfEdges());
+    for (unsigned i = 0; i < expected.NumberOfEdges(); ++i) {
+      EXPECT_EQ(expected.EdgeAt(i).Vertex1(), transformed.EdgeAt(i).Vertex1());
+      EXPECT_EQ(expected.EdgeAt(i).Vertex2(), transformed.EdgeAt(i).Vertex2());
+    }
+    gfx::RectF bounds = expected.BoundingBox();
+    for (float min_y = bounds.y() - 1; min_y <= bounds.bottom() + 1;
+         min_y += bounds.height() / 16) {
+      float max_y = min_y + bounds.height() / 8;
+      Vector<unsigned> expected_edges;
+      for (const FloatPolygonEdge* edge :
+           SortedOverlappingEdges(expected, min_y, max_y)) {
+        expected_edges.push_back(edge->EdgeIndex());
+      }
+      Vector<unsigned> transformed_edges;
+      for (const FloatPolygonEdge* edge :
+           SortedOverlappingEdges(transformed, min_y, max_y)) {
+        transformed_edges.push_back(edge->EdgeIndex());
+      }
+      EXPECT_EQ(expected_edges, transformed_edges);
+    }
+  }
+}
+
 }  // namespace blink
@@ -31,19 +31,156 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
+#include "base/check_op.h"
+#include "base/compiler_specific.h"
 #include "third_party/blink/renderer/platform/geometry/infinite_int_rect.h"
 #include "third_party/blink/renderer/platform/geometry/path.h"
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/wtf/text/strcat.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/insets_f.h"
+#include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/quad_f.h"
 #include "ui/gfx/geometry/size_f.h"
 #include "ui/gfx/geometry/vector2d_f.h"
 
 namespace blink {
 
+namespace {
+
+using gfx::AllTrue;
+using gfx::Float4;
+using gfx::FloatBoolean4;
+
+// The directions from the centers of the corner ellipses to the corners of the
+// rect, in the lanes top-left, top-right, bottom-left and bottom-right.
+constexpr Float4 kCornerSignX = {-1, 1, -1, 1};
+constexpr Float4 kCornerSignY = {-1, -1, 1, 1};
+
+// The same as gfx::SizeF, which clamps its width and height to zero when
+// they're at most this.
+constexpr float kTrivialRadius = 8.f * std::numeric_limits<float>::epsilon();
+
+// Gets the widths and heights of |radii|, in the lanes top-left, top-right,
+// bottom-left and bottom-right.
+ALWAYS_INLINE void LoadRadii(const FloatRoundedRect::Radii& radii,
+                             Float4& widths,
+                             Float4& heights) {
+  widths = Float4{radii.TopLeft().width(), radii.TopRight().width(),
+                  radii.BottomLeft().width(), radii.BottomRight().width()};
+  heights = Float4{radii.TopLeft().height(), radii.TopRight().height(),
+                   radii.BottomLeft().height(), radii.BottomRight().height()};
+}
+
+// Sets |radii| to the widths and heights in the lanes of LoadRadii().
+ALWAYS_INLINE void StoreRadii(Float4 widths,
+                              Float4 heights,
+                              FloatRoundedRect::Radii& radii) {
+  radii.SetTopLeft(gfx::SizeF(widths[0], heights[0]));
+  radii.SetTopRight(gfx::SizeF(widths[1], heights[1]));
+  radii.SetBottomLeft(gfx::SizeF(widths[2], heights[2]));
+  radii.SetBottomRight(gfx::SizeF(widths[3], heights[3]));
+}
+
+// Gets the centers and radii of the corner ellipses of |rect|, in the lanes of
+// kCornerSignX and kCornerSignY.
+ALWAYS_INLINE void GetCornerEllipses(const FloatRoundedRect& rect,
+                                     Float4& center_x,
+                                     Float4& center_y,
+                                     Float4& radius_x,
+                                     Float4& radius_y) {
+  const gfx::RectF& r = rect.Rect();
+  LoadRadii(rect.GetRadii(), radius_x, radius_y);
+  const Float4 left = {r.x(), r.right(), r.x(), r.right()};
+  const Float4 top = {r.y(), r.y(), r.bottom(), r.bottom()};
+  center_x = left - radius_x * kCornerSignX;
+  center_y = top - radius_y * kCornerSignY;
+}
+
+// Edge-inclusive, unlike gfx::RectF::Contains().
+ALWAYS_INLINE bool RectContains(const gfx::RectF& rect,
+                                const gfx::PointF& point) {
+  return point.x() >= rect.x() && point.x() <= rect.right() &&
+         point.y() >= rect.y() && point.y() <= rect.bottom();
+}
+
+// Whether |point|, which must be in the rect, is in the ellipses of the
+// corners it's beyond the centers of, in both directions. An ellipse with
+// radii (rx, ry) contains (dx, dy) if dx^2 * ry^2 + dy^2 * rx^2 <= rx^2 * ry^2,
+// which also holds for the empty ellipses of sharp corners, which the point
+// can't be beyond.
+ALWAYS_INLINE bool CornersContain(Float4 center_x,
+                                  Float4 center_y,
+                                  Float4 radius_x_squared,
+                                  Float4 radius_y_squared,
+                                  const gfx::PointF& point) {
+  const Float4 dx = (point.x() - center_x) * kCornerSignX;
+  const Float4 dy = (point.y() - center_y) * kCornerSignY;
+  const FloatBoolean4 outside =
+      (dx > 0.f) & (dy > 0.f) &
+      (dx * dx * radius_y_squared + dy * dy * radius_x_squared >
+       radius_x_squared * radius_y_squared);
+  return AllTrue(outside == 0);
+}
+
+// The same as std::min() and std::max() in each lane, including for NaNs.
+ALWAYS_INLINE Float4 Min(Float4 a, Float4 b) {
+  return b < a ? b : a;
+}
+ALWAYS_INLINE Float4 Max(Float4 a, Float4 b) {
+  return a < b ? b : a;
+}
+
+// Gets the radii of the corner ellipses of |intersection|, which must be in
+// the rect of |rect|, that contain the parts of the corner ellipses of |rect|
+// that are in |intersection|, in the lanes of kCornerSignX and kCornerSignY.
+// The corners are inset from those of |rect| by (dx, dy), and with radii
+// (rx, ry), the part is empty unless (dx, dy) is outside the ellipse, and is
+// in the ellipse with radii (rx - dx, ry - dy) at the corner of
+// |intersection|, which is the same ellipse if |at_corner|. The radii are zero
+// where the part is empty.
+ALWAYS_INLINE void GetCornerEllipsesIn(const FloatRoundedRect& rect,
+                                       const gfx::RectF& intersection,
+                                       Float4& radius_x,
+                                       Float4& radius_y,
+                                       FloatBoolean4& at_corner) {
+  const gfx::RectF& r = rect.Rect();
+  const gfx::RectF& i = intersection;
+  Float4 rx, ry;
+  LoadRadii(rect.GetRadii(), rx, ry);
+  const Float4 dx = Float4{i.x() - r.x(), r.right() - i.right(),
+                           i.x() - r.x(), r.right() - i.right()};
+  const Float4 dy = Float4{i.y() - r.y(), i.y() - r.y(),
+                           r.bottom() - i.bottom(), r.bottom() - i.bottom()};
+  const Float4 ex = rx - dx;
+  const Float4 ey = ry - dy;
+  const FloatBoolean4 intrudes =
+      (ex > 0.f) & (ey > 0.f) &
+      (ex * ex * ry * ry + ey * ey * rx * rx > rx * rx * ry * ry);
+  const Float4 zeros = {0, 0, 0, 0};
+  radius_x = intrudes ? ex : zeros;
+  radius_y = intrudes ? ey : zeros;
+  at_corner = intrudes & (dx == zeros) & (dy == zeros);
+}
+
+}  // namespace
+
+// FloatRoundedRect::Radii::ToSkVectors() and FromSkVectors() rely on the
+// storage being in the corner order of SkRRect.
+static_assert(SkRRect::kUpperLeft_Corner == 0 &&
+              SkRRect::kUpperRight_Corner == 1 &&
+              SkRRect::kLowerRight_Corner == 2 &&
+              SkRRect::kLowerLeft_Corner == 3);
+static_assert(FloatRoundedRect::Radii(gfx::SizeF(1, 2),
+                                      gfx::SizeF(3, 4),
+                                      gfx::SizeF(5, 6),
+                                      gfx::SizeF(7, 8))
+                  .ToSkVectors()[SkRRect::kLowerRight_Corner]
+                  .fX == 7);
+
 FloatRoundedRect::FloatRoundedRect(float x, float y, float width, float height)
     : rect_(x, y, width, height) {}
 
@@ -60,35 +197,34 @@ FloatRoundedRect::FloatRoundedRect(const gfx::RectF& rect,
                                    const gfx::SizeF& bottom_right)
     : rect_(rect), radii_(top_left, top_right, bottom_left, bottom_right) {}
 
-FloatRoundedRect::FloatRoundedRect(const gfx::RRectF& r)
-    : FloatRoundedRect(r.rect()) {
-  gfx::Vector2dF top_left = r.GetCornerRadii(gfx::RRectF::Corner::kUpperLeft);
-  gfx::Vector2dF top_right = r.GetCornerRadii(gfx::RRectF::Corner::kUpperRight);
-  gfx::Vector2dF bottom_left =
-      r.GetCornerRadii(gfx::RRectF::Corner::kLowerLeft);
-  gfx::Vector2dF bottom_right =
-      r.GetCornerRadii(gfx::RRectF::Corner::kLowerRight);
-  SetRadii(Radii(gfx::SizeF(top_left.x(), top_left.y()),
-                 gfx::SizeF(top_right.x(), top_right.y()),
-                 gfx::SizeF(bottom_left.x(), bottom_left.y()),
-                 gfx::SizeF(bottom_right.x(), bottom_right.y())));
+FloatRoundedRect::FloatRoundedRect(const SkRRect& r)
+    : rect_(gfx::SkRectToRectF(r.rect())) {
+  std::array<SkVector, 4> radii = {r.radii(SkRRect::kUpperLeft_Corner),
+                                   r.radii(SkRRect::kUpperRight_Corner),
+                                   r.radii(SkRRect::kLowerRight_Corner),
+                                   r.radii(SkRRect::kLowerLeft_Corner)};
+  // SkRRect keeps radii that gfx::SizeF would clamp to zero.
+  for (SkVector& radius : radii) {
+    radius.fX = radius.fX > kTrivialRadius ? radius.fX : 0;
+    radius.fY = radius.fY > kTrivialRadius ? radius.fY : 0;
+  }
+  radii_ = Radii::FromSkVectors(radii);
 }
 
 void FloatRoundedRect::Radii::SetMinimumRadius(float minimum_radius) {
-  top_left_.set_width(std::max(minimum_radius, top_left_.width()));
-  top_left_.set_height(std::max(minimum_radius, top_left_.height()));
-  top_right_.set_width(std::max(minimum_radius, top_right_.width()));
-  top_right_.set_height(std::max(minimum_radius, top_right_.height()));
-  bottom_left_.set_width(std::max(minimum_radius, bottom_left_.width()));
-  bottom_left_.set_height(std::max(minimum_radius, bottom_left_.height()));
-  bottom_right_.set_width(std::max(minimum_radius, bottom_right_.width()));
-  bottom_right_.set_height(std::max(minimum_radius, bottom_right_.height()));
+  Float4 widths, heights;
+  LoadRadii(*this, widths, heights);
+  const Float4 minimum = {minimum_radius, minimum_radius, minimum_radius,
+                          minimum_radius};
+  StoreRadii(Max(minimum, widths), Max(minimum, heights), *this);
 }
 
 std::optional<float> FloatRoundedRect::Radii::UniformRadius() const {
-  if (top_left_.width() == top_left_.height() && top_left_ == top_right_ &&
-      top_left_ == bottom_left_ && top_left_ == bottom_right_) {
-    return top_left_.width();
+  Float4 widths, heights;
+  LoadRadii(*this, widths, heights);
+  const float radius = widths[0];
+  if (AllTrue((widths == radius) & (heights == radius))) {
+    return radius;
   }
   return std::nullopt;
 }
@@ -97,38 +233,28 @@ void FloatRoundedRect::Radii::Scale(float factor) {
   if (factor == 1)
     return;
 
+  Float4 widths, heights;
+  LoadRadii(*this, widths, heights);
+  widths *= factor;
+  heights *= factor;
+  const Float4 zeros = {0, 0, 0, 0};
+  widths = widths > kTrivialRadius ? widths : zeros;
+  heights = heights > kTrivialRadius ? heights : zeros;
   // If either radius on a corner becomes zero, reset both radii on that corner.
-  top_left_.Scale(factor);
-  if (!top_left_.width() || !top_left_.height())
-    top_left_ = gfx::SizeF();
-  top_right_.Scale(factor);
-  if (!top_right_.width() || !top_right_.height())
-    top_right_ = gfx::SizeF();
-  bottom_left_.Scale(factor);
-  if (!bottom_left_.width() || !bottom_left_.height())
-    bottom_left_ = gfx::SizeF();
-  bottom_right_.Scale(factor);
-  if (!bottom_right_.width() || !bottom_right_.height())
-    bottom_right_ = gfx::SizeF();
+  const FloatBoolean4 zero = (widths == zeros) | (heights == zeros);
+  StoreRadii(zero ? zeros : widths, zero ? zeros : heights, *this);
 }
 
 void FloatRoundedRect::Radii::Outset(const gfx::OutsetsF& outsets) {
-  if (top_left_.width() > 0)
-    top_left_.set_width(top_left_.width() + outsets.left());
-  if (top_left_.height() > 0)
-    top_left_.set_height(top_left_.height() + outsets.top());
-  if (top_right_.width() > 0)
-    top_right_.set_width(top_right_.width() + outsets.right());
-  if (top_right_.height() > 0)
-    top_right_.set_height(top_right_.height() + outsets.top());
-  if (bottom_left_.width() > 0)
-    bottom_left_.set_width(bottom_left_.width() + outsets.left());
-  if (bottom_left_.height() > 0)
-    bottom_left_.set_height(bottom_left_.height() + outsets.bottom());
-  if (bottom_right_.width() > 0)
-    bottom_right_.set_width(bottom_right_.width() + outsets.right());
-  if (bottom_right_.height() > 0)
-    bottom_right_.set_height(bottom_right_.height() + outsets.bottom());
+  Float4 widths, heights;
+  LoadRadii(*this, widths, heights);
+  const Float4 outsets_x = {outsets.left(), outsets.right(), outsets.left(),
+                            outsets.right()};
+  const Float4 outsets_y = {outsets.top(), outsets.top(), outsets.bottom(),
+                            outsets.bottom()};
+  // Zero radii are kept zero, so that sharp corners stay sharp.
+  StoreRadii(widths > 0.f ? widths + outsets_x : widths,
+             heights > 0.f ? heights + outsets_y : heights, *this);
 }
 
 // From: https://drafts.csswg.org/css-backgrounds-3/#corner-shaping
@@ -238,11 +364,9 @@ void FloatRoundedRect::Radii::OutsetForShapeMargin(float outset) {
   // corners (that is, corners that have x and y radii that are not
   // equal).  But it's not clear to me if the correct result for that
   // case is even an ellipse.
-  gfx::SizeF outset_size(outset, outset);
-  top_left_ += outset_size;
-  top_right_ += outset_size;
-  bottom_left_ += outset_size;
-  bottom_right_ += outset_size;
+  Float4 widths, heights;
+  LoadRadii(*this, widths, heights);
+  StoreRadii(widths + outset, heights + outset, *this);
 }
 
 void FloatRoundedRect::Outset(const gfx::OutsetsF& outsets) {
@@ -281,56 +405,66 @@ bool FloatRoundedRect::IntersectsQuad(const gfx::QuadF& quad) const {
 
   // For each corner, first check the remaining (two) separating axes of the
   // rectangle that encloses the corner. The other (two) axes coincide with the
-  // axes of `rect_`. If none of those are separating, proceed to call
+  // axes of `rect_`. That is done for all the corners at once, and only the
+  // corners for which none of those are separating proceed to call
   // IntersectsRectPartial to check the potential axes of `quad`.
-
-  if (!radii_.TopLeft().IsEmpty()) {
-    const gfx::RectF corner_rect(TopLeftCorner());
-    if (quad_min.y() <= corner_rect.bottom() &&
-        quad_min.x() <= corner_rect.right() &&
-        quad.IntersectsRectPartial(corner_rect)) {
-      if (!quad.IntersectsEllipse(corner_rect.bottom_right(),
-                                  corner_rect.size())) {
-        return false;
-      }
-    }
+  Float4 center_x, center_y, radius_x, radius_y;
+  GetCornerEllipses(*this, center_x, center_y, radius_x, radius_y);
+  const Float4 near_x = {quad_min.x(), quad_max.x(), quad_min.x(),
+                         quad_max.x()};
+  const Float4 near_y = {quad_min.y(), quad_min.y(), quad_max.y(),
+                         quad_max.y()};
+  const FloatBoolean4 candidates = (radius_x > 0.f) & (radius_y > 0.f) &
+                                   ((near_x - center_x) * kCornerSignX >= 0.f) &
+                                   ((near_y - center_y) * kCornerSignY >= 0.f);
+  if (AllTrue(candidates == 0)) {
+    return true;
   }
 
-  if (!radii_.TopRight().IsEmpty()) {
-    const gfx::RectF corner_rect(TopRightCorner());
-    if (quad_min.y() <= corner_rect.bottom() &&
-        quad_max.x() >= corner_rect.x() &&
-        quad.IntersectsRectPartial(corner_rect)) {
-      if (!quad.IntersectsEllipse(corner_rect.bottom_left(),
-                                  corner_rect.size())) {
-        return false;
-      }
+  const std::array<gfx::RectF, 4> corner_rects = {
+      TopLeftCorner(), TopRightCorner(), BottomLeftCorner(),
+      BottomRightCorner()};
+  for (int i = 0; i < 4; ++i) {
+    if (candidates[i] && quad.IntersectsRectPartial(corner_rects[i]) &&
+        !quad.IntersectsEllipse(gfx::PointF(center_x[i], center_y[i]),
+                                corner_rects[i].size())) {
+      return false;
     }
   }
 
-  if (!radii_.BottomLeft().IsEmpty()) {
-    const gfx::RectF corner_rect(BottomLeftCorner());
-    if (quad_max.y() >= corner_rect.y() &&
-        quad_min.x() <= corner_rect.right() &&
-        quad.IntersectsRectPartial(corner_rect)) {
-      if (!quad.IntersectsEllipse(corner_rect.top_right(),
-                                  corner_rect.size())) {
-        return false;
-      }
-    }
+  return true;
+}
+
+bool FloatRoundedRect::Contains(const gfx::PointF& point) const {
+  if (!IsRounded()) {
+    return RectContains(rect_, point);
   }
+  Float4 center_x, center_y, radius_x, radius_y;
+  GetCornerEllipses(*this, center_x, center_y, radius_x, radius_y);
+  return RectContains(rect_, point) &&
+         CornersContain(center_x, center_y, radius_x * radius_x,
+                        radius_y * radius_y, point);
+}
 
-  if (!radii_.BottomRight().IsEmpty()) {
-    const gfx::RectF corner_rect(BottomRightCorner());
-    if (quad_max.y() >= corner_rect.y() && quad_max.x() >= corner_rect.x() &&
-        quad.IntersectsRectPartial(corner_rect)) {
-      if (!quad.IntersectsEllipse(corner_rect.origin(), corner_rect.size())) {
-        return false;
-      }
+void FloatRoundedRect::ContainsMany(base::span<const gfx::PointF> points,
+                                    base::span<bool> results) const {
+  CHECK_EQ(points.size(), results.size());
+  if (!IsRounded()) {
+    for (size_t i = 0; i < points.size(); ++i) {
+      results[i] = RectContains(rect_, points[i]);
     }
+    return;
+  }
+  // The corner ellipses are computed once for all the points.
+  Float4 center_x, center_y, radius_x, radius_y;
+  GetCornerEllipses(*this, center_x, center_y, radius_x, radius_y);
+  const Float4 radius_x_squared = radius_x * radius_x;
+  const Float4 radius_y_squared = radius_y * radius_y;
+  for (size_t i = 0; i < points.size(); ++i) {
+    results[i] = RectContains(rect_, points[i]) &&
+                 CornersContain(center_x, center_y, radius_x_squared,
+                                radius_y_squared, points[i]);
   }
-
-  return true;
 }
 
 void FloatRoundedRect::ConstrainRadii() {
@@ -353,6 +487,68 @@ void FloatRoundedRect::ConstrainRadii() {
   DCHECK(IsRenderable());
 }
 
+// static
+void FloatRoundedRect::ConstrainRadiiMany(base::span<FloatRoundedRect> rects) {
+  static constexpr std::array<gfx::SizeF Radii::*, 4> kCorners = {
+      &Radii::top_left_, &Radii::top_right_, &Radii::bottom_left_,
+      &Radii::bottom_right_};
+  constexpr size_t kLanes = 4;
+
+  size_t begin = 0;
+  for (; begin + kLanes <= rects.size(); begin += kLanes) {
+    base::span<FloatRoundedRect> batch = rects.subspan(begin, kLanes);
+    // Each lane has one of the rects, and each vector of radii one corner.
+    Float4 width;
+    Float4 height;
+    std::array<Float4, 4> radius_x;
+    std::array<Float4, 4> radius_y;
+    for (size_t i = 0; i < kLanes; ++i) {
+      width[i] = batch[i].rect_.width();
+      height[i] = batch[i].rect_.height();
+      for (size_t corner = 0; corner < kCorners.size(); ++corner) {
+        const gfx::SizeF& radius = batch[i].radii_.*kCorners[corner];
+        radius_x[corner][i] = radius.width();
+        radius_y[corner][i] = radius.height();
+      }
+    }
+
+    // The same computation as ConstrainRadii().
+    const Float4 horizontal_sum =
+        Max(radius_x[0] + radius_x[1], radius_x[2] + radius_x[3]);
+    const Float4 vertical_sum =
+        Max(radius_y[0] + radius_y[2], radius_y[1] + radius_y[3]);
+    Float4 factor = {1, 1, 1, 1};
+    factor = horizontal_sum > width ? Min(width / horizontal_sum, factor)
+                                    : factor;
+    factor =
+        vertical_sum > height ? Min(height / vertical_sum, factor) : factor;
+    for (size_t corner = 0; corner < kCorners.size(); ++corner) {
+      radius_x[corner] *= factor;
+      radius_y[corner] *= factor;
+    }
+
+    // As in Radii::Scale(), the radii of rects with a factor of 1 are kept
+    // as they are, and corners with a trivial radius are cleared.
+    for (size_t i = 0; i < kLanes; ++i) {
+      DCHECK_LE(factor[i], 1);
+      if (factor[i] != 1) {
+        for (size_t corner = 0; corner < kCorners.size(); ++corner) {
+          gfx::SizeF radius(radius_x[corner][i], radius_y[corner][i]);
+          if (!radius.width() || !radius.height()) {
+            radius = gfx::SizeF();
+          }
+          batch[i].radii_.*kCorners[corner] = radius;
+        }
+      }
+      DCHECK(batch[i].IsRenderable());
+    }
+  }
+
+  for (FloatRoundedRect& rect : rects.subspan(begin)) {
+    rect.ConstrainRadii();
+  }
+}
+
 bool FloatRoundedRect::IsRenderable() const {
   constexpr float kTolerance = 1.0001;
   return radii_.TopLeft().width() + radii_.TopRight().width() <=
@@ -365,6 +561,45 @@ bool FloatRoundedRect::IsRenderable() const {
              rect_.height() * kTolerance;
 }
 
+FloatRoundedRectIntersection IntersectRoundedRects(const FloatRoundedRect& a,
+                                                   const FloatRoundedRect& b) {
+  gfx::RectF rect = gfx::IntersectRects(a.Rect(), b.Rect());
+  if (rect.IsEmpty()) {
+    return {FloatRoundedRect(), /*is_exact=*/true};
+  }
+  FloatRoundedRect constrained_a = a;
+  FloatRoundedRect constrained_b = b;
+  constrained_a.ConstrainRadii();
+  constrained_b.ConstrainRadii();
+
+  // The intersection is the rect without the parts of the corner ellipses of
+  // each rounded rect in it. Each corner gets the bigger radii of those that
+  // contain the parts at that corner, which can only make the result smaller,
+  // and that's exact if one of them is the only part or contains the other.
+  Float4 radius_x_a, radius_y_a, radius_x_b, radius_y_b;
+  FloatBoolean4 at_corner_a, at_corner_b;
+  GetCornerEllipsesIn(constrained_a, rect, radius_x_a, radius_y_a,
+                      at_corner_a);
+  GetCornerEllipsesIn(constrained_b, rect, radius_x_b, radius_y_b,
+                      at_corner_b);
+  const Float4 radius_x = Max(radius_x_a, radius_x_b);
+  const Float4 radius_y = Max(radius_y_a, radius_y_b);
+  const FloatBoolean4 exact =
+      ((radius_x == 0.f) & (radius_y == 0.f)) |
+      (at_corner_a & (radius_x == radius_x_a) & (radius_y == radius_y_a)) |
+      (at_corner_b & (radius_x == radius_x_b) & (radius_y == radius_y_b));
+
+  FloatRoundedRect result(rect);
+  FloatRoundedRect::Radii radii;
+  StoreRadii(radius_x, radius_y, radii);
+  result.SetRadii(radii);
+  if (!result.IsRenderable()) {
+    // Constraining the radii would uncover parts outside |a| or |b|.
+    return {FloatRoundedRect(), /*is_exact=*/false};
+  }
+  return {result, static_cast<bool>(AllTrue(exact != 0))};
+}
+
 std::ostream& operator<<(std::ostream& ostream, const FloatRoundedRect& rect) {
   return ostream << rect.ToString();
 }
@@ -31,9 +31,11 @@
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_FLOAT_ROUNDED_RECT_H_
 
 #include <array>
+#include <bit>
 #include <iosfwd>
 #include <optional>
 
+#include "base/containers/span.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
@@ -46,6 +48,7 @@
 #include "ui/gfx/geometry/skia_conversions.h"
 
 namespace gfx {
+class PointF;
 class QuadF;
 }
 
@@ -82,8 +85,8 @@ class PLATFORM_EXPORT FloatRoundedRect {
                     const gfx::SizeF& bottom_right)
         : top_left_(top_left),
           top_right_(top_right),
-          bottom_left_(bottom_left),
-          bottom_right_(bottom_right) {}
+          bottom_right_(bottom_right),
+          bottom_left_(bottom_left) {}
     explicit constexpr Radii(float radius) : Radii(radius, radius) {}
     constexpr Radii(float radius_x, float radius_y)
         : Radii(gfx::SizeF(radius_x, radius_y),
@@ -115,6 +118,15 @@ class PLATFORM_EXPORT FloatRoundedRect {
     String ToString() const;
     void Scale(float factor);
 
+    // The radii in the corner order of SkRRect, as plain copies of the
+    // storage, which has the same layout.
+    constexpr std::array<SkVector, 4> ToSkVectors() const {
+      return std::bit_cast<std::array<SkVector, 4>>(*this);
+    }
+    static constexpr Radii FromSkVectors(const std::array<SkVector, 4>& radii) {
+      return std::bit_cast<Radii>(radii);
+    }
+
    private:
     friend class FloatRoundedRect;
     void Outset(const gfx::OutsetsF& outsets);
@@ -124,18 +136,20 @@ class PLATFORM_EXPORT FloatRoundedRect {
         const gfx::SizeF& box_size);
     void OutsetForShapeMargin(float outset);
 
+    // In the corner order of SkRRect, for ToSkVectors() and FromSkVectors().
     gfx::SizeF top_left_;
     gfx::SizeF top_right_;
-    gfx::SizeF bottom_left_;
     gfx::SizeF bottom_right_;
+    gfx::SizeF bottom_left_;
   };
 
   constexpr FloatRoundedRect() = default;
   explicit FloatRoundedRect(const gfx::RectF&, const Radii& radii = Radii());
   explicit FloatRoundedRect(const gfx::Rect&, const Radii& radii = Radii());
-  explicit FloatRoundedRect(const SkRRect& r)
-      : FloatRoundedRect(gfx::RRectF(r)) {}
-  explicit FloatRoundedRect(const gfx::RRectF&);
+  // The radii of SkRRect are already constrained, and are copied as is.
+  explicit FloatRoundedRect(const SkRRect&);
+  explicit FloatRoundedRect(const gfx::RRectF& r)
+      : FloatRoundedRect(SkRRect(r)) {}
   constexpr bool operator==(const FloatRoundedRect&) const = default;
   FloatRoundedRect(float x, float y, float width, float height);
   FloatRoundedRect(const gfx::RectF& rect,
@@ -206,6 +220,14 @@ class PLATFORM_EXPORT FloatRoundedRect {
   // intersecting area is empty (i.e., the intersection is a line or a point).
   bool IntersectsQuad(const gfx::QuadF&) const;
 
+  // Tests whether the point is in this rounded rectangle, edges included.
+  // The four corner ellipses are tested together.
+  bool Contains(const gfx::PointF&) const;
+  // Sets each of |results| to Contains() of the point at the same index of
+  // |points|, which must have the same size.
+  void ContainsMany(base::span<const gfx::PointF> points,
+                    base::span<bool> results) const;
+
   // Whether the radii are constrained in the size of rect().
   bool IsRenderable() const;
 
@@ -215,6 +237,9 @@ class PLATFORM_EXPORT FloatRoundedRect {
   // that is shrunk from a rounded outer border edge to keep uniform width of
   // the rounded border.
   void ConstrainRadii();
+  // Same as ConstrainRadii() on each of |rects|. Their scale factors are
+  // computed a few rects at a time.
+  static void ConstrainRadiiMany(base::span<FloatRoundedRect> rects);
 
   explicit operator SkRRect() const;
   explicit operator gfx::RRectF() const { return gfx::RRectF(SkRRect(*this)); }
@@ -226,25 +251,33 @@ class PLATFORM_EXPORT FloatRoundedRect {
   Radii radii_;
 };
 
+// The result of IntersectRoundedRects().
+struct FloatRoundedRectIntersection {
+  DISALLOW_NEW();
+
+  FloatRoundedRect rect;
+  // Whether |rect| is the intersection, rather than a rounded rect inside it.
+  bool is_exact = false;
+};
+
+// Returns the intersection of two rounded rects, which is exact if one
+// contains the other, or if each corner of the intersection is sharp or comes
+// from one of them. Otherwise it's a rounded rect inside the intersection,
+// which is empty if the corners of the intersection can't be rounded enough.
+// The radii of |a| and |b| are constrained as in ConstrainRadii().
+PLATFORM_EXPORT FloatRoundedRectIntersection
+IntersectRoundedRects(const FloatRoundedRect& a, const FloatRoundedRect& b);
+
 inline FloatRoundedRect::operator SkRRect() const {
   SkRRect rrect;
-
   if (IsRounded()) {
-    std::array<SkVector, 4> radii;
-    radii[SkRRect::kUpperLeft_Corner].set(TopLeftCorner().width(),
-                                          TopLeftCorner().height());
-    radii[SkRRect::kUpperRight_Corner].set(TopRightCorner().width(),
-                                           TopRightCorner().height());
-    radii[SkRRect::kLowerRight_Corner].set(BottomRightCorner().width(),
-                                           BottomRightCorner().height());
-    radii[SkRRect::kLowerLeft_Corner].set(BottomLeftCorner().width(),
-                                          BottomLeftCorner().height());
-
-    rrect.setRectRadii(gfx::RectFToSkRect(Rect()), radii.data());
+    // SkRRect validates and constrains the radii here in any case, so this
+    // doesn't call ConstrainRadii() first.
+    rrect.setRectRadii(gfx::RectFToSkRect(Rect()),
+                       radii_.ToSkVectors().data());
   } else {
     rrect.setRect(gfx::RectFToSkRect(Rect()));
   }
-
   return rrect;
 }
 
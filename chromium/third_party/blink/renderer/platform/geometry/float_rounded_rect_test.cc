@@ -29,9 +29,13 @@
 
 #include "third_party/blink/renderer/platform/geometry/float_rounded_rect.h"
 
+#include <array>
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/platform/geometry/infinite_int_rect.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/quad_f.h"
 #include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/test/geometry_util.h"
@@ -134,6 +138,40 @@ TEST(FloatRoundedrectTest, ConstrainRadii) {
   EXPECT_TRUE(r7.IsRenderable());
 }
 
+TEST(FloatRoundedRectTest, ConstrainRadiiMany) {
+  // More than one batch, with a few rects left over, and rects that are
+  // already constrained, that need to be, and whose radii become trivial.
+  const gfx::RectF rect(-100, -100, 200, 200);
+  std::vector<FloatRoundedRect> rects = {
+      FloatRoundedRect(),
+      FloatRoundedRect(rect),
+      FloatRoundedRect(rect, 10),
+      FloatRoundedRect(rect, 160),
+      FloatRoundedRect(rect, gfx::SizeF(10, 20), gfx::SizeF(100, 250),
+                       gfx::SizeF(200, 60), gfx::SizeF(50, 150)),
+      FloatRoundedRect(rect, gfx::SizeF(10, 20), gfx::SizeF(60, 200),
+                       gfx::SizeF(250, 100), gfx::SizeF(150, 50)),
+      FloatRoundedRect(gfx::RectF(0, 0, 85089, 21377),
+                       gfx::SizeF(1388.89, 1388.89),
+                       gfx::SizeF(58711.2, 14750.3), gfx::SizeF(0, 13467.7),
+                       gfx::SizeF(85088.6, 21377.3)),
+      FloatRoundedRect(gfx::RectF(0, 0, 1, 1), gfx::SizeF(1e-6, 1e6),
+                       gfx::SizeF(), gfx::SizeF(), gfx::SizeF()),
+      FloatRoundedRect(gfx::RectF(5, 5, 0, 10), 5),
+      FloatRoundedRect(gfx::RectF(0, 0, 30, 10), 7),
+  };
+  std::vector<FloatRoundedRect> expected = rects;
+  for (FloatRoundedRect& r : expected) {
+    r.ConstrainRadii();
+  }
+
+  FloatRoundedRect::ConstrainRadiiMany(rects);
+  ASSERT_EQ(expected.size(), rects.size());
+  for (size_t i = 0; i < rects.size(); ++i) {
+    EXPECT_EQ(expected[i], rects[i]) << i;
+  }
+}
+
 TEST(FloatRoundedRectTest, OutsetRect) {
   FloatRoundedRect r(gfx::RectF(0, 0, 100, 100));
   r.Outset(gfx::OutsetsF().set_top(1).set_right(2).set_bottom(3).set_left(4));
@@ -151,6 +189,34 @@ TEST(FloatRoundedRectTest, InsetRect) {
   EXPECT_EQ(FloatRoundedRect(gfx::RectF(0, 0, 100, 100)), r);
 }
 
+TEST(FloatRoundedRectTest, RadiiScale) {
+  FloatRoundedRect::Radii radii(gfx::SizeF(10, 20), gfx::SizeF(1e-6, 30),
+                                gfx::SizeF(), gfx::SizeF(40, 50));
+  radii.Scale(0.5);
+  // The top-right width becomes trivial, so that corner becomes sharp.
+  EXPECT_EQ(FloatRoundedRect::Radii(gfx::SizeF(5, 10), gfx::SizeF(),
+                                    gfx::SizeF(), gfx::SizeF(20, 25)),
+            radii);
+}
+
+TEST(FloatRoundedRectTest, RadiiSetMinimumRadius) {
+  FloatRoundedRect::Radii radii(gfx::SizeF(10, 2), gfx::SizeF(3, 30),
+                                gfx::SizeF(), gfx::SizeF(40, 50));
+  radii.SetMinimumRadius(5);
+  EXPECT_EQ(FloatRoundedRect::Radii(gfx::SizeF(10, 5), gfx::SizeF(5, 30),
+                                    gfx::SizeF(5, 5), gfx::SizeF(40, 50)),
+            radii);
+}
+
+TEST(FloatRoundedRectTest, RadiiUniformRadius) {
+  EXPECT_EQ(7, FloatRoundedRect::Radii(7).UniformRadius());
+  EXPECT_EQ(0, FloatRoundedRect::Radii().UniformRadius());
+  EXPECT_FALSE(FloatRoundedRect::Radii(7, 8).UniformRadius());
+  FloatRoundedRect::Radii radii(7);
+  radii.SetBottomRight(gfx::SizeF(7, 6));
+  EXPECT_FALSE(radii.UniformRadius());
+}
+
 TEST(FloatRoundedRectTest, OutsetWithRadii) {
   FloatRoundedRect r(gfx::RectF(0, 0, 100, 100), gfx::SizeF(5, 10),
                      gfx::SizeF(15, 20), gfx::SizeF(0, 30), gfx::SizeF(35, 0));
@@ -267,6 +333,108 @@ TEST(FloatRoundedRectTest, IntersectsQuadEnclosing) {
   EXPECT_TRUE(r.IntersectsQuad(crossing_corners));
 }
 
+TEST(FloatRoundedRectTest, Contains) {
+  FloatRoundedRect r(gfx::RectF(0, 0, 100, 100), gfx::SizeF(10, 20),
+                     gfx::SizeF(30, 10), gfx::SizeF(), gfx::SizeF(40, 40));
+  struct {
+    gfx::PointF point;
+    bool contains;
+  } cases[] = {
+      {gfx::PointF(50, 50), true},   {gfx::PointF(100, 50), true},
+      {gfx::PointF(101, 50), false}, {gfx::PointF(0, 0), false},
+      {gfx::PointF(2, 2), false},    {gfx::PointF(5, 5), true},
+      {gfx::PointF(99, 1), false},   {gfx::PointF(80, 5), true},
+      {gfx::PointF(0, 100), true},   {gfx::PointF(90, 90), false},
+      {gfx::PointF(85, 85), true},   {gfx::PointF(-1, 50), false},
+  };
+  std::vector<gfx::PointF> points;
+  for (const auto& test : cases) {
+    SCOPED_TRACE(test.point.ToString());
+    EXPECT_EQ(test.contains, r.Contains(test.point));
+    points.push_back(test.point);
+  }
+
+  std::array<bool, std::size(cases)> results;
+  r.ContainsMany(points, results);
+  for (size_t i = 0; i < std::size(cases); ++i) {
+    EXPECT_EQ(cases[i].contains, results[i]) << points[i].ToString();
+  }
+
+  FloatRoundedRect sharp(gfx::RectF(0, 0, 100, 100));
+  EXPECT_TRUE(sharp.Contains(gfx::PointF(0, 0)));
+  EXPECT_TRUE(sharp.Contains(gfx::PointF(100, 100)));
+  EXPECT_FALSE(sharp.Contains(gfx::PointF(100, 101)));
+}
+
+TEST(FloatRoundedRectTest, IntersectsQuadWithDifferentCorners) {
+  FloatRoundedRect r(gfx::RectF(0, 0, 100, 100), gfx::SizeF(10, 20),
+                     gfx::SizeF(30, 10), gfx::SizeF(), gfx::SizeF(40, 40));
+  // Only in the bounds of the top-left and bottom-right corners.
+  EXPECT_FALSE(r.IntersectsQuad(gfx::QuadF(gfx::RectF(0, 0, 2, 2))));
+  EXPECT_FALSE(r.IntersectsQuad(gfx::QuadF(gfx::RectF(90, 90, 10, 10))));
+  // Reaching into the corner ellipses.
+  EXPECT_TRUE(r.IntersectsQuad(gfx::QuadF(gfx::RectF(0, 0, 5, 5))));
+  EXPECT_TRUE(r.IntersectsQuad(gfx::QuadF(gfx::RectF(85, 85, 15, 15))));
+  // The bottom-left corner is sharp.
+  EXPECT_TRUE(r.IntersectsQuad(gfx::QuadF(gfx::RectF(-1, 99, 2, 2))));
+}
+
+TEST(FloatRoundedRectTest, IntersectRoundedRects) {
+  const FloatRoundedRect outer(gfx::RectF(0, 0, 100, 100), 20);
+
+  // Nested rounded rects.
+  FloatRoundedRect inner(gfx::RectF(10, 10, 50, 50), 5);
+  FloatRoundedRectIntersection result = IntersectRoundedRects(outer, inner);
+  EXPECT_TRUE(result.is_exact);
+  EXPECT_EQ(inner, result.rect);
+  result = IntersectRoundedRects(inner, outer);
+  EXPECT_TRUE(result.is_exact);
+  EXPECT_EQ(inner, result.rect);
+
+  // The same rect, with the bigger radii at each corner.
+  FloatRoundedRect same_rect(
+      gfx::RectF(0, 0, 100, 100), gfx::SizeF(30, 30), gfx::SizeF(10, 10),
+      gfx::SizeF(), gfx::SizeF(20, 20));
+  result = IntersectRoundedRects(outer, same_rect);
+  EXPECT_TRUE(result.is_exact);
+  EXPECT_EQ(FloatRoundedRect(gfx::RectF(0, 0, 100, 100), gfx::SizeF(30, 30),
+                             gfx::SizeF(20, 20), gfx::SizeF(20, 20),
+                             gfx::SizeF(20, 20)),
+            result.rect);
+
+  // Radii that don't contain each other give the bigger of each.
+  result = IntersectRoundedRects(
+      FloatRoundedRect(gfx::RectF(0, 0, 100, 100), 20, 10),
+      FloatRoundedRect(gfx::RectF(0, 0, 100, 100), 10, 20));
+  EXPECT_FALSE(result.is_exact);
+  EXPECT_EQ(FloatRoundedRect(gfx::RectF(0, 0, 100, 100), 20), result.rect);
+
+  // Overlapping rounded rects. The corners at the top right and bottom left
+  // are cut by corners of |outer| and |offset| that are outside the
+  // intersection, so they get smaller radii.
+  FloatRoundedRect offset(gfx::RectF(50, 10, 100, 100), 20);
+  result = IntersectRoundedRects(outer, offset);
+  EXPECT_FALSE(result.is_exact);
+  EXPECT_EQ(FloatRoundedRect(gfx::RectF(50, 10, 50, 90), gfx::SizeF(20, 20),
+                             gfx::SizeF(20, 10), gfx::SizeF(20, 10),
+                             gfx::SizeF(20, 20)),
+            result.rect);
+
+  // Corners of one rect that are in the other rect are exact.
+  result = IntersectRoundedRects(
+      outer, FloatRoundedRect(gfx::RectF(50, 50, 100, 100), 10));
+  EXPECT_TRUE(result.is_exact);
+  EXPECT_EQ(FloatRoundedRect(gfx::RectF(50, 50, 50, 50), gfx::SizeF(10, 10),
+                             gfx::SizeF(), gfx::SizeF(), gfx::SizeF(20, 20)),
+            result.rect);
+
+  // Disjoint rects.
+  result = IntersectRoundedRects(
+      outer, FloatRoundedRect(gfx::RectF(200, 0, 100, 100), 20));
+  EXPECT_TRUE(result.is_exact);
+  EXPECT_TRUE(result.rect.IsEmpty());
+}
+
 TEST(FloatRoundedRectTest, Conversion) {
   FloatRoundedRect r(gfx::RectF(100, 200, 300, 400), gfx::SizeF(5, 6),
                      gfx::SizeF(7, 8), gfx::SizeF(9, 10), gfx::SizeF(11, 12));
@@ -276,6 +444,33 @@ TEST(FloatRoundedRectTest, Conversion) {
   EXPECT_EQ(r, FloatRoundedRect(sk_r));
 }
 
+TEST(FloatRoundedRectTest, ConversionCorners) {
+  const FloatRoundedRect::Radii radii(gfx::SizeF(1, 2), gfx::SizeF(3, 4),
+                                      gfx::SizeF(5, 6), gfx::SizeF(7, 8));
+  const std::array<SkVector, 4> sk_radii = radii.ToSkVectors();
+  EXPECT_EQ(SkVector::Make(1, 2), sk_radii[SkRRect::kUpperLeft_Corner]);
+  EXPECT_EQ(SkVector::Make(3, 4), sk_radii[SkRRect::kUpperRight_Corner]);
+  EXPECT_EQ(SkVector::Make(7, 8), sk_radii[SkRRect::kLowerRight_Corner]);
+  EXPECT_EQ(SkVector::Make(5, 6), sk_radii[SkRRect::kLowerLeft_Corner]);
+  EXPECT_EQ(radii, FloatRoundedRect::Radii::FromSkVectors(sk_radii));
+
+  FloatRoundedRect r(gfx::RectF(0, 0, 100, 100), radii);
+  SkRRect sk_r(r);
+  EXPECT_EQ(SkVector::Make(5, 6), sk_r.radii(SkRRect::kLowerLeft_Corner));
+  EXPECT_EQ(r, FloatRoundedRect(sk_r));
+
+  // Unconstrained radii are constrained by SkRRect.
+  r.SetRadii(FloatRoundedRect::Radii(100));
+  EXPECT_EQ(FloatRoundedRect(gfx::RectF(0, 0, 100, 100), 50),
+            FloatRoundedRect(SkRRect(r)));
+
+  // Radii that gfx::SizeF clamps to zero.
+  SkRRect tiny;
+  const SkVector tiny_radii[4] = {{1e-7f, 1e-7f}, {1, 1}, {1, 1}, {1, 1}};
+  tiny.setRectRadii(SkRect::MakeWH(10, 10), tiny_radii);
+  EXPECT_EQ(gfx::SizeF(), FloatRoundedRect(tiny).GetRadii().TopLeft());
+}
+
 TEST(FloatRoundedRectTest, ToString) {
   gfx::SizeF corner_rect(1, 2);
   FloatRoundedRect rounded_rect(
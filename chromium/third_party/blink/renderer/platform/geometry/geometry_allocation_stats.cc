@@ -0,0 +1,121 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/geometry_allocation_stats.h"
+
+#include <atomic>
+#include <numeric>
+
+#include "third_party/blink/renderer/platform/geometry/calculation_expression_node.h"
+#include "third_party/blink/renderer/platform/transforms/transform_operation.h"
+
+namespace blink {
+
+static_assert(GeometryAllocationStats::kNumTransformOperationTypes ==
+              TransformOperation::kRotateAroundOrigin + 1u);
+static_assert(GeometryAllocationStats::kNumCalculationOperators ==
+              static_cast<size_t>(CalculationOperator::kRandom) + 1u);
+
+namespace {
+
+struct Counters {
+  std::array<std::atomic<uint64_t>,
+             GeometryAllocationStats::kNumTransformOperationTypes>
+      transform_operations;
+  std::array<std::atomic<uint64_t>,
+             GeometryAllocationStats::kNumCalculationOperators>
+      calculation_operations;
+  std::atomic<uint64_t> calculation_numbers;
+  std::atomic<uint64_t> calculation_pixels_and_percents;
+  std::atomic<uint64_t> calculation_values;
+};
+
+// Constant-initialized to zeros, so that it can be used at any time.
+constinit Counters g_counters;
+
+void Increment(std::atomic<uint64_t>& counter) {
+  counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t Load(const std::atomic<uint64_t>& counter) {
+  return counter.load(std::memory_order_relaxed);
+}
+
+}  // namespace
+
+uint64_t GeometryAllocationStats::Snapshot::TotalTransformOperations() const {
+  return std::accumulate(transform_operations.begin(),
+                         transform_operations.end(), uint64_t{0});
+}
+
+uint64_t GeometryAllocationStats::Snapshot::TotalCalculationObjects() const {
+  return std::accumulate(calculation_operations.begin(),
+                         calculation_operations.end(), uint64_t{0}) +
+         calculation_numbers + calculation_pixels_and_percents +
+         calculation_values;
+}
+
+GeometryAllocationStats::Snapshot GeometryAllocationStats::Snapshot::operator-(
+    const Snapshot& earlier) const {
+  Snapshot result;
+  for (size_t i = 0; i < kNumTransformOperationTypes; ++i) {
+    result.transform_operations[i] =
+        transform_operations[i] - earlier.transform_operations[i];
+  }
+  for (size_t i = 0; i < kNumCalculationOperators; ++i) {
+    result.calculation_operations[i] =
+        calculation_operations[i] - earlier.calculation_operations[i];
+  }
+  result.calculation_numbers =
+      calculation_numbers - earlier.calculation_numbers;
+  result.calculation_pixels_and_percents =
+      calculation_pixels_and_percents - earlier.calculation_pixels_and_percents;
+  result.calculation_values = calculation_values - earlier.calculation_values;
+  return result;
+}
+
+// static
+GeometryAllocationStats::Snapshot GeometryAllocationStats::GetSnapshot() {
+  Snapshot snapshot;
+  for (size_t i = 0; i < kNumTransformOperationTypes; ++i) {
+    snapshot.transform_operations[i] = Load(g_counters.transform_operations[i]);
+  }
+  for (size_t i = 0; i < kNumCalculationOperators; ++i) {
+    snapshot.calculation_operations[i] =
+        Load(g_counters.calculation_operations[i]);
+  }
+  snapshot.calculation_numbers = Load(g_counters.calculation_numbers);
+  snapshot.calculation_pixels_and_percents =
+      Load(g_counters.calculation_pixels_and_percents);
+  snapshot.calculation_values = Load(g_counters.calculation_values);
+  return snapshot;
+}
+
+// static
+void GeometryAllocationStats::CountTransformOperation(size_t type) {
+  Increment(g_counters.transform_operations[type]);
+}
+
+// static
+void GeometryAllocationStats::CountCalculationOperation(
+    CalculationOperator op) {
+  Increment(g_counters.calculation_operations[static_cast<size_t>(op)]);
+}
+
+// static
+void GeometryAllocationStats::CountCalculationNumber() {
+  Increment(g_counters.calculation_numbers);
+}
+
+// static
+void GeometryAllocationStats::CountCalculationPixelsAndPercent() {
+  Increment(g_counters.calculation_pixels_and_percents);
+}
+
+// static
+void GeometryAllocationStats::CountCalculationValue() {
+  Increment(g_counters.calculation_values);
+}
+
+}  // namespace blink
@@ -0,0 +1,75 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_GEOMETRY_ALLOCATION_STATS_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_GEOMETRY_ALLOCATION_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "third_party/blink/renderer/platform/platform_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace blink {
+
+enum class CalculationOperator;
+
+// Counts of the GC objects allocated for transform functions and calc()
+// expressions, e.g. by TransformOperations::Blend(), Zoom() and Accumulate()
+// and by CalculationValue::Zoom() and Blend(), for each
+// TransformOperation::OperationType and CalculationOperator. Take a
+// snapshot before and after some work, e.g. an animation frame in a test or a
+// benchmark, and subtract them to get the allocations of the work.
+//
+// The counts are of all the threads, and are relaxed atomic increments on
+// paths that already allocate.
+class PLATFORM_EXPORT GeometryAllocationStats {
+  STATIC_ONLY(GeometryAllocationStats);
+
+ public:
+  // The number of TransformOperation::OperationType values and of
+  // CalculationOperator values.
+  static constexpr size_t kNumTransformOperationTypes = 23;
+  static constexpr size_t kNumCalculationOperators = 32;
+
+  struct PLATFORM_EXPORT Snapshot {
+    DISALLOW_NEW();
+
+    // Indexed by TransformOperation::OperationType.
+    std::array<uint64_t, kNumTransformOperationTypes> transform_operations = {};
+    // CalculationExpressionOperationNodes, indexed by CalculationOperator.
+    std::array<uint64_t, kNumCalculationOperators> calculation_operations = {};
+    uint64_t calculation_numbers = 0;
+    uint64_t calculation_pixels_and_percents = 0;
+    uint64_t calculation_values = 0;
+
+    uint64_t TransformOperationCount(size_t type) const {
+      return transform_operations[type];
+    }
+    uint64_t CalculationOperationCount(CalculationOperator op) const {
+      return calculation_operations[static_cast<size_t>(op)];
+    }
+    uint64_t TotalTransformOperations() const;
+    // All the nodes and values of calc() expressions.
+    uint64_t TotalCalculationObjects() const;
+
+    // The allocations since |earlier|.
+    Snapshot operator-(const Snapshot& earlier) const;
+  };
+
+  static Snapshot GetSnapshot();
+
+  // Called by the constructors of the counted objects.
+  static void CountTransformOperation(size_t type);
+  static void CountCalculationOperation(CalculationOperator op);
+  static void CountCalculationNumber();
+  static void CountCalculationPixelsAndPercent();
+  static void CountCalculationValue();
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_GEOMETRY_ALLOCATION_STATS_H_
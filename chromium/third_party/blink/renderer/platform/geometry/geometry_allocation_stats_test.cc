@@ -0,0 +1,85 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/geometry_allocation_stats.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_expression_node.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_value.h"
+#include "third_party/blink/renderer/platform/transforms/rotate_transform_operation.h"
+#include "third_party/blink/renderer/platform/transforms/scale_transform_operation.h"
+#include "third_party/blink/renderer/platform/transforms/transform_operations.h"
+
+namespace blink {
+
+TEST(GeometryAllocationStatsTest, TransformOperations) {
+  TransformOperations from;
+  from.Operations().push_back(MakeGarbageCollected<ScaleTransformOperation>(
+      1, 2, TransformOperation::kScale));
+  from.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      10, TransformOperation::kRotate));
+  TransformOperations to;
+  to.Operations().push_back(MakeGarbageCollected<ScaleTransformOperation>(
+      3, 4, TransformOperation::kScale));
+  to.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      20, TransformOperation::kRotate));
+
+  const GeometryAllocationStats::Snapshot before =
+      GeometryAllocationStats::GetSnapshot();
+  TransformOperations blended = to.Blend(from, 0.5);
+  ASSERT_EQ(2u, blended.size());
+  const GeometryAllocationStats::Snapshot blend =
+      GeometryAllocationStats::GetSnapshot() - before;
+  EXPECT_EQ(1u, blend.TransformOperationCount(TransformOperation::kScale));
+  EXPECT_EQ(1u, blend.TransformOperationCount(TransformOperation::kRotate));
+  EXPECT_EQ(2u, blend.TotalTransformOperations());
+  EXPECT_EQ(0u, blend.TotalCalculationObjects());
+
+  // Scales and rotations don't depend on the zoom.
+  const GeometryAllocationStats::Snapshot before_zoom =
+      GeometryAllocationStats::GetSnapshot();
+  TransformOperations zoomed = blended.Zoom(2);
+  EXPECT_EQ(0u, (GeometryAllocationStats::GetSnapshot() - before_zoom)
+                    .TotalTransformOperations());
+}
+
+TEST(GeometryAllocationStatsTest, CalculationValues) {
+  const GeometryAllocationStats::Snapshot before =
+      GeometryAllocationStats::GetSnapshot();
+  // max(10px, 20%) + 30px
+  const auto* max = MakeGarbageCollected<CalculationExpressionOperationNode>(
+      CalculationExpressionOperationNode::Children(
+          {MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+               PixelsAndPercent(10, 0, true, false)),
+           MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+               PixelsAndPercent(0, 20, false, true))}),
+      CalculationOperator::kMax);
+  const auto* add = MakeGarbageCollected<CalculationExpressionOperationNode>(
+      CalculationExpressionOperationNode::Children(
+          {max,
+           MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+               PixelsAndPercent(30, 0, true, false))}),
+      CalculationOperator::kAdd);
+  const CalculationValue* value =
+      CalculationValue::CreateSimplified(add, Length::ValueRange::kAll);
+  const GeometryAllocationStats::Snapshot created =
+      GeometryAllocationStats::GetSnapshot() - before;
+  EXPECT_EQ(1u, created.CalculationOperationCount(CalculationOperator::kMax));
+  EXPECT_EQ(1u, created.CalculationOperationCount(CalculationOperator::kAdd));
+  EXPECT_EQ(3u, created.calculation_pixels_and_percents);
+  EXPECT_EQ(1u, created.calculation_values);
+  EXPECT_EQ(6u, created.TotalCalculationObjects());
+  EXPECT_EQ(0u, created.TotalTransformOperations());
+
+  // The zoomed value shares the expression, which is zoomed lazily.
+  const GeometryAllocationStats::Snapshot before_zoom =
+      GeometryAllocationStats::GetSnapshot();
+  value->Zoom(2);
+  const GeometryAllocationStats::Snapshot zoom =
+      GeometryAllocationStats::GetSnapshot() - before_zoom;
+  EXPECT_EQ(1u, zoom.calculation_values);
+  EXPECT_EQ(1u, zoom.TotalCalculationObjects());
+}
+
+}  // namespace blink
@@ -5,59 +5,159 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_GEOMETRY_AS_JSON_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_GEOMETRY_AS_JSON_H_
 
+#include <stddef.h>
+
+#include <array>
+#include <cmath>
 #include <memory>
 
+#include "base/containers/span.h"
 #include "third_party/blink/renderer/platform/json/json_values.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/dtoa.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_view.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/size_f.h"
+#include "ui/gfx/geometry/vector2d_f.h"
 
 namespace blink {
 
+// The numbers of the JSON array of a geometry value, e.g. x, y, width and
+// height for a rect.
+struct GeometryJSONComponents {
+  base::span<const double> values() const {
+    return base::span(storage).first(size);
+  }
+
+  std::array<double, 4> storage;
+  size_t size;
+};
+
 template <typename T>
-static std::unique_ptr<JSONArray> RectAsJSONArray(const T& rect) {
+GeometryJSONComponents RectAsJSONComponents(const T& rect) {
   gfx::RectF rect_f(rect);
-  auto array = std::make_unique<JSONArray>();
-  array->PushDouble(rect.x());
-  array->PushDouble(rect.y());
-  array->PushDouble(rect.width());
-  array->PushDouble(rect.height());
-  return array;
+  return {{rect_f.x(), rect_f.y(), rect_f.width(), rect_f.height()}, 4};
 }
 
 template <typename T>
-std::unique_ptr<JSONArray> PointAsJSONArray(const T& point) {
+GeometryJSONComponents PointAsJSONComponents(const T& point) {
   gfx::PointF point_f(point);
-  auto array = std::make_unique<JSONArray>();
-  array->PushDouble(point_f.x());
-  array->PushDouble(point_f.y());
-  return array;
+  return {{point_f.x(), point_f.y()}, 2};
 }
 
 template <typename T>
-std::unique_ptr<JSONArray> VectorAsJSONArray(const T& vector) {
+GeometryJSONComponents VectorAsJSONComponents(const T& vector) {
   gfx::Vector2dF vector_f(vector);
+  return {{vector_f.x(), vector_f.y()}, 2};
+}
+
+// The z coordinate is omitted if it's 0.
+inline GeometryJSONComponents Point3AsJSONComponents(
+    const gfx::Point3F& point) {
+  return {{point.x(), point.y(), point.z()}, point.z() ? 3u : 2u};
+}
+
+template <typename T>
+GeometryJSONComponents SizeAsJSONComponents(const T& size) {
+  gfx::SizeF size_f(size);
+  return {{size_f.width(), size_f.height()}, 2};
+}
+
+// Streams the JSON arrays of geometry values into a StringBuilder, with the
+// numbers of the JSONArrays of the functions below, e.g. "[0,1.5,10,20]" for
+// RectAsJSONArray(gfx::RectF(0, 1.5, 10, 20)), but without allocating any
+// JSONValues. This is for dumps of many values, e.g. of layer trees for
+// tracing; the caller writes the JSON around the arrays.
+class GeometryJSONWriter {
+  STACK_ALLOCATED();
+
+ public:
+  explicit GeometryJSONWriter(StringBuilder& builder) : builder_(builder) {}
+
+  template <typename T>
+  void WriteRect(const T& rect) {
+    Write(RectAsJSONComponents(rect));
+  }
+  template <typename T>
+  void WritePoint(const T& point) {
+    Write(PointAsJSONComponents(point));
+  }
+  template <typename T>
+  void WriteVector(const T& vector) {
+    Write(VectorAsJSONComponents(vector));
+  }
+  void WritePoint3(const gfx::Point3F& point) {
+    Write(Point3AsJSONComponents(point));
+  }
+  template <typename T>
+  void WriteSize(const T& size) {
+    Write(SizeAsJSONComponents(size));
+  }
+
+  void Write(const GeometryJSONComponents& components) {
+    builder_.Append('[');
+    bool first = true;
+    for (double value : components.values()) {
+      if (!first) {
+        builder_.Append(',');
+      }
+      first = false;
+      WriteDouble(value);
+    }
+    builder_.Append(']');
+  }
+
+  // Writes |value| as the shortest string that converts back to it, which is
+  // formatted into a buffer on the stack, or as null if it isn't finite, as
+  // JSON can't represent it.
+  void WriteDouble(double value) {
+    if (!std::isfinite(value)) {
+      builder_.Append("null");
+      return;
+    }
+    NumberToStringBuffer buffer;
+    builder_.Append(StringView(NumberToString(value, buffer)));
+  }
+
+ private:
+  StringBuilder& builder_;
+};
+
+inline std::unique_ptr<JSONArray> ComponentsAsJSONArray(
+    const GeometryJSONComponents& components) {
   auto array = std::make_unique<JSONArray>();
-  array->PushDouble(vector_f.x());
-  array->PushDouble(vector_f.y());
+  for (double value : components.values()) {
+    array->PushDouble(value);
+  }
   return array;
 }
 
+template <typename T>
+static std::unique_ptr<JSONArray> RectAsJSONArray(const T& rect) {
+  return ComponentsAsJSONArray(RectAsJSONComponents(rect));
+}
+
+template <typename T>
+std::unique_ptr<JSONArray> PointAsJSONArray(const T& point) {
+  return ComponentsAsJSONArray(PointAsJSONComponents(point));
+}
+
+template <typename T>
+std::unique_ptr<JSONArray> VectorAsJSONArray(const T& vector) {
+  return ComponentsAsJSONArray(VectorAsJSONComponents(vector));
+}
+
 inline std::unique_ptr<JSONArray> Point3AsJSONArray(const gfx::Point3F& point) {
-  auto array = std::make_unique<JSONArray>();
-  array->PushDouble(point.x());
-  array->PushDouble(point.y());
-  if (point.z())
-    array->PushDouble(point.z());
-  return array;
+  return ComponentsAsJSONArray(Point3AsJSONComponents(point));
 }
 
 template <typename T>
 std::unique_ptr<JSONArray> SizeAsJSONArray(const T& size) {
-  gfx::SizeF size_f(size);
-  auto array = std::make_unique<JSONArray>();
-  array->PushDouble(size_f.width());
-  array->PushDouble(size_f.height());
-  return array;
+  return ComponentsAsJSONArray(SizeAsJSONComponents(size));
 }
 
 }  // namespace blink
@@ -0,0 +1,49 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/geometry_as_json.h"
+
+#include <limits>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "ui/gfx/geometry/point.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/size.h"
+#include "ui/gfx/geometry/vector2d_f.h"
+
+namespace blink {
+
+TEST(GeometryAsJSONTest, Writer) {
+  StringBuilder builder;
+  GeometryJSONWriter writer(builder);
+  writer.WriteRect(gfx::RectF(0, 1.5, 10, 20));
+  writer.WriteRect(gfx::Rect(-1, 2, 3, 4));
+  writer.WritePoint(gfx::Point(5, -6));
+  writer.WriteVector(gfx::Vector2dF(0.25, 1e10));
+  writer.WritePoint3(gfx::Point3F(1, 2, 0));
+  writer.WritePoint3(gfx::Point3F(1, 2, 3));
+  writer.WriteSize(gfx::Size(7, 8));
+  writer.WriteDouble(std::numeric_limits<double>::infinity());
+  EXPECT_EQ(
+      "[0,1.5,10,20][-1,2,3,4][5,-6][0.25,10000000000][1,2][1,2,3][7,8]null",
+      builder.ToString());
+}
+
+TEST(GeometryAsJSONTest, SameNumbersAsJSONArrays) {
+  const gfx::RectF rect(0.5, -2, 0.125, 400);
+  StringBuilder builder;
+  GeometryJSONWriter(builder).WriteRect(rect);
+  EXPECT_EQ(RectAsJSONArray(rect)->ToJSONString(), builder.ToString());
+
+  const gfx::Point3F point(1.5, -2.5, 3.75);
+  builder.Clear();
+  GeometryJSONWriter(builder).WritePoint3(point);
+  EXPECT_EQ(Point3AsJSONArray(point)->ToJSONString(), builder.ToString());
+}
+
+}  // namespace blink
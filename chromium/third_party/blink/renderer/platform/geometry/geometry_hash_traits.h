@@ -5,12 +5,104 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_GEOMETRY_HASH_TRAITS_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_GEOMETRY_HASH_TRAITS_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "base/numerics/wrapping_math.h"
+#include "base/numerics/wrapping_vec.h"
+#include "third_party/blink/renderer/platform/geometry/contoured_rect.h"
+#include "third_party/blink/renderer/platform/geometry/float_rounded_rect.h"
 #include "third_party/blink/renderer/platform/wtf/hash_traits.h"
 #include "third_party/skia/include/core/SkRect.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/size_f.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/vector2d_f.h"
 
 namespace blink {
 
+namespace geometry_hash_internal {
+
+// Returns the bits of |value|, with -0 as 0 and every NaN as the same one, so
+// that the values that HashTraits<float>::Equal() and
+// HashTraits<double>::Equal() find equal have the same bits.
+template <typename T>
+std::conditional_t<sizeof(T) == 4u, uint32_t, uint64_t> CanonicalBits(
+    T value) {
+  using Bits = std::conditional_t<sizeof(T) == 4u, uint32_t, uint64_t>;
+  if (value == 0) {
+    return 0u;
+  }
+  if (std::isnan(value)) {
+    return std::bit_cast<Bits>(std::numeric_limits<T>::quiet_NaN());
+  }
+  return std::bit_cast<Bits>(value);
+}
+
+// Hashes the floating point |components| of a geometry value in a single
+// pass. The canonical bits of the components are mixed 16 bytes at a time, as
+// the lanes of a vector, which don't depend on each other, instead of in a
+// chain of HashInts(); the lanes are only combined, in order, at the end.
+template <typename T, size_t N>
+  requires(std::is_floating_point_v<T>)
+unsigned HashComponents(const std::array<T, N>& components) {
+  using Bits = std::conditional_t<sizeof(T) == 4u, uint32_t, uint64_t>;
+  constexpr size_t kLanes = 16u / sizeof(T);
+  using Lanes = base::WrappingVec<Bits, kLanes>;
+  // The odd multipliers of Fibonacci hashing, which spread the bits of each
+  // component upwards, while the shifts spread them back down.
+  constexpr Bits kMultiplier = static_cast<Bits>(
+      sizeof(T) == 4u ? uint64_t{0x9e3779b1u} : uint64_t{0x9e3779b97f4a7c15u});
+  constexpr int kHalfBits = std::numeric_limits<Bits>::digits / 2;
+
+  Lanes hash(static_cast<Bits>(N));
+  for (size_t i = 0u; i < N; i += kLanes) {
+    std::array<Bits, kLanes> bits = {};
+    for (size_t lane = 0u; lane < kLanes && i + lane < N; ++lane) {
+      bits[lane] = CanonicalBits(components[i + lane]);
+    }
+    hash = (hash ^ Lanes::Load(bits)) * Lanes(kMultiplier);
+    hash ^= hash >> kHalfBits;
+  }
+
+  std::array<Bits, kLanes> lanes;
+  hash.Store(lanes);
+  Bits combined = 0u;
+  for (Bits lane : lanes) {
+    combined = base::WrappingMul(base::RotateLeft(combined, 5) ^ lane,
+                                 kMultiplier);
+  }
+  // The final mix of MurmurHash3, so that all the bits of the lanes affect
+  // the low bits that hash tables index with.
+  uint32_t result = static_cast<uint32_t>(combined ^ (combined >> kHalfBits));
+  result ^= result >> 16;
+  result = base::WrappingMul(result, 0x85ebca6bu);
+  result ^= result >> 13;
+  result = base::WrappingMul(result, 0xc2b2ae35u);
+  result ^= result >> 16;
+  return result;
+}
+
+// Returns whether each pair of components is equal for HashTraits<T>.
+template <typename T, size_t N>
+bool ComponentsEqual(const std::array<T, N>& a, const std::array<T, N>& b) {
+  for (size_t i = 0u; i < N; ++i) {
+    if (!HashTraits<T>::Equal(a[i], b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace geometry_hash_internal
+
 template <>
 struct HashTraits<gfx::SizeF> : GenericHashTraits<gfx::SizeF> {
   STATIC_ONLY(HashTraits);
@@ -31,6 +123,104 @@ struct HashTraits<gfx::SizeF> : GenericHashTraits<gfx::SizeF> {
   }
 };
 
+template <>
+struct HashTraits<gfx::PointF> : GenericHashTraits<gfx::PointF> {
+  STATIC_ONLY(HashTraits);
+  static std::array<float, 2> Components(const gfx::PointF& key) {
+    return {key.x(), key.y()};
+  }
+  static unsigned GetHash(const gfx::PointF& key) {
+    return geometry_hash_internal::HashComponents(Components(key));
+  }
+  static bool Equal(const gfx::PointF& a, const gfx::PointF& b) {
+    return geometry_hash_internal::ComponentsEqual(Components(a),
+                                                   Components(b));
+  }
+
+  static constexpr bool kEmptyValueIsZero = false;
+  static constexpr gfx::PointF EmptyValue() {
+    return gfx::PointF(std::numeric_limits<float>::infinity(), 0);
+  }
+  static constexpr gfx::PointF DeletedValue() {
+    return gfx::PointF(0, std::numeric_limits<float>::infinity());
+  }
+};
+
+template <>
+struct HashTraits<gfx::Vector2dF> : GenericHashTraits<gfx::Vector2dF> {
+  STATIC_ONLY(HashTraits);
+  static std::array<float, 2> Components(const gfx::Vector2dF& key) {
+    return {key.x(), key.y()};
+  }
+  static unsigned GetHash(const gfx::Vector2dF& key) {
+    return geometry_hash_internal::HashComponents(Components(key));
+  }
+  static bool Equal(const gfx::Vector2dF& a, const gfx::Vector2dF& b) {
+    return geometry_hash_internal::ComponentsEqual(Components(a),
+                                                   Components(b));
+  }
+
+  static constexpr bool kEmptyValueIsZero = false;
+  static constexpr gfx::Vector2dF EmptyValue() {
+    return gfx::Vector2dF(std::numeric_limits<float>::infinity(), 0);
+  }
+  static constexpr gfx::Vector2dF DeletedValue() {
+    return gfx::Vector2dF(0, std::numeric_limits<float>::infinity());
+  }
+};
+
+template <>
+struct HashTraits<gfx::RectF> : GenericHashTraits<gfx::RectF> {
+  STATIC_ONLY(HashTraits);
+  static std::array<float, 4> Components(const gfx::RectF& key) {
+    return {key.x(), key.y(), key.width(), key.height()};
+  }
+  static unsigned GetHash(const gfx::RectF& key) {
+    return geometry_hash_internal::HashComponents(Components(key));
+  }
+  static bool Equal(const gfx::RectF& a, const gfx::RectF& b) {
+    return geometry_hash_internal::ComponentsEqual(Components(a),
+                                                   Components(b));
+  }
+
+  static constexpr bool kEmptyValueIsZero = false;
+  static constexpr gfx::RectF EmptyValue() {
+    return gfx::RectF(std::numeric_limits<float>::infinity(), 0, 0, 0);
+  }
+  static constexpr gfx::RectF DeletedValue() {
+    return gfx::RectF(0, std::numeric_limits<float>::infinity(), 0, 0);
+  }
+};
+
+// Hashes and compares the 16 components of the matrix, whether the
+// transforms are backed by a full matrix or not.
+template <>
+struct HashTraits<gfx::Transform> : GenericHashTraits<gfx::Transform> {
+  STATIC_ONLY(HashTraits);
+  static std::array<double, 16> Components(const gfx::Transform& key) {
+    std::array<double, 16> components;
+    key.GetColMajor(components);
+    return components;
+  }
+  static unsigned GetHash(const gfx::Transform& key) {
+    return geometry_hash_internal::HashComponents(Components(key));
+  }
+  static bool Equal(const gfx::Transform& a, const gfx::Transform& b) {
+    return geometry_hash_internal::ComponentsEqual(Components(a),
+                                                   Components(b));
+  }
+
+  static constexpr bool kEmptyValueIsZero = false;
+  static constexpr gfx::Transform EmptyValue() {
+    return gfx::Transform::MakeScale(std::numeric_limits<float>::infinity(),
+                                     0);
+  }
+  static constexpr gfx::Transform DeletedValue() {
+    return gfx::Transform::MakeScale(0,
+                                     std::numeric_limits<float>::infinity());
+  }
+};
+
 template <>
 struct HashTraits<SkIRect> : GenericHashTraits<SkIRect> {
   STATIC_ONLY(HashTraits);
@@ -44,6 +234,56 @@ struct HashTraits<SkIRect> : GenericHashTraits<SkIRect> {
   static SkIRect DeletedValue() { return SkIRect::MakeWH(0, -1); }
 };
 
+template <>
+struct HashTraits<FloatRoundedRect> : GenericHashTraits<FloatRoundedRect> {
+  STATIC_ONLY(HashTraits);
+  static unsigned GetHash(const FloatRoundedRect& key) {
+    const gfx::RectF& rect = key.Rect();
+    const FloatRoundedRect::Radii& radii = key.GetRadii();
+    return geometry_hash_internal::HashComponents(std::array<float, 12>{
+        rect.x(), rect.y(), rect.width(), rect.height(),
+        radii.TopLeft().width(), radii.TopLeft().height(),
+        radii.TopRight().width(), radii.TopRight().height(),
+        radii.BottomLeft().width(), radii.BottomLeft().height(),
+        radii.BottomRight().width(), radii.BottomRight().height()});
+  }
+
+  static constexpr bool kEmptyValueIsZero = false;
+  static FloatRoundedRect EmptyValue() {
+    return FloatRoundedRect(
+        gfx::RectF(std::numeric_limits<float>::infinity(), 0, 0, 0));
+  }
+  static FloatRoundedRect DeletedValue() {
+    return FloatRoundedRect(
+        gfx::RectF(0, std::numeric_limits<float>::infinity(), 0, 0));
+  }
+};
+
+template <>
+struct HashTraits<ContouredRect> : GenericHashTraits<ContouredRect> {
+  STATIC_ONLY(HashTraits);
+  static unsigned GetHash(const ContouredRect& key) {
+    using RectTraits = HashTraits<FloatRoundedRect>;
+    const ContouredRect::CornerCurvature& curvature =
+        key.GetCornerCurvature();
+    return HashInts(
+        HashInts(RectTraits::GetHash(key.AsRoundedRect()),
+                 RectTraits::GetHash(key.GetOriginRect())),
+        HashInts(HashInts(blink::GetHash(curvature.TopLeft()),
+                          blink::GetHash(curvature.TopRight())),
+                 HashInts(blink::GetHash(curvature.BottomRight()),
+                          blink::GetHash(curvature.BottomLeft()))));
+  }
+
+  static constexpr bool kEmptyValueIsZero = false;
+  static ContouredRect EmptyValue() {
+    return ContouredRect(HashTraits<FloatRoundedRect>::EmptyValue());
+  }
+  static ContouredRect DeletedValue() {
+    return ContouredRect(HashTraits<FloatRoundedRect>::DeletedValue());
+  }
+};
+
 }  // namespace blink
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_GEOMETRY_HASH_TRAITS_H_
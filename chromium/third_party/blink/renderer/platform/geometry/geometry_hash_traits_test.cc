@@ -0,0 +1,73 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/geometry_hash_traits.h"
+
+#include <limits>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/hash_set.h"
+
+namespace blink {
+
+TEST(GeometryHashTraitsTest, ZerosAndNaNs) {
+  using Traits = HashTraits<gfx::RectF>;
+  const gfx::RectF zero(0, 0, 10, 10);
+  const gfx::RectF negative_zero(-0.f, 0, 10, 10);
+  EXPECT_TRUE(Traits::Equal(zero, negative_zero));
+  EXPECT_EQ(Traits::GetHash(zero), Traits::GetHash(negative_zero));
+
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const gfx::PointF nan_point(nan, 1);
+  const gfx::PointF other_nan_point(-nan, 1);
+  using PointTraits = HashTraits<gfx::PointF>;
+  EXPECT_EQ(PointTraits::Equal(nan_point, other_nan_point),
+            PointTraits::GetHash(nan_point) ==
+                PointTraits::GetHash(other_nan_point));
+}
+
+TEST(GeometryHashTraitsTest, DifferentKeys) {
+  using Traits = HashTraits<gfx::RectF>;
+  EXPECT_NE(Traits::GetHash(gfx::RectF(1, 2, 3, 4)),
+            Traits::GetHash(gfx::RectF(2, 1, 3, 4)));
+  EXPECT_NE(Traits::GetHash(gfx::RectF(1, 2, 3, 4)),
+            Traits::GetHash(gfx::RectF(1, 2, 4, 3)));
+  EXPECT_NE(HashTraits<gfx::Vector2dF>::GetHash(gfx::Vector2dF(1, 2)),
+            HashTraits<gfx::Vector2dF>::GetHash(gfx::Vector2dF(2, 1)));
+
+  using RoundedTraits = HashTraits<FloatRoundedRect>;
+  const gfx::RectF rect(0, 0, 100, 100);
+  EXPECT_NE(RoundedTraits::GetHash(FloatRoundedRect(rect, 5)),
+            RoundedTraits::GetHash(FloatRoundedRect(rect, 6)));
+
+  // The hashes of transforms don't depend on how they're backed.
+  using TransformTraits = HashTraits<gfx::Transform>;
+  const gfx::Transform translation = gfx::Transform::MakeTranslation(10, 20);
+  gfx::Transform full = translation;
+  full.EnsureFullMatrixForTesting();
+  EXPECT_TRUE(TransformTraits::Equal(translation, full));
+  EXPECT_EQ(TransformTraits::GetHash(translation),
+            TransformTraits::GetHash(full));
+  EXPECT_NE(TransformTraits::GetHash(translation),
+            TransformTraits::GetHash(gfx::Transform::MakeTranslation(20, 10)));
+}
+
+TEST(GeometryHashTraitsTest, HashMap) {
+  HashMap<gfx::RectF, int> map;
+  for (int i = 0; i < 100; ++i) {
+    map.insert(gfx::RectF(i % 10, i / 10, 10, 10), i);
+  }
+  EXPECT_EQ(100u, map.size());
+  EXPECT_EQ(42, map.at(gfx::RectF(2, 4, 10, 10)));
+  EXPECT_EQ(0, map.at(gfx::RectF(-0.f, -0.f, 10, 10)));
+
+  HashSet<gfx::Transform> transforms;
+  transforms.insert(gfx::Transform());
+  transforms.insert(gfx::Transform::MakeScale(2));
+  EXPECT_TRUE(transforms.Contains(gfx::Transform::MakeScale(2, 2)));
+  EXPECT_FALSE(transforms.Contains(gfx::Transform::MakeScale(3)));
+}
+
+}  // namespace blink
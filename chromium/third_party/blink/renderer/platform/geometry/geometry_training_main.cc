@@ -0,0 +1,180 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The geometry_training executable, a workload to train the PGO and BOLT
+// profiles of the geometry, transform, animation and numerics code with: the
+// replays of a geometry trace and the edge cases of
+// gfx::RunGeometryTrainingWorkload(), and the calc() evaluation, LayoutUnit
+// arithmetic and rounded rect tests of blink platform geometry. Run it on an
+// instrumented build, e.g.
+//   geometry_training --rounds=200 --trace=page.gtrc
+// where --trace names a trace recorded with gfx::GeometryTraceRecorder; without
+// one, the trace of gfx::MakeSyntheticGeometryTrace() is replayed. It prints a
+// checksum of the results.
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "base/at_exit.h"
+#include "base/command_line.h"
+#include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/strings/string_number_conversions.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_expression_node.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_value.h"
+#include "third_party/blink/renderer/platform/geometry/float_rounded_rect.h"
+#include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/blink/renderer/platform/geometry/length.h"
+#include "third_party/blink/renderer/platform/geometry/length_functions.h"
+#include "third_party/blink/renderer/platform/testing/unit_test_helpers.h"
+#include "ui/gfx/geometry/geometry_trace.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/test/geometry_training_workload.h"
+
+namespace blink {
+
+namespace {
+
+constexpr int kDefaultRounds = 100;
+constexpr int kNumBases = 256;
+
+const CalculationExpressionNode* Pixels(float pixels) {
+  return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+      PixelsAndPercent(pixels));
+}
+
+const CalculationExpressionNode* Percent(float percent) {
+  return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+      PixelsAndPercent(0, percent, /*has_explicit_pixels=*/false,
+                       /*has_explicit_percent=*/true));
+}
+
+const CalculationExpressionNode* Operation(
+    CalculationExpressionOperationNode::Children&& children,
+    CalculationOperator op) {
+  return MakeGarbageCollected<CalculationExpressionOperationNode>(
+      std::move(children), op);
+}
+
+// The calc() expressions of typical stylesheets, from the ones that are
+// stored as a PixelsAndPercent to nested operations.
+std::vector<Length> MakeCalculatedLengths() {
+  std::vector<Length> lengths;
+  lengths.emplace_back(MakeGarbageCollected<CalculationValue>(
+      PixelsAndPercent(20, 10, /*has_explicit_pixels=*/true,
+                       /*has_explicit_percent=*/true),
+      Length::ValueRange::kAll));
+  lengths.emplace_back(CalculationValue::CreateSimplified(
+      Operation({Pixels(100), Percent(50)}, CalculationOperator::kMin),
+      Length::ValueRange::kAll));
+  lengths.emplace_back(CalculationValue::CreateSimplified(
+      Operation({Pixels(10), Percent(20), Percent(50)},
+                CalculationOperator::kClamp),
+      Length::ValueRange::kNonNegative));
+  lengths.emplace_back(CalculationValue::CreateSimplified(
+      Operation(
+          {Operation({Operation({Pixels(100), Percent(50)},
+                                CalculationOperator::kMin),
+                      MakeGarbageCollected<CalculationExpressionNumberNode>(3)},
+                     CalculationOperator::kMultiply),
+           Pixels(5)},
+          CalculationOperator::kSubtract),
+      Length::ValueRange::kAll));
+  return lengths;
+}
+
+// Resolves Lengths and tests rounded rects as layout and painting do, with
+// percentage bases and rects that differ from call to call.
+double RunBlinkGeometryWorkload(int rounds) {
+  const std::vector<Length> lengths = MakeCalculatedLengths();
+  std::vector<float> bases(kNumBases);
+  std::vector<float> results(kNumBases);
+  for (int i = 0; i < kNumBases; ++i) {
+    bases[i] = static_cast<float>(i * 997 % 2000);
+  }
+
+  double checksum = 0;
+  for (int round = 0; round < rounds; ++round) {
+    for (const Length& length : lengths) {
+      const CalculationValue& calculation = length.GetCalculationValue();
+      for (float base : bases) {
+        checksum += calculation.Evaluate(base);
+        checksum += ValueForLength(length, LayoutUnit(base)).ToFloat();
+      }
+      calculation.EvaluateMany(bases, results);
+      checksum += results.back();
+    }
+    for (int i = 0; i < kNumBases; ++i) {
+      const LayoutUnit width = LayoutUnit::FromFloatRound(bases[i] / 3);
+      checksum += (width * LayoutUnit(1.5f) + width / 7).ToFloat();
+
+      const gfx::RectF rect(i, i * 2, bases[i] + 10, 50);
+      // Radii that may not fit, as border-radius allows.
+      FloatRoundedRect rounded(
+          rect, FloatRoundedRect::Radii(gfx::SizeF(i % 40, 10), gfx::SizeF(),
+                                        gfx::SizeF(30, i % 60),
+                                        gfx::SizeF(5, 5)));
+      if (!rounded.IsRenderable()) {
+        rounded.ConstrainRadii();
+      }
+      checksum += rounded.Contains(gfx::PointF(i + 1, i * 2 + 1));
+      checksum += rounded.IntersectsQuad(
+          gfx::QuadF(gfx::RectF(i - 5, i * 2 - 5, 10, 10)));
+    }
+  }
+  return checksum;
+}
+
+std::optional<std::vector<gfx::GeometryTraceCall>> ReadTrace(
+    const base::CommandLine& command_line) {
+  if (!command_line.HasSwitch("trace")) {
+    return gfx::GeometryTraceReader::ReadAll(
+        gfx::MakeSyntheticGeometryTrace());
+  }
+  base::MemoryMappedFile file;
+  if (!file.Initialize(command_line.GetSwitchValuePath("trace"))) {
+    return std::nullopt;
+  }
+  return gfx::GeometryTraceReader::ReadAll(
+      std::span<const uint8_t>(file.bytes()));
+}
+
+}  // namespace
+
+}  // namespace blink
+
+int main(int argc, char** argv) {
+  base::AtExitManager at_exit_manager;
+  base::CommandLine::Init(argc, argv);
+  const base::CommandLine& command_line =
+      *base::CommandLine::ForCurrentProcess();
+  // For the heap of the calc() values.
+  blink::ScopedUnittestsEnvironmentSetup environment(argc, argv);
+
+  int rounds = blink::kDefaultRounds;
+  if (command_line.HasSwitch("rounds") &&
+      !base::StringToInt(command_line.GetSwitchValueASCII("rounds"),
+                         &rounds)) {
+    fprintf(stderr, "Invalid --rounds\n");
+    return 1;
+  }
+  const std::optional<std::vector<gfx::GeometryTraceCall>> trace_calls =
+      blink::ReadTrace(command_line);
+  if (!trace_calls) {
+    fprintf(stderr, "Can't read the trace\n");
+    return 1;
+  }
+
+  double checksum = gfx::RunGeometryTrainingWorkload(*trace_calls, rounds);
+  checksum += blink::RunBlinkGeometryWorkload(rounds);
+  printf("checksum: %g\n", checksum);
+  return 0;
+}
@@ -0,0 +1,372 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Stress benchmarks of a synthetic scene of 1k to 1M layers, for the
+// blink_platform_perftests target, to judge changes of ui/gfx/geometry and of
+// blink platform geometry at production scale. The layers have a mix of
+// identity, translation, scale, rotation and perspective transforms, boxes
+// sized with fixed, percentage and calc() Lengths, rounded clips and eased
+// animations. Each stage of a frame is a benchmark over all the layers, which
+// reports layers_per_second, summed over the threads that split the layers
+// in the runs of ThreadRange(), and the peak_rss_bytes and scene_bytes
+// counters. The scene is built once for each size, before the timed runs.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include "base/containers/span.h"
+#include "base/no_destructor.h"
+#include "build/build_config.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_expression_node.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_value.h"
+#include "third_party/blink/renderer/platform/geometry/float_rounded_rect.h"
+#include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/blink/renderer/platform/geometry/length.h"
+#include "third_party/blink/renderer/platform/geometry/length_functions.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+#include "ui/gfx/geometry/cubic_bezier.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/size_f.h"
+#include "ui/gfx/geometry/transform.h"
+
+#if BUILDFLAG(IS_POSIX)
+#include <sys/resource.h>
+#endif
+
+namespace blink {
+
+namespace {
+
+constexpr int64_t kMinLayers = 1 << 10;
+constexpr int64_t kMaxLayers = 1 << 20;
+constexpr int kMaxThreads = 16;
+
+// The Lengths of the widths and heights of the boxes. They're made on the
+// stack of each user, where the calc() ones are kept alive.
+constexpr size_t kNumBoxLengths = 4;
+using BoxLengths = std::array<Length, kNumBoxLengths>;
+
+const CalculationExpressionNode* Pixels(float pixels) {
+  return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+      PixelsAndPercent(pixels));
+}
+
+const CalculationExpressionNode* Percent(float percent) {
+  return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+      PixelsAndPercent(0, percent, /*has_explicit_pixels=*/false,
+                       /*has_explicit_percent=*/true));
+}
+
+BoxLengths MakeBoxLengths() {
+  return {
+      Length::Fixed(120),
+      Length::Percent(25),
+      // calc(20px + 10%).
+      Length(MakeGarbageCollected<CalculationValue>(
+          PixelsAndPercent(20, 10, /*has_explicit_pixels=*/true,
+                           /*has_explicit_percent=*/true),
+          Length::ValueRange::kAll)),
+      // min(300px, 50%).
+      Length(CalculationValue::CreateSimplified(
+          MakeGarbageCollected<CalculationExpressionOperationNode>(
+              CalculationExpressionOperationNode::Children(
+                  {Pixels(300), Percent(50)}),
+              CalculationOperator::kMin),
+          Length::ValueRange::kAll)),
+  };
+}
+
+// The easings of the animations, as in CSS.
+std::array<gfx::CubicBezier, 4> MakeEasings() {
+  return {gfx::CubicBezier(0.25, 0.1, 0.25, 1), gfx::CubicBezier(0.42, 0, 1, 1),
+          gfx::CubicBezier(0, 0, 0.58, 1), gfx::CubicBezier(0.42, 0, 0.58, 1)};
+}
+
+struct SceneLayer {
+  // Maps the layer to the screen.
+  gfx::Transform transform;
+  // The box of the layer, whose size is resolved from Lengths.
+  gfx::RectF bounds;
+  // The rounded clip in screen space, if |has_clip|.
+  FloatRoundedRect clip;
+  bool has_clip = false;
+  // The index of the easing of the animation of the layer, or -1.
+  int8_t easing = -1;
+  // The Lengths of the width and height of the box, and its container width.
+  uint8_t width_length = 0;
+  uint8_t height_length = 0;
+  LayoutUnit container_width;
+  // A point of the screen to hit test, in or around the layer.
+  gfx::PointF hit_point;
+};
+
+struct Scene {
+  std::vector<SceneLayer> layers;
+  // The indices of the animated layers.
+  std::vector<uint32_t> animated_layers;
+};
+
+gfx::Transform MakeLayerTransform(std::minstd_rand& random) {
+  std::uniform_real_distribution<float> offset(0, 2000);
+  const int kind = std::uniform_int_distribution<int>(0, 99)(random);
+  // Mostly identities and translations, as in real pages.
+  if (kind < 30) {
+    return gfx::Transform();
+  }
+  gfx::Transform transform =
+      gfx::Transform::MakeTranslation(offset(random), offset(random));
+  if (kind < 70) {
+    return transform;
+  }
+  if (kind < 85) {
+    transform.Scale(std::uniform_real_distribution<float>(0.5, 2)(random),
+                    std::uniform_real_distribution<float>(0.5, 2)(random));
+  } else if (kind < 95) {
+    transform.Rotate(std::uniform_real_distribution<float>(-180, 180)(random));
+  } else {
+    transform.ApplyPerspectiveDepth(800);
+    transform.RotateAboutYAxis(
+        std::uniform_real_distribution<float>(-60, 60)(random));
+  }
+  return transform;
+}
+
+std::unique_ptr<Scene> MakeScene(size_t num_layers) {
+  std::minstd_rand random(static_cast<uint32_t>(num_layers));
+  std::uniform_int_distribution<int> percent(0, 99);
+  const BoxLengths lengths = MakeBoxLengths();
+
+  auto scene = std::make_unique<Scene>();
+  scene->layers.resize(num_layers);
+  for (size_t i = 0; i < num_layers; ++i) {
+    SceneLayer& layer = scene->layers[i];
+    layer.transform = MakeLayerTransform(random);
+    layer.width_length = static_cast<uint8_t>(random() % kNumBoxLengths);
+    layer.height_length = static_cast<uint8_t>(random() % kNumBoxLengths);
+    layer.container_width = LayoutUnit(200 + random() % 1000);
+    layer.bounds = gfx::RectF(
+        ValueForLength(lengths[layer.width_length], layer.container_width)
+            .ToFloat(),
+        ValueForLength(lengths[layer.height_length], layer.container_width)
+            .ToFloat());
+    const gfx::RectF screen_bounds = layer.transform.MapRect(layer.bounds);
+    if (percent(random) < 30) {
+      layer.clip = FloatRoundedRect(
+          screen_bounds,
+          FloatRoundedRect::Radii(gfx::SizeF(16, 16), gfx::SizeF(),
+                                  gfx::SizeF(), gfx::SizeF(8, 8)));
+      layer.clip.Inset(
+          std::min(screen_bounds.width(), screen_bounds.height()) / 8);
+      layer.has_clip = true;
+    }
+    if (percent(random) < 10) {
+      layer.easing = static_cast<int8_t>(random() % 4);
+      scene->animated_layers.push_back(static_cast<uint32_t>(i));
+    }
+    // The points of half of the layers are spread over twice their screen
+    // bounds, so that many of them miss.
+    const float extent = percent(random) < 50 ? 1.f : 2.f;
+    layer.hit_point =
+        gfx::PointF(screen_bounds.x() + screen_bounds.width() * extent *
+                                            (random() % 100) / 100.f,
+                    screen_bounds.y() + screen_bounds.height() * extent *
+                                            (random() % 100) / 100.f);
+  }
+  return scene;
+}
+
+std::unique_ptr<Scene>& CurrentScene() {
+  static base::NoDestructor<std::unique_ptr<Scene>> scene;
+  return *scene;
+}
+
+// Builds the scene of the range of the benchmark, before its threads start,
+// on the main thread where the calc() Lengths can be made. The previous scene
+// is destroyed first, so that only one is in memory.
+void SetUpScene(const benchmark::State& state) {
+  std::unique_ptr<Scene>& scene = CurrentScene();
+  const auto num_layers = static_cast<size_t>(state.range(0));
+  if (!scene || scene->layers.size() != num_layers) {
+    scene.reset();
+    scene = MakeScene(num_layers);
+  }
+}
+
+// Returns the layers of the thread of |state|.
+base::span<const SceneLayer> GetThreadLayers(const benchmark::State& state) {
+  const std::vector<SceneLayer>& layers = CurrentScene()->layers;
+  const size_t begin = layers.size() * state.thread_index() / state.threads();
+  const size_t end =
+      layers.size() * (state.thread_index() + 1) / state.threads();
+  return base::span(layers).subspan(begin, end - begin);
+}
+
+size_t GetPeakRssBytes() {
+#if BUILDFLAG(IS_POSIX)
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#if BUILDFLAG(IS_APPLE)
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+  return 0;
+}
+
+void SetCounters(benchmark::State& state, size_t layers_per_iteration) {
+  state.counters["layers_per_second"] = benchmark::Counter(
+      static_cast<double>(layers_per_iteration), benchmark::Counter::kIsRate);
+  if (state.thread_index() == 0) {
+    const Scene& scene = *CurrentScene();
+    state.counters["scene_bytes"] = static_cast<double>(
+        scene.layers.capacity() * sizeof(SceneLayer) +
+        scene.animated_layers.capacity() * sizeof(uint32_t));
+    state.counters["peak_rss_bytes"] =
+        static_cast<double>(GetPeakRssBytes());
+  }
+}
+
+// Maps the box of each layer to the screen.
+void BM_MapBounds(benchmark::State& state) {
+  const base::span<const SceneLayer> layers = GetThreadLayers(state);
+  for (auto _ : state) {
+    for (const SceneLayer& layer : layers) {
+      benchmark::DoNotOptimize(layer.transform.MapRect(layer.bounds));
+    }
+  }
+  SetCounters(state, layers.size());
+}
+
+// Clips the quad of each layer by its rounded clip.
+void BM_Clip(benchmark::State& state) {
+  const base::span<const SceneLayer> layers = GetThreadLayers(state);
+  for (auto _ : state) {
+    size_t visible = 0;
+    for (const SceneLayer& layer : layers) {
+      const gfx::QuadF quad = layer.transform.MapQuad(gfx::QuadF(layer.bounds));
+      if (!layer.has_clip) {
+        ++visible;
+        continue;
+      }
+      gfx::RectF clipped = quad.BoundingBox();
+      clipped.Intersect(layer.clip.Rect());
+      if (!clipped.IsEmpty() && layer.clip.IntersectsQuad(quad)) {
+        ++visible;
+      }
+    }
+    benchmark::DoNotOptimize(visible);
+  }
+  SetCounters(state, layers.size());
+}
+
+// Computes the screen bounds of the whole scene.
+void BM_SceneBounds(benchmark::State& state) {
+  const base::span<const SceneLayer> layers = GetThreadLayers(state);
+  for (auto _ : state) {
+    gfx::RectF bounds;
+    for (const SceneLayer& layer : layers) {
+      bounds.Union(layer.transform.MapRect(layer.bounds));
+    }
+    benchmark::DoNotOptimize(bounds);
+  }
+  SetCounters(state, layers.size());
+}
+
+// Hit tests a point against each layer, in its own space and by its clip.
+void BM_HitTest(benchmark::State& state) {
+  const base::span<const SceneLayer> layers = GetThreadLayers(state);
+  for (auto _ : state) {
+    size_t hits = 0;
+    for (const SceneLayer& layer : layers) {
+      if (layer.has_clip && !layer.clip.Contains(layer.hit_point)) {
+        continue;
+      }
+      const std::optional<gfx::PointF> point =
+          layer.transform.InverseMapPoint(layer.hit_point);
+      if (point && layer.bounds.InclusiveContains(*point)) {
+        ++hits;
+      }
+    }
+    benchmark::DoNotOptimize(hits);
+  }
+  SetCounters(state, layers.size());
+}
+
+// Ticks the animations of the animated layers: eases the progress of each,
+// and composes its transform, a frame further at each iteration.
+void BM_AnimationTick(benchmark::State& state) {
+  const std::vector<SceneLayer>& all_layers = CurrentScene()->layers;
+  const std::vector<uint32_t>& animated = CurrentScene()->animated_layers;
+  const size_t begin =
+      animated.size() * state.thread_index() / state.threads();
+  const size_t end =
+      animated.size() * (state.thread_index() + 1) / state.threads();
+  const std::array<gfx::CubicBezier, 4> easings = MakeEasings();
+  int frame = 0;
+  for (auto _ : state) {
+    for (size_t i = begin; i < end; ++i) {
+      const SceneLayer& layer = all_layers[animated[i]];
+      // One second animations, 60 frames each, offset by layer.
+      const double progress = ((frame + animated[i]) % 60) / 60.0;
+      const double eased = easings[layer.easing].Solve(progress);
+      gfx::Transform transform = layer.transform;
+      transform.Translate(eased * 100, 0);
+      transform.Rotate(eased * 90);
+      benchmark::DoNotOptimize(transform);
+    }
+    ++frame;
+  }
+  SetCounters(state, end - begin);
+}
+
+// Resolves the Lengths of the boxes. Lengths are made on the main thread, so
+// this runs on one thread.
+void BM_ResolveSizes(benchmark::State& state) {
+  const std::vector<SceneLayer>& layers = CurrentScene()->layers;
+  const BoxLengths lengths = MakeBoxLengths();
+  for (auto _ : state) {
+    for (const SceneLayer& layer : layers) {
+      benchmark::DoNotOptimize(
+          ValueForLength(lengths[layer.width_length], layer.container_width));
+      benchmark::DoNotOptimize(
+          ValueForLength(lengths[layer.height_length], layer.container_width));
+    }
+  }
+  SetCounters(state, layers.size());
+}
+
+void SceneSizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"layers"})
+      ->RangeMultiplier(32)
+      ->Range(kMinLayers, kMaxLayers)
+      ->Setup(SetUpScene)
+      ->UseRealTime();
+}
+
+void SceneSizesAndThreads(benchmark::internal::Benchmark* benchmark) {
+  SceneSizes(benchmark);
+  benchmark->ThreadRange(1, kMaxThreads);
+}
+
+BENCHMARK(BM_MapBounds)->Apply(SceneSizesAndThreads);
+BENCHMARK(BM_Clip)->Apply(SceneSizesAndThreads);
+BENCHMARK(BM_SceneBounds)->Apply(SceneSizesAndThreads);
+BENCHMARK(BM_HitTest)->Apply(SceneSizesAndThreads);
+BENCHMARK(BM_AnimationTick)->Apply(SceneSizesAndThreads);
+BENCHMARK(BM_ResolveSizes)->Apply(SceneSizes);
+
+}  // namespace
+
+}  // namespace blink
@@ -32,6 +32,7 @@
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LAYOUT_UNIT_H_
 
 #include <climits>
+#include <cstdlib>
 #include <iosfwd>
 #include <limits>
 #include <optional>
@@ -533,21 +534,22 @@ template <unsigned fractional_bits, typename RawValue>
 inline FixedPoint<fractional_bits, RawValue> BoundedMultiply(
     const FixedPoint<fractional_bits, RawValue>& a,
     const FixedPoint<fractional_bits, RawValue>& b) {
+  // The product of two 32-bit values can't overflow 64 bits.
   int64_t result =
       static_cast<int64_t>(a.RawValue()) * static_cast<int64_t>(b.RawValue()) /
       FixedPoint<fractional_bits, RawValue>::kFixedPointDenominator;
-  int32_t high = static_cast<int32_t>(result >> 32);
-  int32_t low = static_cast<int32_t>(result);
+  uint32_t low = static_cast<uint32_t>(result);
   uint32_t saturated =
       (static_cast<uint32_t>(a.RawValue() ^ b.RawValue()) >> 31) +
       FixedPoint<fractional_bits, RawValue>::kRawValueMax;
-  // If the higher 32 bits does not match the lower 32 with sign extension the
-  // operation overflowed.
-  if (high != low >> 31)
-    result = saturated;
-
+  // If the lower 32 bits sign extended don't match the result the operation
+  // overflowed. The result is selected with a mask rather than a branch, which
+  // compilers may emit for a conditional, and which is mispredicted when some
+  // of the products overflow.
+  uint32_t overflowed =
+      0u - static_cast<uint32_t>(static_cast<int32_t>(low) != result);
   return FixedPoint<fractional_bits, RawValue>::FromRawValue(
-      static_cast<RawValue>(result));
+      static_cast<RawValue>((low & ~overflowed) | (saturated & overflowed)));
 }
 
 template <unsigned fractional_bits, typename RawValue>
@@ -834,6 +836,92 @@ inline LayoutUnit AbsoluteValue(const LayoutUnit& value) {
   return value.Abs();
 }
 
+// Adds LayoutUnits, e.g. the sizes of many children, without saturating each
+// partial sum, which operator+= does, and saturates once in ToLayoutUnit(). So
+// the result doesn't depend on the order of the values, and is the same as
+// with operator+= unless a partial sum saturates.
+class LayoutUnitAccumulator {
+  DISALLOW_NEW();
+
+ public:
+  LayoutUnitAccumulator() = default;
+  explicit LayoutUnitAccumulator(LayoutUnit value) : sum_(value.RawValue()) {}
+
+  // 64 bits hold the sum of billions of values of any size.
+  LayoutUnitAccumulator& operator+=(LayoutUnit value) {
+    sum_ += value.RawValue();
+    return *this;
+  }
+  LayoutUnitAccumulator& operator-=(LayoutUnit value) {
+    sum_ -= value.RawValue();
+    return *this;
+  }
+
+  LayoutUnit ToLayoutUnit() const {
+    return LayoutUnit::FromRawValueWithClamp(sum_);
+  }
+
+ private:
+  int64_t sum_ = 0;
+};
+
+// Divides LayoutUnits by the same divisor, e.g. to distribute free space over
+// flex items or grid tracks, with a multiplication by a reciprocal computed
+// once, instead of a 64-bit division each time. The results are the same as
+// those of operator/.
+class LayoutUnitDivider {
+  DISALLOW_NEW();
+
+ public:
+  explicit LayoutUnitDivider(LayoutUnit divisor)
+      : divisor_(static_cast<uint64_t>(std::abs(
+            static_cast<int64_t>(divisor.RawValue())))),
+        // For a numerator n < 2^64, the high half of n * reciprocal_ is
+        // either n / divisor_ or one less.
+        reciprocal_(std::numeric_limits<uint64_t>::max() / divisor_),
+        negative_(divisor.RawValue() < 0) {
+    DCHECK(divisor);
+  }
+
+  LayoutUnit Divide(LayoutUnit dividend) const {
+    // The same numerator as operator/, whose magnitude is below 2^38.
+    const int64_t numerator = static_cast<int64_t>(dividend.RawValue()) *
+                              LayoutUnit::kFixedPointDenominator;
+    const uint64_t magnitude = static_cast<uint64_t>(std::abs(numerator));
+    uint64_t quotient = MultiplyHigh(magnitude, reciprocal_);
+    if (magnitude - quotient * divisor_ >= divisor_) {
+      ++quotient;
+    }
+    // Truncating towards zero, as integer division does.
+    const int64_t raw_value = (numerator < 0) != negative_
+                                  ? -static_cast<int64_t>(quotient)
+                                  : static_cast<int64_t>(quotient);
+    return LayoutUnit::FromRawValueWithClamp(raw_value);
+  }
+
+ private:
+  // The high 64 bits of the 128-bit product.
+  static uint64_t MultiplyHigh(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<uint64_t>(
+        (static_cast<unsigned __int128>(a) * b) >> 64);
+#else
+    const uint64_t a_low = a & 0xffffffff;
+    const uint64_t a_high = a >> 32;
+    const uint64_t b_low = b & 0xffffffff;
+    const uint64_t b_high = b >> 32;
+    const uint64_t low = a_low * b_low;
+    const uint64_t middle1 = a_high * b_low + (low >> 32);
+    const uint64_t middle2 = a_low * b_high + (middle1 & 0xffffffff);
+    return a_high * b_high + (middle1 >> 32) + (middle2 >> 32);
+#endif
+  }
+
+  uint64_t divisor_;
+  uint64_t reciprocal_;
+  bool negative_;
+};
+
 template <unsigned fractional_bits, typename RawValue>
 inline std::optional<FixedPoint<fractional_bits, RawValue>>
 FixedPoint<fractional_bits, RawValue>::NullOptIf(FixedPoint null_value) const {
@@ -0,0 +1,81 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LAYOUT_UNIT_PAIR_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LAYOUT_UNIT_PAIR_H_
+
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+#include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace blink {
+
+// Two LayoutUnits, e.g. the left and the top of an offset or the width and
+// the height of a size, which are added or subtracted at once in one SIMD
+// register. The results are the same as those of the LayoutUnit operators on
+// each value, including their saturation.
+struct LayoutUnitPair {
+  DISALLOW_NEW();
+
+  LayoutUnit first;
+  LayoutUnit second;
+};
+
+namespace internal {
+
+using Int32x2 = int32_t __attribute__((vector_size(2 * sizeof(int32_t))));
+using Uint32x2 = uint32_t __attribute__((vector_size(2 * sizeof(uint32_t))));
+
+static_assert(std::is_same_v<decltype(LayoutUnit().RawValue()), int32_t>);
+
+inline Int32x2 ToInt32x2(LayoutUnitPair pair) {
+  return Int32x2{pair.first.RawValue(), pair.second.RawValue()};
+}
+
+inline LayoutUnitPair ToLayoutUnitPair(Int32x2 raw_values) {
+  return {LayoutUnit::FromRawValue(raw_values[0]),
+          LayoutUnit::FromRawValue(raw_values[1])};
+}
+
+// The raw value that an overflowing sum or difference saturates to, given the
+// sign of the result before it overflowed.
+inline Int32x2 SaturatedValue(Int32x2 sign) {
+  return (sign >> 31) ^ LayoutUnit::kRawValueMax;
+}
+
+}  // namespace internal
+
+inline LayoutUnitPair operator+(LayoutUnitPair a, LayoutUnitPair b) {
+  using internal::Int32x2;
+  using internal::Uint32x2;
+  const Int32x2 lhs = internal::ToInt32x2(a);
+  const Int32x2 rhs = internal::ToInt32x2(b);
+  const Int32x2 sum = std::bit_cast<Int32x2>(std::bit_cast<Uint32x2>(lhs) +
+                                             std::bit_cast<Uint32x2>(rhs));
+  // The sum overflowed if its sign differs from those of both operands.
+  const Int32x2 overflowed = ((lhs ^ sum) & (rhs ^ sum)) < 0;
+  return internal::ToLayoutUnitPair(
+      overflowed ? internal::SaturatedValue(lhs) : sum);
+}
+
+inline LayoutUnitPair operator-(LayoutUnitPair a, LayoutUnitPair b) {
+  using internal::Int32x2;
+  using internal::Uint32x2;
+  const Int32x2 lhs = internal::ToInt32x2(a);
+  const Int32x2 rhs = internal::ToInt32x2(b);
+  const Int32x2 difference = std::bit_cast<Int32x2>(
+      std::bit_cast<Uint32x2>(lhs) - std::bit_cast<Uint32x2>(rhs));
+  // The difference overflowed if the operands have different signs, and it
+  // doesn't have the sign of |a|.
+  const Int32x2 overflowed = ((lhs ^ rhs) & (lhs ^ difference)) < 0;
+  return internal::ToLayoutUnitPair(
+      overflowed ? internal::SaturatedValue(lhs) : difference);
+}
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LAYOUT_UNIT_PAIR_H_
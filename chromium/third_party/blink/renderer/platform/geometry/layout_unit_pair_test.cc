@@ -0,0 +1,37 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/layout_unit_pair.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+TEST(LayoutUnitPairTest, AddAndSubtract) {
+  const LayoutUnit values[] = {LayoutUnit(),
+                               LayoutUnit(1),
+                               LayoutUnit(-2.5),
+                               LayoutUnit(1000.25),
+                               LayoutUnit::FromRawValue(1),
+                               LayoutUnit::FromRawValue(-1),
+                               LayoutUnit::Max(),
+                               LayoutUnit::Min(),
+                               LayoutUnit::NearlyMax(),
+                               LayoutUnit::NearlyMin()};
+  for (LayoutUnit a : values) {
+    for (LayoutUnit b : values) {
+      // The second lane has the operands swapped, to mix the lanes that
+      // saturate.
+      const LayoutUnitPair sum = LayoutUnitPair{a, b} + LayoutUnitPair{b, a};
+      EXPECT_EQ(a + b, sum.first) << a << " + " << b;
+      EXPECT_EQ(b + a, sum.second) << b << " + " << a;
+      const LayoutUnitPair difference =
+          LayoutUnitPair{a, b} - LayoutUnitPair{b, a};
+      EXPECT_EQ(a - b, difference.first) << a << " - " << b;
+      EXPECT_EQ(b - a, difference.second) << b << " - " << a;
+    }
+  }
+}
+
+}  // namespace blink
@@ -0,0 +1,200 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Microbenchmarks of the LayoutUnit arithmetic and conversions, for the
+// blink_platform_perftests target. The arithmetic benchmarks run for pairs of
+// LayoutUnits of which a given percentage saturate, in random order, and the
+// conversions for floats of typical sizes. Each reports the time per operation
+// in the time_per_op counter. BM_Reference is the generic 64-bit
+// multiplication clamped with FixedPoint::ClampRawValue, which operator* is
+// compared against. Run with --benchmark_format=json to get results that can
+// be diffed across versions, e.g. with tools/compare.py of google_benchmark,
+// which reports the statistically significant changes.
+
+#include <random>
+#include <vector>
+
+#include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace blink {
+
+namespace {
+
+constexpr size_t kNumOperands = 1024;
+
+struct Operands {
+  std::vector<LayoutUnit> a;
+  std::vector<LayoutUnit> b;
+};
+
+// The raw values of operands that saturate when multiplied, or when added.
+constexpr int32_t kMinLargeFactor = 1 << 26;
+constexpr int32_t kMaxLargeFactor = 1 << 30;
+constexpr int32_t kMinLargeAddend = 1 << 30;
+constexpr int32_t kMaxLargeAddend = LayoutUnit::kRawValueMax;
+
+// Returns operands of which |overflow_percentage| percent have raw values
+// between |min_large| and |max_large|, and the others are the sizes of typical
+// boxes and factors, which are never zero.
+Operands MakeOperands(int overflow_percentage,
+                      int32_t min_large = kMinLargeFactor,
+                      int32_t max_large = kMaxLargeFactor) {
+  // A fixed seed, so that runs are comparable.
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> percent(0, 99);
+  std::uniform_int_distribution<int32_t> small(1, 1000 * 64);
+  std::uniform_int_distribution<int32_t> large(min_large, max_large);
+  std::uniform_int_distribution<int> sign(0, 1);
+  Operands operands;
+  for (size_t i = 0; i < kNumOperands; ++i) {
+    const bool overflow = percent(generator) < overflow_percentage;
+    // Both operands of a sum that saturates have the same sign.
+    const int a_sign = sign(generator) ? 1 : -1;
+    const int b_sign = overflow ? a_sign : (sign(generator) ? 1 : -1);
+    operands.a.push_back(LayoutUnit::FromRawValue(
+        a_sign * (overflow ? large(generator) : small(generator))));
+    operands.b.push_back(LayoutUnit::FromRawValue(
+        b_sign * (overflow ? large(generator) : small(generator))));
+  }
+  return operands;
+}
+
+// Returns floats of typical sizes, with fractions.
+std::vector<float> MakeFloats() {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> distribution(-2000, 2000);
+  std::vector<float> values(kNumOperands);
+  for (float& value : values) {
+    value = distribution(generator);
+  }
+  return values;
+}
+
+LayoutUnit ReferenceMultiply(LayoutUnit a, LayoutUnit b) {
+  return LayoutUnit::FromRawValueWithClamp(static_cast<int64_t>(a.RawValue()) *
+                                           b.RawValue() /
+                                           LayoutUnit::kFixedPointDenominator);
+}
+
+void SetTimePerOp(benchmark::State& state) {
+  state.counters["time_per_op"] = benchmark::Counter(
+      kNumOperands, benchmark::Counter::kIsIterationInvariantRate |
+                        benchmark::Counter::kInvert);
+}
+
+// Each iteration applies the operation to all the operands, so that the cost
+// of the loop is amortized.
+void BM_Add(benchmark::State& state) {
+  const Operands operands =
+      MakeOperands(state.range(0), kMinLargeAddend, kMaxLargeAddend);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kNumOperands; ++i) {
+      benchmark::DoNotOptimize(operands.a[i] + operands.b[i]);
+    }
+  }
+  SetTimePerOp(state);
+}
+
+void BM_Subtract(benchmark::State& state) {
+  Operands operands =
+      MakeOperands(state.range(0), kMinLargeAddend, kMaxLargeAddend);
+  // The differences of operands of opposite signs saturate.
+  for (LayoutUnit& b : operands.b) {
+    b = -b;
+  }
+  for (auto _ : state) {
+    for (size_t i = 0; i < kNumOperands; ++i) {
+      benchmark::DoNotOptimize(operands.a[i] - operands.b[i]);
+    }
+  }
+  SetTimePerOp(state);
+}
+
+void BM_Multiply(benchmark::State& state) {
+  const Operands operands = MakeOperands(state.range(0));
+  for (auto _ : state) {
+    for (size_t i = 0; i < kNumOperands; ++i) {
+      benchmark::DoNotOptimize(operands.a[i] * operands.b[i]);
+    }
+  }
+  SetTimePerOp(state);
+}
+
+void BM_Reference(benchmark::State& state) {
+  const Operands operands = MakeOperands(state.range(0));
+  for (auto _ : state) {
+    for (size_t i = 0; i < kNumOperands; ++i) {
+      benchmark::DoNotOptimize(ReferenceMultiply(operands.a[i], operands.b[i]));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+void BM_MulDiv(benchmark::State& state) {
+  const Operands operands = MakeOperands(state.range(0));
+  const LayoutUnit divisor(3.5);
+  for (auto _ : state) {
+    for (size_t i = 0; i < kNumOperands; ++i) {
+      benchmark::DoNotOptimize(operands.a[i].MulDiv(operands.b[i], divisor));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+// The quotients of large values by small ones saturate.
+void BM_Divide(benchmark::State& state) {
+  Operands operands = MakeOperands(state.range(0));
+  for (size_t i = 0; i < kNumOperands; ++i) {
+    if (operands.a[i].Abs() > LayoutUnit(1000)) {
+      operands.b[i] = LayoutUnit::FromRawValue(operands.b[i] > LayoutUnit() ? 1 : -1);
+    }
+  }
+  for (auto _ : state) {
+    for (size_t i = 0; i < kNumOperands; ++i) {
+      benchmark::DoNotOptimize(operands.a[i] / operands.b[i]);
+    }
+  }
+  SetTimePerOp(state);
+}
+
+void BM_FromFloatRound(benchmark::State& state) {
+  const std::vector<float> values = MakeFloats();
+  for (auto _ : state) {
+    for (float value : values) {
+      benchmark::DoNotOptimize(LayoutUnit::FromFloatRound(value));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+void BM_FromFloatCeil(benchmark::State& state) {
+  const std::vector<float> values = MakeFloats();
+  for (auto _ : state) {
+    for (float value : values) {
+      benchmark::DoNotOptimize(LayoutUnit::FromFloatCeil(value));
+    }
+  }
+  SetTimePerOp(state);
+}
+
+void OverflowPercentages(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"overflow_percentage"});
+  for (int percentage : {0, 1, 10, 50}) {
+    benchmark->Args({percentage});
+  }
+}
+
+BENCHMARK(BM_Add)->Apply(OverflowPercentages);
+BENCHMARK(BM_Subtract)->Apply(OverflowPercentages);
+BENCHMARK(BM_Multiply)->Apply(OverflowPercentages);
+BENCHMARK(BM_Reference)->Apply(OverflowPercentages);
+BENCHMARK(BM_MulDiv)->Apply(OverflowPercentages);
+BENCHMARK(BM_Divide)->Apply(OverflowPercentages);
+BENCHMARK(BM_FromFloatRound);
+BENCHMARK(BM_FromFloatCeil);
+
+}  // namespace
+
+}  // namespace blink
@@ -0,0 +1,279 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/layout_unit_span_functions.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "base/check_op.h"
+
+namespace blink {
+
+namespace {
+
+// The number of LayoutUnits handled at a time.
+constexpr size_t kLanes = 4;
+
+// The raw values of kLanes LayoutUnits, which the compiler maps to the SIMD
+// registers of the target, e.g. SSE2 or NEON.
+using Int32x4 = int32_t __attribute__((vector_size(kLanes * sizeof(int32_t))));
+using Uint32x4 =
+    uint32_t __attribute__((vector_size(kLanes * sizeof(uint32_t))));
+using Int64x4 = int64_t __attribute__((vector_size(kLanes * sizeof(int64_t))));
+
+constexpr int32_t kRawValueMax = LayoutUnit::kRawValueMax;
+constexpr int32_t kRawValueMin = LayoutUnit::kRawValueMin;
+
+static_assert(std::is_same_v<decltype(LayoutUnit().RawValue()), int32_t>);
+
+Int32x4 Load(base::span<const LayoutUnit> values) {
+  return Int32x4{values[0].RawValue(), values[1].RawValue(),
+                 values[2].RawValue(), values[3].RawValue()};
+}
+
+void Store(Int32x4 raw_values, base::span<LayoutUnit> values) {
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    values[lane] = LayoutUnit::FromRawValue(raw_values[lane]);
+  }
+}
+
+// The raw value that an overflowing sum or difference saturates to, given the
+// sign of the result before it overflowed.
+Int32x4 SaturatedValue(Int32x4 sign) {
+  return (sign >> 31) ^ kRawValueMax;
+}
+
+// base::ClampAdd() of each lane.
+Int32x4 SaturatedAdd(Int32x4 a, Int32x4 b) {
+  const Int32x4 sum =
+      std::bit_cast<Int32x4>(std::bit_cast<Uint32x4>(a) +
+                             std::bit_cast<Uint32x4>(b));
+  // The sum overflowed if its sign differs from those of both operands. The
+  // comparison gives -1 in the lanes where it's true.
+  const Int32x4 overflowed = ((a ^ sum) & (b ^ sum)) < 0;
+  return overflowed ? SaturatedValue(a) : sum;
+}
+
+// base::ClampSub() of each lane.
+Int32x4 SaturatedSubtract(Int32x4 a, Int32x4 b) {
+  const Int32x4 difference =
+      std::bit_cast<Int32x4>(std::bit_cast<Uint32x4>(a) -
+                             std::bit_cast<Uint32x4>(b));
+  // The difference overflowed if the operands have different signs, and it
+  // doesn't have the sign of |a|.
+  const Int32x4 overflowed = ((a ^ b) & (a ^ difference)) < 0;
+  return overflowed ? SaturatedValue(a) : difference;
+}
+
+// BoundedMultiply() of each lane by |factor|.
+Int32x4 BoundedMultiply(Int32x4 a, int64_t factor) {
+  const Int64x4 product = __builtin_convertvector(a, Int64x4) * factor /
+                          LayoutUnit::kFixedPointDenominator;
+  const Int64x4 max = Int64x4{} + kRawValueMax;
+  const Int64x4 min = Int64x4{} + kRawValueMin;
+  return __builtin_convertvector(
+      product > max ? max : (product < min ? min : product), Int32x4);
+}
+
+// LayoutUnit::Round() of each lane, which is the value plus one half,
+// floored, computed without overflowing.
+Int32x4 Round(Int32x4 raw_values) {
+  constexpr int32_t kFractionMask = LayoutUnit::kFixedPointDenominator - 1;
+  constexpr int32_t kHalf = LayoutUnit::kFixedPointDenominator / 2;
+  return (raw_values >> LayoutUnit::kFractionalBits) +
+         (((raw_values & kFractionMask) + kHalf) >>
+          LayoutUnit::kFractionalBits);
+}
+
+// SnapSizeToPixel() of each lane of |sizes| at the location in the same lane
+// of |locations|.
+Int32x4 SnapSizes(Int32x4 sizes, Int32x4 locations) {
+  // LayoutUnit::Fraction(), which has the sign of the location.
+  const Int32x4 fractions = locations % LayoutUnit::kFixedPointDenominator;
+  const Int32x4 snapped = Round(SaturatedAdd(fractions, sizes)) -
+                          Round(fractions);
+  // Sizes of more than a few raw units don't snap to zero.
+  const Int32x4 at_least_one = (snapped == 0) & ((sizes > 4) | (sizes < -4));
+  const Int32x4 one = sizes > 0 ? Int32x4{} + 1 : Int32x4{} - 1;
+  return at_least_one ? one : snapped;
+}
+
+}  // namespace
+
+void AddLayoutUnits(base::span<LayoutUnit> values,
+                    base::span<const LayoutUnit> addends) {
+  CHECK_EQ(values.size(), addends.size());
+  size_t i = 0;
+  for (; i + kLanes <= values.size(); i += kLanes) {
+    base::span<LayoutUnit> group = values.subspan(i, kLanes);
+    Store(SaturatedAdd(Load(group), Load(addends.subspan(i, kLanes))), group);
+  }
+  for (; i < values.size(); ++i) {
+    values[i] += addends[i];
+  }
+}
+
+void SubtractLayoutUnits(base::span<LayoutUnit> values,
+                         base::span<const LayoutUnit> subtrahends) {
+  CHECK_EQ(values.size(), subtrahends.size());
+  size_t i = 0;
+  for (; i + kLanes <= values.size(); i += kLanes) {
+    base::span<LayoutUnit> group = values.subspan(i, kLanes);
+    Store(SaturatedSubtract(Load(group), Load(subtrahends.subspan(i, kLanes))),
+          group);
+  }
+  for (; i < values.size(); ++i) {
+    values[i] -= subtrahends[i];
+  }
+}
+
+void MultiplyLayoutUnits(base::span<LayoutUnit> values, LayoutUnit factor) {
+  const int64_t raw_factor = factor.RawValue();
+  size_t i = 0;
+  for (; i + kLanes <= values.size(); i += kLanes) {
+    base::span<LayoutUnit> group = values.subspan(i, kLanes);
+    Store(BoundedMultiply(Load(group), raw_factor), group);
+  }
+  for (; i < values.size(); ++i) {
+    values[i] = values[i] * factor;
+  }
+}
+
+LayoutUnit SumOfLayoutUnits(base::span<const LayoutUnit> values) {
+  // The sums of the positive and of the negative values, which can't
+  // overflow 64 bits.
+  Int64x4 positive = {};
+  Int64x4 negative = {};
+  size_t i = 0;
+  for (; i + kLanes <= values.size(); i += kLanes) {
+    const Int64x4 group =
+        __builtin_convertvector(Load(values.subspan(i, kLanes)), Int64x4);
+    positive += group > 0 ? group : Int64x4{};
+    negative += group < 0 ? group : Int64x4{};
+  }
+  int64_t positive_sum = positive[0] + positive[1] + positive[2] + positive[3];
+  int64_t negative_sum = negative[0] + negative[1] + negative[2] + negative[3];
+  for (; i < values.size(); ++i) {
+    const int32_t value = values[i].RawValue();
+    if (value > 0) {
+      positive_sum += value;
+    } else {
+      negative_sum += value;
+    }
+  }
+  // Each partial sum of the values is between |negative_sum| and
+  // |positive_sum|. If that range fits, none of them saturates, and the sum
+  // is exact. If the values all have the same sign, the sum saturates once
+  // and stays saturated, so it's the exact sum clamped.
+  if ((positive_sum <= kRawValueMax && negative_sum >= kRawValueMin) ||
+      !positive_sum || !negative_sum) {
+    return LayoutUnit::FromRawValue(static_cast<int32_t>(std::clamp<int64_t>(
+        positive_sum + negative_sum, kRawValueMin, kRawValueMax)));
+  }
+  LayoutUnit sum;
+  for (LayoutUnit value : values) {
+    sum += value;
+  }
+  return sum;
+}
+
+LayoutUnit MinOfLayoutUnits(base::span<const LayoutUnit> values) {
+  CHECK(!values.empty());
+  size_t i = 0;
+  Int32x4 minimum = Int32x4{} + values[0].RawValue();
+  for (; i + kLanes <= values.size(); i += kLanes) {
+    const Int32x4 group = Load(values.subspan(i, kLanes));
+    minimum = group < minimum ? group : minimum;
+  }
+  int32_t result = std::min({minimum[0], minimum[1], minimum[2], minimum[3]});
+  for (; i < values.size(); ++i) {
+    result = std::min(result, values[i].RawValue());
+  }
+  return LayoutUnit::FromRawValue(result);
+}
+
+LayoutUnit MaxOfLayoutUnits(base::span<const LayoutUnit> values) {
+  CHECK(!values.empty());
+  size_t i = 0;
+  Int32x4 maximum = Int32x4{} + values[0].RawValue();
+  for (; i + kLanes <= values.size(); i += kLanes) {
+    const Int32x4 group = Load(values.subspan(i, kLanes));
+    maximum = group > maximum ? group : maximum;
+  }
+  int32_t result = std::max({maximum[0], maximum[1], maximum[2], maximum[3]});
+  for (; i < values.size(); ++i) {
+    result = std::max(result, values[i].RawValue());
+  }
+  return LayoutUnit::FromRawValue(result);
+}
+
+void RoundLayoutUnits(base::span<const LayoutUnit> values,
+                      base::span<int> results) {
+  CHECK_EQ(values.size(), results.size());
+  size_t i = 0;
+  for (; i + kLanes <= values.size(); i += kLanes) {
+    const Int32x4 rounded = Round(Load(values.subspan(i, kLanes)));
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      results[i + lane] = rounded[lane];
+    }
+  }
+  for (; i < values.size(); ++i) {
+    results[i] = values[i].Round();
+  }
+}
+
+void SnapSizesToPixels(base::span<const LayoutUnit> sizes,
+                       base::span<const LayoutUnit> locations,
+                       base::span<int> results) {
+  CHECK_EQ(sizes.size(), locations.size());
+  CHECK_EQ(sizes.size(), results.size());
+  size_t i = 0;
+  for (; i + kLanes <= sizes.size(); i += kLanes) {
+    const Int32x4 snapped = SnapSizes(Load(sizes.subspan(i, kLanes)),
+                                      Load(locations.subspan(i, kLanes)));
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      results[i + lane] = snapped[lane];
+    }
+  }
+  for (; i < sizes.size(); ++i) {
+    results[i] = SnapSizeToPixel(sizes[i], locations[i]);
+  }
+}
+
+void ToPixelSnappedRects(base::span<const PhysicalOffset> offsets,
+                         base::span<const PhysicalSize> sizes,
+                         base::span<gfx::Rect> results) {
+  CHECK_EQ(offsets.size(), sizes.size());
+  CHECK_EQ(offsets.size(), results.size());
+  // Two rects at a time, with the horizontal and the vertical values of each
+  // in adjacent lanes.
+  constexpr size_t kRects = kLanes / 2;
+  size_t i = 0;
+  for (; i + kRects <= offsets.size(); i += kRects) {
+    const Int32x4 locations = {
+        offsets[i].left.RawValue(), offsets[i].top.RawValue(),
+        offsets[i + 1].left.RawValue(), offsets[i + 1].top.RawValue()};
+    const Int32x4 rounded = Round(locations);
+    const Int32x4 snapped = SnapSizes(
+        Int32x4{sizes[i].width.RawValue(), sizes[i].height.RawValue(),
+                sizes[i + 1].width.RawValue(), sizes[i + 1].height.RawValue()},
+        locations);
+    for (size_t rect = 0; rect < kRects; ++rect) {
+      results[i + rect] =
+          gfx::Rect(rounded[rect * 2], rounded[rect * 2 + 1],
+                    snapped[rect * 2], snapped[rect * 2 + 1]);
+    }
+  }
+  for (; i < offsets.size(); ++i) {
+    results[i] = gfx::Rect(offsets[i].left.Round(), offsets[i].top.Round(),
+                           SnapSizeToPixel(sizes[i].width, offsets[i].left),
+                           SnapSizeToPixel(sizes[i].height, offsets[i].top));
+  }
+}
+
+}  // namespace blink
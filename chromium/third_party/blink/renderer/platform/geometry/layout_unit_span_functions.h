@@ -0,0 +1,64 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LAYOUT_UNIT_SPAN_FUNCTIONS_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LAYOUT_UNIT_SPAN_FUNCTIONS_H_
+
+#include "base/containers/span.h"
+#include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/blink/renderer/platform/geometry/physical_offset.h"
+#include "third_party/blink/renderer/platform/geometry/physical_size.h"
+#include "third_party/blink/renderer/platform/platform_export.h"
+#include "ui/gfx/geometry/rect.h"
+
+namespace blink {
+
+// Arithmetic over arrays of LayoutUnits, e.g. the sizes of the items of a
+// flex line or the tracks of a grid, which handles a few values at a time.
+// The results are the same as those of the LayoutUnit operators on each value,
+// including their saturation.
+
+// Adds to each of |values| the value at the same index of |addends|, which
+// must have the same size.
+PLATFORM_EXPORT void AddLayoutUnits(base::span<LayoutUnit> values,
+                                    base::span<const LayoutUnit> addends);
+// Subtracts from each of |values| the value at the same index of
+// |subtrahends|, which must have the same size.
+PLATFORM_EXPORT void SubtractLayoutUnits(
+    base::span<LayoutUnit> values,
+    base::span<const LayoutUnit> subtrahends);
+// Multiplies each of |values| by |factor|.
+PLATFORM_EXPORT void MultiplyLayoutUnits(base::span<LayoutUnit> values,
+                                         LayoutUnit factor);
+
+// The same as adding |values| in order to LayoutUnit().
+PLATFORM_EXPORT LayoutUnit
+SumOfLayoutUnits(base::span<const LayoutUnit> values);
+// The smallest and the largest of |values|, which must not be empty.
+PLATFORM_EXPORT LayoutUnit
+MinOfLayoutUnits(base::span<const LayoutUnit> values);
+PLATFORM_EXPORT LayoutUnit
+MaxOfLayoutUnits(base::span<const LayoutUnit> values);
+
+// Pixel snapping, e.g. of the fragments painted into a display list. |results|
+// must have the same size as the inputs.
+
+// LayoutUnit::Round() of each of |values|.
+PLATFORM_EXPORT void RoundLayoutUnits(base::span<const LayoutUnit> values,
+                                      base::span<int> results);
+// SnapSizeToPixel() of each of |sizes| at the location at the same index of
+// |locations|.
+PLATFORM_EXPORT void SnapSizesToPixels(base::span<const LayoutUnit> sizes,
+                                       base::span<const LayoutUnit> locations,
+                                       base::span<int> results);
+// The pixel snapped rect of each offset and the size at the same index: the
+// offset rounded, and the size snapped at the offset.
+PLATFORM_EXPORT void ToPixelSnappedRects(
+    base::span<const PhysicalOffset> offsets,
+    base::span<const PhysicalSize> sizes,
+    base::span<gfx::Rect> results);
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LAYOUT_UNIT_SPAN_FUNCTIONS_H_
@@ -0,0 +1,134 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/layout_unit_span_functions.h"
+
+#include <algorithm>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+namespace {
+
+// Values of each sign, around the limits, and with fractions, enough of them
+// to fill several groups and a remainder.
+Vector<LayoutUnit> TestValues() {
+  return {LayoutUnit(1),          LayoutUnit(-2.5),
+          LayoutUnit::Max(),      LayoutUnit::Min(),
+          LayoutUnit(0),          LayoutUnit(1000.25),
+          LayoutUnit(-300),       LayoutUnit::NearlyMax(),
+          LayoutUnit::NearlyMin(), LayoutUnit(7.75),
+          LayoutUnit(-0.015625)};
+}
+
+}  // namespace
+
+TEST(LayoutUnitSpanFunctionsTest, AddAndSubtract) {
+  const Vector<LayoutUnit> values = TestValues();
+  Vector<LayoutUnit> operands = TestValues();
+  std::ranges::reverse(operands);
+
+  Vector<LayoutUnit> sums = values;
+  AddLayoutUnits(sums, operands);
+  Vector<LayoutUnit> differences = values;
+  SubtractLayoutUnits(differences, operands);
+  for (wtf_size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values[i] + operands[i], sums[i]) << i;
+    EXPECT_EQ(values[i] - operands[i], differences[i]) << i;
+  }
+}
+
+TEST(LayoutUnitSpanFunctionsTest, Multiply) {
+  const Vector<LayoutUnit> values = TestValues();
+  for (LayoutUnit factor : TestValues()) {
+    Vector<LayoutUnit> products = values;
+    MultiplyLayoutUnits(products, factor);
+    for (wtf_size_t i = 0; i < values.size(); ++i) {
+      EXPECT_EQ(values[i] * factor, products[i]) << i << " " << factor;
+    }
+  }
+}
+
+TEST(LayoutUnitSpanFunctionsTest, Sum) {
+  auto sum_in_order = [](base::span<const LayoutUnit> values) {
+    LayoutUnit sum;
+    for (LayoutUnit value : values) {
+      sum += value;
+    }
+    return sum;
+  };
+  const Vector<LayoutUnit> values = TestValues();
+  // Values of both signs around the limits are added in order.
+  EXPECT_EQ(sum_in_order(values), SumOfLayoutUnits(values));
+
+  const Vector<LayoutUnit> positive = {
+      LayoutUnit(1), LayoutUnit::NearlyMax(), LayoutUnit(2), LayoutUnit(3),
+      LayoutUnit(4), LayoutUnit(5)};
+  EXPECT_EQ(LayoutUnit::Max(), SumOfLayoutUnits(positive));
+
+  const Vector<LayoutUnit> small = {LayoutUnit(1.5), LayoutUnit(-2),
+                                    LayoutUnit(3),   LayoutUnit(4),
+                                    LayoutUnit(-5),  LayoutUnit(0.25)};
+  EXPECT_EQ(LayoutUnit(1.75), SumOfLayoutUnits(small));
+  EXPECT_EQ(LayoutUnit(), SumOfLayoutUnits({}));
+}
+
+TEST(LayoutUnitSpanFunctionsTest, MinAndMax) {
+  const Vector<LayoutUnit> values = TestValues();
+  EXPECT_EQ(LayoutUnit::Min(), MinOfLayoutUnits(values));
+  EXPECT_EQ(LayoutUnit::Max(), MaxOfLayoutUnits(values));
+
+  const Vector<LayoutUnit> tail = {LayoutUnit(3), LayoutUnit(4),
+                                   LayoutUnit(5), LayoutUnit(6),
+                                   LayoutUnit(-1)};
+  EXPECT_EQ(LayoutUnit(-1), MinOfLayoutUnits(tail));
+  EXPECT_EQ(LayoutUnit(6), MaxOfLayoutUnits(tail));
+}
+
+TEST(LayoutUnitSpanFunctionsTest, Round) {
+  const Vector<LayoutUnit> values = TestValues();
+  Vector<int> rounded(values.size());
+  RoundLayoutUnits(values, rounded);
+  for (wtf_size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(values[i].Round(), rounded[i]) << values[i];
+  }
+}
+
+TEST(LayoutUnitSpanFunctionsTest, SnapSizes) {
+  const Vector<LayoutUnit> sizes = TestValues();
+  for (LayoutUnit location :
+       {LayoutUnit(), LayoutUnit(0.5), LayoutUnit(-0.75), LayoutUnit(10.25),
+        LayoutUnit::Max(), LayoutUnit::Min()}) {
+    const Vector<LayoutUnit> locations(sizes.size(), location);
+    Vector<int> snapped(sizes.size());
+    SnapSizesToPixels(sizes, locations, snapped);
+    for (wtf_size_t i = 0; i < sizes.size(); ++i) {
+      EXPECT_EQ(SnapSizeToPixel(sizes[i], location), snapped[i])
+          << sizes[i] << " at " << location;
+    }
+  }
+}
+
+TEST(LayoutUnitSpanFunctionsTest, PixelSnappedRects) {
+  const Vector<LayoutUnit> values = TestValues();
+  Vector<PhysicalOffset> offsets;
+  Vector<PhysicalSize> sizes;
+  for (wtf_size_t i = 0; i + 1 < values.size(); ++i) {
+    offsets.push_back(PhysicalOffset(values[i], values[i + 1]));
+    sizes.push_back(PhysicalSize(values[values.size() - i - 1], values[i]));
+  }
+  Vector<gfx::Rect> rects(offsets.size());
+  ToPixelSnappedRects(offsets, sizes, rects);
+  for (wtf_size_t i = 0; i < offsets.size(); ++i) {
+    EXPECT_EQ(gfx::Rect(offsets[i].left.Round(), offsets[i].top.Round(),
+                        SnapSizeToPixel(sizes[i].width, offsets[i].left),
+                        SnapSizeToPixel(sizes[i].height, offsets[i].top)),
+              rects[i])
+        << i;
+  }
+}
+
+}  // namespace blink
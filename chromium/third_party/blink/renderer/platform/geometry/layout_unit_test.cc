@@ -337,6 +337,14 @@ TEST(LayoutUnitTest, LayoutUnitMultiplication) {
   EXPECT_EQ(LayoutUnit::kIntMax, (overflow_int_size_t * LayoutUnit(4)).ToInt());
   EXPECT_EQ(LayoutUnit::kIntMax, (LayoutUnit(4) * overflow_int_size_t).ToInt());
 
+  // Products that overflow saturate to the limit of their sign.
+  EXPECT_EQ(LayoutUnit::Max(), LayoutUnit::Max() * LayoutUnit::Max());
+  EXPECT_EQ(LayoutUnit::Max(), LayoutUnit::Min() * LayoutUnit::Min());
+  EXPECT_EQ(LayoutUnit::Min(), LayoutUnit::Max() * LayoutUnit::Min());
+  EXPECT_EQ(LayoutUnit::Min(), LayoutUnit(-quarter_max) * LayoutUnit(5));
+  EXPECT_EQ(LayoutUnit::Min(), LayoutUnit::Min() * LayoutUnit(1));
+  EXPECT_EQ(LayoutUnit(), LayoutUnit::Min() * LayoutUnit());
+
   {
     // Multiple by float 1.0 can produce a different value.
     LayoutUnit source = LayoutUnit::FromRawValue(2147483009);
@@ -635,4 +643,61 @@ TEST(LayoutUnitTest, Raw64Ceil) {
   EXPECT_EQ(layout.AddEpsilon(), inline_value.ToCeil<LayoutUnit>());
 }
 
+TEST(LayoutUnitTest, Accumulator) {
+  LayoutUnitAccumulator accumulator;
+  EXPECT_EQ(LayoutUnit(), accumulator.ToLayoutUnit());
+  accumulator += LayoutUnit(1.5);
+  accumulator += LayoutUnit(2.25);
+  accumulator -= LayoutUnit(0.75);
+  EXPECT_EQ(LayoutUnit(3), accumulator.ToLayoutUnit());
+
+  // The partial sums don't saturate, so the order doesn't matter.
+  LayoutUnitAccumulator max_first(LayoutUnit::Max());
+  max_first += LayoutUnit(10);
+  max_first -= LayoutUnit(20);
+  LayoutUnitAccumulator max_last(LayoutUnit(-20));
+  max_last += LayoutUnit(10);
+  max_last += LayoutUnit::Max();
+  EXPECT_EQ(LayoutUnit::Max() - LayoutUnit(10), max_first.ToLayoutUnit());
+  EXPECT_EQ(max_first.ToLayoutUnit(), max_last.ToLayoutUnit());
+
+  // The sum saturates once.
+  LayoutUnitAccumulator large;
+  for (int i = 0; i < 4; ++i) {
+    large += LayoutUnit::Max();
+  }
+  EXPECT_EQ(LayoutUnit::Max(), large.ToLayoutUnit());
+  for (int i = 0; i < 8; ++i) {
+    large -= LayoutUnit::Max();
+  }
+  EXPECT_EQ(LayoutUnit::Min(), large.ToLayoutUnit());
+}
+
+TEST(LayoutUnitTest, Divider) {
+  const LayoutUnit values[] = {LayoutUnit(),
+                               LayoutUnit(1),
+                               LayoutUnit(-1),
+                               LayoutUnit(3.5),
+                               LayoutUnit(-7.25),
+                               LayoutUnit(100),
+                               LayoutUnit(12345.67),
+                               LayoutUnit::FromRawValue(1),
+                               LayoutUnit::FromRawValue(-1),
+                               LayoutUnit::FromRawValue(63),
+                               LayoutUnit::Max(),
+                               LayoutUnit::Min(),
+                               LayoutUnit::NearlyMax(),
+                               LayoutUnit::NearlyMin()};
+  for (LayoutUnit divisor : values) {
+    if (!divisor) {
+      continue;
+    }
+    const LayoutUnitDivider divider(divisor);
+    for (LayoutUnit dividend : values) {
+      EXPECT_EQ(dividend / divisor, divider.Divide(dividend))
+          << dividend << " / " << divisor;
+    }
+  }
+}
+
 }  // namespace blink
@@ -26,11 +26,13 @@
 #include "third_party/blink/renderer/platform/geometry/length.h"
 
 #include <array>
+#include <optional>
 
 #include "third_party/blink/renderer/platform/geometry/blend.h"
 #include "third_party/blink/renderer/platform/geometry/calculation_value.h"
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_hash_map.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
 #include "third_party/blink/renderer/platform/wtf/size_assertions.h"
 #include "third_party/blink/renderer/platform/wtf/static_constructors.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
@@ -74,19 +76,43 @@ class CalculationValueHandleMap
     void Trace(Visitor* visitor) const { visitor->Trace(value); }
     Member<const CalculationValue> value;
     unsigned count = 1u;
+    // The key of the handle in `handles_by_hash_`, if it's there.
+    std::optional<unsigned> interned_hash;
   };
 
   void Trace(Visitor* visitor) const { visitor->Trace(map_); }
 
   int insert(const CalculationValue* calc_value) {
     DCHECK(index_);
+    // Expressions are interned, so that identical ones, e.g. from the same
+    // calc() on many elements, share one value with its program and memo.
+    // Values with colliding hashes, or hashes that can't be keys, aren't.
+    std::optional<unsigned> hash;
+    if (calc_value->IsExpression()) {
+      hash = calc_value->GetHash();
+      if (IsHashTraitsEmptyOrDeletedValue<HashTraits<unsigned>>(*hash)) {
+        hash.reset();
+      } else if (auto it = handles_by_hash_.find(*hash);
+                 it != handles_by_hash_.end()) {
+        MemberWithCount& interned = map_.find(it->value)->value;
+        if (interned.value->IsIdentical(*calc_value)) {
+          ++interned.count;
+          return it->value;
+        }
+        hash.reset();
+      }
+    }
+
     // FIXME calc(): https://bugs.webkit.org/show_bug.cgi?id=80489
     // This monotonically increasing handle generation scheme is potentially
     // wasteful of the handle space. Consider reusing empty handles.
     while (map_.Contains(index_))
       index_++;
 
-    map_.Set(index_, MemberWithCount(calc_value, 1u));
+    map_.Set(index_, MemberWithCount(calc_value, 1u, hash));
+    if (hash) {
+      handles_by_hash_.insert(*hash, index_);
+    }
 
     return index_;
   }
@@ -108,6 +134,9 @@ class CalculationValueHandleMap
     auto iter = map_.find(index);
     --iter->value.count;
     if (iter->value.count == 0u) {
+      if (iter->value.interned_hash) {
+        handles_by_hash_.erase(*iter->value.interned_hash);
+      }
       map_.erase(index);
     }
   }
@@ -121,6 +150,7 @@ class CalculationValueHandleMap
  private:
   int index_ = 1;
   HeapHashMap<int, MemberWithCount> map_;
+  HashMap<unsigned, int> handles_by_hash_;
 };
 
 static CalculationValueHandleMap& CalcHandles() {
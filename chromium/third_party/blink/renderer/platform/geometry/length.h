@@ -164,6 +164,13 @@ class PLATFORM_EXPORT Length {
       IncrementCalculatedCount();
   }
 
+  // Moving a calculated Length transfers its handle, and leaves |length| as
+  // Auto(), without changing the count of the handle.
+  Length(Length&& length) noexcept {
+    UNSAFE_TODO(memcpy(this, &length, sizeof(Length)));
+    length.ResetAfterMove();
+  }
+
   Length& operator=(const Length& length) {
     if (length.IsCalculated())
       length.IncrementCalculatedCount();
@@ -173,6 +180,17 @@ class PLATFORM_EXPORT Length {
     return *this;
   }
 
+  Length& operator=(Length&& length) noexcept {
+    if (this == &length) {
+      return *this;
+    }
+    if (IsCalculated())
+      DecrementCalculatedCount();
+    UNSAFE_TODO(memcpy(this, &length, sizeof(Length)));
+    length.ResetAfterMove();
+    return *this;
+  }
+
   ~Length() {
     if (IsCalculated())
       DecrementCalculatedCount();
@@ -386,6 +404,8 @@ class PLATFORM_EXPORT Length {
   unsigned GetHash() const;
 
  private:
+  friend class ScopedLengthResolutionCache;
+
   float GetFloatValue() const {
     DCHECK(!IsNone());
     DCHECK(!IsCalculated());
@@ -403,6 +423,12 @@ class PLATFORM_EXPORT Length {
   void IncrementCalculatedCount() const;
   void DecrementCalculatedCount() const;
 
+  void ResetAfterMove() {
+    value_ = 0;
+    quirk_ = false;
+    type_ = kAuto;
+  }
+
   union {
     // If kType == kCalculated.
     int calculation_handle_;
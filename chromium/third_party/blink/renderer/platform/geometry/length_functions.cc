@@ -23,14 +23,75 @@
 
 #include "third_party/blink/renderer/platform/geometry/length_functions.h"
 
+#include <bit>
+
+#include "base/check_op.h"
 #include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/blink/renderer/platform/geometry/length_box.h"
 #include "third_party/blink/renderer/platform/geometry/length_point.h"
 #include "third_party/blink/renderer/platform/geometry/length_size.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/size_f.h"
 
 namespace blink {
 
+namespace {
+
+constinit thread_local ScopedLengthResolutionCache* g_current_cache = nullptr;
+
+bool IsDefaultInput(const EvaluationInput& input) {
+  return !input.size_keyword_basis && !input.intrinsic_evaluator &&
+         input.calc_size_keyword_behavior ==
+             CalcSizeKeywordBehavior::kAsSpecified &&
+         input.color_channel_keyword_values.empty();
+}
+
+float NonNanCalculatedValue(const Length& length,
+                            float maximum_value,
+                            const EvaluationInput& input) {
+  if (g_current_cache && IsDefaultInput(input)) {
+    return g_current_cache->NonNanCalculatedValue(length, maximum_value);
+  }
+  return length.NonNanCalculatedValue(maximum_value, input);
+}
+
+}  // namespace
+
+ScopedLengthResolutionCache::ScopedLengthResolutionCache(wtf_size_t capacity)
+    : previous_(g_current_cache), capacity_(capacity) {
+  DCHECK_GT(capacity_, 0u);
+  g_current_cache = this;
+}
+
+ScopedLengthResolutionCache::~ScopedLengthResolutionCache() {
+  DCHECK_EQ(g_current_cache, this);
+  g_current_cache = previous_;
+}
+
+// static
+ScopedLengthResolutionCache* ScopedLengthResolutionCache::Current() {
+  return g_current_cache;
+}
+
+float ScopedLengthResolutionCache::NonNanCalculatedValue(const Length& length,
+                                                         float maximum_value) {
+  // Handles start at 1, so the keys are never the empty value, 0, or the
+  // deleted value, all ones.
+  const uint64_t key =
+      (static_cast<uint64_t>(length.CalculationHandle()) << 32) |
+      std::bit_cast<uint32_t>(maximum_value);
+  if (auto it = results_.find(key); it != results_.end()) {
+    return it->value;
+  }
+  if (results_.size() >= capacity_) {
+    results_.clear();
+  }
+  const float result = length.NonNanCalculatedValue(maximum_value, {});
+  results_.insert(key, result);
+  return result;
+}
+
 int IntValueForLength(const Length& length, int maximum_value) {
   return ValueForLength(length, LayoutUnit(maximum_value)).ToInt();
 }
@@ -47,7 +108,7 @@ float FloatValueForLength(const Length& length,
     case Length::kAuto:
       return static_cast<float>(maximum_value);
     case Length::kCalculated:
-      return length.NonNanCalculatedValue(maximum_value, input);
+      return NonNanCalculatedValue(length, maximum_value, input);
     case Length::kMinContent:
     case Length::kMaxContent:
     case Length::kMinIntrinsic:
@@ -73,7 +134,7 @@ LayoutUnit MinimumValueForLengthInternal(const Length& length,
       return LayoutUnit(
           static_cast<float>(maximum_value * length.Percent() / 100.0f));
     case Length::kCalculated:
-      return LayoutUnit(length.NonNanCalculatedValue(maximum_value, input));
+      return LayoutUnit(NonNanCalculatedValue(length, maximum_value, input));
     case Length::kStretch:
     case Length::kAuto:
       return LayoutUnit();
@@ -119,6 +180,35 @@ LayoutUnit ValueForLength(const Length& length,
   NOTREACHED();
 }
 
+LengthBoxValues ResolveLengthBox(const LengthBox& box,
+                                 LayoutUnit percent_base,
+                                 const EvaluationInput& input) {
+  const Length::Type type = box.Top().GetType();
+  const bool same_type = box.Right().GetType() == type &&
+                         box.Bottom().GetType() == type &&
+                         box.Left().GetType() == type;
+  if (same_type && type == Length::kFixed) {
+    return {LayoutUnit(box.Top().Pixels()), LayoutUnit(box.Right().Pixels()),
+            LayoutUnit(box.Bottom().Pixels()), LayoutUnit(box.Left().Pixels())};
+  }
+  if (same_type && type == Length::kPercent) {
+    // The same float math as MinimumValueForLengthInternal(), for all of the
+    // sides at once.
+    const float base = percent_base.ToFloat();
+    const gfx::Float4 values =
+        gfx::Float4{base, base, base, base} *
+        gfx::Float4{box.Top().Percent(), box.Right().Percent(),
+                    box.Bottom().Percent(), box.Left().Percent()} /
+        100.0f;
+    return {LayoutUnit(values[0]), LayoutUnit(values[1]),
+            LayoutUnit(values[2]), LayoutUnit(values[3])};
+  }
+  return {MinimumValueForLength(box.Top(), percent_base, input),
+          MinimumValueForLength(box.Right(), percent_base, input),
+          MinimumValueForLength(box.Bottom(), percent_base, input),
+          MinimumValueForLength(box.Left(), percent_base, input)};
+}
+
 gfx::SizeF SizeForLengthSize(const LengthSize& length_size,
                              const gfx::SizeF& box_size) {
   return gfx::SizeF(
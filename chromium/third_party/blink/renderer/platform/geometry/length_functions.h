@@ -24,10 +24,14 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LENGTH_FUNCTIONS_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_LENGTH_FUNCTIONS_H_
 
+#include <stdint.h>
+
 #include "third_party/blink/renderer/platform/geometry/evaluation_input.h"
 #include "third_party/blink/renderer/platform/geometry/layout_unit.h"
 #include "third_party/blink/renderer/platform/geometry/length.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
 
 namespace gfx {
 class PointF;
@@ -37,10 +41,47 @@ class SizeF;
 namespace blink {
 
 class Length;
+class LengthBox;
 class LengthSize;
 
 struct LengthPoint;
 
+// Memoizes the calc() Lengths resolved by ValueForLength(),
+// MinimumValueForLength() and FloatValueForLength() on the current thread for
+// its lifetime, e.g. around a layout pass, which resolves the same calc()
+// sizes of siblings against the same container size many times. The results
+// are keyed by the calc() value of the Length, whose handle isn't reused, and
+// the maximum value; the other types of Lengths resolve faster than a lookup.
+// Resolutions with an EvaluationInput other than the default, e.g. with an
+// intrinsic evaluator, bypass it. The cache holds at most |capacity| results,
+// and is cleared when a new one would exceed that.
+class PLATFORM_EXPORT ScopedLengthResolutionCache {
+  STACK_ALLOCATED();
+
+ public:
+  static constexpr wtf_size_t kDefaultCapacity = 1024;
+
+  explicit ScopedLengthResolutionCache(wtf_size_t capacity = kDefaultCapacity);
+  ScopedLengthResolutionCache(const ScopedLengthResolutionCache&) = delete;
+  ScopedLengthResolutionCache& operator=(const ScopedLengthResolutionCache&) =
+      delete;
+  ~ScopedLengthResolutionCache();
+
+  // Returns the innermost cache of the current thread, or null.
+  static ScopedLengthResolutionCache* Current();
+
+  // The same as Length::NonNanCalculatedValue() with the default
+  // EvaluationInput.
+  float NonNanCalculatedValue(const Length& length, float maximum_value);
+
+  wtf_size_t size() const { return results_.size(); }
+
+ private:
+  ScopedLengthResolutionCache* const previous_;
+  const wtf_size_t capacity_;
+  HashMap<uint64_t, float> results_;
+};
+
 PLATFORM_EXPORT int IntValueForLength(const Length&, int maximum_value);
 PLATFORM_EXPORT float FloatValueForLength(const Length&,
                                           float maximum_value,
@@ -63,6 +104,24 @@ inline LayoutUnit MinimumValueForLength(const Length& length,
 PLATFORM_EXPORT LayoutUnit ValueForLength(const Length&,
                                           LayoutUnit maximum_value,
                                           const EvaluationInput& input = {});
+// The sides of a LengthBox resolved by ResolveLengthBox().
+struct LengthBoxValues {
+  DISALLOW_NEW();
+
+  LayoutUnit top;
+  LayoutUnit right;
+  LayoutUnit bottom;
+  LayoutUnit left;
+};
+
+// The same as MinimumValueForLength() of each side of |box|, e.g. for margins
+// and paddings. The sides are resolved together if they're all fixed or all
+// percentages.
+PLATFORM_EXPORT LengthBoxValues
+ResolveLengthBox(const LengthBox& box,
+                 LayoutUnit percent_base,
+                 const EvaluationInput& input = {});
+
 PLATFORM_EXPORT gfx::SizeF SizeForLengthSize(const LengthSize&,
                                              const gfx::SizeF& box_size);
 PLATFORM_EXPORT gfx::PointF PointForLengthPoint(const LengthPoint&,
@@ -5,6 +5,8 @@
 #include "third_party/blink/renderer/platform/geometry/length_functions.h"
 
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_value.h"
+#include "third_party/blink/renderer/platform/geometry/length_box.h"
 
 namespace blink {
 
@@ -14,4 +16,67 @@ TEST(LengthFunctionsTest, OutOfRangePercentage) {
   EXPECT_TRUE(isfinite(value));
 }
 
+TEST(LengthFunctionsTest, ResolveLengthBox) {
+  const LayoutUnit percent_base(333);
+  const LengthBox boxes[] = {
+      LengthBox(1, 2, 3, 4),
+      LengthBox(Length::Fixed(0.3), Length::Fixed(-2.7), Length::Fixed(1e20),
+                Length::Fixed(5)),
+      LengthBox(Length::Percent(10), Length::Percent(33.3),
+                Length::Percent(-5), Length::Percent(0)),
+      LengthBox(Length::Fixed(10), Length::Percent(20), Length::Auto(),
+                Length::Percent(7)),
+  };
+  for (const LengthBox& box : boxes) {
+    const LengthBoxValues values = ResolveLengthBox(box, percent_base);
+    EXPECT_EQ(MinimumValueForLength(box.Top(), percent_base), values.top);
+    EXPECT_EQ(MinimumValueForLength(box.Right(), percent_base), values.right);
+    EXPECT_EQ(MinimumValueForLength(box.Bottom(), percent_base),
+              values.bottom);
+    EXPECT_EQ(MinimumValueForLength(box.Left(), percent_base), values.left);
+  }
+}
+
+TEST(LengthFunctionsTest, ScopedLengthResolutionCache) {
+  // calc(20px + 10%).
+  const Length calc(MakeGarbageCollected<CalculationValue>(
+      PixelsAndPercent(20, 10, /*has_explicit_pixels=*/true,
+                       /*has_explicit_percent=*/true),
+      Length::ValueRange::kAll));
+  const Length percent = Length::Percent(50);
+  EXPECT_EQ(nullptr, ScopedLengthResolutionCache::Current());
+
+  {
+    ScopedLengthResolutionCache cache;
+    EXPECT_EQ(&cache, ScopedLengthResolutionCache::Current());
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ(LayoutUnit(30), ValueForLength(calc, LayoutUnit(100)));
+      EXPECT_EQ(LayoutUnit(30), MinimumValueForLength(calc, LayoutUnit(100)));
+      EXPECT_EQ(40, FloatValueForLength(calc, 200));
+      EXPECT_EQ(LayoutUnit(50), ValueForLength(percent, LayoutUnit(100)));
+    }
+    // One result for each maximum value, and none for the percentage.
+    EXPECT_EQ(2u, cache.size());
+
+    // Resolutions with an EvaluationInput bypass the cache.
+    EvaluationInput input;
+    input.size_keyword_basis = 10;
+    EXPECT_EQ(60, FloatValueForLength(calc, 400, input));
+    EXPECT_EQ(2u, cache.size());
+
+    {
+      // The innermost cache is the current one.
+      ScopedLengthResolutionCache inner(/*capacity=*/1);
+      EXPECT_EQ(LayoutUnit(30), ValueForLength(calc, LayoutUnit(100)));
+      EXPECT_EQ(1u, inner.size());
+      // Beyond the capacity, the cache is cleared.
+      EXPECT_EQ(40, FloatValueForLength(calc, 200));
+      EXPECT_EQ(1u, inner.size());
+    }
+    EXPECT_EQ(&cache, ScopedLengthResolutionCache::Current());
+    EXPECT_EQ(2u, cache.size());
+  }
+  EXPECT_EQ(nullptr, ScopedLengthResolutionCache::Current());
+}
+
 }  // namespace blink
@@ -0,0 +1,200 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Microbenchmarks of the resolution of Lengths, for the
+// blink_platform_perftests target. BM_ValueForLength runs for every kind of
+// Length in LengthKind, which are the types that ValueForLength() accepts and
+// representative calc() expressions, and BM_CalculationValueEvaluate runs for
+// the calc() ones. Each resolves the Length against many percentage bases and
+// reports the time per resolution in the time_per_eval counter. Run with
+// --benchmark_format=json to get results that can be diffed across versions,
+// e.g. with tools/compare.py of google_benchmark, which reports the
+// statistically significant changes.
+
+#include <string>
+#include <vector>
+
+#include "third_party/blink/renderer/platform/geometry/calculation_expression_node.h"
+#include "third_party/blink/renderer/platform/geometry/calculation_value.h"
+#include "third_party/blink/renderer/platform/geometry/length.h"
+#include "third_party/blink/renderer/platform/geometry/length_functions.h"
+#include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace blink {
+
+namespace {
+
+enum class LengthKind {
+  kFixed,
+  kPercent,
+  kAuto,
+  kStretch,
+  // calc(20px + 10%), which is stored as a PixelsAndPercent.
+  kCalcPixelsAndPercent,
+  // min(100px, 50%).
+  kCalcMin,
+  // clamp(10px, 20px + 10%, 50%).
+  kCalcClamp,
+  // calc(min(100px, 50%) * 3 - 5px), which has nested operations.
+  kCalcNested,
+};
+constexpr int kNumLengthKinds = 8;
+constexpr int kFirstCalculatedKind =
+    static_cast<int>(LengthKind::kCalcPixelsAndPercent);
+
+const char* LengthKindName(LengthKind kind) {
+  switch (kind) {
+    case LengthKind::kFixed:
+      return "fixed";
+    case LengthKind::kPercent:
+      return "percent";
+    case LengthKind::kAuto:
+      return "auto";
+    case LengthKind::kStretch:
+      return "stretch";
+    case LengthKind::kCalcPixelsAndPercent:
+      return "calc_pixels_and_percent";
+    case LengthKind::kCalcMin:
+      return "calc_min";
+    case LengthKind::kCalcClamp:
+      return "calc_clamp";
+    case LengthKind::kCalcNested:
+      return "calc_nested";
+  }
+}
+
+const CalculationExpressionNode* Pixels(float pixels) {
+  return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+      PixelsAndPercent(pixels));
+}
+
+const CalculationExpressionNode* Percent(float percent) {
+  return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+      PixelsAndPercent(0, percent, /*has_explicit_pixels=*/false,
+                       /*has_explicit_percent=*/true));
+}
+
+const CalculationExpressionNode* PixelsAndPercentNode(float pixels,
+                                                      float percent) {
+  return MakeGarbageCollected<CalculationExpressionPixelsAndPercentNode>(
+      PixelsAndPercent(pixels, percent, /*has_explicit_pixels=*/true,
+                       /*has_explicit_percent=*/true));
+}
+
+const CalculationExpressionNode* Operation(
+    CalculationExpressionOperationNode::Children&& children,
+    CalculationOperator op) {
+  return MakeGarbageCollected<CalculationExpressionOperationNode>(
+      std::move(children), op);
+}
+
+Length MakeCalculatedLength(const CalculationExpressionNode* expression) {
+  return Length(
+      CalculationValue::CreateSimplified(expression, Length::ValueRange::kAll));
+}
+
+Length MakeLength(LengthKind kind) {
+  switch (kind) {
+    case LengthKind::kFixed:
+      return Length::Fixed(42.5f);
+    case LengthKind::kPercent:
+      return Length::Percent(37.5f);
+    case LengthKind::kAuto:
+      return Length();
+    case LengthKind::kStretch:
+      return Length(Length::kStretch);
+    case LengthKind::kCalcPixelsAndPercent:
+      return Length(MakeGarbageCollected<CalculationValue>(
+          PixelsAndPercent(20, 10, /*has_explicit_pixels=*/true,
+                           /*has_explicit_percent=*/true),
+          Length::ValueRange::kAll));
+    case LengthKind::kCalcMin:
+      return MakeCalculatedLength(
+          Operation({Pixels(100), Percent(50)}, CalculationOperator::kMin));
+    case LengthKind::kCalcClamp:
+      return MakeCalculatedLength(Operation(
+          {Pixels(10), PixelsAndPercentNode(20, 10), Percent(50)},
+          CalculationOperator::kClamp));
+    case LengthKind::kCalcNested:
+      return MakeCalculatedLength(Operation(
+          {Operation({Operation({Pixels(100), Percent(50)},
+                                CalculationOperator::kMin),
+                      MakeGarbageCollected<CalculationExpressionNumberNode>(3)},
+                     CalculationOperator::kMultiply),
+           Pixels(5)},
+          CalculationOperator::kSubtract));
+  }
+}
+
+constexpr size_t kNumBases = 1024;
+
+// Percentage bases of widths of typical boxes, which differ so that the
+// results can't be reused.
+std::vector<LayoutUnit> MakeBases() {
+  std::vector<LayoutUnit> bases;
+  for (size_t i = 0; i < kNumBases; ++i) {
+    bases.push_back(
+        LayoutUnit::FromRawValue(static_cast<int>(i * 997 % 65536)));
+  }
+  return bases;
+}
+
+LengthKind GetKind(benchmark::State& state) {
+  auto kind = static_cast<LengthKind>(state.range(0));
+  state.SetLabel(LengthKindName(kind));
+  return kind;
+}
+
+void SetTimePerEval(benchmark::State& state) {
+  state.counters["time_per_eval"] = benchmark::Counter(
+      kNumBases, benchmark::Counter::kIsIterationInvariantRate |
+                     benchmark::Counter::kInvert);
+}
+
+// Each iteration resolves the Length against all the bases, so that the cost
+// of the loop is amortized.
+void BM_ValueForLength(benchmark::State& state) {
+  const Length length = MakeLength(GetKind(state));
+  const std::vector<LayoutUnit> bases = MakeBases();
+  for (auto _ : state) {
+    for (LayoutUnit base : bases) {
+      benchmark::DoNotOptimize(ValueForLength(length, base));
+    }
+  }
+  SetTimePerEval(state);
+}
+
+void BM_CalculationValueEvaluate(benchmark::State& state) {
+  const Length length = MakeLength(GetKind(state));
+  const CalculationValue& calculation = length.GetCalculationValue();
+  const std::vector<LayoutUnit> bases = MakeBases();
+  for (auto _ : state) {
+    for (LayoutUnit base : bases) {
+      benchmark::DoNotOptimize(calculation.Evaluate(base.ToFloat()));
+    }
+  }
+  SetTimePerEval(state);
+}
+
+void LengthKinds(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"kind"});
+  for (int kind = 0; kind < kNumLengthKinds; ++kind) {
+    benchmark->Args({kind});
+  }
+}
+
+void CalculatedLengthKinds(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgNames({"kind"});
+  for (int kind = kFirstCalculatedKind; kind < kNumLengthKinds; ++kind) {
+    benchmark->Args({kind});
+  }
+}
+
+BENCHMARK(BM_ValueForLength)->Apply(LengthKinds);
+BENCHMARK(BM_CalculationValueEvaluate)->Apply(CalculatedLengthKinds);
+
+}  // namespace
+
+}  // namespace blink
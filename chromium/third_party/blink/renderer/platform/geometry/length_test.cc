@@ -4,6 +4,9 @@
 
 #include "third_party/blink/renderer/platform/geometry/length.h"
 
+#include <iterator>
+#include <type_traits>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/platform/geometry/calculation_expression_node.h"
 #include "third_party/blink/renderer/platform/geometry/calculation_value.h"
@@ -255,6 +258,46 @@ TEST_F(LengthTest, EvaluateAdditive) {
   }
 }
 
+TEST_F(LengthTest, EvaluateRepeatedly) {
+  // max(10%, 10px) - 20px, which is non-negative.
+  const CalculationValue* value = CalculationValue::CreateSimplified(
+      Subtract(Max({PixelsAndPercent(ten_percent), PixelsAndPercent(ten_px)}),
+               PixelsAndPercent(twenty_px)),
+      Length::ValueRange::kNonNegative);
+  ASSERT_TRUE(value->IsExpression());
+  // The last result is reused only for the same max value.
+  EXPECT_EQ(10.0f, value->Evaluate(300));
+  EXPECT_EQ(10.0f, value->Evaluate(300));
+  EXPECT_EQ(0.0f, value->Evaluate(100));
+  EXPECT_EQ(0.0f, value->Evaluate(100));
+  EXPECT_EQ(20.0f, value->Evaluate(400));
+  EXPECT_EQ(10.0f, value->Evaluate(300));
+}
+
+TEST_F(LengthTest, EvaluateMany) {
+  const float max_values[] = {-100, 0, 50, 100, 150, 200, 1000};
+  float results[std::size(max_values)];
+  const CalculationValue* values[] = {
+      // 20px + 10%
+      MakeGarbageCollected<CalculationValue>(twenty_px_ten_percent,
+                                             Length::ValueRange::kAll),
+      // clamp(10px, 10% + 10px, 30%) * 2
+      CalculationValue::CreateSimplified(
+          Multiply(Clamp({PixelsAndPercent(ten_px),
+                          Add(PixelsAndPercent(ten_percent),
+                              PixelsAndPercent(ten_px)),
+                          PixelsAndPercent(thirty_percent)}),
+                   2),
+          Length::ValueRange::kNonNegative),
+  };
+  for (const CalculationValue* value : values) {
+    value->EvaluateMany(max_values, results);
+    for (size_t i = 0; i < std::size(max_values); ++i) {
+      EXPECT_EQ(value->Evaluate(max_values[i]), results[i]) << max_values[i];
+    }
+  }
+}
+
 TEST_F(LengthTest, EvaluateMultiplicative) {
   // min(10px, 10%) * 2
   {
@@ -387,6 +430,32 @@ TEST_F(LengthTest, ZoomExpression) {
   }
 }
 
+TEST_F(LengthTest, ZoomExpressionLazily) {
+  // max(10px, 10%) + 20px
+  const CalculationExpressionNode* expression =
+      Add(Max({PixelsAndPercent(ten_px), PixelsAndPercent(ten_percent)}),
+          PixelsAndPercent(twenty_px));
+  const CalculationValue* original =
+      CalculationValue::CreateSimplified(expression, Length::ValueRange::kAll);
+  const CalculationValue* zoomed = original->Zoom(2);
+  ASSERT_TRUE(zoomed->IsExpression());
+  EXPECT_EQ(60.0f, zoomed->Evaluate(100));
+  EXPECT_EQ(80.0f, zoomed->Evaluate(400));
+
+  // The expression is only zoomed when it's needed.
+  const CalculationValue* rebuilt = CalculationValue::CreateSimplified(
+      expression->Zoom(2), Length::ValueRange::kAll);
+  EXPECT_EQ(*rebuilt->GetOrCreateExpression(),
+            *zoomed->GetOrCreateExpression());
+  EXPECT_EQ(*rebuilt, *zoomed);
+  EXPECT_NE(*original, *zoomed);
+
+  const CalculationValue* zoomed_twice = zoomed->Zoom(0.25);
+  EXPECT_EQ(20.0f, zoomed_twice->Evaluate(100));
+  EXPECT_EQ(50.0f, zoomed_twice->Evaluate(400));
+  EXPECT_EQ(*original->Zoom(0.5), *zoomed_twice);
+}
+
 TEST_F(LengthTest, SubtractExpressionFromOneHundredPercent) {
   // min(10px, 20%)
   {
@@ -561,4 +630,67 @@ TEST_F(LengthTest, Add) {
       non_simplified.Add(Length::Fixed(1)).GetCalculationValue().Evaluate(123));
 }
 
+// So that vectors of Lengths move them instead of copying them when they
+// reallocate.
+static_assert(std::is_nothrow_move_constructible_v<Length>);
+static_assert(std::is_nothrow_move_assignable_v<Length>);
+
+TEST_F(LengthTest, MoveCalculated) {
+  Length length = CreateLength(
+      Min({PixelsAndPercent(ten_px), PixelsAndPercent(ten_percent)}));
+  ASSERT_TRUE(length.IsCalculated());
+  EXPECT_EQ(1u, length.GetCalculatedCountForTest());
+
+  Length copy = length;
+  EXPECT_EQ(2u, length.GetCalculatedCountForTest());
+
+  // Moving transfers the handle, without changing its count.
+  Length moved = std::move(copy);
+  EXPECT_TRUE(copy.IsAuto());
+  EXPECT_EQ(2u, moved.GetCalculatedCountForTest());
+  EXPECT_EQ(length, moved);
+
+  Length assigned = Length::Fixed(1);
+  assigned = std::move(moved);
+  EXPECT_TRUE(moved.IsAuto());
+  EXPECT_EQ(2u, assigned.GetCalculatedCountForTest());
+
+  // Assigning over a calculated Length releases its handle.
+  assigned = Length::Percent(10);
+  EXPECT_EQ(1u, length.GetCalculatedCountForTest());
+}
+
+TEST_F(LengthTest, InternCalculated) {
+  const wtf_size_t map_size = Length::GetCalcHandleMapSizeForTest();
+  {
+    Length a = CreateLength(
+        Min({PixelsAndPercent(ten_px), PixelsAndPercent(ten_percent)}));
+    Length b = CreateLength(
+        Min({PixelsAndPercent(ten_px), PixelsAndPercent(ten_percent)}));
+    EXPECT_EQ(&a.GetCalculationValue(), &b.GetCalculationValue());
+    EXPECT_EQ(2u, a.GetCalculatedCountForTest());
+    EXPECT_EQ(a.GetHash(), b.GetHash());
+
+    // Equal values that don't have the same explicit terms aren't shared.
+    Length c = CreateLength(
+        Min({PixelsAndPercent(ten_px),
+             PixelsAndPercent(blink::PixelsAndPercent(
+                 0, 10, /*has_explicit_pixels=*/false,
+                 /*has_explicit_percent=*/true))}));
+    EXPECT_EQ(a, c);
+    EXPECT_NE(&a.GetCalculationValue(), &c.GetCalculationValue());
+
+    Length d = CreateLength(
+        Max({PixelsAndPercent(ten_px), PixelsAndPercent(ten_percent)}));
+    EXPECT_NE(&a.GetCalculationValue(), &d.GetCalculationValue());
+    EXPECT_EQ(map_size + 3, Length::GetCalcHandleMapSizeForTest());
+  }
+  EXPECT_EQ(map_size, Length::GetCalcHandleMapSizeForTest());
+
+  // The value is interned again once it isn't used.
+  Length e = CreateLength(
+      Min({PixelsAndPercent(ten_px), PixelsAndPercent(ten_percent)}));
+  EXPECT_EQ(1u, e.GetCalculatedCountForTest());
+}
+
 }  // namespace blink
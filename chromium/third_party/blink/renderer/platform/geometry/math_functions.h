@@ -8,10 +8,13 @@
 #include <array>
 #include <cfloat>
 #include <cmath>
+#include <limits>
 #include <optional>
 #include <type_traits>
 #include <utility>
 
+#include "base/check_op.h"
+#include "base/containers/span.h"
 #include "base/notreached.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
@@ -21,12 +24,72 @@ namespace blink {
 
 namespace {
 
+// Returns the number of whole B in A, which must both be non-negative, if B is
+// an integer or a power of two, e.g. the step of a grid, and A is small enough
+// for the multiples of B around it to be exact. The quotient is then computed
+// with a division, which is much faster than std::fmod, and is exact.
+template <class ValueType>
+std::optional<ValueType> GetExactQuotient(ValueType a, ValueType b) {
+  // The integers up to this limit are exact.
+  constexpr ValueType kExactLimit =
+      static_cast<ValueType>(1ull << std::numeric_limits<ValueType>::digits);
+  // This also rejects infinities and NaN.
+  if (!(b > 0) || !(a + b < kExactLimit)) {
+    return std::nullopt;
+  }
+  int exponent;
+  const bool is_power_of_two = std::frexp(b, &exponent) == 0.5;
+  if (!is_power_of_two && std::trunc(b) != b) {
+    return std::nullopt;
+  }
+  // Dividing by a power of two is exact, unless the quotient is too small to
+  // be normal, which doesn't change its floor.
+  ValueType quotient = std::floor(a / b);
+  if (is_power_of_two) {
+    // The next multiple must also be exact.
+    if (!(quotient < kExactLimit)) {
+      return std::nullopt;
+    }
+    return quotient;
+  }
+  // The division is rounded, so the floor may be off by one, but the
+  // multiples of the integer B are exact.
+  if (quotient * b > a) {
+    quotient -= 1;
+  } else if ((quotient + 1) * b <= a) {
+    quotient += 1;
+  }
+  return quotient;
+}
+
+// The same as std::fmod(a, b), computed from GetExactQuotient() when possible.
+template <class ValueType>
+ValueType GetRemainder(ValueType a, ValueType b) {
+  const ValueType b_abs = std::abs(b);
+  if (std::optional<ValueType> quotient =
+          GetExactQuotient(std::abs(a), b_abs)) {
+    // The remainder has the sign of A, even when it's zero.
+    return std::copysign(std::abs(a) - *quotient * b_abs, a);
+  }
+  return std::fmod(a, b);
+}
+
 template <class ValueType>
 std::pair<ValueType, ValueType> GetNearestMultiples(ValueType a, ValueType b) {
   using std::swap;
   bool is_negative = a < 0.0;
   a = std::abs(a);
   b = std::abs(b);
+  if (std::optional<ValueType> quotient = GetExactQuotient(a, b)) {
+    ValueType lower = *quotient * b;
+    ValueType upper = (*quotient + 1) * b;
+    if (is_negative) {
+      swap(lower, upper);
+      lower = -lower;
+      upper = -upper;
+    }
+    return {lower, upper};
+  }
   // To get rid of rounding and range problems we use std::fmod
   // to get the lower to A multiple of B.
   ValueType c = -std::fmod(a, b);
@@ -66,7 +129,7 @@ std::optional<ValueType> PreCheckSteppedValueFunctionArguments(OperatorType op,
   // round() resolves to A exactly.
   // If A is infinite but B is finite, the result is the same infinity.
   if (OperatorType::kRoundNearest <= op && op <= OperatorType::kRoundToZero &&
-      (std::fmod(a, b) == 0.0 || (std::isinf(a) && !std::isinf(b)))) {
+      (GetRemainder(a, b) == 0.0 || (std::isinf(a) && !std::isinf(b)))) {
     return a;
   }
   // In mod(A, B) or rem(A, B), if A is infinite, the result is NaN.
@@ -198,7 +261,7 @@ ValueType EvaluateSteppedValueFunction(OperatorType op,
           using std::swap;
           swap(lower, upper);
         }
-        const ValueType distance = std::abs(std::fmod(a, b));
+        const ValueType distance = std::abs(GetRemainder(a, b));
         const ValueType half_b = std::abs(b) / 2;
         if (distance < half_b || (a_is_negative && distance == half_b)) {
           return lower;
@@ -244,7 +307,7 @@ ValueType EvaluateSteppedValueFunction(OperatorType op,
       // multiple of B that puts the value between zero and B.
       // std::fmod - the returned value has the same sign as A
       // and is less than B in magnitude.
-      ValueType result = std::fmod(a, b);
+      ValueType result = GetRemainder(a, b);
       if (std::signbit(result) != std::signbit(b)) {
         // When the absolute values of arguments are the same, but they
         // appear on different sides from zero, the result of std::fmod will be
@@ -271,13 +334,28 @@ ValueType EvaluateSteppedValueFunction(OperatorType op,
       // avoiding changing the sign of the value.
       // std::fmod - the returned value has the same sign as A
       // and is less than B in magnitude.
-      return std::fmod(a, b);
+      return GetRemainder(a, b);
     }
     default:
       NOTREACHED();
   }
 }
 
+// EvaluateSteppedValueFunction() of each of |values| with the same step
+// |b|, e.g. the positions snapped to a grid, into |results|, which must have
+// the same size.
+template <class OperatorType, typename ValueType>
+  requires std::is_enum_v<OperatorType> && std::floating_point<ValueType>
+void EvaluateSteppedValueFunctionMany(OperatorType op,
+                                      base::span<const ValueType> values,
+                                      ValueType b,
+                                      base::span<ValueType> results) {
+  CHECK_EQ(values.size(), results.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    results[i] = EvaluateSteppedValueFunction(op, values[i], b);
+  }
+}
+
 template <typename ValueType>
   requires std::floating_point<ValueType>
 ValueType EvaluateSignFunction(ValueType v) {
@@ -4,6 +4,8 @@
 
 #include "third_party/blink/renderer/platform/geometry/math_functions.h"
 
+#include <cmath>
+#include <iterator>
 #include <limits>
 
 #include "testing/gtest/include/gtest/gtest.h"
@@ -75,6 +77,57 @@ TEST(MathFunctionsTest, EvaluateSteppedValueFunction_SmallB) {
   }
 }
 
+TEST(MathFunctionsTest, EvaluateSteppedValueFunction_GridSteps) {
+  struct {
+    TestOperatorType op;
+    double a;
+    double b;
+    double expected;
+  } tests[] = {
+      {TestOperatorType::kRoundNearest, 13.0, 8.0, 16.0},
+      {TestOperatorType::kRoundNearest, 12.0, 8.0, 16.0},
+      {TestOperatorType::kRoundNearest, -12.0, 8.0, -8.0},
+      {TestOperatorType::kRoundNearest, 14.9, 10.0, 10.0},
+      {TestOperatorType::kRoundNearest, 0.3, 0.25, 0.25},
+      {TestOperatorType::kRoundUp, 10.1, 10.0, 20.0},
+      {TestOperatorType::kRoundUp, -10.1, 10.0, -10.0},
+      {TestOperatorType::kRoundDown, 10.1, 10.0, 10.0},
+      {TestOperatorType::kRoundDown, -10.1, -10.0, -20.0},
+      {TestOperatorType::kRoundToZero, -19.9, 10.0, -10.0},
+      {TestOperatorType::kMod, -7.0, 3.0, 2.0},
+      {TestOperatorType::kMod, 7.0, -3.0, -2.0},
+      {TestOperatorType::kMod, 5.5, 0.5, 0.0},
+      {TestOperatorType::kRem, -7.0, 3.0, -1.0},
+      {TestOperatorType::kRem, 7.25, 2.0, 1.25},
+  };
+  for (const auto& test : tests) {
+    EXPECT_EQ(EvaluateSteppedValueFunction(test.op, test.a, test.b),
+              test.expected)
+        << "a=" << test.a << " b=" << test.b;
+  }
+  // The remainder of exact multiples has the sign of A.
+  EXPECT_TRUE(std::signbit(
+      EvaluateSteppedValueFunction(TestOperatorType::kRem, -6.0, 3.0)));
+  EXPECT_FALSE(std::signbit(
+      EvaluateSteppedValueFunction(TestOperatorType::kRem, 6.0, -3.0)));
+}
+
+TEST(MathFunctionsTest, EvaluateSteppedValueFunctionMany) {
+  const double values[] = {-17.5, -8.0, 0.0, 3.0, 4.0, 12.25, 1e20};
+  for (double b : {4.0, 3.0, 0.5, 2.5}) {
+    double results[std::size(values)];
+    EvaluateSteppedValueFunctionMany(
+        TestOperatorType::kRoundNearest, base::span<const double>(values), b,
+        base::span<double>(results));
+    for (size_t i = 0; i < std::size(values); ++i) {
+      EXPECT_EQ(EvaluateSteppedValueFunction(TestOperatorType::kRoundNearest,
+                                             values[i], b),
+                results[i])
+          << "a=" << values[i] << " b=" << b;
+    }
+  }
+}
+
 }  // namespace
 
 }  // namespace blink
@@ -32,15 +32,25 @@
 #include <math.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstddef>
 #include <optional>
 
+#include "base/functional/bind.h"
+#include "base/task/post_job.h"
+#include "base/task/task_traits.h"
+
 #include "third_party/blink/renderer/platform/geometry/path_builder.h"
 #include "third_party/blink/renderer/platform/geometry/skia_geometry_utils.h"
 #include "third_party/blink/renderer/platform/geometry/stroke_data.h"
 #include "third_party/blink/renderer/platform/transforms/affine_transform.h"
+#include "third_party/blink/renderer/platform/wtf/hash_functions.h"
+#include "third_party/blink/renderer/platform/wtf/hash_traits.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
+#include "third_party/blink/renderer/platform/wtf/thread_safe_ref_counted.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "third_party/skia/include/core/SkContourMeasure.h"
 #include "third_party/skia/include/core/SkPathBuilder.h"
 #include "third_party/skia/include/pathops/SkPathOps.h"
 #include "ui/gfx/geometry/point_f.h"
@@ -66,8 +76,369 @@ bool PathQuadIntersection(const SkPath& path, const gfx::QuadF& quad) {
   return intersection && !intersection->isEmpty();
 }
 
+// The number of contours of each chunk measured by a worker.
+constexpr wtf_size_t kContoursPerParallelChunk = 512;
+
+wtf_size_t CountContours(const SkPath& path) {
+  wtf_size_t count = 0;
+  SkPath::RawIter iter(path);
+  std::array<SkPoint, 4> pts;
+  for (;;) {
+    const SkPath::Verb verb = iter.next(pts.data());
+    if (verb == SkPath::kDone_Verb) {
+      return count;
+    }
+    count += verb == SkPath::kMove_Verb;
+  }
+}
+
+// Splits |path| into paths of |contours_per_chunk| contours each, but the
+// last.
+Vector<SkPath> SplitContours(const SkPath& path,
+                             wtf_size_t contours_per_chunk) {
+  Vector<SkPath> chunks;
+  SkPathBuilder builder(path.getFillType());
+  wtf_size_t contours = 0;
+  SkPath::RawIter iter(path);
+  std::array<SkPoint, 4> pts;
+  for (;;) {
+    switch (iter.next(pts.data())) {
+      case SkPath::kMove_Verb:
+        if (contours == contours_per_chunk) {
+          chunks.push_back(builder.detach());
+          builder.setFillType(path.getFillType());
+          contours = 0;
+        }
+        ++contours;
+        builder.moveTo(pts[0]);
+        break;
+      case SkPath::kLine_Verb:
+        builder.lineTo(pts[1]);
+        break;
+      case SkPath::kQuad_Verb:
+        builder.quadTo(pts[1], pts[2]);
+        break;
+      case SkPath::kConic_Verb:
+        builder.conicTo(pts[1], pts[2], iter.conicWeight());
+        break;
+      case SkPath::kCubic_Verb:
+        builder.cubicTo(pts[1], pts[2], pts[3]);
+        break;
+      case SkPath::kClose_Verb:
+        builder.close();
+        break;
+      case SkPath::kDone_Verb:
+        chunks.push_back(builder.detach());
+        return chunks;
+    }
+  }
+}
+
+// Computes Measure() of each of |chunks| with a job, which the calling thread
+// joins. Each worker takes the next chunk that no other worker took.
+template <typename Result, Result (*Measure)(const SkPath&)>
+class ParallelChunkMeasurement {
+  STACK_ALLOCATED();
+
+ public:
+  explicit ParallelChunkMeasurement(const Vector<SkPath>& chunks)
+      : chunks_(chunks), results_(chunks.size()) {}
+
+  Vector<Result> Run() {
+    base::PostJob(
+        FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+        base::BindRepeating(&ParallelChunkMeasurement::MeasureChunks,
+                            base::Unretained(this)),
+        base::BindRepeating(&ParallelChunkMeasurement::GetMaxConcurrency,
+                            base::Unretained(this)))
+        .Join();
+    return std::move(results_);
+  }
+
+ private:
+  void MeasureChunks(base::JobDelegate* delegate) {
+    while (!delegate->ShouldYield()) {
+      const wtf_size_t index = next_chunk_.fetch_add(1);
+      if (index >= chunks_.size()) {
+        return;
+      }
+      results_[index] = Measure(chunks_[index]);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t) const {
+    return chunks_.size() - std::min(next_chunk_.load(), chunks_.size());
+  }
+
+  const Vector<SkPath>& chunks_;
+  // Each element is written by the worker that took its chunk.
+  Vector<Result> results_;
+  std::atomic<wtf_size_t> next_chunk_{0};
+};
+
+float MeasureLength(const SkPath& path) {
+  float length = 0;
+  SkContourMeasureIter iter(path, false);
+  while (sk_sp<SkContourMeasure> contour = iter.next()) {
+    length += contour->length();
+  }
+  return length;
+}
+
+SkRect MeasureTightBounds(const SkPath& path) {
+  return path.computeTightBounds();
+}
+
+PointAndTangent ToPointAndTangent(const SkPoint& position,
+                                  const SkVector& tangent) {
+  PointAndTangent result;
+  result.point = gfx::SkPointToPointF(position);
+  result.tangent_in_degrees = Rad2deg(SkScalarATan2(tangent.fY, tangent.fX));
+  return result;
+}
+
 }  // namespace
 
+// The measured contours of a path, with the length of the path at the end of
+// each. SkContourMeasure keeps the lengths at the end of each segment of its
+// contour, so a lookup is a binary search over the contours, and another over
+// the segments of the contour.
+class Path::ArcLengthTable final
+    : public ThreadSafeRefCounted<Path::ArcLengthTable> {
+ public:
+  explicit ArcLengthTable(const SkPath& path) {
+    // Accumulates the lengths in the same order as Path::length() without a
+    // table, so that the results are the same.
+    SkContourMeasureIter iter(path, false);
+    float length = 0;
+    while (sk_sp<SkContourMeasure> contour = iter.next()) {
+      length += contour->length();
+      contours_.push_back(std::move(contour));
+      contour_ends_.push_back(length);
+    }
+  }
+
+  float length() const {
+    return contour_ends_.empty() ? 0 : contour_ends_.back();
+  }
+
+  std::optional<PointAndTangent> PointAndNormalAtLength(float length) const {
+    // The first contour that ends at or after |length|, as with
+    // CalculatePointAndNormalOnPath().
+    wtf_size_t index = static_cast<wtf_size_t>(
+        std::lower_bound(contour_ends_.begin(), contour_ends_.end(), length) -
+        contour_ends_.begin());
+    for (; index < contours_.size(); ++index) {
+      const float contour_start = index ? contour_ends_[index - 1] : 0;
+      SkPoint position;
+      SkVector tangent;
+      if (contours_[index]->getPosTan(length - contour_start, &position,
+                                      &tangent)) {
+        return ToPointAndTangent(position, tangent);
+      }
+    }
+    return std::nullopt;
+  }
+
+ private:
+  Vector<sk_sp<SkContourMeasure>> contours_;
+  Vector<float> contour_ends_;
+};
+
+// A grid of kSize x kSize cells over the bounds of a path, each classified as
+// inside or outside of the path for a fill type, or as an edge cell that the
+// path may cross. Cells are classified by subdividing each segment (closing
+// the contours, as filling does) until the bounds of its control points,
+// which contain it, span at most two cells in each direction, and marking the
+// cells under those bounds as edges. The other cells contain no point of the
+// path, so the path has the same winding number over each connected area of
+// them, and one exact test classifies the whole area.
+class Path::HitTestGrid final : public ThreadSafeRefCounted<Path::HitTestGrid> {
+ public:
+  HitTestGrid(const SkPath& path, SkPathFillType fill_type)
+      : fill_type_(fill_type), bounds_(path.getBounds()) {
+    if (!bounds_.isFinite() || bounds_.isEmpty()) {
+      // Every point is tested exactly.
+      return;
+    }
+    scale_x_ = kSize / bounds_.width();
+    scale_y_ = kSize / bounds_.height();
+    // A margin for the rounding of the subdivisions.
+    margin_x_ = bounds_.width() / (16 * kSize);
+    margin_y_ = bounds_.height() / (16 * kSize);
+    cells_.Fill(Cell::kUnknown, kSize * kSize);
+
+    SkPath::Iter iter(path, /*forceClose=*/true);
+    std::array<SkPoint, 4> points;
+    for (;;) {
+      switch (iter.next(points.data())) {
+        case SkPath::kLine_Verb:
+          MarkEdges(points, 2, 1, 0);
+          break;
+        case SkPath::kQuad_Verb:
+          MarkEdges(points, 3, 1, 0);
+          break;
+        case SkPath::kConic_Verb:
+          MarkEdges(points, 3, iter.conicWeight(), 0);
+          break;
+        case SkPath::kCubic_Verb:
+          MarkEdges(points, 4, 1, 0);
+          break;
+        case SkPath::kMove_Verb:
+        case SkPath::kClose_Verb:
+          break;
+        case SkPath::kDone_Verb:
+          ClassifyAreas(path);
+          return;
+      }
+    }
+  }
+
+  SkPathFillType fill_type() const { return fill_type_; }
+
+  std::optional<bool> Contains(float x, float y) const {
+    if (cells_.empty() || x < bounds_.left() || x > bounds_.right() ||
+        y < bounds_.top() || y > bounds_.bottom()) {
+      return std::nullopt;
+    }
+    switch (cells_[CellY(y) * kSize + CellX(x)]) {
+      case Cell::kInside:
+        return true;
+      case Cell::kOutside:
+        return false;
+      case Cell::kUnknown:
+      case Cell::kEdge:
+        return std::nullopt;
+    }
+  }
+
+ private:
+  static constexpr wtf_size_t kSize = 32;
+  // Enough for a line across the grid to reach 2 x 2 cells.
+  static constexpr int kMaxSubdivisions = 8;
+
+  enum class Cell : uint8_t { kUnknown, kEdge, kInside, kOutside };
+
+  // Monotonic in |x| and |y|, so that a point in the bounds of a curve is in
+  // a cell within the cells of the corners of the bounds.
+  wtf_size_t CellX(float x) const {
+    return static_cast<wtf_size_t>(
+        std::clamp((x - bounds_.left()) * scale_x_, 0.f, kSize - 1.f));
+  }
+  wtf_size_t CellY(float y) const {
+    return static_cast<wtf_size_t>(
+        std::clamp((y - bounds_.top()) * scale_y_, 0.f, kSize - 1.f));
+  }
+
+  // Marks the cells under the curve with the first |count| of |points| as
+  // edges. The curve is a line, a cubic, or a conic with |weight| (a quad if
+  // it's 1), and is split in half until it spans at most two cells in each
+  // direction.
+  void MarkEdges(const std::array<SkPoint, 4>& points,
+                 size_t count,
+                 float weight,
+                 int subdivisions) {
+    SkRect curve_bounds;
+    curve_bounds.setBounds(points.data(), static_cast<int>(count));
+    const wtf_size_t left = CellX(curve_bounds.left() - margin_x_);
+    const wtf_size_t right = CellX(curve_bounds.right() + margin_x_);
+    const wtf_size_t top = CellY(curve_bounds.top() - margin_y_);
+    const wtf_size_t bottom = CellY(curve_bounds.bottom() + margin_y_);
+    if (subdivisions == kMaxSubdivisions ||
+        (right - left <= 1 && bottom - top <= 1)) {
+      for (wtf_size_t y = top; y <= bottom; ++y) {
+        for (wtf_size_t x = left; x <= right; ++x) {
+          cells_[y * kSize + x] = Cell::kEdge;
+        }
+      }
+      return;
+    }
+
+    const auto mix = [](const SkPoint& a, const SkPoint& b, float t) {
+      return a + (b - a) * t;
+    };
+    std::array<SkPoint, 4> first = points;
+    std::array<SkPoint, 4> second = points;
+    if (count == 2) {
+      first[1] = second[0] = mix(points[0], points[1], 0.5f);
+    } else if (count == 3) {
+      // The halves of the conic have the weight sqrt((1 + w) / 2), and their
+      // control points are projections of those of the homogeneous curve.
+      const SkPoint weighted = points[1] * weight;
+      const float scale = 1 / (1 + weight);
+      first[1] = (points[0] + weighted) * scale;
+      second[1] = (weighted + points[2]) * scale;
+      first[2] = second[0] = mix(first[1], second[1], 0.5f);
+    } else {
+      const SkPoint p01 = mix(points[0], points[1], 0.5f);
+      const SkPoint p12 = mix(points[1], points[2], 0.5f);
+      const SkPoint p23 = mix(points[2], points[3], 0.5f);
+      first[1] = p01;
+      first[2] = mix(p01, p12, 0.5f);
+      second[2] = p23;
+      second[1] = mix(p12, p23, 0.5f);
+      first[3] = second[0] = mix(first[2], second[1], 0.5f);
+    }
+    const float half_weight =
+        count == 3 ? std::sqrt((1 + weight) / 2) : weight;
+    MarkEdges(first, count, half_weight, subdivisions + 1);
+    MarkEdges(second, count, half_weight, subdivisions + 1);
+  }
+
+  // Classifies each 4-connected area of cells that aren't edges with an exact
+  // test of the center of one of its cells.
+  void ClassifyAreas(SkPath path) {
+    path.setFillType(fill_type_);
+    Vector<wtf_size_t> stack;
+    for (wtf_size_t i = 0; i < cells_.size(); ++i) {
+      if (cells_[i] != Cell::kUnknown) {
+        continue;
+      }
+      const float x = bounds_.left() + (i % kSize + 0.5f) / scale_x_;
+      const float y = bounds_.top() + (i / kSize + 0.5f) / scale_y_;
+      if (CellY(y) * kSize + CellX(x) != i) {
+        // The cell is too small for its center to be found in it.
+        cells_[i] = Cell::kEdge;
+        continue;
+      }
+      const Cell cell = path.contains(x, y) ? Cell::kInside : Cell::kOutside;
+      cells_[i] = cell;
+      stack.push_back(i);
+      while (!stack.empty()) {
+        const wtf_size_t index = stack.back();
+        stack.pop_back();
+        const auto visit = [&](wtf_size_t neighbor) {
+          if (cells_[neighbor] == Cell::kUnknown) {
+            cells_[neighbor] = cell;
+            stack.push_back(neighbor);
+          }
+        };
+        if (index % kSize) {
+          visit(index - 1);
+        }
+        if (index % kSize + 1 < kSize) {
+          visit(index + 1);
+        }
+        if (index >= kSize) {
+          visit(index - kSize);
+        }
+        if (index + kSize < cells_.size()) {
+          visit(index + kSize);
+        }
+      }
+    }
+  }
+
+  const SkPathFillType fill_type_;
+  const SkRect bounds_;
+  float scale_x_ = 0;
+  float scale_y_ = 0;
+  float margin_x_ = 0;
+  float margin_y_ = 0;
+  // Row by row, or empty if the bounds are empty.
+  Vector<Cell> cells_;
+};
+
 Path::Path() = default;
 
 Path::Path(const Path& other) = default;
@@ -80,17 +451,76 @@ Path& Path::operator=(const Path&) = default;
 
 Path& Path::operator=(const SkPath& other) {
   path_ = other;
+  arc_length_table_ = nullptr;
+  hit_test_grid_ = nullptr;
+  hash_ = 0;
+  tight_bounds_.reset();
   return *this;
 }
 
 bool Path::operator==(const Path& other) const {
+  if (hash_ && other.hash_ && hash_ != other.hash_) {
+    return false;
+  }
   return path_ == other.path_;
 }
 
+unsigned Path::GetHash() const {
+  if (hash_) {
+    return hash_;
+  }
+  // SkPath compares points with float ==, so -0 hashes as 0.
+  const auto hash_float = [](float value) {
+    return blink::GetHash(value == 0 ? 0.f : value);
+  };
+  unsigned hash = HashInt(static_cast<unsigned>(path_.getFillType()));
+  SkPath::RawIter iter(path_);
+  std::array<SkPoint, 4> pts;
+  for (;;) {
+    const SkPath::Verb verb = iter.next(pts.data());
+    // The points added by the verb. Other than a move, each verb starts at
+    // the last point of the previous one, in pts[0].
+    size_t begin = 1;
+    size_t end = 1;
+    switch (verb) {
+      case SkPath::kMove_Verb:
+        begin = 0;
+        break;
+      case SkPath::kLine_Verb:
+        end = 2;
+        break;
+      case SkPath::kQuad_Verb:
+        end = 3;
+        break;
+      case SkPath::kConic_Verb:
+        end = 3;
+        hash = HashInts(hash, hash_float(iter.conicWeight()));
+        break;
+      case SkPath::kCubic_Verb:
+        end = 4;
+        break;
+      case SkPath::kClose_Verb:
+        break;
+      case SkPath::kDone_Verb:
+        hash_ = hash ? hash : 1;
+        return hash_;
+    }
+    hash = HashInts(hash, static_cast<unsigned>(verb));
+    for (size_t i = begin; i < end; ++i) {
+      hash = HashInts(hash, HashInts(hash_float(pts[i].x()),
+                                     hash_float(pts[i].y())));
+    }
+  }
+}
+
 bool Path::Contains(const gfx::PointF& point) const {
   if (!std::isfinite(point.x()) || !std::isfinite(point.y())) {
     return false;
   }
+  if (std::optional<bool> contains =
+          HitTestGridContains(point, path_.getFillType())) {
+    return *contains;
+  }
   return path_.contains(point.x(), point.y());
 }
 
@@ -101,6 +531,9 @@ bool Path::Contains(const gfx::PointF& point, WindRule rule) const {
   const float x = point.x();
   const float y = point.y();
   const SkPathFillType fill_type = WebCoreWindRuleToSkFillType(rule);
+  if (std::optional<bool> contains = HitTestGridContains(point, fill_type)) {
+    return *contains;
+  }
   if (path_.getFillType() != fill_type) {
     SkPath tmp(path_);
     tmp.setFillType(fill_type);
@@ -109,12 +542,55 @@ bool Path::Contains(const gfx::PointF& point, WindRule rule) const {
   return path_.contains(x, y);
 }
 
+void Path::EnsureHitTestGrid(WindRule rule) const {
+  const SkPathFillType fill_type = WebCoreWindRuleToSkFillType(rule);
+  if (!hit_test_grid_ || hit_test_grid_->fill_type() != fill_type) {
+    hit_test_grid_ = base::MakeRefCounted<HitTestGrid>(path_, fill_type);
+  }
+}
+
+std::optional<bool> Path::HitTestGridContains(const gfx::PointF& point,
+                                              SkPathFillType fill_type) const {
+  if (!hit_test_grid_ || hit_test_grid_->fill_type() != fill_type) {
+    return std::nullopt;
+  }
+  return hit_test_grid_->Contains(point.x(), point.y());
+}
+
 bool Path::Intersects(const gfx::QuadF& quad) const {
-  return PathQuadIntersection(path_, quad);
+  return IntersectsQuad(quad, path_.getFillType());
 }
 
 bool Path::Intersects(const gfx::QuadF& quad, WindRule rule) const {
-  SkPathFillType fill_type = WebCoreWindRuleToSkFillType(rule);
+  return IntersectsQuad(quad, WebCoreWindRuleToSkFillType(rule));
+}
+
+bool Path::IntersectsQuad(const gfx::QuadF& quad,
+                          SkPathFillType fill_type) const {
+  if (!SkPathFillType_IsInverse(fill_type)) {
+    const gfx::QuadF clamped(ClampNonFiniteToZero(quad.p1()),
+                             ClampNonFiniteToZero(quad.p2()),
+                             ClampNonFiniteToZero(quad.p3()),
+                             ClampNonFiniteToZero(quad.p4()));
+    const gfx::RectF bounds = gfx::SkRectToRectF(TightBounds());
+    const gfx::RectF quad_bounds = clamped.BoundingBox();
+    // Bounds that only touch, or that have no area, have no intersection with
+    // an area.
+    if (!quad_bounds.Intersects(bounds)) {
+      return false;
+    }
+    if (clamped.IsRectilinear() &&
+        path_.conservativelyContainsRect(gfx::RectFToSkRect(quad_bounds))) {
+      return true;
+    }
+    // The fill of these paths has an area if their bounds have one, which
+    // they do since they intersect another rect.
+    if ((path_.isRect(nullptr) || path_.isOval(nullptr) ||
+         path_.isRRect(nullptr)) &&
+        clamped.ContainsQuad(gfx::QuadF(bounds))) {
+      return true;
+    }
+  }
   if (path_.getFillType() != fill_type) {
     SkPath tmp(path_);
     tmp.setFillType(fill_type);
@@ -123,6 +599,13 @@ bool Path::Intersects(const gfx::QuadF& quad, WindRule rule) const {
   return PathQuadIntersection(path_, quad);
 }
 
+const SkRect& Path::TightBounds() const {
+  if (!tight_bounds_) {
+    tight_bounds_ = path_.computeTightBounds();
+  }
+  return *tight_bounds_;
+}
+
 SkPath Path::StrokePath(const StrokeData& stroke_data,
                         const AffineTransform& transform) const {
   float stroke_precision = ClampTo<float>(
@@ -151,7 +634,7 @@ bool Path::StrokeContains(const gfx::PointF& point,
 }
 
 gfx::RectF Path::TightBoundingRect() const {
-  return gfx::SkRectToRectF(path_.computeTightBounds());
+  return gfx::SkRectToRectF(TightBounds());
 }
 
 gfx::RectF Path::BoundingRect() const {
@@ -159,78 +642,134 @@ gfx::RectF Path::BoundingRect() const {
 }
 
 gfx::RectF Path::StrokeBoundingRect(const StrokeData& stroke_data) const {
+  if (ConservativeStrokeBoundingRectIsExact(stroke_data)) {
+    return ConservativeStrokeBoundingRect(stroke_data);
+  }
   // Skia stroke resolution scale for reduced-precision requirements.
   constexpr float kStrokePrecision = 0.3f;
   return gfx::SkRectToRectF(
       StrokePath(stroke_data, kStrokePrecision).computeTightBounds());
 }
 
-static base::span<gfx::PointF> ConvertPathPoints(
-    std::array<gfx::PointF, 3>& dst,
-    base::span<const SkPoint> src) {
-  for (size_t i = 0; i < src.size(); ++i) {
-    dst[i] = gfx::SkPointToPointF(src[i]);
-  }
-  return base::span(dst).first(src.size());
+gfx::RectF Path::ConservativeStrokeBoundingRect(
+    const StrokeData& stroke_data) const {
+  gfx::RectF bounds = BoundingRect();
+  bounds.Outset(stroke_data.InflationRadius());
+  return bounds;
 }
 
-void Path::Apply(void* info, PathApplierFunction function) const {
+bool Path::ConservativeStrokeBoundingRectIsExact(
+    const StrokeData& stroke_data) const {
+  if (!(stroke_data.Thickness() > 0) || !stroke_data.IsRoundAndSolid() ||
+      path_.getSegmentMasks() != SkPath::kLine_SegmentMask) {
+    return false;
+  }
+  // A move that isn't followed by a line adds a point to the bounds that the
+  // stroke may not cover.
   SkPath::RawIter iter(path_);
   std::array<SkPoint, 4> pts;
-  std::array<gfx::PointF, 3> path_points;
-  PathElement path_element;
-
+  bool has_line_since_move = true;
   for (;;) {
     switch (iter.next(pts.data())) {
       case SkPath::kMove_Verb:
-        path_element.type = kPathElementMoveToPoint;
-        path_element.points =
-            ConvertPathPoints(path_points, base::span(pts).first(1u));
+        if (!has_line_since_move) {
+          return false;
+        }
+        has_line_since_move = false;
         break;
       case SkPath::kLine_Verb:
-        path_element.type = kPathElementAddLineToPoint;
-        path_element.points =
-            ConvertPathPoints(path_points, base::span(pts).subspan<1, 1>());
-        break;
-      case SkPath::kQuad_Verb:
-        path_element.type = kPathElementAddQuadCurveToPoint;
-        path_element.points =
-            ConvertPathPoints(path_points, base::span(pts).subspan<1, 2>());
-        break;
-      case SkPath::kCubic_Verb:
-        path_element.type = kPathElementAddCurveToPoint;
-        path_element.points =
-            ConvertPathPoints(path_points, base::span(pts).subspan<1, 3>());
+        has_line_since_move = true;
         break;
-      case SkPath::kConic_Verb: {
-        // Approximate with quads.  Use two for now, increase if more precision
-        // is needed.
-        const int kPow2 = 1;
-        const unsigned kQuadCount = 1 << kPow2;
-        std::array<SkPoint, 1 + 2 * kQuadCount> quads;
-        SkPath::ConvertConicToQuads(pts[0], pts[1], pts[2], iter.conicWeight(),
-                                    quads.data(), kPow2);
-
-        path_element.type = kPathElementAddQuadCurveToPoint;
-        for (unsigned i = 0; i < kQuadCount; ++i) {
-          path_element.points = ConvertPathPoints(
-              path_points, base::span(quads).subspan(1 + 2 * i, 2u));
-          function(info, path_element);
-        }
-        continue;
-      }
       case SkPath::kClose_Verb:
-        path_element.type = kPathElementCloseSubpath;
-        path_element.points = ConvertPathPoints(path_points, {});
+        // A contour that is closed right after its move.
+        if (!has_line_since_move) {
+          return false;
+        }
         break;
+      case SkPath::kQuad_Verb:
+      case SkPath::kConic_Verb:
+      case SkPath::kCubic_Verb:
+        // Excluded by the segment mask.
+        return false;
       case SkPath::kDone_Verb:
-        return;
+        return has_line_since_move;
     }
-    function(info, path_element);
+  }
+}
+
+static base::span<gfx::PointF> ConvertPathPoints(
+    std::array<gfx::PointF, 3>& dst,
+    base::span<const SkPoint> src) {
+  for (size_t i = 0; i < src.size(); ++i) {
+    dst[i] = gfx::SkPointToPointF(src[i]);
+  }
+  return base::span(dst).first(src.size());
+}
+
+Path::ElementIterator::ElementIterator(const SkPath& path) : iter_(path) {
+  Advance();
+}
+
+void Path::ElementIterator::Advance() {
+  if (next_conic_quad_ < kConicQuadCount) {
+    element_.type = kPathElementAddQuadCurveToPoint;
+    element_.points =
+        ConvertPathPoints(points_, base::span(conic_quads_)
+                                       .subspan(1 + 2 * next_conic_quad_, 2u));
+    ++next_conic_quad_;
+    return;
+  }
+
+  switch (iter_.next(pts_.data())) {
+    case SkPath::kMove_Verb:
+      element_.type = kPathElementMoveToPoint;
+      element_.points = ConvertPathPoints(points_, base::span(pts_).first(1u));
+      return;
+    case SkPath::kLine_Verb:
+      element_.type = kPathElementAddLineToPoint;
+      element_.points =
+          ConvertPathPoints(points_, base::span(pts_).subspan<1, 1>());
+      return;
+    case SkPath::kQuad_Verb:
+      element_.type = kPathElementAddQuadCurveToPoint;
+      element_.points =
+          ConvertPathPoints(points_, base::span(pts_).subspan<1, 2>());
+      return;
+    case SkPath::kCubic_Verb:
+      element_.type = kPathElementAddCurveToPoint;
+      element_.points =
+          ConvertPathPoints(points_, base::span(pts_).subspan<1, 3>());
+      return;
+    case SkPath::kConic_Verb:
+      // Approximate with quads.  Use two for now, increase if more precision
+      // is needed.
+      SkPath::ConvertConicToQuads(pts_[0], pts_[1], pts_[2],
+                                  iter_.conicWeight(), conic_quads_.data(),
+                                  kConicPow2);
+      next_conic_quad_ = 0;
+      Advance();
+      return;
+    case SkPath::kClose_Verb:
+      element_.type = kPathElementCloseSubpath;
+      element_.points = ConvertPathPoints(points_, {});
+      return;
+    case SkPath::kDone_Verb:
+      element_.points = {};
+      done_ = true;
+      return;
+  }
+}
+
+void Path::Apply(void* info, PathApplierFunction function) const {
+  for (const PathElement& element : Elements()) {
+    function(info, element);
   }
 }
 
 float Path::length() const {
+  if (arc_length_table_) {
+    return arc_length_table_->length();
+  }
   float length = 0;
   SkPathMeasure measure(path_, false);
 
@@ -241,6 +780,42 @@ float Path::length() const {
   return length;
 }
 
+float Path::LengthInParallel() const {
+  if (arc_length_table_ ||
+      CountContours(path_) < kMinContoursForParallelMeasurement) {
+    return length();
+  }
+  const Vector<SkPath> chunks = SplitContours(path_, kContoursPerParallelChunk);
+  const Vector<float> lengths =
+      ParallelChunkMeasurement<float, &MeasureLength>(chunks).Run();
+  float length = 0;
+  for (float chunk_length : lengths) {
+    length += chunk_length;
+  }
+  return length;
+}
+
+gfx::RectF Path::TightBoundingRectInParallel() const {
+  if (tight_bounds_ ||
+      CountContours(path_) < kMinContoursForParallelMeasurement) {
+    return TightBoundingRect();
+  }
+  const Vector<SkPath> chunks = SplitContours(path_, kContoursPerParallelChunk);
+  const Vector<SkRect> chunk_bounds =
+      ParallelChunkMeasurement<SkRect, &MeasureTightBounds>(chunks).Run();
+  // Unlike SkRect::join(), this doesn't skip chunks with empty bounds, as
+  // computeTightBounds() doesn't for contours.
+  SkRect bounds = chunk_bounds.front();
+  for (const SkRect& rect : chunk_bounds) {
+    bounds.setLTRB(std::min(bounds.left(), rect.left()),
+                   std::min(bounds.top(), rect.top()),
+                   std::max(bounds.right(), rect.right()),
+                   std::max(bounds.bottom(), rect.bottom()));
+  }
+  tight_bounds_ = bounds;
+  return gfx::SkRectToRectF(bounds);
+}
+
 gfx::PointF Path::PointAtLength(float length) const {
   return PointAndNormalAtLength(length).point;
 }
@@ -257,11 +832,7 @@ static std::optional<PointAndTangent> CalculatePointAndNormalOnPath(
 
       const float pos_in_contour = length - contour_start;
       if (measure.getPosTan(pos_in_contour, &position, &tangent)) {
-        PointAndTangent result;
-        result.point = gfx::SkPointToPointF(position);
-        result.tangent_in_degrees =
-            Rad2deg(SkScalarATan2(tangent.fY, tangent.fX));
-        return result;
+        return ToPointAndTangent(position, tangent);
       }
     }
     contour_start = contour_end;
@@ -270,10 +841,18 @@ static std::optional<PointAndTangent> CalculatePointAndNormalOnPath(
 }
 
 PointAndTangent Path::PointAndNormalAtLength(float length) const {
+  length = ClampNonFiniteToZero(length);
+  if (arc_length_table_) {
+    if (std::optional<PointAndTangent> result =
+            arc_length_table_->PointAndNormalAtLength(length)) {
+      return *result;
+    }
+    return {gfx::SkPointToPointF(path_.getPoint(0)), 0};
+  }
   SkPathMeasure measure(path_, false);
   float start = 0;
-  if (std::optional<PointAndTangent> result = CalculatePointAndNormalOnPath(
-          measure, start, ClampNonFiniteToZero(length))) {
+  if (std::optional<PointAndTangent> result =
+          CalculatePointAndNormalOnPath(measure, start, length)) {
     return *result;
   }
   return {gfx::SkPointToPointF(path_.getPoint(0)), 0};
@@ -29,17 +29,22 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PATH_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PATH_H_
 
+#include <array>
+#include <iterator>
+#include <optional>
+
 #include "base/memory/raw_span.h"
+#include "base/memory/scoped_refptr.h"
 #include "third_party/blink/renderer/platform/geometry/float_rounded_rect.h"
 #include "third_party/blink/renderer/platform/geometry/path_types.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/skia/include/core/SkPath.h"
 #include "third_party/skia/include/core/SkPathMeasure.h"
+#include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/transform.h"
 
 namespace gfx {
-class PointF;
 class QuadF;
 class RectF;
 }  // namespace gfx
@@ -87,9 +92,28 @@ class PLATFORM_EXPORT Path {
   Path& operator=(const SkPath&);
   bool operator==(const Path&) const;
 
+  // A hash of the verbs, points and fill type of the path, consistent with
+  // operator==. It's computed on the first call, and shared by copies made
+  // afterwards.
+  unsigned GetHash() const;
+
   bool Contains(const gfx::PointF&) const;
   bool Contains(const gfx::PointF&, WindRule) const;
 
+  // Classifies the cells of a coarse grid over the bounds of the path as
+  // inside, outside or crossed by the path for |rule|, so that Contains() with
+  // that rule only tests the path exactly for points in crossed cells. It's
+  // for paths that are hit tested repeatedly, and, like the arc-length table,
+  // it's shared by copies made afterwards. Does nothing if the path already
+  // has a grid for |rule|.
+  void EnsureHitTestGrid(WindRule rule) const;
+  bool HasHitTestGrid() const { return !!hit_test_grid_; }
+
+  // Whether the intersection of the quad and the fill of the path has an area.
+  // Quads whose bounds miss the tight bounds of the path are rejected, and
+  // rectilinear quads inside a convex path, or quads that contain a rect, oval
+  // or rounded rect path, are accepted. Other quads are intersected with the
+  // path exactly.
   bool Intersects(const gfx::QuadF&) const;
   bool Intersects(const gfx::QuadF&, WindRule) const;
 
@@ -107,11 +131,41 @@ class PLATFORM_EXPORT Path {
   gfx::RectF TightBoundingRect() const;
   gfx::RectF BoundingRect() const;
   gfx::RectF StrokeBoundingRect(const StrokeData&) const;
+  // Cheap bounds of the stroke, for invalidation and culling: BoundingRect(),
+  // outset by StrokeData::InflationRadius(). They contain
+  // StrokeBoundingRect(), and are equal to it (up to the precision of the
+  // stroker) if ConservativeStrokeBoundingRectIsExact().
+  gfx::RectF ConservativeStrokeBoundingRect(const StrokeData&) const;
+  // Whether the stroke is round and solid, and the path only has lines, each
+  // contour having at least one, so that the bounds of the path are those of
+  // the points the stroke is centered on. That takes a pass over the verbs of
+  // the path, but no stroking.
+  bool ConservativeStrokeBoundingRectIsExact(const StrokeData&) const;
 
   float length() const;
   gfx::PointF PointAtLength(float length) const;
   PointAndTangent PointAndNormalAtLength(float length) const;
 
+  // Same as length() and TightBoundingRect(), but paths with at least
+  // kMinContoursForParallelMeasurement contours are split into chunks of
+  // contours, which workers of the thread pool measure while the calling
+  // thread joins them. The length can differ from length() by rounding, since
+  // the chunks are summed separately. This requires a thread pool, so it's
+  // for callers that know they measure very large paths (e.g. maps with tens
+  // of thousands of contours).
+  static constexpr wtf_size_t kMinContoursForParallelMeasurement = 4096;
+  float LengthInParallel() const;
+  gfx::RectF TightBoundingRectInParallel() const;
+
+  // Measures the contours of the path once, so that length(), PointAtLength()
+  // and PointAndNormalAtLength() look their results up with binary searches,
+  // instead of measuring the path again on each call. Copies of the path made
+  // afterwards share the measurements, so a path that is queried repeatedly
+  // (e.g. each frame of an offset-path animation) should be prepared once
+  // before it's copied. Does nothing if the path is already prepared.
+  void EnsureArcLengthTable() const;
+  bool HasArcLengthTable() const { return !!arc_length_table_; }
+
   // Helper for computing a sequence of positions and normals (normal angles) on
   // a path. The best possible access pattern will be one where the |length|
   // value is strictly increasing. For other access patterns, performance will
@@ -139,6 +193,60 @@ class PLATFORM_EXPORT Path {
 
   const SkPath& GetSkPath() const { return path_; }
 
+  // Iterates the elements of the path, approximating conics with two quads
+  // each. The points of the current element point into the iterator, and are
+  // only valid until it's incremented:
+  //
+  //   for (const PathElement& element : path.Elements()) {
+  //     ...
+  //   }
+  class PLATFORM_EXPORT ElementIterator {
+    STACK_ALLOCATED();
+
+   public:
+    explicit ElementIterator(const SkPath&);
+    ElementIterator(const ElementIterator&) = delete;
+    ElementIterator& operator=(const ElementIterator&) = delete;
+
+    const PathElement& operator*() const { return element_; }
+    const PathElement* operator->() const { return &element_; }
+    ElementIterator& operator++() {
+      Advance();
+      return *this;
+    }
+    bool operator==(std::default_sentinel_t) const { return done_; }
+
+   private:
+    static constexpr int kConicPow2 = 1;
+    static constexpr unsigned kConicQuadCount = 1 << kConicPow2;
+
+    void Advance();
+
+    SkPath::RawIter iter_;
+    std::array<SkPoint, 4> pts_;
+    // The quads approximating the last conic, and the next of them.
+    std::array<SkPoint, 1 + 2 * kConicQuadCount> conic_quads_;
+    unsigned next_conic_quad_ = kConicQuadCount;
+    std::array<gfx::PointF, 3> points_;
+    PathElement element_;
+    bool done_ = false;
+  };
+
+  class ElementRange {
+    STACK_ALLOCATED();
+
+   public:
+    explicit ElementRange(const SkPath& path) : path_(path) {}
+    ElementIterator begin() const { return ElementIterator(path_); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+   private:
+    const SkPath& path_;
+  };
+
+  ElementRange Elements() const { return ElementRange(path_); }
+
+  // Calls the function with each of Elements().
   void Apply(void* info, PathApplierFunction) const;
 
   // Utility factories for simple shapes.
@@ -154,9 +262,26 @@ class PLATFORM_EXPORT Path {
                           float radius_y);
 
  private:
+  class ArcLengthTable;
+  class HitTestGrid;
+
   SkPath StrokePath(const StrokeData&, float stroke_precision) const;
+  // Returns whether the hit test grid for |fill_type| determines that the
+  // point is inside or outside of the path, or nullopt if the path has to be
+  // tested.
+  bool IntersectsQuad(const gfx::QuadF&, SkPathFillType fill_type) const;
+  // The tight bounds of the path, computed on the first call.
+  const SkRect& TightBounds() const;
+  std::optional<bool> HitTestGridContains(const gfx::PointF&,
+                                          SkPathFillType fill_type) const;
 
   SkPath path_;
+  // Shared by copies, and reset when path_ is replaced.
+  mutable scoped_refptr<const ArcLengthTable> arc_length_table_;
+  mutable scoped_refptr<const HitTestGrid> hit_test_grid_;
+  // 0 until GetHash() is called.
+  mutable unsigned hash_ = 0;
+  mutable std::optional<SkRect> tight_bounds_;
 };
 
 // Only used for DCHECKs
@@ -4,13 +4,24 @@
 
 #include "third_party/blink/renderer/platform/geometry/path_builder.h"
 
+#include <algorithm>
+#include <array>
+#include <numbers>
+#include <optional>
+
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "third_party/blink/renderer/platform/geometry/contoured_rect.h"
 #include "third_party/blink/renderer/platform/geometry/infinite_int_rect.h"
 #include "third_party/blink/renderer/platform/geometry/path.h"
 #include "third_party/blink/renderer/platform/geometry/path_types.h"
 #include "third_party/blink/renderer/platform/geometry/skia_geometry_utils.h"
 #include "third_party/blink/renderer/platform/transforms/affine_transform.h"
+#include "third_party/blink/renderer/platform/wtf/math_extras.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 #include "third_party/skia/include/pathops/SkPathOps.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/line_f.h"
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/rect_f.h"
@@ -23,47 +34,118 @@ namespace {
 
 using Corner = ContouredRect::Corner;
 
-// Given a superellipse with the supplied curvature in the coordinate space
-// -1,-1,1,1, returns 3 vectors (2 control points and the end point)
-// of a bezier curve, going from t=0 (0, 1) clockwise to t=0.5 (45 degrees),
-// and following the path of the superellipse with a small margin of error.
-// TODO(fserb) document how this works.
-std::array<gfx::Vector2dF, 3> ApproximateSuperellipseHalfCornerAsBezierCurve(
-    float curvature) {
-  static constexpr std::array<double, 7> p = {
-      1.2430920942724248, 2.010479023614843,  0.32922901179443753,
-      0.2823023142212073, 1.3473704261055421, 2.9149468637949814,
-      0.9106507102917086};
+// The most verbs, points and conics appended by AddCurvedCorner().
+constexpr int kMaxCornerVerbs = 3;
+constexpr int kMaxCornerPoints = 7;
+constexpr int kMaxCornerConics = 1;
 
-  // This formula only works with convex superellipses. To apply to a concave
-  // superellipse, flip the center and the outer point and apply the
-  // equivalent convex formula (1/curvature).
-  DCHECK_GE(curvature, 1);
-  const float s = std::log2(curvature);
-  const float slope =
-      p[0] + (p[6] - p[0]) * 0.5 * (1 + std::tanh(p[5] * (s - p[1])));
-  const float base = 1 / (1 + std::exp(-slope * (0 - p[1])));
-  const float logistic = 1 / (1 + std::exp(-slope * (s - p[1])));
+using HalfCornerControlPoints = std::array<gfx::Vector2dF, 3>;
+using gfx::Float4;
 
-  const float a = (logistic - base) / (1 - base);
-  const float b = p[2] * std::exp(-p[3] * std::pow(s, p[4]));
+ALWAYS_INLINE Float4 ExpFloat4(Float4 v) {
+  return gfx::Exp2Float4(v * std::numbers::log2e_v<float>);
+}
 
-  // This is the superellipse formula at t=0.5 (45 degrees),
-  // the middle of the corner.
-  const float half_corner = Corner::HalfCornerForCurvature(curvature);
+// The curvature of the superellipse that AddCurvedCorner() approximates with
+// cubic beziers for |corner|, or nullopt if it draws lines or a conic instead.
+std::optional<float> SuperellipseCurvature(const Corner& corner) {
+  if (corner.IsConcave()) {
+    return SuperellipseCurvature(corner.Inverse());
+  }
+  if (corner.IsStraight() || corner.IsEmpty() || corner.IsBevel() ||
+      corner.IsRound()) {
+    return std::nullopt;
+  }
+  return corner.Curvature();
+}
+
+// The results of ApproximateSuperellipseHalfCornersAsBezierCurves() for the
+// most recently used curvatures. They're the control points of a unit corner,
+// which Corner::MapPoint() scales and translates, so all the boxes with the
+// same corner-shape share them, whatever their radii.
+struct HalfCornerCache {
+  static constexpr wtf_size_t kSize = 8;
 
-  const gfx::Vector2dF P1(a, 1);
-  const gfx::Vector2dF P2(half_corner - b, half_corner + b);
-  const gfx::Vector2dF P3(half_corner, half_corner);
-  return {P1, P2, P3};
+  struct Entry {
+    float curvature;
+    HalfCornerControlPoints control_points;
+  };
+
+  static HalfCornerCache& Get() {
+    static base::NoDestructor<HalfCornerCache> cache;
+    return *cache;
+  }
+
+  base::Lock lock;
+  // The most recently used first.
+  Vector<Entry, kSize> entries GUARDED_BY(lock);
+};
+
+// Returns the control points of the corners with |curvatures|, from the cache,
+// and computes the missing ones together. The corners without a curvature get
+// no control points.
+std::array<HalfCornerControlPoints, 4> SuperellipseHalfCornerControlPoints(
+    const std::array<std::optional<float>, 4>& curvatures) {
+  std::array<HalfCornerControlPoints, 4> control_points;
+  // The lanes that aren't missing are computed as round corners, and ignored.
+  std::array<float, 4> missing_curvatures;
+  missing_curvatures.fill(ContouredRect::CornerCurvature::kRound);
+  std::array<bool, 4> is_missing = {};
+  bool has_missing = false;
+
+  HalfCornerCache& cache = HalfCornerCache::Get();
+  base::AutoLock locker(cache.lock);
+  for (size_t i = 0; i < curvatures.size(); ++i) {
+    if (!curvatures[i]) {
+      continue;
+    }
+    auto* it = std::ranges::find(cache.entries, *curvatures[i],
+                                 &HalfCornerCache::Entry::curvature);
+    if (it == cache.entries.end()) {
+      missing_curvatures[i] = *curvatures[i];
+      is_missing[i] = true;
+      has_missing = true;
+    } else {
+      std::rotate(cache.entries.begin(), it, it + 1);
+      control_points[i] = cache.entries.front().control_points;
+    }
+  }
+  if (!has_missing) {
+    return control_points;
+  }
+
+  const std::array<HalfCornerControlPoints, 4> computed =
+      ApproximateSuperellipseHalfCornersAsBezierCurves(missing_curvatures);
+  for (size_t i = 0; i < curvatures.size(); ++i) {
+    if (!is_missing[i]) {
+      continue;
+    }
+    control_points[i] = computed[i];
+    // Another corner with the same curvature may have added it.
+    if (std::ranges::find(cache.entries, missing_curvatures[i],
+                          &HalfCornerCache::Entry::curvature) !=
+        cache.entries.end()) {
+      continue;
+    }
+    if (cache.entries.size() == HalfCornerCache::kSize) {
+      cache.entries.pop_back();
+    }
+    cache.entries.push_front(
+        HalfCornerCache::Entry{missing_curvatures[i], computed[i]});
+  }
+  return control_points;
 }
 
 // Adds a curved corner to a path. The vertex argument is the 4 points
 // of the corner rectangle, starting from the beginning of the corner
-// and continuing clockwise.
-void AddCurvedCorner(SkPathBuilder& path, const Corner& corner) {
+// and continuing clockwise. |control_points| are those of
+// SuperellipseHalfCornerControlPoints() for SuperellipseCurvature(corner),
+// if it has one.
+void AddCurvedCorner(SkPathBuilder& path,
+                     const Corner& corner,
+                     const HalfCornerControlPoints& control_points) {
   if (corner.IsConcave()) {
-    AddCurvedCorner(path, corner.Inverse());
+    AddCurvedCorner(path, corner.Inverse(), control_points);
     return;
   }
 
@@ -84,9 +166,6 @@ void AddCurvedCorner(SkPathBuilder& path, const Corner& corner) {
     // Approximate 1/2 corner (45 degrees) of the superellipse as a
     // cubic bezier curve, and draw it twice, transposed, meeting at the t=0.5
     // (45 degrees) point.
-    std::array<gfx::Vector2dF, 3> control_points =
-        ApproximateSuperellipseHalfCornerAsBezierCurve(corner.Curvature());
-
     path.cubicTo(gfx::PointFToSkPoint(corner.MapPoint(control_points.at(0))),
                  gfx::PointFToSkPoint(corner.MapPoint(control_points.at(1))),
                  gfx::PointFToSkPoint(corner.MapPoint(control_points.at(2))));
@@ -99,8 +178,54 @@ void AddCurvedCorner(SkPathBuilder& path, const Corner& corner) {
   }
 }
 
+void AddCurvedCorner(SkPathBuilder& path, const Corner& corner) {
+  AddCurvedCorner(path, corner,
+                  SuperellipseHalfCornerControlPoints(
+                      {SuperellipseCurvature(corner), std::nullopt,
+                       std::nullopt, std::nullopt})[0]);
+}
+
 }  // anonymous namespace
 
+std::array<std::array<gfx::Vector2dF, 3>, 4>
+ApproximateSuperellipseHalfCornersAsBezierCurves(
+    const std::array<float, 4>& curvatures) {
+  // TODO(fserb) document how this works.
+  static constexpr std::array<float, 7> p = {
+      1.2430920942724248f, 2.010479023614843f,  0.32922901179443753f,
+      0.2823023142212073f, 1.3473704261055421f, 2.9149468637949814f,
+      0.9106507102917086f};
+
+  // This formula only works with convex superellipses. To apply to a concave
+  // superellipse, flip the center and the outer point and apply the
+  // equivalent convex formula (1/curvature).
+  const Float4 curvature = gfx::LoadFloat4(curvatures.data());
+  DCHECK(gfx::AllTrue(curvature >= 1));
+  const Float4 s = gfx::Log2Float4(curvature);
+  // tanh(x) = 1 - 2 / (e^2x + 1).
+  const Float4 tanh = 1 - 2 / (ExpFloat4(2 * p[5] * (s - p[1])) + 1);
+  const Float4 slope = p[0] + (p[6] - p[0]) * 0.5f * (1 + tanh);
+  const Float4 base = 1 / (1 + ExpFloat4(slope * p[1]));
+  const Float4 logistic = 1 / (1 + ExpFloat4(-slope * (s - p[1])));
+
+  const Float4 a = (logistic - base) / (1 - base);
+  const Float4 s_pow = gfx::PowFloat4(s, Float4{} + p[4]);
+  const Float4 b = p[2] * ExpFloat4(-p[3] * s_pow);
+
+  // This is the superellipse formula at t=0.5 (45 degrees),
+  // the middle of the corner: pow(0.5, 1 / curvature).
+  const Float4 half_corner = gfx::Exp2Float4(-1 / curvature);
+
+  std::array<std::array<gfx::Vector2dF, 3>, 4> control_points;
+  for (size_t i = 0; i < control_points.size(); ++i) {
+    control_points[i] = {gfx::Vector2dF(a[i], 1),
+                         gfx::Vector2dF(half_corner[i] - b[i],
+                                        half_corner[i] + b[i]),
+                         gfx::Vector2dF(half_corner[i], half_corner[i])};
+  }
+  return control_points;
+}
+
 PathBuilder::PathBuilder() = default;
 PathBuilder::~PathBuilder() = default;
 
@@ -108,7 +233,24 @@ PathBuilder::PathBuilder(const Path& path) : builder_(path.GetSkPath()) {}
 
 void PathBuilder::ClearCachedData() {
   current_path_.reset();
-  current_bounds_.reset();
+  bounded_points_ = 0;
+  has_non_finite_points_ = false;
+}
+
+void PathBuilder::OffsetCachedData(float dx, float dy) {
+  current_path_.reset();
+  if (bounded_points_) {
+    // The points overflow where the extremes do.
+    point_bounds_.offset(dx, dy);
+    has_non_finite_points_ |= !point_bounds_.isFinite();
+  }
+}
+
+void PathBuilder::ClearCachedDataBeforeAddingContour() {
+  const SkSpan<const SkPathVerb> verbs = builder_.verbs();
+  if (!verbs.empty() && verbs.back() == SkPathVerb::kMove) {
+    ClearCachedData();
+  }
 }
 
 void PathBuilder::Reset() {
@@ -121,11 +263,39 @@ Path PathBuilder::Finalize() {
   return builder_.detach();
 }
 
+Path PathBuilder::FinalizeKeepingStorage() {
+  Path path(builder_.snapshot());
+  Reset();
+  return path;
+}
+
+PathBuilder& PathBuilder::Reserve(int verbs, int points, int conics) {
+  builder_.incReserve(points, verbs, conics);
+  return *this;
+}
+
 gfx::RectF PathBuilder::BoundingRect() const {
-  if (!current_bounds_) {
-    current_bounds_.emplace(gfx::SkRectToRectF(builder_.computeBounds()));
+  // The same as SkPathBuilder::computeBounds(), for the points appended since
+  // the last call.
+  const SkSpan<const SkPoint> points = builder_.points();
+  DCHECK_LE(bounded_points_, points.size());
+  for (size_t i = bounded_points_; i < points.size(); ++i) {
+    const SkPoint& point = points[i];
+    has_non_finite_points_ |= !point.isFinite();
+    if (i == 0) {
+      point_bounds_.setLTRB(point.x(), point.y(), point.x(), point.y());
+    } else {
+      point_bounds_.setLTRB(std::min(point_bounds_.left(), point.x()),
+                            std::min(point_bounds_.top(), point.y()),
+                            std::max(point_bounds_.right(), point.x()),
+                            std::max(point_bounds_.bottom(), point.y()));
+    }
   }
-  return current_bounds_.value();
+  bounded_points_ = points.size();
+  if (!bounded_points_ || has_non_finite_points_) {
+    return gfx::RectF();
+  }
+  return gfx::SkRectToRectF(point_bounds_);
 }
 
 const Path& PathBuilder::CurrentPath() const {
@@ -146,21 +316,27 @@ std::optional<gfx::PointF> PathBuilder::CurrentPoint() const {
 PathBuilder& PathBuilder::Close() {
   builder_.close();
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
 PathBuilder& PathBuilder::MoveTo(const gfx::PointF& pt) {
+  const int points = builder_.countPoints();
   builder_.moveTo(gfx::PointFToSkPoint(pt));
 
-  ClearCachedData();
+  // A move that follows another one may replace its point.
+  if (builder_.countPoints() > points) {
+    ClearCachedPath();
+  } else {
+    ClearCachedData();
+  }
   return *this;
 }
 
 PathBuilder& PathBuilder::LineTo(const gfx::PointF& pt) {
   builder_.lineTo(gfx::PointFToSkPoint(pt));
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
@@ -168,7 +344,7 @@ PathBuilder& PathBuilder::QuadTo(const gfx::PointF& ctrl,
                                  const gfx::PointF& pt) {
   builder_.quadTo(gfx::PointFToSkPoint(ctrl), gfx::PointFToSkPoint(pt));
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
@@ -178,7 +354,7 @@ PathBuilder& PathBuilder::CubicTo(const gfx::PointF& ctrl1,
   builder_.cubicTo(gfx::PointFToSkPoint(ctrl1), gfx::PointFToSkPoint(ctrl2),
                    gfx::PointFToSkPoint(pt));
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
@@ -194,7 +370,7 @@ PathBuilder& PathBuilder::ArcTo(const gfx::PointF& p,
       sweep ? SkPathDirection::kCW : SkPathDirection::kCCW,
       gfx::PointFToSkPoint(p));
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
@@ -203,47 +379,59 @@ PathBuilder& PathBuilder::ArcTo(const gfx::PointF& p1,
                                 float radius) {
   builder_.arcTo(gfx::PointFToSkPoint(p1), gfx::PointFToSkPoint(p2), radius);
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
 PathBuilder& PathBuilder::AddRect(const gfx::PointF& origin,
                                   const gfx::PointF& opposite_point) {
+  ClearCachedDataBeforeAddingContour();
   builder_.addRect(SkRect::MakeLTRB(origin.x(), origin.y(), opposite_point.x(),
                                     opposite_point.y()),
                    SkPathDirection::kCW, 0);
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
 PathBuilder& PathBuilder::AddPath(const Path& src,
                                   const AffineTransform& transform) {
-  builder_.addPath(src.GetSkPath(), transform.ToSkMatrix());
+  ClearCachedDataBeforeAddingContour();
+  // Skip the matrix conversion and the per-point mapping in the common cases.
+  if (transform.IsIdentity()) {
+    builder_.addPath(src.GetSkPath());
+  } else if (transform.IsIdentityOrTranslation()) {
+    builder_.addPath(src.GetSkPath(), ClampToWithNaNTo0<float>(transform.E()),
+                     ClampToWithNaNTo0<float>(transform.F()));
+  } else {
+    builder_.addPath(src.GetSkPath(), transform.ToSkMatrix());
+  }
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
 PathBuilder& PathBuilder::AddRoundedRect(const FloatRoundedRect& rect,
                                          bool clockwise) {
+  ClearCachedDataBeforeAddingContour();
   builder_.addRRect(SkRRect(rect),
                     clockwise ? SkPathDirection::kCW : SkPathDirection::kCCW,
                     /* start at upper-left after corner radius */ 0);
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
 PathBuilder& PathBuilder::AddCorner(const ContouredRect::Corner& corner) {
   AddCurvedCorner(builder_, corner);
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
 PathBuilder& PathBuilder::AddContouredRect(
     const ContouredRect& contoured_rect) {
+  ClearCachedDataBeforeAddingContour();
   const FloatRoundedRect& target_rect = contoured_rect.AsRoundedRect();
 
   if (contoured_rect.HasRoundCurvature()) {
@@ -252,17 +440,26 @@ PathBuilder& PathBuilder::AddContouredRect(
   }
   const FloatRoundedRect& origin_rect = contoured_rect.GetOriginRect();
 
+  // In the order that they're drawn, clockwise, with the control points of all
+  // four computed together.
+  const ContouredRect::Corners corners(contoured_rect);
+  const std::array<HalfCornerControlPoints, 4> control_points =
+      SuperellipseHalfCornerControlPoints(
+          {SuperellipseCurvature(corners[0]), SuperellipseCurvature(corners[1]),
+           SuperellipseCurvature(corners[2]),
+           SuperellipseCurvature(corners[3])});
+
   auto DrawAsSinglePath = [&]() {
     // A rect with no insets/outsets, we can draw all the corners and not worry
     // about intersections.
-    const Corner top_right_corner = contoured_rect.TopRightCorner();
-    MoveTo(top_right_corner.Start());
-    AddCurvedCorner(builder_, top_right_corner);
-    AddCurvedCorner(builder_, contoured_rect.BottomRightCorner());
-    AddCurvedCorner(builder_, contoured_rect.BottomLeftCorner());
-    AddCurvedCorner(builder_, contoured_rect.TopLeftCorner());
+    Reserve(4 * kMaxCornerVerbs + 2, 4 * kMaxCornerPoints + 1,
+            4 * kMaxCornerConics);
+    MoveTo(corners[0].Start());
+    for (size_t i = 0; i < ContouredRect::Corners::kCount; ++i) {
+      AddCurvedCorner(builder_, corners[i], control_points[i]);
+    }
     Close();
-    ClearCachedData();
+    ClearCachedPath();
   };
 
   if (origin_rect == target_rect) {
@@ -290,11 +487,9 @@ PathBuilder& PathBuilder::AddContouredRect(
       return miter(corner, edge, corner.End());
     };
 
-    const Corner top_right_corner = contoured_rect.TopRightCorner();
-    const Corner bottom_right_corner = contoured_rect.BottomRightCorner();
-    const Corner bottom_left_corner = contoured_rect.BottomLeftCorner();
-    const Corner top_left_corner = contoured_rect.TopLeftCorner();
-
+    // The corners, with two lines each to and from their miters.
+    Reserve(4 * (kMaxCornerVerbs + 2) + 2, 4 * (kMaxCornerPoints + 2) + 1,
+            4 * kMaxCornerConics);
     const gfx::LineF top_line(target_rect.Rect().origin(),
                               target_rect.Rect().top_right());
     const gfx::LineF bottom_line(target_rect.Rect().bottom_left(),
@@ -304,24 +499,24 @@ PathBuilder& PathBuilder::AddContouredRect(
     const gfx::LineF right_line(target_rect.Rect().top_right(),
                                 target_rect.Rect().bottom_right());
 
-    MoveTo(miter_start(top_right_corner, top_line));
-    AddCorner(top_right_corner);
-    LineTo(miter_end(top_right_corner, right_line));
+    MoveTo(miter_start(corners[0], top_line));
+    AddCurvedCorner(builder_, corners[0], control_points[0]);
+    LineTo(miter_end(corners[0], right_line));
 
-    LineTo(miter_start(bottom_right_corner, right_line));
-    AddCorner(bottom_right_corner);
-    LineTo(miter_end(bottom_right_corner, bottom_line));
+    LineTo(miter_start(corners[1], right_line));
+    AddCurvedCorner(builder_, corners[1], control_points[1]);
+    LineTo(miter_end(corners[1], bottom_line));
 
-    LineTo(miter_start(bottom_left_corner, bottom_line));
-    AddCorner(bottom_left_corner);
-    LineTo(miter_end(bottom_left_corner, left_line));
+    LineTo(miter_start(corners[2], bottom_line));
+    AddCurvedCorner(builder_, corners[2], control_points[2]);
+    LineTo(miter_end(corners[2], left_line));
 
-    LineTo(miter_start(top_left_corner, left_line));
-    AddCorner(top_left_corner);
-    LineTo(miter_end(top_left_corner, top_line));
+    LineTo(miter_start(corners[3], left_line));
+    AddCurvedCorner(builder_, corners[3], control_points[3]);
+    LineTo(miter_end(corners[3], top_line));
 
     Close();
-    ClearCachedData();
+    ClearCachedPath();
 
     return *this;
   }
@@ -347,44 +542,48 @@ PathBuilder& PathBuilder::AddContouredRect(
   ContouredRect origin_contoured_rect(origin_rect,
                                       contoured_rect.GetCornerCurvature());
 
+  // Reused for the path of each corner, with its storage.
+  SkPathBuilder path;
+  path.incReserve(kMaxCornerPoints + 3, kMaxCornerVerbs + 4, kMaxCornerConics);
+
   if (!origin_rect.GetRadii().TopRight().IsEmpty()) {
-    SkPathBuilder path;
     path.moveTo(infinite_rect.left(), infinite_rect.top());
-    AddCurvedCorner(path, contoured_rect.TopRightCorner());
+    AddCurvedCorner(path, corners[0], control_points[0]);
     path.lineTo(infinite_rect.right(), infinite_rect.bottom());
     path.lineTo(infinite_rect.left(), infinite_rect.bottom());
     path.close();
-    op_builder.add(path.detach(), kIntersect_SkPathOp);
+    op_builder.add(path.snapshot(), kIntersect_SkPathOp);
+    path.reset();
   }
 
   if (!origin_rect.GetRadii().BottomRight().IsEmpty()) {
-    SkPathBuilder path;
     path.moveTo(infinite_rect.right(), infinite_rect.top());
-    AddCurvedCorner(path, contoured_rect.BottomRightCorner());
+    AddCurvedCorner(path, corners[1], control_points[1]);
     path.lineTo(infinite_rect.left(), infinite_rect.bottom());
     path.lineTo(infinite_rect.left(), infinite_rect.top());
     path.close();
-    op_builder.add(path.detach(), kIntersect_SkPathOp);
+    op_builder.add(path.snapshot(), kIntersect_SkPathOp);
+    path.reset();
   }
 
   if (!origin_rect.GetRadii().BottomLeft().IsEmpty()) {
-    SkPathBuilder path;
     path.moveTo(infinite_rect.right(), infinite_rect.bottom());
-    AddCurvedCorner(path, contoured_rect.BottomLeftCorner());
+    AddCurvedCorner(path, corners[2], control_points[2]);
     path.lineTo(infinite_rect.left(), infinite_rect.top());
     path.lineTo(infinite_rect.right(), infinite_rect.top());
     path.close();
-    op_builder.add(path.detach(), kIntersect_SkPathOp);
+    op_builder.add(path.snapshot(), kIntersect_SkPathOp);
+    path.reset();
   }
 
   if (!origin_rect.GetRadii().TopLeft().IsEmpty()) {
-    SkPathBuilder path;
     path.moveTo(infinite_rect.left(), infinite_rect.bottom());
-    AddCurvedCorner(path, contoured_rect.TopLeftCorner());
+    AddCurvedCorner(path, corners[3], control_points[3]);
     path.lineTo(infinite_rect.right(), infinite_rect.top());
     path.lineTo(infinite_rect.right(), infinite_rect.bottom());
     path.close();
-    op_builder.add(path.detach(), kIntersect_SkPathOp);
+    op_builder.add(path.snapshot(), kIntersect_SkPathOp);
+    path.reset();
   }
 
   SkPath result;
@@ -393,7 +592,7 @@ PathBuilder& PathBuilder::AddContouredRect(
   } else {
     DrawAsSinglePath();
   }
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
@@ -430,7 +629,7 @@ PathBuilder& PathBuilder::AddEllipse(const gfx::PointF& p,
   } else {
     builder_.arcTo(oval, start_degrees, sweep_degrees, false);
   }
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
@@ -459,23 +658,25 @@ PathBuilder& PathBuilder::AddEllipse(const gfx::PointF& p,
 }
 
 PathBuilder& PathBuilder::AddRect(const gfx::RectF& rect) {
+  ClearCachedDataBeforeAddingContour();
   // Start at upper-left, add clock-wise.
   builder_.addRect(gfx::RectFToSkRect(rect), SkPathDirection::kCW, 0);
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
 PathBuilder& PathBuilder::AddEllipse(const gfx::PointF& center,
                                      float radius_x,
                                      float radius_y) {
+  ClearCachedDataBeforeAddingContour();
   // Start at 3 o'clock, add clock-wise.
   builder_.addOval(
       SkRect::MakeLTRB(center.x() - radius_x, center.y() - radius_y,
                        center.x() + radius_x, center.y() + radius_y),
       SkPathDirection::kCW, 1);
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
@@ -488,21 +689,31 @@ PathBuilder& PathBuilder::SetWindRule(WindRule rule) {
 
   builder_.setFillType(fill_type);
 
-  ClearCachedData();
+  ClearCachedPath();
   return *this;
 }
 
 PathBuilder& PathBuilder::Translate(const gfx::Vector2dF& offset) {
   builder_.offset(offset.x(), offset.y());
 
-  ClearCachedData();
+  OffsetCachedData(offset.x(), offset.y());
   return *this;
 }
 
 PathBuilder& PathBuilder::Transform(const AffineTransform& xform) {
-  builder_.transform(xform.ToSkMatrix());
-
-  ClearCachedData();
+  if (xform.IsIdentity()) {
+    // The path and the cached data are unchanged.
+    return *this;
+  }
+  if (xform.IsIdentityOrTranslation()) {
+    const float dx = ClampToWithNaNTo0<float>(xform.E());
+    const float dy = ClampToWithNaNTo0<float>(xform.F());
+    builder_.offset(dx, dy);
+    OffsetCachedData(dx, dy);
+  } else {
+    builder_.transform(xform.ToSkMatrix());
+    ClearCachedData();
+  }
   return *this;
 }
 
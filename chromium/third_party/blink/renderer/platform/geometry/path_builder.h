@@ -5,6 +5,7 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PATH_BUILDER_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PATH_BUILDER_H_
 
+#include <array>
 #include <optional>
 
 #include "third_party/blink/renderer/platform/geometry/contoured_rect.h"
@@ -13,12 +14,12 @@
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/skia/include/core/SkPathBuilder.h"
+#include "ui/gfx/geometry/vector2d_f.h"
 
 namespace gfx {
 
 class RectF;
 class PointF;
-class Vector2dF;
 
 }  // namespace gfx
 
@@ -67,6 +68,12 @@ class PLATFORM_EXPORT PathBuilder {
 
   // Construct a path from the accumulated path data, and reset internal state.
   Path Finalize();
+  // Same as Finalize(), but copies the path data into the path instead of
+  // moving its storage there, so that the builder keeps its storage. A builder
+  // that is reused for many short-lived paths (e.g. the border and clip paths
+  // of each paint) stops reallocating once its storage fits the largest one,
+  // and each path gets a single allocation of the right size.
+  Path FinalizeKeepingStorage();
 
   // Access a Path based on the current path data, allowing further mutations.
   // Avoid if possible (use Finalize instead).
@@ -87,6 +94,11 @@ class PLATFORM_EXPORT PathBuilder {
 
   gfx::RectF BoundingRect() const;
 
+  // Reserves storage for |verbs| more verbs (of which up to |conics| are
+  // conics) and |points| more points, so that appending them doesn't
+  // reallocate.
+  PathBuilder& Reserve(int verbs, int points, int conics = 0);
+
   PathBuilder& MoveTo(const gfx::PointF&);
   PathBuilder& Close();
 
@@ -133,14 +145,42 @@ class PLATFORM_EXPORT PathBuilder {
   PathBuilder& Transform(const AffineTransform&);
 
  private:
+  // Drops the cached path after verbs are appended. The bounds of the points
+  // that were in the path already stay valid, and BoundingRect() extends them
+  // with the appended ones.
+  void ClearCachedPath() { current_path_.reset(); }
+  // Drops the cached path and bounds after points are moved or removed.
   void ClearCachedData();
+  // Drops the cached path and moves the bounds after the path is offset.
+  void OffsetCachedData(float dx, float dy);
+  // Drops the cached bounds before a contour is added with the add*()
+  // functions of SkPathBuilder, if the path ends with a move. The contour
+  // begins with a move, which replaces the point of that move.
+  void ClearCachedDataBeforeAddingContour();
 
   SkPathBuilder builder_;
 
   mutable std::optional<Path> current_path_;
-  mutable std::optional<gfx::RectF> current_bounds_;
+  // The control point bounds of the first |bounded_points_| points of the
+  // path, which BoundingRect() returns (or an empty rect if any of them isn't
+  // finite). It extends them with the points appended since, so that the
+  // bounds of incrementally drawn paths, which are asked for after each edit,
+  // aren't computed from all the points each time.
+  mutable SkRect point_bounds_ = SkRect::MakeEmpty();
+  mutable size_t bounded_points_ = 0;
+  mutable bool has_non_finite_points_ = false;
 };
 
+// Given superellipses with the supplied |curvatures| (all >= 1) in the
+// coordinate space -1,-1,1,1, returns for each the 3 vectors (2 control points
+// and the end point) of a bezier curve, going from t=0 (0, 1) clockwise to
+// t=0.5 (45 degrees), and following the path of the superellipse with a small
+// margin of error. The four are computed together in SIMD lanes, as
+// AddContouredRect() does for its corners.
+PLATFORM_EXPORT std::array<std::array<gfx::Vector2dF, 3>, 4>
+ApproximateSuperellipseHalfCornersAsBezierCurves(
+    const std::array<float, 4>& curvatures);
+
 }  // namespace blink
 
 #endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PATH_BUILDER_H_
@@ -4,8 +4,14 @@
 
 #include "third_party/blink/renderer/platform/geometry/path_builder.h"
 
+#include <cmath>
+#include <limits>
+
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/geometry/contoured_rect.h"
+#include "third_party/blink/renderer/platform/geometry/float_rounded_rect.h"
 #include "third_party/blink/renderer/platform/geometry/path_types.h"
+#include "third_party/blink/renderer/platform/transforms/affine_transform.h"
 
 namespace blink {
 
@@ -62,6 +68,74 @@ TEST(PathBuilderTest, CurrentPath) {
   EXPECT_NE(p4, p5);
 }
 
+TEST(PathBuilderTest, BoundingRect) {
+  PathBuilder builder;
+  EXPECT_EQ(gfx::RectF(), builder.BoundingRect());
+
+  // The bounds are extended with the appended points, and are the same as
+  // those of the path.
+  builder.MoveTo({10, 20});
+  EXPECT_EQ(gfx::RectF(10, 20, 0, 0), builder.BoundingRect());
+  builder.LineTo({30, 5});
+  EXPECT_EQ(gfx::RectF(10, 5, 20, 15), builder.BoundingRect());
+  builder.CubicTo({-5, 0}, {0, 50}, {15, 25});
+  EXPECT_EQ(gfx::RectF(-5, 0, 35, 50), builder.BoundingRect());
+  builder.AddEllipse({100, 100}, 10, 20);
+  EXPECT_EQ(builder.CurrentPath().BoundingRect(), builder.BoundingRect());
+  builder.Close();
+  builder.AddRect(gfx::RectF(-50, 0, 10, 10));
+  EXPECT_EQ(builder.CurrentPath().BoundingRect(), builder.BoundingRect());
+
+  // A move may replace the point of the move before it.
+  PathBuilder moves;
+  moves.MoveTo({100, 100});
+  EXPECT_EQ(gfx::RectF(100, 100, 0, 0), moves.BoundingRect());
+  moves.MoveTo({0, 0});
+  moves.LineTo({10, 10});
+  EXPECT_EQ(moves.CurrentPath().BoundingRect(), moves.BoundingRect());
+  // So may the move that a contour that is added begins with.
+  PathBuilder added;
+  added.MoveTo({100, 100});
+  EXPECT_EQ(gfx::RectF(100, 100, 0, 0), added.BoundingRect());
+  added.AddRect(gfx::RectF(0, 0, 10, 10));
+  EXPECT_EQ(gfx::RectF(0, 0, 10, 10), added.BoundingRect());
+  added.MoveTo({100, 100});
+  EXPECT_EQ(gfx::RectF(0, 0, 100, 100), added.BoundingRect());
+  added.AddEllipse({0, 0}, 5, 5);
+  EXPECT_EQ(added.CurrentPath().BoundingRect(), added.BoundingRect());
+  EXPECT_EQ(gfx::RectF(-5, -5, 15, 15), added.BoundingRect());
+
+  // Translations move the bounds, and other transforms recompute them.
+  builder.Translate({5, 10});
+  EXPECT_EQ(builder.CurrentPath().BoundingRect(), builder.BoundingRect());
+  builder.Transform(AffineTransform().Rotate(30));
+  EXPECT_EQ(builder.CurrentPath().BoundingRect(), builder.BoundingRect());
+  builder.LineTo({1000, 1000});
+  EXPECT_EQ(builder.CurrentPath().BoundingRect(), builder.BoundingRect());
+
+  // Non-finite points are empty bounds.
+  builder.LineTo({std::numeric_limits<float>::infinity(), 0});
+  EXPECT_EQ(gfx::RectF(), builder.BoundingRect());
+  builder.Reset();
+  builder.LineTo({1, 2});
+  EXPECT_EQ(gfx::RectF(0, 0, 1, 2), builder.BoundingRect());
+}
+
+TEST(PathBuilderTest, CurrentPathIsCachedBetweenEdits) {
+  PathBuilder builder;
+  builder.MoveTo({1, 2}).LineTo({3, 4});
+  const Path& path = builder.CurrentPath();
+  EXPECT_EQ(&path, &builder.CurrentPath());
+  builder.BoundingRect();
+  EXPECT_EQ(&path, &builder.CurrentPath());
+  const Path copy = path;
+
+  // The wind rule is the only edit that leaves the bounds.
+  builder.SetWindRule(WindRule::RULE_EVENODD);
+  EXPECT_NE(copy, builder.CurrentPath());
+  EXPECT_EQ(gfx::RectF(1, 2, 2, 2), builder.BoundingRect());
+}
+
 TEST(PathBuilderTest, WindRule) {
   PathBuilder builder;
 
@@ -76,4 +150,130 @@ TEST(PathBuilderTest, WindRule) {
       WindRule::RULE_EVENODD);
 }
 
+TEST(PathBuilderTest, FinalizeKeepingStorage) {
+  PathBuilder builder;
+  PathBuilder reference;
+  for (int i = 0; i < 3; ++i) {
+    builder.Reserve(4, 4).MoveTo({0, 0}).LineTo({10, 0}).LineTo({0, 10});
+    builder.Close();
+    reference.MoveTo({0, 0}).LineTo({10, 0}).LineTo({0, 10}).Close();
+
+    const Path path = builder.FinalizeKeepingStorage();
+    EXPECT_TRUE(builder.IsEmpty());
+    EXPECT_TRUE(builder.CurrentPath().IsEmpty());
+    EXPECT_EQ(path, reference.Finalize());
+  }
+}
+
+TEST(PathBuilderTest, TransformAndAddPath) {
+  const Path triangle =
+      PathBuilder().MoveTo({0, 0}).LineTo({10, 0}).LineTo({0, 10}).Finalize();
+  const Path translated =
+      PathBuilder().MoveTo({3, 4}).LineTo({13, 4}).LineTo({3, 14}).Finalize();
+  const Path scaled =
+      PathBuilder().MoveTo({3, 4}).LineTo({23, 4}).LineTo({3, 34}).Finalize();
+  const AffineTransform translation = AffineTransform::Translation(3, 4);
+  const AffineTransform scale_translation =
+      AffineTransform::Translation(3, 4).ScaleNonUniform(2, 3);
+
+  PathBuilder builder(triangle);
+  EXPECT_EQ(triangle.BoundingRect(), builder.BoundingRect());
+  builder.Transform(AffineTransform());
+  EXPECT_EQ(triangle, builder.CurrentPath());
+  EXPECT_EQ(triangle.BoundingRect(), builder.BoundingRect());
+  builder.Transform(translation);
+  EXPECT_EQ(translated, builder.CurrentPath());
+  EXPECT_EQ(translated.BoundingRect(), builder.BoundingRect());
+  builder.Transform(translation.Inverse()).Transform(scale_translation);
+  EXPECT_EQ(scaled, builder.CurrentPath());
+
+  EXPECT_EQ(triangle,
+            PathBuilder().AddPath(triangle, AffineTransform()).Finalize());
+  EXPECT_EQ(translated,
+            PathBuilder().AddPath(triangle, translation).Finalize());
+  EXPECT_EQ(scaled,
+            PathBuilder().AddPath(triangle, scale_translation).Finalize());
+}
+
+TEST(PathBuilderTest, ContouredRectCornersAreReused) {
+  const auto make_path = [](float curvature, float radius) {
+    return PathBuilder()
+        .AddContouredRect(ContouredRect(
+            FloatRoundedRect(gfx::RectF(0, 0, 100, 80), radius),
+            ContouredRect::CornerCurvature(curvature, curvature, curvature,
+                                           curvature)))
+        .Finalize();
+  };
+  const Path squircle = make_path(4, 20);
+  const Path scoop = make_path(0.5, 20);
+  EXPECT_NE(squircle, scoop);
+
+  // Corners with the same curvature and other radii share the control points
+  // of the unit corner, and paths are the same when they're built again after
+  // other curvatures evicted them.
+  const Path larger_squircle = make_path(4, 30);
+  EXPECT_NE(squircle, larger_squircle);
+  for (int i = 0; i < 20; ++i) {
+    make_path(2.5f + i, 10);
+  }
+  EXPECT_EQ(make_path(4, 20), squircle);
+  EXPECT_EQ(make_path(4, 30), larger_squircle);
+  EXPECT_EQ(make_path(0.5, 20), scoop);
+}
+
+// The scalar formula of the half corner, in double precision.
+std::array<gfx::Vector2dF, 3> ScalarHalfCorner(double curvature) {
+  constexpr double p[] = {1.2430920942724248, 2.010479023614843,
+                          0.32922901179443753, 0.2823023142212073,
+                          1.3473704261055421, 2.9149468637949814,
+                          0.9106507102917086};
+  const double s = std::log2(curvature);
+  const double slope =
+      p[0] + (p[6] - p[0]) * 0.5 * (1 + std::tanh(p[5] * (s - p[1])));
+  const double base = 1 / (1 + std::exp(-slope * (0 - p[1])));
+  const double logistic = 1 / (1 + std::exp(-slope * (s - p[1])));
+  const double a = (logistic - base) / (1 - base);
+  const double b = p[2] * std::exp(-p[3] * std::pow(s, p[4]));
+  const double half_corner = std::pow(0.5, 1 / curvature);
+  return {gfx::Vector2dF(a, 1),
+          gfx::Vector2dF(half_corner - b, half_corner + b),
+          gfx::Vector2dF(half_corner, half_corner)};
+}
+
+TEST(PathBuilderTest, ApproximateSuperellipseHalfCornersAsBezierCurves) {
+  // From the bevel to the straight corner, with a different curvature in each
+  // lane.
+  for (float curvature = 1; curvature <= 1000; curvature *= 1.01f) {
+    const std::array<float, 4> curvatures = {curvature, curvature * 1.5f,
+                                             1 + curvature / 1000, 2};
+    const auto control_points =
+        ApproximateSuperellipseHalfCornersAsBezierCurves(curvatures);
+    for (size_t i = 0; i < curvatures.size(); ++i) {
+      const auto expected = ScalarHalfCorner(curvatures[i]);
+      for (size_t j = 0; j < expected.size(); ++j) {
+        SCOPED_TRACE(testing::Message() << curvatures[i] << " " << j);
+        EXPECT_NEAR(expected[j].x(), control_points[i][j].x(), 1e-6);
+        EXPECT_NEAR(expected[j].y(), control_points[i][j].y(), 1e-6);
+      }
+    }
+  }
+}
+
+TEST(PathBuilderTest, ContouredRectCornersWithDifferentCurvatures) {
+  const ContouredRect contoured_rect(
+      FloatRoundedRect(gfx::RectF(0, 0, 100, 80), 20),
+      ContouredRect::CornerCurvature(4, 0.5, 1, 8));
+  const Path path = PathBuilder().AddContouredRect(contoured_rect).Finalize();
+
+  // The same as the corners that are added one at a time.
+  PathBuilder builder;
+  builder.MoveTo(contoured_rect.TopRightCorner().Start());
+  builder.AddCorner(contoured_rect.TopRightCorner());
+  builder.AddCorner(contoured_rect.BottomRightCorner());
+  builder.AddCorner(contoured_rect.BottomLeftCorner());
+  builder.AddCorner(contoured_rect.TopLeftCorner());
+  builder.Close();
+  EXPECT_EQ(builder.Finalize(), path);
+}
+
 }  // namespace blink
@@ -0,0 +1,44 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/path_intern_table.h"
+
+#include <cmath>
+
+#include "base/check_op.h"
+#include "third_party/blink/renderer/platform/geometry/float_rounded_rect.h"
+
+namespace blink {
+
+PathInternTable::PathInternTable(wtf_size_t capacity) : capacity_(capacity) {
+  DCHECK_GT(capacity, 0u);
+}
+
+PathInternTable::~PathInternTable() = default;
+
+Path PathInternTable::RoundedRectPath(const FloatRoundedRect& rect) {
+  // A contoured rect with round corners has the same path.
+  return ContouredRectPath(ContouredRect(rect));
+}
+
+Path PathInternTable::ContouredRectPath(const ContouredRect& rect) {
+  // Rects at infinity include the empty and deleted values of the map.
+  if (!std::isfinite(rect.Rect().x()) || !std::isfinite(rect.Rect().y())) {
+    return Path::MakeContouredRect(rect);
+  }
+  auto it = paths_.find(rect);
+  if (it != paths_.end()) {
+    return it->value;
+  }
+  if (paths_.size() >= capacity_) {
+    paths_.clear();
+  }
+  Path path = Path::MakeContouredRect(rect);
+  // Computed once, for the copies that the callers compare.
+  path.GetHash();
+  paths_.insert(rect, path);
+  return path;
+}
+
+}  // namespace blink
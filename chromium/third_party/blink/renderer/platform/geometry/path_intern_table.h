@@ -0,0 +1,50 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PATH_INTERN_TABLE_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PATH_INTERN_TABLE_H_
+
+#include "third_party/blink/renderer/platform/geometry/contoured_rect.h"
+#include "third_party/blink/renderer/platform/geometry/geometry_hash_traits.h"
+#include "third_party/blink/renderer/platform/geometry/path.h"
+#include "third_party/blink/renderer/platform/platform_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+
+namespace blink {
+
+class FloatRoundedRect;
+
+// Interns the paths of rounded and contoured rects by their geometry, so that
+// identical shapes (e.g. the same border-radius on each item of a list) share
+// one Path, with its data, hash and lazily built tables, instead of each
+// building its own. Paths that compare equal to an interned one also compare
+// cheaply, once both have their hashes. The table holds at most |capacity|
+// paths, and is cleared when a new shape would exceed that.
+class PLATFORM_EXPORT PathInternTable {
+  USING_FAST_MALLOC(PathInternTable);
+
+ public:
+  static constexpr wtf_size_t kDefaultCapacity = 256;
+
+  explicit PathInternTable(wtf_size_t capacity = kDefaultCapacity);
+  PathInternTable(const PathInternTable&) = delete;
+  PathInternTable& operator=(const PathInternTable&) = delete;
+  ~PathInternTable();
+
+  // The same as Path::MakeRoundedRect() and Path::MakeContouredRect().
+  Path RoundedRectPath(const FloatRoundedRect&);
+  Path ContouredRectPath(const ContouredRect&);
+
+  wtf_size_t size() const { return paths_.size(); }
+  void Clear() { paths_.clear(); }
+
+ private:
+  const wtf_size_t capacity_;
+  HashMap<ContouredRect, Path> paths_;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PATH_INTERN_TABLE_H_
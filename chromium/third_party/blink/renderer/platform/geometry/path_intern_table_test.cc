@@ -0,0 +1,50 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/path_intern_table.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/geometry/float_rounded_rect.h"
+
+namespace blink {
+
+TEST(PathInternTableTest, SharesPaths) {
+  PathInternTable table(4);
+  const FloatRoundedRect rect(gfx::RectF(10, 20, 100, 50), 8);
+  const ContouredRect squircle(
+      rect, ContouredRect::CornerCurvature(4, 4, 4, 4));
+
+  const Path rounded = table.RoundedRectPath(rect);
+  EXPECT_EQ(rounded, Path::MakeRoundedRect(rect));
+  EXPECT_EQ(table.RoundedRectPath(rect), rounded);
+  EXPECT_EQ(table.size(), 1u);
+
+  const Path contoured = table.ContouredRectPath(squircle);
+  EXPECT_EQ(contoured, Path::MakeContouredRect(squircle));
+  EXPECT_NE(contoured, rounded);
+  EXPECT_EQ(table.size(), 2u);
+  EXPECT_EQ(table.ContouredRectPath(squircle), contoured);
+  EXPECT_EQ(table.size(), 2u);
+
+  // The table is cleared when it's full.
+  for (int i = 0; i < 3; ++i) {
+    table.RoundedRectPath(FloatRoundedRect(gfx::RectF(i, 0, 10, 10), 2));
+  }
+  EXPECT_EQ(table.size(), 1u);
+}
+
+TEST(PathInternTableTest, HashTraits) {
+  const FloatRoundedRect rect(gfx::RectF(10, 20, 100, 50), 8);
+  const ContouredRect squircle(
+      rect, ContouredRect::CornerCurvature(4, 4, 4, 4));
+  EXPECT_EQ(HashTraits<ContouredRect>::GetHash(ContouredRect(rect)),
+            HashTraits<ContouredRect>::GetHash(ContouredRect(rect)));
+  EXPECT_NE(HashTraits<ContouredRect>::GetHash(ContouredRect(rect)),
+            HashTraits<ContouredRect>::GetHash(squircle));
+  EXPECT_NE(HashTraits<FloatRoundedRect>::GetHash(rect),
+            HashTraits<FloatRoundedRect>::GetHash(
+                FloatRoundedRect(gfx::RectF(10, 20, 100, 50), 9)));
+}
+
+}  // namespace blink
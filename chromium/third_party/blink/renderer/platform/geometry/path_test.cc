@@ -6,6 +6,13 @@
 
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/platform/geometry/path_builder.h"
+#include "third_party/blink/renderer/platform/geometry/stroke_data.h"
+#include "third_party/blink/renderer/platform/testing/task_environment.h"
+#include "third_party/blink/renderer/platform/transforms/affine_transform.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/skia_conversions.h"
 
 namespace blink {
 
@@ -24,4 +31,270 @@ TEST(PathTest, PointAtEndOfPath) {
   EXPECT_EQ(point_and_tangent.point, gfx::PointF(460, 470));
 }
 
+TEST(PathTest, Elements) {
+  const Path path = PathBuilder()
+                        .MoveTo({1, 2})
+                        .LineTo({3, 4})
+                        .QuadTo({5, 6}, {7, 8})
+                        .CubicTo({9, 10}, {11, 12}, {13, 14})
+                        .Close()
+                        .AddEllipse({50, 50}, 10, 20)
+                        .Finalize();
+  Vector<PathElementType> types;
+  Vector<gfx::PointF> points;
+  for (const PathElement& element : path.Elements()) {
+    types.push_back(element.type);
+    for (const gfx::PointF& point : element.points) {
+      points.push_back(point);
+    }
+  }
+  // The ellipse is made of four conics, each approximated with two quads.
+  ASSERT_EQ(types.size(), 15u);
+  EXPECT_EQ(types[0], kPathElementMoveToPoint);
+  EXPECT_EQ(types[1], kPathElementAddLineToPoint);
+  EXPECT_EQ(types[2], kPathElementAddQuadCurveToPoint);
+  EXPECT_EQ(types[3], kPathElementAddCurveToPoint);
+  EXPECT_EQ(types[4], kPathElementCloseSubpath);
+  EXPECT_EQ(types[5], kPathElementMoveToPoint);
+  for (wtf_size_t i = 6; i < 14; ++i) {
+    EXPECT_EQ(types[i], kPathElementAddQuadCurveToPoint);
+  }
+  EXPECT_EQ(types[14], kPathElementCloseSubpath);
+  ASSERT_EQ(points.size(), 7u + 1 + 16);
+  for (wtf_size_t i = 0; i < 7; ++i) {
+    EXPECT_EQ(points[i], gfx::PointF(2 * i + 1, 2 * i + 2));
+  }
+  EXPECT_EQ(points[7], gfx::PointF(60, 50));
+  EXPECT_EQ(points.back(), gfx::PointF(60, 50));
+
+  // Apply() calls the function with the same elements.
+  struct Collected {
+    Vector<PathElementType> types;
+    Vector<gfx::PointF> points;
+  } collected;
+  path.Apply(&collected, [](void* info, const PathElement& element) {
+    auto* collected = static_cast<Collected*>(info);
+    collected->types.push_back(element.type);
+    for (const gfx::PointF& point : element.points) {
+      collected->points.push_back(point);
+    }
+  });
+  EXPECT_EQ(collected.types, types);
+  EXPECT_EQ(collected.points, points);
+}
+
+TEST(PathTest, ArcLengthTable) {
+  const Path path = PathBuilder()
+                        .MoveTo(gfx::PointF(10, 10))
+                        .LineTo(gfx::PointF(110, 10))
+                        .CubicTo(gfx::PointF(150, 10), gfx::PointF(150, 90),
+                                 gfx::PointF(110, 90))
+                        .Close()
+                        .MoveTo(gfx::PointF(300, 300))
+                        .MoveTo(gfx::PointF(200, 200))
+                        .QuadTo(gfx::PointF(250, 150), gfx::PointF(300, 200))
+                        .Finalize();
+  Path prepared = path;
+  EXPECT_FALSE(prepared.HasArcLengthTable());
+  prepared.EnsureArcLengthTable();
+  EXPECT_TRUE(prepared.HasArcLengthTable());
+  EXPECT_FALSE(path.HasArcLengthTable());
+
+  EXPECT_EQ(prepared.length(), path.length());
+  const float length = path.length();
+  for (float distance : {-10.f, 0.f, 50.f, 100.f, 150.f, length - 50,
+                         length, length + 10}) {
+    SCOPED_TRACE(distance);
+    PointAndTangent expected = path.PointAndNormalAtLength(distance);
+    PointAndTangent actual = prepared.PointAndNormalAtLength(distance);
+    EXPECT_EQ(actual.point, expected.point);
+    EXPECT_EQ(actual.tangent_in_degrees, expected.tangent_in_degrees);
+  }
+
+  // Copies share the table, which is reset when the path is replaced.
+  Path copy = prepared;
+  EXPECT_TRUE(copy.HasArcLengthTable());
+  copy = SkPath();
+  EXPECT_FALSE(copy.HasArcLengthTable());
+  EXPECT_EQ(copy.length(), 0);
+}
+
+TEST(PathTest, ArcLengthTableOfEmptyPath) {
+  Path path;
+  path.EnsureArcLengthTable();
+  EXPECT_EQ(path.length(), 0);
+  EXPECT_EQ(path.PointAtLength(10), gfx::PointF());
+}
+
+TEST(PathTest, Hash) {
+  const Path a =
+      PathBuilder().MoveTo({0, 0}).LineTo({10, 0}).LineTo({0, 10}).Finalize();
+  const Path b = PathBuilder()
+                     .MoveTo({-0.f, 0})
+                     .LineTo({10, 0})
+                     .LineTo({0, 10})
+                     .Finalize();
+  const Path c =
+      PathBuilder().MoveTo({0, 0}).LineTo({10, 0}).LineTo({0, 11}).Finalize();
+  const Path d = PathBuilder()
+                     .MoveTo({0, 0})
+                     .LineTo({10, 0})
+                     .LineTo({0, 10})
+                     .SetWindRule(RULE_EVENODD)
+                     .Finalize();
+  EXPECT_EQ(a, b);
+  EXPECT_EQ(a.GetHash(), b.GetHash());
+  EXPECT_NE(a.GetHash(), c.GetHash());
+  EXPECT_NE(a.GetHash(), d.GetHash());
+  EXPECT_NE(a, c);
+  EXPECT_NE(a, d);
+
+  // The hash is shared by copies, and reset when the path is replaced.
+  Path copy = a;
+  EXPECT_EQ(copy.GetHash(), a.GetHash());
+  copy = c.GetSkPath();
+  EXPECT_EQ(copy.GetHash(), c.GetHash());
+}
+
+TEST(PathTest, ConservativeStrokeBoundingRect) {
+  const Path polyline = PathBuilder()
+                            .MoveTo({10, 10})
+                            .LineTo({100, 20})
+                            .LineTo({20, 40})
+                            .LineTo({90, 80})
+                            .Finalize();
+  const auto exact_bounds = [](const Path& path, const StrokeData& stroke) {
+    return gfx::SkRectToRectF(
+        path.StrokePath(stroke, AffineTransform()).computeTightBounds());
+  };
+
+  StrokeData stroke;
+  stroke.SetThickness(6);
+  stroke.SetLineJoin(kMiterJoin);
+  stroke.SetMiterLimit(10);
+  EXPECT_FALSE(polyline.ConservativeStrokeBoundingRectIsExact(stroke));
+  gfx::RectF bounds = polyline.ConservativeStrokeBoundingRect(stroke);
+  EXPECT_EQ(bounds, gfx::RectF(-20, -20, 150, 130));
+  EXPECT_TRUE(bounds.Contains(exact_bounds(polyline, stroke)));
+
+  stroke.SetLineCap(kSquareCap);
+  stroke.SetLineJoin(kBevelJoin);
+  EXPECT_FALSE(polyline.ConservativeStrokeBoundingRectIsExact(stroke));
+  EXPECT_TRUE(polyline.ConservativeStrokeBoundingRect(stroke).Contains(
+      exact_bounds(polyline, stroke)));
+
+  stroke.SetLineCap(kRoundCap);
+  stroke.SetLineJoin(kRoundJoin);
+  EXPECT_TRUE(polyline.ConservativeStrokeBoundingRectIsExact(stroke));
+  bounds = polyline.ConservativeStrokeBoundingRect(stroke);
+  EXPECT_EQ(bounds, gfx::RectF(7, 7, 96, 76));
+  const gfx::RectF exact = exact_bounds(polyline, stroke);
+  EXPECT_NEAR(bounds.x(), exact.x(), 0.01);
+  EXPECT_NEAR(bounds.y(), exact.y(), 0.01);
+  EXPECT_NEAR(bounds.right(), exact.right(), 0.01);
+  EXPECT_NEAR(bounds.bottom(), exact.bottom(), 0.01);
+  EXPECT_EQ(polyline.StrokeBoundingRect(stroke), bounds);
+
+  // Curves, and moves without lines, aren't drawn where the path's bounds
+  // say.
+  const Path with_move = PathBuilder(polyline).MoveTo({200, 200}).Finalize();
+  EXPECT_FALSE(with_move.ConservativeStrokeBoundingRectIsExact(stroke));
+  const Path with_curve =
+      PathBuilder(polyline).QuadTo({200, 200}, {20, 80}).Finalize();
+  EXPECT_FALSE(with_curve.ConservativeStrokeBoundingRectIsExact(stroke));
+  stroke.SetLineDash({5, 5}, 0);
+  EXPECT_FALSE(polyline.ConservativeStrokeBoundingRectIsExact(stroke));
+}
+
+TEST(PathTest, IntersectsQuad) {
+  const Path circle = Path::MakeEllipse({50, 50}, 20, 20);
+  // Rejected by the bounds.
+  EXPECT_FALSE(circle.Intersects(gfx::QuadF(gfx::RectF(0, 0, 30, 25))));
+  EXPECT_FALSE(circle.Intersects(gfx::QuadF(gfx::RectF(70, 30, 10, 10))));
+  // Inside, and containing the circle.
+  EXPECT_TRUE(circle.Intersects(gfx::QuadF(gfx::RectF(45, 45, 10, 10))));
+  EXPECT_TRUE(circle.Intersects(gfx::QuadF(gfx::PointF(50, 0), {110, 50},
+                                           {50, 110}, {-10, 50})));
+  // Within the bounds, but outside of the circle, and overlapping it.
+  EXPECT_FALSE(circle.Intersects(gfx::QuadF(gfx::RectF(30, 30, 3, 3))));
+  EXPECT_TRUE(circle.Intersects(gfx::QuadF(gfx::RectF(30, 30, 10, 10))));
+  EXPECT_FALSE(circle.Intersects(
+      gfx::QuadF(gfx::PointF(30, 30), {34, 30}, {30, 34}, {30, 34})));
+
+  // Paths that aren't convex are only rejected by their bounds.
+  const Path ring = PathBuilder()
+                        .AddEllipse({50, 50}, 20, 20)
+                        .AddEllipse({50, 50}, 10, 10)
+                        .SetWindRule(RULE_EVENODD)
+                        .Finalize();
+  EXPECT_FALSE(ring.Intersects(gfx::QuadF(gfx::RectF(45, 45, 10, 10))));
+  EXPECT_TRUE(ring.Intersects(gfx::QuadF(gfx::RectF(45, 45, 10, 10)),
+                              RULE_NONZERO));
+  EXPECT_TRUE(ring.Intersects(gfx::QuadF(gfx::RectF(0, 0, 100, 100))));
+  EXPECT_FALSE(ring.Intersects(gfx::QuadF(gfx::RectF(0, 0, 100, 20))));
+}
+
+TEST(PathTest, MeasureInParallel) {
+  test::TaskEnvironment task_environment;
+  PathBuilder builder;
+  for (wtf_size_t i = 0; i < 2 * Path::kMinContoursForParallelMeasurement;
+       ++i) {
+    const float x = i % 100;
+    const float y = i / 100;
+    builder.MoveTo({x, y}).QuadTo({x + 1, y - 2}, {x + 2, y}).LineTo({x, y});
+    if (i % 3) {
+      builder.Close();
+    }
+  }
+  const Path path = builder.Finalize();
+  const float length = path.length();
+  EXPECT_NEAR(path.LengthInParallel(), length, length * 1e-5);
+  const gfx::RectF bounds = path.TightBoundingRect();
+  EXPECT_EQ(Path(path.GetSkPath()).TightBoundingRectInParallel(), bounds);
+
+  // Small paths are measured on the calling thread.
+  const Path small = Path::MakeEllipse({0, 0}, 10, 20);
+  EXPECT_EQ(small.LengthInParallel(), small.length());
+  EXPECT_EQ(small.TightBoundingRectInParallel(), small.TightBoundingRect());
+}
+
+TEST(PathTest, HitTestGrid) {
+  // A star, whose center is outside with the even-odd rule, a circle, and a
+  // cubic loop.
+  const Path path = PathBuilder()
+                        .MoveTo(gfx::PointF(50, 0))
+                        .LineTo(gfx::PointF(80, 90))
+                        .LineTo(gfx::PointF(5, 35))
+                        .LineTo(gfx::PointF(95, 35))
+                        .LineTo(gfx::PointF(20, 90))
+                        .Close()
+                        .AddEllipse(gfx::PointF(150, 50), 40, 30)
+                        .MoveTo(gfx::PointF(60, 120))
+                        .CubicTo(gfx::PointF(250, 200), gfx::PointF(0, 200),
+                                 gfx::PointF(190, 120))
+                        .Finalize();
+  for (WindRule rule : {RULE_NONZERO, RULE_EVENODD}) {
+    Path accelerated = path;
+    accelerated.EnsureHitTestGrid(rule);
+    EXPECT_TRUE(accelerated.HasHitTestGrid());
+    for (float y = -5; y <= 205; y += 2.5f) {
+      for (float x = -5; x <= 205; x += 2.5f) {
+        const gfx::PointF point(x, y);
+        SCOPED_TRACE(point.ToString());
+        EXPECT_EQ(accelerated.Contains(point, rule),
+                  path.Contains(point, rule));
+      }
+    }
+  }
+
+  // Copies share the grid, which is reset when the path is replaced.
+  Path copy = path;
+  copy.EnsureHitTestGrid(RULE_NONZERO);
+  Path copy_of_copy = copy;
+  EXPECT_TRUE(copy_of_copy.HasHitTestGrid());
+  copy_of_copy = SkPath();
+  EXPECT_FALSE(copy_of_copy.HasHitTestGrid());
+  EXPECT_FALSE(copy_of_copy.Contains(gfx::PointF(50, 50), RULE_NONZERO));
+}
+
 }  // namespace blink
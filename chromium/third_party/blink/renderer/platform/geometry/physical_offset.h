@@ -5,7 +5,10 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PHYSICAL_OFFSET_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PHYSICAL_OFFSET_H_
 
+#include <type_traits>
+
 #include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/blink/renderer/platform/geometry/layout_unit_pair.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "ui/gfx/geometry/point.h"
 #include "ui/gfx/geometry/point_f.h"
@@ -49,6 +52,11 @@ struct PLATFORM_EXPORT PhysicalFixedOffset {
   constexpr bool operator==(const PhysicalFixedOffset& other) const = default;
 
   PhysicalFixedOffset operator+(const PhysicalFixedOffset& other) const {
+    if constexpr (std::is_same_v<ValueType, LayoutUnit>) {
+      const LayoutUnitPair sum =
+          LayoutUnitPair{left, top} + LayoutUnitPair{other.left, other.top};
+      return PhysicalFixedOffset{sum.first, sum.second};
+    }
     return PhysicalFixedOffset{this->left + other.left, this->top + other.top};
   }
   PhysicalFixedOffset& operator+=(const PhysicalFixedOffset& other) {
@@ -60,6 +68,11 @@ struct PLATFORM_EXPORT PhysicalFixedOffset {
     return PhysicalFixedOffset{-this->left, -this->top};
   }
   PhysicalFixedOffset operator-(const PhysicalFixedOffset& other) const {
+    if constexpr (std::is_same_v<ValueType, LayoutUnit>) {
+      const LayoutUnitPair difference =
+          LayoutUnitPair{left, top} - LayoutUnitPair{other.left, other.top};
+      return PhysicalFixedOffset{difference.first, difference.second};
+    }
     return PhysicalFixedOffset{this->left - other.left, this->top - other.top};
   }
   PhysicalFixedOffset& operator-=(const PhysicalFixedOffset& other) {
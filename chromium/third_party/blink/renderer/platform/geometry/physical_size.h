@@ -6,6 +6,7 @@
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_GEOMETRY_PHYSICAL_SIZE_H_
 
 #include "third_party/blink/renderer/platform/geometry/layout_unit.h"
+#include "third_party/blink/renderer/platform/geometry/layout_unit_pair.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "ui/gfx/geometry/size.h"
 #include "ui/gfx/geometry/size_f.h"
@@ -38,7 +39,7 @@ struct PLATFORM_EXPORT PhysicalSize {
   constexpr bool operator==(const PhysicalSize& other) const = default;
 
   PhysicalSize operator+(const PhysicalSize& other) const {
-    return PhysicalSize{this->width + other.width, this->height + other.height};
+    return FromPair(ToPair() + other.ToPair());
   }
   PhysicalSize& operator+=(const PhysicalSize& other) {
     *this = *this + other;
@@ -49,7 +50,7 @@ struct PLATFORM_EXPORT PhysicalSize {
     return PhysicalSize{-this->width, -this->height};
   }
   PhysicalSize operator-(const PhysicalSize& other) const {
-    return PhysicalSize{this->width - other.width, this->height - other.height};
+    return FromPair(ToPair() - other.ToPair());
   }
   PhysicalSize& operator-=(const PhysicalSize& other) {
     *this = *this - other;
@@ -118,6 +119,12 @@ struct PLATFORM_EXPORT PhysicalSize {
       : width(size.width()), height(size.height()) {}
 
   String ToString() const;
+
+ private:
+  LayoutUnitPair ToPair() const { return {width, height}; }
+  static PhysicalSize FromPair(LayoutUnitPair pair) {
+    return {pair.first, pair.second};
+  }
 };
 
 PLATFORM_EXPORT std::ostream& operator<<(std::ostream&, const PhysicalSize&);
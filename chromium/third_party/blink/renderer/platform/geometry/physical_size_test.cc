@@ -16,6 +16,19 @@ TEST(PhysicalSizeTest, MultipleFloat) {
             PhysicalSize(200, 14) * std::numeric_limits<float>::quiet_NaN());
 }
 
+TEST(PhysicalSizeTest, AddAndSubtractSaturate) {
+  const PhysicalSize max(LayoutUnit::Max(), LayoutUnit::Max());
+  const PhysicalSize min(LayoutUnit::Min(), LayoutUnit::Min());
+  EXPECT_EQ(PhysicalSize(LayoutUnit::Max(), LayoutUnit(-1)),
+            PhysicalSize(LayoutUnit::Max(), LayoutUnit(1)) +
+                PhysicalSize(LayoutUnit(1), LayoutUnit(-2)));
+  EXPECT_EQ(max, max + max);
+  EXPECT_EQ(min, min + min);
+  EXPECT_EQ(max, max - min);
+  EXPECT_EQ(min, min - max);
+  EXPECT_EQ(PhysicalSize(3, 4), PhysicalSize(1, 6) - PhysicalSize(-2, 2));
+}
+
 TEST(PhysicalSizeTest, ExpandedTo) {
   EXPECT_EQ(PhysicalSize(13, 7), PhysicalSize(13, 1).ExpandedTo({10, 7}));
   EXPECT_EQ(PhysicalSize(17, 1), PhysicalSize(13, 1).ExpandedTo({17, 1}));
@@ -28,17 +28,43 @@
 
 #include "third_party/blink/renderer/platform/geometry/stroke_data.h"
 
+#include <algorithm>
+
 #include "base/containers/heap_array.h"
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "third_party/skia/include/core/SkScalar.h"
 
 namespace blink {
 
-void StrokeData::SetLineDash(const DashArray& dashes, float dash_offset) {
-  wtf_size_t dash_length = dashes.size();
-  if (!dash_length) {
-    dash_.reset();
-    return;
+namespace {
+
+// The most recently made dash effects, so that repaints with the same dashes
+// share an effect instead of making a new one each time. It's lock-protected,
+// since strokes are also set up for canvases on workers.
+struct DashEffectCache {
+  static constexpr wtf_size_t kSize = 8;
+
+  struct Entry {
+    DashArray dashes;
+    float dash_offset;
+    sk_sp<cc::PathEffect> effect;
+  };
+
+  static DashEffectCache& Get() {
+    static base::NoDestructor<DashEffectCache> cache;
+    return *cache;
   }
 
+  base::Lock lock;
+  // The most recently used first.
+  Vector<Entry, kSize> entries GUARDED_BY(lock);
+};
+
+sk_sp<cc::PathEffect> MakeDashEffect(const DashArray& dashes,
+                                     float dash_offset) {
+  wtf_size_t dash_length = dashes.size();
   wtf_size_t count = !(dash_length % 2) ? dash_length : dash_length * 2;
   auto intervals = base::HeapArray<float>::Uninit(count);
 
@@ -46,13 +72,49 @@ void StrokeData::SetLineDash(const DashArray& dashes, float dash_offset) {
     intervals[i] = dashes[i % dash_length];
   }
 
-  dash_ = cc::PathEffect::MakeDash(intervals.data(), count, dash_offset);
+  return cc::PathEffect::MakeDash(intervals.data(), count, dash_offset);
+}
+
+}  // namespace
+
+void StrokeData::SetLineDash(const DashArray& dashes, float dash_offset) {
+  if (dashes.empty()) {
+    dash_.reset();
+    return;
+  }
+
+  DashEffectCache& cache = DashEffectCache::Get();
+  base::AutoLock locker(cache.lock);
+  auto* it = std::ranges::find_if(cache.entries, [&](const auto& entry) {
+    return entry.dash_offset == dash_offset && entry.dashes == dashes;
+  });
+  if (it == cache.entries.end()) {
+    if (cache.entries.size() == DashEffectCache::kSize) {
+      cache.entries.pop_back();
+    }
+    cache.entries.push_front(DashEffectCache::Entry{
+        dashes, dash_offset, MakeDashEffect(dashes, dash_offset)});
+  } else {
+    std::rotate(cache.entries.begin(), it, it + 1);
+  }
+  dash_ = cache.entries.front().effect;
 }
 
 void StrokeData::SetDashEffect(sk_sp<cc::PathEffect> dash_effect) {
   dash_ = std::move(dash_effect);
 }
 
+float StrokeData::InflationRadius() const {
+  float multiplier = 1;
+  if (line_join_ == cc::PaintFlags::kMiter_Join) {
+    multiplier = std::max(multiplier, miter_limit_);
+  }
+  if (line_cap_ == cc::PaintFlags::kSquare_Cap) {
+    multiplier = std::max(multiplier, SK_ScalarSqrt2);
+  }
+  return std::max(thickness_, 0.f) / 2 * multiplier;
+}
+
 void StrokeData::SetupPaint(cc::PaintFlags* flags) const {
   flags->setStyle(cc::PaintFlags::kStroke_Style);
   flags->setStrokeWidth(SkFloatToScalar(thickness_));
@@ -63,6 +63,17 @@ class PLATFORM_EXPORT StrokeData final {
   void SetLineDash(const DashArray&, float);
   void SetDashEffect(sk_sp<cc::PathEffect> dash_effect);
 
+  // The farthest that a stroke extends from its path, as with
+  // SkStrokeRec::GetInflationRadius(): half the thickness, times the miter
+  // limit for miter joins, or times sqrt(2) for square caps.
+  float InflationRadius() const;
+  // Whether the stroke of a path is the set of points within half the
+  // thickness of the path: the stroke has round caps and joins and no dashes.
+  bool IsRoundAndSolid() const {
+    return line_cap_ == cc::PaintFlags::kRound_Cap &&
+           line_join_ == cc::PaintFlags::kRound_Join && !dash_;
+  }
+
   // Sets everything on the paint except the pattern, gradient and color.
   void SetupPaint(cc::PaintFlags*) const;
 
@@ -0,0 +1,46 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/geometry/stroke_data.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace blink {
+
+namespace {
+
+sk_sp<cc::PathEffect> GetDashEffect(const StrokeData& stroke_data) {
+  cc::PaintFlags flags;
+  stroke_data.SetupPaint(&flags);
+  return flags.getPathEffect();
+}
+
+}  // namespace
+
+TEST(StrokeDataTest, SetLineDashSharesEffects) {
+  StrokeData a;
+  StrokeData b;
+  a.SetLineDash({4, 2}, 1);
+  b.SetLineDash({4, 2}, 1);
+  ASSERT_TRUE(GetDashEffect(a));
+  EXPECT_EQ(GetDashEffect(a), GetDashEffect(b));
+
+  b.SetLineDash({4, 2}, 2);
+  EXPECT_NE(GetDashEffect(a), GetDashEffect(b));
+  b.SetLineDash({4, 2, 1}, 1);
+  EXPECT_NE(GetDashEffect(a), GetDashEffect(b));
+
+  // Other dashes evict the least recently used ones.
+  for (int i = 0; i < 20; ++i) {
+    b.SetLineDash({static_cast<float>(i + 10)}, 0);
+  }
+  b.SetLineDash({4, 2}, 1);
+  EXPECT_TRUE(GetDashEffect(b));
+  EXPECT_NE(GetDashEffect(a), GetDashEffect(b));
+
+  b.SetLineDash({}, 0);
+  EXPECT_FALSE(GetDashEffect(b));
+}
+
+}  // namespace blink
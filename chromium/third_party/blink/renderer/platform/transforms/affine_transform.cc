@@ -27,6 +27,9 @@
 
 #include "third_party/blink/renderer/platform/transforms/affine_transform.h"
 
+#include <limits>
+
+#include "base/check_op.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
 #include "third_party/blink/renderer/platform/wtf/text/strcat.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
@@ -44,6 +47,40 @@
 
 namespace blink {
 
+namespace {
+
+// The operations below use the lanes of gfx::Double4 for the components of
+// two points, or of the two columns of the 2x2 matrix. Each lane gives the
+// same result as the scalar operation.
+
+// ClampToWithNaNTo0<float>() of each lane of |v|.
+inline gfx::Float4 ClampToFloat4(gfx::Double4 v) {
+  const gfx::Double4 kMax =
+      gfx::Double4{} + std::numeric_limits<float>::max();
+  const gfx::Double4 kLowest =
+      gfx::Double4{} + std::numeric_limits<float>::lowest();
+  v = v == v ? v : gfx::Double4{};
+  v = v >= kMax ? kMax : v;
+  v = v <= kLowest ? kLowest : v;
+  return __builtin_convertvector(v, gfx::Float4);
+}
+
+// AffineTransform::MapPoint() of (x0, y0) and (x1, y1) through |t|, with the
+// results in the lanes {x0, y0, x1, y1}.
+inline gfx::Float4 MapTwoPoints(const AffineTransform& t,
+                                double x0,
+                                double y0,
+                                double x1,
+                                double y1) {
+  const gfx::Double4 ab = {t.A(), t.B(), t.A(), t.B()};
+  const gfx::Double4 cd = {t.C(), t.D(), t.C(), t.D()};
+  const gfx::Double4 ef = {t.E(), t.F(), t.E(), t.F()};
+  return ClampToFloat4(ab * gfx::Double4{x0, x0, x1, x1} +
+                       cd * gfx::Double4{y0, y0, y1, y1} + ef);
+}
+
+}  // namespace
+
 double AffineTransform::XScaleSquared() const {
   return transform_[0] * transform_[0] + transform_[1] * transform_[1];
 }
@@ -80,17 +117,16 @@ AffineTransform AffineTransform::Inverse() const {
   if (!std::isnormal(determinant))
     return result;
 
-  result.transform_[0] = transform_[3] / determinant;
-  result.transform_[1] = -transform_[1] / determinant;
-  result.transform_[2] = -transform_[2] / determinant;
-  result.transform_[3] = transform_[0] / determinant;
-  result.transform_[4] =
-      (transform_[2] * transform_[5] - transform_[3] * transform_[4]) /
-      determinant;
-  result.transform_[5] =
-      (transform_[1] * transform_[4] - transform_[0] * transform_[5]) /
+  const double a = A(), b = B(), c = C(), d = D(), e = E(), f = F();
+  gfx::StoreDouble4(gfx::Double4{d, -b, -c, a} / determinant,
+                    result.transform_);
+  // {c * f - d * e, b * e - a * f} in the low lanes.
+  const gfx::Double4 translation =
+      (gfx::Double4{c, b, 0, 0} * gfx::Double4{f, e, 0, 0} -
+       gfx::Double4{d, a, 0, 0} * gfx::Double4{e, f, 0, 0}) /
       determinant;
-
+  result.transform_[4] = translation[0];
+  result.transform_[5] = translation[1];
   return result;
 }
 
@@ -103,11 +139,17 @@ inline AffineTransform DoMultiply(const AffineTransform& t1,
                            t1.F() + t2.F());
   }
 
-  return AffineTransform(
-      t1.A() * t2.A() + t1.C() * t2.B(), t1.B() * t2.A() + t1.D() * t2.B(),
-      t1.A() * t2.C() + t1.C() * t2.D(), t1.B() * t2.C() + t1.D() * t2.D(),
-      t1.A() * t2.E() + t1.C() * t2.F() + t1.E(),
-      t1.B() * t2.E() + t1.D() * t2.F() + t1.F());
+  // The columns of t1 times those of t2, i.e. {a, b, c, d} in the lanes of
+  // |linear| and {e, f} in the low lanes of |translation|.
+  const gfx::Double4 ab = {t1.A(), t1.B(), t1.A(), t1.B()};
+  const gfx::Double4 cd = {t1.C(), t1.D(), t1.C(), t1.D()};
+  const gfx::Double4 linear =
+      ab * gfx::Double4{t2.A(), t2.A(), t2.C(), t2.C()} +
+      cd * gfx::Double4{t2.B(), t2.B(), t2.D(), t2.D()};
+  const gfx::Double4 translation =
+      ab * t2.E() + cd * t2.F() + gfx::Double4{t1.E(), t1.F(), 0, 0};
+  return AffineTransform(linear[0], linear[1], linear[2], linear[3],
+                         translation[0], translation[1]);
 }
 
 }  // anonymous namespace
@@ -202,6 +244,22 @@ gfx::PointF AffineTransform::MapPoint(const gfx::PointF& point) const {
                                   transform_[3] * point.y() + transform_[5]));
 }
 
+void AffineTransform::MapPoints(base::span<const gfx::PointF> points,
+                                base::span<gfx::PointF> results) const {
+  CHECK_EQ(points.size(), results.size());
+  size_t i = 0;
+  for (; i + 2 <= points.size(); i += 2) {
+    const gfx::Float4 mapped =
+        MapTwoPoints(*this, points[i].x(), points[i].y(),
+                     points[i + 1].x(), points[i + 1].y());
+    results[i] = gfx::PointF(mapped[0], mapped[1]);
+    results[i + 1] = gfx::PointF(mapped[2], mapped[3]);
+  }
+  if (i < points.size()) {
+    results[i] = MapPoint(points[i]);
+  }
+}
+
 gfx::Rect AffineTransform::MapRect(const gfx::Rect& rect) const {
   return gfx::ToEnclosingRect(MapRect(gfx::RectF(rect)));
 }
@@ -219,18 +277,21 @@ gfx::RectF AffineTransform::MapRect(const gfx::RectF& rect) const {
 }
 
 gfx::QuadF AffineTransform::MapQuad(const gfx::QuadF& q) const {
-  return gfx::QuadF(MapPoint(q.p1()), MapPoint(q.p2()), MapPoint(q.p3()),
-                    MapPoint(q.p4()));
+  const gfx::Float4 p12 =
+      MapTwoPoints(*this, q.p1().x(), q.p1().y(), q.p2().x(), q.p2().y());
+  const gfx::Float4 p34 =
+      MapTwoPoints(*this, q.p3().x(), q.p3().y(), q.p4().x(), q.p4().y());
+  return gfx::QuadF(gfx::PointF(p12[0], p12[1]), gfx::PointF(p12[2], p12[3]),
+                    gfx::PointF(p34[0], p34[1]), gfx::PointF(p34[2], p34[3]));
 }
 
 // static
 AffineTransform AffineTransform::FromTransform(const gfx::Transform& t) {
-  return AffineTransform(t.rc(0, 0), t.rc(1, 0), t.rc(0, 1), t.rc(1, 1),
-                         t.rc(0, 3), t.rc(1, 3));
+  return AffineTransform(t.To2dAffine());
 }
 
 gfx::Transform AffineTransform::ToTransform() const {
-  return gfx::Transform::Affine(A(), B(), C(), D(), E(), F());
+  return gfx::Transform(ToAffineTransform2d());
 }
 
 SkMatrix AffineTransform::ToSkMatrix() const {
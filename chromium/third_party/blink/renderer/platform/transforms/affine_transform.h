@@ -28,10 +28,13 @@
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_AFFINE_TRANSFORM_H_
 
 #include <string.h>  // for memcpy
+
+#include "base/containers/span.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "ui/gfx/geometry/affine_transform2d.h"
 #include "ui/gfx/geometry/double4.h"
 
 namespace gfx {
@@ -59,12 +62,23 @@ class PLATFORM_EXPORT AffineTransform {
                             double e,
                             double f)
       : transform_{a, b, c, d, e, f} {}
+  // gfx::AffineTransform2d has the same components, so these convert without
+  // going through a 4x4 matrix.
+  constexpr explicit AffineTransform(const gfx::AffineTransform2d& t)
+      : transform_{t.a(), t.b(), t.c(), t.d(), t.e(), t.f()} {}
+  constexpr gfx::AffineTransform2d ToAffineTransform2d() const {
+    return gfx::AffineTransform2d(A(), B(), C(), D(), E(), F());
+  }
 
   void SetMatrix(double a, double b, double c, double d, double e, double f) {
     *this = AffineTransform(a, b, c, d, e, f);
   }
 
   [[nodiscard]] gfx::PointF MapPoint(const gfx::PointF&) const;
+  // MapPoint() of each of |points| into |results|, which must have the same
+  // size, two points at a time. |points| and |results| may be the same.
+  void MapPoints(base::span<const gfx::PointF> points,
+                 base::span<gfx::PointF> results) const;
 
   // Rounds the resulting mapped rectangle out. This is helpful for bounding
   // box computations but may not be what is wanted in other contexts.
@@ -84,17 +98,17 @@ class PLATFORM_EXPORT AffineTransform {
                         gfx::Double4{1, 0, 0, 1});
   }
 
-  double A() const { return transform_[0]; }
+  constexpr double A() const { return transform_[0]; }
   void SetA(double a) { transform_[0] = a; }
-  double B() const { return transform_[1]; }
+  constexpr double B() const { return transform_[1]; }
   void SetB(double b) { transform_[1] = b; }
-  double C() const { return transform_[2]; }
+  constexpr double C() const { return transform_[2]; }
   void SetC(double c) { transform_[2] = c; }
-  double D() const { return transform_[3]; }
+  constexpr double D() const { return transform_[3]; }
   void SetD(double d) { transform_[3] = d; }
-  double E() const { return transform_[4]; }
+  constexpr double E() const { return transform_[4]; }
   void SetE(double e) { transform_[4] = e; }
-  double F() const { return transform_[5]; }
+  constexpr double F() const { return transform_[5]; }
   void SetF(double f) { transform_[5] = f; }
 
   void MakeIdentity() { *this = AffineTransform(); }
@@ -133,6 +147,9 @@ class PLATFORM_EXPORT AffineTransform {
   // gfx::Transform and ignoring other components.
   [[nodiscard]] static AffineTransform FromTransform(const gfx::Transform&);
 
+  // The result is a 2d affine gfx::Transform, not a full matrix. To apply this
+  // to a gfx::Transform, pass ToAffineTransform2d() to its PreConcat() or
+  // PostConcat() instead of a temporary gfx::Transform.
   [[nodiscard]] gfx::Transform ToTransform() const;
   [[nodiscard]] SkMatrix ToSkMatrix() const;
   [[nodiscard]] SkM44 ToSkM44() const;
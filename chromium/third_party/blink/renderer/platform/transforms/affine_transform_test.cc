@@ -11,6 +11,7 @@
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/quad_f.h"
 #include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/transform.h"
 
 namespace blink {
 
@@ -128,6 +129,31 @@ TEST(AffineTransformTest, MultiplySelf) {
   EXPECT_EQ(a, b);
 }
 
+TEST(AffineTransformTest, MapPoints) {
+  AffineTransform t(1.25, -0.5, 0.75, 2, 3.5, -7);
+  const std::array<gfx::PointF, 5> points = {
+      gfx::PointF(1.5f, 2.25f), gfx::PointF(-100, 0.1f),
+      gfx::PointF(3e38f, -3e38f), gfx::PointF(0, 1e-30f),
+      gfx::PointF(42, -42)};
+  std::array<gfx::PointF, 5> results;
+  t.MapPoints(points, results);
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(t.MapPoint(points[i]), results[i]) << i;
+  }
+
+  // In place.
+  results = points;
+  t.MapPoints(results, results);
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(t.MapPoint(points[i]), results[i]) << i;
+  }
+
+  const gfx::QuadF quad(points[0], points[1], points[3], points[4]);
+  EXPECT_EQ(gfx::QuadF(t.MapPoint(quad.p1()), t.MapPoint(quad.p2()),
+                       t.MapPoint(quad.p3()), t.MapPoint(quad.p4())),
+            t.MapQuad(quad));
+}
+
 TEST(AffineTransformTest, ValidRangedMatrix) {
   constexpr std::array entries = {
       // The first entry is initial matrix value.
@@ -173,6 +199,20 @@ TEST(AffineTransformTest, ValidRangedMatrix) {
   }
 }
 
+TEST(AffineTransformTest, GfxConversions) {
+  const AffineTransform affine(1, 2, 3, 4, 5, 6);
+  EXPECT_EQ(gfx::AffineTransform2d(1, 2, 3, 4, 5, 6),
+            affine.ToAffineTransform2d());
+  EXPECT_EQ(affine, AffineTransform(affine.ToAffineTransform2d()));
+  EXPECT_EQ(gfx::Transform::Affine(1, 2, 3, 4, 5, 6), affine.ToTransform());
+  EXPECT_EQ(affine, AffineTransform::FromTransform(affine.ToTransform()));
+
+  gfx::Transform transform = gfx::Transform::MakeScale(2, 3);
+  transform.PreConcat(affine.ToAffineTransform2d());
+  EXPECT_EQ(AffineTransform::MakeScaleNonUniform(2, 3) * affine,
+            AffineTransform::FromTransform(transform));
+}
+
 TEST(AffineTransformTest, ToString) {
   AffineTransform identity;
   EXPECT_EQ("identity", identity.ToString());
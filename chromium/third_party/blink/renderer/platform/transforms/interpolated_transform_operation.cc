@@ -42,6 +42,36 @@ bool InterpolatedTransformOperation::IsEqualAssumingSameType(
 void InterpolatedTransformOperation::Apply(
     gfx::Transform& transform,
     const gfx::SizeF& border_box_size) const {
+  if (!memo_) {
+    transform.PreConcat(BlendedMatrix(border_box_size));
+    return;
+  }
+
+  BoxSizeDependency dependencies = BoxSizeDependencies();
+  bool valid = memo_->box_size &&
+               (!(dependencies & kDependsWidth) ||
+                memo_->box_size->width() == border_box_size.width()) &&
+               (!(dependencies & kDependsHeight) ||
+                memo_->box_size->height() == border_box_size.height());
+  if (!valid) {
+    memo_->matrix = BlendedMatrix(border_box_size);
+    memo_->box_size = border_box_size;
+  }
+  transform.PreConcat(memo_->matrix);
+}
+
+bool InterpolatedTransformOperation::ContainsInterpolated(
+    const TransformOperations& operations) const {
+  for (wtf_size_t i = starting_index_; i < operations.size(); ++i) {
+    if (operations.at(i)->GetType() == kInterpolated) {
+      return true;
+    }
+  }
+  return false;
+}
+
+gfx::Transform InterpolatedTransformOperation::BlendedMatrix(
+    const gfx::SizeF& border_box_size) const {
   gfx::Transform from_transform;
   gfx::Transform to_transform;
   from_.ApplyRemaining(border_box_size, starting_index_, from_transform);
@@ -49,7 +79,7 @@ void InterpolatedTransformOperation::Apply(
 
   if (!to_transform.Blend(from_transform, progress_) && progress_ < 0.5)
     to_transform = from_transform;
-  transform.PreConcat(to_transform);
+  return to_transform;
 }
 
 TransformOperation* InterpolatedTransformOperation::Blend(
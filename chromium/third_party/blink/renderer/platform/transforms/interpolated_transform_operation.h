@@ -31,10 +31,15 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_INTERPOLATED_TRANSFORM_OPERATION_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_INTERPOLATED_TRANSFORM_OPERATION_H_
 
+#include <memory>
+#include <optional>
+
 #include "base/notreached.h"
 #include "third_party/blink/renderer/platform/transforms/transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/transform_operations.h"
 #include "third_party/blink/renderer/platform/wtf/casting.h"
+#include "ui/gfx/geometry/size_f.h"
+#include "ui/gfx/geometry/transform.h"
 
 namespace blink {
 
@@ -46,10 +51,14 @@ class PLATFORM_EXPORT InterpolatedTransformOperation final
                                  const TransformOperations& to,
                                  int starting_index,
                                  double progress)
-      : from_(from),
+      : TransformOperation(kInterpolated),
+        from_(from),
         to_(to),
         starting_index_(starting_index),
-        progress_(progress) {
+        progress_(progress),
+        memo_(ContainsInterpolated(from_) || ContainsInterpolated(to_)
+                  ? std::make_unique<Memo>()
+                  : nullptr) {
     // This should only be generated during interpolation when it is impossible
     // to create a Matrix3DTransformOperation due to layout-dependence.
     DCHECK(BoxSizeDependencies());
@@ -93,6 +102,9 @@ class PLATFORM_EXPORT InterpolatedTransformOperation final
                                to_.BoxSizeDependencies(starting_index_));
   }
 
+  bool ContainsInterpolated(const TransformOperations& operations) const;
+  gfx::Transform BlendedMatrix(const gfx::SizeF& border_box_size) const;
+
   const TransformOperations from_;
   const TransformOperations to_;
   // Number of operations to skip from the start of each list. By spec,
@@ -100,6 +112,20 @@ class PLATFORM_EXPORT InterpolatedTransformOperation final
   // start of the list and matrix interpolation for the remainder.
   int starting_index_;
   double progress_;
+
+  // Interrupted transitions between mismatched lists nest interpolated
+  // operations, and applying a chain would blend every level again. Nested
+  // operations therefore memoize their matrix for the last box size, which
+  // flattens the chain into a single matrix while the box size is the same.
+  // The memoized matrix is only valid for the dimensions the operation
+  // depends on.
+  struct Memo {
+    std::optional<gfx::SizeF> box_size;
+    gfx::Transform matrix;
+  };
+  // Only allocated for nested operations, so that the others only carry a
+  // pointer.
+  const std::unique_ptr<Memo> memo_;
 };
 
 template <>
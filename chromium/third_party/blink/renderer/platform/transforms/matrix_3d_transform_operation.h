@@ -35,7 +35,7 @@ class PLATFORM_EXPORT Matrix3DTransformOperation final
     : public TransformOperation {
  public:
   explicit Matrix3DTransformOperation(const gfx::Transform& matrix)
-      : matrix_(matrix) {}
+      : TransformOperation(kMatrix3D), matrix_(matrix) {}
 
   gfx::Transform Matrix() const { return matrix_; }
 
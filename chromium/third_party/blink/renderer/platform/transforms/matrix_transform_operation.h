@@ -34,7 +34,8 @@ namespace blink {
 class PLATFORM_EXPORT MatrixTransformOperation final
     : public TransformOperation {
  public:
-  explicit MatrixTransformOperation(const gfx::Transform& t) : matrix_(t) {
+  explicit MatrixTransformOperation(const gfx::Transform& t)
+      : TransformOperation(kMatrix), matrix_(t) {
     DCHECK(t.Is2dTransform());
   }
 
@@ -44,7 +45,8 @@ class PLATFORM_EXPORT MatrixTransformOperation final
                            double d,
                            double e,
                            double f)
-      : matrix_(gfx::Transform::Affine(a, b, c, d, e, f)) {}
+      : TransformOperation(kMatrix),
+        matrix_(gfx::Transform::Affine(a, b, c, d, e, f)) {}
 
   const gfx::Transform& Matrix() const { return matrix_; }
 
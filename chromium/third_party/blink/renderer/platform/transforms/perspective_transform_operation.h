@@ -37,7 +37,8 @@ namespace blink {
 class PLATFORM_EXPORT PerspectiveTransformOperation final
     : public TransformOperation {
  public:
-  explicit PerspectiveTransformOperation(std::optional<double> p) : p_(p) {}
+  explicit PerspectiveTransformOperation(std::optional<double> p)
+      : TransformOperation(kPerspective), p_(p) {}
 
   std::optional<double> Perspective() const { return p_; }
 
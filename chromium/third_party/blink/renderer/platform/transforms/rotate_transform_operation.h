@@ -35,7 +35,7 @@ namespace blink {
 class PLATFORM_EXPORT RotateTransformOperation : public TransformOperation {
  public:
   RotateTransformOperation(const Rotation& rotation, OperationType type)
-      : rotation_(rotation), type_(type) {}
+      : TransformOperation(type), rotation_(rotation), type_(type) {}
 
   RotateTransformOperation(double angle, OperationType type)
       : RotateTransformOperation((Rotation(gfx::Vector3dF(0, 0, 1), angle)),
@@ -21,6 +21,7 @@
 
 #include "third_party/blink/renderer/platform/transforms/rotation.h"
 
+#include "base/check_op.h"
 #include "third_party/blink/renderer/platform/geometry/blend.h"
 #include "ui/gfx/geometry/quaternion.h"
 #include "ui/gfx/geometry/transform.h"
@@ -127,6 +128,28 @@ Rotation Rotation::Slerp(const Rotation& from,
   return ComputeRotation(qc);
 }
 
+void Rotation::SlerpMany(const Rotation& from,
+                         const Rotation& to,
+                         base::span<const double> progress,
+                         base::span<Rotation> out) {
+  CHECK_EQ(progress.size(), out.size());
+  double from_angle;
+  double to_angle;
+  gfx::Vector3dF axis;
+  if (GetCommonAxis(from, to, axis, from_angle, to_angle)) {
+    for (size_t i = 0; i < progress.size(); ++i) {
+      out[i] = Rotation(axis, blink::Blend(from_angle, to_angle, progress[i]));
+    }
+    return;
+  }
+
+  gfx::QuaternionSlerpPlan plan(ComputeQuaternion(from),
+                                ComputeQuaternion(to));
+  for (size_t i = 0; i < progress.size(); ++i) {
+    out[i] = ComputeRotation(plan.Evaluate(progress[i]));
+  }
+}
+
 Rotation Rotation::Add(const Rotation& a, const Rotation& b) {
   double angle_a;
   double angle_b;
@@ -5,6 +5,7 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_ROTATION_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_ROTATION_H_
 
+#include "base/containers/span.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "ui/gfx/geometry/vector3d_f.h"
 
@@ -32,6 +33,15 @@ struct PLATFORM_EXPORT Rotation {
                         const Rotation& to,
                         double progress);
 
+  // Same as calling Slerp() for each of |progress| into the corresponding
+  // element of |out|, but the common axis or the quaternions of the
+  // endpoints are computed only once. |out| must have the same size as
+  // |progress|.
+  static void SlerpMany(const Rotation& from,
+                        const Rotation& to,
+                        base::span<const double> progress,
+                        base::span<Rotation> out);
+
   // Returns a rotation whose effect is equivalent to applying a followed by b.
   static Rotation Add(const Rotation& /*a*/, const Rotation& /*b*/);
 
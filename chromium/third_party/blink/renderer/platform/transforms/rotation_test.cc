@@ -4,6 +4,9 @@
 
 #include "third_party/blink/renderer/platform/transforms/rotation.h"
 
+#include <iterator>
+#include <utility>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/platform/wtf/math_extras.h"
 #include "ui/gfx/geometry/point3_f.h"
@@ -136,4 +139,25 @@ TEST(RotationTest, SlerpTest) {
   EXPECT_ANGLE(expected_angle, xy_rotation.angle);
 }
 
+TEST(RotationTest, SlerpManyMatchesSlerp) {
+  const double progress[] = {-0.5, 0, 0.25, 0.5, 1, 1.5};
+  const std::pair<Rotation, Rotation> cases[] = {
+      {Rotation(gfx::Vector3dF(1, 0, 0), 30),
+       Rotation(gfx::Vector3dF(1, 0, 0), 60)},
+      {Rotation(gfx::Vector3dF(1, 0, 0), 90),
+       Rotation(gfx::Vector3dF(0, 1, 0), 90)},
+      {Rotation(gfx::Vector3dF(0, 0, 0), 0),
+       Rotation(gfx::Vector3dF(0, 1, 1), 120)},
+  };
+  for (const auto& [from, to] : cases) {
+    Rotation out[std::size(progress)];
+    Rotation::SlerpMany(from, to, progress, out);
+    for (size_t i = 0; i < std::size(progress); ++i) {
+      Rotation expected = Rotation::Slerp(from, to, progress[i]);
+      EXPECT_EQ(expected.axis, out[i].axis);
+      EXPECT_EQ(expected.angle, out[i].angle);
+    }
+  }
+}
+
 }  // namespace blink
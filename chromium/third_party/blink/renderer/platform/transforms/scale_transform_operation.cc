@@ -66,12 +66,45 @@ TransformOperation* ScaleTransformOperation::Blend(
     const TransformOperation* from,
     double progress,
     bool blend_to_identity) {
+  double x, y, z;
+  OperationType type;
+  BlendedParameters(from, progress, blend_to_identity, x, y, z, type);
+  return MakeGarbageCollected<ScaleTransformOperation>(x, y, z, type);
+}
+
+bool ScaleTransformOperation::BlendInto(const TransformOperation* from,
+                                        double progress,
+                                        bool blend_to_identity,
+                                        TransformOperation& result) {
+  double x, y, z;
+  OperationType type;
+  BlendedParameters(from, progress, blend_to_identity, x, y, z, type);
+  if (result.GetType() != type) {
+    return false;
+  }
+  auto& scale = To<ScaleTransformOperation>(result);
+  scale.x_ = x;
+  scale.y_ = y;
+  scale.z_ = z;
+  return true;
+}
+
+void ScaleTransformOperation::BlendedParameters(
+    const TransformOperation* from,
+    double progress,
+    bool blend_to_identity,
+    double& x,
+    double& y,
+    double& z,
+    OperationType& type) const {
   DCHECK(!from || CanBlendWith(*from));
 
   if (blend_to_identity) {
-    return MakeGarbageCollected<ScaleTransformOperation>(
-        blink::Blend(x_, 1.0, progress), blink::Blend(y_, 1.0, progress),
-        blink::Blend(z_, 1.0, progress), type_);
+    x = blink::Blend(x_, 1.0, progress);
+    y = blink::Blend(y_, 1.0, progress);
+    z = blink::Blend(z_, 1.0, progress);
+    type = type_;
+    return;
   }
 
   const ScaleTransformOperation* from_op =
@@ -80,13 +113,11 @@ TransformOperation* ScaleTransformOperation::Blend(
   double from_y = from_op ? from_op->y_ : 1.0;
   double from_z = from_op ? from_op->z_ : 1.0;
 
-  TransformOperation::OperationType type;
-
   CommonPrimitiveForInterpolation(from, type);
 
-  return MakeGarbageCollected<ScaleTransformOperation>(
-      blink::Blend(from_x, x_, progress), blink::Blend(from_y, y_, progress),
-      blink::Blend(from_z, z_, progress), type);
+  x = blink::Blend(from_x, x_, progress);
+  y = blink::Blend(from_y, y_, progress);
+  z = blink::Blend(from_z, z_, progress);
 }
 
 void ScaleTransformOperation::CommonPrimitiveForInterpolation(
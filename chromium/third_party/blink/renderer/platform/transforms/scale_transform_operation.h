@@ -34,7 +34,7 @@ class PLATFORM_EXPORT ScaleTransformOperation final
     : public TransformOperation {
  public:
   ScaleTransformOperation(double sx, double sy, double sz, OperationType type)
-      : x_(sx), y_(sy), z_(sz), type_(type) {
+      : TransformOperation(type), x_(sx), y_(sy), z_(sz), type_(type) {
     DCHECK(IsMatchingOperationType(type));
   }
   ScaleTransformOperation(double sx, double sy, OperationType type)
@@ -74,6 +74,19 @@ class PLATFORM_EXPORT ScaleTransformOperation final
       const TransformOperation* from,
       TransformOperation::OperationType& common_type) const;
 
+  bool BlendInto(const TransformOperation* from,
+                 double progress,
+                 bool blend_to_identity,
+                 TransformOperation& result) override;
+  // Computes the parameters of the result of Blend().
+  void BlendedParameters(const TransformOperation* from,
+                         double progress,
+                         bool blend_to_identity,
+                         double& x,
+                         double& y,
+                         double& z,
+                         OperationType& type) const;
+
   TransformOperation* Zoom(double factor) final { return this; }
 
   bool PreservesAxisAlignment() const final { return true; }
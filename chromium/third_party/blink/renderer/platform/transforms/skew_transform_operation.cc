@@ -37,21 +37,45 @@ TransformOperation* SkewTransformOperation::Blend(
     const TransformOperation* from,
     double progress,
     bool blend_to_identity) {
+  double angle_x, angle_y;
+  BlendedAngles(from, progress, blend_to_identity, angle_x, angle_y);
+  return MakeGarbageCollected<SkewTransformOperation>(angle_x, angle_y, type_);
+}
+
+bool SkewTransformOperation::BlendInto(const TransformOperation* from,
+                                       double progress,
+                                       bool blend_to_identity,
+                                       TransformOperation& result) {
+  if (result.GetType() != type_) {
+    return false;
+  }
+  double angle_x, angle_y;
+  BlendedAngles(from, progress, blend_to_identity, angle_x, angle_y);
+  auto& skew = To<SkewTransformOperation>(result);
+  skew.angle_x_ = angle_x;
+  skew.angle_y_ = angle_y;
+  return true;
+}
+
+void SkewTransformOperation::BlendedAngles(const TransformOperation* from,
+                                           double progress,
+                                           bool blend_to_identity,
+                                           double& angle_x,
+                                           double& angle_y) const {
   DCHECK(!from || CanBlendWith(*from));
 
   if (blend_to_identity) {
-    return MakeGarbageCollected<SkewTransformOperation>(
-        blink::Blend(angle_x_, 0.0, progress),
-        blink::Blend(angle_y_, 0.0, progress), type_);
+    angle_x = blink::Blend(angle_x_, 0.0, progress);
+    angle_y = blink::Blend(angle_y_, 0.0, progress);
+    return;
   }
 
   const SkewTransformOperation* from_op =
       static_cast<const SkewTransformOperation*>(from);
   double from_angle_x = from_op ? from_op->angle_x_ : 0;
   double from_angle_y = from_op ? from_op->angle_y_ : 0;
-  return MakeGarbageCollected<SkewTransformOperation>(
-      blink::Blend(from_angle_x, angle_x_, progress),
-      blink::Blend(from_angle_y, angle_y_, progress), type_);
+  angle_x = blink::Blend(from_angle_x, angle_x_, progress);
+  angle_y = blink::Blend(from_angle_y, angle_y_, progress);
 }
 
 }  // namespace blink
@@ -33,7 +33,10 @@ namespace blink {
 class PLATFORM_EXPORT SkewTransformOperation final : public TransformOperation {
  public:
   SkewTransformOperation(double angle_x, double angle_y, OperationType type)
-      : angle_x_(angle_x), angle_y_(angle_y), type_(type) {}
+      : TransformOperation(type),
+        angle_x_(angle_x),
+        angle_y_(angle_y),
+        type_(type) {}
 
   double AngleX() const { return angle_x_; }
   double AngleY() const { return angle_y_; }
@@ -60,8 +63,19 @@ class PLATFORM_EXPORT SkewTransformOperation final : public TransformOperation {
   TransformOperation* Blend(const TransformOperation* from,
                             double progress,
                             bool blend_to_identity = false) override;
+  bool BlendInto(const TransformOperation* from,
+                 double progress,
+                 bool blend_to_identity,
+                 TransformOperation& result) override;
   TransformOperation* Zoom(double factor) final { return this; }
 
+  // Computes the angles of the result of Blend().
+  void BlendedAngles(const TransformOperation* from,
+                     double progress,
+                     bool blend_to_identity,
+                     double& angle_x,
+                     double& angle_y) const;
+
   double angle_x_;
   double angle_y_;
   OperationType type_;
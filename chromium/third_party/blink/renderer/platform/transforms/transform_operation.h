@@ -25,6 +25,7 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_TRANSFORM_OPERATION_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_TRANSFORM_OPERATION_H_
 
+#include "third_party/blink/renderer/platform/geometry/geometry_allocation_stats.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
@@ -64,7 +65,6 @@ class PLATFORM_EXPORT TransformOperation
     kRotateAroundOrigin,
   };
 
-  TransformOperation() = default;
   TransformOperation(const TransformOperation&) = delete;
   TransformOperation& operator=(const TransformOperation&) = delete;
   virtual ~TransformOperation() = default;
@@ -134,7 +134,28 @@ class PLATFORM_EXPORT TransformOperation
   }
 
  protected:
+  // Counts the allocation of an operation of |type|, see
+  // GeometryAllocationStats.
+  explicit TransformOperation(OperationType type) {
+    GeometryAllocationStats::CountTransformOperation(type);
+  }
+
   virtual bool IsEqualAssumingSameType(const TransformOperation&) const = 0;
+
+ private:
+  friend class BlendedTransformOperations;
+
+  // Same as Blend(), but stores the result in |result| instead of allocating
+  // a new operation, if |result| has the type that Blend() would return.
+  // Otherwise returns false and leaves |result| unchanged. Operations are
+  // otherwise immutable, so this is only called by BlendedTransformOperations
+  // on operations that it allocated and that nothing else references.
+  virtual bool BlendInto(const TransformOperation* from,
+                         double progress,
+                         bool blend_to_identity,
+                         TransformOperation& result) {
+    return false;
+  }
 };
 
 }  // namespace blink
@@ -23,15 +23,22 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <memory>
+#include <optional>
 
 #include "base/containers/span.h"
+#include "base/notreached.h"
 #include "third_party/blink/renderer/platform/geometry/blend.h"
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 #include "third_party/blink/renderer/platform/transforms/interpolated_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/matrix_3d_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/matrix_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/rotate_transform_operation.h"
 #include "third_party/blink/renderer/platform/wtf/functional.h"
 #include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/transform_util.h"
 
 namespace blink {
 
@@ -75,6 +82,86 @@ TransformOperations ApplyFunctionToMatchingPrefix(
   return result;
 }
 
+// The names of the transform functions, for trace events.
+const char* OperationTypeName(TransformOperation::OperationType type) {
+  switch (type) {
+    case TransformOperation::kScaleX:
+      return "scaleX";
+    case TransformOperation::kScaleY:
+      return "scaleY";
+    case TransformOperation::kScale:
+      return "scale";
+    case TransformOperation::kTranslateX:
+      return "translateX";
+    case TransformOperation::kTranslateY:
+      return "translateY";
+    case TransformOperation::kTranslate:
+      return "translate";
+    case TransformOperation::kRotate:
+      return "rotate";
+    case TransformOperation::kRotateZ:
+      return "rotateZ";
+    case TransformOperation::kSkewX:
+      return "skewX";
+    case TransformOperation::kSkewY:
+      return "skewY";
+    case TransformOperation::kSkew:
+      return "skew";
+    case TransformOperation::kMatrix:
+      return "matrix";
+    case TransformOperation::kScaleZ:
+      return "scaleZ";
+    case TransformOperation::kScale3D:
+      return "scale3d";
+    case TransformOperation::kTranslateZ:
+      return "translateZ";
+    case TransformOperation::kTranslate3D:
+      return "translate3d";
+    case TransformOperation::kRotateX:
+      return "rotateX";
+    case TransformOperation::kRotateY:
+      return "rotateY";
+    case TransformOperation::kRotate3D:
+      return "rotate3d";
+    case TransformOperation::kMatrix3D:
+      return "matrix3d";
+    case TransformOperation::kPerspective:
+      return "perspective";
+    case TransformOperation::kInterpolated:
+      return "interpolated";
+    case TransformOperation::kRotateAroundOrigin:
+      return "rotate (around origin)";
+  }
+  NOTREACHED();
+}
+
+// Emits a trace event, and updates a counter, for an interpolation whose
+// transform functions don't match from |matching_prefix_length| on, naming the
+// first pair of them that doesn't. |reason| is "mismatched lists" if they're
+// interpolated as matrices, which is |deferred| until the box size is known if
+// they depend on it, and otherwise says why the interpolation is discrete.
+void TraceMatrixInterpolationFallback(const TransformOperations& from,
+                                      const TransformOperations& to,
+                                      wtf_size_t matching_prefix_length,
+                                      const char* reason,
+                                      bool deferred = false) {
+  static std::atomic<uint64_t> fallback_count{0};
+  const uint64_t count =
+      fallback_count.fetch_add(1, std::memory_order_relaxed) + 1;
+  auto type_name_at = [matching_prefix_length](const TransformOperations& ops) {
+    return matching_prefix_length < ops.size()
+               ? OperationTypeName(
+                     ops.Operations()[matching_prefix_length]->GetType())
+               : "none";
+  };
+  TRACE_EVENT_INSTANT("blink.animations",
+                      "TransformMatrixInterpolationFallback", "reason", reason,
+                      "from", type_name_at(from), "to", type_name_at(to),
+                      "deferred", deferred);
+  TRACE_COUNTER("blink.animations", "TransformMatrixInterpolationFallbacks",
+                count);
+}
+
 bool IsSingularMatrixOp(const TransformOperation& op) {
   if (op.GetType() == InterpolatedTransformOperation::OperationType::kMatrix) {
     return !To<MatrixTransformOperation>(op).Matrix().IsInvertible();
@@ -103,6 +190,106 @@ bool TransformOperations::operator==(const TransformOperations& o) const {
   return true;
 }
 
+bool TransformOperations::ApplyCache::IsValidFor(
+    const HeapVector<Member<TransformOperation>, 2>& list,
+    const gfx::SizeF& box_size) const {
+  if (operations.size() != list.size()) {
+    return false;
+  }
+  for (wtf_size_t i = 0; i < list.size(); ++i) {
+    if (operations[i] != list[i].Get()) {
+      return false;
+    }
+  }
+  if ((dependencies & TransformOperation::kDependsWidth) &&
+      border_box_size.width() != box_size.width()) {
+    return false;
+  }
+  if ((dependencies & TransformOperation::kDependsHeight) &&
+      border_box_size.height() != box_size.height()) {
+    return false;
+  }
+  return true;
+}
+
+void TransformOperations::Apply(const gfx::SizeF& border_box_size,
+                                gfx::Transform& t) const {
+  // A single operation is as cheap to apply as a memoized matrix.
+  if (operations_.size() < 2) {
+    ApplyRemaining(border_box_size, 0, t);
+    return;
+  }
+
+  const gfx::Transform& matrix = CachedMatrix(border_box_size);
+  if (t.IsIdentity()) {
+    t = matrix;
+  } else {
+    t.PreConcat(matrix);
+  }
+}
+
+void TransformOperations::ApplyWithOrigin(const gfx::SizeF& border_box_size,
+                                          const gfx::Point3F& origin,
+                                          gfx::Transform& t) const {
+  // The origin cancels out of translations.
+  if (IsIdentityOrTranslation()) {
+    Apply(border_box_size, t);
+    return;
+  }
+
+  // The origin translations and a single operation are applied in place,
+  // without a general multiply.
+  if (operations_.size() < 2) {
+    t.Translate3d(origin.x(), origin.y(), origin.z());
+    ApplyRemaining(border_box_size, 0, t);
+    t.Translate3d(-origin.x(), -origin.y(), -origin.z());
+    return;
+  }
+
+  gfx::Transform matrix = CachedMatrix(border_box_size);
+  matrix.ApplyTransformOrigin(origin.x(), origin.y(), origin.z());
+  if (t.IsIdentity()) {
+    t = matrix;
+  } else {
+    t.PreConcat(matrix);
+  }
+}
+
+const gfx::Transform& TransformOperations::CachedMatrix(
+    const gfx::SizeF& border_box_size) const {
+  DCHECK_GE(operations_.size(), 2u);
+  if (!apply_cache_ ||
+      !apply_cache_->IsValidFor(operations_, border_box_size)) {
+    if (!apply_cache_) {
+      apply_cache_ = std::make_unique<ApplyCache>();
+    }
+    apply_cache_->matrix = gfx::Transform();
+    ApplyRemaining(border_box_size, 0, apply_cache_->matrix);
+    apply_cache_->border_box_size = border_box_size;
+    apply_cache_->dependencies = BoxSizeDependencies();
+    apply_cache_->operations.clear();
+    for (const auto& operation : operations_) {
+      apply_cache_->operations.push_back(operation.Get());
+    }
+  }
+#if DCHECK_IS_ON()
+  {
+    // The cached operations can't change, see BlendedTransformOperations, so
+    // the product must be the same. It's compared bitwise, so that a product
+    // with NaN is the same as itself.
+    std::array<double, 16> matrix;
+    std::array<double, 16> cached_matrix;
+    gfx::Transform transform;
+    ApplyRemaining(border_box_size, 0, transform);
+    transform.GetColMajor(matrix);
+    apply_cache_->matrix.GetColMajor(cached_matrix);
+    DCHECK(std::ranges::equal(base::as_byte_span(matrix),
+                              base::as_byte_span(cached_matrix)));
+  }
+#endif
+  return apply_cache_->matrix;
+}
+
 void TransformOperations::ApplyRemaining(const gfx::SizeF& border_box_size,
                                          wtf_size_t start,
                                          gfx::Transform& t) const {
@@ -149,8 +336,12 @@ TransformOperations::BlendRemainingByUsingMatrixInterpolation(
   if (BoxSizeDependencies(matching_prefix_length) ||
       from.BoxSizeDependencies(matching_prefix_length)) {
     if (box_size_dependent == BoxSizeDependentMatrixBlending::kDisallow) {
+      TraceMatrixInterpolationFallback(from, *this, matching_prefix_length,
+                                       "box size dependent");
       return nullptr;
     }
+    TraceMatrixInterpolationFallback(from, *this, matching_prefix_length,
+                                     "mismatched lists", /*deferred=*/true);
     return MakeGarbageCollected<InterpolatedTransformOperation>(
         from, *this, matching_prefix_length, progress);
   }
@@ -164,11 +355,23 @@ TransformOperations::BlendRemainingByUsingMatrixInterpolation(
 
   // Fallback to discrete interpolation if either transform matrix is singular.
   if (!(from_transform.IsInvertible() && to_transform.IsInvertible())) {
+    TraceMatrixInterpolationFallback(from, *this, matching_prefix_length,
+                                     "singular");
     return nullptr;
   }
 
-  if (!to_transform.Blend(from_transform, progress) && progress < 0.5)
-    to_transform = from_transform;
+  if (!to_transform.Blend(from_transform, progress)) {
+    // Invertible matrices fail to decompose only because of their
+    // perspective, e.g. with w = 0 at the origin.
+    TraceMatrixInterpolationFallback(from, *this, matching_prefix_length,
+                                     "perspective");
+    if (progress < 0.5) {
+      to_transform = from_transform;
+    }
+  } else {
+    TraceMatrixInterpolationFallback(from, *this, matching_prefix_length,
+                                     "mismatched lists");
+  }
 
   return MakeGarbageCollected<Matrix3DTransformOperation>(to_transform);
 }
@@ -213,6 +416,93 @@ TransformOperations TransformOperations::Blend(
   return result;
 }
 
+void BlendedTransformOperations::Blend(
+    const TransformOperations& from,
+    const TransformOperations& to,
+    double progress,
+    BoxSizeDependentMatrixBlending box_size_dependent) {
+  if (from == to || (!from.size() && !to.size())) {
+    SetShared(to);
+    return;
+  }
+
+  wtf_size_t matching_prefix_length = to.MatchingPrefixLength(from);
+  wtf_size_t from_size = from.size();
+  wtf_size_t to_size = to.size();
+  wtf_size_t max_path_length = std::max(from_size, to_size);
+
+  // Also resets the memoized matrix of Apply().
+  HeapVector<Member<TransformOperation>, 2>& operations = result_.Operations();
+  DCHECK_EQ(owned_.size(), operations.size());
+  bool success = true;
+  for (wtf_size_t i = 0; i < matching_prefix_length; i++) {
+    TransformOperation* from_operation =
+        (i < from_size) ? from.Operations()[i].Get() : nullptr;
+    TransformOperation* to_operation =
+        (i < to_size) ? to.Operations()[i].Get() : nullptr;
+
+    // Where the lists matched but one was longer, the shorter list is padded
+    // with nullptr that represent matching identity operations.
+    if (i < operations.size() && owned_[i]) {
+      TransformOperation& existing = *operations[i];
+      if (to_operation
+              ? to_operation->BlendInto(from_operation, progress, false,
+                                        existing)
+              : from_operation->BlendInto(nullptr, progress, true, existing)) {
+        continue;
+      }
+    }
+
+    TransformOperation* result_operation =
+        to_operation ? to_operation->Blend(from_operation, progress)
+                     : from_operation->Blend(nullptr, progress, true);
+    if (!result_operation) {
+      success = false;
+      break;
+    }
+    // Blend() may return one of the inputs.
+    const bool owned =
+        result_operation != from_operation && result_operation != to_operation;
+    if (i < operations.size()) {
+      operations[i] = result_operation;
+      owned_[i] = owned;
+    } else {
+      operations.push_back(result_operation);
+      owned_.push_back(owned);
+    }
+  }
+
+  if (success) {
+    operations.Shrink(matching_prefix_length);
+    owned_.Shrink(matching_prefix_length);
+    if (matching_prefix_length < max_path_length) {
+      TransformOperation* matrix_op =
+          to.BlendRemainingByUsingMatrixInterpolation(
+              from, matching_prefix_length, progress, box_size_dependent);
+      if (matrix_op) {
+        operations.push_back(matrix_op);
+        owned_.push_back(false);
+      } else {
+        success = false;
+      }
+    }
+  }
+  if (!success) {
+    SetShared(progress < 0.5 ? from : to);
+  }
+}
+
+TransformOperations BlendedTransformOperations::Result() {
+  owned_.Fill(false);
+  return result_;
+}
+
+void BlendedTransformOperations::SetShared(
+    const TransformOperations& operations) {
+  result_ = operations;
+  owned_.Fill(false, operations.size());
+}
+
 TransformOperations TransformOperations::Accumulate(
     const TransformOperations& to) const {
   if (!to.size() && !size())
@@ -278,6 +568,27 @@ static void FindCandidatesInPlane(double px,
   }
 }
 
+// Computes the range of angles, in degrees, about the axis of |from_transform|
+// that results from blending |from_transform| and |to_transform| with
+// progress in [min_progress, max_progress].
+static void BlendedArcDegrees(const RotateTransformOperation& from_transform,
+                              const RotateTransformOperation& to_transform,
+                              double min_progress,
+                              double max_progress,
+                              double& from_degrees,
+                              double& to_degrees) {
+  from_degrees = from_transform.Angle();
+  to_degrees = to_transform.Angle();
+
+  if (gfx::DotProduct(from_transform.Axis(), to_transform.Axis()) < 0)
+    to_degrees *= -1;
+
+  from_degrees = Blend(from_degrees, to_degrees, min_progress);
+  to_degrees = Blend(to_degrees, from_transform.Angle(), 1.0 - max_progress);
+  if (from_degrees > to_degrees)
+    std::swap(from_degrees, to_degrees);
+}
+
 // This method returns the bounding box that contains the starting point,
 // the ending point, and any of the extrema (in each dimension) found across
 // the circle described by the arc. These are then filtered to points that
@@ -289,16 +600,10 @@ static void BoundingBoxForArc(const gfx::Point3F& point,
                               double max_progress,
                               gfx::BoxF& box) {
   gfx::Vector3dF axis = from_transform.Axis();
-  double from_degrees = from_transform.Angle();
-  double to_degrees = to_transform.Angle();
-
-  if (gfx::DotProduct(axis, to_transform.Axis()) < 0)
-    to_degrees *= -1;
-
-  from_degrees = Blend(from_degrees, to_degrees, min_progress);
-  to_degrees = Blend(to_degrees, from_transform.Angle(), 1.0 - max_progress);
-  if (from_degrees > to_degrees)
-    std::swap(from_degrees, to_degrees);
+  double from_degrees;
+  double to_degrees;
+  BlendedArcDegrees(from_transform, to_transform, min_progress, max_progress,
+                    from_degrees, to_degrees);
 
   gfx::Transform from_matrix;
   gfx::Transform to_matrix;
@@ -432,7 +737,8 @@ bool TransformOperations::BlendedBoundsForBox(const gfx::BoxF& box,
                                               const TransformOperations& from,
                                               const double& min_progress,
                                               const double& max_progress,
-                                              gfx::BoxF* bounds) const {
+                                              gfx::BoxF* bounds,
+                                              double tolerance) const {
   int from_size = from.Operations().size();
   int to_size = Operations().size();
   int size = std::max(from_size, to_size);
@@ -539,6 +845,20 @@ bool TransformOperations::BlendedBoundsForBox(const gfx::BoxF& box,
           to_rotation = identity_rotation;
         }
 
+        if (tolerance > 0) {
+          double from_degrees;
+          double to_degrees;
+          BlendedArcDegrees(*from_rotation, *to_rotation, min_progress,
+                            max_progress, from_degrees, to_degrees);
+          if (std::optional<gfx::BoxF> conservative_bounds =
+                  gfx::ConservativeBoundsForRotatedBox(
+                      *bounds, from_rotation->Axis(), from_degrees,
+                      to_degrees, tolerance)) {
+            *bounds = *conservative_bounds;
+            continue;
+          }
+        }
+
         gfx::BoxF from_box = *bounds;
         bool first = true;
         for (size_t j = 0; j < 2; ++j) {
@@ -583,6 +903,9 @@ TransformOperations TransformOperations::Add(
 
 TransformOperations TransformOperations::Zoom(double factor) const {
   TransformOperations result;
+  // The operations that don't depend on the zoom return themselves, and the
+  // lengths of translations are zoomed lazily, see CalculationValue::Zoom().
+  result.operations_.reserve(operations_.size());
   for (auto& transform_operation : operations_)
     result.operations_.push_back(transform_operation->Zoom(factor));
   return result;
@@ -25,15 +25,20 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_TRANSFORM_OPERATIONS_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_TRANSFORMS_TRANSFORM_OPERATIONS_H_
 
+#include <memory>
+
 #include "third_party/blink/renderer/platform/heap/collection_support/heap_vector.h"
 #include "third_party/blink/renderer/platform/heap/member.h"
 #include "third_party/blink/renderer/platform/transforms/transform_operation.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 #include "ui/gfx/geometry/size_f.h"
+#include "ui/gfx/geometry/transform.h"
 
 namespace gfx {
 class BoxF;
+class Point3F;
 }
 
 namespace blink {
@@ -48,6 +53,15 @@ class PLATFORM_EXPORT TransformOperations {
  public:
   TransformOperations() = default;
   TransformOperations(const EmptyTransformOperations&) {}
+  TransformOperations(const TransformOperations& other)
+      : operations_(other.operations_) {}
+  TransformOperations(TransformOperations&&) = default;
+  TransformOperations& operator=(const TransformOperations& other) {
+    operations_ = other.operations_;
+    apply_cache_.reset();
+    return *this;
+  }
+  TransformOperations& operator=(TransformOperations&&) = default;
 
   void Trace(Visitor* visitor) const { visitor->Trace(operations_); }
 
@@ -55,10 +69,21 @@ class PLATFORM_EXPORT TransformOperations {
 
   // Constructs a transformation matrix from the operations. The parameter
   // |border_box_size| is used when computing styles that are size-dependent.
-  void Apply(const gfx::SizeF& border_box_size, gfx::Transform& t) const {
-    for (auto& operation : operations_)
-      operation->Apply(t, border_box_size);
-  }
+  //
+  // The product of the operations is memoized, and recomputed only when the
+  // operations change or a box dimension they depend on changes. If |t| is not
+  // the identity, the result may differ from applying the operations to |t|
+  // one by one by floating point rounding.
+  void Apply(const gfx::SizeF& border_box_size, gfx::Transform& t) const;
+
+  // Applies the operations about |origin|, as CSS transform-origin does. The
+  // result is that of t.Translate3d(origin), Apply() and
+  // t.Translate3d(-origin), up to floating point rounding, but the origin is
+  // folded into the memoized product of the operations, so |t| is multiplied
+  // at most once. The origin isn't applied at all for translations.
+  void ApplyWithOrigin(const gfx::SizeF& border_box_size,
+                       const gfx::Point3F& origin,
+                       gfx::Transform& t) const;
 
   // Constructs a transformation matrix from the operations starting from index
   // |start|. This process facilitates mixing pairwise operations for a common
@@ -127,9 +152,15 @@ class PLATFORM_EXPORT TransformOperations {
 
   wtf_size_t MatchingPrefixLength(const TransformOperations&) const;
 
-  void clear() { operations_.clear(); }
+  void clear() {
+    operations_.clear();
+    apply_cache_.reset();
+  }
 
+  // The returned vector must not be modified after calling Apply() without
+  // calling this again.
   HeapVector<Member<TransformOperation>, 2>& Operations() {
+    apply_cache_.reset();
     return operations_;
   }
   const HeapVector<Member<TransformOperation>, 2>& Operations() const {
@@ -141,11 +172,16 @@ class PLATFORM_EXPORT TransformOperations {
     return index < operations_.size() ? operations_.at(index).Get() : nullptr;
   }
 
+  // If |tolerance| is positive, the bounds of rotations may be computed by
+  // sampling the rotated corners instead of finding the exact extrema of their
+  // arcs. That is cheaper, and the bounds of each rotation still contain the
+  // exact ones and exceed them by at most |tolerance| on each side.
   bool BlendedBoundsForBox(const gfx::BoxF&,
                            const TransformOperations& from,
                            const double& min_progress,
                            const double& max_progress,
-                           gfx::BoxF* bounds) const;
+                           gfx::BoxF* bounds,
+                           double tolerance = 0) const;
 
   // Registered custom property interpolations cannot currently represent
   // interpolated values if functions need to be combined into a matrix and
@@ -203,7 +239,88 @@ class PLATFORM_EXPORT TransformOperations {
   }
 
  private:
+  // The result of Apply() on the identity transform, valid while the list
+  // still has the same |operations| and the dimensions of |border_box_size|
+  // that are in |dependencies| don't change. Every mutating accessor resets
+  // it, and |operations| also catches operations replaced through a
+  // reference to Operations() that was kept across Apply(). They're only
+  // compared, and kept alive by the list while the cache is valid.
+  struct ApplyCache {
+    bool IsValidFor(const HeapVector<Member<TransformOperation>, 2>& list,
+                    const gfx::SizeF& box_size) const;
+
+    gfx::Transform matrix;
+    gfx::SizeF border_box_size;
+    TransformOperation::BoxSizeDependency dependencies;
+    Vector<UntracedMember<const TransformOperation>, 2> operations;
+  };
+
+  // Returns the product of the operations for |border_box_size|, updating
+  // |apply_cache_| if needed. There must be more than one operation.
+  const gfx::Transform& CachedMatrix(const gfx::SizeF& border_box_size) const;
+
   HeapVector<Member<TransformOperation>, 2> operations_;
+  // Only allocated for lists of more than one operation. Not copied.
+  mutable std::unique_ptr<ApplyCache> apply_cache_;
+};
+
+// A caller-owned result of TransformOperations::Blend() that is blended again
+// and again, e.g. for every frame of an animation. Blend() updates the
+// operations of the last result in place where the blended ones have the same
+// type, so that it only allocates when the types change. Rotations and the
+// operations that aren't blended pairwise are still allocated.
+//
+// The operations are owned exclusively: the methods below don't hand them
+// out, except Result(), which shares them with the returned copy so that the
+// next Blend() allocates new operations instead (copy-on-write). Operations
+// that Blend() takes from |from| or |to| are never updated in place either.
+class PLATFORM_EXPORT BlendedTransformOperations {
+  DISALLOW_NEW();
+
+ public:
+  BlendedTransformOperations() = default;
+  BlendedTransformOperations(const BlendedTransformOperations&) = delete;
+  BlendedTransformOperations& operator=(const BlendedTransformOperations&) =
+      delete;
+
+  using BoxSizeDependentMatrixBlending =
+      TransformOperations::BoxSizeDependentMatrixBlending;
+
+  void Trace(Visitor* visitor) const { visitor->Trace(result_); }
+
+  // Sets the result to to.Blend(from, progress, box_size_dependent).
+  void Blend(const TransformOperations& from,
+             const TransformOperations& to,
+             double progress,
+             BoxSizeDependentMatrixBlending box_size_dependent =
+                 BoxSizeDependentMatrixBlending::kAllow);
+
+  // The same as for the result.
+  void Apply(const gfx::SizeF& border_box_size, gfx::Transform& t) const {
+    result_.Apply(border_box_size, t);
+  }
+  void ApplyWithOrigin(const gfx::SizeF& border_box_size,
+                       const gfx::Point3F& origin,
+                       gfx::Transform& t) const {
+    result_.ApplyWithOrigin(border_box_size, origin, t);
+  }
+  TransformOperation::BoxSizeDependency BoxSizeDependencies() const {
+    return result_.BoxSizeDependencies();
+  }
+  wtf_size_t size() const { return result_.size(); }
+  bool operator==(const TransformOperations& o) const { return result_ == o; }
+
+  // Returns a copy of the result, which keeps its operations from then on.
+  TransformOperations Result();
+
+ private:
+  // Sets the result to |operations|, which aren't owned.
+  void SetShared(const TransformOperations& operations);
+
+  TransformOperations result_;
+  // Whether each operation of |result_| was allocated by Blend() and nothing
+  // else references it, so that it can be updated in place.
+  Vector<bool> owned_;
 };
 
 }  // namespace blink
@@ -25,9 +25,13 @@
 #include "third_party/blink/renderer/platform/transforms/transform_operations.h"
 
 #include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 #include "base/compiler_specific.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/geometry/geometry_allocation_stats.h"
 #include "third_party/blink/renderer/platform/transforms/interpolated_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/matrix_3d_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/matrix_transform_operation.h"
@@ -37,6 +41,7 @@
 #include "third_party/blink/renderer/platform/transforms/skew_transform_operation.h"
 #include "third_party/blink/renderer/platform/transforms/translate_transform_operation.h"
 #include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/point3_f.h"
 #include "ui/gfx/geometry/test/geometry_util.h"
 
 namespace blink {
@@ -406,6 +411,57 @@ TEST(TransformOperationsTest, BlendedBoundsForRotationEmpiricalTests) {
   }
 }
 
+TEST(TransformOperationsTest, BlendedBoundsForRotationWithTolerance) {
+  auto axes = std::to_array<std::array<float, 3>>({
+      {0, 0, 1},
+      {1, 1, 1},
+      {-1, 2, 3},
+  });
+  auto angles = std::to_array<std::array<float, 2>>({
+      {5, 100},
+      {20, 380},
+      {-3200, 120},
+  });
+  gfx::BoxF box(1, 2, 3, 10, 20, 5);
+  // Allows for float rounding of the exact bounds.
+  const float kEpsilon = 1e-4f;
+
+  for (const auto& axis : axes) {
+    for (const auto& angle : angles) {
+      TransformOperations from_ops;
+      TransformOperations to_ops;
+      from_ops.Operations().push_back(
+          MakeGarbageCollected<RotateTransformOperation>(
+              axis[0], axis[1], axis[2], angle[0],
+              TransformOperation::kRotate3D));
+      to_ops.Operations().push_back(
+          MakeGarbageCollected<RotateTransformOperation>(
+              axis[0], axis[1], axis[2], angle[1],
+              TransformOperation::kRotate3D));
+      gfx::BoxF exact;
+      ASSERT_TRUE(
+          to_ops.BlendedBoundsForBox(box, from_ops, -0.25, 1.25, &exact));
+      for (double tolerance : {0.5, 5.0, 100.0}) {
+        gfx::BoxF bounds;
+        ASSERT_TRUE(to_ops.BlendedBoundsForBox(box, from_ops, -0.25, 1.25,
+                                               &bounds, tolerance));
+        EXPECT_LE(bounds.x(), exact.x() + kEpsilon);
+        EXPECT_LE(bounds.y(), exact.y() + kEpsilon);
+        EXPECT_LE(bounds.z(), exact.z() + kEpsilon);
+        EXPECT_GE(bounds.right(), exact.right() - kEpsilon);
+        EXPECT_GE(bounds.bottom(), exact.bottom() - kEpsilon);
+        EXPECT_GE(bounds.front(), exact.front() - kEpsilon);
+        EXPECT_GE(bounds.x(), exact.x() - tolerance - kEpsilon);
+        EXPECT_GE(bounds.y(), exact.y() - tolerance - kEpsilon);
+        EXPECT_GE(bounds.z(), exact.z() - tolerance - kEpsilon);
+        EXPECT_LE(bounds.right(), exact.right() + tolerance + kEpsilon);
+        EXPECT_LE(bounds.bottom(), exact.bottom() + tolerance + kEpsilon);
+        EXPECT_LE(bounds.front(), exact.front() + tolerance + kEpsilon);
+      }
+    }
+  }
+}
+
 TEST(TransformOperationsTest, AbsoluteAnimatedPerspectiveBoundsTest) {
   TransformOperations from_ops;
   TransformOperations to_ops;
@@ -741,6 +797,42 @@ TEST(TransformOperationsTest, InterpolatedTransformBlendIdentityTest) {
   EXPECT_TRANSFORM_EQ(mat_d2, mat_d3);
 }
 
+TEST(TransformOperationsTest, NestedInterpolatedTransformApplyTest) {
+  // Retargeting a transition between mismatched lists nests deferred
+  // interpolations. Applying the chain for a box size must match blending the
+  // matrices of each level, including after the box size changes.
+  TransformOperations ops_a, ops_b, ops_c;
+  ops_a.Operations().push_back(
+      MakeGarbageCollected<TranslateTransformOperation>(
+          Length::Percent(100), Length::Fixed(0),
+          TransformOperation::kTranslate));
+  ops_b.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      90, TransformOperation::kRotate));
+  ops_c.Operations().push_back(MakeGarbageCollected<ScaleTransformOperation>(
+      2, 3, TransformOperation::kScale));
+
+  TransformOperations inner = ops_b.Blend(ops_a, 0.5);
+  TransformOperations outer = ops_c.Blend(inner, 0.25);
+  ASSERT_EQ(outer.Operations().size(), 1u);
+  ASSERT_TRUE(IsA<InterpolatedTransformOperation>(*outer.Operations()[0]));
+  EXPECT_EQ(outer.BoxSizeDependencies(), TransformOperation::kDependsWidth);
+
+  for (const gfx::SizeF& size :
+       {gfx::SizeF(100, 100), gfx::SizeF(100, 200), gfx::SizeF(200, 100),
+        gfx::SizeF(100, 100)}) {
+    gfx::Transform from, to, expected;
+    ops_a.Apply(size, from);
+    ops_b.Apply(size, to);
+    ASSERT_TRUE(to.Blend(from, 0.5));
+    ops_c.Apply(size, expected);
+    ASSERT_TRUE(expected.Blend(to, 0.25));
+
+    gfx::Transform transform;
+    outer.Apply(size, transform);
+    EXPECT_TRANSFORM_NEAR(expected, transform, 1e-6);
+  }
+}
+
 TEST(TransformOperationsTest, BlendPercentPrefixTest) {
   TransformOperations ops_a, ops_b;
   ops_a.Operations().push_back(
@@ -782,6 +874,192 @@ TEST(TransformOperationsTest, BlendPercentPrefixTest) {
   EXPECT_TRANSFORM_NEAR(mat_c, matrix_ref, 1e-15);
 }
 
+TEST(TransformOperationsTest, ApplyIsMemoizedPerBoxSize) {
+  TransformOperations ops;
+  ops.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      90, TransformOperation::kRotate));
+  ops.Operations().push_back(MakeGarbageCollected<TranslateTransformOperation>(
+      Length::Fixed(10), Length::Percent(50), TransformOperation::kTranslate));
+
+  auto apply_one_by_one = [&ops](const gfx::SizeF& size) {
+    gfx::Transform transform;
+    for (const auto& operation : std::as_const(ops).Operations()) {
+      operation->Apply(transform, size);
+    }
+    return transform;
+  };
+
+  // The width doesn't matter, but the height does.
+  for (const gfx::SizeF& size :
+       {gfx::SizeF(100, 200), gfx::SizeF(300, 200), gfx::SizeF(100, 400),
+        gfx::SizeF(100, 200)}) {
+    gfx::Transform transform;
+    ops.Apply(size, transform);
+    EXPECT_EQ(apply_one_by_one(size), transform);
+  }
+
+  // Modifying the operations invalidates the memoized matrix.
+  ops.Operations().push_back(MakeGarbageCollected<ScaleTransformOperation>(
+      2, 3, TransformOperation::kScale));
+  gfx::Transform transform;
+  ops.Apply(gfx::SizeF(100, 200), transform);
+  EXPECT_EQ(apply_one_by_one(gfx::SizeF(100, 200)), transform);
+
+  // So does replacing an operation through a reference to the operations
+  // that was kept across Apply().
+  HeapVector<Member<TransformOperation>, 2>& operations = ops.Operations();
+  ops.Apply(gfx::SizeF(100, 200), transform);
+  operations[2] = MakeGarbageCollected<ScaleTransformOperation>(
+      4, 5, TransformOperation::kScale);
+  transform = gfx::Transform();
+  ops.Apply(gfx::SizeF(100, 200), transform);
+  EXPECT_EQ(apply_one_by_one(gfx::SizeF(100, 200)), transform);
+
+  // A product with NaN is memoized too.
+  TransformOperations nan_ops;
+  nan_ops.Operations().push_back(MakeGarbageCollected<ScaleTransformOperation>(
+      std::numeric_limits<double>::quiet_NaN(), 1, TransformOperation::kScale));
+  nan_ops.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      90, TransformOperation::kRotate));
+  for (int i = 0; i < 2; ++i) {
+    gfx::Transform nan_transform;
+    nan_ops.Apply(gfx::SizeF(100, 200), nan_transform);
+    EXPECT_TRUE(std::isnan(nan_transform.rc(0, 0)));
+  }
+
+  // The memoized matrix applies to a non-identity transform.
+  transform = gfx::Transform::MakeTranslation(5, 6);
+  ops.Apply(gfx::SizeF(100, 200), transform);
+  EXPECT_TRANSFORM_NEAR(gfx::Transform::MakeTranslation(5, 6) *
+                            apply_one_by_one(gfx::SizeF(100, 200)),
+                        transform, 1e-6);
+}
+
+TEST(TransformOperationsTest, ApplyWithOrigin) {
+  const gfx::SizeF size(100, 200);
+  const gfx::Point3F origin(50, 100, 5);
+  auto apply_about_origin = [&](const TransformOperations& ops,
+                                gfx::Transform transform) {
+    transform.Translate3d(origin.x(), origin.y(), origin.z());
+    for (const auto& operation : ops.Operations()) {
+      operation->Apply(transform, size);
+    }
+    transform.Translate3d(-origin.x(), -origin.y(), -origin.z());
+    return transform;
+  };
+
+  const std::array<TransformOperation*, 3> operations = {
+      MakeGarbageCollected<TranslateTransformOperation>(
+          Length::Fixed(10), Length::Percent(50),
+          TransformOperation::kTranslate),
+      MakeGarbageCollected<RotateTransformOperation>(
+          30, TransformOperation::kRotate),
+      MakeGarbageCollected<ScaleTransformOperation>(
+          2, 3, TransformOperation::kScale)};
+  // One, two and three operations.
+  TransformOperations ops;
+  for (TransformOperation* operation : operations) {
+    ops.Operations().push_back(operation);
+    for (const gfx::Transform& initial :
+         {gfx::Transform(), gfx::Transform::MakeTranslation(5, 6),
+          gfx::Transform::MakeScale(0.5f)}) {
+      gfx::Transform transform = initial;
+      ops.ApplyWithOrigin(size, origin, transform);
+      EXPECT_TRANSFORM_NEAR(apply_about_origin(ops, initial), transform,
+                            1e-6);
+    }
+  }
+
+  // The origin cancels out of translations and of no operations.
+  gfx::Transform transform;
+  TransformOperations().ApplyWithOrigin(size, origin, transform);
+  EXPECT_TRUE(transform.IsIdentity());
+  ops.Operations().resize(1);
+  ops.ApplyWithOrigin(size, origin, transform);
+  EXPECT_EQ(gfx::Transform::MakeTranslation(10, 100), transform);
+}
+
+TEST(TransformOperationsTest, BlendedTransformOperations) {
+  TransformOperations from;
+  from.Operations().push_back(MakeGarbageCollected<TranslateTransformOperation>(
+      Length::Fixed(0), Length::Percent(10), TransformOperation::kTranslate));
+  from.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      10, TransformOperation::kRotate));
+  from.Operations().push_back(MakeGarbageCollected<ScaleTransformOperation>(
+      1, 2, TransformOperation::kScale));
+  from.Operations().push_back(MakeGarbageCollected<SkewTransformOperation>(
+      5, 0, TransformOperation::kSkewX));
+
+  TransformOperations to;
+  to.Operations().push_back(MakeGarbageCollected<TranslateTransformOperation>(
+      Length::Fixed(20), Length::Percent(30), TransformOperation::kTranslate));
+  to.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
+      0, 1, 1, 50, TransformOperation::kRotate3D));
+  to.Operations().push_back(MakeGarbageCollected<ScaleTransformOperation>(
+      3, 4, TransformOperation::kScale));
+
+  // Returns the number of operations that |blended|.Blend() allocates.
+  auto blend = [](BlendedTransformOperations& blended,
+                  const TransformOperations& from,
+                  const TransformOperations& to, double progress) {
+    const GeometryAllocationStats::Snapshot before =
+        GeometryAllocationStats::GetSnapshot();
+    blended.Blend(from, to, progress);
+    return (GeometryAllocationStats::GetSnapshot() - before)
+        .TotalTransformOperations();
+  };
+
+  BlendedTransformOperations blended;
+  EXPECT_EQ(4u, blend(blended, from, to, 0.25));
+  EXPECT_EQ(to.Blend(from, 0.25), blended.Result());
+
+  // The result was handed out, so blending again allocates new operations,
+  // and doesn't change the copy.
+  const TransformOperations copy = blended.Result();
+  EXPECT_EQ(4u, blend(blended, from, to, 0.5));
+  EXPECT_EQ(to.Blend(from, 0.25), copy);
+
+  // Then only the rotation, which is immutable, is allocated again.
+  const gfx::SizeF box_size(100, 200);
+  for (double progress : {0.75, -1.0, 2.0}) {
+    EXPECT_EQ(1u, blend(blended, from, to, progress));
+    const TransformOperations expected = to.Blend(from, progress);
+    EXPECT_EQ(expected, blended);
+    gfx::Transform expected_matrix;
+    expected.Apply(box_size, expected_matrix);
+    gfx::Transform matrix;
+    blended.Apply(box_size, matrix);
+    EXPECT_EQ(expected_matrix, matrix);
+  }
+
+  // Operations whose blended type changes are reallocated.
+  TransformOperations other_to;
+  other_to.Operations().push_back(
+      MakeGarbageCollected<TranslateTransformOperation>(
+          Length::Fixed(20), Length::Fixed(0), 5,
+          TransformOperation::kTranslate3D));
+  other_to.Operations().push_back(
+      MakeGarbageCollected<RotateTransformOperation>(
+          20, TransformOperation::kRotate));
+  blended.Blend(from, other_to, 0.5);
+  EXPECT_EQ(other_to.Blend(from, 0.5), blended);
+
+  // Lists that can't be blended fall back to discrete interpolation, and
+  // share the operations of the inputs.
+  TransformOperations singular;
+  singular.Operations().push_back(MakeGarbageCollected<ScaleTransformOperation>(
+      0, 0, TransformOperation::kScale));
+  singular.Operations().push_back(
+      MakeGarbageCollected<RotateTransformOperation>(
+          20, TransformOperation::kRotate));
+  blended.Blend(singular, other_to, 0.25);
+  EXPECT_EQ(singular, blended);
+  blended.Blend(singular, other_to, 0.75);
+  EXPECT_EQ(other_to, blended);
+  blended.Blend(from, to, 0.5);
+  EXPECT_EQ(to.Blend(from, 0.5), blended);
+}
+
 TEST(TransformOperationsTest, SizeDependenciesCombineTest) {
   TransformOperations ops;
   ops.Operations().push_back(MakeGarbageCollected<RotateTransformOperation>(
@@ -75,28 +75,60 @@ TransformOperation* TranslateTransformOperation::Blend(
     const TransformOperation* from,
     double progress,
     bool blend_to_identity) {
+  Length x, y;
+  double z;
+  OperationType type;
+  BlendedParameters(from, progress, blend_to_identity, x, y, z, type);
+  return MakeGarbageCollected<TranslateTransformOperation>(x, y, z, type);
+}
+
+bool TranslateTransformOperation::BlendInto(const TransformOperation* from,
+                                            double progress,
+                                            bool blend_to_identity,
+                                            TransformOperation& result) {
+  Length x, y;
+  double z;
+  OperationType type;
+  BlendedParameters(from, progress, blend_to_identity, x, y, z, type);
+  if (result.GetType() != type) {
+    return false;
+  }
+  auto& translate = To<TranslateTransformOperation>(result);
+  translate.x_ = x;
+  translate.y_ = y;
+  translate.z_ = z;
+  return true;
+}
+
+void TranslateTransformOperation::BlendedParameters(
+    const TransformOperation* from,
+    double progress,
+    bool blend_to_identity,
+    Length& x,
+    Length& y,
+    double& z,
+    OperationType& type) const {
   DCHECK(!from || CanBlendWith(*from));
 
   const Length zero_length = Length::Fixed(0);
   if (blend_to_identity) {
-    return MakeGarbageCollected<TranslateTransformOperation>(
-        zero_length.Blend(x_, progress, Length::ValueRange::kAll),
-        zero_length.Blend(y_, progress, Length::ValueRange::kAll),
-        blink::Blend(z_, 0., progress), type_);
+    x = zero_length.Blend(x_, progress, Length::ValueRange::kAll);
+    y = zero_length.Blend(y_, progress, Length::ValueRange::kAll);
+    z = blink::Blend(z_, 0., progress);
+    type = type_;
+    return;
   }
 
   const auto* from_op = To<TranslateTransformOperation>(from);
   const Length& from_x = from_op ? from_op->x_ : zero_length;
   const Length& from_y = from_op ? from_op->y_ : zero_length;
   double from_z = from_op ? from_op->z_ : 0;
-  OperationType type;
 
   CommonPrimitiveForInterpolation(from, type);
 
-  return MakeGarbageCollected<TranslateTransformOperation>(
-      x_.Blend(from_x, progress, Length::ValueRange::kAll),
-      y_.Blend(from_y, progress, Length::ValueRange::kAll),
-      blink::Blend(from_z, z_, progress), type);
+  x = x_.Blend(from_x, progress, Length::ValueRange::kAll);
+  y = y_.Blend(from_y, progress, Length::ValueRange::kAll);
+  z = blink::Blend(from_z, z_, progress);
 }
 
 TranslateTransformOperation* TranslateTransformOperation::ZoomTranslate(
@@ -39,7 +39,7 @@ class PLATFORM_EXPORT TranslateTransformOperation final
                               const Length& ty,
                               double tz,
                               OperationType type)
-      : x_(tx), y_(ty), z_(tz), type_(type) {
+      : TransformOperation(type), x_(tx), y_(ty), z_(tz), type_(type) {
     DCHECK(IsMatchingOperationType(type));
   }
 
@@ -94,6 +94,10 @@ class PLATFORM_EXPORT TranslateTransformOperation final
   TransformOperation* Blend(const TransformOperation* from,
                             double progress,
                             bool blend_to_identity = false) override;
+  bool BlendInto(const TransformOperation* from,
+                 double progress,
+                 bool blend_to_identity,
+                 TransformOperation& result) override;
   TransformOperation* Zoom(double factor) final {
     return ZoomTranslate(factor);
   }
@@ -105,6 +109,15 @@ class PLATFORM_EXPORT TranslateTransformOperation final
       const TransformOperation* from,
       TransformOperation::OperationType& common_type) const;
 
+  // Computes the parameters of the result of Blend().
+  void BlendedParameters(const TransformOperation* from,
+                         double progress,
+                         bool blend_to_identity,
+                         Length& x,
+                         Length& y,
+                         double& z,
+                         OperationType& type) const;
+
   bool HasNonTrivial3DComponent() const override { return z_ != 0.0; }
 
   Length x_;
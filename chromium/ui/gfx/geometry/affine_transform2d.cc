@@ -0,0 +1,37 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/affine_transform2d.h"
+
+#include "base/strings/stringprintf.h"
+#include "ui/gfx/geometry/quad_f.h"
+
+namespace gfx {
+
+bool AffineTransform2d::GetInverse(AffineTransform2d& result) const {
+  // The same as the 2d case of Matrix44::GetInverse().
+  double determinant = Determinant();
+  if (!std::isnormal(static_cast<float>(determinant))) {
+    return false;
+  }
+
+  double inv_det = 1.0 / determinant;
+  result = AffineTransform2d(d_ * inv_det, -b_ * inv_det, -c_ * inv_det,
+                             a_ * inv_det, (c_ * f_ - d_ * e_) * inv_det,
+                             (b_ * e_ - a_ * f_) * inv_det);
+  return true;
+}
+
+RectF AffineTransform2d::MapRect(const RectF& r) const {
+  return QuadF(MapPoint(r.origin()), MapPoint(r.top_right()),
+               MapPoint(r.bottom_right()), MapPoint(r.bottom_left()))
+      .BoundingBox();
+}
+
+std::string AffineTransform2d::ToString() const {
+  return base::StringPrintf("[%lg %lg %lg, %lg %lg %lg]", a_, c_, e_, b_, d_,
+                            f_);
+}
+
+}  // namespace gfx
@@ -0,0 +1,183 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_AFFINE_TRANSFORM2D_H_
+#define UI_GFX_GEOMETRY_AFFINE_TRANSFORM2D_H_
+
+#include <cmath>
+#include <iosfwd>
+#include <string>
+
+#include "base/check_op.h"
+#include "base/component_export.h"
+#include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/clamp_float_geometry.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+
+namespace gfx {
+
+// This class implements 2D affine transforms, i.e. the 2x3 matrices that map
+// (x, y) to (a * x + c * y + e, b * x + d * y + f), including 2d rotations and
+// skews. The components are named as in Transform::Affine(), and are stored
+// in double precision.
+//
+// It's the representation of Transform between AxisTransform2d and a full
+// Matrix44. The operations give the same results as the corresponding
+// Matrix44 operations on the equivalent 4x4 matrix, whose third row and
+// column are those of the identity and whose fourth row is (0, 0, 0, 1).
+//
+// Results of the *Map* methods are clamped with ClampFloatGeometry().
+//
+class COMPONENT_EXPORT(GEOMETRY) AffineTransform2d {
+ public:
+  constexpr AffineTransform2d() = default;
+  constexpr AffineTransform2d(double a,
+                              double b,
+                              double c,
+                              double d,
+                              double e,
+                              double f)
+      : a_(a), b_(b), c_(c), d_(d), e_(e), f_(f) {}
+  static constexpr AffineTransform2d FromAxisTransform2d(
+      const AxisTransform2d& axis_2d) {
+    return AffineTransform2d(axis_2d.scale().x(), 0, 0, axis_2d.scale().y(),
+                             axis_2d.translation().x(),
+                             axis_2d.translation().y());
+  }
+
+  friend constexpr bool operator==(const AffineTransform2d&,
+                                   const AffineTransform2d&) = default;
+
+  constexpr double a() const { return a_; }
+  constexpr double b() const { return b_; }
+  constexpr double c() const { return c_; }
+  constexpr double d() const { return d_; }
+  constexpr double e() const { return e_; }
+  constexpr double f() const { return f_; }
+
+  // Gets a value at |row|, |col| of the equivalent 4x4 matrix.
+  constexpr double rc(int row, int col) const {
+    DCHECK_LE(static_cast<unsigned>(row), 3u);
+    DCHECK_LE(static_cast<unsigned>(col), 3u);
+    if (row == 0) {
+      return col == 0 ? a_ : col == 1 ? c_ : col == 3 ? e_ : 0;
+    }
+    if (row == 1) {
+      return col == 0 ? b_ : col == 1 ? d_ : col == 3 ? f_ : 0;
+    }
+    return row == col ? 1 : 0;
+  }
+
+  bool IsIdentity() const { return IsIdentityOrTranslation() && !e_ && !f_; }
+  bool IsIdentityOrTranslation() const {
+    return a_ == 1 && d_ == 1 && IsScaleOrTranslation();
+  }
+  bool IsScaleOrTranslation() const { return b_ == 0 && c_ == 0; }
+
+  // this = this * scale(sx, sy).
+  void PreScale(double sx, double sy) {
+    a_ *= sx;
+    b_ *= sx;
+    c_ *= sy;
+    d_ *= sy;
+  }
+  // this = scale(sx, sy) * this.
+  void PostScale(double sx, double sy) {
+    a_ *= sx;
+    c_ *= sx;
+    e_ *= sx;
+    b_ *= sy;
+    d_ *= sy;
+    f_ *= sy;
+  }
+  // this = this * translate(dx, dy).
+  void PreTranslate(double dx, double dy) {
+    e_ = a_ * dx + c_ * dy + e_;
+    f_ = b_ * dx + d_ * dy + f_;
+  }
+  // this = translate(dx, dy) * this.
+  void PostTranslate(double dx, double dy) {
+    e_ += dx;
+    f_ += dy;
+  }
+
+  // this = this * pre.
+  void PreConcat(const AffineTransform2d& pre) { SetConcat(*this, pre); }
+  // this = post * this.
+  void PostConcat(const AffineTransform2d& post) { SetConcat(post, *this); }
+
+  // this = this * rotation, where |sin_angle| and |cos_angle| are of the angle
+  // of the rotation.
+  void RotateSinCos(double sin_angle, double cos_angle) {
+    const double a = a_;
+    const double b = b_;
+    a_ = a * cos_angle + c_ * sin_angle;
+    b_ = b * cos_angle + d_ * sin_angle;
+    c_ = c_ * cos_angle - a * sin_angle;
+    d_ = d_ * cos_angle - b * sin_angle;
+  }
+  // this = this * skew, where |tan_skew_x| and |tan_skew_y| are the tangents
+  // of the skew angles.
+  void Skew(double tan_skew_x, double tan_skew_y) {
+    const double a = a_;
+    const double b = b_;
+    a_ = a + c_ * tan_skew_y;
+    b_ = b + d_ * tan_skew_y;
+    c_ = c_ + a * tan_skew_x;
+    d_ = d_ + b * tan_skew_x;
+  }
+
+  // Changes the transform to: scale(z) * mat * scale(1/z).
+  void Zoom(double zoom_factor) {
+    e_ *= zoom_factor;
+    f_ *= zoom_factor;
+  }
+
+  double Determinant() const { return a_ * d_ - b_ * c_; }
+  bool IsInvertible() const {
+    // Check float determinant to keep consistency with Matrix44.
+    return std::isnormal(static_cast<float>(Determinant()));
+  }
+  // If |this| is invertible, sets |result| to the inverse and returns true.
+  // Otherwise leaves |result| unchanged and returns false. |result| may be
+  // |this|.
+  [[nodiscard]] bool GetInverse(AffineTransform2d& result) const;
+
+  PointF MapPoint(const PointF& p) const {
+    return PointF(ClampFloatGeometry(p.x() * a_ + p.y() * c_ + e_),
+                  ClampFloatGeometry(p.x() * b_ + p.y() * d_ + f_));
+  }
+  // Returns the bounds of the four mapped corners of |r|.
+  RectF MapRect(const RectF& r) const;
+
+  std::string ToString() const;
+
+ private:
+  void SetConcat(const AffineTransform2d& x, const AffineTransform2d& y) {
+    *this = AffineTransform2d(x.a_ * y.a_ + x.c_ * y.b_,
+                              x.b_ * y.a_ + x.d_ * y.b_,
+                              x.a_ * y.c_ + x.c_ * y.d_,
+                              x.b_ * y.c_ + x.d_ * y.d_,
+                              x.a_ * y.e_ + x.c_ * y.f_ + x.e_,
+                              x.b_ * y.e_ + x.d_ * y.f_ + x.f_);
+  }
+
+  // a.k.a. r0c0, r1c0, r0c1, r1c1, r0c3 and r1c3 of the 4x4 matrix.
+  double a_ = 1;
+  double b_ = 0;
+  double c_ = 0;
+  double d_ = 1;
+  double e_ = 0;
+  double f_ = 0;
+};
+
+// This is declared here for use in gtest-based unit tests but is defined in
+// the //ui/gfx:test_support target. Depend on that to use this in your unit
+// test. This should not be used in production code - call ToString() instead.
+void PrintTo(const AffineTransform2d&, ::std::ostream* os);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_AFFINE_TRANSFORM2D_H_
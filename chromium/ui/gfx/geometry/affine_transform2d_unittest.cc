@@ -0,0 +1,146 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/affine_transform2d.h"
+
+#include <cmath>
+
+#include "base/numerics/angle_conversions.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/test/geometry_util.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+namespace {
+
+// Returns the full matrix equivalent of |t|, whose operations are the
+// reference for those of AffineTransform2d.
+Transform FullMatrix(const AffineTransform2d& t) {
+  Transform full(t);
+  full.EnsureFullMatrixForTesting();
+  return full;
+}
+
+// Expects the bits of |t| to be the same as those of the 2d components of
+// |full|.
+void ExpectSameAs(const Transform& full, const AffineTransform2d& t) {
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      EXPECT_EQ(full.rc(row, col), t.rc(row, col))
+          << "row=" << row << " col=" << col;
+    }
+  }
+}
+
+constexpr AffineTransform2d kT(1.25, 0.5, -0.75, 2.5, 3.75, 55);
+
+TEST(AffineTransform2dTest, Mapping) {
+  PointF p(150.f, 100.f);
+  EXPECT_EQ(PointF(116.25f, 380.f), kT.MapPoint(p));
+  EXPECT_EQ(FullMatrix(kT).MapPoint(p), kT.MapPoint(p));
+
+  RectF r(150.f, 100.f, 20.f, 40.f);
+  EXPECT_EQ(RectF(86.25f, 380.f, 55.f, 110.f), kT.MapRect(r));
+  EXPECT_EQ(FullMatrix(kT).MapRect(r), kT.MapRect(r));
+}
+
+TEST(AffineTransform2dTest, ScalingAndTranslating) {
+  AffineTransform2d t = kT;
+  Transform full = FullMatrix(kT);
+  t.PreScale(1.5, -2);
+  full.Scale(1.5, -2);
+  ExpectSameAs(full, t);
+  t.PostScale(0.25, 3);
+  full.PostScale(0.25, 3);
+  ExpectSameAs(full, t);
+  t.PreTranslate(3, -5);
+  full.Translate(3, -5);
+  ExpectSameAs(full, t);
+  t.PostTranslate(-7, 0.5);
+  full.PostTranslate(-7, 0.5);
+  ExpectSameAs(full, t);
+}
+
+TEST(AffineTransform2dTest, Concat) {
+  constexpr AffineTransform2d kOther(0.5, -1, 2, 0.25, -4, 8);
+  AffineTransform2d t = kT;
+  Transform full = FullMatrix(kT);
+  t.PreConcat(kOther);
+  full.PreConcat(FullMatrix(kOther));
+  ExpectSameAs(full, t);
+  t.PostConcat(kOther);
+  full.PostConcat(FullMatrix(kOther));
+  ExpectSameAs(full, t);
+}
+
+TEST(AffineTransform2dTest, RotateAndSkew) {
+  AffineTransform2d t = kT;
+  Transform full = FullMatrix(kT);
+  t.RotateSinCos(std::sin(0.5), std::cos(0.5));
+  Transform rotation;
+  rotation.set_rc(0, 0, std::cos(0.5));
+  rotation.set_rc(0, 1, -std::sin(0.5));
+  rotation.set_rc(1, 0, std::sin(0.5));
+  rotation.set_rc(1, 1, std::cos(0.5));
+  full.PreConcat(rotation);
+  EXPECT_TRUE(full.ApproximatelyEqual(Transform(t)));
+
+  t = kT;
+  full = FullMatrix(kT);
+  t.Skew(std::tan(0.25), std::tan(-0.5));
+  full.Skew(base::RadToDeg(0.25), base::RadToDeg(-0.5));
+  EXPECT_TRUE(full.ApproximatelyEqual(Transform(t)));
+}
+
+TEST(AffineTransform2dTest, Inverse) {
+  AffineTransform2d inverse;
+  ASSERT_TRUE(kT.GetInverse(inverse));
+  Transform full_inverse;
+  ASSERT_TRUE(FullMatrix(kT).GetInverse(&full_inverse));
+  ExpectSameAs(full_inverse, inverse);
+
+  AffineTransform2d product = kT;
+  product.PreConcat(inverse);
+  EXPECT_TRUE(Transform(product).ApproximatelyEqual(Transform()));
+
+  // The inverse may replace the transform.
+  AffineTransform2d t = kT;
+  ASSERT_TRUE(t.GetInverse(t));
+  EXPECT_EQ(inverse, t);
+
+  constexpr AffineTransform2d kSingular(1, 2, 2, 4, 5, 6);
+  EXPECT_FALSE(kSingular.IsInvertible());
+  EXPECT_FALSE(kSingular.GetInverse(t));
+  EXPECT_EQ(inverse, t);
+}
+
+TEST(AffineTransform2dTest, Predicates) {
+  EXPECT_TRUE(AffineTransform2d().IsIdentity());
+  EXPECT_TRUE(AffineTransform2d(1, 0, 0, 1, 2, 3).IsIdentityOrTranslation());
+  EXPECT_FALSE(AffineTransform2d(1, 0, 0, 1, 2, 3).IsIdentity());
+  EXPECT_TRUE(AffineTransform2d(2, 0, 0, 3, 2, 3).IsScaleOrTranslation());
+  EXPECT_FALSE(AffineTransform2d(2, 0, 0, 3, 2, 3).IsIdentityOrTranslation());
+  EXPECT_FALSE(kT.IsScaleOrTranslation());
+  EXPECT_EQ(AffineTransform2d(2, 0, 0, 3, 4, 5),
+            AffineTransform2d::FromAxisTransform2d(
+                AxisTransform2d::FromScaleAndTranslation(Vector2dF(2, 3),
+                                                         Vector2dF(4, 5))));
+}
+
+TEST(AffineTransform2dTest, ClampOutput) {
+  constexpr AffineTransform2d kHuge(1e300, 0.5, -2, 1e300, 0, 0);
+  PointF p = kHuge.MapPoint(PointF(1, -1));
+  EXPECT_TRUE(std::isfinite(p.x()));
+  EXPECT_TRUE(std::isfinite(p.y()));
+  RectF r = kHuge.MapRect(RectF(1, 1, 2, 2));
+  EXPECT_TRUE(std::isfinite(r.right()));
+  EXPECT_TRUE(std::isfinite(r.bottom()));
+}
+
+TEST(AffineTransform2dTest, ToString) {
+  EXPECT_EQ("[1.25 -0.75 3.75, 0.5 2.5 55]", kT.ToString());
+}
+
+}  // namespace
+}  // namespace gfx
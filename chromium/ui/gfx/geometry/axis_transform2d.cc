@@ -6,11 +6,133 @@
 #include "ui/gfx/geometry/axis_transform2d.h"
 
 #include "base/check_op.h"
+#include "base/compiler_specific.h"
 #include "base/strings/stringprintf.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
 #include "ui/gfx/geometry/decomposed_transform.h"
+#include "ui/gfx/geometry/double4.h"
 
 namespace gfx {
 
+namespace {
+
+// The lanes of the x, y, width and height of four rects.
+struct RectLanes {
+  Float4 x, y, width, height;
+};
+
+ALWAYS_INLINE RectLanes LoadRectLanes(base::span<const RectF, 4> rects) {
+  RectLanes lanes;
+  for (size_t i = 0; i < 4; ++i) {
+    lanes.x[i] = rects[i].x();
+    lanes.y[i] = rects[i].y();
+    lanes.width[i] = rects[i].width();
+    lanes.height[i] = rects[i].height();
+  }
+  return lanes;
+}
+
+ALWAYS_INLINE void StoreRectLanes(const RectLanes& lanes,
+                                  base::span<RectF, 4> results) {
+  for (size_t i = 0; i < 4; ++i) {
+    // Let RectF apply its clamping of tiny sizes, as the single versions do.
+    results[i] =
+        RectF(lanes.x[i], lanes.y[i], lanes.width[i], lanes.height[i]);
+  }
+}
+
+}  // namespace
+
+void AxisTransform2d::MapPoints(base::span<const PointF> points,
+                                base::span<PointF> results) const {
+  CheckBatchSpans(points, results);
+  size_t i = 0;
+  for (; i + 4 <= points.size(); i += 4) {
+    Float4 x, y;
+    for (size_t j = 0; j < 4; ++j) {
+      x[j] = points[i + j].x();
+      y[j] = points[i + j].y();
+    }
+    // The same operations as MapX() and MapY().
+    x = ClampFloatGeometry4(x * scale_.x() + translation_.x());
+    y = ClampFloatGeometry4(y * scale_.y() + translation_.y());
+    for (size_t j = 0; j < 4; ++j) {
+      results[i + j] = PointF(x[j], y[j]);
+    }
+  }
+  for (; i < points.size(); ++i) {
+    results[i] = MapPoint(points[i]);
+  }
+}
+
+void AxisTransform2d::InverseMapPoints(base::span<const PointF> points,
+                                       base::span<PointF> results) const {
+  CheckBatchSpans(points, results);
+  const float inverse_scale_x = 1.f / scale_.x();
+  const float inverse_scale_y = 1.f / scale_.y();
+  size_t i = 0;
+  for (; i + 4 <= points.size(); i += 4) {
+    Float4 x, y;
+    for (size_t j = 0; j < 4; ++j) {
+      x[j] = points[i + j].x();
+      y[j] = points[i + j].y();
+    }
+    // The same operations as InverseMapX() and InverseMapY().
+    x = ClampFloatGeometry4((x - translation_.x()) * inverse_scale_x);
+    y = ClampFloatGeometry4((y - translation_.y()) * inverse_scale_y);
+    for (size_t j = 0; j < 4; ++j) {
+      results[i + j] = PointF(x[j], y[j]);
+    }
+  }
+  for (; i < points.size(); ++i) {
+    results[i] = InverseMapPoint(points[i]);
+  }
+}
+
+void AxisTransform2d::MapRects(base::span<const RectF> rects,
+                               base::span<RectF> results) const {
+  CheckBatchSpans(rects, results);
+  DCHECK_GE(scale_.x(), 0.f);
+  DCHECK_GE(scale_.y(), 0.f);
+  size_t i = 0;
+  for (; i + 4 <= rects.size(); i += 4) {
+    RectLanes lanes = LoadRectLanes(rects.subspan(i).first<4>());
+    // The same operations as MapRect().
+    lanes.x = ClampFloatGeometry4(lanes.x * scale_.x() + translation_.x());
+    lanes.y = ClampFloatGeometry4(lanes.y * scale_.y() + translation_.y());
+    lanes.width = ClampFloatGeometry4(lanes.width * scale_.x());
+    lanes.height = ClampFloatGeometry4(lanes.height * scale_.y());
+    StoreRectLanes(lanes, results.subspan(i).first<4>());
+  }
+  for (; i < rects.size(); ++i) {
+    results[i] = MapRect(rects[i]);
+  }
+}
+
+void AxisTransform2d::InverseMapRects(base::span<const RectF> rects,
+                                      base::span<RectF> results) const {
+  CheckBatchSpans(rects, results);
+  DCHECK_GT(scale_.x(), 0.f);
+  DCHECK_GT(scale_.y(), 0.f);
+  const float inverse_scale_x = 1.f / scale_.x();
+  const float inverse_scale_y = 1.f / scale_.y();
+  size_t i = 0;
+  for (; i + 4 <= rects.size(); i += 4) {
+    RectLanes lanes = LoadRectLanes(rects.subspan(i).first<4>());
+    // The same operations as InverseMapRect().
+    lanes.x =
+        ClampFloatGeometry4((lanes.x - translation_.x()) * inverse_scale_x);
+    lanes.y =
+        ClampFloatGeometry4((lanes.y - translation_.y()) * inverse_scale_y);
+    lanes.width = ClampFloatGeometry4(lanes.width * inverse_scale_x);
+    lanes.height = ClampFloatGeometry4(lanes.height * inverse_scale_y);
+    StoreRectLanes(lanes, results.subspan(i).first<4>());
+  }
+  for (; i < rects.size(); ++i) {
+    results[i] = InverseMapRect(rects[i]);
+  }
+}
+
 DecomposedTransform AxisTransform2d::Decompose() const {
   DecomposedTransform decomp;
 
@@ -9,6 +9,7 @@
 
 #include "base/check_op.h"
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/clamp_float_geometry.h"
 #include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/vector2d_f.h"
@@ -112,6 +113,19 @@ class COMPONENT_EXPORT(GEOMETRY) AxisTransform2d {
                  ClampFloatGeometry(r.height() * (1.f / scale_.y())));
   }
 
+  // MapPoint(), InverseMapPoint(), MapRect() and InverseMapRect() of each of
+  // |points| or |rects| into |results|, which must have the same size. Four
+  // are mapped at a time with vector operations, with the same results as the
+  // single versions. The inputs and |results| may refer to the same memory.
+  void MapPoints(base::span<const PointF> points,
+                 base::span<PointF> results) const;
+  void InverseMapPoints(base::span<const PointF> points,
+                        base::span<PointF> results) const;
+  void MapRects(base::span<const RectF> rects,
+                base::span<RectF> results) const;
+  void InverseMapRects(base::span<const RectF> rects,
+                       base::span<RectF> results) const;
+
   // Decomposes this transform into |decomp|, following the 2d decomposition
   // spec: https://www.w3.org/TR/css-transforms-1/#decomposing-a-2d-matrix.
   // It's a simplified version of Matrix44::Decompose2d().
@@ -4,8 +4,13 @@
 
 #include "ui/gfx/geometry/axis_transform2d.h"
 
+#include <stdint.h>
+
 #include <array>
+#include <cstring>
+#include <limits>
 
+#include "base/numerics/saturation_counters.h"
 #include "base/strings/stringprintf.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/decomposed_transform.h"
@@ -92,6 +97,93 @@ TEST(AxisTransform2dTest, Inverse) {
                              ConcatAxisTransform2d(inv_inplace, t));
 }
 
+TEST(AxisTransform2dTest, BatchedMapping) {
+  AxisTransform2d t = AxisTransform2d::FromScaleAndTranslation(
+      Vector2dF(1.25f, 0.3f), Vector2dF(3.75f, -55.f));
+  constexpr float kMax = std::numeric_limits<float>::max();
+  constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+  // Six, so that the last two are mapped singly.
+  const std::array<PointF, 6> points = {
+      PointF(150.f, 100.f), PointF(-0.1f, 1e-3f), PointF(kMax, -kMax),
+      PointF(kNaN, 7.f),    PointF(1e30f, 0.7f),  PointF(-3.f, kNaN)};
+  std::array<PointF, 6> results;
+  t.MapPoints(points, results);
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(t.MapPoint(points[i]), results[i]) << i;
+  }
+  t.InverseMapPoints(points, results);
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(t.InverseMapPoint(points[i]), results[i]) << i;
+  }
+  // In place.
+  results = points;
+  t.MapPoints(results, results);
+  EXPECT_EQ(t.MapPoint(points[0]), results[0]);
+  EXPECT_EQ(t.MapPoint(points[5]), results[5]);
+
+  const std::array<RectF, 6> rects = {
+      RectF(150.f, 100.f, 22.5f, 37.5f), RectF(-0.1f, 1e-3f, 1e-30f, 5.f),
+      RectF(kMax, -kMax, kMax, kMax),    RectF(kNaN, 7.f, kNaN, 2.f),
+      RectF(1e30f, 0.7f, 1e30f, 0.f),    RectF(-3.f, 4.f, 5.f, 6.f)};
+  std::array<RectF, 6> rect_results;
+  t.MapRects(rects, rect_results);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    EXPECT_EQ(t.MapRect(rects[i]), rect_results[i]) << i;
+  }
+  t.InverseMapRects(rects, rect_results);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    EXPECT_EQ(t.InverseMapRect(rects[i]), rect_results[i]) << i;
+  }
+}
+
+// The saturations of ClampFloatGeometry(), as overflows + underflows + NaNs.
+uint64_t FloatGeometrySaturations() {
+  uint64_t saturations = 0;
+  base::ForEachSaturationCounts(
+      [&](const base::numerics_internal::SaturationCounts& counts) {
+        if (strstr(counts.handler, "FloatGeometrySaturationHandler<float>")) {
+          saturations += counts.overflows + counts.underflows + counts.nans;
+        }
+      });
+  return saturations;
+}
+
+TEST(AxisTransform2dTest, BatchedMappingCountsSaturations) {
+  AxisTransform2d t = AxisTransform2d::FromScaleAndTranslation(
+      Vector2dF(1e30f, 0.5f), Vector2dF(1.f, 2.f));
+  constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+  // Four, so that they are all mapped in the lanes.
+  const std::array<PointF, 4> points = {PointF(1e30f, 1.f), PointF(-1e30f, 2.f),
+                                        PointF(kNaN, 3.f), PointF(4.f, 5.f)};
+  const std::array<RectF, 4> rects = {
+      RectF(1e30f, 1.f, 1e30f, 2.f), RectF(-1e30f, 2.f, 3.f, 4.f),
+      RectF(kNaN, 3.f, 4.f, 5.f), RectF(4.f, 5.f, 6.f, 7.f)};
+
+  // The batches count the same saturations as mapping each element.
+  uint64_t before = FloatGeometrySaturations();
+  std::array<PointF, 4> expected;
+  std::array<RectF, 4> expected_rects;
+  for (size_t i = 0; i < 4; ++i) {
+    expected[i] = t.MapPoint(points[i]);
+    expected_rects[i] = t.MapRect(rects[i]);
+  }
+  const uint64_t single = FloatGeometrySaturations() - before;
+
+  before = FloatGeometrySaturations();
+  std::array<PointF, 4> results;
+  t.MapPoints(points, results);
+  std::array<RectF, 4> rect_results;
+  t.MapRects(rects, rect_results);
+  EXPECT_EQ(FloatGeometrySaturations() - before, single);
+  EXPECT_EQ(expected, results);
+  EXPECT_EQ(expected_rects, rect_results);
+  if (base::numerics_internal::kCountSaturations) {
+    EXPECT_EQ(single, 7u);
+  } else {
+    EXPECT_EQ(single, 0u);
+  }
+}
+
 TEST(AxisTransform2dTest, ClampOutput) {
   const auto entries = std::to_array<std::pair<float, float>>({
       // The first entry is used to initialize the transform.
@@ -0,0 +1,79 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_BATCH_BATCH_SPANS_H_
+#define UI_GFX_GEOMETRY_BATCH_BATCH_SPANS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "base/check_op.h"
+#include "base/compiler_specific.h"
+#include "base/containers/span.h"
+#include "base/numerics/saturation_counters.h"
+#include "ui/gfx/geometry/clamp_float_geometry.h"
+#include "ui/gfx/geometry/double4.h"
+
+namespace gfx {
+
+// The rules that the batch operations of ui/gfx/geometry, e.g.
+// Transform::MapRects(), ToEnclosingRects() and CubicBezier::SolveMany(),
+// follow, so that callers can use them the same way:
+// - Element i of each output is the function of element i of each input, with
+//   the same result as the function of a single element, including its
+//   clamping with ClampFloatGeometry() and its saturation to int.
+// - The inputs and outputs have the same size, which is CHECKed.
+// - An output may be the same memory as an input of the same type, to update
+//   the elements in place, but must not otherwise overlap it.
+// - The elements are processed in the lanes of the vector types of double4.h,
+//   which map to SSE2 and NEON. Kernels for which AVX2 is worth it are also
+//   compiled for it, and are selected with HasAvx2() of
+//   batch/cpu_features.h.
+// The inputs are spans of the geometry types, or, where the operation loads
+// the components separately, their structure of arrays, e.g. Float3Array and
+// the component spans of Transform::MapRects().
+
+// Checks that |input| and |output| follow the rules above.
+template <typename T, typename U>
+void CheckBatchSpans(base::span<const T> input, base::span<U> output) {
+  CHECK_EQ(input.size(), output.size());
+  if constexpr (std::is_same_v<T, U>) {
+    const uintptr_t input_begin = reinterpret_cast<uintptr_t>(input.data());
+    const uintptr_t output_begin = reinterpret_cast<uintptr_t>(output.data());
+    const uintptr_t size_in_bytes = input.size() * sizeof(T);
+    DCHECK(input_begin == output_begin ||
+           input_begin + size_in_bytes <= output_begin ||
+           output_begin + size_in_bytes <= input_begin)
+        << "The output of a batch operation partially overlaps its input";
+  }
+}
+
+// Applies ClampFloatGeometry() to each lane of |v|, a Float4 or a Double4,
+// and counts the saturations as it does.
+template <typename Vector4>
+ALWAYS_INLINE Float4 ClampFloatGeometry4(Vector4 v) {
+  using Limits = FloatGeometrySaturationHandler<float>;
+  const Vector4 kNaN = Vector4{} + Limits::NaN();
+  const Vector4 kMax = Vector4{} + Limits::max();
+  const Vector4 kLowest = Vector4{} + Limits::lowest();
+  if constexpr (BASE_NUMERICS_COUNT_SATURATIONS) {
+    for (int i = 0; i < 4; ++i) {
+      const bool is_overflow = !(v[i] <= Limits::max());
+      const bool is_underflow = !(v[i] >= Limits::lowest());
+      if (is_overflow || is_underflow) {
+        base::CountSaturation<Limits>(is_overflow, is_underflow);
+      }
+    }
+  }
+  v = v == v ? v : kNaN;
+  v = v > kMax ? kMax : v;
+  v = v < kLowest ? kLowest : v;
+  return __builtin_convertvector(v, Float4);
+}
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_BATCH_BATCH_SPANS_H_
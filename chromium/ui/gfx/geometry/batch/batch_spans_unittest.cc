@@ -0,0 +1,64 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/batch/batch_spans.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+TEST(BatchSpansTest, CheckBatchSpans) {
+  std::vector<RectF> rects(10);
+  std::vector<RectF> results(10);
+  std::vector<Rect> converted(10);
+  // Disjoint, the same memory, adjacent, and of different types.
+  CheckBatchSpans<RectF, RectF>(rects, results);
+  CheckBatchSpans<RectF, RectF>(rects, rects);
+  CheckBatchSpans<RectF, RectF>(base::span(rects).first(5u),
+                                base::span(rects).last(5u));
+  CheckBatchSpans<RectF, Rect>(rects, converted);
+  CheckBatchSpans<RectF, RectF>({}, {});
+}
+
+// The batch operations that follow the rules have the same results in place.
+TEST(BatchSpansTest, InPlace) {
+  std::vector<PointF> points;
+  std::vector<RectF> rects;
+  for (int i = 0; i < 11; ++i) {
+    points.emplace_back(i * 1.5f, -i * 3.25f);
+    rects.emplace_back(i * 1.5f, -i * 3.25f, i + 0.5f, 2 * i);
+  }
+  Transform transform;
+  transform.Scale(2, 3);
+  transform.Translate(10, -20);
+  const AxisTransform2d axis_transform =
+      AxisTransform2d::FromScaleAndTranslation(Vector2dF(2, 3),
+                                               Vector2dF(10, -20));
+
+  std::vector<PointF> mapped_points(points.size());
+  transform.MapPoints(points, mapped_points);
+  std::vector<PointF> in_place_points = points;
+  transform.MapPoints(in_place_points, in_place_points);
+  EXPECT_EQ(mapped_points, in_place_points);
+
+  std::vector<RectF> mapped_rects(rects.size());
+  transform.MapRects(rects, mapped_rects);
+  std::vector<RectF> in_place_rects = rects;
+  transform.MapRects(in_place_rects, in_place_rects);
+  EXPECT_EQ(mapped_rects, in_place_rects);
+
+  axis_transform.MapRects(rects, mapped_rects);
+  in_place_rects = rects;
+  axis_transform.MapRects(in_place_rects, in_place_rects);
+  EXPECT_EQ(mapped_rects, in_place_rects);
+}
+
+}  // namespace gfx
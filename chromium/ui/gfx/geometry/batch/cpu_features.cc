@@ -0,0 +1,25 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/batch/cpu_features.h"
+
+#include "build/build_config.h"
+
+#if defined(ARCH_CPU_X86_64)
+#include "base/cpu.h"
+#endif
+
+namespace gfx {
+
+bool HasAvx2() {
+#if defined(ARCH_CPU_X86_64)
+  static const bool has_avx2 =
+      base::CPU::GetInstanceNoAllocation().has_avx2();
+  return has_avx2;
+#else
+  return false;
+#endif
+}
+
+}  // namespace gfx
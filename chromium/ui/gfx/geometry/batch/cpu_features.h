@@ -0,0 +1,23 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_BATCH_CPU_FEATURES_H_
+#define UI_GFX_GEOMETRY_BATCH_CPU_FEATURES_H_
+
+#include "base/component_export.h"
+
+namespace gfx {
+
+// Whether the CPU has AVX2, for the kernels that are compiled with
+// __attribute__((target("avx2"))) next to their portable versions on x86-64.
+// They don't use FMA, so that their results are the same as the portable
+// code's. The portable Double4 code is often split into SSE2 halves or scalar
+// code without AVX. It's checked once, and is always false on the other
+// architectures, where the portable code is compiled for NEON or the baseline
+// of the target.
+COMPONENT_EXPORT(GEOMETRY) bool HasAvx2();
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_BATCH_CPU_FEATURES_H_
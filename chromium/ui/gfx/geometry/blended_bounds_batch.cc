@@ -0,0 +1,87 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/blended_bounds_batch.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "base/functional/bind.h"
+#include "base/task/post_job.h"
+#include "base/task/task_traits.h"
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace gfx {
+
+namespace {
+
+// The number of jobs of each chunk computed by a worker.
+constexpr size_t kJobsPerParallelChunk = 16;
+
+void ComputeJobs(base::span<BlendedBoundsJob> jobs, SkScalar tolerance) {
+  for (BlendedBoundsJob& job : jobs) {
+    job.succeeded = job.to->BlendedBoundsForBox(
+        job.box, *job.from, job.min_progress, job.max_progress, &job.bounds,
+        tolerance);
+  }
+}
+
+// Computes chunks of |jobs| with a job of the thread pool, which the calling
+// thread joins. Each worker takes the next chunk that no other worker took.
+class ParallelBlendedBounds {
+ public:
+  ParallelBlendedBounds(base::span<BlendedBoundsJob> jobs, SkScalar tolerance)
+      : jobs_(jobs),
+        tolerance_(tolerance),
+        chunk_count_((jobs.size() + kJobsPerParallelChunk - 1) /
+                     kJobsPerParallelChunk) {}
+
+  void Run() {
+    base::PostJob(
+        FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+        base::BindRepeating(&ParallelBlendedBounds::ComputeChunks,
+                            base::Unretained(this)),
+        base::BindRepeating(&ParallelBlendedBounds::GetMaxConcurrency,
+                            base::Unretained(this)))
+        .Join();
+  }
+
+ private:
+  void ComputeChunks(base::JobDelegate* delegate) {
+    while (!delegate->ShouldYield()) {
+      const size_t chunk = next_chunk_.fetch_add(1);
+      if (chunk >= chunk_count_) {
+        return;
+      }
+      const size_t begin = chunk * kJobsPerParallelChunk;
+      ComputeJobs(jobs_.subspan(begin, std::min(kJobsPerParallelChunk,
+                                                jobs_.size() - begin)),
+                  tolerance_);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t) const {
+    return chunk_count_ - std::min(next_chunk_.load(), chunk_count_);
+  }
+
+  const base::span<BlendedBoundsJob> jobs_;
+  const SkScalar tolerance_;
+  const size_t chunk_count_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+}  // namespace
+
+bool ComputeBlendedBoundsForBoxes(base::span<BlendedBoundsJob> jobs,
+                                  SkScalar tolerance) {
+  if (jobs.size() < kMinJobsForParallelBlendedBounds) {
+    ComputeJobs(jobs, tolerance);
+  } else {
+    ParallelBlendedBounds(jobs, tolerance).Run();
+  }
+  return std::ranges::all_of(
+      jobs, [](const BlendedBoundsJob& job) { return job.succeeded; });
+}
+
+}  // namespace gfx
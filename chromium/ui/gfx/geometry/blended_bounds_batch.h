@@ -0,0 +1,53 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_BLENDED_BOUNDS_BATCH_H_
+#define UI_GFX_GEOMETRY_BLENDED_BOUNDS_BATCH_H_
+
+#include <stddef.h>
+
+#include "base/component_export.h"
+#include "base/containers/span.h"
+#include "base/memory/raw_ptr.h"
+#include "third_party/skia/include/core/SkScalar.h"
+#include "ui/gfx/geometry/box_f.h"
+
+namespace gfx {
+
+class TransformOperations;
+
+// A computation of ComputeBlendedBoundsForBoxes(): the bounds of |box| when
+// it's transformed by |to| blended from |from| with progress in
+// [min_progress, max_progress], as TransformOperations::BlendedBoundsForBox()
+// computes them.
+struct BlendedBoundsJob {
+  raw_ptr<const TransformOperations> from;
+  raw_ptr<const TransformOperations> to;
+  BoxF box;
+  SkScalar min_progress = 0;
+  SkScalar max_progress = 1;
+
+  // Set by ComputeBlendedBoundsForBoxes(). |bounds| is only meaningful if
+  // |succeeded|.
+  BoxF bounds;
+  bool succeeded = false;
+};
+
+// Batches of at least this many jobs are computed in parallel.
+inline constexpr size_t kMinJobsForParallelBlendedBounds = 64;
+
+// Computes the bounds of each of |jobs|, e.g. those of all the animated
+// layers at commit, and returns whether all of them succeeded. Batches of at
+// least kMinJobsForParallelBlendedBounds jobs are split into chunks, which
+// workers of the thread pool compute while the calling thread joins them, so
+// this requires a thread pool; smaller batches are computed on the calling
+// thread. Jobs can share operations, which mustn't be modified during the
+// call. The results are the same either way.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+bool ComputeBlendedBoundsForBoxes(base::span<BlendedBoundsJob> jobs,
+                                  SkScalar tolerance = 0);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_BLENDED_BOUNDS_BATCH_H_
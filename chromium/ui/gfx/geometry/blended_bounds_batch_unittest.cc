@@ -0,0 +1,92 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/blended_bounds_batch.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace gfx {
+namespace {
+
+class BlendedBoundsBatchTest : public testing::Test {
+ protected:
+  BlendedBoundsBatchTest() {
+    to_.AppendTranslate(10, 0, 0);
+    to_.AppendRotate(0, 0, 1, 90);
+    to_.AppendScale(2, 2, 1);
+    // Doesn't match the types of |to_|, so it has no blended bounds.
+    mismatched_.AppendSkewX(20);
+  }
+
+  // Makes |count| jobs, all sharing |to_|, and returns them with their
+  // bounds computed one by one.
+  std::vector<BlendedBoundsJob> MakeJobs(size_t count) {
+    from_.clear();
+    from_.resize(count);
+    std::vector<BlendedBoundsJob> jobs(count);
+    for (size_t i = 0; i < count; ++i) {
+      const float f = static_cast<float>(i);
+      if (i % 10 == 9) {
+        jobs[i].from = &mismatched_;
+      } else {
+        from_[i].AppendTranslate(-f, f, 0);
+        from_[i].AppendRotate(0, 0, 1, f);
+        from_[i].AppendScale(1, 1 + f / 10, 1);
+        jobs[i].from = &from_[i];
+      }
+      jobs[i].to = &to_;
+      jobs[i].box = BoxF(f, 0, 0, 10, 20 + f, 1);
+      jobs[i].min_progress = i % 2 ? -0.5f : 0;
+      jobs[i].max_progress = 1;
+      jobs[i].succeeded =
+          jobs[i].to->BlendedBoundsForBox(jobs[i].box, *jobs[i].from,
+                                          jobs[i].min_progress,
+                                          jobs[i].max_progress,
+                                          &jobs[i].bounds);
+    }
+    return jobs;
+  }
+
+  void ExpectSameResults(size_t count) {
+    const std::vector<BlendedBoundsJob> expected = MakeJobs(count);
+    std::vector<BlendedBoundsJob> jobs = expected;
+    for (BlendedBoundsJob& job : jobs) {
+      job.bounds = BoxF();
+      job.succeeded = false;
+    }
+    EXPECT_FALSE(ComputeBlendedBoundsForBoxes(jobs));
+    for (size_t i = 0; i < count; ++i) {
+      EXPECT_EQ(expected[i].succeeded, jobs[i].succeeded) << i;
+      EXPECT_EQ(i % 10 != 9, jobs[i].succeeded) << i;
+      if (jobs[i].succeeded) {
+        EXPECT_EQ(expected[i].bounds, jobs[i].bounds) << i;
+      }
+    }
+  }
+
+  TransformOperations to_;
+  TransformOperations mismatched_;
+  std::vector<TransformOperations> from_;
+};
+
+TEST_F(BlendedBoundsBatchTest, Serial) {
+  ExpectSameResults(kMinJobsForParallelBlendedBounds - 1);
+
+  std::vector<BlendedBoundsJob> jobs = MakeJobs(3);
+  EXPECT_TRUE(ComputeBlendedBoundsForBoxes(jobs));
+  EXPECT_TRUE(ComputeBlendedBoundsForBoxes({}));
+}
+
+TEST_F(BlendedBoundsBatchTest, Parallel) {
+  ExpectSameResults(5 * kMinJobsForParallelBlendedBounds + 3);
+}
+
+}  // namespace
+}  // namespace gfx
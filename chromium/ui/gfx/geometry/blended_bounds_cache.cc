@@ -0,0 +1,101 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/blended_bounds_cache.h"
+
+#include <algorithm>
+
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace gfx {
+
+namespace {
+
+bool IsSameOperation(const std::optional<TransformOperation>& cached,
+                     const TransformOperation* operation) {
+  if (!cached || !operation) {
+    return !cached && !operation;
+  }
+  return cached->ApproximatelyEqual(*operation, 0);
+}
+
+std::optional<TransformOperation> ToOptional(
+    const TransformOperation* operation) {
+  if (!operation) {
+    return std::nullopt;
+  }
+  return *operation;
+}
+
+}  // namespace
+
+BlendedBoundsCache::BlendedBoundsCache() = default;
+
+BlendedBoundsCache::~BlendedBoundsCache() = default;
+
+void BlendedBoundsCache::Clear() {
+  steps_.clear();
+  reused_count_ = 0;
+}
+
+bool BlendedBoundsCache::BlendedBoundsForBox(const TransformOperations& to,
+                                             const BoxF& box,
+                                             const TransformOperations& from,
+                                             SkScalar min_progress,
+                                             SkScalar max_progress,
+                                             BoxF* bounds,
+                                             SkScalar tolerance) {
+  // This follows TransformOperations::BlendedBoundsForBox().
+  *bounds = box;
+  reused_count_ = 0;
+
+  const bool from_identity = from.IsIdentity();
+  const bool to_identity = to.IsIdentity();
+  if (from_identity && to_identity) {
+    return true;
+  }
+  if (!to.MatchesTypes(from)) {
+    return false;
+  }
+
+  if (box != box_ || min_progress != min_progress_ ||
+      max_progress != max_progress_ || tolerance != tolerance_) {
+    steps_.clear();
+    box_ = box;
+    min_progress_ = min_progress;
+    max_progress_ = max_progress;
+    tolerance_ = tolerance;
+  }
+
+  const size_t num_operations = std::max(from_identity ? 0 : from.size(),
+                                         to_identity ? 0 : to.size());
+  for (size_t i = 0; i < num_operations; ++i) {
+    const size_t operation_index = num_operations - 1 - i;
+    const TransformOperation* from_op =
+        from_identity ? nullptr : &from.at(operation_index);
+    const TransformOperation* to_op =
+        to_identity ? nullptr : &to.at(operation_index);
+    if (i == reused_count_ && i < steps_.size() &&
+        IsSameOperation(steps_[i].from, from_op) &&
+        IsSameOperation(steps_[i].to, to_op)) {
+      *bounds = steps_[i].bounds;
+      ++reused_count_;
+      continue;
+    }
+    steps_.resize(i);
+    BoxF bounds_for_operation;
+    if (!TransformOperation::BlendedBoundsForBox(*bounds, from_op, to_op,
+                                                 min_progress, max_progress,
+                                                 &bounds_for_operation,
+                                                 tolerance)) {
+      return false;
+    }
+    *bounds = bounds_for_operation;
+    steps_.push_back({ToOptional(from_op), ToOptional(to_op), *bounds});
+  }
+  steps_.resize(num_operations);
+  return true;
+}
+
+}  // namespace gfx
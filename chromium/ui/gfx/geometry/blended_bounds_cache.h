@@ -0,0 +1,71 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_BLENDED_BOUNDS_CACHE_H_
+#define UI_GFX_GEOMETRY_BLENDED_BOUNDS_CACHE_H_
+
+#include <stddef.h>
+
+#include <optional>
+#include <vector>
+
+#include "base/component_export.h"
+#include "third_party/skia/include/core/SkScalar.h"
+#include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/transform_operation.h"
+
+namespace gfx {
+
+class TransformOperations;
+
+// Computes the blended bounds of a box for a sequence of pairs of operations,
+// such as those of a transition that is retargeted on each input event.
+// TransformOperations::BlendedBoundsForBox() maps the box through the
+// operations from the last one to the first one, so the bounds after the
+// operations that are at the same distance from the end, and that are the
+// same as in the last call, are reused instead of computed again. E.g. when a
+// drag retargets the translation before a rotation, the bounds of the arc of
+// the rotation aren't computed again.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) BlendedBoundsCache {
+ public:
+  BlendedBoundsCache();
+  BlendedBoundsCache(const BlendedBoundsCache&) = delete;
+  BlendedBoundsCache& operator=(const BlendedBoundsCache&) = delete;
+  ~BlendedBoundsCache();
+
+  // Returns the same as to.BlendedBoundsForBox(box, from, min_progress,
+  // max_progress, bounds, tolerance).
+  bool BlendedBoundsForBox(const TransformOperations& to,
+                           const BoxF& box,
+                           const TransformOperations& from,
+                           SkScalar min_progress,
+                           SkScalar max_progress,
+                           BoxF* bounds,
+                           SkScalar tolerance = 0);
+
+  // The number of operations whose bounds the last call reused.
+  size_t reused_count() const { return reused_count_; }
+
+  void Clear();
+
+ private:
+  // The bounds after mapping through a pair of operations, in the order in
+  // which they are mapped. Null operations are identities.
+  struct Step {
+    std::optional<TransformOperation> from;
+    std::optional<TransformOperation> to;
+    BoxF bounds;
+  };
+
+  BoxF box_;
+  SkScalar min_progress_ = 0;
+  SkScalar max_progress_ = 0;
+  SkScalar tolerance_ = 0;
+  std::vector<Step> steps_;
+  size_t reused_count_ = 0;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_BLENDED_BOUNDS_CACHE_H_
@@ -0,0 +1,95 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/blended_bounds_cache.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace gfx {
+namespace {
+
+TransformOperations MakeOperations(float x, float degrees) {
+  TransformOperations operations;
+  operations.AppendTranslate(x, 2 * x, 0);
+  operations.AppendRotate(0, 0, 1, degrees);
+  operations.AppendScale(2, 3, 1);
+  return operations;
+}
+
+TEST(BlendedBoundsCacheTest, ReusesUnchangedOperations) {
+  const BoxF box(1, 2, 0, 10, 20, 0);
+  const TransformOperations to = MakeOperations(10, 90);
+  BlendedBoundsCache cache;
+
+  // Retargeting the translation reuses the bounds of the scale and the arc of
+  // the rotation.
+  for (float x = 0; x < 5; ++x) {
+    const TransformOperations from = MakeOperations(x, 30);
+    BoxF expected;
+    ASSERT_TRUE(to.BlendedBoundsForBox(box, from, -0.5f, 1.5f, &expected));
+    BoxF bounds;
+    ASSERT_TRUE(
+        cache.BlendedBoundsForBox(to, box, from, -0.5f, 1.5f, &bounds));
+    EXPECT_EQ(expected, bounds) << x;
+    EXPECT_EQ(x ? 2u : 0u, cache.reused_count()) << x;
+  }
+
+  // Changing the rotation only reuses the scale.
+  BoxF bounds;
+  BoxF expected;
+  const TransformOperations from = MakeOperations(4, 45);
+  ASSERT_TRUE(to.BlendedBoundsForBox(box, from, -0.5f, 1.5f, &expected));
+  ASSERT_TRUE(cache.BlendedBoundsForBox(to, box, from, -0.5f, 1.5f, &bounds));
+  EXPECT_EQ(expected, bounds);
+  EXPECT_EQ(1u, cache.reused_count());
+
+  // Other progress ranges and boxes reuse nothing.
+  ASSERT_TRUE(to.BlendedBoundsForBox(box, from, 0, 1, &expected));
+  ASSERT_TRUE(cache.BlendedBoundsForBox(to, box, from, 0, 1, &bounds));
+  EXPECT_EQ(expected, bounds);
+  EXPECT_EQ(0u, cache.reused_count());
+  const BoxF other_box(0, 0, 0, 5, 5, 5);
+  ASSERT_TRUE(to.BlendedBoundsForBox(other_box, from, 0, 1, &expected));
+  ASSERT_TRUE(cache.BlendedBoundsForBox(to, other_box, from, 0, 1, &bounds));
+  EXPECT_EQ(expected, bounds);
+  EXPECT_EQ(0u, cache.reused_count());
+
+  ASSERT_TRUE(cache.BlendedBoundsForBox(to, other_box, from, 0, 1, &bounds));
+  EXPECT_EQ(expected, bounds);
+  EXPECT_EQ(3u, cache.reused_count());
+  cache.Clear();
+  ASSERT_TRUE(cache.BlendedBoundsForBox(to, other_box, from, 0, 1, &bounds));
+  EXPECT_EQ(expected, bounds);
+  EXPECT_EQ(0u, cache.reused_count());
+}
+
+TEST(BlendedBoundsCacheTest, IdentityAndMismatchedOperations) {
+  const BoxF box(1, 2, 3, 4, 5, 6);
+  const TransformOperations to = MakeOperations(10, 90);
+  BlendedBoundsCache cache;
+  BoxF expected;
+  BoxF bounds;
+
+  // Blending from identity.
+  const TransformOperations identity;
+  ASSERT_TRUE(to.BlendedBoundsForBox(box, identity, 0, 1, &expected));
+  ASSERT_TRUE(cache.BlendedBoundsForBox(to, box, identity, 0, 1, &bounds));
+  EXPECT_EQ(expected, bounds);
+  ASSERT_TRUE(cache.BlendedBoundsForBox(to, box, identity, 0, 1, &bounds));
+  EXPECT_EQ(expected, bounds);
+  EXPECT_EQ(3u, cache.reused_count());
+
+  ASSERT_TRUE(
+      cache.BlendedBoundsForBox(identity, box, identity, 0, 1, &bounds));
+  EXPECT_EQ(box, bounds);
+
+  TransformOperations mismatched;
+  mismatched.AppendSkewX(10);
+  EXPECT_FALSE(cache.BlendedBoundsForBox(to, box, mismatched, 0, 1, &bounds));
+}
+
+}  // namespace
+}  // namespace gfx
@@ -7,6 +7,7 @@
 
 #include <limits>
 
+#include "base/containers/span.h"
 #include "base/numerics/safe_conversions.h"
 
 namespace gfx {
@@ -34,6 +35,14 @@ constexpr float ClampFloatGeometry(T value) {
   return base::saturated_cast<float, FloatGeometrySaturationHandler, T>(value);
 }
 
+// ClampFloatGeometry() of each of |values| into |results|, which must have the
+// same size. This vectorizes, unlike a loop of the above.
+constexpr void ClampFloatGeometry(base::span<const double> values,
+                                  base::span<float> results) {
+  base::SaturatedCastSpan<float, FloatGeometrySaturationHandler, double>(
+      values, results);
+}
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_CLAMP_FLOAT_GEOMETRY_H_
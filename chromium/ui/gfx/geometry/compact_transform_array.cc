@@ -0,0 +1,50 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/compact_transform_array.h"
+
+#include "base/check_op.h"
+#include "base/numerics/safe_conversions.h"
+
+namespace gfx {
+
+CompactTransformArray::CompactTransformArray() = default;
+CompactTransformArray::CompactTransformArray(const CompactTransformArray&) =
+    default;
+CompactTransformArray::CompactTransformArray(CompactTransformArray&&) =
+    default;
+CompactTransformArray& CompactTransformArray::operator=(
+    const CompactTransformArray&) = default;
+CompactTransformArray& CompactTransformArray::operator=(
+    CompactTransformArray&&) = default;
+CompactTransformArray::~CompactTransformArray() = default;
+
+void CompactTransformArray::clear() {
+  bytes_.clear();
+  offsets_.clear();
+}
+
+void CompactTransformArray::push_back(const Transform& transform) {
+  const size_t offset = bytes_.size();
+  offsets_.push_back(base::checked_cast<uint32_t>(offset));
+  bytes_.resize(offset + GetSerializedTransformSize(transform));
+  base::SpanWriter writer{std::span(bytes_).subspan(offset)};
+  const bool written = WriteTransform(transform, writer);
+  CHECK(written);
+  DCHECK_EQ(writer.remaining(), 0u);
+}
+
+Transform CompactTransformArray::Get(size_t index) const {
+  base::SpanReader reader{std::span(bytes_).subspan(offsets_.at(index))};
+  std::optional<Transform> transform = ReadTransform(reader);
+  CHECK(transform);
+  return *transform;
+}
+
+size_t CompactTransformArray::EstimateMemoryUsage() const {
+  return bytes_.capacity() * sizeof(uint8_t) +
+         offsets_.capacity() * sizeof(uint32_t);
+}
+
+}  // namespace gfx
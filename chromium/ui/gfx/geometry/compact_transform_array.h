@@ -0,0 +1,79 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_COMPACT_TRANSFORM_ARRAY_H_
+#define UI_GFX_GEOMETRY_COMPACT_TRANSFORM_ARRAY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "base/check.h"
+#include "base/component_export.h"
+#include "base/numerics/span_reader_writer.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/transform_serialization.h"
+
+namespace gfx {
+
+// An append-only array of Transforms for long lists, e.g. those of display
+// lists, most of which are identity or translation transforms. Instead of a
+// whole Transform, each element is packed with the encoding of
+// transform_serialization.h: a tag byte for its kind and only the components
+// that it needs, so an identity takes 1 byte and a float translation 9 bytes,
+// plus a 4-byte offset for Get(). Get() and ForEach() return transforms equal
+// to the appended ones.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) CompactTransformArray {
+ public:
+  CompactTransformArray();
+  CompactTransformArray(const CompactTransformArray&);
+  CompactTransformArray(CompactTransformArray&&);
+  CompactTransformArray& operator=(const CompactTransformArray&);
+  CompactTransformArray& operator=(CompactTransformArray&&);
+  ~CompactTransformArray();
+
+  size_t size() const { return offsets_.size(); }
+  bool empty() const { return offsets_.empty(); }
+
+  // Reserves the offsets of |count| transforms. The packed storage isn't
+  // reserved, since its size depends on the kinds of transforms.
+  void reserve(size_t count) { offsets_.reserve(count); }
+  void clear();
+
+  void push_back(const Transform& transform);
+
+  // Returns the transform at |index|, which must be less than size().
+  Transform Get(size_t index) const;
+
+  // Calls |callback| with the index and the transform of each element in
+  // order. This reads the packed storage once, sequentially, without the
+  // offsets, so it's the cheapest way to visit all the elements.
+  template <typename Callback>
+  void ForEach(Callback callback) const {
+    base::SpanReader reader{std::span<const uint8_t>(bytes_)};
+    for (size_t i = 0; i < size(); ++i) {
+      std::optional<Transform> transform = ReadTransform(reader);
+      CHECK(transform);
+      callback(i, *transform);
+    }
+  }
+
+  // Returns the number of bytes allocated for the elements.
+  size_t EstimateMemoryUsage() const;
+
+ private:
+  friend class PublishedTransformArray;
+
+  // The encodings of the elements, one after the other.
+  std::vector<uint8_t> bytes_;
+  // The offset in |bytes_| of the encoding of each element.
+  std::vector<uint32_t> offsets_;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_COMPACT_TRANSFORM_ARRAY_H_
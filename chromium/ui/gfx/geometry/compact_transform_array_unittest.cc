@@ -0,0 +1,81 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/compact_transform_array.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+namespace {
+
+std::vector<Transform> MakeTransforms() {
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(100);
+  Transform rotation;
+  rotation.Rotate(30);
+  Transform rotation_3d;
+  rotation_3d.RotateAboutXAxis(30);
+  return {Transform(),
+          Transform::MakeTranslation(1.5f, -2),
+          Transform::MakeScale(2, 3),
+          Transform::MakeTranslation(0.1, 0.2),
+          rotation,
+          rotation_3d,
+          perspective,
+          Transform::MakeTranslation(-7, 8)};
+}
+
+TEST(CompactTransformArrayTest, GetAndForEach) {
+  const std::vector<Transform> transforms = MakeTransforms();
+  CompactTransformArray array;
+  EXPECT_TRUE(array.empty());
+  array.reserve(transforms.size());
+  for (const Transform& transform : transforms) {
+    array.push_back(transform);
+  }
+  ASSERT_EQ(transforms.size(), array.size());
+  EXPECT_FALSE(array.empty());
+
+  for (size_t i = 0; i < transforms.size(); ++i) {
+    EXPECT_EQ(transforms[i], array.Get(i)) << i;
+  }
+  size_t count = 0;
+  array.ForEach([&](size_t index, const Transform& transform) {
+    EXPECT_EQ(count, index);
+    EXPECT_EQ(transforms[index], transform) << index;
+    ++count;
+  });
+  EXPECT_EQ(transforms.size(), count);
+
+  const CompactTransformArray copy = array;
+  EXPECT_EQ(transforms.back(), copy.Get(copy.size() - 1));
+
+  array.clear();
+  EXPECT_TRUE(array.empty());
+  array.ForEach([](size_t, const Transform&) { ADD_FAILURE(); });
+}
+
+TEST(CompactTransformArrayTest, PacksCommonKinds) {
+  constexpr size_t kCount = 1000;
+  CompactTransformArray array;
+  array.reserve(kCount);
+  for (size_t i = 0; i < kCount; ++i) {
+    array.push_back(i % 2 ? Transform() : Transform::MakeTranslation(i, 1));
+  }
+  // 1 byte for each identity and 9 for each translation of floats, plus the
+  // offsets, rounded up to the growth of the storage.
+  EXPECT_LT(array.EstimateMemoryUsage(),
+            2 * (kCount / 2) * (1 + 9) + kCount * sizeof(uint32_t));
+  EXPECT_LT(array.EstimateMemoryUsage(), kCount * sizeof(Transform) / 4);
+  EXPECT_EQ(Transform::MakeTranslation(998, 1), array.Get(998));
+  EXPECT_EQ(Transform(), array.Get(999));
+}
+
+}  // namespace
+}  // namespace gfx
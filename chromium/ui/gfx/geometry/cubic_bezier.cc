@@ -10,6 +10,8 @@
 #include <limits>
 
 #include "base/check_op.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 
 namespace gfx {
 
@@ -17,6 +19,51 @@ namespace {
 
 const int kMaxNewtonIterations = 4;
 
+void ComputeEndGradients(double p1x,
+                         double p1y,
+                         double p2x,
+                         double p2y,
+                         double& start_gradient,
+                         double& end_gradient) {
+  // End-point gradients are used to calculate timing function results
+  // outside the range [0, 1].
+  //
+  // There are four possibilities for the gradient at each end:
+  // (1) the closest control point is not horizontally coincident with regard to
+  //     (0, 0) or (1, 1). In this case the line between the end point and
+  //     the control point is tangent to the bezier at the end point.
+  // (2) the closest control point is coincident with the end point. In
+  //     this case the line between the end point and the far control
+  //     point is tangent to the bezier at the end point.
+  // (3) both internal control points are coincident with an endpoint. There
+  //     are two special case that fall into this category:
+  //     CubicBezier(0, 0, 0, 0) and CubicBezier(1, 1, 1, 1). Both are
+  //     equivalent to linear.
+  // (4) the closest control point is horizontally coincident with the end
+  //     point, but vertically distinct. In this case the gradient at the
+  //     end point is Infinite. However, this causes issues when
+  //     interpolating. As a result, we break down to a simple case of
+  //     0 gradient under these conditions.
+
+  if (p1x > 0)
+    start_gradient = p1y / p1x;
+  else if (!p1y && p2x > 0)
+    start_gradient = p2y / p2x;
+  else if (!p1y && !p2y)
+    start_gradient = 1;
+  else
+    start_gradient = 0;
+
+  if (p2x < 1)
+    end_gradient = (p2y - 1) / (p2x - 1);
+  else if (p2y == 1 && p1x < 1)
+    end_gradient = (p1y - 1) / (p1x - 1);
+  else if (p2y == 1 && p1y == 1)
+    end_gradient = 1;
+  else
+    end_gradient = 0;
+}
+
 }  // namespace
 
 static const double kBezierEpsilon = 1e-7;
@@ -67,43 +114,7 @@ void CubicBezier::InitGradients(double p1x,
                                 double p1y,
                                 double p2x,
                                 double p2y) {
-  // End-point gradients are used to calculate timing function results
-  // outside the range [0, 1].
-  //
-  // There are four possibilities for the gradient at each end:
-  // (1) the closest control point is not horizontally coincident with regard to
-  //     (0, 0) or (1, 1). In this case the line between the end point and
-  //     the control point is tangent to the bezier at the end point.
-  // (2) the closest control point is coincident with the end point. In
-  //     this case the line between the end point and the far control
-  //     point is tangent to the bezier at the end point.
-  // (3) both internal control points are coincident with an endpoint. There
-  //     are two special case that fall into this category:
-  //     CubicBezier(0, 0, 0, 0) and CubicBezier(1, 1, 1, 1). Both are
-  //     equivalent to linear.
-  // (4) the closest control point is horizontally coincident with the end
-  //     point, but vertically distinct. In this case the gradient at the
-  //     end point is Infinite. However, this causes issues when
-  //     interpolating. As a result, we break down to a simple case of
-  //     0 gradient under these conditions.
-
-  if (p1x > 0)
-    start_gradient_ = p1y / p1x;
-  else if (!p1y && p2x > 0)
-    start_gradient_ = p2y / p2x;
-  else if (!p1y && !p2y)
-    start_gradient_ = 1;
-  else
-    start_gradient_ = 0;
-
-  if (p2x < 1)
-    end_gradient_ = (p2y - 1) / (p2x - 1);
-  else if (p2y == 1 && p1x < 1)
-    end_gradient_ = (p1y - 1) / (p1x - 1);
-  else if (p2y == 1 && p1y == 1)
-    end_gradient_ = 1;
-  else
-    end_gradient_ = 0;
+  ComputeEndGradients(p1x, p1y, p2x, p2y, start_gradient_, end_gradient_);
 }
 
 // This works by taking taking the derivative of the cubic bezier, on the y
@@ -178,13 +189,26 @@ double CubicBezier::GetDefaultEpsilon() {
   return kBezierEpsilon;
 }
 
+double CubicBezier::InitialGuess(double x, double& t0, double& t1) const {
+  // Linear interpolation of spline curve for initial guess.
+  double delta_t = 1.0 / (CUBIC_BEZIER_SPLINE_SAMPLES - 1);
+  for (int i = 1; i < CUBIC_BEZIER_SPLINE_SAMPLES; i++) {
+    if (x <= spline_samples_[i]) {
+      t1 = delta_t * i;
+      t0 = t1 - delta_t;
+      return t0 + (t1 - t0) * (x - spline_samples_[i - 1]) /
+                      (spline_samples_[i] - spline_samples_[i - 1]);
+    }
+  }
+  return x;
+}
+
 double CubicBezier::SolveCurveX(double x, double epsilon) const {
   DCHECK_GE(x, 0.0);
   DCHECK_LE(x, 1.0);
 
   double t0;
   double t1;
-  double t2 = x;
   double x2;
   double d2;
   int i;
@@ -193,17 +217,7 @@ double CubicBezier::SolveCurveX(double x, double epsilon) const {
   DCHECK(monotonically_increasing_);
 #endif
 
-  // Linear interpolation of spline curve for initial guess.
-  double delta_t = 1.0 / (CUBIC_BEZIER_SPLINE_SAMPLES - 1);
-  for (i = 1; i < CUBIC_BEZIER_SPLINE_SAMPLES; i++) {
-    if (x <= spline_samples_[i]) {
-      t1 = delta_t * i;
-      t0 = t1 - delta_t;
-      t2 = t0 + (t1 - t0) * (x - spline_samples_[i - 1]) /
-                    (spline_samples_[i] - spline_samples_[i - 1]);
-      break;
-    }
-  }
+  double t2 = InitialGuess(x, t0, t1);
 
   // Perform a few iterations of Newton's method -- normally very fast.
   // See https://en.wikipedia.org/wiki/Newton%27s_method.
@@ -240,6 +254,87 @@ double CubicBezier::Solve(double x) const {
   return SolveWithEpsilon(x, kBezierEpsilon);
 }
 
+CubicBezier::Solver::Solver(const CubicBezier& bezier) : bezier_(bezier) {}
+
+CubicBezier::Solver::Solver(const Solver& other) = default;
+
+CubicBezier::Solver::~Solver() = default;
+
+double CubicBezier::Solver::Solve(double x) {
+  if (x < 0.0 || x > 1.0)
+    return bezier_.Solve(x);
+
+  // The same Newton iterations as SolveCurveX(), from the last parameter.
+  double t = last_t_;
+  for (int i = 0; t >= 0.0 && t <= 1.0 && i < kMaxNewtonIterations; i++) {
+    double x2 = bezier_.SampleCurveX(t) - x;
+    if (fabs(x2) < kBezierEpsilon) {
+      last_t_ = t;
+      return bezier_.SampleCurveY(t);
+    }
+    double d2 = bezier_.SampleCurveDerivativeX(t);
+    if (fabs(d2) < kBezierEpsilon)
+      break;
+    t = t - x2 / d2;
+  }
+
+  last_t_ = bezier_.SolveCurveX(x, kBezierEpsilon);
+  return bezier_.SampleCurveY(last_t_);
+}
+
+void CubicBezier::SolveMany(base::span<const double> x,
+                            base::span<double> y) const {
+  CheckBatchSpans(x, y);
+
+  size_t i = 0;
+  for (; i + 4 <= x.size(); i += 4) {
+    Double4 x4 = LoadDouble4(x.subspan(i, 4u).data());
+    if (!AllTrue((x4 >= 0.0) & (x4 <= 1.0))) {
+      // Outside [0, 1], or NaN. Fall back to the gradients.
+      for (size_t j = i; j < i + 4; ++j) {
+        y[j] = Solve(x[j]);
+      }
+      continue;
+    }
+
+#ifndef NDEBUG
+    DCHECK(monotonically_increasing_);
+#endif
+
+    double t0;
+    double t1;
+    Double4 t2 = {InitialGuess(x4[0], t0, t1), InitialGuess(x4[1], t0, t1),
+                  InitialGuess(x4[2], t0, t1), InitialGuess(x4[3], t0, t1)};
+
+    // The same Newton iterations as SolveCurveX(), in each lane until it
+    // converges or the derivative vanishes.
+    DoubleBoolean4 active = {-1, -1, -1, -1};
+    DoubleBoolean4 converged = {0, 0, 0, 0};
+    for (int n = 0; n < kMaxNewtonIterations; n++) {
+      Double4 x2 = ((ax_ * t2 + bx_) * t2 + cx_) * t2 - x4;
+      Double4 abs_x2 = x2 < 0 ? -x2 : x2;
+      converged |= active & (abs_x2 < kBezierEpsilon);
+      active &= ~converged;
+      Double4 d2 = (3.0 * ax_ * t2 + 2.0 * bx_) * t2 + cx_;
+      Double4 abs_d2 = d2 < 0 ? -d2 : d2;
+      active &= ~(abs_d2 < kBezierEpsilon);
+      if (!(active[0] | active[1] | active[2] | active[3])) {
+        break;
+      }
+      t2 = active ? t2 - x2 / d2 : t2;
+    }
+
+    // With the default epsilon, SolveCurveX() only returns after the Newton
+    // iterations if they converged. Other lanes need the bisection.
+    for (size_t j = 0; j < 4; ++j) {
+      y[i + j] = converged[j] ? SampleCurveY(t2[j]) : Solve(x4[j]);
+    }
+  }
+  for (; i < x.size(); ++i) {
+    y[i] = Solve(x[i]);
+  }
+}
+
 double CubicBezier::SlopeWithEpsilon(double x, double epsilon) const {
   x = std::clamp(x, 0.0, 1.0);
   double t = SolveCurveX(x, epsilon);
@@ -272,4 +367,148 @@ double CubicBezier::GetY2() const {
   return (by_ + cy_) / 3.0 + GetY1();
 }
 
+CubicBezierLUT::CubicBezierLUT(const CubicBezier& bezier,
+                               size_t size,
+                               Interpolation interpolation)
+    : bezier_(bezier), interpolation_(interpolation) {
+  CHECK_GE(size, 2u);
+  values_.resize(size);
+  double delta_x = 1.0 / (size - 1);
+  for (size_t i = 0; i < size; ++i) {
+    values_[i] = bezier_.Solve(i * delta_x);
+  }
+  if (interpolation_ == Interpolation::kCubicHermite) {
+    slopes_.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+      // Near-vertical tangents would make the splines overshoot wildly, so
+      // limit the slopes to three times the adjacent secant slopes, as in
+      // Fritsch-Carlson monotone interpolation.
+      double secant = 0;
+      if (i > 0) {
+        secant = std::abs(values_[i] - values_[i - 1]) / delta_x;
+      }
+      if (i + 1 < size) {
+        secant = std::max(secant,
+                          std::abs(values_[i + 1] - values_[i]) / delta_x);
+      }
+      slopes_[i] = std::clamp(bezier_.Slope(i * delta_x), -3 * secant,
+                              3 * secant);
+    }
+  }
+}
+
+CubicBezierLUT::CubicBezierLUT(const CubicBezierLUT& other) = default;
+
+CubicBezierLUT::~CubicBezierLUT() = default;
+
+double CubicBezierLUT::Solve(double x) const {
+  if (!(x >= 0.0 && x <= 1.0)) {
+    return bezier_.Solve(x);
+  }
+
+  double position = x * (values_.size() - 1);
+  size_t i = std::min(static_cast<size_t>(position), values_.size() - 2);
+  double s = position - i;
+  double y0 = values_[i];
+  double y1 = values_[i + 1];
+  if (interpolation_ == Interpolation::kLinear) {
+    return y0 + (y1 - y0) * s;
+  }
+
+  // The Hermite basis functions, with the slopes scaled from dy/dx to the
+  // interval of the table.
+  double delta_x = 1.0 / (values_.size() - 1);
+  double s2 = s * s;
+  double s3 = s2 * s;
+  double h00 = 2 * s3 - 3 * s2 + 1;
+  double h10 = s3 - 2 * s2 + s;
+  double h01 = -2 * s3 + 3 * s2;
+  double h11 = s3 - s2;
+  return h00 * y0 + h10 * delta_x * slopes_[i] + h01 * y1 +
+         h11 * delta_x * slopes_[i + 1];
+}
+
+double CubicBezierLUT::MaxError(double epsilon,
+                                size_t samples_per_interval) const {
+  DCHECK_GT(samples_per_interval, 0u);
+  size_t samples = (values_.size() - 1) * samples_per_interval;
+  double max_error = 0;
+  for (size_t i = 0; i <= samples; ++i) {
+    double x = static_cast<double>(i) / samples;
+    max_error = std::max(
+        max_error, std::abs(Solve(x) - bezier_.SolveWithEpsilon(x, epsilon)));
+  }
+  return max_error;
+}
+
+CompactCubicBezier::CompactCubicBezier(double p1x,
+                                       double p1y,
+                                       double p2x,
+                                       double p2y)
+    : p1x_(p1x), p1y_(p1y), p2x_(p2x), p2y_(p2y) {}
+
+double CompactCubicBezier::Solve(double x) const {
+  return SolveWithEpsilon(x, kBezierEpsilon);
+}
+
+double CompactCubicBezier::SolveWithEpsilon(double x, double epsilon) const {
+  const double p1x = p1x_;
+  const double p1y = p1y_;
+  const double p2x = p2x_;
+  const double p2y = p2y_;
+  if (x < 0.0 || x > 1.0) {
+    double start_gradient;
+    double end_gradient;
+    ComputeEndGradients(p1x, p1y, p2x, p2y, start_gradient, end_gradient);
+    if (x < 0.0)
+      return CubicBezier::ToFinite(0.0 + start_gradient * x);
+    return CubicBezier::ToFinite(1.0 + end_gradient * (x - 1.0));
+  }
+
+  // The coefficients, as in CubicBezier::InitCoefficients().
+  const double cx = 3.0 * p1x;
+  const double bx = 3.0 * (p2x - p1x) - cx;
+  const double ax = 1.0 - cx - bx;
+  const double cy = 3.0 * p1y;
+  const double by = 3.0 * (p2y - p1y) - cy;
+  const double ay = 1.0 - cy - by;
+  const auto sample_x = [&](double t) { return ((ax * t + bx) * t + cx) * t; };
+  const auto sample_y = [&](double t) {
+    return CubicBezier::ToFinite(((ay * t + by) * t + cy) * t);
+  };
+
+  // Newton's method, starting from t = x since there are no spline samples.
+  // More iterations than CubicBezier::SolveCurveX() make up for the worse
+  // initial guess.
+  double newton_epsilon = std::min(kBezierEpsilon, epsilon);
+  double t = x;
+  for (int i = 0; i < 2 * kMaxNewtonIterations; i++) {
+    double x2 = sample_x(t) - x;
+    if (fabs(x2) < newton_epsilon)
+      return sample_y(t);
+    double d2 = (3.0 * ax * t + 2.0 * bx) * t + cx;
+    if (fabs(d2) < kBezierEpsilon)
+      break;
+    t = t - x2 / d2;
+    if (!(t >= 0.0 && t <= 1.0))
+      break;
+  }
+
+  // Fall back to the bisection method for reliability.
+  double t0 = 0.0;
+  double t1 = 1.0;
+  t = x;
+  while (t0 < t1) {
+    double x2 = sample_x(t);
+    if (fabs(x2 - x) < epsilon)
+      break;
+    if (x > x2)
+      t0 = t;
+    else
+      t1 = t;
+    t = (t1 + t0) * .5;
+  }
+  return sample_y(t);
+}
+
 }  // namespace gfx
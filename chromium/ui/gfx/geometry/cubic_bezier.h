@@ -6,8 +6,10 @@
 #define UI_GFX_GEOMETRY_CUBIC_BEZIER_H_
 
 #include <array>
+#include <vector>
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 
 namespace gfx {
 
@@ -15,6 +17,9 @@ namespace gfx {
 
 class COMPONENT_EXPORT(GEOMETRY) CubicBezier {
  public:
+  // Defined below, since it holds a CubicBezier.
+  class Solver;
+
   CubicBezier(double p1x, double p1y, double p2x, double p2y);
   CubicBezier(const CubicBezier& other);
 
@@ -49,6 +54,9 @@ class COMPONENT_EXPORT(GEOMETRY) CubicBezier {
 
   // Evaluates y at the given x with default epsilon.
   double Solve(double x) const;
+  // Sets each y[i] to Solve(x[i]), with the same result. The Newton
+  // iterations of SolveCurveX() run on several x values at once.
+  void SolveMany(base::span<const double> x, base::span<double> y) const;
   // Evaluates y at the given x. The epsilon parameter provides a hint as to the
   // required accuracy and is not guaranteed. Uses gradients if x is
   // out of [0, 1] range.
@@ -79,10 +87,15 @@ class COMPONENT_EXPORT(GEOMETRY) CubicBezier {
   double range_max() const { return range_max_; }
 
  private:
+  friend class CompactCubicBezier;
+
   void InitCoefficients(double p1x, double p1y, double p2x, double p2y);
   void InitGradients(double p1x, double p1y, double p2x, double p2y);
   void InitRange(double p1y, double p2y);
   void InitSpline();
+  // Computes the initial guess of SolveCurveX() from the spline samples. Sets
+  // |t0| and |t1| to the parameters of the samples around |x|, if any.
+  double InitialGuess(double x, double& t0, double& t1) const;
   static double ToFinite(double value);
 
   double ax_;
@@ -108,6 +121,101 @@ class COMPONENT_EXPORT(GEOMETRY) CubicBezier {
 #endif
 };
 
+// Solves a curve at a sequence of x, such as the progress of an animation
+// on successive frames. Newton's method starts from the parameter of the
+// last x, which is usually close enough to converge in one step, and falls
+// back to SolveCurveX() when it doesn't converge.
+class COMPONENT_EXPORT(GEOMETRY) CubicBezier::Solver {
+ public:
+  explicit Solver(const CubicBezier& bezier);
+  Solver(const Solver& other);
+  ~Solver();
+
+  Solver& operator=(const Solver&) = delete;
+
+  // Returns bezier().Solve(x), up to the default epsilon of the solver.
+  double Solve(double x);
+
+  const CubicBezier& bezier() const { return bezier_; }
+
+ private:
+  const CubicBezier bezier_;
+  // The parameter of the last x in [0, 1], or a negative value if there
+  // hasn't been one.
+  double last_t_ = -1;
+};
+
+// The same curve as CubicBezier, but stored as its control points in floats
+// instead of the coefficients, gradients, range and spline samples, for holding
+// many curves. The solver expands them to coefficients in double precision on
+// each call, and starts from t = x instead of the spline samples, so it takes
+// a few more iterations.
+class COMPONENT_EXPORT(GEOMETRY) CompactCubicBezier {
+ public:
+  CompactCubicBezier(double p1x, double p1y, double p2x, double p2y);
+
+  // Same as CubicBezier::Solve() and CubicBezier::SolveWithEpsilon(), for the
+  // control points rounded to floats.
+  double Solve(double x) const;
+  double SolveWithEpsilon(double x, double epsilon) const;
+
+  double GetX1() const { return p1x_; }
+  double GetY1() const { return p1y_; }
+  double GetX2() const { return p2x_; }
+  double GetY2() const { return p2y_; }
+
+ private:
+  float p1x_;
+  float p1y_;
+  float p2x_;
+  float p2y_;
+};
+
+// A table of the values of a CubicBezier at evenly spaced x in [0, 1], which
+// is cheaper to evaluate than solving the curve, at the cost of a bounded
+// error. Useful for easing curves that are evaluated for many elements every
+// frame.
+class COMPONENT_EXPORT(GEOMETRY) CubicBezierLUT {
+ public:
+  enum class Interpolation {
+    // Linearly interpolates between the table entries.
+    kLinear,
+    // Also stores the slope of the curve at each entry, and interpolates with
+    // cubic Hermite splines. Much more accurate for the same size.
+    kCubicHermite,
+  };
+
+  // |size| is the number of entries, which must be at least 2.
+  CubicBezierLUT(const CubicBezier& bezier,
+                 size_t size,
+                 Interpolation interpolation);
+  CubicBezierLUT(const CubicBezierLUT& other);
+  ~CubicBezierLUT();
+
+  CubicBezierLUT& operator=(const CubicBezierLUT&) = delete;
+
+  // Approximates bezier().Solve(x). Outside [0, 1], the result is exact
+  // since the curve is extended by its end gradients.
+  double Solve(double x) const;
+
+  // Returns the largest difference between Solve() and
+  // bezier().SolveWithEpsilon(x, epsilon) at |samples_per_interval| evenly
+  // spaced x in each interval of the table.
+  double MaxError(double epsilon = CubicBezier::GetDefaultEpsilon(),
+                  size_t samples_per_interval = 8) const;
+
+  const CubicBezier& bezier() const { return bezier_; }
+  size_t size() const { return values_.size(); }
+  Interpolation interpolation() const { return interpolation_; }
+
+ private:
+  const CubicBezier bezier_;
+  const Interpolation interpolation_;
+  std::vector<double> values_;
+  // Only for kCubicHermite.
+  std::vector<double> slopes_;
+};
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_CUBIC_BEZIER_H_
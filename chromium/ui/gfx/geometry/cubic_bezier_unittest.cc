@@ -4,10 +4,13 @@
 
 #include "ui/gfx/geometry/cubic_bezier.h"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
+#include <vector>
 
 #include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/test/geometry_edge_cases.h"
 
 namespace gfx {
 namespace {
@@ -325,5 +328,125 @@ TEST(CubicBezierTest, ControlPointsOutsideUnitSquare) {
   validateSolver(CubicBezier(0, 4, 1, -3));
 }
 
+TEST(CubicBezierTest, SolveMany) {
+  const CubicBezier curves[] = {
+      CubicBezier(0.25, 0.1, 0.25, 1), CubicBezier(0.42, 0, 0.58, 1),
+      CubicBezier(0.0, 0.0, 0.0, 0.0), CubicBezier(0.4, -0.8, 0.7, 1.7),
+      CubicBezier(1, 0, 0, 1),         CubicBezier(0, 4, 1, -3)};
+  std::vector<double> x;
+  for (int i = -10; i <= 110; ++i) {
+    x.push_back(i / 100.0);
+  }
+  // Leave a partial batch at the end.
+  x.push_back(0.123);
+  x.push_back(0.999);
+
+  for (const CubicBezier& curve : curves) {
+    std::vector<double> y(x.size());
+    curve.SolveMany(x, y);
+    for (size_t i = 0; i < x.size(); ++i) {
+      EXPECT_EQ(curve.Solve(x[i]), y[i]) << x[i];
+    }
+  }
+}
+
+TEST(CubicBezierTest, Solver) {
+  const CubicBezier curves[] = {
+      CubicBezier(0.25, 0.1, 0.25, 1), CubicBezier(0.42, 0, 0.58, 1),
+      CubicBezier(0.0, 0.0, 0.0, 0.0), CubicBezier(0.4, -0.8, 0.7, 1.7),
+      CubicBezier(1, 0, 0, 1),         CubicBezier(0, 4, 1, -3)};
+  for (const CubicBezier& curve : curves) {
+    CubicBezier::Solver solver(curve);
+    // Increasing x, as on successive frames.
+    for (int i = -10; i <= 110; ++i) {
+      double x = i / 100.0;
+      EXPECT_NEAR(curve.Solve(x), solver.Solve(x), 1e-5) << x;
+    }
+    // Jumps back and across the curve.
+    for (double x : {0.0, 0.9, 0.1, 0.5, 0.5, 1.0, 0.0}) {
+      EXPECT_NEAR(curve.Solve(x), solver.Solve(x), 1e-5) << x;
+    }
+  }
+}
+
+TEST(CubicBezierTest, LookupTable) {
+  CubicBezier ease(0.25, 0.1, 0.25, 1);
+  CubicBezierLUT linear(ease, 65, CubicBezierLUT::Interpolation::kLinear);
+  CubicBezierLUT hermite(ease, 65,
+                         CubicBezierLUT::Interpolation::kCubicHermite);
+
+  // The table entries and the values outside [0, 1] are exact.
+  for (double x : {-0.5, 0.0, 0.25, 0.5, 1.0, 1.5}) {
+    EXPECT_EQ(ease.Solve(x), linear.Solve(x)) << x;
+    EXPECT_EQ(ease.Solve(x), hermite.Solve(x)) << x;
+  }
+
+  EXPECT_LT(linear.MaxError(), 1e-3);
+  EXPECT_LT(hermite.MaxError(), 1e-5);
+  EXPECT_LT(hermite.MaxError(), linear.MaxError());
+
+  // The reported error bounds the error at other points, approximately.
+  double max_error = 0;
+  for (int i = 0; i <= 1000; ++i) {
+    double x = i / 1000.0;
+    max_error = std::max(max_error, std::abs(hermite.Solve(x) - ease.Solve(x)));
+  }
+  EXPECT_LE(max_error, 2 * hermite.MaxError());
+
+  // A copy has the same table.
+  CubicBezierLUT copy(hermite);
+  EXPECT_EQ(hermite.Solve(0.3), copy.Solve(0.3));
+
+  // Curves with vertical tangents still have a bounded error.
+  CubicBezier steep(0, 1, 1, 0);
+  CubicBezierLUT steep_hermite(steep, 129,
+                               CubicBezierLUT::Interpolation::kCubicHermite);
+  EXPECT_LT(steep_hermite.MaxError(), 2e-2);
+}
+
+TEST(CubicBezierTest, Compact) {
+  EXPECT_LE(4 * sizeof(CompactCubicBezier), sizeof(CubicBezier));
+
+  // Control points that are exact in floats, so that the curves are the same.
+  const double control_points[][4] = {
+      {0.25, 0.1, 0.25, 1}, {0.42, 0, 0.58, 1}, {0, 0, 0, 0},
+      {0.4, -0.8, 0.7, 1.7}, {1, 0, 0, 1},      {0, 4, 1, -3},
+      {0, 1, 1, 0}};
+  for (const auto& p : control_points) {
+    CubicBezier curve(p[0], p[1], p[2], p[3]);
+    CompactCubicBezier compact(p[0], p[1], p[2], p[3]);
+    EXPECT_EQ(static_cast<float>(p[0]), compact.GetX1());
+    EXPECT_EQ(static_cast<float>(p[3]), compact.GetY2());
+    for (int i = -20; i <= 120; ++i) {
+      double x = i / 100.0;
+      EXPECT_NEAR(curve.Solve(x), compact.Solve(x), 1e-5) << x;
+      EXPECT_NEAR(curve.SolveWithEpsilon(x, 1e-3),
+                  compact.SolveWithEpsilon(x, 1e-3), 1e-2)
+          << x;
+    }
+  }
+}
+
+TEST(CubicBezierTest, EdgeCases) {
+  for (const CubicBezierEdgeCase& edge_case : GetCubicBezierEdgeCases()) {
+    SCOPED_TRACE(edge_case.name);
+    CubicBezier curve(edge_case.x1, edge_case.y1, edge_case.x2, edge_case.y2);
+    CubicBezier::Solver solver(curve);
+    std::vector<double> x;
+    for (int i = 0; i <= 100; ++i) {
+      x.push_back(i / 100.0);
+    }
+    std::vector<double> y(x.size());
+    curve.SolveMany(x, y);
+    for (size_t i = 0; i < x.size(); ++i) {
+      EXPECT_TRUE(std::isfinite(y[i])) << x[i];
+      EXPECT_EQ(curve.Solve(x[i]), y[i]) << x[i];
+      EXPECT_NEAR(y[i], solver.Solve(x[i]),
+                  1e-5 * std::max(1.0, std::abs(y[i])))
+          << x[i];
+    }
+  }
+}
+
 }  // namespace
 }  // namespace gfx
@@ -8,6 +8,7 @@
 #include <array>
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "base/dcheck_is_on.h"
 #include "ui/gfx/geometry/quaternion.h"
 
@@ -25,6 +26,22 @@ struct COMPONENT_EXPORT(GEOMETRY) DecomposedTransform {
   Quaternion quaternion;
 
   std::string ToString() const;
+
+  friend bool operator==(const DecomposedTransform&,
+                         const DecomposedTransform&) = default;
+};
+
+// The components of many DecomposedTransforms in structure-of-arrays form:
+// element i of each span belongs to the i-th transform. Used by
+// Transform::ComposeMany(). All spans must have the same size.
+struct DecomposedTransformSpans {
+  size_t size() const { return translate.size(); }
+
+  base::span<const std::array<double, 3u>> translate;
+  base::span<const std::array<double, 3u>> scale;
+  base::span<const std::array<double, 3u>> skew;
+  base::span<const std::array<double, 4u>> perspective;
+  base::span<const Quaternion> quaternion;
 };
 
 // This is declared here for use in gtest-based unit tests but is defined in
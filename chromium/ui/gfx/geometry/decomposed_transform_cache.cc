@@ -0,0 +1,130 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/decomposed_transform_cache.h"
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+#include "base/no_destructor.h"
+#include "base/trace_event/typed_macros.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+namespace {
+
+// Keys are compared by bits, so that e.g. 0 and -0, which may decompose
+// differently, are different keys.
+bool BitwiseEqual(const std::array<double, 16>& a,
+                  const std::array<double, 16>& b) {
+  for (size_t i = 0; i < 16; ++i) {
+    if (std::bit_cast<uint64_t>(a[i]) != std::bit_cast<uint64_t>(b[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t GetSlot(const std::array<double, 16>& matrix) {
+  uint64_t hash = 0;
+  for (double d : matrix) {
+    hash = (hash ^ std::bit_cast<uint64_t>(d)) * 0x9e3779b97f4a7c15ull;
+  }
+  return (hash >> 32) % DecomposedTransformCache::kCapacity;
+}
+
+// Returns why Transform::Decompose() fails for |transform|: either the
+// perspective can't be normalized, as w is 0 at the origin, or the transform
+// is singular.
+const char* GetDecompositionFailureReason(const Transform& transform) {
+  return std::isnormal(transform.rc(3, 3)) ? "singular" : "perspective";
+}
+
+}  // namespace
+
+// static
+DecomposedTransformCache& DecomposedTransformCache::GetInstance() {
+  static base::NoDestructor<DecomposedTransformCache> instance;
+  return *instance;
+}
+
+DecomposedTransformCache::DecomposedTransformCache() = default;
+DecomposedTransformCache::~DecomposedTransformCache() = default;
+
+std::optional<DecomposedTransform> DecomposedTransformCache::Decompose(
+    const Transform& transform) {
+  std::optional<DecomposedTransform> decomp = LookUpOrDecompose(transform);
+  if (!decomp) [[unlikely]] {
+    size_t failure_count;
+    {
+      base::AutoLock lock(lock_);
+      failure_count = ++failure_count_;
+    }
+    TRACE_EVENT_INSTANT("cc", "TransformDecompositionFailed", "reason",
+                        GetDecompositionFailureReason(transform), "transform",
+                        transform.ToString());
+    TRACE_COUNTER("cc", "TransformDecompositionFailures", failure_count);
+  }
+  return decomp;
+}
+
+std::optional<DecomposedTransform> DecomposedTransformCache::LookUpOrDecompose(
+    const Transform& transform) {
+  if (transform.representation_ == Transform::kAxis2d) [[likely]] {
+    return transform.Decompose();
+  }
+
+  std::array<double, 16> matrix;
+  transform.GetColMajor(matrix);
+  size_t slot = GetSlot(matrix);
+  {
+    base::AutoLock lock(lock_);
+    const Entry& entry = entries_[slot];
+    if (entry.valid && BitwiseEqual(entry.matrix, matrix)) {
+      ++hit_count_;
+      return entry.decomp;
+    }
+    ++miss_count_;
+  }
+
+  // Decompose without holding the lock.
+  std::optional<DecomposedTransform> decomp = transform.Decompose();
+
+  base::AutoLock lock(lock_);
+  Entry& entry = entries_[slot];
+  entry.valid = true;
+  entry.matrix = matrix;
+  entry.decomp = decomp;
+  return decomp;
+}
+
+size_t DecomposedTransformCache::hit_count() const {
+  base::AutoLock lock(lock_);
+  return hit_count_;
+}
+
+size_t DecomposedTransformCache::miss_count() const {
+  base::AutoLock lock(lock_);
+  return miss_count_;
+}
+
+size_t DecomposedTransformCache::failure_count() const {
+  base::AutoLock lock(lock_);
+  return failure_count_;
+}
+
+void DecomposedTransformCache::Clear() {
+  base::AutoLock lock(lock_);
+  for (Entry& entry : entries_) {
+    entry.valid = false;
+    entry.decomp.reset();
+  }
+  hit_count_ = 0;
+  miss_count_ = 0;
+  failure_count_ = 0;
+}
+
+}  // namespace gfx
@@ -0,0 +1,81 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_DECOMPOSED_TRANSFORM_CACHE_H_
+#define UI_GFX_GEOMETRY_DECOMPOSED_TRANSFORM_CACHE_H_
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "base/component_export.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "ui/gfx/geometry/decomposed_transform.h"
+
+namespace gfx {
+
+class Transform;
+
+// A bounded, process-wide cache of Transform::Decompose() results, keyed by
+// the exact matrix content. It's used by Transform::Blend() and
+// Transform::Accumulate(), whose endpoints usually stay the same for every
+// frame of an animation.
+//
+// Only full matrices are cached. Transforms stored as AxisTransform2d are
+// cheap to decompose and bypass the cache.
+//
+// The cache is direct-mapped: a new entry replaces the one with the same
+// slot, so the memory use is fixed. It's thread-safe.
+//
+// As every interpolation of transforms by decomposition goes through the
+// cache, it also emits a trace event for each transform that can't be
+// decomposed, after which the interpolation falls back to a discrete one,
+// with the reason ("singular" or "perspective"), and a counter of them.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) DecomposedTransformCache {
+ public:
+  static constexpr size_t kCapacity = 64;
+
+  static DecomposedTransformCache& GetInstance();
+
+  DecomposedTransformCache();
+  DecomposedTransformCache(const DecomposedTransformCache&) = delete;
+  DecomposedTransformCache& operator=(const DecomposedTransformCache&) = delete;
+  ~DecomposedTransformCache();
+
+  // Returns the same as transform.Decompose().
+  std::optional<DecomposedTransform> Decompose(const Transform& transform);
+
+  // The number of lookups of full matrices that were found or not found in
+  // the cache.
+  size_t hit_count() const;
+  size_t miss_count() const;
+
+  // The number of calls to Decompose() that failed, whether the transform
+  // was found in the cache or not.
+  size_t failure_count() const;
+
+  // Removes all entries and resets the counters.
+  void Clear();
+
+ private:
+  struct Entry {
+    bool valid = false;
+    std::array<double, 16> matrix;
+    std::optional<DecomposedTransform> decomp;
+  };
+
+  std::optional<DecomposedTransform> LookUpOrDecompose(
+      const Transform& transform);
+
+  mutable base::Lock lock_;
+  std::array<Entry, kCapacity> entries_ GUARDED_BY(lock_);
+  size_t hit_count_ GUARDED_BY(lock_) = 0;
+  size_t miss_count_ GUARDED_BY(lock_) = 0;
+  size_t failure_count_ GUARDED_BY(lock_) = 0;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_DECOMPOSED_TRANSFORM_CACHE_H_
@@ -0,0 +1,91 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/decomposed_transform_cache.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/vector3d_f.h"
+
+namespace gfx {
+
+namespace {
+
+Transform GetTestTransform(double degrees) {
+  Transform transform;
+  transform.Translate3d(1, 2, 3);
+  transform.RotateAbout(Vector3dF(4, 5, 6), degrees);
+  transform.Scale3d(7, 8, 9);
+  return transform;
+}
+
+TEST(DecomposedTransformCacheTest, Decompose) {
+  DecomposedTransformCache cache;
+  Transform singular = Transform::MakeScale(0, 1);
+  singular.EnsureFullMatrixForTesting();
+  for (const Transform& transform :
+       {GetTestTransform(30), GetTestTransform(60), singular}) {
+    SCOPED_TRACE(transform.ToString());
+    // Query twice to exercise both a miss and a hit.
+    EXPECT_EQ(transform.Decompose(), cache.Decompose(transform));
+    EXPECT_EQ(transform.Decompose(), cache.Decompose(transform));
+  }
+  EXPECT_EQ(3u, cache.hit_count());
+  EXPECT_EQ(3u, cache.miss_count());
+  // The singular transform failed both times.
+  EXPECT_EQ(2u, cache.failure_count());
+
+  // AxisTransform2d bypasses the cache.
+  Transform scale = Transform::MakeScale(2, 3);
+  EXPECT_EQ(scale.Decompose(), cache.Decompose(scale));
+  EXPECT_EQ(3u, cache.hit_count());
+  EXPECT_EQ(3u, cache.miss_count());
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.hit_count());
+  EXPECT_EQ(0u, cache.miss_count());
+  EXPECT_EQ(0u, cache.failure_count());
+  EXPECT_EQ(GetTestTransform(30).Decompose(),
+            cache.Decompose(GetTestTransform(30)));
+  EXPECT_EQ(1u, cache.miss_count());
+}
+
+TEST(DecomposedTransformCacheTest, BlendUsesCache) {
+  DecomposedTransformCache& cache = DecomposedTransformCache::GetInstance();
+  cache.Clear();
+  const Transform from = GetTestTransform(10);
+  const Transform to = GetTestTransform(80);
+  for (int i = 0; i <= 10; ++i) {
+    Transform blended = to;
+    ASSERT_TRUE(blended.Blend(from, i / 10.0));
+  }
+  EXPECT_EQ(2u, cache.miss_count());
+  EXPECT_EQ(20u, cache.hit_count());
+}
+
+TEST(DecomposedTransformCacheTest, BlendFailures) {
+  DecomposedTransformCache& cache = DecomposedTransformCache::GetInstance();
+  cache.Clear();
+  const Transform to = GetTestTransform(80);
+
+  // Neither a singular transform nor one with w = 0 at the origin can be
+  // decomposed, whether they're backed by AxisTransform2d or not.
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(1);
+  perspective.set_rc(3, 3, 0);
+  for (const Transform& from :
+       {Transform::MakeScale(0, 1), perspective, GetTestTransform(10)}) {
+    Transform blended = to;
+    blended.Blend(from, 0.5);
+  }
+  EXPECT_EQ(2u, cache.failure_count());
+
+  Transform accumulated = Transform::MakeScale(0, 1);
+  EXPECT_FALSE(accumulated.Accumulate(to));
+  EXPECT_EQ(3u, cache.failure_count());
+}
+
+}  // namespace
+
+}  // namespace gfx
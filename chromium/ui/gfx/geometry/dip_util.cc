@@ -4,8 +4,17 @@
 
 #include "ui/gfx/geometry/dip_util.h"
 
+#include <algorithm>
+#include <array>
+#include <utility>
+
+#include "base/check_op.h"
+#include "base/numerics/clamped_math.h"
 #include "base/numerics/safe_conversions.h"
 #include "build/build_config.h"
+#include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/insets.h"
 #include "ui/gfx/geometry/insets_f.h"
 #include "ui/gfx/geometry/point.h"
@@ -18,6 +27,92 @@
 
 namespace gfx {
 
+namespace {
+
+// Scales two points per vector, as ScalePoint() does.
+void ScalePoints(base::span<const PointF> points,
+                 float scale,
+                 base::span<PointF> results) {
+  CheckBatchSpans(points, results);
+  size_t i = 0;
+  for (; i + 2 <= points.size(); i += 2) {
+    Float4 v = Float4{points[i].x(), points[i].y(), points[i + 1].x(),
+                      points[i + 1].y()} *
+               scale;
+    results[i] = PointF(v[0], v[1]);
+    results[i + 1] = PointF(v[2], v[3]);
+  }
+  if (i < points.size()) {
+    results[i] = ScalePoint(points[i], scale);
+  }
+}
+
+// Scales two sizes per vector, as ScaleSize() does.
+void ScaleSizes(base::span<const SizeF> sizes,
+                float scale,
+                base::span<SizeF> results) {
+  CheckBatchSpans(sizes, results);
+  size_t i = 0;
+  for (; i + 2 <= sizes.size(); i += 2) {
+    Float4 v = Float4{sizes[i].width(), sizes[i].height(),
+                      sizes[i + 1].width(), sizes[i + 1].height()} *
+               scale;
+    results[i] = SizeF(v[0], v[1]);
+    results[i + 1] = SizeF(v[2], v[3]);
+  }
+  if (i < sizes.size()) {
+    results[i] = ScaleSize(sizes[i], scale);
+  }
+}
+
+// Scales each rect as one vector, as ScaleRect() does.
+void ScaleRects(base::span<const RectF> rects,
+                float scale,
+                base::span<RectF> results) {
+  CheckBatchSpans(rects, results);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    const RectF& r = rects[i];
+    Float4 v = Float4{r.x(), r.y(), r.width(), r.height()} * scale;
+    results[i] = RectF(v[0], v[1], v[2], v[3]);
+  }
+}
+
+// Returns the Rect enclosing the span from |left| to |right| and from |top|
+// to |bottom|, which may be in either order. Like ToEnclosingRect(), an empty
+// span stays empty.
+Rect EnclosingRectOfEdges(float left, float top, float right, float bottom) {
+  if (left > right) {
+    std::swap(left, right);
+  }
+  if (top > bottom) {
+    std::swap(top, bottom);
+  }
+  const int enclosing_left = base::ClampFloor(left);
+  const int enclosing_top = base::ClampFloor(top);
+  Rect result;
+  result.SetByBounds(
+      enclosing_left, enclosing_top,
+      right == left ? enclosing_left : base::ClampCeil(right),
+      bottom == top ? enclosing_top : base::ClampCeil(bottom));
+  return result;
+}
+
+// Maps the edges of |rect| through |transform|, as AxisTransform2d::MapX()
+// and MapY() do, and returns their enclosing Rect.
+Rect MapRectToEnclosingRect(const AxisTransform2d& transform,
+                            const RectF& rect) {
+  const float scale_x = transform.scale().x();
+  const float scale_y = transform.scale().y();
+  const float translation_x = transform.translation().x();
+  const float translation_y = transform.translation().y();
+  return EnclosingRectOfEdges(rect.x() * scale_x + translation_x,
+                              rect.y() * scale_y + translation_y,
+                              rect.right() * scale_x + translation_x,
+                              rect.bottom() * scale_y + translation_y);
+}
+
+}  // namespace
+
 PointF ConvertPointToDips(const Point& point_in_pixels,
                           float device_scale_factor) {
   return ScalePoint(PointF(point_in_pixels), 1.f / device_scale_factor);
@@ -94,4 +189,98 @@ InsetsF ConvertInsetsToPixels(const gfx::InsetsF& insets_in_dips,
   return ScaleInsets(insets_in_dips, device_scale_factor);
 }
 
+void ConvertPointsToDips(base::span<const PointF> points_in_pixels,
+                         float device_scale_factor,
+                         base::span<PointF> points_in_dips) {
+  ScalePoints(points_in_pixels, 1.f / device_scale_factor, points_in_dips);
+}
+
+void ConvertPointsToPixels(base::span<const PointF> points_in_dips,
+                           float device_scale_factor,
+                           base::span<PointF> points_in_pixels) {
+  ScalePoints(points_in_dips, device_scale_factor, points_in_pixels);
+}
+
+void ConvertSizesToDips(base::span<const SizeF> sizes_in_pixels,
+                        float device_scale_factor,
+                        base::span<SizeF> sizes_in_dips) {
+  ScaleSizes(sizes_in_pixels, 1.f / device_scale_factor, sizes_in_dips);
+}
+
+void ConvertSizesToPixels(base::span<const SizeF> sizes_in_dips,
+                          float device_scale_factor,
+                          base::span<SizeF> sizes_in_pixels) {
+  ScaleSizes(sizes_in_dips, device_scale_factor, sizes_in_pixels);
+}
+
+void ConvertRectsToDips(base::span<const RectF> rects_in_pixels,
+                        float device_scale_factor,
+                        base::span<RectF> rects_in_dips) {
+  ScaleRects(rects_in_pixels, 1.f / device_scale_factor, rects_in_dips);
+}
+
+void ConvertRectsToPixels(base::span<const RectF> rects_in_dips,
+                          float device_scale_factor,
+                          base::span<RectF> rects_in_pixels) {
+  ScaleRects(rects_in_dips, device_scale_factor, rects_in_pixels);
+}
+
+void ConvertRectsToEnclosingPixels(base::span<const RectF> rects_in_dips,
+                                   float device_scale_factor,
+                                   base::span<Rect> rects_in_pixels) {
+  CheckBatchSpans(rects_in_dips, rects_in_pixels);
+
+  // Scales the rects in chunks, which stay in cache for their rounding,
+  // without allocating.
+  constexpr size_t kChunkSize = 32;
+  std::array<RectF, kChunkSize> scaled;
+  for (size_t start = 0; start < rects_in_dips.size(); start += kChunkSize) {
+    const size_t size = std::min(kChunkSize, rects_in_dips.size() - start);
+    auto chunk = base::span(scaled).first(size);
+    ScaleRects(rects_in_dips.subspan(start, size), device_scale_factor, chunk);
+    ToEnclosingRects(chunk, rects_in_pixels.subspan(start, size));
+  }
+}
+
+Rect MapRectToEnclosingPixels(const AxisTransform2d& transform,
+                              const RectF& rect_in_dips,
+                              float device_scale_factor) {
+  return MapRectToEnclosingRect(
+      PostScaleAxisTransform2d(transform, device_scale_factor), rect_in_dips);
+}
+
+void MapRectsToEnclosingPixels(const AxisTransform2d& transform,
+                               base::span<const RectF> rects_in_dips,
+                               float device_scale_factor,
+                               base::span<Rect> rects_in_pixels) {
+  CheckBatchSpans(rects_in_dips, rects_in_pixels);
+  const AxisTransform2d to_pixels =
+      PostScaleAxisTransform2d(transform, device_scale_factor);
+  for (size_t i = 0; i < rects_in_dips.size(); ++i) {
+    rects_in_pixels[i] = MapRectToEnclosingRect(to_pixels, rects_in_dips[i]);
+  }
+}
+
+std::optional<Rect> InverseMapRectToEnclosingDips(
+    const AxisTransform2d& transform,
+    const Rect& rect_in_pixels,
+    float device_scale_factor) {
+  const AxisTransform2d to_pixels =
+      PostScaleAxisTransform2d(transform, device_scale_factor);
+  if (!to_pixels.IsInvertible()) {
+    return std::nullopt;
+  }
+  // The same operations as AxisTransform2d::InverseMapX() and InverseMapY().
+  const float inverse_scale_x = 1.f / to_pixels.scale().x();
+  const float inverse_scale_y = 1.f / to_pixels.scale().y();
+  const float translation_x = to_pixels.translation().x();
+  const float translation_y = to_pixels.translation().y();
+  const RectF rect(rect_in_pixels);
+  return EnclosingRectOfEdges(
+      (rect.x() - translation_x) * inverse_scale_x,
+      (rect.y() - translation_y) * inverse_scale_y,
+      (rect.right() - translation_x) * inverse_scale_x,
+      (rect.bottom() - translation_y) * inverse_scale_y);
+}
+
 }  // namespace gfx
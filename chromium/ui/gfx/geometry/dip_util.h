@@ -5,10 +5,14 @@
 #ifndef UI_GFX_GEOMETRY_DIP_UTIL_H_
 #define UI_GFX_GEOMETRY_DIP_UTIL_H_
 
+#include <optional>
+
 #include "base/component_export.h"
+#include "base/containers/span.h"
 
 namespace gfx {
 
+class AxisTransform2d;
 class Insets;
 class InsetsF;
 class Point;
@@ -86,6 +90,68 @@ COMPONENT_EXPORT(GEOMETRY)
 gfx::InsetsF ConvertInsetsToPixels(const gfx::InsetsF& insets_in_dips,
                                    float device_scale_factor);
 
+// Batch versions of the functions above, which convert each of the values in
+// the first span into the element of the second span at the same index, with
+// the same results. The spans must have the same size.
+COMPONENT_EXPORT(GEOMETRY)
+void ConvertPointsToDips(base::span<const gfx::PointF> points_in_pixels,
+                         float device_scale_factor,
+                         base::span<gfx::PointF> points_in_dips);
+COMPONENT_EXPORT(GEOMETRY)
+void ConvertPointsToPixels(base::span<const gfx::PointF> points_in_dips,
+                           float device_scale_factor,
+                           base::span<gfx::PointF> points_in_pixels);
+
+COMPONENT_EXPORT(GEOMETRY)
+void ConvertSizesToDips(base::span<const gfx::SizeF> sizes_in_pixels,
+                        float device_scale_factor,
+                        base::span<gfx::SizeF> sizes_in_dips);
+COMPONENT_EXPORT(GEOMETRY)
+void ConvertSizesToPixels(base::span<const gfx::SizeF> sizes_in_dips,
+                          float device_scale_factor,
+                          base::span<gfx::SizeF> sizes_in_pixels);
+
+COMPONENT_EXPORT(GEOMETRY)
+void ConvertRectsToDips(base::span<const gfx::RectF> rects_in_pixels,
+                        float device_scale_factor,
+                        base::span<gfx::RectF> rects_in_dips);
+COMPONENT_EXPORT(GEOMETRY)
+void ConvertRectsToPixels(base::span<const gfx::RectF> rects_in_dips,
+                          float device_scale_factor,
+                          base::span<gfx::RectF> rects_in_pixels);
+
+// Returns the same as ToEnclosingRect(ConvertRectToPixels()) for each rect.
+COMPONENT_EXPORT(GEOMETRY)
+void ConvertRectsToEnclosingPixels(base::span<const gfx::RectF> rects_in_dips,
+                                   float device_scale_factor,
+                                   base::span<gfx::Rect> rects_in_pixels);
+
+// Returns ToEnclosingRect(ConvertRectToPixels(transform.MapRect(rect_in_dips),
+// device_scale_factor)), up to float rounding. The device scale factor is
+// folded into |transform|, and the enclosing edges are computed from the
+// mapped edges of |rect_in_dips|, without an intermediate RectF. See
+// transform_util.h for the version for gfx::Transform.
+COMPONENT_EXPORT(GEOMETRY)
+gfx::Rect MapRectToEnclosingPixels(const gfx::AxisTransform2d& transform,
+                                   const gfx::RectF& rect_in_dips,
+                                   float device_scale_factor);
+// Same as above for each rect, folding the device scale factor only once.
+COMPONENT_EXPORT(GEOMETRY)
+void MapRectsToEnclosingPixels(const gfx::AxisTransform2d& transform,
+                               base::span<const gfx::RectF> rects_in_dips,
+                               float device_scale_factor,
+                               base::span<gfx::Rect> rects_in_pixels);
+
+// The reverse of MapRectToEnclosingPixels(): returns
+// ToEnclosingRect(*transform.InverseMapRect(ConvertRectToDips(rect_in_pixels,
+// device_scale_factor))), up to float rounding, or std::nullopt if
+// |transform| isn't invertible.
+COMPONENT_EXPORT(GEOMETRY)
+std::optional<gfx::Rect> InverseMapRectToEnclosingDips(
+    const gfx::AxisTransform2d& transform,
+    const gfx::Rect& rect_in_pixels,
+    float device_scale_factor);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_DIP_UTIL_H_
@@ -0,0 +1,158 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/dip_util.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/size_f.h"
+#include "ui/gfx/geometry/vector2d_f.h"
+
+namespace gfx {
+
+namespace {
+
+constexpr float kScales[] = {1.f, 1.25f, 1.5f, 2.f, 2.625f, 3.f};
+
+// Values with fractions in both pixels and DIPs, and some negative ones.
+std::vector<RectF> MakeRects() {
+  std::vector<RectF> rects;
+  for (int i = 0; i < 7; ++i) {
+    rects.emplace_back(i * 13.3f - 40, i * -7.1f, i * 1.7f, 100.f / (i + 1));
+  }
+  rects.emplace_back();
+  rects.emplace_back(1e9f, -1e9f, 1e9f, 3e9f);
+  return rects;
+}
+
+}  // namespace
+
+TEST(DipUtilTest, ConvertPoints) {
+  std::vector<PointF> points;
+  for (const RectF& rect : MakeRects()) {
+    points.push_back(rect.origin());
+  }
+  std::vector<PointF> results(points.size());
+  for (float scale : kScales) {
+    SCOPED_TRACE(scale);
+    ConvertPointsToDips(points, scale, results);
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_EQ(ConvertPointToDips(points[i], scale), results[i]);
+    }
+    ConvertPointsToPixels(points, scale, results);
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_EQ(ConvertPointToPixels(points[i], scale), results[i]);
+    }
+  }
+}
+
+TEST(DipUtilTest, ConvertSizes) {
+  std::vector<SizeF> sizes;
+  for (const RectF& rect : MakeRects()) {
+    sizes.push_back(rect.size());
+  }
+  std::vector<SizeF> results(sizes.size());
+  for (float scale : kScales) {
+    SCOPED_TRACE(scale);
+    ConvertSizesToDips(sizes, scale, results);
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      EXPECT_EQ(ConvertSizeToDips(sizes[i], scale), results[i]);
+    }
+    ConvertSizesToPixels(sizes, scale, results);
+    for (size_t i = 0; i < sizes.size(); ++i) {
+      EXPECT_EQ(ConvertSizeToPixels(sizes[i], scale), results[i]);
+    }
+  }
+}
+
+TEST(DipUtilTest, ConvertRects) {
+  std::vector<RectF> rects = MakeRects();
+  std::vector<RectF> results(rects.size());
+  for (float scale : kScales) {
+    SCOPED_TRACE(scale);
+    ConvertRectsToDips(rects, scale, results);
+    for (size_t i = 0; i < rects.size(); ++i) {
+      EXPECT_EQ(ConvertRectToDips(rects[i], scale), results[i]);
+    }
+    ConvertRectsToPixels(rects, scale, results);
+    for (size_t i = 0; i < rects.size(); ++i) {
+      EXPECT_EQ(ConvertRectToPixels(rects[i], scale), results[i]);
+    }
+  }
+}
+
+TEST(DipUtilTest, ConvertRectsToEnclosingPixels) {
+  // More rects than a chunk.
+  std::vector<RectF> rects;
+  for (int i = 0; i < 10; ++i) {
+    for (const RectF& rect : MakeRects()) {
+      rects.push_back(rect + Vector2dF(i * 0.3f, i * -0.7f));
+    }
+  }
+  std::vector<Rect> results(rects.size());
+  for (float scale : kScales) {
+    SCOPED_TRACE(scale);
+    ConvertRectsToEnclosingPixels(rects, scale, results);
+    for (size_t i = 0; i < rects.size(); ++i) {
+      EXPECT_EQ(ToEnclosingRect(ConvertRectToPixels(rects[i], scale)),
+                results[i]);
+    }
+  }
+}
+
+TEST(DipUtilTest, MapRectToEnclosingPixels) {
+  const auto transform = AxisTransform2d::FromScaleAndTranslation(
+      Vector2dF(1.5f, 0.5f), Vector2dF(3.25f, -2.f));
+  EXPECT_EQ(Rect(9, -2, 10, 4),
+            MapRectToEnclosingPixels(transform, RectF(1, 2, 3, 4), 2.f));
+  EXPECT_EQ(Rect(0, 2, 5, 4),
+            InverseMapRectToEnclosingDips(transform, Rect(9, -2, 10, 4), 2.f));
+
+  const auto flip = AxisTransform2d::FromScaleAndTranslation(
+      Vector2dF(-1.f, 1.f), Vector2dF());
+  EXPECT_EQ(Rect(-8, 4, 6, 8),
+            MapRectToEnclosingPixels(flip, RectF(1, 2, 3, 4), 2.f));
+  EXPECT_EQ(Rect(1, 2, 3, 4),
+            InverseMapRectToEnclosingDips(flip, Rect(-8, 4, 6, 8), 2.f));
+
+  // Empty rects stay empty, as with ToEnclosingRect().
+  EXPECT_EQ(Rect(2, 5, 0, 0),
+            MapRectToEnclosingPixels(AxisTransform2d(),
+                                     RectF(1.25f, 2.5f, 0, 0), 2.f));
+
+  EXPECT_FALSE(InverseMapRectToEnclosingDips(
+      AxisTransform2d::FromScaleAndTranslation(Vector2dF(0, 1), Vector2dF()),
+      Rect(1, 2, 3, 4), 2.f));
+
+  // The results are those of the separate steps, up to their rounding, which
+  // grows with the float precision of large rects.
+  auto expect_near = [](int expected, int actual) {
+    EXPECT_NEAR(expected, actual, 1 + std::abs(expected) * 1e-6);
+  };
+  const std::vector<RectF> rects = MakeRects();
+  std::vector<Rect> results(rects.size());
+  for (float scale : kScales) {
+    SCOPED_TRACE(scale);
+    MapRectsToEnclosingPixels(transform, rects, scale, results);
+    for (size_t i = 0; i < rects.size(); ++i) {
+      EXPECT_EQ(MapRectToEnclosingPixels(transform, rects[i], scale),
+                results[i]);
+      Rect expected = ToEnclosingRect(
+          ConvertRectToPixels(transform.MapRect(rects[i]), scale));
+      expect_near(expected.x(), results[i].x());
+      expect_near(expected.y(), results[i].y());
+      expect_near(expected.right(), results[i].right());
+      expect_near(expected.bottom(), results[i].bottom());
+    }
+  }
+}
+
+}  // namespace gfx
@@ -5,6 +5,9 @@
 #ifndef UI_GFX_GEOMETRY_DOUBLE4_H_
 #define UI_GFX_GEOMETRY_DOUBLE4_H_
 
+#include <stdint.h>
+
+#include <limits>
 #include <type_traits>
 
 #include "base/compiler_specific.h"
@@ -51,6 +54,7 @@ namespace gfx {
 
 typedef double __attribute__((vector_size(4 * sizeof(double)))) Double4;
 typedef float __attribute__((vector_size(4 * sizeof(float)))) Float4;
+typedef int32_t __attribute__((vector_size(4 * sizeof(int32_t)))) Int4;
 
 ALWAYS_INLINE double Sum(Double4 v) {
   return v[0] + v[1] + v[2] + v[3];
@@ -67,6 +71,21 @@ ALWAYS_INLINE void StoreDouble4(Double4 v, double d[4]) {
   UNSAFE_TODO(d[3]) = v[3];
 }
 
+ALWAYS_INLINE float Sum(Float4 v) {
+  return v[0] + v[1] + v[2] + v[3];
+}
+
+ALWAYS_INLINE Float4 LoadFloat4(const float s[4]) {
+  return Float4{s[0], UNSAFE_TODO(s[1]), UNSAFE_TODO(s[2]), UNSAFE_TODO(s[3])};
+}
+
+ALWAYS_INLINE void StoreFloat4(Float4 v, float d[4]) {
+  d[0] = v[0];
+  UNSAFE_TODO(d[1]) = v[1];
+  UNSAFE_TODO(d[2]) = v[2];
+  UNSAFE_TODO(d[3]) = v[3];
+}
+
 // The parameter should be the result of Double4/Float4 operations that would
 // produce bool results if they were original scalar operators, e.g.
 //   auto b4 = double4_a == double4_b;
@@ -89,6 +108,146 @@ ALWAYS_INLINE int32_t AllTrue(FloatBoolean4 b4) {
   return b4[0] & b4[1] & b4[2] & b4[3];
 }
 
+typedef uint32_t __attribute__((vector_size(4 * sizeof(uint32_t)))) UInt4;
+
+// Returns the saturated value for lanes of |a| that overflowed: the max int
+// where |a| is positive, and the min int where it's negative.
+ALWAYS_INLINE Int4 SaturatedValue4(Int4 a) {
+  return (a >> 31) ^ std::numeric_limits<int>::max();
+}
+
+// Branchless base::ClampAdd() and base::ClampSub() for each lane. The lanes
+// wrap as unsigned values, and overflowed if the sign of the result differs
+// from that of both operands (for addition), or from that of |a| when the
+// operands have different signs (for subtraction).
+ALWAYS_INLINE Int4 ClampAdd4(Int4 a, Int4 b) {
+  Int4 sum = reinterpret_cast<Int4>(reinterpret_cast<UInt4>(a) +
+                                    reinterpret_cast<UInt4>(b));
+  return ((a ^ sum) & (b ^ sum)) < 0 ? SaturatedValue4(a) : sum;
+}
+
+ALWAYS_INLINE Int4 ClampSub4(Int4 a, Int4 b) {
+  Int4 difference = reinterpret_cast<Int4>(reinterpret_cast<UInt4>(a) -
+                                           reinterpret_cast<UInt4>(b));
+  return ((a ^ b) & (a ^ difference)) < 0 ? SaturatedValue4(a) : difference;
+}
+
+// Converts the lanes of |v|, which must be integers, infinities or NaN, to int
+// with saturation, and NaN to 0, as base::saturated_cast<int>().
+ALWAYS_INLINE Int4 SaturatedIntegersToInt4(Float4 v) {
+  // 2^31, the smallest float above the int range; -2^31 is in it.
+  constexpr float kUpper = 2147483648.0f;
+  // NaN fails both comparisons, and is replaced by 0 before the conversion.
+  const FloatBoolean4 in_range = (v < kUpper) & (v >= -kUpper);
+  const Int4 converted = __builtin_convertvector(in_range ? v : Float4{}, Int4);
+  constexpr int32_t kMax = std::numeric_limits<int32_t>::max();
+  constexpr int32_t kMin = std::numeric_limits<int32_t>::min();
+  return v >= kUpper ? Int4{} + kMax
+                     : (v < -kUpper ? Int4{} + kMin : converted);
+}
+
+// Floats of magnitude 2^23 or more are integers (or infinities).
+constexpr float kMinIntegralFloatMagnitude = 8388608.0f;
+
+// Returns the lanes of |v| truncated towards zero in |truncated|, and whether
+// they may have fractions in the result, which is false for NaN.
+ALWAYS_INLINE FloatBoolean4 TruncateFloat4(Float4 v, Float4& truncated) {
+  const FloatBoolean4 may_be_fractional =
+      (v < kMinIntegralFloatMagnitude) & (v > -kMinIntegralFloatMagnitude);
+  truncated = __builtin_convertvector(
+      __builtin_convertvector(may_be_fractional ? v : Float4{}, Int4), Float4);
+  return may_be_fractional;
+}
+
+// These have the same results as base::ClampFloor(), ClampCeil() and
+// ClampRound() of each lane of |v|, i.e. std::floor(), std::ceil() and
+// std::round() to int with saturation and NaN converted to 0, with SIMD
+// compares and conversions instead of branches. The true lanes of the
+// comparisons are -1, which is added to or subtracted from the truncated
+// lanes.
+ALWAYS_INLINE Int4 ClampFloorToInt4(Float4 v) {
+  Float4 truncated;
+  const FloatBoolean4 may_be_fractional = TruncateFloat4(v, truncated);
+  const Float4 floored =
+      truncated + __builtin_convertvector(truncated > v, Float4);
+  return SaturatedIntegersToInt4(may_be_fractional ? floored : v);
+}
+
+ALWAYS_INLINE Int4 ClampCeilToInt4(Float4 v) {
+  Float4 truncated;
+  const FloatBoolean4 may_be_fractional = TruncateFloat4(v, truncated);
+  const Float4 ceiled =
+      truncated - __builtin_convertvector(truncated < v, Float4);
+  return SaturatedIntegersToInt4(may_be_fractional ? ceiled : v);
+}
+
+// Rounds halfway cases away from zero. The fraction is exact, unlike v + 0.5,
+// which rounds e.g. 0.49999997 up.
+ALWAYS_INLINE Int4 ClampRoundToInt4(Float4 v) {
+  Float4 truncated;
+  const FloatBoolean4 may_be_fractional = TruncateFloat4(v, truncated);
+  const Float4 fraction = v - truncated;
+  const Float4 rounded = truncated -
+                         __builtin_convertvector(fraction >= 0.5f, Float4) +
+                         __builtin_convertvector(fraction <= -0.5f, Float4);
+  return SaturatedIntegersToInt4(may_be_fractional ? rounded : v);
+}
+
+// 2^v for each lane of |v|, clamped to the normal floats, with a relative error
+// below 2e-7. v is split into an integer, which goes into the exponent bits,
+// and a fraction in [-0.5, 0.5], for which 2^f is a polynomial (Cephes'
+// exp2f()).
+ALWAYS_INLINE Float4 Exp2Float4(Float4 v) {
+  const Float4 kMin = Float4{} - 126.f;
+  const Float4 kMax = Float4{} + 127.f;
+  v = v < kMin ? kMin : (v > kMax ? kMax : v);
+  const Int4 n = ClampRoundToInt4(v);
+  const Float4 f = v - __builtin_convertvector(n, Float4);
+  Float4 p = 1.535336188319500e-4f * f + 1.339887440266574e-3f;
+  p = p * f + 9.618437357674640e-3f;
+  p = p * f + 5.550332471162809e-2f;
+  p = p * f + 2.402264791363012e-1f;
+  p = p * f + 6.931472028550421e-1f;
+  p = p * f + 1.f;
+  return p * reinterpret_cast<Float4>((n + 127) << 23);
+}
+
+// log2(v) for each lane of |v|, which must be positive and finite, with an
+// error below 1e-6, relative to the result beyond 2 and 1/2. The exponent bits
+// are the integer part, and the mantissa, scaled into [sqrt(1/2), sqrt(2)),
+// goes through the polynomial of Cephes' logf(). Zero lanes, like the
+// denormals, are treated as 2^-127.
+ALWAYS_INLINE Float4 Log2Float4(Float4 v) {
+  const Int4 bits = reinterpret_cast<Int4>(v);
+  Int4 exponent = (bits >> 23) - 127;
+  Float4 mantissa = reinterpret_cast<Float4>((bits & 0x007fffff) | 0x3f800000);
+  // The true lanes are -1.
+  const FloatBoolean4 is_large = mantissa > 1.41421356237f;
+  mantissa = is_large ? mantissa * 0.5f : mantissa;
+  exponent -= is_large;
+
+  const Float4 x = mantissa - 1.f;
+  const Float4 z = x * x;
+  Float4 y = 7.0376836292e-2f * x - 1.1514610310e-1f;
+  y = y * x + 1.1676998740e-1f;
+  y = y * x - 1.2420140846e-1f;
+  y = y * x + 1.4249322787e-1f;
+  y = y * x - 1.6668057665e-1f;
+  y = y * x + 2.0000714765e-1f;
+  y = y * x - 2.4999993993e-1f;
+  y = y * x + 3.3333331174e-1f;
+  y = y * x * z - 0.5f * z;
+  constexpr float kLog2e = 1.44269504088896340736f;
+  return (x + y) * kLog2e + __builtin_convertvector(exponent, Float4);
+}
+
+// std::pow(base, exponent) for each lane of |base|, which must be non-negative
+// and finite, and the positive |exponent|, as 2^(exponent * log2(base)). The
+// zero lanes are 0.
+ALWAYS_INLINE Float4 PowFloat4(Float4 base, Float4 exponent) {
+  return base > 0.f ? Exp2Float4(exponent * Log2Float4(base)) : Float4{};
+}
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_DOUBLE4_H_
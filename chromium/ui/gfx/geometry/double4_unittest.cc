@@ -0,0 +1,58 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/double4.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace gfx {
+
+TEST(Double4Test, Exp2Float4) {
+  for (float v = -100; v < 100; v += 0.0137f) {
+    const Float4 result = Exp2Float4(Float4{v, -v, v / 8, 0});
+    EXPECT_NEAR(1, result[0] / std::exp2(double{v}), 2e-7) << v;
+    EXPECT_NEAR(1, result[1] / std::exp2(-double{v}), 2e-7) << v;
+    EXPECT_NEAR(1, result[2] / std::exp2(double{v / 8}), 2e-7) << v;
+    EXPECT_EQ(1, result[3]);
+  }
+  // Clamped to the normal floats.
+  const Float4 result = Exp2Float4(Float4{-200, 200, -126, 127});
+  EXPECT_EQ(std::exp2(-126.f), result[0]);
+  EXPECT_EQ(std::exp2(127.f), result[1]);
+  EXPECT_EQ(std::exp2(-126.f), result[2]);
+  EXPECT_EQ(std::exp2(127.f), result[3]);
+}
+
+TEST(Double4Test, Log2Float4) {
+  for (float v = 1e-30f; v < 1e30f; v *= 1.0171f) {
+    const Float4 result = Log2Float4(Float4{v, 1 / v, 1, 2});
+    // Relative to the result beyond 2 and 1/2.
+    const double tolerance =
+        1e-6 * std::max(1.0, std::abs(std::log2(double{v})));
+    EXPECT_NEAR(std::log2(double{v}), result[0], tolerance) << v;
+    EXPECT_NEAR(std::log2(double{1 / v}), result[1], tolerance) << v;
+    EXPECT_EQ(0, result[2]);
+    EXPECT_EQ(1, result[3]);
+  }
+}
+
+TEST(Double4Test, PowFloat4) {
+  for (float base = 0; base <= 1; base += 0.01f) {
+    for (float exponent : {0.001f, 0.5f, 1.f, 4.f, 1000.f}) {
+      const Float4 result =
+          PowFloat4(Float4{base, 1 - base, 0, 1}, Float4{} + exponent);
+      EXPECT_NEAR(std::pow(base, exponent), result[0], 1e-5)
+          << base << " " << exponent;
+      EXPECT_NEAR(std::pow(1 - base, exponent), result[1], 1e-5)
+          << base << " " << exponent;
+      EXPECT_EQ(0, result[2]);
+      EXPECT_EQ(1, result[3]);
+    }
+  }
+}
+
+}  // namespace gfx
@@ -0,0 +1,130 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/float3_array.h"
+
+#include <cmath>
+
+#include "base/compiler_specific.h"
+#include "ui/gfx/geometry/double4.h"
+
+namespace gfx {
+
+namespace {
+
+constexpr size_t kLanes = Vector3dFArray::kLanes;
+
+// As in Vector3dF::GetNormalized().
+constexpr double kEpsilon = 1.0e-6;
+
+ALWAYS_INLINE Float4 Load(base::span<const float> s, size_t i) {
+  return LoadFloat4(s.subspan(i, kLanes).data());
+}
+
+ALWAYS_INLINE void Store(Float4 v, base::span<float> d, size_t i) {
+  StoreFloat4(v, d.subspan(i, kLanes).data());
+}
+
+// Stores the lanes of |v| that are elements of |results|, which aren't
+// padded.
+ALWAYS_INLINE void StoreElements(Float4 v,
+                                 base::span<float> results,
+                                 size_t i) {
+  for (size_t lane = 0; lane < kLanes && i + lane < results.size(); ++lane) {
+    results[i + lane] = v[lane];
+  }
+}
+
+ALWAYS_INLINE Double4 ToDouble4(Float4 v) {
+  return __builtin_convertvector(v, Double4);
+}
+
+// Returns the squares of the lengths of the vectors in the lanes, as
+// Vector3dF::LengthSquared().
+ALWAYS_INLINE Double4 LengthsSquared(Float4 x, Float4 y, Float4 z) {
+  const Double4 dx = ToDouble4(x);
+  const Double4 dy = ToDouble4(y);
+  const Double4 dz = ToDouble4(z);
+  return dx * dx + dy * dy + dz * dz;
+}
+
+ALWAYS_INLINE Float4 LaneLengths(Float4 x, Float4 y, Float4 z) {
+  const Double4 lengths_squared = LengthsSquared(x, y, z);
+  // Lane by lane, since the vector extensions have no square root.
+  Double4 lengths;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    lengths[lane] = std::sqrt(lengths_squared[lane]);
+  }
+  return __builtin_convertvector(lengths, Float4);
+}
+
+}  // namespace
+
+void DotProducts(const Vector3dFArray& lhs,
+                 const Vector3dFArray& rhs,
+                 base::span<float> results) {
+  CHECK_EQ(lhs.size(), rhs.size());
+  CHECK_EQ(lhs.size(), results.size());
+  for (size_t i = 0; i < lhs.padded_size(); i += kLanes) {
+    const Float4 dot = Load(lhs.xs(), i) * Load(rhs.xs(), i) +
+                       Load(lhs.ys(), i) * Load(rhs.ys(), i) +
+                       Load(lhs.zs(), i) * Load(rhs.zs(), i);
+    StoreElements(dot, results, i);
+  }
+}
+
+void CrossProducts(const Vector3dFArray& lhs,
+                   const Vector3dFArray& rhs,
+                   Vector3dFArray& results) {
+  CHECK_EQ(lhs.size(), rhs.size());
+  // |results| may be one of the arguments, and keeps their size.
+  results.resize(lhs.size());
+  for (size_t i = 0; i < lhs.padded_size(); i += kLanes) {
+    // In double, as Vector3dF::Cross().
+    const Double4 ax = ToDouble4(Load(lhs.xs(), i));
+    const Double4 ay = ToDouble4(Load(lhs.ys(), i));
+    const Double4 az = ToDouble4(Load(lhs.zs(), i));
+    const Double4 bx = ToDouble4(Load(rhs.xs(), i));
+    const Double4 by = ToDouble4(Load(rhs.ys(), i));
+    const Double4 bz = ToDouble4(Load(rhs.zs(), i));
+    Store(__builtin_convertvector(ay * bz - az * by, Float4), results.xs(), i);
+    Store(__builtin_convertvector(az * bx - ax * bz, Float4), results.ys(), i);
+    Store(__builtin_convertvector(ax * by - ay * bx, Float4), results.zs(), i);
+  }
+}
+
+void Lengths(const Vector3dFArray& vectors, base::span<float> results) {
+  CHECK_EQ(vectors.size(), results.size());
+  for (size_t i = 0; i < vectors.padded_size(); i += kLanes) {
+    StoreElements(LaneLengths(Load(vectors.xs(), i), Load(vectors.ys(), i),
+                              Load(vectors.zs(), i)),
+                  results, i);
+  }
+}
+
+void ScaleVectors(Vector3dFArray& vectors, float scale) {
+  for (size_t i = 0; i < vectors.padded_size(); i += kLanes) {
+    Store(Load(vectors.xs(), i) * scale, vectors.xs(), i);
+    Store(Load(vectors.ys(), i) * scale, vectors.ys(), i);
+    Store(Load(vectors.zs(), i) * scale, vectors.zs(), i);
+  }
+}
+
+void NormalizeVectors(Vector3dFArray& vectors) {
+  for (size_t i = 0; i < vectors.padded_size(); i += kLanes) {
+    const Float4 x = Load(vectors.xs(), i);
+    const Float4 y = Load(vectors.ys(), i);
+    const Float4 z = Load(vectors.zs(), i);
+    // The vectors that are too short are divided by 1, which leaves them
+    // unchanged.
+    const Int4 normalizable = __builtin_convertvector(
+        LengthsSquared(x, y, z) >= kEpsilon * kEpsilon, Int4);
+    const Float4 lengths = normalizable ? LaneLengths(x, y, z) : Float4{} + 1;
+    Store(x / lengths, vectors.xs(), i);
+    Store(y / lengths, vectors.ys(), i);
+    Store(z / lengths, vectors.zs(), i);
+  }
+}
+
+}  // namespace gfx
@@ -0,0 +1,130 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_FLOAT3_ARRAY_H_
+#define UI_GFX_GEOMETRY_FLOAT3_ARRAY_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "base/check_op.h"
+#include "base/component_export.h"
+#include "base/containers/span.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/vector3d_f.h"
+
+namespace gfx {
+
+// An array of Vector3dF or Point3F stored as a structure of arrays: the x, y
+// and z components each in their own array, padded to a multiple of kLanes
+// elements. The batch operations below and Transform::MapPoints3d() load
+// kLanes elements at once into Float4 or Double4 lanes, without shuffling
+// packed 3-float elements or a scalar loop for the tail. The values of the
+// padding are unspecified, since the operations write whole groups of lanes.
+template <typename T>
+class Float3Array {
+ public:
+  static constexpr size_t kLanes = 4;
+
+  Float3Array() = default;
+  Float3Array(const Float3Array&) = default;
+  Float3Array(Float3Array&&) = default;
+  Float3Array& operator=(const Float3Array&) = default;
+  Float3Array& operator=(Float3Array&&) = default;
+  ~Float3Array() = default;
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  // The size of the component arrays, a multiple of kLanes.
+  size_t padded_size() const { return xs_.size(); }
+
+  void reserve(size_t count) {
+    const size_t padded = PaddedSize(count);
+    xs_.reserve(padded);
+    ys_.reserve(padded);
+    zs_.reserve(padded);
+  }
+  void clear() { resize(0); }
+  // Resizes to |count| elements. The new elements are 0.
+  void resize(size_t count) {
+    const size_t padded = PaddedSize(count);
+    // The new elements in the padding of the last group may have been written.
+    for (size_t i = size_; i < std::min(count, xs_.size()); ++i) {
+      xs_[i] = ys_[i] = zs_[i] = 0;
+    }
+    xs_.resize(padded);
+    ys_.resize(padded);
+    zs_.resize(padded);
+    size_ = count;
+  }
+
+  void push_back(const T& element) {
+    if (size_ == xs_.size()) {
+      xs_.resize(size_ + kLanes);
+      ys_.resize(size_ + kLanes);
+      zs_.resize(size_ + kLanes);
+    }
+    Set(size_++, element);
+  }
+
+  T Get(size_t index) const {
+    CHECK_LT(index, size_);
+    return T(xs_[index], ys_[index], zs_[index]);
+  }
+  void Set(size_t index, const T& element) {
+    CHECK_LT(index, size_);
+    xs_[index] = element.x();
+    ys_[index] = element.y();
+    zs_[index] = element.z();
+  }
+
+  // The component arrays, of padded_size() floats each.
+  base::span<const float> xs() const { return xs_; }
+  base::span<const float> ys() const { return ys_; }
+  base::span<const float> zs() const { return zs_; }
+  base::span<float> xs() { return xs_; }
+  base::span<float> ys() { return ys_; }
+  base::span<float> zs() { return zs_; }
+
+ private:
+  static size_t PaddedSize(size_t count) {
+    return (count + kLanes - 1) / kLanes * kLanes;
+  }
+
+  std::vector<float> xs_;
+  std::vector<float> ys_;
+  std::vector<float> zs_;
+  size_t size_ = 0;
+};
+
+using Vector3dFArray = Float3Array<Vector3dF>;
+using Point3FArray = Float3Array<Point3F>;
+
+// These set results[i] to the function of the i-th elements of the arguments,
+// with the same results as the function of Vector3dF, and results must have
+// as many elements as the arguments, which have the same size.
+COMPONENT_EXPORT(GEOMETRY)
+void DotProducts(const Vector3dFArray& lhs,
+                 const Vector3dFArray& rhs,
+                 base::span<float> results);
+// |results| is resized to the size of the arguments, and may be one of them.
+COMPONENT_EXPORT(GEOMETRY)
+void CrossProducts(const Vector3dFArray& lhs,
+                   const Vector3dFArray& rhs,
+                   Vector3dFArray& results);
+COMPONENT_EXPORT(GEOMETRY)
+void Lengths(const Vector3dFArray& vectors, base::span<float> results);
+
+// Same as Vector3dF::Scale() for each element.
+COMPONENT_EXPORT(GEOMETRY)
+void ScaleVectors(Vector3dFArray& vectors, float scale);
+// Replaces each element with Vector3dF::GetNormalized() of it, which leaves
+// the elements that are too short unchanged.
+COMPONENT_EXPORT(GEOMETRY) void NormalizeVectors(Vector3dFArray& vectors);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_FLOAT3_ARRAY_H_
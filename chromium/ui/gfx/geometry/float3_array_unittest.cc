@@ -0,0 +1,109 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/float3_array.h"
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/vector3d_f.h"
+
+namespace gfx {
+namespace {
+
+// Not a multiple of the lanes, with some vectors too short to normalize.
+std::vector<Vector3dF> MakeVectors(float factor) {
+  std::vector<Vector3dF> vectors;
+  for (int i = 0; i < 11; ++i) {
+    const float v = factor * (i - 5);
+    vectors.emplace_back(v, 0.5f - v * v, i % 3 ? 1.25f * v : 1e-8f);
+  }
+  return vectors;
+}
+
+Vector3dFArray MakeArray(const std::vector<Vector3dF>& vectors) {
+  Vector3dFArray array;
+  array.reserve(vectors.size());
+  for (const Vector3dF& vector : vectors) {
+    array.push_back(vector);
+  }
+  return array;
+}
+
+TEST(Float3ArrayTest, Elements) {
+  Point3FArray array;
+  EXPECT_TRUE(array.empty());
+  array.push_back(Point3F(1, 2, 3));
+  array.push_back(Point3F(4, 5, 6));
+  EXPECT_EQ(2u, array.size());
+  EXPECT_EQ(Float3Array<Point3F>::kLanes, array.padded_size());
+  EXPECT_EQ(Point3F(4, 5, 6), array.Get(1));
+  array.Set(0, Point3F(7, 8, 9));
+  EXPECT_EQ(Point3F(7, 8, 9), array.Get(0));
+  EXPECT_EQ(7, array.xs()[0]);
+  EXPECT_EQ(6, array.zs()[1]);
+
+  // Elements that come back after a shrink are 0.
+  array.resize(1);
+  array.resize(3);
+  EXPECT_EQ(Point3F(), array.Get(1));
+  EXPECT_EQ(Point3F(), array.Get(2));
+  array.clear();
+  EXPECT_TRUE(array.empty());
+  EXPECT_EQ(0u, array.padded_size());
+}
+
+TEST(Float3ArrayTest, SameAsVector3dF) {
+  const std::vector<Vector3dF> lhs = MakeVectors(0.75f);
+  const std::vector<Vector3dF> rhs = MakeVectors(-1.5f);
+  const Vector3dFArray lhs_array = MakeArray(lhs);
+  const Vector3dFArray rhs_array = MakeArray(rhs);
+
+  std::vector<float> results(lhs.size());
+  DotProducts(lhs_array, rhs_array, results);
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(DotProduct(lhs[i], rhs[i]), results[i]) << i;
+  }
+  Lengths(lhs_array, results);
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(lhs[i].Length(), results[i]) << i;
+  }
+
+  Vector3dFArray cross;
+  CrossProducts(lhs_array, rhs_array, cross);
+  ASSERT_EQ(lhs.size(), cross.size());
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(CrossProduct(lhs[i], rhs[i]), cross.Get(i)) << i;
+  }
+  // In place.
+  Vector3dFArray in_place = lhs_array;
+  CrossProducts(in_place, rhs_array, in_place);
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(cross.Get(i), in_place.Get(i)) << i;
+  }
+
+  Vector3dFArray scaled = lhs_array;
+  ScaleVectors(scaled, -2.5f);
+  for (size_t i = 0; i < lhs.size(); ++i) {
+    EXPECT_EQ(ScaleVector3d(lhs[i], -2.5f), scaled.Get(i)) << i;
+  }
+
+  std::vector<Vector3dF> vectors = {Vector3dF(3, 4, 0), Vector3dF(1e-7f, 0, 0),
+                                    Vector3dF()};
+  vectors.insert(vectors.end(), lhs.begin(), lhs.end());
+  Vector3dFArray normalized = MakeArray(vectors);
+  NormalizeVectors(normalized);
+  for (size_t i = 0; i < vectors.size(); ++i) {
+    Vector3dF expected;
+    vectors[i].GetNormalized(&expected);
+    EXPECT_EQ(expected, normalized.Get(i)) << i;
+  }
+  EXPECT_EQ(Vector3dF(0.6f, 0.8f, 0), normalized.Get(0));
+  EXPECT_EQ(Vector3dF(1e-7f, 0, 0), normalized.Get(1));
+}
+
+}  // namespace
+}  // namespace gfx
@@ -0,0 +1,94 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/full_matrix_promotions.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <map>
+#include <utility>
+
+#include "base/no_destructor.h"
+#include "base/notreached.h"
+#include "base/synchronization/lock.h"
+
+namespace gfx {
+
+namespace {
+
+std::array<std::atomic<uint64_t>, kNumFullMatrixPromotions> g_counts;
+
+struct Callers {
+  base::Lock lock;
+  std::map<std::pair<FullMatrixPromotion, const void*>, uint64_t> counts;
+};
+
+Callers& GetCallers() {
+  static base::NoDestructor<Callers> callers;
+  return *callers;
+}
+
+}  // namespace
+
+const char* FullMatrixPromotionName(FullMatrixPromotion reason) {
+  switch (reason) {
+    case FullMatrixPromotion::kRotate:
+      return "rotate";
+    case FullMatrixPromotion::kScale3d:
+      return "scale_3d";
+    case FullMatrixPromotion::kTranslate3d:
+      return "translate_3d";
+    case FullMatrixPromotion::kApplyPerspectiveDepth:
+      return "apply_perspective_depth";
+    case FullMatrixPromotion::kSetRc:
+      return "set_rc";
+    case FullMatrixPromotion::kConcat:
+      return "concat";
+    case FullMatrixPromotion::kTranspose:
+      return "transpose";
+    case FullMatrixPromotion::kCompose:
+      return "compose";
+    case FullMatrixPromotion::kForTesting:
+      return "for_testing";
+  }
+  NOTREACHED();
+}
+
+uint64_t GetFullMatrixPromotionCount(FullMatrixPromotion reason) {
+  return g_counts[static_cast<size_t>(reason)].load(std::memory_order_relaxed);
+}
+
+std::vector<FullMatrixPromotionCaller> GetFullMatrixPromotionCallers() {
+  std::vector<FullMatrixPromotionCaller> result;
+  Callers& callers = GetCallers();
+  {
+    base::AutoLock lock(callers.lock);
+    for (const auto& [key, count] : callers.counts) {
+      result.push_back({key.first, key.second, count});
+    }
+  }
+  std::ranges::stable_sort(result, std::ranges::greater(),
+                           &FullMatrixPromotionCaller::count);
+  return result;
+}
+
+void ResetFullMatrixPromotionCountsForTesting() {
+  for (std::atomic<uint64_t>& count : g_counts) {
+    count.store(0, std::memory_order_relaxed);
+  }
+  Callers& callers = GetCallers();
+  base::AutoLock lock(callers.lock);
+  callers.counts.clear();
+}
+
+void CountFullMatrixPromotion(FullMatrixPromotion reason, const void* caller) {
+  g_counts[static_cast<size_t>(reason)].fetch_add(1,
+                                                  std::memory_order_relaxed);
+  Callers& callers = GetCallers();
+  base::AutoLock lock(callers.lock);
+  ++callers.counts[{reason, caller}];
+}
+
+}  // namespace gfx
@@ -0,0 +1,84 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_FULL_MATRIX_PROMOTIONS_H_
+#define UI_GFX_GEOMETRY_FULL_MATRIX_PROMOTIONS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "base/component_export.h"
+
+// Counts of the promotions of Transforms from AxisTransform2d or
+// AffineTransform2d to a full Matrix44, after which all their operations take the slow paths, for each
+// reason and for each caller. They show which callers knock transforms off
+// the fast paths.
+//
+// Counting is off unless GFX_COUNT_FULL_MATRIX_PROMOTIONS is defined to 1 for
+// the whole build, as it adds an atomic increment and, for the callers, a
+// locked map update to every promotion. When it's off, nothing is counted.
+#if !defined(GFX_COUNT_FULL_MATRIX_PROMOTIONS)
+#define GFX_COUNT_FULL_MATRIX_PROMOTIONS 0
+#endif
+
+namespace gfx {
+
+inline constexpr bool kCountFullMatrixPromotions =
+    GFX_COUNT_FULL_MATRIX_PROMOTIONS;
+
+// The Transform methods that promote to a full matrix.
+enum class FullMatrixPromotion : uint8_t {
+  // RotateAbout*() about an axis other than z, by a non-zero angle.
+  kRotate,
+  // Scale3d() and PostScale3d() with z != 1.
+  kScale3d,
+  // Translate3d() and PostTranslate3d() with z != 0.
+  kTranslate3d,
+  kApplyPerspectiveDepth,
+  kSetRc,
+  // PreConcat() and PostConcat() with a full matrix.
+  kConcat,
+  kTranspose,
+  // Compose() with skews.
+  kCompose,
+  kForTesting,
+  kMaxValue = kForTesting,
+};
+inline constexpr size_t kNumFullMatrixPromotions =
+    static_cast<size_t>(FullMatrixPromotion::kMaxValue) + 1;
+
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+const char* FullMatrixPromotionName(FullMatrixPromotion reason);
+
+// Returns the number of promotions for |reason|.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+uint64_t GetFullMatrixPromotionCount(FullMatrixPromotion reason);
+
+// The promotions for a reason from one caller, which is the address that the
+// promoting Transform method returns to. For Transform methods that are
+// inlined, e.g. set_rc(), it's the address that their caller returns to.
+// Symbolize it, e.g. with base::debug::StackTrace or addr2line, to find the
+// caller.
+struct FullMatrixPromotionCaller {
+  FullMatrixPromotion reason;
+  const void* caller;
+  uint64_t count;
+};
+
+// Returns the callers that have promoted, the most frequent first.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+std::vector<FullMatrixPromotionCaller> GetFullMatrixPromotionCallers();
+
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+void ResetFullMatrixPromotionCountsForTesting();
+
+// Counts a promotion. Called by Transform only if kCountFullMatrixPromotions.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+void CountFullMatrixPromotion(FullMatrixPromotion reason, const void* caller);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_FULL_MATRIX_PROMOTIONS_H_
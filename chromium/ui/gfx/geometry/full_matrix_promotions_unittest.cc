@@ -0,0 +1,79 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/full_matrix_promotions.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+TEST(FullMatrixPromotionsTest, CountsEachReason) {
+  ResetFullMatrixPromotionCountsForTesting();
+
+  Transform rotation;
+  rotation.RotateAboutXAxis(30);
+  rotation.RotateAboutYAxis(30);
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(100);
+  Transform set_rc;
+  set_rc.set_rc(0, 1, 2);
+  Transform concat = Transform::MakeTranslation(1, 2);
+  concat.PreConcat(rotation);
+
+  // These stay AxisTransform2d.
+  Transform axis;
+  axis.RotateAboutZAxis(0);
+  axis.Scale3d(2, 2, 1);
+  axis.Translate3d(1, 2, 0);
+  axis.PreConcat(Transform::MakeScale(2));
+  EXPECT_FALSE(axis.IsFullMatrixForTesting());
+  // These become AffineTransform2d.
+  Transform affine;
+  affine.RotateAboutZAxis(30);
+  affine.Skew(10, 0);
+  affine.PreConcat(Transform::Affine(1, 2, 3, 4, 5, 6));
+  EXPECT_TRUE(affine.IsAffine2dForTesting());
+
+  if (!kCountFullMatrixPromotions) {
+    for (size_t i = 0; i < kNumFullMatrixPromotions; ++i) {
+      EXPECT_EQ(0u, GetFullMatrixPromotionCount(
+                        static_cast<FullMatrixPromotion>(i)));
+    }
+    EXPECT_TRUE(GetFullMatrixPromotionCallers().empty());
+    return;
+  }
+  // Only the first rotation promotes.
+  EXPECT_EQ(1u, GetFullMatrixPromotionCount(FullMatrixPromotion::kRotate));
+  EXPECT_EQ(1u, GetFullMatrixPromotionCount(
+                    FullMatrixPromotion::kApplyPerspectiveDepth));
+  EXPECT_EQ(1u, GetFullMatrixPromotionCount(FullMatrixPromotion::kSetRc));
+  EXPECT_EQ(1u, GetFullMatrixPromotionCount(FullMatrixPromotion::kConcat));
+  EXPECT_EQ(0u, GetFullMatrixPromotionCount(FullMatrixPromotion::kScale3d));
+
+  // The same caller promoting repeatedly is counted once per promotion.
+  for (int i = 0; i < 3; ++i) {
+    Transform transform;
+    transform.ApplyPerspectiveDepth(10);
+  }
+  const std::vector<FullMatrixPromotionCaller> callers =
+      GetFullMatrixPromotionCallers();
+  ASSERT_EQ(5u, callers.size());
+  EXPECT_EQ(FullMatrixPromotion::kApplyPerspectiveDepth, callers[0].reason);
+  EXPECT_EQ(3u, callers[0].count);
+  EXPECT_TRUE(callers[0].caller);
+  EXPECT_EQ(4u, GetFullMatrixPromotionCount(
+                    FullMatrixPromotion::kApplyPerspectiveDepth));
+
+  ResetFullMatrixPromotionCountsForTesting();
+  EXPECT_EQ(0u, GetFullMatrixPromotionCount(
+                    FullMatrixPromotion::kApplyPerspectiveDepth));
+  EXPECT_TRUE(GetFullMatrixPromotionCallers().empty());
+}
+
+}  // namespace gfx
@@ -0,0 +1,138 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Microbenchmarks of the geometry hot paths with the degenerate inputs of
+// test/geometry_edge_cases.h, for the geometry_perftests target, next to the
+// well-behaved inputs of transform_perftest.cc. Each benchmark runs for every
+// edge case of its kind, labelled with the name of the case. These take the
+// slow paths, e.g. the clipping of ProjectQuad() behind the viewer and the
+// bisection of CubicBezier::Solve(), so an optimization of the common paths
+// shouldn't regress them.
+
+#include <vector>
+
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+#include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/cubic_bezier.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/test/geometry_edge_cases.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+namespace {
+
+// Returns the edge case of |cases| given by the argument of |state|.
+template <typename EdgeCase>
+EdgeCase GetEdgeCase(const std::vector<EdgeCase>& cases,
+                     benchmark::State& state) {
+  const EdgeCase& edge_case = cases[state.range(0)];
+  state.SetLabel(edge_case.name);
+  return edge_case;
+}
+
+void BM_EdgeCaseMapRect(benchmark::State& state) {
+  const Transform transform =
+      GetEdgeCase(GetTransformEdgeCases(), state).transform;
+  RectF rect = kEdgeCaseRect;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect);
+    benchmark::DoNotOptimize(transform.MapRect(rect));
+  }
+}
+
+void BM_EdgeCaseProjectQuad(benchmark::State& state) {
+  const Transform transform =
+      GetEdgeCase(GetTransformEdgeCases(), state).transform;
+  QuadF quad(kEdgeCaseRect);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(quad);
+    benchmark::DoNotOptimize(transform.ProjectQuad(quad));
+  }
+}
+
+void BM_EdgeCaseGetInverse(benchmark::State& state) {
+  const Transform transform =
+      GetEdgeCase(GetTransformEdgeCases(), state).transform;
+  for (auto _ : state) {
+    Transform inverse;
+    benchmark::DoNotOptimize(transform.GetInverse(&inverse));
+    benchmark::DoNotOptimize(inverse);
+  }
+}
+
+void BM_EdgeCaseBlend(benchmark::State& state) {
+  const Transform from = GetEdgeCase(GetTransformEdgeCases(), state).transform;
+  Transform to;
+  to.Rotate(30);
+  for (auto _ : state) {
+    Transform transform = to;
+    benchmark::DoNotOptimize(transform.Blend(from, 0.25));
+    benchmark::DoNotOptimize(transform);
+  }
+}
+
+// Solves for 101 x evenly spaced in [0, 1], as an animation would on
+// successive frames, so that the x at which a curve needs bisection are
+// included.
+void BM_EdgeCaseSolveBezier(benchmark::State& state) {
+  const CubicBezierEdgeCase edge_case =
+      GetEdgeCase(GetCubicBezierEdgeCases(), state);
+  const CubicBezier curve(edge_case.x1, edge_case.y1, edge_case.x2,
+                          edge_case.y2);
+  for (auto _ : state) {
+    for (int i = 0; i <= 100; ++i) {
+      benchmark::DoNotOptimize(curve.Solve(i / 100.0));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 101);
+}
+
+void BM_EdgeCaseBlendedBounds(benchmark::State& state) {
+  const TransformOperationsEdgeCase edge_case =
+      GetEdgeCase(GetTransformOperationsEdgeCases(), state);
+  const BoxF box(200, 500, 100, 100, 300, 200);
+  for (auto _ : state) {
+    BoxF bounds;
+    benchmark::DoNotOptimize(edge_case.to.BlendedBoundsForBox(
+        box, edge_case.from, -0.25f, 1.25f, &bounds));
+    benchmark::DoNotOptimize(bounds);
+  }
+}
+
+void BM_EdgeCaseRectOutset(benchmark::State& state) {
+  const Rect rect = GetEdgeCase(GetRectEdgeCases(), state).rect;
+  for (auto _ : state) {
+    Rect outset = rect;
+    benchmark::DoNotOptimize(outset);
+    outset.Outset(10);
+    benchmark::DoNotOptimize(outset);
+  }
+}
+
+void BM_EdgeCaseToEnclosingRect(benchmark::State& state) {
+  const RectF rect = GetEdgeCase(GetRectFEdgeCases(), state).rect;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect);
+    benchmark::DoNotOptimize(ToEnclosingRect(rect));
+  }
+}
+
+#define EDGE_CASE_BENCHMARK(name, cases) \
+  BENCHMARK(name)->ArgName("case")->DenseRange(0, (cases).size() - 1)
+
+EDGE_CASE_BENCHMARK(BM_EdgeCaseMapRect, GetTransformEdgeCases());
+EDGE_CASE_BENCHMARK(BM_EdgeCaseProjectQuad, GetTransformEdgeCases());
+EDGE_CASE_BENCHMARK(BM_EdgeCaseGetInverse, GetTransformEdgeCases());
+EDGE_CASE_BENCHMARK(BM_EdgeCaseBlend, GetTransformEdgeCases());
+EDGE_CASE_BENCHMARK(BM_EdgeCaseSolveBezier, GetCubicBezierEdgeCases());
+EDGE_CASE_BENCHMARK(BM_EdgeCaseBlendedBounds,
+                    GetTransformOperationsEdgeCases());
+EDGE_CASE_BENCHMARK(BM_EdgeCaseRectOutset, GetRectEdgeCases());
+EDGE_CASE_BENCHMARK(BM_EdgeCaseToEnclosingRect, GetRectFEdgeCases());
+
+}  // namespace
+
+}  // namespace gfx
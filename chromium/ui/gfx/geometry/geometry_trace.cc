@@ -0,0 +1,203 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/geometry_trace.h"
+
+#include <algorithm>
+
+#include "ui/gfx/geometry/cubic_bezier.h"
+#include "ui/gfx/geometry/transform_serialization.h"
+
+namespace gfx {
+
+namespace {
+
+constexpr std::array<uint8_t, 5> kHeader = {'G', 'T', 'R', 'C', 1};
+
+constinit thread_local GeometryTraceRecorder* g_current_recorder = nullptr;
+
+bool ReadRect(base::SpanReader& reader, RectF& rect) {
+  std::array<float, 4> values;
+  if (!reader.ReadFloatsLittleEndian(values)) {
+    return false;
+  }
+  rect = RectF(values[0], values[1], values[2], values[3]);
+  return true;
+}
+
+}  // namespace
+
+GeometryTraceRecorder::GeometryTraceRecorder()
+    : data_(kHeader.begin(), kHeader.end()) {}
+
+GeometryTraceRecorder::~GeometryTraceRecorder() = default;
+
+// static
+GeometryTraceRecorder* GeometryTraceRecorder::Current() {
+  return g_current_recorder;
+}
+
+GeometryTraceRecorder::ScopedRecording::ScopedRecording(
+    GeometryTraceRecorder* recorder)
+    : previous_(g_current_recorder) {
+  g_current_recorder = recorder;
+}
+
+GeometryTraceRecorder::ScopedRecording::~ScopedRecording() {
+  g_current_recorder = previous_;
+}
+
+void GeometryTraceRecorder::RecordPreConcat(const Transform& transform,
+                                            const Transform& other) {
+  base::SpanWriter writer =
+      Begin(GeometryTraceOp::kPreConcat, 2 * kMaxSerializedTransformSize);
+  WriteTransform(transform, writer);
+  WriteTransform(other, writer);
+  Finish(writer);
+}
+
+void GeometryTraceRecorder::RecordMapRect(const Transform& transform,
+                                          const RectF& rect) {
+  base::SpanWriter writer = Begin(GeometryTraceOp::kMapRect,
+                                  kMaxSerializedTransformSize +
+                                      4 * sizeof(float));
+  WriteTransform(transform, writer);
+  writer.WriteFloatsLittleEndian(std::array<float, 4>{
+      rect.x(), rect.y(), rect.width(), rect.height()});
+  Finish(writer);
+}
+
+void GeometryTraceRecorder::RecordSolveBezier(const CubicBezier& bezier,
+                                              double x) {
+  base::SpanWriter writer =
+      Begin(GeometryTraceOp::kSolveBezier, 5 * sizeof(double));
+  writer.WriteDoublesLittleEndian(std::array<double, 5>{
+      bezier.GetX1(), bezier.GetY1(), bezier.GetX2(), bezier.GetY2(), x});
+  Finish(writer);
+}
+
+base::SpanWriter GeometryTraceRecorder::Begin(GeometryTraceOp op,
+                                              size_t max_size) {
+  ++num_calls_;
+  data_.push_back(static_cast<uint8_t>(op));
+  const size_t start = data_.size();
+  data_.resize(start + max_size);
+  return base::SpanWriter(std::span(data_).subspan(start));
+}
+
+void GeometryTraceRecorder::Finish(const base::SpanWriter& writer) {
+  data_.resize(data_.size() - writer.remaining());
+}
+
+GeometryTraceReader::GeometryTraceReader(std::span<const uint8_t> data)
+    : reader_(data) {
+  std::optional<std::span<const uint8_t>> header =
+      reader_.Read(kHeader.size());
+  is_valid_ = header && std::ranges::equal(*header, kHeader);
+}
+
+std::optional<GeometryTraceCall> GeometryTraceReader::ReadNext() {
+  uint8_t op;
+  if (!is_valid_ || !reader_.ReadLittleEndian(op) ||
+      op > static_cast<uint8_t>(GeometryTraceOp::kMaxValue)) {
+    return std::nullopt;
+  }
+  GeometryTraceCall call;
+  call.op = static_cast<GeometryTraceOp>(op);
+  switch (call.op) {
+    case GeometryTraceOp::kPreConcat: {
+      std::optional<Transform> transform = ReadTransform(reader_);
+      std::optional<Transform> other =
+          transform ? ReadTransform(reader_) : std::nullopt;
+      if (!other) {
+        return std::nullopt;
+      }
+      call.transform = *transform;
+      call.other = *other;
+      return call;
+    }
+    case GeometryTraceOp::kMapRect: {
+      std::optional<Transform> transform = ReadTransform(reader_);
+      if (!transform || !ReadRect(reader_, call.rect)) {
+        return std::nullopt;
+      }
+      call.transform = *transform;
+      return call;
+    }
+    case GeometryTraceOp::kSolveBezier: {
+      std::array<double, 5> values;
+      if (!reader_.ReadDoublesLittleEndian(values)) {
+        return std::nullopt;
+      }
+      std::copy_n(values.begin(), 4, call.bezier.begin());
+      call.x = values[4];
+      return call;
+    }
+  }
+  return std::nullopt;
+}
+
+// static
+std::optional<std::vector<GeometryTraceCall>> GeometryTraceReader::ReadAll(
+    std::span<const uint8_t> data) {
+  GeometryTraceReader reader(data);
+  if (!reader.is_valid()) {
+    return std::nullopt;
+  }
+  std::vector<GeometryTraceCall> calls;
+  while (std::optional<GeometryTraceCall> call = reader.ReadNext()) {
+    calls.push_back(*call);
+  }
+  if (reader.reader_.remaining()) {
+    return std::nullopt;
+  }
+  return calls;
+}
+
+double ReplayGeometryCall(const GeometryTraceCall& call) {
+  switch (call.op) {
+    case GeometryTraceOp::kPreConcat: {
+      Transform transform = call.transform;
+      transform.PreConcat(call.other);
+      return transform.rc(0, 0) + transform.rc(0, 3);
+    }
+    case GeometryTraceOp::kMapRect: {
+      const RectF rect = call.transform.MapRect(call.rect);
+      return rect.x() + rect.bottom();
+    }
+    case GeometryTraceOp::kSolveBezier:
+      return CubicBezier(call.bezier[0], call.bezier[1], call.bezier[2],
+                         call.bezier[3])
+          .Solve(call.x);
+  }
+  return 0;
+}
+
+std::vector<uint8_t> MakeSyntheticGeometryTrace() {
+  GeometryTraceRecorder recorder;
+  const CubicBezier ease(0.25, 0.1, 0.25, 1);
+  for (int frame = 0; frame < 100; ++frame) {
+    Transform scroll = Transform::MakeTranslation(0, -frame * 16.f);
+    Transform animated = Transform::MakeScale(1 + frame / 100.f);
+    animated.Rotate(frame * 3.6);
+    Transform perspective;
+    perspective.ApplyPerspectiveDepth(800);
+    perspective.RotateAboutYAxis(frame % 45);
+    recorder.RecordSolveBezier(ease, frame / 100.0);
+    for (int layer = 0; layer < 20; ++layer) {
+      const Transform offset = Transform::MakeTranslation(layer * 10, 100);
+      const Transform& local =
+          layer % 10 == 0 ? animated : (layer % 7 == 0 ? perspective : offset);
+      recorder.RecordPreConcat(scroll, local);
+      Transform screen = scroll;
+      screen.PreConcat(local);
+      recorder.RecordMapRect(screen, RectF(0, 0, 300, 50 + layer));
+      recorder.RecordMapRect(screen, RectF(layer, 10, 20, 20));
+    }
+  }
+  const std::span<const uint8_t> data = recorder.data();
+  return std::vector<uint8_t>(data.begin(), data.end());
+}
+
+}  // namespace gfx
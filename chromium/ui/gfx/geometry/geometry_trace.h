@@ -0,0 +1,138 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_GEOMETRY_TRACE_H_
+#define UI_GFX_GEOMETRY_GEOMETRY_TRACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "base/component_export.h"
+#include "base/numerics/span_reader_writer.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+class CubicBezier;
+
+// Binary traces of geometry calls, recorded from real pages and replayed by
+// geometry_trace_perftest.cc, so that the calls are benchmarked in the mix and
+// with the operands that they really have.
+//
+// A trace is the 4 bytes "GTRC" and a version byte, followed by one record
+// per call: a GeometryTraceOp byte and its operands in little endian, with
+// transforms in the encoding of transform_serialization.h:
+// - kPreConcat: the transform and the transform that it's concatenated with;
+// - kMapRect: the transform and the rect, as 4 floats;
+// - kSolveBezier: the 4 control point coordinates of the curve and x, as
+//   doubles.
+enum class GeometryTraceOp : uint8_t {
+  kPreConcat,
+  kMapRect,
+  kSolveBezier,
+  kMaxValue = kSolveBezier,
+};
+
+// One call of a trace.
+struct COMPONENT_EXPORT(GEOMETRY_SKIA) GeometryTraceCall {
+  GeometryTraceOp op;
+  Transform transform;
+  // kPreConcat only.
+  Transform other;
+  // kMapRect only.
+  RectF rect;
+  // kSolveBezier only: x1, y1, x2, y2.
+  std::array<double, 4> bezier = {};
+  double x = 0;
+};
+
+// Records calls into a trace. The recorder of the current thread, if there
+// is one, is the hook where callers record their calls:
+//   if (auto* recorder = GeometryTraceRecorder::Current()) [[unlikely]] {
+//     recorder->RecordMapRect(transform, rect);
+//   }
+// The Transform methods themselves aren't instrumented, to keep the check
+// out of their hot paths.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) GeometryTraceRecorder {
+ public:
+  GeometryTraceRecorder();
+  GeometryTraceRecorder(const GeometryTraceRecorder&) = delete;
+  GeometryTraceRecorder& operator=(const GeometryTraceRecorder&) = delete;
+  ~GeometryTraceRecorder();
+
+  // Returns the recorder of the current thread, or null.
+  static GeometryTraceRecorder* Current();
+
+  // Makes |recorder| the recorder of the current thread for the lifetime of
+  // this object.
+  class COMPONENT_EXPORT(GEOMETRY_SKIA) ScopedRecording {
+   public:
+    explicit ScopedRecording(GeometryTraceRecorder* recorder);
+    ScopedRecording(const ScopedRecording&) = delete;
+    ScopedRecording& operator=(const ScopedRecording&) = delete;
+    ~ScopedRecording();
+
+   private:
+    GeometryTraceRecorder* const previous_;
+  };
+
+  void RecordPreConcat(const Transform& transform, const Transform& other);
+  void RecordMapRect(const Transform& transform, const RectF& rect);
+  void RecordSolveBezier(const CubicBezier& bezier, double x);
+
+  // The trace so far.
+  std::span<const uint8_t> data() const { return data_; }
+  size_t num_calls() const { return num_calls_; }
+
+ private:
+  // Appends room for |max_size| bytes and returns a writer over it. Finish()
+  // drops the room that the writer didn't use.
+  base::SpanWriter Begin(GeometryTraceOp op, size_t max_size);
+  void Finish(const base::SpanWriter& writer);
+
+  std::vector<uint8_t> data_;
+  size_t num_calls_ = 0;
+};
+
+// Reads the calls of a trace, e.g. of a memory-mapped file, which must
+// outlive the reader.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) GeometryTraceReader {
+ public:
+  explicit GeometryTraceReader(std::span<const uint8_t> data);
+
+  // Whether the trace has a valid header.
+  bool is_valid() const { return is_valid_; }
+
+  // Returns the next call, or nullopt at the end of the trace or if the rest
+  // of the trace isn't valid.
+  std::optional<GeometryTraceCall> ReadNext();
+
+  // Reads all the calls. Returns nullopt if the trace isn't entirely valid.
+  static std::optional<std::vector<GeometryTraceCall>> ReadAll(
+      std::span<const uint8_t> data);
+
+ private:
+  base::SpanReader reader_;
+  bool is_valid_ = false;
+};
+
+// Makes |call| and returns a value of its result, so that replays can't be
+// optimized away and can be checked against each other.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+double ReplayGeometryCall(const GeometryTraceCall& call);
+
+// Returns a synthetic trace of a page of scrolled and animated layers, for
+// when there's no recorded one.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+std::vector<uint8_t> MakeSyntheticGeometryTrace();
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_GEOMETRY_TRACE_H_
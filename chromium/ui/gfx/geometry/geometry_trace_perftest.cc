@@ -0,0 +1,123 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Replays a trace of geometry calls recorded with GeometryTraceRecorder (see
+// geometry_trace.h), for the geometry_perftests target. The trace is the file
+// named by the GEOMETRY_TRACE environment variable, which is memory mapped,
+// or, without one, a synthetic trace of a page of scrolled and animated
+// layers. Each benchmark reports the calls replayed per second. Hardware
+// counters are reported with e.g.
+// --benchmark_perf_counters=CYCLES,INSTRUCTIONS,CACHE-MISSES, in builds of
+// google_benchmark with libpfm.
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "base/check.h"
+#include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/no_destructor.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+#include "ui/gfx/geometry/geometry_trace.h"
+
+namespace gfx {
+
+namespace {
+
+// Returns the bytes of the trace, which live until the end of the process.
+std::span<const uint8_t> GetTraceData() {
+  static base::NoDestructor<base::MemoryMappedFile> mapped_file;
+  static base::NoDestructor<std::vector<uint8_t>> synthetic_trace;
+  static const std::span<const uint8_t> data = [] {
+    if (const char* path = getenv("GEOMETRY_TRACE")) {
+      CHECK(mapped_file->Initialize(base::FilePath::FromUTF8Unsafe(path)))
+          << "Can't map " << path;
+      return std::span<const uint8_t>(mapped_file->bytes());
+    }
+    *synthetic_trace = MakeSyntheticGeometryTrace();
+    return std::span<const uint8_t>(*synthetic_trace);
+  }();
+  return data;
+}
+
+const std::vector<GeometryTraceCall>& GetTraceCalls() {
+  static base::NoDestructor<std::vector<GeometryTraceCall>> calls([] {
+    std::optional<std::vector<GeometryTraceCall>> result =
+        GeometryTraceReader::ReadAll(GetTraceData());
+    CHECK(result) << "Invalid geometry trace";
+    return *std::move(result);
+  }());
+  return *calls;
+}
+
+void SetCallsPerSecond(benchmark::State& state, size_t calls_per_iteration) {
+  state.counters["calls_per_second"] = benchmark::Counter(
+      static_cast<double>(calls_per_iteration), benchmark::Counter::kIsRate);
+}
+
+// Replays the whole trace in order, as recorded.
+void BM_ReplayTrace(benchmark::State& state) {
+  const std::vector<GeometryTraceCall>& calls = GetTraceCalls();
+  for (auto _ : state) {
+    double result = 0;
+    for (const GeometryTraceCall& call : calls) {
+      result += ReplayGeometryCall(call);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  SetCallsPerSecond(state, calls.size());
+}
+
+// Replays only the calls of one GeometryTraceOp.
+void BM_ReplayTraceOp(benchmark::State& state) {
+  const auto op = static_cast<GeometryTraceOp>(state.range(0));
+  std::vector<GeometryTraceCall> calls;
+  for (const GeometryTraceCall& call : GetTraceCalls()) {
+    if (call.op == op) {
+      calls.push_back(call);
+    }
+  }
+  if (calls.empty()) {
+    state.SkipWithError("No calls of this op in the trace");
+    return;
+  }
+  for (auto _ : state) {
+    double result = 0;
+    for (const GeometryTraceCall& call : calls) {
+      result += ReplayGeometryCall(call);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  SetCallsPerSecond(state, calls.size());
+}
+
+// Decodes the trace, which is the cost of reading the transforms of
+// transform_serialization.h.
+void BM_DecodeTrace(benchmark::State& state) {
+  const std::span<const uint8_t> data = GetTraceData();
+  size_t num_calls = 0;
+  for (auto _ : state) {
+    GeometryTraceReader reader(data);
+    num_calls = 0;
+    while (std::optional<GeometryTraceCall> call = reader.ReadNext()) {
+      benchmark::DoNotOptimize(call);
+      ++num_calls;
+    }
+  }
+  SetCallsPerSecond(state, num_calls);
+}
+
+BENCHMARK(BM_ReplayTrace);
+BENCHMARK(BM_ReplayTraceOp)
+    ->ArgName("op")
+    ->DenseRange(0, static_cast<int>(GeometryTraceOp::kMaxValue));
+BENCHMARK(BM_DecodeTrace);
+
+}  // namespace
+
+}  // namespace gfx
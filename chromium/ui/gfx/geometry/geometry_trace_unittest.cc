@@ -0,0 +1,79 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/geometry_trace.h"
+
+#include <stdint.h>
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/cubic_bezier.h"
+
+namespace gfx {
+
+TEST(GeometryTraceTest, RecordAndReplay) {
+  GeometryTraceRecorder recorder;
+  EXPECT_FALSE(GeometryTraceRecorder::Current());
+  Transform rotation;
+  rotation.Rotate(30);
+  const Transform translation = Transform::MakeTranslation(10, 20);
+  const CubicBezier bezier(0.25, 0.1, 0.25, 1);
+  {
+    GeometryTraceRecorder::ScopedRecording scoped_recording(&recorder);
+    ASSERT_EQ(&recorder, GeometryTraceRecorder::Current());
+    GeometryTraceRecorder::Current()->RecordPreConcat(translation, rotation);
+    GeometryTraceRecorder::Current()->RecordMapRect(rotation,
+                                                    RectF(1, 2, 3, 4));
+    GeometryTraceRecorder::Current()->RecordSolveBezier(bezier, 0.5);
+  }
+  EXPECT_FALSE(GeometryTraceRecorder::Current());
+  EXPECT_EQ(3u, recorder.num_calls());
+
+  std::optional<std::vector<GeometryTraceCall>> calls =
+      GeometryTraceReader::ReadAll(recorder.data());
+  ASSERT_TRUE(calls);
+  ASSERT_EQ(3u, calls->size());
+
+  const GeometryTraceCall& concat = (*calls)[0];
+  EXPECT_EQ(GeometryTraceOp::kPreConcat, concat.op);
+  EXPECT_EQ(translation, concat.transform);
+  EXPECT_EQ(rotation, concat.other);
+  Transform expected_concat = translation;
+  expected_concat.PreConcat(rotation);
+  EXPECT_EQ(expected_concat.rc(0, 0) + expected_concat.rc(0, 3),
+            ReplayGeometryCall(concat));
+
+  const GeometryTraceCall& map_rect = (*calls)[1];
+  EXPECT_EQ(GeometryTraceOp::kMapRect, map_rect.op);
+  EXPECT_EQ(RectF(1, 2, 3, 4), map_rect.rect);
+  const RectF mapped = rotation.MapRect(RectF(1, 2, 3, 4));
+  EXPECT_EQ(mapped.x() + mapped.bottom(), ReplayGeometryCall(map_rect));
+
+  const GeometryTraceCall& solve = (*calls)[2];
+  EXPECT_EQ(GeometryTraceOp::kSolveBezier, solve.op);
+  EXPECT_EQ(bezier.Solve(0.5), ReplayGeometryCall(solve));
+}
+
+TEST(GeometryTraceTest, InvalidTraces) {
+  GeometryTraceRecorder recorder;
+  recorder.RecordMapRect(Transform(), RectF(1, 2, 3, 4));
+  const std::span<const uint8_t> data = recorder.data();
+
+  EXPECT_FALSE(GeometryTraceReader(data.first(4u)).is_valid());
+  EXPECT_FALSE(GeometryTraceReader::ReadAll(data.first(data.size() - 1)));
+
+  std::vector<uint8_t> bad_op(data.begin(), data.end());
+  bad_op[5] = 0xff;
+  EXPECT_FALSE(GeometryTraceReader::ReadAll(bad_op));
+
+  std::optional<std::vector<GeometryTraceCall>> empty =
+      GeometryTraceReader::ReadAll(data.first(5u));
+  ASSERT_TRUE(empty);
+  EXPECT_TRUE(empty->empty());
+}
+
+}  // namespace gfx
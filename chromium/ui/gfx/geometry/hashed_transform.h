@@ -0,0 +1,52 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_HASHED_TRANSFORM_H_
+#define UI_GFX_GEOMETRY_HASHED_TRANSFORM_H_
+
+#include <stddef.h>
+
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+// Hashes Transforms with Transform::Hash(), for hash maps keyed by
+// Transform, e.g. std::unordered_map<Transform, int, TransformHash>.
+struct TransformHash {
+  size_t operator()(const Transform& transform) const {
+    return transform.Hash();
+  }
+};
+
+// An immutable Transform with its hash, for keys that are looked up
+// repeatedly, e.g. to deduplicate the transforms of a frame. The hash is
+// computed once, on construction, and two keys with different hashes are
+// unequal without comparing their transforms.
+class HashedTransform {
+ public:
+  HashedTransform() : hash_(transform_.Hash()) {}
+  explicit HashedTransform(const Transform& transform)
+      : transform_(transform), hash_(transform.Hash()) {}
+
+  const Transform& transform() const { return transform_; }
+  size_t hash() const { return hash_; }
+
+  friend bool operator==(const HashedTransform& a, const HashedTransform& b) {
+    return a.hash_ == b.hash_ && a.transform_ == b.transform_;
+  }
+
+  struct Hasher {
+    size_t operator()(const HashedTransform& transform) const {
+      return transform.hash();
+    }
+  };
+
+ private:
+  Transform transform_;
+  size_t hash_;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_HASHED_TRANSFORM_H_
@@ -0,0 +1,88 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/hashed_transform.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/vector2d_f.h"
+
+namespace gfx {
+
+namespace {
+
+// Returns |transform| backed by a full matrix.
+Transform FullMatrix(const Transform& transform) {
+  Transform full = transform;
+  full.EnsureFullMatrixForTesting();
+  return full;
+}
+
+}  // namespace
+
+TEST(HashedTransformTest, EqualTransformsHashEqual) {
+  Transform scale_and_translation = Transform::MakeScale(2, 0.5f);
+  scale_and_translation.PostTranslate(Vector2dF(10, -20));
+  Transform rotation;
+  rotation.RotateAboutZAxis(30);
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(100);
+
+  for (const Transform& transform :
+       {Transform(), Transform::MakeTranslation(1, 2), scale_and_translation,
+        rotation, perspective}) {
+    SCOPED_TRACE(transform.ToString());
+    const Transform full = FullMatrix(transform);
+    EXPECT_TRUE(full.IsFullMatrixForTesting());
+    ASSERT_EQ(transform, full);
+    EXPECT_EQ(transform.Hash(), full.Hash());
+  }
+
+  // -0 and 0 are equal.
+  EXPECT_EQ(Transform::MakeTranslation(0, 0).Hash(),
+            Transform::MakeTranslation(-0.f, 0).Hash());
+  EXPECT_EQ(Transform().Hash(),
+            FullMatrix(Transform::MakeTranslation(-0.f, -0.f)).Hash());
+}
+
+TEST(HashedTransformTest, DifferentTransformsHashDifferently) {
+  std::unordered_set<size_t> hashes;
+  for (int i = 0; i < 100; ++i) {
+    hashes.insert(Transform::MakeTranslation(i % 10, i / 10).Hash());
+    hashes.insert(Transform::MakeScale(i + 2).Hash());
+    Transform matrix = FullMatrix(Transform::MakeTranslation(i, 0));
+    matrix.set_rc(3, 0, 0.25);
+    hashes.insert(matrix.Hash());
+  }
+  EXPECT_EQ(300u, hashes.size());
+
+  // A 3d scale isn't a 2d scale.
+  Transform scale_3d;
+  scale_3d.Scale3d(2, 2, 2);
+  EXPECT_NE(Transform::MakeScale(2).Hash(), scale_3d.Hash());
+}
+
+TEST(HashedTransformTest, HashMap) {
+  Transform translation = Transform::MakeTranslation(5, 6);
+  const HashedTransform key(translation);
+  EXPECT_EQ(translation.Hash(), key.hash());
+  EXPECT_EQ(translation, key.transform());
+  EXPECT_EQ(Transform().Hash(), HashedTransform().hash());
+
+  std::unordered_map<HashedTransform, int, HashedTransform::Hasher> map;
+  map[key] = 1;
+  map[HashedTransform(FullMatrix(translation))] = 2;
+  map[HashedTransform(Transform::MakeTranslation(6, 5))] = 3;
+  ASSERT_EQ(2u, map.size());
+  EXPECT_EQ(2, map[key]);
+
+  std::unordered_map<Transform, int, TransformHash> transforms;
+  transforms[translation] = 1;
+  transforms[FullMatrix(translation)] = 2;
+  EXPECT_EQ(1u, transforms.size());
+}
+
+}  // namespace gfx
@@ -10,6 +10,7 @@
 
 #include "base/component_export.h"
 #include "base/numerics/clamped_math.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/size.h"
 
 namespace gfx {
@@ -118,18 +119,14 @@ class InsetsOutsetsBase {
   friend bool operator==(const InsetsOutsetsBase<T>&,
                          const InsetsOutsetsBase<T>&) = default;
 
+  // These saturate each edge as base::ClampAdd() and base::ClampSub(), and
+  // then clamp the bottom and right as the setters do, in Int4 lanes.
   void operator+=(const T& other) {
-    top_ = base::ClampAdd(top_, other.top_);
-    left_ = base::ClampAdd(left_, other.left_);
-    bottom_ = ClampBottomOrRight(top_, base::ClampAdd(bottom_, other.bottom_));
-    right_ = ClampBottomOrRight(left_, base::ClampAdd(right_, other.right_));
+    SetFromInt4(ClampAdd4(ToInt4(), other.ToInt4()));
   }
 
   void operator-=(const T& other) {
-    top_ = base::ClampSub(top_, other.top_);
-    left_ = base::ClampSub(left_, other.left_);
-    bottom_ = ClampBottomOrRight(top_, base::ClampSub(bottom_, other.bottom_));
-    right_ = ClampBottomOrRight(left_, base::ClampSub(right_, other.right_));
+    SetFromInt4(ClampSub4(ToInt4(), other.ToInt4()));
   }
 
   T operator-() const {
@@ -152,6 +149,21 @@ class InsetsOutsetsBase {
     return base::ClampAdd(top_or_left, bottom_or_right) - top_or_left;
   }
 
+  // Returns {top, left, bottom, right}. The edges aren't stored as an Int4
+  // because of its alignment requirements (see double4.h).
+  Int4 ToInt4() const { return Int4{top_, left_, bottom_, right_}; }
+
+  // Sets the edges to the lanes of |v| as TLBR(), with ClampBottomOrRight()
+  // in the lanes.
+  void SetFromInt4(Int4 v) {
+    const Int4 top_left = {v[0], v[1], v[0], v[1]};
+    const Int4 clamped = ClampAdd4(top_left, v) - top_left;
+    top_ = v[0];
+    left_ = v[1];
+    bottom_ = clamped[2];
+    right_ = clamped[3];
+  }
+
   int top_ = 0;
   int left_ = 0;
   int bottom_ = 0;
@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "base/component_export.h"
+#include "ui/gfx/geometry/double4.h"
 
 namespace gfx {
 
@@ -91,10 +92,7 @@ class InsetsOutsetsFBase {
   }
 
   void Scale(float x_scale, float y_scale) {
-    top_ *= y_scale;
-    left_ *= x_scale;
-    bottom_ *= y_scale;
-    right_ *= x_scale;
+    SetFromFloat4(ToFloat4() * Float4{y_scale, x_scale, y_scale, x_scale});
   }
   void Scale(float scale) { Scale(scale, scale); }
 
@@ -102,17 +100,11 @@ class InsetsOutsetsFBase {
                          const InsetsOutsetsFBase<T>&) = default;
 
   void operator+=(const T& other) {
-    top_ += other.top_;
-    left_ += other.left_;
-    bottom_ += other.bottom_;
-    right_ += other.right_;
+    SetFromFloat4(ToFloat4() + other.ToFloat4());
   }
 
   void operator-=(const T& other) {
-    top_ -= other.top_;
-    left_ -= other.left_;
-    bottom_ -= other.bottom_;
-    right_ -= other.right_;
+    SetFromFloat4(ToFloat4() - other.ToFloat4());
   }
 
   T operator-() const {
@@ -124,6 +116,17 @@ class InsetsOutsetsFBase {
   COMPONENT_EXPORT(GEOMETRY) std::string ToString() const;
 
  private:
+  // Returns {top, left, bottom, right}, for the arithmetic above with a vector
+  // op for the 4 edges. The edges aren't stored as a Float4 because of its
+  // alignment requirements (see double4.h).
+  Float4 ToFloat4() const { return Float4{top_, left_, bottom_, right_}; }
+  void SetFromFloat4(Float4 v) {
+    top_ = v[0];
+    left_ = v[1];
+    bottom_ = v[2];
+    right_ = v[3];
+  }
+
   float top_ = 0.f;
   float left_ = 0.f;
   float bottom_ = 0.f;
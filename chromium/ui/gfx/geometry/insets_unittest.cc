@@ -4,6 +4,9 @@
 
 #include "ui/gfx/geometry/insets.h"
 
+#include <limits>
+
+#include "base/numerics/clamped_math.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/outsets.h"
 #include "ui/gfx/geometry/rect.h"
@@ -366,6 +369,39 @@ TEST(InsetsTest, IntegerUnderflowOffset) {
             insets);
 }
 
+TEST(InsetsTest, OperatorsSaturateEachEdge) {
+  constexpr int int_max = std::numeric_limits<int>::max();
+  constexpr int int_min = std::numeric_limits<int>::min();
+  const int values[] = {0, 1, -7, int_max, int_min, int_max - 3, int_min + 5};
+  for (int a : values) {
+    for (int b : values) {
+      // -int_min overflows, so b is negated with saturation. int_min is still
+      // an edge of both sides, at the positions of a and b.
+      const int negated_b = base::ClampSub(0, b);
+      const Insets lhs = Insets::TLBR(a, b, negated_b, a / 2);
+      const Insets rhs = Insets::TLBR(b, a, a, negated_b / 3);
+      // The same as the edges added or subtracted one at a time, and then set
+      // with the clamping of TLBR().
+      Insets sum = lhs;
+      sum += rhs;
+      EXPECT_EQ(Insets::TLBR(base::ClampAdd(lhs.top(), rhs.top()),
+                             base::ClampAdd(lhs.left(), rhs.left()),
+                             base::ClampAdd(lhs.bottom(), rhs.bottom()),
+                             base::ClampAdd(lhs.right(), rhs.right())),
+                sum)
+          << a << " " << b;
+      Insets difference = lhs;
+      difference -= rhs;
+      EXPECT_EQ(Insets::TLBR(base::ClampSub(lhs.top(), rhs.top()),
+                             base::ClampSub(lhs.left(), rhs.left()),
+                             base::ClampSub(lhs.bottom(), rhs.bottom()),
+                             base::ClampSub(lhs.right(), rhs.right())),
+                difference)
+          << a << " " << b;
+    }
+  }
+}
+
 TEST(InsetsTest, Size) {
   Insets insets = Insets().set_left_right(2, 4).set_top_bottom(1, 3);
   EXPECT_EQ(Size(6, 4), insets.size());
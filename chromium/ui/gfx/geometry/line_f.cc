@@ -0,0 +1,64 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/line_f.h"
+
+#include <algorithm>
+
+namespace gfx {
+
+std::vector<SegmentIntersection> FindSegmentIntersections(
+    base::span<const LineF> segments) {
+  struct Bounds {
+    float min_x;
+    float max_x;
+    float min_y;
+    float max_y;
+    size_t index;
+  };
+  std::vector<Bounds> sorted_bounds;
+  sorted_bounds.reserve(segments.size());
+  for (size_t i = 0; i < segments.size(); ++i) {
+    const LineF& segment = segments[i];
+    sorted_bounds.push_back({std::min(segment.p1.x(), segment.p2.x()),
+                             std::max(segment.p1.x(), segment.p2.x()),
+                             std::min(segment.p1.y(), segment.p2.y()),
+                             std::max(segment.p1.y(), segment.p2.y()), i});
+  }
+  std::ranges::sort(sorted_bounds, {}, &Bounds::min_x);
+
+  // The segments that may still overlap the next ones, i.e. whose right end
+  // is at or after the left end of the last one. Those that end before it are
+  // removed while testing it against the others.
+  std::vector<Bounds> active;
+  std::vector<SegmentIntersection> intersections;
+  for (const Bounds& bounds : sorted_bounds) {
+    size_t num_active = 0;
+    for (const Bounds& other : active) {
+      if (other.max_x < bounds.min_x) {
+        continue;
+      }
+      active[num_active++] = other;
+      if (other.max_y < bounds.min_y || other.min_y > bounds.max_y) {
+        continue;
+      }
+      const auto [index1, index2] = std::minmax(bounds.index, other.index);
+      if (std::optional<PointF> point =
+              segments[index1].SegmentIntersectionWith(segments[index2])) {
+        intersections.push_back({index1, index2, *point});
+      }
+    }
+    active.resize(num_active);
+    active.push_back(bounds);
+  }
+
+  std::ranges::sort(intersections, {},
+                    [](const SegmentIntersection& intersection) {
+                      return std::pair(intersection.index1,
+                                       intersection.index2);
+                    });
+  return intersections;
+}
+
+}  // namespace gfx
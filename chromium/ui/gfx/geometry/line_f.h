@@ -5,9 +5,14 @@
 #ifndef UI_GFX_GEOMETRY_LINE_F_H_
 #define UI_GFX_GEOMETRY_LINE_F_H_
 
+#include <stddef.h>
+
 #include <optional>
 #include <utility>
+#include <vector>
 
+#include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/vector2d_f.h"
 
@@ -33,8 +38,54 @@ struct LineF {
     const float param = CrossProduct(other.p1 - p1, b_length) / denom;
     return p1 + ScaleVector2d(a_length, param);
   }
+
+  // Same as IntersectionWith(), but for the segments from p1 to p2, including
+  // their end points, rather than for the lines through them.
+  inline std::optional<gfx::PointF> SegmentIntersectionWith(
+      const gfx::LineF& other) const {
+    const Vector2dF a_length = p2 - p1;
+    const Vector2dF b_length = other.p2 - other.p1;
+    const float denom = CrossProduct(a_length, b_length);
+    if (!denom) {
+      return std::nullopt;
+    }
+
+    const Vector2dF p1_delta = p1 - other.p1;
+    const float param = CrossProduct(b_length, p1_delta) / denom;
+    const float other_param = CrossProduct(a_length, p1_delta) / denom;
+    if (!(param >= 0 && param <= 1 && other_param >= 0 && other_param <= 1)) {
+      return std::nullopt;
+    }
+    return p1 + ScaleVector2d(a_length, param);
+  }
 };
 
+// An intersection found by FindSegmentIntersections().
+struct SegmentIntersection {
+  // The indices of the segments, with index1 < index2.
+  size_t index1;
+  size_t index2;
+  // segments[index1].SegmentIntersectionWith(segments[index2]).
+  PointF point;
+
+  friend bool operator==(const SegmentIntersection&,
+                         const SegmentIntersection&) = default;
+};
+
+// Returns the intersections of all the pairs of |segments| for which
+// SegmentIntersectionWith() has a value, sorted by index1 and then index2.
+// Segments sharing an end point intersect, so that callers checking a polygon
+// for self-intersections should skip the pairs of adjacent edges. Parallel
+// segments never intersect, even if they overlap.
+//
+// Instead of testing all the pairs, it sweeps the segments in order of their
+// left end, keeping those that overlap the sweep line, and only tests the
+// pairs whose bounds overlap. For the edges of typical polygons, that's close
+// to O(n log n), rather than O(n^2).
+COMPONENT_EXPORT(GEOMETRY)
+std::vector<SegmentIntersection> FindSegmentIntersections(
+    base::span<const LineF> segments);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_LINE_F_H_
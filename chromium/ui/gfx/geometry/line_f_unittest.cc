@@ -6,7 +6,10 @@
 
 #include <stddef.h>
 
+#include <cmath>
+#include <numbers>
 #include <optional>
+#include <vector>
 
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/point_conversions.h"
@@ -37,4 +40,70 @@ TEST(LineFTest, Intersection) {
             ToRoundedPoint(PointF(-15.2941, 12.9412)));
 }
 
+TEST(LineFTest, SegmentIntersection) {
+  EXPECT_EQ(
+      LineF({10, 10}, {100, 10}).SegmentIntersectionWith({{50, 0}, {50, 100}}),
+      PointF(50, 10));
+  EXPECT_EQ(
+      LineF({10, 10}, {100, 10}).SegmentIntersectionWith({{50, 20}, {50, 30}}),
+      std::nullopt);
+  EXPECT_EQ(
+      LineF({10, 10}, {40, 10}).SegmentIntersectionWith({{50, 0}, {50, 100}}),
+      std::nullopt);
+  // End points.
+  EXPECT_EQ(
+      LineF({0, 0}, {10, 10}).SegmentIntersectionWith({{10, 10}, {20, 0}}),
+      PointF(10, 10));
+  EXPECT_EQ(LineF({0, 0}, {10, 0}).SegmentIntersectionWith({{5, 0}, {5, 10}}),
+            PointF(5, 0));
+  // Parallel.
+  EXPECT_EQ(LineF({0, 0}, {10, 0}).SegmentIntersectionWith({{5, 0}, {20, 0}}),
+            std::nullopt);
+  // Same as IntersectionWith() when the segments intersect.
+  const LineF a({0, -10}, {-20, 20});
+  const LineF b({-10, 20}, {-100, -100});
+  EXPECT_EQ(a.SegmentIntersectionWith(b), a.IntersectionWith(b));
+}
+
+TEST(LineFTest, FindSegmentIntersections) {
+  EXPECT_TRUE(FindSegmentIntersections(std::vector<LineF>()).empty());
+
+  // Two diagonals and a horizontal segment through them, and a segment away
+  // from the others.
+  std::vector<LineF> segments = {{{0, 0}, {20, 20}},
+                                 {{0, 20}, {20, 0}},
+                                 {{30, 0}, {40, 10}},
+                                 {{-5, 5}, {25, 5}}};
+  EXPECT_EQ(FindSegmentIntersections(segments),
+            std::vector<SegmentIntersection>(
+                {{0, 1, PointF(10, 10)},
+                 {0, 3, *segments[0].SegmentIntersectionWith(segments[3])},
+                 {1, 3, *segments[1].SegmentIntersectionWith(segments[3])}}));
+
+  // A self-intersecting polygon with many edges, compared with testing all
+  // the pairs.
+  segments.clear();
+  constexpr int kNumVertices = 301;
+  auto vertex = [](int i) {
+    // A star polygon that visits every 100th vertex of a circle.
+    float angle = 2 * std::numbers::pi_v<float> * ((i * 100) % kNumVertices) /
+                  kNumVertices;
+    return PointF(1000 * std::cos(angle), 1000 * std::sin(angle));
+  };
+  for (int i = 0; i < kNumVertices; ++i) {
+    segments.push_back({vertex(i), vertex(i + 1)});
+  }
+  std::vector<SegmentIntersection> expected;
+  for (size_t i = 0; i < segments.size(); ++i) {
+    for (size_t j = i + 1; j < segments.size(); ++j) {
+      if (std::optional<PointF> point =
+              segments[i].SegmentIntersectionWith(segments[j])) {
+        expected.push_back({i, j, *point});
+      }
+    }
+  }
+  EXPECT_GT(expected.size(), 1000u);
+  EXPECT_EQ(expected, FindSegmentIntersections(segments));
+}
+
 }  // namespace gfx
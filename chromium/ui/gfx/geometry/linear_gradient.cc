@@ -4,19 +4,112 @@
 
 #include "ui/gfx/geometry/linear_gradient.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <optional>
 #include <sstream>
 
 #include "base/check_op.h"
+#include "base/compiler_specific.h"
 #include "base/containers/adapters.h"
 #include "base/numerics/angle_conversions.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
 #include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/transform.h"
 
 namespace gfx {
 
+namespace {
+
+static_assert(LinearGradient::kMaxStepSize == 8,
+              "The fractions are loaded into two Float4s");
+
+// Returns the fractions of the steps from |begin|, with infinity for the
+// steps past |step_count|, so that no position is after them.
+ALWAYS_INLINE Float4 LoadFractions(const LinearGradient::StepArray& steps,
+                                   size_t step_count,
+                                   size_t begin) {
+  Float4 fractions;
+  for (size_t i = 0; i < 4; ++i) {
+    fractions[i] = begin + i < step_count
+                       ? steps[begin + i].fraction
+                       : std::numeric_limits<float>::infinity();
+  }
+  return fractions;
+}
+
+ALWAYS_INLINE uint8_t EvaluateAlphaAt(const LinearGradient::StepArray& steps,
+                                      size_t step_count,
+                                      Float4 low_fractions,
+                                      Float4 high_fractions,
+                                      float position) {
+  // The comparisons are -1 in the lanes where they hold, so this counts the
+  // steps at or before |position|, which is the index of the step after it.
+  const FloatBoolean4 at_or_before =
+      (low_fractions <= position) + (high_fractions <= position);
+  const size_t next = static_cast<size_t>(
+      -(at_or_before[0] + at_or_before[1] + at_or_before[2] + at_or_before[3]));
+  if (next == 0) {
+    return steps[0].alpha;
+  }
+  if (next == step_count) {
+    return steps[step_count - 1].alpha;
+  }
+  const LinearGradient::Step& before = steps[next - 1];
+  const LinearGradient::Step& after = steps[next];
+  const float t =
+      (position - before.fraction) / (after.fraction - before.fraction);
+  return static_cast<uint8_t>(
+      std::lround(before.alpha + (after.alpha - before.alpha) * t));
+}
+
+// Returns |angle| transformed as by LinearGradient::ApplyTransform(), given the
+// mapping of the origin by |transform|.
+int16_t TransformAngle(const Transform& transform,
+                       const PointF& origin,
+                       int16_t angle) {
+  float radian = base::DegToRad(static_cast<float>(angle));
+  float y = -sin(radian);
+  float x = cos(radian);
+  PointF end = transform.MapPoint(PointF(x, y));
+  Vector2dF diff = end - origin;
+  float new_angle = base::RadToDeg(atan2(diff.y(), diff.x()));
+  return -static_cast<int16_t>(std::round(new_angle));
+}
+
+int16_t TransformAngle(const AxisTransform2d& transform, int16_t angle) {
+  float radian = base::DegToRad(static_cast<float>(angle));
+  float y = -sin(radian) * transform.scale().y();
+  float x = cos(radian) * transform.scale().x();
+  float new_angle = base::RadToDeg(atan2(y, x));
+  return -static_cast<int16_t>(std::round(new_angle));
+}
+
+// Sets the angle of each of |gradients| to |transform_angle| of it. Gradients
+// under one transform tend to share their angles, so the result for the
+// previous angle is reused.
+template <typename TransformAngleFunction>
+void TransformAngles(base::span<LinearGradient> gradients,
+                     TransformAngleFunction transform_angle) {
+  std::optional<int16_t> last_angle;
+  int16_t last_result = 0;
+  for (LinearGradient& gradient : gradients) {
+    if (gradient.angle() != last_angle) {
+      last_angle = gradient.angle();
+      last_result = transform_angle(gradient.angle());
+    }
+    gradient.set_angle(last_result);
+  }
+}
+
+}  // namespace
+
 // static
 LinearGradient& LinearGradient::GetEmpty() {
   static LinearGradient kEmpty;
@@ -49,29 +142,70 @@ void LinearGradient::ReverseSteps() {
     steps_[i].fraction = 1.f - steps_[i].fraction;
 }
 
+uint8_t LinearGradient::EvaluateAlpha(float position) const {
+  if (IsEmpty()) {
+    return 255;
+  }
+  return EvaluateAlphaAt(steps_, step_count_,
+                         LoadFractions(steps_, step_count_, 0),
+                         LoadFractions(steps_, step_count_, 4), position);
+}
+
+void LinearGradient::EvaluateAlphaMany(base::span<const float> positions,
+                                       base::span<uint8_t> alphas) const {
+  CheckBatchSpans(positions, alphas);
+  if (IsEmpty()) {
+    std::ranges::fill(alphas, 255);
+    return;
+  }
+  const Float4 low_fractions = LoadFractions(steps_, step_count_, 0);
+  const Float4 high_fractions = LoadFractions(steps_, step_count_, 4);
+  for (size_t i = 0; i < positions.size(); ++i) {
+    alphas[i] = EvaluateAlphaAt(steps_, step_count_, low_fractions,
+                                high_fractions, positions[i]);
+  }
+}
+
 void LinearGradient::ApplyTransform(const Transform& transform) {
   if (transform.IsIdentityOrTranslation())
     return;
 
-  float radian = base::DegToRad(static_cast<float>(angle_));
-  float y = -sin(radian);
-  float x = cos(radian);
-  PointF origin = transform.MapPoint(PointF());
-  PointF end = transform.MapPoint(PointF(x, y));
-  Vector2dF diff = end - origin;
-  float new_angle = base::RadToDeg(atan2(diff.y(), diff.x()));
-  angle_ = -static_cast<int16_t>(std::round(new_angle));
+  angle_ = TransformAngle(transform, transform.MapPoint(PointF()), angle_);
 }
 
 void LinearGradient::ApplyTransform(const AxisTransform2d& transform) {
   if (transform.scale().x() == transform.scale().y())
     return;
 
-  float radian = base::DegToRad(static_cast<float>(angle_));
-  float y = -sin(radian) * transform.scale().y();
-  float x = cos(radian) * transform.scale().x();
-  float new_angle = base::RadToDeg(atan2(y, x));
-  angle_ = -static_cast<int16_t>(std::round(new_angle));
+  angle_ = TransformAngle(transform, angle_);
+}
+
+void ApplyTransformToGradients(const Transform& transform,
+                               base::span<LinearGradient> gradients) {
+  if (transform.IsIdentityOrTranslation()) {
+    return;
+  }
+  // A positive uniform scale keeps the angles, which TransformAngle() only
+  // normalizes to (-180, 180], so the trig is only needed outside of that.
+  const bool keeps_angles = transform.IsPositiveScaleOrTranslation() &&
+                            transform.rc(0, 0) == transform.rc(1, 1);
+  const PointF origin = transform.MapPoint(PointF());
+  TransformAngles(gradients, [&](int16_t angle) {
+    if (keeps_angles && std::abs(angle) < 180) {
+      return angle;
+    }
+    return TransformAngle(transform, origin, angle);
+  });
+}
+
+void ApplyTransformToGradients(const AxisTransform2d& transform,
+                               base::span<LinearGradient> gradients) {
+  if (transform.scale().x() == transform.scale().y()) {
+    return;
+  }
+  TransformAngles(gradients, [&](int16_t angle) {
+    return TransformAngle(transform, angle);
+  });
 }
 
 std::string LinearGradient::ToString() const {
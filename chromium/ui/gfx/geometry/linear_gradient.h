@@ -13,6 +13,7 @@
 #include <string>
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 
 namespace gfx {
 
@@ -65,6 +66,17 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) LinearGradient {
   // Reverse the steps.
   void ReverseSteps();
 
+  // Returns the alpha at |position|, a fraction along the gradient from 0 to
+  // 1, interpolated between the steps around it. Positions before the first
+  // step or after the last have the alpha of that step. An empty gradient is
+  // opaque.
+  uint8_t EvaluateAlpha(float position) const;
+  // Sets each of |alphas| to EvaluateAlpha() of the position at the same index
+  // of |positions|, which must have the same size. The fractions of the steps
+  // are loaded once for all the positions.
+  void EvaluateAlphaMany(base::span<const float> positions,
+                         base::span<uint8_t> alphas) const;
+
   // Transform the angle.
   void ApplyTransform(const Transform& transform);
   void ApplyTransform(const AxisTransform2d& transform);
@@ -81,6 +93,19 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) LinearGradient {
   StepArray steps_;
 };
 
+// Same as LinearGradient::ApplyTransform() on each of |gradients|, but the
+// mapping of the angles is set up once for |transform|, and computed once for
+// each run of gradients with the same angle. Transforms that keep the angles,
+// i.e. translations and positive uniform scales, don't need the trig, and the
+// angles are kept as is where ApplyTransform() would be off by the rounding of
+// the mapped points.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+void ApplyTransformToGradients(const Transform& transform,
+                               base::span<LinearGradient> gradients);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+void ApplyTransformToGradients(const AxisTransform2d& transform,
+                               base::span<LinearGradient> gradients);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_LINEAR_GRADIENT_H_
@@ -4,6 +4,8 @@
 
 #include "ui/gfx/geometry/linear_gradient.h"
 
+#include <vector>
+
 #include "build/build_config.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/axis_transform2d.h"
@@ -44,6 +46,37 @@ TEST(LinearGradientTest, Basic) {
   EXPECT_NE(gradient, gradient2);
 }
 
+TEST(LinearGradientTest, EvaluateAlpha) {
+  EXPECT_EQ(255, LinearGradient().EvaluateAlpha(0.5f));
+
+  LinearGradient single(0);
+  single.AddStep(.5, 30);
+  EXPECT_EQ(30, single.EvaluateAlpha(0));
+  EXPECT_EQ(30, single.EvaluateAlpha(1));
+
+  LinearGradient gradient(0);
+  gradient.AddStep(.2, 0);
+  gradient.AddStep(.5, 100);
+  gradient.AddStep(.9, 200);
+  const std::vector<float> positions = {0, .2, .35, .5, .7, .9, 1};
+  const std::vector<uint8_t> expected = {0, 0, 50, 100, 150, 200, 200};
+  std::vector<uint8_t> alphas(positions.size());
+  gradient.EvaluateAlphaMany(positions, alphas);
+  for (size_t i = 0; i < positions.size(); ++i) {
+    SCOPED_TRACE(positions[i]);
+    EXPECT_EQ(expected[i], gradient.EvaluateAlpha(positions[i]));
+    EXPECT_EQ(expected[i], alphas[i]);
+  }
+
+  // All of the steps.
+  LinearGradient full(0);
+  for (size_t i = 0; i < LinearGradient::kMaxStepSize; ++i) {
+    full.AddStep(i / 10.f, i * 10);
+  }
+  EXPECT_EQ(65, full.EvaluateAlpha(.65f));
+  EXPECT_EQ(70, full.EvaluateAlpha(1));
+}
+
 TEST(LinearGradientTest, Reverse) {
   LinearGradient gradient(45);
   // Make sure reversing an empty LinearGradient doesn't cause an issue.
@@ -109,4 +142,52 @@ TEST(LinearGradientTest, ApplyAxisTransform2d) {
   }
 }
 
+TEST(LinearGradientTest, ApplyTransformToGradients) {
+  // Runs of equal angles, and angles outside of (-180, 180].
+  const int16_t angles[] = {45, 45, 0, 90, 90, 90, -135, 180, 270, -300, 45};
+  std::vector<LinearGradient> gradients;
+  for (int16_t angle : angles) {
+    gradients.emplace_back(angle);
+  }
+
+  Transform scale;
+  scale.Scale(1, 10);
+  Transform rotation;
+  rotation.Rotate(30);
+  Transform skew;
+  skew.Skew(20, -10);
+  Transform uniform_scale;
+  uniform_scale.Scale(3, 3);
+  Transform flip;
+  flip.Scale(-1, -1);
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(100);
+  perspective.RotateAboutYAxis(30);
+  for (const Transform& transform : {Transform::MakeTranslation(10, 50), scale,
+                                     rotation, skew, uniform_scale, flip,
+                                     perspective}) {
+    SCOPED_TRACE(transform.ToString());
+    std::vector<LinearGradient> batch = gradients;
+    ApplyTransformToGradients(transform, batch);
+    for (size_t i = 0; i < gradients.size(); ++i) {
+      LinearGradient expected = gradients[i];
+      expected.ApplyTransform(transform);
+      EXPECT_EQ(expected.angle(), batch[i].angle()) << i;
+    }
+  }
+
+  for (const Vector2dF& axis_scale :
+       {Vector2dF(1, 1), Vector2dF(1, 10), Vector2dF(-2, 0.5f)}) {
+    const auto transform =
+        AxisTransform2d::FromScaleAndTranslation(axis_scale, Vector2dF(10, 50));
+    std::vector<LinearGradient> batch = gradients;
+    ApplyTransformToGradients(transform, batch);
+    for (size_t i = 0; i < gradients.size(); ++i) {
+      LinearGradient expected = gradients[i];
+      expected.ApplyTransform(transform);
+      EXPECT_EQ(expected.angle(), batch[i].angle()) << i;
+    }
+  }
+}
+
 }  // namespace gfx
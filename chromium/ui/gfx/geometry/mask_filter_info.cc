@@ -4,14 +4,78 @@
 
 #include "ui/gfx/geometry/mask_filter_info.h"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
 #include "base/strings/string_number_conversions.h"
 #include "third_party/skia/include/core/SkMatrix.h"
 #include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/skia_conversions.h"
 #include "ui/gfx/geometry/transform.h"
 
 namespace gfx {
 
+namespace {
+
+// Returns |rrect| scaled and then translated, as SkRRect::transform() with a
+// scale matrix and SkRRect::offset() would, but without an SkMatrix. The radii
+// of the four corners are scaled together, and swapped between the corners
+// that a negative scale flips. Returns an empty RRectF if the result is empty.
+RRectF ScaleAndTranslateRRect(const RRectF& rrect,
+                              const Vector2dF& scale,
+                              const Vector2dF& translation) {
+  const SkRRect sk_rrect(rrect);
+  const SkRect& bounds = sk_rrect.rect();
+  const float x0 = bounds.fLeft * scale.x() + translation.x();
+  const float x1 = bounds.fRight * scale.x() + translation.x();
+  const float y0 = bounds.fTop * scale.y() + translation.y();
+  const float y1 = bounds.fBottom * scale.y() + translation.y();
+  const SkRect mapped = SkRect::MakeLTRB(std::min(x0, x1), std::min(y0, y1),
+                                         std::max(x0, x1), std::max(y0, y1));
+  if (mapped.isEmpty()) {
+    return RRectF();
+  }
+
+  SkRRect result;
+  if (sk_rrect.isRect()) {
+    result.setRect(mapped);
+  } else if (sk_rrect.isOval()) {
+    result.setOval(mapped);
+  } else {
+    // The lanes are ordered like SkRRect::Corner, clockwise from the upper
+    // left.
+    const SkVector upper_left = sk_rrect.radii(SkRRect::kUpperLeft_Corner);
+    const SkVector upper_right = sk_rrect.radii(SkRRect::kUpperRight_Corner);
+    const SkVector lower_right = sk_rrect.radii(SkRRect::kLowerRight_Corner);
+    const SkVector lower_left = sk_rrect.radii(SkRRect::kLowerLeft_Corner);
+    Float4 radius_x = Float4{upper_left.fX, upper_right.fX, lower_right.fX,
+                             lower_left.fX} *
+                      std::abs(scale.x());
+    Float4 radius_y = Float4{upper_left.fY, upper_right.fY, lower_right.fY,
+                             lower_left.fY} *
+                      std::abs(scale.y());
+    if (scale.x() < 0) {
+      radius_x = Float4{radius_x[1], radius_x[0], radius_x[3], radius_x[2]};
+      radius_y = Float4{radius_y[1], radius_y[0], radius_y[3], radius_y[2]};
+    }
+    if (scale.y() < 0) {
+      radius_x = Float4{radius_x[3], radius_x[2], radius_x[1], radius_x[0]};
+      radius_y = Float4{radius_y[3], radius_y[2], radius_y[1], radius_y[0]};
+    }
+    const std::array<SkVector, 4> radii = {{{radius_x[0], radius_y[0]},
+                                           {radius_x[1], radius_y[1]},
+                                           {radius_x[2], radius_y[2]},
+                                           {radius_x[3], radius_y[3]}}};
+    result.setRectRadii(mapped, radii.data());
+  }
+  return RRectF(result);
+}
+
+}  // namespace
+
 void MaskFilterInfo::ApplyTransform(const Transform& transform) {
   if (rounded_corner_bounds_.IsEmpty()) {
     return;
@@ -23,6 +87,27 @@ void MaskFilterInfo::ApplyTransform(const Transform& transform) {
   // test).  So after converting our Matrix44 to SkMatrix, round
   // relevant values less than kEpsilon to zero.
   constexpr float kEpsilon = std::numeric_limits<float>::epsilon();
+
+  // Most quads only have a 2d scale and translation, which are applied
+  // directly. Scales that would be rounded to zero make the bounds empty, so
+  // they take the general path.
+  if (transform.IsScaleOrTranslation()) {
+    const Vector2dF scale = transform.To2dScale();
+    if (std::abs(scale.x()) >= kEpsilon && std::abs(scale.y()) >= kEpsilon) {
+      rounded_corner_bounds_ = ScaleAndTranslateRRect(
+          rounded_corner_bounds_, scale, transform.To2dTranslation());
+      if (rounded_corner_bounds_.IsEmpty() ||
+          !SkRRect(rounded_corner_bounds_).isValid()) {
+        rounded_corner_bounds_ = RRectF();
+        return;
+      }
+      if (gradient_mask_ && !gradient_mask_->IsEmpty()) {
+        gradient_mask_->ApplyTransform(transform);
+      }
+      return;
+    }
+  }
+
   SkMatrix rounded_matrix = TransformToFlattenedSkMatrix(transform);
   if (std::abs(rounded_matrix.get(SkMatrix::kMScaleX)) < kEpsilon)
     rounded_matrix.set(SkMatrix::kMScaleX, 0.0f);
@@ -50,8 +135,8 @@ void MaskFilterInfo::ApplyTransform(const AxisTransform2d& transform) {
   if (rounded_corner_bounds_.IsEmpty())
     return;
 
-  rounded_corner_bounds_.Scale(transform.scale().x(), transform.scale().y());
-  rounded_corner_bounds_.Offset(transform.translation());
+  rounded_corner_bounds_ = ScaleAndTranslateRRect(
+      rounded_corner_bounds_, transform.scale(), transform.translation());
   if (!SkRRect(rounded_corner_bounds_).isValid()) {
     rounded_corner_bounds_ = RRectF();
     return;
@@ -116,5 +116,37 @@ TEST(MaskFilterInfoTest, ApplyAxisTransform2d) {
       Vector2dF(1, 1), Vector2dF(1, kNan))));
 }
 
+TEST(MaskFilterInfoTest, ApplyFlippingScale) {
+  const MaskFilterInfo info(
+      RRectF(RectF(0, 0, 20.f, 25.f), 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f),
+      CreateGradient(50));
+  // Flipping horizontally swaps the left and right corners.
+  const MaskFilterInfo expected(
+      RRectF(RectF(-20.f, 0, 20.f, 50.f), 3.f, 8.f, 1.f, 4.f, 7.f, 16.f, 5.f,
+             12.f),
+      CreateGradient(113));
+
+  MaskFilterInfo transformed = info;
+  transformed.ApplyTransform(Transform::MakeScale(-1.f, 2.f));
+  EXPECT_EQ(expected, transformed);
+
+  transformed = info;
+  transformed.ApplyTransform(AxisTransform2d::FromScaleAndTranslation(
+      Vector2dF(-1.f, 2.f), Vector2dF()));
+  EXPECT_EQ(expected, transformed);
+
+  // Flipping both ways swaps the opposite corners.
+  transformed = MaskFilterInfo(
+      RRectF(RectF(0, 0, 20.f, 25.f), 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f));
+  transformed.ApplyTransform(Transform::MakeScale(-1.f, -1.f));
+  EXPECT_EQ(MaskFilterInfo(RRectF(RectF(-20.f, -25.f, 20.f, 25.f), 5.f, 6.f,
+                                  7.f, 8.f, 1.f, 2.f, 3.f, 4.f)),
+            transformed);
+
+  transformed = info;
+  transformed.ApplyTransform(Transform::MakeScale(0.f, 1.f));
+  EXPECT_TRUE(transformed.IsEmpty());
+}
+
 }  // anonymous namespace
 }  // namespace gfx
@@ -0,0 +1,393 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/matrix3_f_array.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include "base/check_op.h"
+#include "base/compiler_specific.h"
+#include "ui/gfx/geometry/double4.h"
+
+namespace gfx {
+
+namespace {
+
+constexpr size_t kLanes = Matrix3FArray::kLanes;
+
+// The entries of kLanes matrices, one matrix per lane.
+struct MatrixLanes {
+  Float4 m[3][3];
+};
+
+ALWAYS_INLINE MatrixLanes Load(const Matrix3FArray& matrices, size_t i) {
+  MatrixLanes lanes;
+  for (int r = 0; r < 3; ++r) {
+    for (int c = 0; c < 3; ++c) {
+      lanes.m[r][c] =
+          LoadFloat4(matrices.entries(r, c).subspan(i, kLanes).data());
+    }
+  }
+  return lanes;
+}
+
+ALWAYS_INLINE void Store(Float4 v, base::span<float> entries, size_t i) {
+  StoreFloat4(v, entries.subspan(i, kLanes).data());
+}
+
+ALWAYS_INLINE Double4 ToDouble4(Float4 v) {
+  return __builtin_convertvector(v, Double4);
+}
+
+// As Determinant3x3() of matrix3_f.cc, in double.
+ALWAYS_INLINE Double4 Determinant(const MatrixLanes& lanes) {
+  const auto d = [&lanes](int r, int c) { return ToDouble4(lanes.m[r][c]); };
+  return d(0, 0) * (d(1, 1) * d(2, 2) - d(1, 2) * d(2, 1)) +
+         d(0, 1) * (d(1, 2) * d(2, 0) - d(1, 0) * d(2, 2)) +
+         d(0, 2) * (d(1, 0) * d(2, 1) - d(1, 1) * d(2, 0));
+}
+
+// The eigenvalues of a symmetric matrix in decreasing order.
+struct Eigenvalues {
+  Double4 values[3];
+};
+
+// The trigonometric solution of the characteristic polynomial of a symmetric
+// 3x3 matrix: with q = trace / 3 and p the scale of A - qI, the eigenvalues
+// are q + 2p cos(phi + 2 pi k / 3), where cos(3 phi) = det((A - qI) / p) / 2.
+ALWAYS_INLINE Eigenvalues SymmetricEigenvalues(const MatrixLanes& lanes) {
+  const auto d = [&lanes](int r, int c) { return ToDouble4(lanes.m[r][c]); };
+  const Double4 a00 = d(0, 0);
+  const Double4 a11 = d(1, 1);
+  const Double4 a22 = d(2, 2);
+  const Double4 a01 = d(0, 1);
+  const Double4 a02 = d(0, 2);
+  const Double4 a12 = d(1, 2);
+
+  const Double4 q = (a00 + a11 + a22) / 3;
+  const Double4 b00 = a00 - q;
+  const Double4 b11 = a11 - q;
+  const Double4 b22 = a22 - q;
+  const Double4 off_diagonal = a01 * a01 + a02 * a02 + a12 * a12;
+  const Double4 p2 =
+      (b00 * b00 + b11 * b11 + b22 * b22 + 2 * off_diagonal) / 6;
+  const Double4 det_b = b00 * (b11 * b22 - a12 * a12) -
+                        a01 * (a01 * b22 - a12 * a02) +
+                        a02 * (a01 * a12 - b11 * a02);
+
+  Double4 p;
+  Double4 cos_3phi;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    p[lane] = std::sqrt(p2[lane]);
+    // A multiple of the identity has p == 0 and any phi.
+    cos_3phi[lane] =
+        p[lane] > 0 ? std::clamp(det_b[lane] / (2 * p2[lane] * p[lane]), -1.0,
+                                 1.0)
+                    : 1.0;
+  }
+
+  Eigenvalues result;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    const double phi = std::acos(cos_3phi[lane]) / 3;
+    result.values[0][lane] = q[lane] + 2 * p[lane] * std::cos(phi);
+    result.values[2][lane] =
+        q[lane] + 2 * p[lane] * std::cos(phi + 2 * std::numbers::pi / 3);
+  }
+  // The trace is the sum of the eigenvalues. The middle one is clamped
+  // between the others, which it can cross by rounding when it's repeated.
+  Double4 middle = 3 * q - result.values[0] - result.values[2];
+  middle = middle > result.values[0] ? result.values[0] : middle;
+  middle = middle < result.values[2] ? result.values[2] : middle;
+  result.values[1] = middle;
+  return result;
+}
+
+struct DoubleVector3 {
+  double x;
+  double y;
+  double z;
+};
+
+double Dot(const DoubleVector3& a, const DoubleVector3& b) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+DoubleVector3 Cross(const DoubleVector3& a, const DoubleVector3& b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+}
+
+DoubleVector3 Scale(const DoubleVector3& v, double s) {
+  return {v.x * s, v.y * s, v.z * s};
+}
+
+DoubleVector3 Subtract(const DoubleVector3& a, const DoubleVector3& b) {
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+// The symmetric matrix of lane |lane| of |lanes|, from its upper triangle.
+struct SymmetricMatrix {
+  SymmetricMatrix(const MatrixLanes& lanes, size_t lane)
+      : a00(lanes.m[0][0][lane]),
+        a01(lanes.m[0][1][lane]),
+        a02(lanes.m[0][2][lane]),
+        a11(lanes.m[1][1][lane]),
+        a12(lanes.m[1][2][lane]),
+        a22(lanes.m[2][2][lane]) {}
+
+  DoubleVector3 Map(const DoubleVector3& v) const {
+    return {a00 * v.x + a01 * v.y + a02 * v.z,
+            a01 * v.x + a11 * v.y + a12 * v.z,
+            a02 * v.x + a12 * v.y + a22 * v.z};
+  }
+
+  double a00, a01, a02, a11, a12, a22;
+};
+
+// Returns a unit vector in the null space of A - eigenvalue I, which has rank
+// 2 when |eigenvalue| is simple: the longest cross product of two rows.
+DoubleVector3 EigenvectorOfSimpleEigenvalue(const SymmetricMatrix& a,
+                                            double eigenvalue) {
+  const DoubleVector3 row0 = {a.a00 - eigenvalue, a.a01, a.a02};
+  const DoubleVector3 row1 = {a.a01, a.a11 - eigenvalue, a.a12};
+  const DoubleVector3 row2 = {a.a02, a.a12, a.a22 - eigenvalue};
+  const DoubleVector3 crosses[] = {Cross(row0, row1), Cross(row0, row2),
+                                   Cross(row1, row2)};
+  const DoubleVector3* longest = &crosses[0];
+  double longest_squared = Dot(crosses[0], crosses[0]);
+  for (const DoubleVector3& cross : crosses) {
+    const double length_squared = Dot(cross, cross);
+    if (length_squared > longest_squared) {
+      longest = &cross;
+      longest_squared = length_squared;
+    }
+  }
+  if (longest_squared == 0) {
+    // A multiple of the identity, for which every vector is an eigenvector.
+    return {1, 0, 0};
+  }
+  return Scale(*longest, 1 / std::sqrt(longest_squared));
+}
+
+// Sets |u| and |v| to unit vectors which, with the unit vector |w|, make an
+// orthonormal basis.
+void OrthogonalComplement(const DoubleVector3& w,
+                          DoubleVector3& u,
+                          DoubleVector3& v) {
+  if (std::fabs(w.x) > std::fabs(w.y)) {
+    u = Scale({-w.z, 0, w.x}, 1 / std::sqrt(w.x * w.x + w.z * w.z));
+  } else {
+    u = Scale({0, w.z, -w.y}, 1 / std::sqrt(w.y * w.y + w.z * w.z));
+  }
+  v = Cross(w, u);
+}
+
+// Returns a unit eigenvector of |eigenvalue| orthogonal to the unit
+// eigenvector |w| of another eigenvalue, from the 2x2 restriction of
+// A - eigenvalue I to the orthogonal complement of |w|.
+DoubleVector3 EigenvectorInComplement(const SymmetricMatrix& a,
+                                      const DoubleVector3& w,
+                                      double eigenvalue) {
+  DoubleVector3 u;
+  DoubleVector3 v;
+  OrthogonalComplement(w, u, v);
+  const DoubleVector3 au = a.Map(u);
+  const DoubleVector3 av = a.Map(v);
+  double m00 = Dot(u, au) - eigenvalue;
+  double m01 = Dot(u, av);
+  double m11 = Dot(v, av) - eigenvalue;
+  const double abs_m00 = std::fabs(m00);
+  const double abs_m01 = std::fabs(m01);
+  const double abs_m11 = std::fabs(m11);
+  // The null vector of the 2x2 matrix, from its larger row.
+  if (abs_m00 >= abs_m11) {
+    if (std::max(abs_m00, abs_m01) == 0) {
+      return u;
+    }
+    if (abs_m00 >= abs_m01) {
+      m01 /= m00;
+      m00 = 1 / std::sqrt(1 + m01 * m01);
+      m01 *= m00;
+    } else {
+      m00 /= m01;
+      m01 = 1 / std::sqrt(1 + m00 * m00);
+      m00 *= m01;
+    }
+    return Subtract(Scale(u, m01), Scale(v, m00));
+  }
+  if (std::max(abs_m11, abs_m01) == 0) {
+    return u;
+  }
+  if (abs_m11 >= abs_m01) {
+    m01 /= m11;
+    m11 = 1 / std::sqrt(1 + m01 * m01);
+    m01 *= m11;
+  } else {
+    m11 /= m01;
+    m01 = 1 / std::sqrt(1 + m11 * m11);
+    m11 *= m01;
+  }
+  return Subtract(Scale(u, m11), Scale(v, m01));
+}
+
+void StoreColumn(const DoubleVector3& v,
+                 int column,
+                 size_t index,
+                 Matrix3FArray& matrices) {
+  matrices.entries(0, column)[index] = static_cast<float>(v.x);
+  matrices.entries(1, column)[index] = static_cast<float>(v.y);
+  matrices.entries(2, column)[index] = static_cast<float>(v.z);
+}
+
+}  // namespace
+
+Matrix3FArray::Matrix3FArray() = default;
+Matrix3FArray::Matrix3FArray(const Matrix3FArray&) = default;
+Matrix3FArray::Matrix3FArray(Matrix3FArray&&) = default;
+Matrix3FArray& Matrix3FArray::operator=(const Matrix3FArray&) = default;
+Matrix3FArray& Matrix3FArray::operator=(Matrix3FArray&&) = default;
+Matrix3FArray::~Matrix3FArray() = default;
+
+void Matrix3FArray::reserve(size_t count) {
+  for (std::vector<float>& entries : entries_) {
+    entries.reserve((count + kLanes - 1) / kLanes * kLanes);
+  }
+}
+
+void Matrix3FArray::resize(size_t count) {
+  const size_t padded = (count + kLanes - 1) / kLanes * kLanes;
+  for (std::vector<float>& entries : entries_) {
+    // The new matrices in the padding of the last group may have been
+    // written.
+    for (size_t i = size_; i < std::min(count, entries.size()); ++i) {
+      entries[i] = 0;
+    }
+    entries.resize(padded);
+  }
+  size_ = count;
+}
+
+void Matrix3FArray::push_back(const Matrix3F& matrix) {
+  if (size_ == padded_size()) {
+    for (std::vector<float>& entries : entries_) {
+      entries.resize(size_ + kLanes);
+    }
+  }
+  Set(size_++, matrix);
+}
+
+Matrix3F Matrix3FArray::Get(size_t index) const {
+  CHECK_LT(index, size_);
+  Matrix3F matrix = Matrix3F::Zeros();
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      matrix.set(i, j, entries_[i * 3 + j][index]);
+    }
+  }
+  return matrix;
+}
+
+void Matrix3FArray::Set(size_t index, const Matrix3F& matrix) {
+  CHECK_LT(index, size_);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      entries_[i * 3 + j][index] = matrix.get(i, j);
+    }
+  }
+}
+
+void Determinants(const Matrix3FArray& matrices, base::span<float> results) {
+  CHECK_EQ(matrices.size(), results.size());
+  for (size_t i = 0; i < matrices.padded_size(); i += kLanes) {
+    const Float4 determinants =
+        __builtin_convertvector(Determinant(Load(matrices, i)), Float4);
+    for (size_t lane = 0; lane < kLanes && i + lane < results.size(); ++lane) {
+      results[i + lane] = determinants[lane];
+    }
+  }
+}
+
+void InvertMatrices(const Matrix3FArray& matrices, Matrix3FArray& results) {
+  // |results| may be |matrices|, and keeps its size.
+  results.resize(matrices.size());
+  const Double4 kEpsilon = Double4{} + std::numeric_limits<float>::epsilon();
+  for (size_t i = 0; i < matrices.padded_size(); i += kLanes) {
+    const MatrixLanes lanes = Load(matrices, i);
+    const auto& m = lanes.m;
+    const Double4 determinant = Determinant(lanes);
+    const Double4 abs_determinant =
+        determinant < 0 ? -determinant : determinant;
+    const auto singular = kEpsilon > abs_determinant;
+    // The cofactors are in float and divided in double, as
+    // Matrix3F::Inverse() does.
+    const Float4 cofactors[3][3] = {
+        {m[1][1] * m[2][2] - m[1][2] * m[2][1],
+         m[0][2] * m[2][1] - m[0][1] * m[2][2],
+         m[0][1] * m[1][2] - m[0][2] * m[1][1]},
+        {m[1][2] * m[2][0] - m[1][0] * m[2][2],
+         m[0][0] * m[2][2] - m[0][2] * m[2][0],
+         m[0][2] * m[1][0] - m[0][0] * m[1][2]},
+        {m[1][0] * m[2][1] - m[1][1] * m[2][0],
+         m[0][1] * m[2][0] - m[0][0] * m[2][1],
+         m[0][0] * m[1][1] - m[0][1] * m[1][0]}};
+    for (int r = 0; r < 3; ++r) {
+      for (int c = 0; c < 3; ++c) {
+        const Double4 entry = ToDouble4(cofactors[r][c]) / determinant;
+        Store(__builtin_convertvector(singular ? Double4{} : entry, Float4),
+              results.entries(r, c), i);
+      }
+    }
+  }
+}
+
+void SolveSymmetricEigenproblems(const Matrix3FArray& matrices,
+                                 Vector3dFArray& eigenvalues,
+                                 Matrix3FArray* eigenvectors) {
+  eigenvalues.resize(matrices.size());
+  if (eigenvectors) {
+    eigenvectors->resize(matrices.size());
+  }
+  for (size_t i = 0; i < matrices.padded_size(); i += kLanes) {
+    const MatrixLanes lanes = Load(matrices, i);
+    const Eigenvalues values = SymmetricEigenvalues(lanes);
+    Store(__builtin_convertvector(values.values[0], Float4), eigenvalues.xs(),
+          i);
+    Store(__builtin_convertvector(values.values[1], Float4), eigenvalues.ys(),
+          i);
+    Store(__builtin_convertvector(values.values[2], Float4), eigenvalues.zs(),
+          i);
+    if (!eigenvectors) {
+      continue;
+    }
+
+    for (size_t lane = 0; lane < kLanes && i + lane < matrices.size();
+         ++lane) {
+      const SymmetricMatrix a(lanes, lane);
+      const double e0 = values.values[0][lane];
+      const double e1 = values.values[1][lane];
+      const double e2 = values.values[2][lane];
+      // Start from the eigenvalue farther from the middle one, which is
+      // simple unless all three are equal.
+      DoubleVector3 v0;
+      DoubleVector3 v1;
+      DoubleVector3 v2;
+      if (e0 - e1 >= e1 - e2) {
+        v0 = EigenvectorOfSimpleEigenvalue(a, e0);
+        v1 = EigenvectorInComplement(a, v0, e1);
+        v2 = Cross(v0, v1);
+      } else {
+        v2 = EigenvectorOfSimpleEigenvalue(a, e2);
+        v1 = EigenvectorInComplement(a, v2, e1);
+        v0 = Cross(v1, v2);
+      }
+      StoreColumn(v0, 0, i + lane, *eigenvectors);
+      StoreColumn(v1, 1, i + lane, *eigenvectors);
+      StoreColumn(v2, 2, i + lane, *eigenvectors);
+    }
+  }
+}
+
+}  // namespace gfx
@@ -0,0 +1,97 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_MATRIX3_F_ARRAY_H_
+#define UI_GFX_GEOMETRY_MATRIX3_F_ARRAY_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <vector>
+
+#include "base/component_export.h"
+#include "base/containers/span.h"
+#include "ui/gfx/geometry/float3_array.h"
+#include "ui/gfx/geometry/matrix3_f.h"
+
+namespace gfx {
+
+// An array of Matrix3F stored as a structure of arrays, as Float3Array: each
+// of the 9 entries of all the matrices in its own array, padded to a multiple
+// of kLanes matrices, so that the batch operations below work on kLanes
+// matrices at a time in Float4 or Double4 lanes. The values of the padding
+// are unspecified.
+class COMPONENT_EXPORT(GEOMETRY) Matrix3FArray {
+ public:
+  static constexpr size_t kLanes = 4;
+
+  Matrix3FArray();
+  Matrix3FArray(const Matrix3FArray&);
+  Matrix3FArray(Matrix3FArray&&);
+  Matrix3FArray& operator=(const Matrix3FArray&);
+  Matrix3FArray& operator=(Matrix3FArray&&);
+  ~Matrix3FArray();
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  // The size of the entry arrays, a multiple of kLanes.
+  size_t padded_size() const { return entries_[0].size(); }
+
+  void reserve(size_t count);
+  void clear() { resize(0); }
+  // Resizes to |count| matrices. The new matrices are Matrix3F::Zeros().
+  void resize(size_t count);
+
+  void push_back(const Matrix3F& matrix);
+  Matrix3F Get(size_t index) const;
+  void Set(size_t index, const Matrix3F& matrix);
+
+  // The entries (i, j) of the matrices, padded_size() floats.
+  base::span<const float> entries(int i, int j) const {
+    return entries_[i * 3 + j];
+  }
+  base::span<float> entries(int i, int j) { return entries_[i * 3 + j]; }
+
+ private:
+  std::array<std::vector<float>, 9> entries_;
+  size_t size_ = 0;
+};
+
+// Sets results[i] to matrices.Get(i).Determinant(). |results| must have the
+// size of |matrices|.
+COMPONENT_EXPORT(GEOMETRY)
+void Determinants(const Matrix3FArray& matrices, base::span<float> results);
+
+// Sets each matrix of |results| to Matrix3F::Inverse() of the matrix of
+// |matrices|, with the same results, so singular ones are inverted to
+// Matrix3F::Zeros(). |results| is resized to the size of |matrices|, and may
+// be |matrices|.
+COMPONENT_EXPORT(GEOMETRY)
+void InvertMatrices(const Matrix3FArray& matrices, Matrix3FArray& results);
+
+// Solves the eigenproblem of each matrix of |matrices|, which must be
+// symmetric, e.g. a covariance matrix; only the entries on and above the
+// diagonal are read. |eigenvalues| is resized to the size of |matrices|,
+// and each element is set to the 3 eigenvalues in x, y and z in decreasing
+// order. If |eigenvectors| isn't null, it's resized too, and column k of each
+// matrix is set to a unit eigenvector of eigenvalue k, the columns making an
+// orthonormal basis.
+//
+// The eigenvalues are in closed form, from the trigonometric solution of the
+// characteristic polynomial, in double and in Double4 lanes, without
+// iterations. They're within 1e-6 times the largest magnitude of the entries
+// of the exact eigenvalues of the float matrix. The eigenvectors are built
+// from cross products as in D. Eberly, "A Robust Eigensolver for 3 x 3
+// Symmetric Matrices", one matrix at a time, which is robust for repeated
+// eigenvalues; the residual |A v - e v| of each eigenvector v of eigenvalue e
+// is within 1e-6 times the largest magnitude of the entries, but eigenvectors
+// of eigenvalues closer than that aren't well defined by the float matrix.
+COMPONENT_EXPORT(GEOMETRY)
+void SolveSymmetricEigenproblems(const Matrix3FArray& matrices,
+                                 Vector3dFArray& eigenvalues,
+                                 Matrix3FArray* eigenvectors = nullptr);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_MATRIX3_F_ARRAY_H_
@@ -0,0 +1,178 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/matrix3_f_array.h"
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/vector3d_f.h"
+
+namespace gfx {
+namespace {
+
+Matrix3F MakeMatrix(float m00,
+                    float m01,
+                    float m02,
+                    float m10,
+                    float m11,
+                    float m12,
+                    float m20,
+                    float m21,
+                    float m22) {
+  Matrix3F matrix = Matrix3F::Zeros();
+  matrix.set(m00, m01, m02, m10, m11, m12, m20, m21, m22);
+  return matrix;
+}
+
+Matrix3FArray MakeArray(const std::vector<Matrix3F>& matrices) {
+  Matrix3FArray array;
+  array.reserve(matrices.size());
+  for (const Matrix3F& matrix : matrices) {
+    array.push_back(matrix);
+  }
+  return array;
+}
+
+// The covariance of a few points, e.g. of a gesture.
+Matrix3F Covariance(const std::vector<Vector3dF>& points) {
+  Matrix3F covariance = Matrix3F::Zeros();
+  for (const Vector3dF& point : points) {
+    covariance = covariance + Matrix3F::FromOuterProduct(point, point);
+  }
+  return covariance;
+}
+
+float MaxAbsEntry(const Matrix3F& matrix) {
+  float max = 0;
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      max = std::max(max, std::fabs(matrix.get(i, j)));
+    }
+  }
+  return max;
+}
+
+TEST(Matrix3FArrayTest, Elements) {
+  Matrix3FArray array;
+  EXPECT_TRUE(array.empty());
+  const Matrix3F matrix = MakeMatrix(1, 2, 3, 4, 5, 6, 7, 8, 9);
+  array.push_back(matrix);
+  array.push_back(Matrix3F::Identity());
+  EXPECT_EQ(2u, array.size());
+  EXPECT_EQ(Matrix3FArray::kLanes, array.padded_size());
+  EXPECT_EQ(matrix, array.Get(0));
+  EXPECT_EQ(Matrix3F::Identity(), array.Get(1));
+  EXPECT_EQ(6, array.entries(1, 2)[0]);
+
+  // Matrices that come back after a shrink are zeros.
+  array.resize(1);
+  array.resize(2);
+  EXPECT_EQ(Matrix3F::Zeros(), array.Get(1));
+  array.clear();
+  EXPECT_TRUE(array.empty());
+}
+
+TEST(Matrix3FArrayTest, InverseAndDeterminant) {
+  // Not a multiple of the lanes, with singular matrices.
+  const std::vector<Matrix3F> matrices = {
+      MakeMatrix(1, 2, 3, 4, 5, 6, 7, 8, 9),
+      MakeMatrix(2, 0.5f, -1, 0.25f, 3, 0, 1, -2, 4),
+      Matrix3F::Identity(),
+      MakeMatrix(1e-3f, 0, 0, 0, 1e-3f, 0, 0, 0, 1e-3f),
+      MakeMatrix(-7, 1.5f, 2, 0, 0.125f, 9, 3, -1, 0.75f),
+      Matrix3F::Zeros(),
+      MakeMatrix(0, 1, 0, 0, 0, 1, 1, 0, 0)};
+  const Matrix3FArray array = MakeArray(matrices);
+
+  std::vector<float> determinants(matrices.size());
+  Determinants(array, determinants);
+  Matrix3FArray inverses;
+  InvertMatrices(array, inverses);
+  ASSERT_EQ(matrices.size(), inverses.size());
+  for (size_t i = 0; i < matrices.size(); ++i) {
+    EXPECT_EQ(matrices[i].Determinant(), determinants[i]) << i;
+    EXPECT_EQ(matrices[i].Inverse(), inverses.Get(i)) << i;
+  }
+  EXPECT_EQ(Matrix3F::Zeros(), inverses.Get(0));
+
+  // In place.
+  Matrix3FArray in_place = array;
+  InvertMatrices(in_place, in_place);
+  for (size_t i = 0; i < matrices.size(); ++i) {
+    EXPECT_EQ(inverses.Get(i), in_place.Get(i)) << i;
+  }
+}
+
+TEST(Matrix3FArrayTest, SymmetricEigenproblems) {
+  std::vector<Matrix3F> matrices = {
+      MakeMatrix(3, 0, 0, 0, -1, 0, 0, 0, 2),
+      // Repeated eigenvalues.
+      Matrix3F::Identity(),
+      Matrix3F::Zeros(),
+      Matrix3F::Identity() +
+          Matrix3F::FromOuterProduct(Vector3dF(1, 2, 2), Vector3dF(1, 2, 2)),
+      MakeMatrix(2, 1, 0, 1, 2, 0, 0, 0, 1),
+      MakeMatrix(4, 1e-4f, 0, 1e-4f, 4, 0, 0, 0, -4)};
+  // Covariances of points along lines, on planes and in space, at various
+  // scales.
+  for (int i = 0; i < 20; ++i) {
+    const float s = std::pow(10.0f, static_cast<float>(i % 7 - 3));
+    std::vector<Vector3dF> points;
+    for (int j = 0; j < 5; ++j) {
+      const float t = static_cast<float>(j - 2 + i);
+      points.emplace_back(s * t, s * (i % 3 ? 0.5f * t * t / (i + 1) : 2 * t),
+                          s * (i % 2 ? std::sin(t) : 0.0f));
+    }
+    matrices.push_back(Covariance(points));
+  }
+  const Matrix3FArray array = MakeArray(matrices);
+
+  Vector3dFArray eigenvalues;
+  Matrix3FArray eigenvectors;
+  SolveSymmetricEigenproblems(array, eigenvalues, &eigenvectors);
+  ASSERT_EQ(matrices.size(), eigenvalues.size());
+  ASSERT_EQ(matrices.size(), eigenvectors.size());
+
+  for (size_t i = 0; i < matrices.size(); ++i) {
+    SCOPED_TRACE(matrices[i].ToString());
+    const Matrix3F& matrix = matrices[i];
+    // As documented in the header.
+    const float tolerance = 1e-6f * MaxAbsEntry(matrix);
+    const Vector3dF values = eigenvalues.Get(i);
+    EXPECT_GE(values.x(), values.y());
+    EXPECT_GE(values.y(), values.z());
+    EXPECT_NEAR(matrix.Trace(), values.x() + values.y() + values.z(),
+                3 * tolerance);
+
+    const Matrix3F vectors = eigenvectors.Get(i);
+    const float lambdas[] = {values.x(), values.y(), values.z()};
+    for (int k = 0; k < 3; ++k) {
+      const Vector3dF v = vectors.get_column(k);
+      EXPECT_NEAR(1, v.Length(), 1e-6f) << k;
+      Vector3dF residual = MatrixProduct(matrix, v);
+      residual -= ScaleVector3d(v, lambdas[k], lambdas[k], lambdas[k]);
+      EXPECT_LE(residual.Length(), tolerance) << k;
+      for (int l = 0; l < k; ++l) {
+        EXPECT_NEAR(0, DotProduct(v, vectors.get_column(l)), 1e-6f) << k;
+      }
+    }
+  }
+
+  // Without eigenvectors.
+  Vector3dFArray eigenvalues_only;
+  SolveSymmetricEigenproblems(array, eigenvalues_only);
+  EXPECT_EQ(Vector3dF(3, 2, -1), eigenvalues_only.Get(0));
+  EXPECT_EQ(Vector3dF(1, 1, 1), eigenvalues_only.Get(1));
+  for (size_t i = 0; i < matrices.size(); ++i) {
+    EXPECT_EQ(eigenvalues.Get(i), eigenvalues_only.Get(i)) << i;
+  }
+}
+
+}  // namespace
+}  // namespace gfx
@@ -11,8 +11,16 @@
 
 #include "base/compiler_specific.h"
 #include "base/containers/span.h"
+#include "build/build_config.h"
+#include "ui/gfx/geometry/batch/cpu_features.h"
 #include "ui/gfx/geometry/decomposed_transform.h"
 
+#if defined(ARCH_CPU_X86_64)
+#include <immintrin.h>
+#elif defined(ARCH_CPU_ARM64)
+#include <arm_neon.h>
+#endif
+
 namespace gfx {
 
 namespace {
@@ -101,6 +109,184 @@ ALWAYS_INLINE bool InverseWithDouble4Cols(Double4& c0,
   return true;
 }
 
+// This is a simplified version of InverseWithDouble4Cols().
+ALWAYS_INLINE double DeterminantWithDouble4Cols(Double4 c0,
+                                                Double4 c1,
+                                                Double4 c2,
+                                                Double4 c3) {
+  // Note that r1 and r3 have components 2/3 and 0/1 swapped.
+  Double4 r0 = {c0[0], c1[0], c2[0], c3[0]};
+  Double4 r1 = {c2[1], c3[1], c0[1], c1[1]};
+  Double4 r2 = {c0[2], c1[2], c2[2], c3[2]};
+  Double4 r3 = {c2[3], c3[3], c0[3], c1[3]};
+
+  Double4 t = SwapInPairs(r2 * r3);
+  c0 = r1 * t;
+  t = SwapHighLow(t);
+  c0 = r1 * t - c0;
+  t = SwapInPairs(r1 * r2);
+  c0 += r3 * t;
+  t = SwapHighLow(t);
+  c0 -= r3 * t;
+  t = SwapInPairs(SwapHighLow(r1) * r3);
+  r2 = SwapHighLow(r2);
+  c0 += r2 * t;
+  t = SwapHighLow(t);
+  c0 -= r2 * t;
+
+  return Sum(r0 * c0);
+}
+
+// Architecture-specific kernels. All matrices are 16 doubles in col-major
+// order. |result| may alias |x| or |y| in the concat kernels because each
+// result column only depends on the columns of |x| (loaded upfront) and the
+// same column of |y|.
+#if defined(ARCH_CPU_X86_64)
+
+// The following kernels are compiled for AVX2, and selected at runtime with
+// HasAvx2(). Like the NEON kernels, they multiply and add separately,
+// without FMA, and add the products in the same order as the portable code,
+// so that the results are the same on every CPU.
+__attribute__((target("avx2"))) void ConcatAvx2(const double* x,
+                                                const double* y,
+                                                double* result) {
+  UNSAFE_TODO({
+    __m256d c0 = _mm256_loadu_pd(x);
+    __m256d c1 = _mm256_loadu_pd(x + 4);
+    __m256d c2 = _mm256_loadu_pd(x + 8);
+    __m256d c3 = _mm256_loadu_pd(x + 12);
+    for (int i = 0; i < 16; i += 4) {
+      __m256d r = _mm256_mul_pd(c0, _mm256_broadcast_sd(y + i));
+      r = _mm256_add_pd(r, _mm256_mul_pd(c1, _mm256_broadcast_sd(y + i + 1)));
+      r = _mm256_add_pd(r, _mm256_mul_pd(c2, _mm256_broadcast_sd(y + i + 2)));
+      r = _mm256_add_pd(r, _mm256_mul_pd(c3, _mm256_broadcast_sd(y + i + 3)));
+      _mm256_storeu_pd(result + i, r);
+    }
+  })
+}
+
+__attribute__((target("avx2"))) void MapVector4Avx2(const double* m,
+                                                    double* vec) {
+  UNSAFE_TODO({
+    __m256d r = _mm256_mul_pd(_mm256_loadu_pd(m), _mm256_broadcast_sd(vec));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_loadu_pd(m + 4),
+                                       _mm256_broadcast_sd(vec + 1)));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_loadu_pd(m + 8),
+                                       _mm256_broadcast_sd(vec + 2)));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_loadu_pd(m + 12),
+                                       _mm256_broadcast_sd(vec + 3)));
+    _mm256_storeu_pd(vec, r);
+  })
+}
+
+// Same as MapVector4Avx2() for each lane of |v|, which are x, y, z and w.
+__attribute__((target("avx2"))) void MapVector4InLanesAvx2(const double* m,
+                                                           Double4* v) {
+  UNSAFE_TODO({
+    __m256d x = v[0];
+    __m256d y = v[1];
+    __m256d z = v[2];
+    __m256d w = v[3];
+    for (int i = 0; i < 4; ++i) {
+      __m256d r = _mm256_mul_pd(_mm256_broadcast_sd(m + i), x);
+      r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(m + 4 + i), y));
+      r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(m + 8 + i), z));
+      r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(m + 12 + i), w));
+      v[i] = r;
+    }
+  })
+}
+
+// The inverse and the determinant are straight-line shuffles and arithmetic
+// on whole columns, which the compiler lowers directly to 256-bit registers
+// when the portable kernels are compiled for AVX2. Without FMA in the target,
+// the compiler can't contract their multiplications and additions either.
+__attribute__((target("avx2"))) bool InverseAvx2(Double4& c0,
+                                                 Double4& c1,
+                                                 Double4& c2,
+                                                 Double4& c3) {
+  return InverseWithDouble4Cols(c0, c1, c2, c3);
+}
+
+__attribute__((target("avx2"))) double DeterminantAvx2(const Double4& c0,
+                                                       const Double4& c1,
+                                                       const Double4& c2,
+                                                       const Double4& c3) {
+  return DeterminantWithDouble4Cols(c0, c1, c2, c3);
+}
+
+#elif defined(ARCH_CPU_ARM64)
+
+// NEON is always available on ARM64, so no runtime dispatch is needed. Each
+// column is held in two float64x2_t registers.
+void ConcatNeon(const double* x, const double* y, double* result) {
+  UNSAFE_TODO({
+    float64x2_t c0_lo = vld1q_f64(x);
+    float64x2_t c0_hi = vld1q_f64(x + 2);
+    float64x2_t c1_lo = vld1q_f64(x + 4);
+    float64x2_t c1_hi = vld1q_f64(x + 6);
+    float64x2_t c2_lo = vld1q_f64(x + 8);
+    float64x2_t c2_hi = vld1q_f64(x + 10);
+    float64x2_t c3_lo = vld1q_f64(x + 12);
+    float64x2_t c3_hi = vld1q_f64(x + 14);
+    for (int i = 0; i < 16; i += 4) {
+      float64x2_t m01 = vld1q_f64(y + i);
+      float64x2_t m23 = vld1q_f64(y + i + 2);
+      float64x2_t lo = vmulq_laneq_f64(c0_lo, m01, 0);
+      float64x2_t hi = vmulq_laneq_f64(c0_hi, m01, 0);
+      lo = vaddq_f64(lo, vmulq_laneq_f64(c1_lo, m01, 1));
+      hi = vaddq_f64(hi, vmulq_laneq_f64(c1_hi, m01, 1));
+      lo = vaddq_f64(lo, vmulq_laneq_f64(c2_lo, m23, 0));
+      hi = vaddq_f64(hi, vmulq_laneq_f64(c2_hi, m23, 0));
+      lo = vaddq_f64(lo, vmulq_laneq_f64(c3_lo, m23, 1));
+      hi = vaddq_f64(hi, vmulq_laneq_f64(c3_hi, m23, 1));
+      vst1q_f64(result + i, lo);
+      vst1q_f64(result + i + 2, hi);
+    }
+  })
+}
+
+void MapVector4Neon(const double* m, double* vec) {
+  UNSAFE_TODO({
+    float64x2_t v01 = vld1q_f64(vec);
+    float64x2_t v23 = vld1q_f64(vec + 2);
+    float64x2_t lo = vmulq_laneq_f64(vld1q_f64(m), v01, 0);
+    float64x2_t hi = vmulq_laneq_f64(vld1q_f64(m + 2), v01, 0);
+    lo = vaddq_f64(lo, vmulq_laneq_f64(vld1q_f64(m + 4), v01, 1));
+    hi = vaddq_f64(hi, vmulq_laneq_f64(vld1q_f64(m + 6), v01, 1));
+    lo = vaddq_f64(lo, vmulq_laneq_f64(vld1q_f64(m + 8), v23, 0));
+    hi = vaddq_f64(hi, vmulq_laneq_f64(vld1q_f64(m + 10), v23, 0));
+    lo = vaddq_f64(lo, vmulq_laneq_f64(vld1q_f64(m + 12), v23, 1));
+    hi = vaddq_f64(hi, vmulq_laneq_f64(vld1q_f64(m + 14), v23, 1));
+    vst1q_f64(vec, lo);
+    vst1q_f64(vec + 2, hi);
+  })
+}
+
+// Same as MapVector4Neon() for each lane of |v|, which are x, y, z and w.
+void MapVector4InLanesNeon(const double* m, Double4* v) {
+  UNSAFE_TODO({
+    const double* in = reinterpret_cast<const double*>(v);
+    float64x2_t lanes[4][2];
+    for (int j = 0; j < 4; ++j) {
+      lanes[j][0] = vld1q_f64(in + j * 4);
+      lanes[j][1] = vld1q_f64(in + j * 4 + 2);
+    }
+    double* out = reinterpret_cast<double*>(v);
+    for (int i = 0; i < 4; ++i) {
+      for (int h = 0; h < 2; ++h) {
+        float64x2_t r = vmulq_n_f64(lanes[0][h], m[i]);
+        r = vaddq_f64(r, vmulq_n_f64(lanes[1][h], m[4 + i]));
+        r = vaddq_f64(r, vmulq_n_f64(lanes[2][h], m[8 + i]));
+        r = vaddq_f64(r, vmulq_n_f64(lanes[3][h], m[12 + i]));
+        vst1q_f64(out + i * 4 + h * 2, r);
+      }
+    }
+  })
+}
+
+#endif
+
 }  // anonymous namespace
 
 void Matrix44::GetColMajor(base::span<double, 16> dst) const {
@@ -109,12 +295,11 @@ void Matrix44::GetColMajor(base::span<double, 16> dst) const {
 }
 
 void Matrix44::GetColMajorF(base::span<float, 16> dst) const {
-  base::span UNSAFE_TODO(src{&matrix_[0][0], base::fixed_extent<16>()});
-
-  // TODO: It's surprising that this isn't flagged as unsafe.
-  //       It'd be nice if copy_from() supported differing element types,
-  //       then this would be statically safe.
-  std::ranges::copy(src, dst.begin());
+  // One vector narrowing conversion and store per column.
+  for (int i = 0; i < 4; ++i) {
+    StoreFloat4(__builtin_convertvector(Col(i), Float4),
+                dst.subspan(static_cast<size_t>(i) * 4, 4u).data());
+  }
 }
 
 void Matrix44::PreTranslate(double dx, double dy) {
@@ -305,6 +490,16 @@ void Matrix44::SetConcat(const Matrix44& x, const Matrix44& y) {
     return;
   }
 
+#if defined(ARCH_CPU_X86_64)
+  if (HasAvx2()) {
+    ConcatAvx2(x.matrix_[0], y.matrix_[0], matrix_[0]);
+    return;
+  }
+#elif defined(ARCH_CPU_ARM64)
+  ConcatNeon(x.matrix_[0], y.matrix_[0], matrix_[0]);
+  return;
+#endif
+
   auto c0 = x.Col(0);
   auto c1 = x.Col(1);
   auto c2 = x.Col(2);
@@ -347,7 +542,13 @@ bool Matrix44::GetInverse(Matrix44& result) const {
   Double4 c2 = Col(2);
   Double4 c3 = Col(3);
 
-  if (!InverseWithDouble4Cols(c0, c1, c2, c3))
+#if defined(ARCH_CPU_X86_64)
+  bool invertible = HasAvx2() ? InverseAvx2(c0, c1, c2, c3)
+                                    : InverseWithDouble4Cols(c0, c1, c2, c3);
+#else
+  bool invertible = InverseWithDouble4Cols(c0, c1, c2, c3);
+#endif
+  if (!invertible)
     return false;
 
   result.SetCol(0, c0);
@@ -361,37 +562,15 @@ bool Matrix44::IsInvertible() const {
   return std::isnormal(static_cast<float>(Determinant()));
 }
 
-// This is a simplified version of InverseWithDouble4Cols().
 double Matrix44::Determinant() const {
   if (Is2dTransform())
     return matrix_[0][0] * matrix_[1][1] - matrix_[0][1] * matrix_[1][0];
 
-  Double4 c0 = Col(0);
-  Double4 c1 = Col(1);
-  Double4 c2 = Col(2);
-  Double4 c3 = Col(3);
-
-  // Note that r1 and r3 have components 2/3 and 0/1 swapped.
-  Double4 r0 = {c0[0], c1[0], c2[0], c3[0]};
-  Double4 r1 = {c2[1], c3[1], c0[1], c1[1]};
-  Double4 r2 = {c0[2], c1[2], c2[2], c3[2]};
-  Double4 r3 = {c2[3], c3[3], c0[3], c1[3]};
-
-  Double4 t = SwapInPairs(r2 * r3);
-  c0 = r1 * t;
-  t = SwapHighLow(t);
-  c0 = r1 * t - c0;
-  t = SwapInPairs(r1 * r2);
-  c0 += r3 * t;
-  t = SwapHighLow(t);
-  c0 -= r3 * t;
-  t = SwapInPairs(SwapHighLow(r1) * r3);
-  r2 = SwapHighLow(r2);
-  c0 += r2 * t;
-  t = SwapHighLow(t);
-  c0 -= r2 * t;
-
-  return Sum(r0 * c0);
+#if defined(ARCH_CPU_X86_64)
+  if (HasAvx2())
+    return DeterminantAvx2(Col(0), Col(1), Col(2), Col(3));
+#endif
+  return DeterminantWithDouble4Cols(Col(0), Col(1), Col(2), Col(3));
 }
 
 void Matrix44::Transpose() {
@@ -425,6 +604,16 @@ double Matrix44::MapVector2(base::span<double, 2> vec) const {
 }
 
 void Matrix44::MapVector4(double vec[4]) const {
+#if defined(ARCH_CPU_X86_64)
+  if (HasAvx2()) {
+    MapVector4Avx2(matrix_[0], vec);
+    return;
+  }
+#elif defined(ARCH_CPU_ARM64)
+  MapVector4Neon(matrix_[0], vec);
+  return;
+#endif
+
   Double4 v = LoadDouble4(vec);
   Double4 r0{matrix_[0][0], matrix_[1][0], matrix_[2][0], matrix_[3][0]};
   Double4 r1{matrix_[0][1], matrix_[1][1], matrix_[2][1], matrix_[3][1]};
@@ -434,6 +623,40 @@ void Matrix44::MapVector4(double vec[4]) const {
                vec);
 }
 
+void Matrix44::MapVector4InLanes(Double4& x,
+                                 Double4& y,
+                                 Double4& z,
+                                 Double4& w) const {
+  Double4 v[4] = {x, y, z, w};
+#if defined(ARCH_CPU_X86_64)
+  if (HasAvx2()) {
+    MapVector4InLanesAvx2(matrix_[0], v);
+    x = v[0];
+    y = v[1];
+    z = v[2];
+    w = v[3];
+    return;
+  }
+#elif defined(ARCH_CPU_ARM64)
+  MapVector4InLanesNeon(matrix_[0], v);
+  x = v[0];
+  y = v[1];
+  z = v[2];
+  w = v[3];
+  return;
+#endif
+
+  // The additions are in the same order as Sum() in MapVector4().
+  x = v[0] * matrix_[0][0] + v[1] * matrix_[1][0] + v[2] * matrix_[2][0] +
+      v[3] * matrix_[3][0];
+  y = v[0] * matrix_[0][1] + v[1] * matrix_[1][1] + v[2] * matrix_[2][1] +
+      v[3] * matrix_[3][1];
+  z = v[0] * matrix_[0][2] + v[1] * matrix_[1][2] + v[2] * matrix_[2][2] +
+      v[3] * matrix_[3][2];
+  w = v[0] * matrix_[0][3] + v[1] * matrix_[1][3] + v[2] * matrix_[2][3] +
+      v[3] * matrix_[3][3];
+}
+
 void Matrix44::Flatten() {
   matrix_[0][2] = 0;
   matrix_[1][2] = 0;
@@ -181,10 +181,27 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Matrix44 {
   // Applies the matrix to the vector in place.
   void MapVector4(double vec[4]) const;
 
+  // Applies the matrix in place to four vectors stored in lanes, i.e. to
+  // (x[i], y[i], z[i], w[i]) for each i, with the same rounding as
+  // MapVector4().
+  void MapVector4InLanes(Double4& x, Double4& y, Double4& z, Double4& w) const;
+
   // Same as above, but assumes the vec[2] is 0 and vec[3] is 1, discards
   // vec[2], and returns vec[3].
   double MapVector2(base::span<double, 2> vec) const;
 
+  // Returns this * (x, y, 0, 1) and this * (x, y, z, 1). These are used in
+  // loops mapping many points, where the caller has already dispatched on the
+  // matrix type once for the whole batch.
+  ALWAYS_INLINE Double4 MapPoint2dToDouble4(double x, double y) const {
+    return Col(0) * x + Col(1) * y + Col(3);
+  }
+  ALWAYS_INLINE Double4 MapPoint3dToDouble4(double x,
+                                            double y,
+                                            double z) const {
+    return Col(0) * x + Col(1) * y + Col(2) * z + Col(3);
+  }
+
   void Flatten();
 
   std::optional<DecomposedTransform> Decompose() const;
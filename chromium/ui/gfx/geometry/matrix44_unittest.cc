@@ -0,0 +1,88 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/matrix44.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace gfx {
+
+namespace {
+
+// Values whose products and sums round, so that a fused multiply-add, or
+// another order of the additions, would change the results.
+Matrix44 MakeMatrix(double seed) {
+  Matrix44 matrix(Matrix44::kUninitialized);
+  for (int row = 0; row < 4; ++row) {
+    for (int col = 0; col < 4; ++col) {
+      matrix.set_rc(row, col, seed / (row * 4 + col + 3) - 0.1 * col);
+    }
+  }
+  return matrix;
+}
+
+// The sum of the products in the order of the portable code, with each
+// multiplication and addition rounded on its own.
+double Dot(const double a[4], const double b[4]) {
+  double sum = a[0] * b[0];
+  for (int i = 1; i < 4; ++i) {
+    const double product = a[i] * b[i];
+    sum = sum + product;
+  }
+  return sum;
+}
+
+}  // namespace
+
+// The kernels that are selected for the CPU have the same results as the
+// portable code, on any CPU.
+TEST(Matrix44Test, ConcatIsTheSameOnEveryCpu) {
+  const Matrix44 x = MakeMatrix(1.7);
+  const Matrix44 y = MakeMatrix(-2.3);
+  Matrix44 result(Matrix44::kUninitialized);
+  result.SetConcat(x, y);
+  for (int row = 0; row < 4; ++row) {
+    const double x_row[4] = {x.rc(row, 0), x.rc(row, 1), x.rc(row, 2),
+                             x.rc(row, 3)};
+    for (int col = 0; col < 4; ++col) {
+      const double y_col[4] = {y.rc(0, col), y.rc(1, col), y.rc(2, col),
+                               y.rc(3, col)};
+      EXPECT_EQ(Dot(x_row, y_col), result.rc(row, col)) << row << " " << col;
+    }
+  }
+}
+
+TEST(Matrix44Test, MapVector4IsTheSameOnEveryCpu) {
+  const Matrix44 matrix = MakeMatrix(3.1);
+  double vectors[4][4] = {{0.3, -1.7, 2.9, 1},
+                          {1e-3, 7.1, 0.7, 0.9},
+                          {-4.4, 0.1, 5.3, 1.1},
+                          {1.0 / 3, 2.0 / 3, -1.0 / 7, 1}};
+  Double4 x, y, z, w;
+  for (int i = 0; i < 4; ++i) {
+    x[i] = vectors[i][0];
+    y[i] = vectors[i][1];
+    z[i] = vectors[i][2];
+    w[i] = vectors[i][3];
+  }
+  matrix.MapVector4InLanes(x, y, z, w);
+  for (int i = 0; i < 4; ++i) {
+    double expected[4];
+    for (int row = 0; row < 4; ++row) {
+      const double matrix_row[4] = {matrix.rc(row, 0), matrix.rc(row, 1),
+                                    matrix.rc(row, 2), matrix.rc(row, 3)};
+      expected[row] = Dot(matrix_row, vectors[i]);
+    }
+    matrix.MapVector4(vectors[i]);
+    for (int row = 0; row < 4; ++row) {
+      EXPECT_EQ(expected[row], vectors[i][row]) << i << " " << row;
+    }
+    EXPECT_EQ(expected[0], x[i]) << i;
+    EXPECT_EQ(expected[1], y[i]) << i;
+    EXPECT_EQ(expected[2], z[i]) << i;
+    EXPECT_EQ(expected[3], w[i]) << i;
+  }
+}
+
+}  // namespace gfx
@@ -0,0 +1,137 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/occlusion_accumulator.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "ui/gfx/geometry/region.h"
+
+namespace gfx {
+
+OcclusionAccumulator::OcclusionAccumulator(size_t max_rects,
+                                           size_t cost_budget)
+    : max_rects_(max_rects),
+      cost_budget_(cost_budget),
+      remaining_budget_(cost_budget) {
+  DCHECK_GE(max_rects_, 1u);
+  occluders_.reserve(max_rects_ + 2);
+}
+
+OcclusionAccumulator::OcclusionAccumulator(const OcclusionAccumulator& other) =
+    default;
+
+OcclusionAccumulator::~OcclusionAccumulator() = default;
+
+OcclusionAccumulator& OcclusionAccumulator::operator=(
+    const OcclusionAccumulator& other) = default;
+
+void OcclusionAccumulator::Reset() {
+  occluders_.clear();
+  remaining_budget_ = cost_budget_;
+}
+
+void OcclusionAccumulator::AddOccluder(const Rect& rect) {
+  if (rect.IsEmpty() || !Spend(2 * occluders_.size() + 1)) {
+    return;
+  }
+  for (const Rect& occluder : occluders_) {
+    if (occluder.Contains(rect)) {
+      return;
+    }
+  }
+  std::erase_if(occluders_, [&rect](const Rect& occluder) {
+    return rect.Contains(occluder);
+  });
+
+  // Merges the rect with the occluders that it extends into a larger covered
+  // rect, as long as that covers both.
+  Rect merged = rect;
+  for (bool grew = true; grew;) {
+    grew = false;
+    if (!Spend(occluders_.size())) {
+      break;
+    }
+    for (auto it = occluders_.begin(); it != occluders_.end(); ++it) {
+      Rect covered = MaximumCoveredRect(*it, merged);
+      if (covered.Contains(*it) && covered.Contains(merged)) {
+        merged = covered;
+        occluders_.erase(it);
+        grew = true;
+        break;
+      }
+    }
+  }
+
+  // Also keeps the largest rect covered by the merged rect and one occluder
+  // together, when it's larger than both, so that GetLargestOccluder() spans
+  // the occluders that overlap without forming a rect.
+  Rect spanning;
+  uint64_t merged_area = merged.size().Area64();
+  for (const Rect& occluder : occluders_) {
+    Rect covered = MaximumCoveredRect(occluder, merged);
+    uint64_t covered_area = covered.size().Area64();
+    if (covered_area > merged_area &&
+        covered_area > occluder.size().Area64() &&
+        covered_area > spanning.size().Area64()) {
+      spanning = covered;
+    }
+  }
+  occluders_.push_back(merged);
+  if (!spanning.IsEmpty()) {
+    occluders_.push_back(spanning);
+  }
+  while (occluders_.size() > max_rects_) {
+    occluders_.erase(std::ranges::min_element(
+        occluders_, {}, [](const Rect& r) { return r.size().Area64(); }));
+  }
+}
+
+bool OcclusionAccumulator::IsOccluded(const Rect& rect) {
+  if (rect.IsEmpty()) {
+    return true;
+  }
+  if (!Spend(occluders_.size())) {
+    return false;
+  }
+  size_t num_intersecting = 0;
+  for (const Rect& occluder : occluders_) {
+    if (occluder.Contains(rect)) {
+      return true;
+    }
+    num_intersecting += occluder.Intersects(rect);
+  }
+  if (num_intersecting < 2 || !Spend(num_intersecting * num_intersecting)) {
+    return false;
+  }
+
+  // The rect may be covered by several occluders together.
+  Region remaining(rect);
+  for (const Rect& occluder : occluders_) {
+    remaining.Subtract(occluder);
+  }
+  return remaining.IsEmpty();
+}
+
+Rect OcclusionAccumulator::GetLargestOccluder() const {
+  if (occluders_.empty()) {
+    return Rect();
+  }
+  return *std::ranges::max_element(
+      occluders_, {}, [](const Rect& r) { return r.size().Area64(); });
+}
+
+bool OcclusionAccumulator::Spend(size_t cost) {
+  if (cost > remaining_budget_) {
+    remaining_budget_ = 0;
+    return false;
+  }
+  remaining_budget_ -= cost;
+  return true;
+}
+
+}  // namespace gfx
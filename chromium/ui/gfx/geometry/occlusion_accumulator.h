@@ -0,0 +1,70 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_OCCLUSION_ACCUMULATOR_H_
+#define UI_GFX_GEOMETRY_OCCLUSION_ACCUMULATOR_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "base/component_export.h"
+#include "ui/gfx/geometry/rect.h"
+
+namespace gfx {
+
+// Accumulates the opaque rects of the layers of a frame, visited front to
+// back, to tell whether the content behind them is occluded. It keeps at most
+// max_rects() covering rects: added rects are merged with the ones they
+// extend into larger covered rects, as MaximumCoveredRect() computes, and the
+// smallest rects are dropped beyond the maximum. A rect covered by an added
+// rect and an occluder together is kept too, when it is larger than both.
+//
+// Every operation takes from a per-frame cost budget, counted in rects
+// compared. Once the budget is spent, added rects are ignored and no rect is
+// occluded, so the results are conservative: a rect is only occluded if it's
+// covered by the added rects.
+class COMPONENT_EXPORT(GEOMETRY) OcclusionAccumulator {
+ public:
+  static constexpr size_t kDefaultMaxRects = 8;
+  static constexpr size_t kDefaultCostBudget = 4096;
+
+  explicit OcclusionAccumulator(size_t max_rects = kDefaultMaxRects,
+                                size_t cost_budget = kDefaultCostBudget);
+  OcclusionAccumulator(const OcclusionAccumulator& other);
+  ~OcclusionAccumulator();
+
+  OcclusionAccumulator& operator=(const OcclusionAccumulator& other);
+
+  // Starts a new frame: removes the rects and restores the budget.
+  void Reset();
+
+  // Adds an opaque rect, which occludes the rects behind it.
+  void AddOccluder(const Rect& rect);
+
+  // Returns true if |rect| is covered by the added rects. Empty rects are
+  // occluded.
+  bool IsOccluded(const Rect& rect);
+
+  // Returns the largest covering rect, which is the largest rect known to be
+  // covered by the added rects.
+  Rect GetLargestOccluder() const;
+
+  const std::vector<Rect>& occluders() const { return occluders_; }
+  size_t max_rects() const { return max_rects_; }
+  size_t remaining_budget() const { return remaining_budget_; }
+
+ private:
+  // Takes |cost| from the budget, or returns false if it's spent.
+  bool Spend(size_t cost);
+
+  size_t max_rects_;
+  size_t cost_budget_;
+  size_t remaining_budget_;
+  std::vector<Rect> occluders_;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_OCCLUSION_ACCUMULATOR_H_
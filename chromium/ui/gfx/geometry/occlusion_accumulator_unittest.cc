@@ -0,0 +1,149 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/occlusion_accumulator.h"
+
+#include <stdint.h>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/region.h"
+
+namespace gfx {
+
+TEST(OcclusionAccumulatorTest, Empty) {
+  OcclusionAccumulator accumulator;
+  EXPECT_TRUE(accumulator.occluders().empty());
+  EXPECT_EQ(Rect(), accumulator.GetLargestOccluder());
+  EXPECT_FALSE(accumulator.IsOccluded(Rect(0, 0, 1, 1)));
+  EXPECT_TRUE(accumulator.IsOccluded(Rect(5, 5, 0, 10)));
+
+  accumulator.AddOccluder(Rect(0, 0, 0, 10));
+  EXPECT_TRUE(accumulator.occluders().empty());
+}
+
+TEST(OcclusionAccumulatorTest, Contained) {
+  OcclusionAccumulator accumulator;
+  accumulator.AddOccluder(Rect(10, 10, 20, 20));
+  accumulator.AddOccluder(Rect(12, 12, 5, 5));
+  EXPECT_EQ(1u, accumulator.occluders().size());
+  EXPECT_TRUE(accumulator.IsOccluded(Rect(10, 10, 20, 20)));
+  EXPECT_TRUE(accumulator.IsOccluded(Rect(15, 15, 3, 3)));
+  EXPECT_FALSE(accumulator.IsOccluded(Rect(9, 10, 20, 20)));
+  EXPECT_FALSE(accumulator.IsOccluded(Rect(0, 0, 5, 5)));
+
+  // A rect containing the occluders replaces them.
+  accumulator.AddOccluder(Rect(0, 0, 50, 50));
+  EXPECT_EQ(1u, accumulator.occluders().size());
+  EXPECT_EQ(Rect(0, 0, 50, 50), accumulator.GetLargestOccluder());
+}
+
+TEST(OcclusionAccumulatorTest, Merge) {
+  OcclusionAccumulator accumulator;
+  // Rects that abut or overlap into a rect are merged, transitively.
+  accumulator.AddOccluder(Rect(0, 0, 10, 10));
+  accumulator.AddOccluder(Rect(20, 0, 10, 10));
+  EXPECT_EQ(2u, accumulator.occluders().size());
+  accumulator.AddOccluder(Rect(5, 0, 20, 10));
+  EXPECT_EQ(1u, accumulator.occluders().size());
+  EXPECT_EQ(Rect(0, 0, 30, 10), accumulator.GetLargestOccluder());
+  accumulator.AddOccluder(Rect(0, 10, 30, 5));
+  EXPECT_EQ(1u, accumulator.occluders().size());
+  EXPECT_EQ(Rect(0, 0, 30, 15), accumulator.GetLargestOccluder());
+}
+
+TEST(OcclusionAccumulatorTest, Spanning) {
+  OcclusionAccumulator accumulator;
+  // A cross of two rects covers a rect larger than either.
+  accumulator.AddOccluder(Rect(0, 10, 100, 20));
+  accumulator.AddOccluder(Rect(10, 0, 20, 100));
+  EXPECT_EQ(Rect(0, 10, 100, 20), MaximumCoveredRect(Rect(0, 10, 100, 20),
+                                                    Rect(10, 0, 20, 100)));
+  EXPECT_EQ(Rect(0, 10, 100, 20), accumulator.GetLargestOccluder());
+
+  // An L shape covers a rect spanning both of its arms.
+  OcclusionAccumulator l_shape;
+  l_shape.AddOccluder(Rect(0, 0, 100, 60));
+  l_shape.AddOccluder(Rect(0, 50, 60, 100));
+  EXPECT_EQ(3u, l_shape.occluders().size());
+  EXPECT_EQ(Rect(0, 0, 60, 150), l_shape.GetLargestOccluder());
+  EXPECT_TRUE(l_shape.IsOccluded(Rect(0, 0, 60, 150)));
+}
+
+TEST(OcclusionAccumulatorTest, CoveredByMany) {
+  OcclusionAccumulator accumulator;
+  // A checkerboard of quadrants that don't merge pairwise.
+  accumulator.AddOccluder(Rect(0, 0, 10, 10));
+  accumulator.AddOccluder(Rect(10, 10, 10, 10));
+  accumulator.AddOccluder(Rect(10, 0, 10, 5));
+  accumulator.AddOccluder(Rect(10, 5, 10, 5));
+  accumulator.AddOccluder(Rect(0, 10, 10, 10));
+  EXPECT_TRUE(accumulator.IsOccluded(Rect(0, 0, 20, 20)));
+  EXPECT_TRUE(accumulator.IsOccluded(Rect(5, 5, 10, 10)));
+  EXPECT_FALSE(accumulator.IsOccluded(Rect(5, 5, 20, 10)));
+}
+
+TEST(OcclusionAccumulatorTest, MaxRects) {
+  OcclusionAccumulator accumulator(/*max_rects=*/3);
+  EXPECT_EQ(3u, accumulator.max_rects());
+  for (int i = 0; i < 5; ++i) {
+    accumulator.AddOccluder(Rect(i * 100, 0, 10 + i, 10));
+  }
+  // The smallest rects are dropped.
+  ASSERT_EQ(3u, accumulator.occluders().size());
+  EXPECT_FALSE(accumulator.IsOccluded(Rect(0, 0, 10, 10)));
+  EXPECT_FALSE(accumulator.IsOccluded(Rect(100, 0, 11, 10)));
+  EXPECT_TRUE(accumulator.IsOccluded(Rect(200, 0, 12, 10)));
+  EXPECT_TRUE(accumulator.IsOccluded(Rect(400, 0, 14, 10)));
+  EXPECT_EQ(Rect(400, 0, 14, 10), accumulator.GetLargestOccluder());
+}
+
+TEST(OcclusionAccumulatorTest, Budget) {
+  OcclusionAccumulator accumulator(/*max_rects=*/4, /*cost_budget=*/10);
+  accumulator.AddOccluder(Rect(0, 0, 10, 10));
+  accumulator.AddOccluder(Rect(100, 0, 10, 10));
+  EXPECT_EQ(2u, accumulator.occluders().size());
+  EXPECT_LT(accumulator.remaining_budget(), 10u);
+  while (accumulator.remaining_budget() > 0) {
+    accumulator.IsOccluded(Rect(0, 0, 5, 5));
+  }
+
+  // Once the budget is spent, rects are ignored and aren't occluded.
+  accumulator.AddOccluder(Rect(200, 0, 10, 10));
+  EXPECT_EQ(2u, accumulator.occluders().size());
+  EXPECT_FALSE(accumulator.IsOccluded(Rect(0, 0, 5, 5)));
+
+  // The next frame restores it.
+  accumulator.Reset();
+  EXPECT_TRUE(accumulator.occluders().empty());
+  EXPECT_EQ(10u, accumulator.remaining_budget());
+  accumulator.AddOccluder(Rect(200, 0, 10, 10));
+  EXPECT_TRUE(accumulator.IsOccluded(Rect(200, 0, 5, 5)));
+}
+
+TEST(OcclusionAccumulatorTest, Conservative) {
+  // Whatever is dropped, occluded rects are covered by the added rects.
+  uint32_t seed = 1;
+  const auto next = [&seed](int range) {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<int>((seed >> 8) % range);
+  };
+  for (size_t max_rects : {1u, 2u, 8u}) {
+    OcclusionAccumulator accumulator(max_rects);
+    Region added;
+    for (int i = 0; i < 40; ++i) {
+      Rect rect(next(80), next(80), next(30), next(30));
+      accumulator.AddOccluder(rect);
+      added.Union(rect);
+      for (const Rect& occluder : accumulator.occluders()) {
+        EXPECT_TRUE(added.Contains(occluder)) << occluder.ToString();
+      }
+      Rect query(next(100), next(100), next(20), next(20));
+      if (accumulator.IsOccluded(query)) {
+        EXPECT_TRUE(added.Contains(query)) << query.ToString();
+      }
+    }
+  }
+}
+
+}  // namespace gfx
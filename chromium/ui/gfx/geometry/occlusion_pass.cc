@@ -0,0 +1,65 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/occlusion_pass.h"
+
+#include "ui/gfx/geometry/occlusion_accumulator.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/rect_f.h"
+
+namespace gfx {
+
+namespace {
+
+// Returns the largest rect known to be covered by |opaque_rect| mapped by
+// |transform|, or an empty rect if the mapped quad isn't known to be
+// rectilinear.
+Rect MapOpaqueRect(const Transform& transform, const Rect& opaque_rect) {
+  if (opaque_rect.IsEmpty()) {
+    return Rect();
+  }
+  // Exact, even where RectF loses precision.
+  if (transform.ToInteger2dTranslation()) {
+    return transform.MapRect(opaque_rect);
+  }
+  bool is_rectilinear = false;
+  const QuadF quad =
+      transform.MapRectToQuad(RectF(opaque_rect), &is_rectilinear);
+  if (!is_rectilinear) {
+    return Rect();
+  }
+  return ToEnclosedRect(quad.BoundingBox());
+}
+
+}  // namespace
+
+void ComputeVisibleRegions(base::span<const OcclusionLayer> layers,
+                           OcclusionAccumulator& occlusion,
+                           std::vector<Region>& visible_regions,
+                           size_t max_region_rects) {
+  visible_regions.resize(layers.size());
+  for (size_t i = 0; i < layers.size(); ++i) {
+    const OcclusionLayer& layer = layers[i];
+    Region& visible = visible_regions[i];
+    visible.Clear();
+    visible.set_max_rects(max_region_rects);
+
+    const Rect bounds = layer.rect.IsEmpty()
+                            ? Rect()
+                            : layer.transform.MapRect(layer.rect);
+    if (!occlusion.IsOccluded(bounds)) {
+      visible.Union(bounds);
+      // The occluders are covered even once the budget is spent, and there
+      // are at most max_rects() of them.
+      for (const Rect& occluder : occlusion.occluders()) {
+        visible.Subtract(occluder);
+      }
+    }
+    occlusion.AddOccluder(MapOpaqueRect(
+        layer.transform, IntersectRects(layer.opaque_rect, layer.rect)));
+  }
+}
+
+}  // namespace gfx
@@ -0,0 +1,52 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_OCCLUSION_PASS_H_
+#define UI_GFX_GEOMETRY_OCCLUSION_PASS_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "base/component_export.h"
+#include "base/containers/span.h"
+#include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/region.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+class OcclusionAccumulator;
+
+// A layer of an occlusion pass, in its own space.
+struct OcclusionLayer {
+  // Maps the layer space to the target space.
+  Transform transform;
+  // The bounds of the content of the layer.
+  Rect rect;
+  // The opaque part of the content, which occludes the layers behind it. It's
+  // clipped to |rect|.
+  Rect opaque_rect;
+};
+
+// Computes the visible region of each of |layers|, visited front to back, in
+// the target space: the enclosing rect of its mapped rect, minus the rects
+// known to be covered by |occlusion| and by the layers in front of it. Each
+// opaque rect is then added to |occlusion|, as the enclosed rect of its
+// mapped quad, if the quad is known to be rectilinear from the transform, as
+// Transform::MapRectToQuad() tells; other opaque rects don't occlude.
+//
+// The results are conservative, so that the visible regions contain all of
+// the visible content: |occlusion| keeps a bounded number of rects from its
+// cost budget, and each region becomes its bounds beyond |max_region_rects|
+// rects. |visible_regions| is resized to the size of |layers|.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+void ComputeVisibleRegions(base::span<const OcclusionLayer> layers,
+                           OcclusionAccumulator& occlusion,
+                           std::vector<Region>& visible_regions,
+                           size_t max_region_rects = Region::kDefaultMaxRects);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_OCCLUSION_PASS_H_
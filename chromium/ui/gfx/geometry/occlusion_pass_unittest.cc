@@ -0,0 +1,74 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/occlusion_pass.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/occlusion_accumulator.h"
+
+namespace gfx {
+
+TEST(OcclusionPassTest, VisibleRegions) {
+  Transform scale;
+  scale.Scale(2, 2);
+  Transform rotation;
+  rotation.Rotate(45);
+  const OcclusionLayer layers[] = {
+      // A layer with an opaque part, in front.
+      {Transform::MakeTranslation(10, 10), Rect(0, 0, 50, 50),
+       Rect(0, 0, 50, 20)},
+      // Rotated, so its opaque rect doesn't occlude.
+      {rotation, Rect(0, 0, 10, 10), Rect(0, 0, 10, 10)},
+      // Partly occluded, and scaled into an opaque rect.
+      {scale, Rect(0, 0, 30, 30), Rect(0, 0, 30, 30)},
+      // Fully occluded.
+      {Transform(), Rect(5, 5, 50, 50), Rect()},
+      // Outside of the occlusion, and empty.
+      {Transform(), Rect(100, 100, 10, 10), Rect()},
+      {Transform(), Rect(), Rect(0, 0, 100, 100)}};
+
+  OcclusionAccumulator occlusion;
+  std::vector<Region> visible;
+  ComputeVisibleRegions(layers, occlusion, visible);
+  ASSERT_EQ(6u, visible.size());
+
+  EXPECT_EQ(Region(Rect(10, 10, 50, 50)), visible[0]);
+  EXPECT_EQ(Region(layers[1].transform.MapRect(layers[1].rect)), visible[1]);
+  Region expected(Rect(0, 0, 60, 60));
+  expected.Subtract(Rect(10, 10, 50, 20));
+  EXPECT_EQ(expected, visible[2]);
+  EXPECT_TRUE(visible[3].IsEmpty());
+  EXPECT_EQ(Region(Rect(100, 100, 10, 10)), visible[4]);
+  EXPECT_TRUE(visible[5].IsEmpty());
+
+  // The opaque rects of the translation and the scale, which merge, and not
+  // the ones of the rotation and the empty layer.
+  EXPECT_TRUE(occlusion.IsOccluded(Rect(0, 0, 60, 60)));
+  EXPECT_FALSE(occlusion.IsOccluded(Rect(0, 0, 61, 61)));
+}
+
+TEST(OcclusionPassTest, BoundedRegions) {
+  // Occluders in a grid cut the layer behind them into more rects than the
+  // maximum, so its region becomes its bounds.
+  std::vector<OcclusionLayer> layers;
+  for (int i = 0; i < 4; ++i) {
+    layers.push_back({Transform(), Rect(i * 10, i * 10, 5, 5),
+                      Rect(i * 10, i * 10, 5, 5)});
+  }
+  layers.push_back({Transform(), Rect(0, 0, 40, 40), Rect()});
+
+  OcclusionAccumulator occlusion;
+  std::vector<Region> visible;
+  ComputeVisibleRegions(layers, occlusion, visible, 2);
+  EXPECT_EQ(Region(Rect(0, 0, 40, 40)), visible.back());
+
+  occlusion.Reset();
+  ComputeVisibleRegions(layers, occlusion, visible);
+  EXPECT_FALSE(visible.back().Contains(Rect(0, 0, 5, 5)));
+  EXPECT_TRUE(visible.back().Contains(Rect(5, 0, 35, 10)));
+}
+
+}  // namespace gfx
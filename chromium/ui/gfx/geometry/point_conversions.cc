@@ -4,10 +4,35 @@
 
 #include "ui/gfx/geometry/point_conversions.h"
 
+#include <stddef.h>
+
+#include "base/check_op.h"
 #include "base/numerics/safe_conversions.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 
 namespace gfx {
 
+namespace {
+
+// Converts |points| into |results| two at a time, in the lanes of a Float4.
+template <Int4 (*Convert)(Float4)>
+void ConvertPoints(base::span<const PointF> points, base::span<Point> results) {
+  CheckBatchSpans(points, results);
+  for (size_t i = 0; i < points.size(); i += 2) {
+    const bool has_pair = i + 1 < points.size();
+    const PointF& second = points[has_pair ? i + 1 : i];
+    const Int4 converted =
+        Convert(Float4{points[i].x(), points[i].y(), second.x(), second.y()});
+    results[i] = Point(converted[0], converted[1]);
+    if (has_pair) {
+      results[i + 1] = Point(converted[2], converted[3]);
+    }
+  }
+}
+
+}  // namespace
+
 Point ToFlooredPoint(const PointF& point) {
   return Point(base::ClampFloor(point.x()), base::ClampFloor(point.y()));
 }
@@ -20,5 +45,20 @@ Point ToRoundedPoint(const PointF& point) {
   return Point(base::ClampRound(point.x()), base::ClampRound(point.y()));
 }
 
+void ToFlooredPoints(base::span<const PointF> points,
+                     base::span<Point> results) {
+  ConvertPoints<ClampFloorToInt4>(points, results);
+}
+
+void ToCeiledPoints(base::span<const PointF> points,
+                    base::span<Point> results) {
+  ConvertPoints<ClampCeilToInt4>(points, results);
+}
+
+void ToRoundedPoints(base::span<const PointF> points,
+                     base::span<Point> results) {
+  ConvertPoints<ClampRoundToInt4>(points, results);
+}
+
 }  // namespace gfx
 
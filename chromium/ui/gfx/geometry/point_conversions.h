@@ -6,6 +6,7 @@
 #define UI_GFX_GEOMETRY_POINT_CONVERSIONS_H_
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/point.h"
 #include "ui/gfx/geometry/point_f.h"
 
@@ -20,6 +21,18 @@ COMPONENT_EXPORT(GEOMETRY) Point ToCeiledPoint(const PointF& point);
 // Returns a Point with each component from the input PointF rounded.
 COMPONENT_EXPORT(GEOMETRY) Point ToRoundedPoint(const PointF& point);
 
+// Same as the functions above for each of |points|, into |results|, which must
+// have the same size. Two points are converted at a time, with SIMD rounding
+// and saturation.
+COMPONENT_EXPORT(GEOMETRY)
+void ToFlooredPoints(base::span<const PointF> points,
+                     base::span<Point> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToCeiledPoints(base::span<const PointF> points, base::span<Point> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToRoundedPoints(base::span<const PointF> points,
+                     base::span<Point> results);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_POINT_CONVERSIONS_H_
@@ -4,6 +4,12 @@
 
 #include "ui/gfx/geometry/point_f.h"
 
+#include <stddef.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/point.h"
 #include "ui/gfx/geometry/point_conversions.h"
@@ -49,6 +55,38 @@ TEST(PointFTest, ToRoundedPoint) {
   EXPECT_EQ(Point(-11, -11), ToRoundedPoint(PointF(-10.9999f, -10.9999f)));
 }
 
+TEST(PointFTest, ToFlooredCeiledAndRoundedPoints) {
+  constexpr float kInfinity = std::numeric_limits<float>::infinity();
+  // Halfway and nearly halfway cases, the bounds of the floats with fractions
+  // and of int, and values that saturate.
+  const float values[] = {0, -0.0f, 0.5f, -0.5f, 0.49999997f, -0.49999997f,
+                          1.5f, -2.5f, 0.75f, -1e-30f, 8388607.5f, -8388607.5f,
+                          // 16777217.0f rounds to 2^24.
+                          8388608.0f, 16777217.0f, 2147483520.0f, 2147483648.0f,
+                          -2147483648.0f, -2147483904.0f, 1e30f, -1e30f,
+                          kInfinity, -kInfinity, std::nanf(""), 3.25f};
+  // An odd number of points, so that the last one isn't in a pair.
+  std::vector<PointF> points;
+  for (float x : values) {
+    points.emplace_back(x, -x);
+  }
+  points.emplace_back(7.5f, -7.5f);
+  ASSERT_EQ(1u, points.size() % 2);
+
+  std::vector<Point> floored(points.size());
+  ToFlooredPoints(points, floored);
+  std::vector<Point> ceiled(points.size());
+  ToCeiledPoints(points, ceiled);
+  std::vector<Point> rounded(points.size());
+  ToRoundedPoints(points, rounded);
+  for (size_t i = 0; i < points.size(); ++i) {
+    SCOPED_TRACE(points[i].ToString());
+    EXPECT_EQ(ToFlooredPoint(points[i]), floored[i]);
+    EXPECT_EQ(ToCeiledPoint(points[i]), ceiled[i]);
+    EXPECT_EQ(ToRoundedPoint(points[i]), rounded[i]);
+  }
+}
+
 TEST(PointFTest, Scale) {
   EXPECT_EQ(PointF(2, -2), ScalePoint(PointF(1, -1), 2));
   EXPECT_EQ(PointF(2, -2), ScalePoint(PointF(1, -1), 2, 2));
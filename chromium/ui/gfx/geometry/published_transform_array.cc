@@ -0,0 +1,158 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/published_transform_array.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "base/containers/span.h"
+#include "ui/gfx/geometry/transform_serialization.h"
+
+namespace gfx {
+
+namespace {
+
+constexpr size_t kBytesPerWord = sizeof(uint64_t);
+constexpr size_t kOffsetsPerWord = kBytesPerWord / sizeof(uint32_t);
+// The size and the number of bytes.
+constexpr size_t kHeaderWords = 2;
+
+size_t WordsForBytes(size_t bytes) {
+  return (bytes + kBytesPerWord - 1) / kBytesPerWord;
+}
+
+size_t WordsForOffsets(size_t offsets) {
+  return (offsets + kOffsetsPerWord - 1) / kOffsetsPerWord;
+}
+
+// Copies |bytes| to the first words of |words|, zero-padding the last one.
+void StoreBytes(base::span<const uint8_t> bytes,
+                base::span<std::atomic<uint64_t>> words) {
+  for (size_t i = 0; i * kBytesPerWord < bytes.size(); ++i) {
+    const base::span<const uint8_t> chunk = bytes.subspan(
+        i * kBytesPerWord,
+        std::min(kBytesPerWord, bytes.size() - i * kBytesPerWord));
+    uint64_t word = 0;
+    memcpy(&word, chunk.data(), chunk.size());
+    words[i].store(word, std::memory_order_relaxed);
+  }
+}
+
+void LoadBytes(base::span<const std::atomic<uint64_t>> words,
+               base::span<uint8_t> bytes) {
+  for (size_t i = 0; i * kBytesPerWord < bytes.size(); ++i) {
+    const base::span<uint8_t> chunk = bytes.subspan(
+        i * kBytesPerWord,
+        std::min(kBytesPerWord, bytes.size() - i * kBytesPerWord));
+    const uint64_t word = words[i].load(std::memory_order_relaxed);
+    memcpy(chunk.data(), &word, chunk.size());
+  }
+}
+
+void StoreOffsets(base::span<const uint32_t> offsets,
+                  base::span<std::atomic<uint64_t>> words) {
+  for (size_t i = 0; i * kOffsetsPerWord < offsets.size(); ++i) {
+    uint64_t word = offsets[i * kOffsetsPerWord];
+    if (i * kOffsetsPerWord + 1 < offsets.size()) {
+      word |= uint64_t{offsets[i * kOffsetsPerWord + 1]} << 32;
+    }
+    words[i].store(word, std::memory_order_relaxed);
+  }
+}
+
+void LoadOffsets(base::span<const std::atomic<uint64_t>> words,
+                 base::span<uint32_t> offsets) {
+  for (size_t i = 0; i * kOffsetsPerWord < offsets.size(); ++i) {
+    const uint64_t word = words[i].load(std::memory_order_relaxed);
+    offsets[i * kOffsetsPerWord] = static_cast<uint32_t>(word);
+    if (i * kOffsetsPerWord + 1 < offsets.size()) {
+      offsets[i * kOffsetsPerWord + 1] = static_cast<uint32_t>(word >> 32);
+    }
+  }
+}
+
+}  // namespace
+
+PublishedTransformArray::PublishedTransformArray(size_t max_size)
+    : PublishedTransformArray(max_size,
+                              max_size * kMaxSerializedTransformSize) {}
+
+PublishedTransformArray::PublishedTransformArray(size_t max_size,
+                                                 size_t max_bytes)
+    : max_size_(max_size), max_bytes_(max_bytes), words_(2 * CopyWords()) {}
+
+PublishedTransformArray::~PublishedTransformArray() = default;
+
+size_t PublishedTransformArray::CopyWords() const {
+  return kHeaderWords + WordsForOffsets(max_size_) + WordsForBytes(max_bytes_);
+}
+
+void PublishedTransformArray::Publish(const CompactTransformArray& transforms) {
+  CHECK_LE(transforms.size(), max_size_);
+  CHECK_LE(transforms.bytes_.size(), max_bytes_);
+
+  // Send readers to the second copy while the first one is written, and then
+  // back to the first one, which is complete, while the second one is. Each
+  // store of the sequence releases the copy that it sends readers to: the odd
+  // one the second copy written by the previous call, and the even one the
+  // first copy written just before. The release fences order the writes of
+  // each copy after the change of the sequence, so that a reader that sees
+  // any of them also sees that change and retries.
+  const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+  sequence_.store(sequence + 1, std::memory_order_release);
+  std::atomic_thread_fence(std::memory_order_release);
+  WriteCopy(0, transforms);
+  sequence_.store(sequence + 2, std::memory_order_release);
+  std::atomic_thread_fence(std::memory_order_release);
+  WriteCopy(1, transforms);
+}
+
+CompactTransformArray PublishedTransformArray::Read() const {
+  CompactTransformArray transforms;
+  for (;;) {
+    const uint32_t sequence = sequence_.load(std::memory_order_acquire);
+    const bool complete = ReadCopy(sequence & 1, transforms);
+    // Orders the reads of the copy before reading the sequence again.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (complete && sequence_.load(std::memory_order_relaxed) == sequence) {
+      return transforms;
+    }
+  }
+}
+
+void PublishedTransformArray::WriteCopy(
+    size_t copy,
+    const CompactTransformArray& transforms) {
+  const base::span<std::atomic<uint64_t>> words =
+      base::span(words_).subspan(copy * CopyWords(), CopyWords());
+  words[0].store(transforms.offsets_.size(), std::memory_order_relaxed);
+  words[1].store(transforms.bytes_.size(), std::memory_order_relaxed);
+  StoreOffsets(transforms.offsets_, words.subspan(kHeaderWords));
+  StoreBytes(transforms.bytes_,
+             words.subspan(kHeaderWords + WordsForOffsets(max_size_)));
+}
+
+bool PublishedTransformArray::ReadCopy(
+    size_t copy,
+    CompactTransformArray& transforms) const {
+  const base::span<const std::atomic<uint64_t>> words =
+      base::span(words_).subspan(copy * CopyWords(), CopyWords());
+  const uint64_t size = words[0].load(std::memory_order_relaxed);
+  const uint64_t bytes = words[1].load(std::memory_order_relaxed);
+  // A torn header can be anything.
+  if (size > max_size_ || bytes > max_bytes_) {
+    return false;
+  }
+  transforms.offsets_.resize(size);
+  transforms.bytes_.resize(bytes);
+  LoadOffsets(words.subspan(kHeaderWords), transforms.offsets_);
+  LoadBytes(words.subspan(kHeaderWords + WordsForOffsets(max_size_)),
+            transforms.bytes_);
+  return true;
+}
+
+}  // namespace gfx
@@ -0,0 +1,72 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_PUBLISHED_TRANSFORM_ARRAY_H_
+#define UI_GFX_GEOMETRY_PUBLISHED_TRANSFORM_ARRAY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <vector>
+
+#include "base/component_export.h"
+#include "ui/gfx/geometry/compact_transform_array.h"
+
+namespace gfx {
+
+// Publishes arrays of transforms from one writer thread, e.g. the transforms
+// of the layers of each frame, to reader threads such as one that hit tests,
+// without locks. Publish() replaces the whole array at once, and Read()
+// returns a copy of the last published array, never a mix of two.
+//
+// This is a seqlock with two copies of the array (a "latch"): while the
+// writer updates one copy, readers read the other, so readers only retry
+// when a publication overlaps their read. Each copy holds the packed
+// encoding of a CompactTransformArray in fixed storage, so publishing doesn't
+// allocate.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) PublishedTransformArray {
+ public:
+  // Can publish arrays of up to |max_size| transforms whose packed encodings
+  // take up to |max_bytes| in total. That's always the case with
+  // |max_size| * kMaxSerializedTransformSize bytes, which is what the first
+  // constructor uses, though the common kinds of transforms take much less.
+  explicit PublishedTransformArray(size_t max_size);
+  PublishedTransformArray(size_t max_size, size_t max_bytes);
+  PublishedTransformArray(const PublishedTransformArray&) = delete;
+  PublishedTransformArray& operator=(const PublishedTransformArray&) = delete;
+  ~PublishedTransformArray();
+
+  size_t max_size() const { return max_size_; }
+  size_t max_bytes() const { return max_bytes_; }
+
+  // Publishes |transforms|, which must fit in the limits above. Must be
+  // called on one thread at a time.
+  void Publish(const CompactTransformArray& transforms);
+
+  // Returns the last published array, or an empty one if none was published.
+  // Can be called on any thread, at the same time as Publish().
+  CompactTransformArray Read() const;
+
+ private:
+  // Each copy of the array takes CopyWords() words of |words_|: the size and
+  // the number of bytes, the offsets, and then the packed bytes. They're
+  // atomics, so that a read overlapping a publication is well defined before
+  // it's retried.
+  size_t CopyWords() const;
+  void WriteCopy(size_t copy, const CompactTransformArray& transforms);
+  // Returns false if the copy is torn.
+  bool ReadCopy(size_t copy, CompactTransformArray& transforms) const;
+
+  const size_t max_size_;
+  const size_t max_bytes_;
+  // Odd while the first copy is written, and even while the second one is.
+  // Readers read the copy that isn't written.
+  std::atomic<uint32_t> sequence_{0};
+  std::vector<std::atomic<uint64_t>> words_;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_PUBLISHED_TRANSFORM_ARRAY_H_
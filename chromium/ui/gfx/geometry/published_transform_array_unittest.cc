@@ -0,0 +1,155 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/published_transform_array.h"
+
+#include <stddef.h>
+
+#include <atomic>
+
+#include "base/threading/simple_thread.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/compact_transform_array.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+namespace {
+
+constexpr size_t kMaxSize = 8;
+
+// The array of frame |frame|, whose size and transforms are all derived from
+// the frame, so that a reader can tell if it got a mix of frames. Each
+// transform maps the origin to (frame, 0, 0).
+CompactTransformArray MakeFrame(int frame) {
+  CompactTransformArray transforms;
+  for (size_t i = 0; i < frame % kMaxSize + 1; ++i) {
+    Transform transform = Transform::MakeTranslation(frame, 0);
+    if (frame % 3 == 0) {
+      transform.RotateAboutXAxis(frame);
+    }
+    transforms.push_back(transform);
+  }
+  return transforms;
+}
+
+TEST(PublishedTransformArrayTest, PublishAndRead) {
+  PublishedTransformArray published(kMaxSize);
+  EXPECT_EQ(kMaxSize, published.max_size());
+  EXPECT_TRUE(published.Read().empty());
+
+  for (int frame = 1; frame < 5; ++frame) {
+    const CompactTransformArray transforms = MakeFrame(frame);
+    published.Publish(transforms);
+    const CompactTransformArray read = published.Read();
+    ASSERT_EQ(transforms.size(), read.size());
+    for (size_t i = 0; i < read.size(); ++i) {
+      EXPECT_EQ(transforms.Get(i), read.Get(i));
+    }
+  }
+
+  published.Publish(CompactTransformArray());
+  EXPECT_TRUE(published.Read().empty());
+
+  // Translations of floats take 9 bytes.
+  PublishedTransformArray small(2, 18);
+  CompactTransformArray translations;
+  translations.push_back(Transform::MakeTranslation(1, 2));
+  translations.push_back(Transform::MakeTranslation(3, 4));
+  small.Publish(translations);
+  EXPECT_EQ(Transform::MakeTranslation(3, 4), small.Read().Get(1));
+}
+
+class ReaderThread : public base::SimpleThread {
+ public:
+  ReaderThread(const PublishedTransformArray& published,
+               const std::atomic<bool>& done)
+      : base::SimpleThread("Reader"), published_(published), done_(done) {}
+
+  void Run() override {
+    do {
+      const CompactTransformArray read = published_.Read();
+      ASSERT_FALSE(read.empty());
+      ++reads_;
+      const int frame =
+          static_cast<int>(read.Get(0).MapPoint(Point3F()).x());
+      const CompactTransformArray expected = MakeFrame(frame);
+      ASSERT_EQ(expected.size(), read.size()) << frame;
+      for (size_t i = 0; i < read.size(); ++i) {
+        ASSERT_EQ(expected.Get(i), read.Get(i)) << frame;
+      }
+    } while (!done_.load());
+  }
+
+  int reads() const { return reads_; }
+
+ private:
+  const PublishedTransformArray& published_;
+  const std::atomic<bool>& done_;
+  int reads_ = 0;
+};
+
+TEST(PublishedTransformArrayTest, ConcurrentReads) {
+  PublishedTransformArray published(kMaxSize);
+  published.Publish(MakeFrame(1));
+
+  std::atomic<bool> done{false};
+  ReaderThread reader_1(published, done);
+  ReaderThread reader_2(published, done);
+  reader_1.Start();
+  reader_2.Start();
+  for (int frame = 2; frame < 3000; ++frame) {
+    published.Publish(MakeFrame(frame));
+  }
+  done.store(true);
+  reader_1.Join();
+  reader_2.Join();
+  EXPECT_GT(reader_1.reads(), 0);
+  EXPECT_GT(reader_2.reads(), 0);
+}
+
+class WriterThread : public base::SimpleThread {
+ public:
+  WriterThread(PublishedTransformArray& published, int frames)
+      : base::SimpleThread("Writer"), published_(published), frames_(frames) {}
+
+  void Run() override {
+    for (int frame = 2; frame <= frames_; ++frame) {
+      published_.Publish(MakeFrame(frame));
+    }
+  }
+
+ private:
+  PublishedTransformArray& published_;
+  const int frames_;
+};
+
+// Reads on the main thread while another thread publishes, so that reads
+// also overlap the writes of the second copy. Each read must be a whole
+// frame, and no older than the previous read.
+TEST(PublishedTransformArrayTest, ReadsAreWholeAndInOrder) {
+  constexpr int kFrames = 20000;
+  PublishedTransformArray published(kMaxSize);
+  published.Publish(MakeFrame(1));
+
+  WriterThread writer(published, kFrames);
+  writer.Start();
+  int last_frame = 1;
+  while (last_frame < kFrames) {
+    const CompactTransformArray read = published.Read();
+    ASSERT_FALSE(read.empty());
+    const int frame = static_cast<int>(read.Get(0).MapPoint(Point3F()).x());
+    ASSERT_GE(frame, last_frame);
+    const CompactTransformArray expected = MakeFrame(frame);
+    ASSERT_EQ(expected.size(), read.size()) << frame;
+    for (size_t i = 0; i < read.size(); ++i) {
+      ASSERT_EQ(expected.Get(i), read.Get(i)) << frame;
+    }
+    last_frame = frame;
+  }
+  writer.Join();
+}
+
+}  // namespace
+}  // namespace gfx
@@ -4,15 +4,30 @@
 
 #include "ui/gfx/geometry/quad_f.h"
 
+#include <array>
 #include <limits>
 
 #include "base/strings/stringprintf.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/triangle_f.h"
 
 namespace gfx {
 
 namespace {
 
+// Returns CrossProduct(vector, point - base) for the points in the lanes of
+// (|x|, |y|).
+ALWAYS_INLINE Double4 CrossProducts4(const PointF& base,
+                                     const Vector2dF& vector,
+                                     Float4 x,
+                                     Float4 y) {
+  Double4 dx = __builtin_convertvector(x - base.x(), Double4);
+  Double4 dy = __builtin_convertvector(y - base.y(), Double4);
+  return static_cast<double>(vector.x()) * dy -
+         static_cast<double>(vector.y()) * dx;
+}
+
 PointF RightMostCornerToVector(const RectF& rect, const Vector2dF& vector) {
   // Return the corner of the rectangle that if it is to the left of the vector
   // would mean all of the rectangle is to the left of the vector.
@@ -125,9 +140,55 @@ bool QuadF::Contains(const PointF& point) const {
          PointIsInTriangle(point, p1_, p3_, p4_);
 }
 
+void QuadF::ContainsMany(base::span<const PointF> points,
+                         base::span<bool> contains) const {
+  CheckBatchSpans(points, contains);
+  const TriangleF first(p1_, p2_, p3_);
+  const TriangleF second(p1_, p3_, p4_);
+  first.ContainsMany(points, contains);
+
+  // Tests the points against the second triangle in chunks, without
+  // allocating.
+  constexpr size_t kChunkSize = 64;
+  std::array<bool, kChunkSize> in_second;
+  for (size_t start = 0; start < points.size(); start += kChunkSize) {
+    const size_t size = std::min(kChunkSize, points.size() - start);
+    auto chunk = base::span(in_second).first(size);
+    second.ContainsMany(points.subspan(start, size), chunk);
+    for (size_t i = 0; i < size; ++i) {
+      contains[start + i] = contains[start + i] || chunk[i];
+    }
+  }
+}
+
+bool QuadF::IsConvex() const {
+  // The cross products of the edges at each corner, which all have the same
+  // sign (or are 0) if the quad turns the same way at each corner. A quad
+  // can't turn the same way around more than once.
+  const Float4 x{p1_.x(), p2_.x(), p3_.x(), p4_.x()};
+  const Float4 y{p1_.y(), p2_.y(), p3_.y(), p4_.y()};
+  const Float4 next_x{p2_.x(), p3_.x(), p4_.x(), p1_.x()};
+  const Float4 next_y{p2_.y(), p3_.y(), p4_.y(), p1_.y()};
+  const Double4 edge_x = __builtin_convertvector(next_x - x, Double4);
+  const Double4 edge_y = __builtin_convertvector(next_y - y, Double4);
+  const Double4 previous_edge_x{edge_x[3], edge_x[0], edge_x[1], edge_x[2]};
+  const Double4 previous_edge_y{edge_y[3], edge_y[0], edge_y[1], edge_y[2]};
+  const Double4 turns = previous_edge_x * edge_y - previous_edge_y * edge_x;
+  return AllTrue(turns >= 0) || AllTrue(turns <= 0);
+}
+
 bool QuadF::ContainsQuad(const QuadF& other) const {
-  return Contains(other.p1()) && Contains(other.p2()) && Contains(other.p3()) &&
-         Contains(other.p4());
+  // A convex quad contains all of |other| if it contains its points. Other
+  // quads would also need their edges to be tested against those of |other|,
+  // so they conservatively contain nothing.
+  if (!IsConvex()) {
+    return false;
+  }
+  const std::array<PointF, 4> points = {other.p1(), other.p2(), other.p3(),
+                                        other.p4()};
+  std::array<bool, 4> contains;
+  ContainsMany(points, contains);
+  return contains[0] && contains[1] && contains[2] && contains[3];
 }
 
 void QuadF::Scale(float x_scale, float y_scale) {
@@ -180,6 +241,57 @@ bool QuadF::IntersectsRect(const RectF& rect) const {
   return IntersectsRectPartial(rect);
 }
 
+// static
+void QuadF::IntersectsRectMany(base::span<const float> x,
+                               base::span<const float> y,
+                               const RectF& rect,
+                               base::span<bool> intersects) {
+  CHECK_EQ(x.size(), 4 * intersects.size());
+  CHECK_EQ(y.size(), 4 * intersects.size());
+  for (size_t i = 0; i < intersects.size(); ++i) {
+    const size_t p = 4 * i;
+    const Float4 px{x[p], x[p + 1], x[p + 2], x[p + 3]};
+    const Float4 py{y[p], y[p + 1], y[p + 2], y[p + 3]};
+
+    // As in IntersectsRect(), the sides of the rect first.
+    if (std::min({px[0], px[1], px[2], px[3]}) > rect.right() ||
+        rect.x() > std::max({px[0], px[1], px[2], px[3]}) ||
+        std::min({py[0], py[1], py[2], py[3]}) > rect.bottom() ||
+        rect.y() > std::max({py[0], py[1], py[2], py[3]})) {
+      intersects[i] = false;
+      continue;
+    }
+
+    // Then, as in IntersectsRectPartial(), each clockwise side of the quad,
+    // from each point to the next one if the quad is clockwise, or to the
+    // previous one if not, against the corner of the rect that is the most to
+    // its right, with all four sides in lanes. This is IsCounterClockwise().
+    const float p24 = py[1] - py[3];
+    const float p31 = py[2] - py[0];
+    const bool counter_clockwise =
+        static_cast<double>(px[0]) * p24 + static_cast<double>(px[1]) * p31 <
+        static_cast<double>(px[2]) * p24 + static_cast<double>(px[3]) * p31;
+    const Float4 to_x = counter_clockwise
+                            ? Float4{px[3], px[0], px[1], px[2]}
+                            : Float4{px[1], px[2], px[3], px[0]};
+    const Float4 to_y = counter_clockwise
+                            ? Float4{py[3], py[0], py[1], py[2]}
+                            : Float4{py[1], py[2], py[3], py[0]};
+    const Float4 vx = to_x - px;
+    const Float4 vy = to_y - py;
+    const Float4 corner_x =
+        vy >= 0 ? Float4{} + rect.x() : Float4{} + rect.right();
+    const Float4 corner_y =
+        vx >= 0 ? Float4{} + rect.bottom() : Float4{} + rect.y();
+    const Double4 dx = __builtin_convertvector(corner_x - px, Double4);
+    const Double4 dy = __builtin_convertvector(corner_y - py, Double4);
+    const Double4 cross = __builtin_convertvector(vx, Double4) * dy -
+                          __builtin_convertvector(vy, Double4) * dx;
+    const DoubleBoolean4 outside = cross < 0;
+    intersects[i] = !(outside[0] | outside[1] | outside[2] | outside[3]);
+  }
+}
+
 bool QuadF::IntersectsRectPartial(const RectF& rect) const {
   // For each side of the quad clockwise we check if the rectangle is to the
   // left of it since only content on the right can overlap with the quad.
@@ -220,27 +332,11 @@ bool QuadF::IntersectsRectPartial(const RectF& rect) const {
   return true;
 }
 
-bool QuadF::IsToTheLeftOfOrTouchingLine(const PointF& base,
-                                        const Vector2dF& vector) const {
-  if (CrossProduct(vector, p1_ - base) >= 0) {
-    return false;
-  }
-  if (CrossProduct(vector, p2_ - base) >= 0) {
-    return false;
-  }
-  if (CrossProduct(vector, p3_ - base) >= 0) {
-    return false;
-  }
-  if (CrossProduct(vector, p4_ - base) >= 0) {
-    return false;
-  }
-  return true;
-}
-
 bool QuadF::FullyOutsideOneEdge(const QuadF& quad) const {
   // For each side of the quad clockwise we check if the quad is to the left of
   // it since only content on the right can overlap with the quad. This only
-  // works if the quads are convex.
+  // works if this quad is convex. The points of |quad| are tested against each
+  // side at once.
   Vector2dF v1, v2, v3, v4;
 
   // Ensure we use clockwise vectors.
@@ -256,25 +352,31 @@ bool QuadF::FullyOutsideOneEdge(const QuadF& quad) const {
     v4 = p1_ - p4_;
   }
 
-  if (quad.IsToTheLeftOfOrTouchingLine(p1_, v1)) {
-    return true;
-  }
-  if (quad.IsToTheLeftOfOrTouchingLine(p2_, v2)) {
-    return true;
-  }
-  if (quad.IsToTheLeftOfOrTouchingLine(p3_, v3)) {
-    return true;
-  }
-  if (quad.IsToTheLeftOfOrTouchingLine(p4_, v4)) {
-    return true;
-  }
-  return false;
+  const Float4 x{quad.p1_.x(), quad.p2_.x(), quad.p3_.x(), quad.p4_.x()};
+  const Float4 y{quad.p1_.y(), quad.p2_.y(), quad.p3_.y(), quad.p4_.y()};
+  return AllTrue(CrossProducts4(p1_, v1, x, y) < 0) ||
+         AllTrue(CrossProducts4(p2_, v2, x, y) < 0) ||
+         AllTrue(CrossProducts4(p3_, v3, x, y) < 0) ||
+         AllTrue(CrossProducts4(p4_, v4, x, y) < 0);
 }
 
 bool QuadF::IntersectsQuad(const QuadF& quad) const {
-  // Check if |quad| is fully outside one of the edges of this quad or vice
-  // versa.
-  return !FullyOutsideOneEdge(quad) && !quad.FullyOutsideOneEdge(*this);
+  // The sides of a convex quad are separating axes if |quad| is fully outside
+  // one of them. Those of other quads aren't, so if either quad isn't convex,
+  // the axes of the bounding boxes, which contain the quads, are tested
+  // instead.
+  const bool convex = IsConvex();
+  const bool other_convex = quad.IsConvex();
+  if (!convex || !other_convex) {
+    const auto [min, max] = Extents();
+    const auto [other_min, other_max] = quad.Extents();
+    if (min.x() > other_max.x() || other_min.x() > max.x() ||
+        min.y() > other_max.y() || other_min.y() > max.y()) {
+      return false;
+    }
+  }
+  return !(convex && FullyOutsideOneEdge(quad)) &&
+         !(other_convex && quad.FullyOutsideOneEdge(*this));
 }
 
 bool QuadF::IntersectsCircle(const PointF& center, float radius) const {
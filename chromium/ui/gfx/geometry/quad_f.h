@@ -14,6 +14,7 @@
 
 #include "base/check_op.h"
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/rect_f.h"
 
@@ -51,6 +52,11 @@ class COMPONENT_EXPORT(GEOMETRY) QuadF {
   // Returns true if the quad is an axis-aligned rectangle.
   bool IsRectilinear() const;
 
+  // Returns true if the quad is convex, including when some or all of its
+  // points are collinear or coincident. This is false for concave and
+  // self-intersecting quads.
+  bool IsConvex() const;
+
   // Returns true if the points of the quad are in counter-clockwise order. This
   // assumes that the quad is convex, and that no three points are collinear.
   bool IsCounterClockwise() const;
@@ -59,9 +65,16 @@ class COMPONENT_EXPORT(GEOMETRY) QuadF {
   // edge of the quad. This assumes that the quad is convex.
   bool Contains(const PointF& point) const;
 
-  // Returns true if the |quad| parameter is contained within |this| quad.
-  // This method assumes |this| quad is convex. The |quad| parameter has no
-  // restrictions.
+  // Sets each element of |contains| to Contains() of the point at the same
+  // index of |points|, with the same results. The quad is split into two
+  // TriangleFs, and points are tested against them with
+  // TriangleF::ContainsMany(). Both spans must have the same size.
+  void ContainsMany(base::span<const PointF> points,
+                    base::span<bool> contains) const;
+
+  // Returns true if the |quad| parameter is contained within |this| quad, as
+  // Contains() is for its points. If |this| quad isn't convex, returns false.
+  // The |quad| parameter has no restrictions.
   bool ContainsQuad(const QuadF& quad) const;
 
   // Returns two points (forming an axis-aligned bounding box) that bounds the
@@ -112,13 +125,27 @@ class COMPONENT_EXPORT(GEOMETRY) QuadF {
   // intersecting area is empty (i.e., the intersection is a line or a point).
   bool IntersectsRect(const RectF&) const;
 
+  // Sets each element of |intersects| to IntersectsRect(rect) of the quad at
+  // the same index, with the same results, e.g. to cull many transformed
+  // tiles against a viewport. The x and y of the points of the quad at index
+  // i, from p1() to p4(), are the elements from 4 * i to 4 * i + 3 of |x| and
+  // |y|, which must have 4 times the size of |intersects|. The points of each
+  // quad are tested in lanes.
+  static void IntersectsRectMany(base::span<const float> x,
+                                 base::span<const float> y,
+                                 const RectF& rect,
+                                 base::span<bool> intersects);
+
   // Like the above, but only checks `rect` against the sides of quad ("does
   // half of the job"). Can be used if it is known beforehand that the bounding
   // box of the quad intersects `rect`.
   bool IntersectsRectPartial(const RectF& rect) const;
 
-  // Tests whether any part of the quad intersects with this quad.
-  // This intersection is edge-inclusive.
+  // Tests whether any part of the quad intersects with this quad, with the
+  // sides of the quads, if they're convex, and of their bounding boxes, if
+  // not, as separating axes. This intersection is edge-inclusive, and is
+  // conservative for quads that aren't convex, i.e. it may return true for
+  // quads that only have overlapping bounding boxes.
   bool IntersectsQuad(const QuadF& quad) const;
 
   // Test whether any part of the circle/ellipse intersects with this quad.
@@ -141,8 +168,6 @@ class COMPONENT_EXPORT(GEOMETRY) QuadF {
   friend bool operator==(const QuadF&, const QuadF&) = default;
 
  private:
-  bool IsToTheLeftOfOrTouchingLine(const PointF& base,
-                                   const Vector2dF& vector) const;
   bool FullyOutsideOneEdge(const QuadF& quad) const;
 
   PointF p1_;
@@ -8,6 +8,8 @@
 
 #include <algorithm>
 #include <array>
+#include <limits>
+#include <vector>
 
 #include "build/build_config.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -353,6 +355,43 @@ TEST(QuadFTest, ContainsPoint) {
   EXPECT_FALSE(QuadF(s1, s2, s3, s4).Contains(PointF(0, 1.1f)));
 }
 
+TEST(QuadFTest, ContainsMany) {
+  const float epsilon = 2 * std::numeric_limits<float>::epsilon();
+  const QuadF quads[] = {
+      QuadF(PointF(1.3f, 1.4f), PointF(-0.8f, 4.4f), PointF(1.8f, 6.1f),
+            PointF(2.1f, 1.6f)),
+      QuadF(RectF(-1, -2, 3, 4)),
+      // Degenerate quads: a line and a point.
+      QuadF(PointF(0, 0), PointF(1, 1), PointF(2, 2), PointF(3, 3)),
+      QuadF(PointF(1, 1), PointF(1, 1), PointF(1, 1), PointF(1, 1))};
+  for (const QuadF& quad : quads) {
+    SCOPED_TRACE(quad.ToString());
+    // The corners, points just off them, and a grid over the bounds, with a
+    // count that isn't a multiple of four.
+    std::vector<PointF> points;
+    for (const PointF& p : {quad.p1(), quad.p2(), quad.p3(), quad.p4()}) {
+      points.push_back(p);
+      points.push_back(p + Vector2dF(epsilon, 0));
+      points.push_back(p - Vector2dF(0, epsilon));
+    }
+    RectF bounds = quad.BoundingBox();
+    for (int i = -1; i <= 11; ++i) {
+      for (int j = -1; j <= 11; ++j) {
+        points.emplace_back(bounds.x() + bounds.width() * i / 10,
+                            bounds.y() + bounds.height() * j / 10);
+      }
+    }
+    points.emplace_back(std::numeric_limits<float>::quiet_NaN(), 0);
+
+    std::array<bool, 182> contains;
+    ASSERT_EQ(contains.size(), points.size());
+    quad.ContainsMany(points, contains);
+    for (size_t i = 0; i < points.size(); ++i) {
+      EXPECT_EQ(quad.Contains(points[i]), contains[i]) << points[i].ToString();
+    }
+  }
+}
+
 TEST(QuadFTest, ContainsQuad) {
   QuadF quad(PointF(10, 0), PointF(20, 10), PointF(10, 20), PointF(0, 10));
   EXPECT_TRUE(quad.ContainsQuad(quad));
@@ -370,6 +409,76 @@ TEST(QuadFTest, ContainsQuad) {
   EXPECT_FALSE(quad.ContainsQuad(quad - gfx::Vector2dF(0, 0.1)));
 }
 
+TEST(QuadFTest, ContainsQuadNotConvex) {
+  // A concave dart and a bowtie, which contain the small square in their
+  // triangles, but aren't convex.
+  QuadF square(RectF(9, 9, 1, 1));
+  EXPECT_FALSE(QuadF(PointF(0, 0), PointF(20, 10), PointF(0, 20),
+                     PointF(5, 10))
+                   .ContainsQuad(square));
+  EXPECT_FALSE(QuadF(PointF(0, 0), PointF(20, 20), PointF(20, 0),
+                     PointF(0, 20))
+                   .ContainsQuad(square));
+}
+
+TEST(QuadFTest, IsConvex) {
+  EXPECT_TRUE(QuadF().IsConvex());
+  EXPECT_TRUE(QuadF(RectF(1, 2, 3, 4)).IsConvex());
+  // Clockwise and counter-clockwise diamonds.
+  EXPECT_TRUE(
+      QuadF(PointF(10, 0), PointF(20, 10), PointF(10, 20), PointF(0, 10))
+          .IsConvex());
+  EXPECT_TRUE(
+      QuadF(PointF(10, 0), PointF(0, 10), PointF(10, 20), PointF(20, 10))
+          .IsConvex());
+  // A triangle, with a point in the middle of one side.
+  EXPECT_TRUE(QuadF(PointF(0, 0), PointF(10, 0), PointF(20, 0), PointF(0, 20))
+                  .IsConvex());
+  // Collinear.
+  EXPECT_TRUE(QuadF(PointF(0, 0), PointF(1, 1), PointF(2, 2), PointF(3, 3))
+                  .IsConvex());
+  // Concave.
+  EXPECT_FALSE(QuadF(PointF(0, 0), PointF(20, 10), PointF(0, 20), PointF(5, 10))
+                   .IsConvex());
+  // Self-intersecting.
+  EXPECT_FALSE(QuadF(PointF(0, 0), PointF(20, 20), PointF(20, 0), PointF(0, 20))
+                   .IsConvex());
+}
+
+TEST(QuadFTest, IntersectsQuad) {
+  QuadF diamond(PointF(10, 0), PointF(20, 10), PointF(10, 20), PointF(0, 10));
+  QuadF reversed_diamond(PointF(10, 0), PointF(0, 10), PointF(10, 20),
+                         PointF(20, 10));
+  for (const QuadF& quad : {diamond, reversed_diamond}) {
+    SCOPED_TRACE(quad.ToString());
+    EXPECT_TRUE(quad.IntersectsQuad(quad));
+    EXPECT_TRUE(quad.IntersectsQuad(QuadF(RectF(9, 9, 2, 2))));
+    EXPECT_TRUE(quad.IntersectsQuad(QuadF(RectF(-5, -5, 30, 30))));
+    // The bounding boxes overlap in the corners, but the quads don't.
+    EXPECT_FALSE(quad.IntersectsQuad(QuadF(RectF(0, 0, 4.9, 4.9))));
+    EXPECT_FALSE(QuadF(RectF(15.1, 15.1, 5, 5)).IntersectsQuad(quad));
+    EXPECT_FALSE(quad.IntersectsQuad(quad + Vector2dF(10.1, 10.1)));
+    // Edge-inclusive.
+    EXPECT_TRUE(quad.IntersectsQuad(QuadF(RectF(0, 0, 5, 5))));
+    EXPECT_TRUE(quad.IntersectsQuad(quad + Vector2dF(10, 10)));
+    EXPECT_TRUE(quad.IntersectsQuad(quad + Vector2dF(20, 0)));
+    EXPECT_FALSE(quad.IntersectsQuad(quad + Vector2dF(20.1, 0)));
+  }
+
+  // The concave dart doesn't reach into its notch, but only the sides of a
+  // convex quad and the bounding box of the dart can be separating axes.
+  QuadF dart(PointF(0, 0), PointF(20, 10), PointF(0, 20), PointF(5, 10));
+  QuadF notch(RectF(1, 9, 2, 2));
+  EXPECT_TRUE(dart.IntersectsQuad(notch));
+  EXPECT_TRUE(notch.IntersectsQuad(dart));
+  EXPECT_FALSE(dart.IntersectsQuad(QuadF(RectF(21, 9, 2, 2))));
+  // Only a side of the dart separates it from this square, so they
+  // conservatively intersect.
+  EXPECT_TRUE(QuadF(RectF(15, 0, 5, 5)).IntersectsQuad(dart));
+  EXPECT_TRUE(dart.IntersectsQuad(dart + Vector2dF(5, 5)));
+  EXPECT_FALSE(dart.IntersectsQuad(dart + Vector2dF(20.1, 0)));
+}
+
 TEST(QuadFTest, Scale) {
   PointF a(1.3f, 1.4f);
   PointF b(-0.8f, 4.4f);
@@ -676,6 +785,54 @@ TEST(FloatQuadTest, QuadIntersection) {
   EXPECT_FALSE(ccw_quad.IntersectsQuad(QuadF(RectF(60, 20, 30, 10))));
 }
 
+TEST(QuadFTest, IntersectsRectMany) {
+  // Tiles rotated and scaled, in both orientations, in a grid around the
+  // viewport, including tiles that only touch it and tiles whose bounding
+  // boxes overlap it but which don't.
+  const RectF viewport(100, 50, 400, 300);
+  std::vector<QuadF> quads;
+  for (float angle : {0.f, 30.f, 45.f, 150.f}) {
+    for (float scale_x : {1.f, -1.f}) {
+      Transform transform;
+      transform.Rotate(angle);
+      transform.Scale(scale_x, 1);
+      for (int i = -2; i < 10; ++i) {
+        for (int j = -2; j < 8; ++j) {
+          quads.push_back(
+              transform.MapQuad(QuadF(RectF(i * 64, j * 64, 64, 64))) +
+              Vector2dF(250, 150));
+        }
+      }
+    }
+  }
+  quads.push_back(QuadF(RectF(500, 50, 10, 10)));
+  quads.push_back(QuadF(RectF(510, 50, 10, 10)));
+  quads.push_back(QuadF());
+
+  std::vector<float> x;
+  std::vector<float> y;
+  for (const QuadF& quad : quads) {
+    for (const PointF& point : {quad.p1(), quad.p2(), quad.p3(), quad.p4()}) {
+      x.push_back(point.x());
+      y.push_back(point.y());
+    }
+  }
+  std::vector<bool> expected;
+  for (const QuadF& quad : quads) {
+    expected.push_back(quad.IntersectsRect(viewport));
+  }
+  EXPECT_NE(std::ranges::count(expected, true), 0);
+  EXPECT_NE(std::ranges::count(expected, false), 0);
+
+  std::array<bool, 1024> intersects;
+  ASSERT_LE(quads.size(), intersects.size());
+  QuadF::IntersectsRectMany(x, y, viewport,
+                            base::span(intersects).first(quads.size()));
+  for (size_t i = 0; i < quads.size(); ++i) {
+    EXPECT_EQ(expected[i], intersects[i]) << quads[i].ToString();
+  }
+}
+
 TEST(QuadFTest, IntersectsEllipseClockWise) {
   QuadF quad(PointF(10, 0), PointF(20, 10), PointF(10, 20), PointF(0, 10));
 
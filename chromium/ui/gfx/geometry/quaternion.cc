@@ -8,7 +8,10 @@
 #include <cmath>
 #include <numbers>
 
+#include "base/check_op.h"
 #include "base/strings/stringprintf.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/vector3d_f.h"
 
 namespace gfx {
@@ -68,39 +71,16 @@ Quaternion Quaternion::FromAxisAngle(double x,
   return Quaternion(scale * x, scale * y, scale * z, std::cos(0.5 * angle));
 }
 
-// Adapted from https://www.euclideanspace.com/maths/algebra/realNormedAlgebra/
-// quaternions/slerp/index.htm
 Quaternion Quaternion::Slerp(const Quaternion& to, double t) const {
-  Quaternion from = *this;
-
-  double cos_half_angle =
-      from.x_ * to.x_ + from.y_ * to.y_ + from.z_ * to.z_ + from.w_ * to.w_;
-  if (cos_half_angle < 0) {
-    // Since the half angle is > 90 degrees, the full rotation angle would
-    // exceed 180 degrees. The quaternions (x, y, z, w) and (-x, -y, -z, -w)
-    // represent the same rotation. Flipping the orientation of either
-    // quaternion ensures that the half angle is less than 90 and that we are
-    // taking the shortest path.
-    from = from.flip();
-    cos_half_angle = -cos_half_angle;
-  }
-
-  // Ensure that acos is well behaved at the boundary.
-  if (cos_half_angle > 1)
-    cos_half_angle = 1;
-
-  double sin_half_angle = std::sqrt(1.0 - cos_half_angle * cos_half_angle);
-  if (sin_half_angle < kEpsilon) {
-    // Quaternions share common axis and angle.
-    return *this;
-  }
-
-  double half_angle = std::acos(cos_half_angle);
-
-  double scaleA = std::sin((1 - t) * half_angle) / sin_half_angle;
-  double scaleB = std::sin(t * half_angle) / sin_half_angle;
+  return QuaternionSlerpPlan(*this, to).Evaluate(t);
+}
 
-  return (scaleA * from) + (scaleB * to);
+// static
+void Quaternion::SlerpMany(const Quaternion& from,
+                           const Quaternion& to,
+                           base::span<const double> t,
+                           base::span<Quaternion> out) {
+  QuaternionSlerpPlan(from, to).EvaluateMany(t, out);
 }
 
 Quaternion Quaternion::Lerp(const Quaternion& q, double t) const {
@@ -129,4 +109,65 @@ std::string Quaternion::ToString() const {
          base::StringPrintf(", θ:%fπ", abs_theta / std::numbers::pi_v<float>);
 }
 
+// Adapted from https://www.euclideanspace.com/maths/algebra/realNormedAlgebra/
+// quaternions/slerp/index.htm
+QuaternionSlerpPlan::QuaternionSlerpPlan(const Quaternion& from,
+                                         const Quaternion& to)
+    : original_from_(from), from_(from), to_(to) {
+  double cos_half_angle = from.x() * to.x() + from.y() * to.y() +
+                          from.z() * to.z() + from.w() * to.w();
+  if (cos_half_angle < 0) {
+    // Since the half angle is > 90 degrees, the full rotation angle would
+    // exceed 180 degrees. The quaternions (x, y, z, w) and (-x, -y, -z, -w)
+    // represent the same rotation. Flipping the orientation of either
+    // quaternion ensures that the half angle is less than 90 and that we are
+    // taking the shortest path.
+    from_ = from.flip();
+    cos_half_angle = -cos_half_angle;
+  }
+
+  // Ensure that acos is well behaved at the boundary.
+  if (cos_half_angle > 1)
+    cos_half_angle = 1;
+
+  sin_half_angle_ = std::sqrt(1.0 - cos_half_angle * cos_half_angle);
+  if (sin_half_angle_ < kEpsilon) {
+    // Quaternions share common axis and angle.
+    same_rotation_ = true;
+    return;
+  }
+
+  half_angle_ = std::acos(cos_half_angle);
+}
+
+Quaternion QuaternionSlerpPlan::Evaluate(double t) const {
+  if (same_rotation_)
+    return original_from_;
+
+  double scaleA = std::sin((1 - t) * half_angle_) / sin_half_angle_;
+  double scaleB = std::sin(t * half_angle_) / sin_half_angle_;
+
+  return (scaleA * from_) + (scaleB * to_);
+}
+
+void QuaternionSlerpPlan::EvaluateMany(base::span<const double> t,
+                                       base::span<Quaternion> out) const {
+  CheckBatchSpans(t, out);
+  if (same_rotation_) {
+    std::ranges::fill(out, original_from_);
+    return;
+  }
+
+  const Double4 from{from_.x(), from_.y(), from_.z(), from_.w()};
+  const Double4 to{to_.x(), to_.y(), to_.z(), to_.w()};
+  for (size_t i = 0; i < t.size(); ++i) {
+    // Same arithmetic as Evaluate(), with the weighted sum of the components
+    // done as one vector operation.
+    double scaleA = std::sin((1 - t[i]) * half_angle_) / sin_half_angle_;
+    double scaleB = std::sin(t[i] * half_angle_) / sin_half_angle_;
+    Double4 q = scaleA * from + scaleB * to;
+    out[i] = Quaternion(q[0], q[1], q[2], q[3]);
+  }
+}
+
 }  // namespace gfx
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 
 namespace gfx {
 
@@ -58,6 +59,14 @@ class COMPONENT_EXPORT(GEOMETRY) Quaternion {
   // and values outside that range will extrapolate beyond in either direction.
   Quaternion Slerp(const Quaternion& q, double t) const;
 
+  // Stores from.Slerp(to, t[i]) in out[i] for each i. |out| must have the same
+  // size as |t|. The data that only depends on |from| and |to|, including the
+  // angle between them, is computed once for all values of |t|.
+  static void SlerpMany(const Quaternion& from,
+                        const Quaternion& to,
+                        base::span<const double> t,
+                        base::span<Quaternion> out);
+
   // Blends with the given quaternion, |q|, via linear interpolation. This is
   // rarely what you want. Use only if you know what you're doing.
   // Values of |t| in the range [0, 1] will interpolate between |this| and |q|,
@@ -98,6 +107,30 @@ inline Quaternion operator/(const Quaternion& q, double s) {
   return q * inv;
 }
 
+// The data of Quaternion::Slerp() that only depends on the endpoints, for
+// callers that interpolate between the same quaternions many times.
+class COMPONENT_EXPORT(GEOMETRY) QuaternionSlerpPlan {
+ public:
+  QuaternionSlerpPlan(const Quaternion& from, const Quaternion& to);
+
+  // Returns from.Slerp(to, t).
+  Quaternion Evaluate(double t) const;
+  // Same as Quaternion::SlerpMany().
+  void EvaluateMany(base::span<const double> t,
+                    base::span<Quaternion> out) const;
+
+ private:
+  // |from| before it's flipped for the shortest path.
+  Quaternion original_from_;
+  Quaternion from_;
+  Quaternion to_;
+  // True if the endpoints share the same axis and angle, in which case
+  // Evaluate() returns |original_from_|.
+  bool same_rotation_ = false;
+  double half_angle_ = 0;
+  double sin_half_angle_ = 0;
+};
+
 // This is declared here for use in gtest-based unit tests but is defined in
 // the //ui/gfx:test_support target. Depend on that to use this in your unit
 // test. This should not be used in production code - call ToString() instead.
@@ -154,6 +154,20 @@ TEST(QuatTest, Slerp) {
   }
 }
 
+TEST(QuatTest, SlerpMany) {
+  const double t[] = {-0.5, 0, 0.1, 0.25, 0.5, 0.75, 1, 1.5};
+  const Quaternion from(Vector3dF(1, 2, 3), 0.5);
+  for (const Quaternion& to :
+       {Quaternion(Vector3dF(-3, 2, 1), 2.5), from, from.flip(),
+        Quaternion(Vector3dF(1, 0, 0), -3)}) {
+    std::array<Quaternion, std::size(t)> out;
+    Quaternion::SlerpMany(from, to, t, out);
+    for (size_t i = 0; i < std::size(t); ++i) {
+      EXPECT_EQ(from.Slerp(to, t[i]), out[i]);
+    }
+  }
+}
+
 TEST(QuatTest, SlerpOppositeAngles) {
   Vector3dF axis(1, 1, 1);
   double start_radians = -std::numbers::pi / 2;
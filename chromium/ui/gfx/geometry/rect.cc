@@ -4,12 +4,16 @@
 
 #include "ui/gfx/geometry/rect.h"
 
+#include <stdint.h>
+
 #include <algorithm>
+#include <limits>
 
 #include "base/check.h"
 #include "base/numerics/clamped_math.h"
 #include "base/strings/stringprintf.h"
 #include "build/build_config.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/insets.h"
 #include "ui/gfx/geometry/outsets.h"
 #include "ui/gfx/geometry/rect_conversions.h"
@@ -76,6 +80,34 @@ void SaturatedClampRange(int min, int max, int* origin, int* span) {
 
 namespace gfx {
 
+namespace {
+
+// Returns the {x, y, width, height} of |rect| with |add| added to and
+// |subtract| subtracted from each component, and then the width and height
+// clamped as Rect::set_width() and Rect::set_height() do, so that right()
+// and bottom() don't overflow.
+ALWAYS_INLINE Int4 AdjustRect4(const Rect& rect, Int4 add, Int4 subtract) {
+  Int4 v = ClampSub4(
+      ClampAdd4(Int4{rect.x(), rect.y(), rect.width(), rect.height()}, add),
+      subtract);
+  Int4 origin = {v[0], v[1], v[0], v[1]};
+  Int4 end = ClampAdd4(origin, Int4{v[2], v[3], v[2], v[3]});
+  Int4 size = end - origin;
+  size = size < 0 ? Int4{} : size;
+  return Int4{v[0], v[1], size[0], size[1]};
+}
+
+// The lanes of AdjustRect4() that Rect::Inset() adds and subtracts.
+ALWAYS_INLINE Int4 InsetOrigin4(const Insets& insets) {
+  return Int4{insets.left(), insets.top(), 0, 0};
+}
+
+ALWAYS_INLINE Int4 InsetSize4(const Insets& insets) {
+  return Int4{0, 0, insets.width(), insets.height()};
+}
+
+}  // namespace
+
 #if BUILDFLAG(IS_WIN)
 
 Rect::Rect(const RECT& r)
@@ -117,16 +149,16 @@ void Rect::AdjustForSaturatedBottom(int bottom) {
 }
 
 void Rect::Inset(const Insets& insets) {
-  origin_ += Vector2d(insets.left(), insets.top());
-  set_width(base::ClampSub(width(), insets.width()));
-  set_height(base::ClampSub(height(), insets.height()));
+  Int4 v = AdjustRect4(*this, InsetOrigin4(insets), InsetSize4(insets));
+  origin_.SetPoint(v[0], v[1]);
+  size_.SetSize(v[2], v[3]);
 }
 
 void Rect::Offset(const Vector2d& distance) {
-  origin_ += distance;
-  // Ensure that width and height remain valid.
-  set_width(width());
-  set_height(height());
+  // Also ensures that width and height remain valid.
+  Int4 v = AdjustRect4(*this, Int4{distance.x(), distance.y(), 0, 0}, Int4{});
+  origin_.SetPoint(v[0], v[1]);
+  size_.SetSize(v[2], v[3]);
 }
 
 Insets Rect::InsetsFrom(const Rect& inner) const {
@@ -349,13 +381,44 @@ Rect UnionRects(const Rect& a, const Rect& b) {
 }
 
 Rect UnionRects(base::span<const Rect> rects) {
-  Rect result;
+  // Reduces {x, y, -right, -bottom} of the non-empty rects with a single
+  // vector min per rect, and only saturates the size at the end. The right
+  // and bottom of a non-empty rect are greater than the minimum int, so they
+  // can be negated.
+  const Rect* first = nullptr;
+  Int4 bounds;
   for (const Rect& rect : rects) {
-    result.Union(rect);
+    if (rect.IsEmpty()) {
+      continue;
+    }
+    Int4 v = {rect.x(), rect.y(), -rect.right(), -rect.bottom()};
+    if (!first) {
+      first = &rect;
+      bounds = v;
+    } else {
+      bounds = v < bounds ? v : bounds;
+    }
   }
+  // As with successive Union() calls, without non-empty rects, the result is
+  // the last rect.
+  if (!first) {
+    return rects.empty() ? Rect() : rects.back();
+  }
+  Rect result;
+  result.SetByBounds(bounds[0], bounds[1], -bounds[2], -bounds[3]);
   return result;
 }
 
+void InsetRects(base::span<Rect> rects, const Insets& insets) {
+  const Int4 add = InsetOrigin4(insets);
+  const Int4 subtract = InsetSize4(insets);
+  for (Rect& rect : rects) {
+    // The origin and size are already clamped, which SetRect() keeps.
+    const Int4 v = AdjustRect4(rect, add, subtract);
+    rect.SetRect(v[0], v[1], v[2], v[3]);
+  }
+}
+
 Rect UnionRectsEvenIfEmpty(const Rect& a, const Rect& b) {
   Rect result = a;
   result.UnionEvenIfEmpty(b);
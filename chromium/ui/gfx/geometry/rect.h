@@ -295,6 +295,11 @@ COMPONENT_EXPORT(GEOMETRY)
 Rect UnionRectsEvenIfEmpty(const Rect& a, const Rect& b);
 COMPONENT_EXPORT(GEOMETRY) Rect SubtractRects(const Rect& a, const Rect& b);
 
+// Calls rects[i].Inset(insets) for each rect, e.g. to apply margins to a list
+// of rects, with the insets in Int4 lanes once for all the rects.
+COMPONENT_EXPORT(GEOMETRY)
+void InsetRects(base::span<Rect> rects, const Insets& insets);
+
 // Constructs a rectangle with |p1| and |p2| as opposite corners.
 //
 // This could also be thought of as "the smallest rect that contains both
@@ -6,9 +6,13 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include "base/check.h"
+#include "base/check_op.h"
 #include "base/numerics/safe_conversions.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/rect.h"
 #include "ui/gfx/geometry/rect_f.h"
 
@@ -26,6 +30,95 @@ int CeilIgnoringError(float f, float error) {
   return std::abs(rounded - f) < error ? rounded : base::ClampCeil(f);
 }
 
+// The float bounds of the values that convert to int without saturating:
+// -2^31, and the largest float below 2^31.
+constexpr float kMinIntFloat = -2147483648.f;
+constexpr float kMaxIntFloat = 2147483520.f;
+
+// Returns the components of |v| clamped to the range of int, with NaN as 0,
+// so that they can be converted to int.
+ALWAYS_INLINE Float4 ClampToIntRange(Float4 v) {
+  v = v == v ? v : Float4{};
+  v = v < kMinIntFloat ? Float4{} + kMinIntFloat : v;
+  return v > kMaxIntFloat ? Float4{} + kMaxIntFloat : v;
+}
+
+// Returns |i| with the components of |v| at least 2^31 saturated to the max
+// int, which ClampToIntRange() clamps below it.
+ALWAYS_INLINE Int4 SaturateOverflow(Float4 v, Int4 i) {
+  return v > kMaxIntFloat ? Int4{} + std::numeric_limits<int>::max() : i;
+}
+
+// Vectorized base::ClampFloor(), base::ClampCeil() and base::ClampRound().
+// The conversion of the clamped components truncates them, and the masks of
+// the comparisons, -1 where true, step the results to the right integers.
+ALWAYS_INLINE Int4 ClampFloor4(Float4 v) {
+  Float4 clamped = ClampToIntRange(v);
+  Int4 truncated = __builtin_convertvector(clamped, Int4);
+  Int4 floored =
+      truncated + (__builtin_convertvector(truncated, Float4) > clamped);
+  return SaturateOverflow(v, floored);
+}
+
+ALWAYS_INLINE Int4 ClampCeil4(Float4 v) {
+  Float4 clamped = ClampToIntRange(v);
+  Int4 truncated = __builtin_convertvector(clamped, Int4);
+  Int4 ceiled =
+      truncated - (__builtin_convertvector(truncated, Float4) < clamped);
+  return SaturateOverflow(v, ceiled);
+}
+
+ALWAYS_INLINE Int4 ClampRound4(Float4 v) {
+  Float4 clamped = ClampToIntRange(v);
+  Int4 truncated = __builtin_convertvector(clamped, Int4);
+  // Exact, since the truncation has no more significant bits than |clamped|.
+  Float4 fraction = clamped - __builtin_convertvector(truncated, Float4);
+  Int4 rounded = truncated - (fraction >= 0.5f) + (fraction <= -0.5f);
+  return SaturateOverflow(v, rounded);
+}
+
+// Returns the mask of the components of |v| within |error| of |rounded|, as
+// in FloorIgnoringError() and CeilIgnoringError().
+ALWAYS_INLINE FloatBoolean4 IsNear4(Float4 v, Int4 rounded, float error) {
+  Float4 difference = __builtin_convertvector(rounded, Float4) - v;
+  difference = difference < 0 ? -difference : difference;
+  return difference < error;
+}
+
+// Returns the components {x, y, right, bottom} of |rect|.
+ALWAYS_INLINE Float4 Edges4(const RectF& rect) {
+  return Float4{rect.x(), rect.y(), rect.right(), rect.bottom()};
+}
+
+// Sets |result| from the edges {left, top, right, bottom} in |edges|, where
+// the right and bottom edges are replaced by the left and top ones if |rect|
+// has no width or height, as ToEnclosingRect() does.
+ALWAYS_INLINE void SetByEdges(const RectF& rect, Int4 edges, Rect& result) {
+  result.SetByBounds(edges[0], edges[1], rect.width() ? edges[2] : edges[0],
+                     rect.height() ? edges[3] : edges[1]);
+}
+
+// Converts each of |rects| with |convert|, which returns the edges of the
+// result for the edges of a rect.
+template <typename Convert>
+ALWAYS_INLINE void ConvertRects(base::span<const RectF> rects,
+                                base::span<Rect> results,
+                                bool keep_empty_edges,
+                                Convert convert) {
+  CheckBatchSpans(rects, results);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    Int4 edges = convert(Edges4(rects[i]));
+    if (keep_empty_edges) {
+      SetByEdges(rects[i], edges, results[i]);
+    } else {
+      results[i].SetByBounds(edges[0], edges[1], edges[2], edges[3]);
+    }
+  }
+}
+
+// The lanes of the left and top edges, which round down when enclosing.
+const FloatBoolean4 kLeftTopLanes = {-1, -1, 0, 0};
+
 }  // anonymous namespace
 
 Rect ToEnclosingRect(const RectF& r) {
@@ -125,4 +218,50 @@ Rect ToFlooredRectDeprecated(const RectF& rect) {
               base::ClampFloor(rect.width()), base::ClampFloor(rect.height()));
 }
 
+void ToEnclosingRects(base::span<const RectF> rects,
+                      base::span<Rect> results) {
+  ConvertRects(rects, results, /*keep_empty_edges=*/true, [](Float4 v) {
+    return kLeftTopLanes ? ClampFloor4(v) : ClampCeil4(v);
+  });
+}
+
+void ToEnclosingRectsIgnoringError(base::span<const RectF> rects,
+                                   base::span<Rect> results,
+                                   float error) {
+  ConvertRects(rects, results, /*keep_empty_edges=*/true, [error](Float4 v) {
+    Int4 rounded = ClampRound4(v);
+    Int4 enclosing = kLeftTopLanes ? ClampFloor4(v) : ClampCeil4(v);
+    return IsNear4(v, rounded, error) ? rounded : enclosing;
+  });
+}
+
+void ToEnclosedRects(base::span<const RectF> rects, base::span<Rect> results) {
+  ConvertRects(rects, results, /*keep_empty_edges=*/false, [](Float4 v) {
+    return kLeftTopLanes ? ClampCeil4(v) : ClampFloor4(v);
+  });
+}
+
+void ToEnclosedRectsIgnoringError(base::span<const RectF> rects,
+                                  base::span<Rect> results,
+                                  float error) {
+  ConvertRects(rects, results, /*keep_empty_edges=*/true, [error](Float4 v) {
+    Int4 rounded = ClampRound4(v);
+    Int4 enclosed = kLeftTopLanes ? ClampCeil4(v) : ClampFloor4(v);
+    return IsNear4(v, rounded, error) ? rounded : enclosed;
+  });
+}
+
+void ToNearestRects(base::span<const RectF> rects, base::span<Rect> results) {
+  ConvertRects(rects, results, /*keep_empty_edges=*/false, [](Float4 v) {
+    Int4 rounded = ClampRound4(v);
+    // See ToNearestRect().
+    DCHECK(AllTrue(IsNear4(v, rounded, 0.01f)));
+    return rounded;
+  });
+}
+
+void ToRoundedRects(base::span<const RectF> rects, base::span<Rect> results) {
+  ConvertRects(rects, results, /*keep_empty_edges=*/false, ClampRound4);
+}
+
 }  // namespace gfx
@@ -6,6 +6,7 @@
 #define UI_GFX_GEOMETRY_RECT_CONVERSIONS_H_
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 
 namespace gfx {
 
@@ -57,6 +58,27 @@ COMPONENT_EXPORT(GEOMETRY) gfx::Rect ToRoundedRect(const gfx::RectF& rect);
 // Please prefer the previous two functions in new code.
 COMPONENT_EXPORT(GEOMETRY) Rect ToFlooredRectDeprecated(const RectF& rect);
 
+// Batch versions of the functions above, which convert each of |rects| into
+// the element of |results| at the same index, with the same results. The
+// components of each rect are rounded and saturated as a vector. |results|
+// must be the same size as |rects|.
+COMPONENT_EXPORT(GEOMETRY)
+void ToEnclosingRects(base::span<const RectF> rects, base::span<Rect> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToEnclosingRectsIgnoringError(base::span<const RectF> rects,
+                                   base::span<Rect> results,
+                                   float error = 0.001f);
+COMPONENT_EXPORT(GEOMETRY)
+void ToEnclosedRects(base::span<const RectF> rects, base::span<Rect> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToEnclosedRectsIgnoringError(base::span<const RectF> rects,
+                                  base::span<Rect> results,
+                                  float error);
+COMPONENT_EXPORT(GEOMETRY)
+void ToNearestRects(base::span<const RectF> rects, base::span<Rect> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToRoundedRects(base::span<const RectF> rects, base::span<Rect> results);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_RECT_CONVERSIONS_H_
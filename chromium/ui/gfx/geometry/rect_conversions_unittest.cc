@@ -5,6 +5,7 @@
 #include "ui/gfx/geometry/rect_conversions.h"
 
 #include <limits>
+#include <vector>
 
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/rect.h"
@@ -160,4 +161,64 @@ TEST(RectConversionsTest, ToFlooredRect) {
             ToFlooredRectDeprecated(RectF(20000.5f, 20000.5f, 0.5f, 0.5f)));
 }
 
+TEST(RectConversionsTest, BatchConversions) {
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  const float kInfinity = std::numeric_limits<float>::infinity();
+  const float values[] = {0.f, -0.f, 0.5f, -0.5f, 0.49999997f, -0.49999997f,
+                          // Near integers, within the default error or not.
+                          1.5f, -2.5f, 0.0009f, 1.0009f, -2.0001f, 123.999f,
+                          // Where floats stop having fractions.
+                          8388607.5f, 16777216.f,
+                          // Out of the range of int, or at its bounds.
+                          1e10f, -1e10f, kMaxIntF, kMinIntF, 2147483520.f,
+                          kMaxFloat, -kMaxFloat, kInfinity, -kInfinity, kNaN};
+  constexpr size_t kNumValues = std::size(values);
+  std::vector<RectF> rects;
+  for (size_t i = 0; i < kNumValues; ++i) {
+    for (size_t j = 0; j < kNumValues; ++j) {
+      rects.emplace_back(values[i], values[j], values[(i + j) % kNumValues],
+                         values[(i * 7 + j) % kNumValues]);
+    }
+  }
+  std::vector<Rect> results(rects.size());
+
+  ToEnclosingRects(rects, results);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    SCOPED_TRACE(rects[i].ToString());
+    EXPECT_EQ(ToEnclosingRect(rects[i]), results[i]);
+  }
+  ToEnclosingRectsIgnoringError(rects, results);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    SCOPED_TRACE(rects[i].ToString());
+    EXPECT_EQ(ToEnclosingRectIgnoringError(rects[i]), results[i]);
+  }
+  ToEnclosedRects(rects, results);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    SCOPED_TRACE(rects[i].ToString());
+    EXPECT_EQ(ToEnclosedRect(rects[i]), results[i]);
+  }
+  ToEnclosedRectsIgnoringError(rects, results, 0.01f);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    SCOPED_TRACE(rects[i].ToString());
+    EXPECT_EQ(ToEnclosedRectIgnoringError(rects[i], 0.01f), results[i]);
+  }
+  ToRoundedRects(rects, results);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    SCOPED_TRACE(rects[i].ToString());
+    EXPECT_EQ(ToRoundedRect(rects[i]), results[i]);
+  }
+
+  // ToNearestRect() only accepts integer rects with floating point error.
+  std::vector<RectF> integer_rects = {
+      RectF(), RectF(-1, -1, 3, 3),
+      RectF(-1.00001f, -0.999999f, 3.0000001f, 2.999999f),
+      RectF(kMinIntF, kMinIntF, 0, 0), RectF(0, 0, kMaxIntF, kMaxIntF)};
+  std::vector<Rect> nearest_results(integer_rects.size());
+  ToNearestRects(integer_rects, nearest_results);
+  for (size_t i = 0; i < integer_rects.size(); ++i) {
+    SCOPED_TRACE(integer_rects[i].ToString());
+    EXPECT_EQ(ToNearestRect(integer_rects[i]), nearest_results[i]);
+  }
+}
+
 }  // namespace gfx
@@ -12,6 +12,8 @@
 #include "base/numerics/safe_conversions.h"
 #include "base/strings/stringprintf.h"
 #include "build/build_config.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/insets_f.h"
 #include "ui/gfx/geometry/outsets_f.h"
 
@@ -23,6 +25,36 @@
 
 namespace gfx {
 
+// Returns the lanes added to {x, y, width, height} by RectF::Inset().
+static ALWAYS_INLINE Float4 InsetLanes(const InsetsF& insets) {
+  return Float4{insets.left(), insets.top(), -insets.width(),
+                -insets.height()};
+}
+
+// Sets |rect| to the rect from (x, y) to (right, bottom). Due to floating
+// errors and SizeF::clamp(), that rect may not reach |right| and |bottom|;
+// it's expanded in that case.
+static void SetByBoundsContaining(RectF& rect,
+                                  float x,
+                                  float y,
+                                  float right,
+                                  float bottom) {
+  rect.SetRect(x, y, right - x, bottom - y);
+  constexpr auto kFloatMax = std::numeric_limits<float>::max();
+  if (rect.right() < right && rect.width() < kFloatMax) [[unlikely]] {
+    SizeF size = rect.size();
+    size.SetToNextWidth();
+    rect.set_size(size);
+    DCHECK_GE(rect.right(), right);
+  }
+  if (rect.bottom() < bottom && rect.height() < kFloatMax) [[unlikely]] {
+    SizeF size = rect.size();
+    size.SetToNextHeight();
+    rect.set_size(size);
+    DCHECK_GE(rect.bottom(), bottom);
+  }
+}
+
 static void AdjustAlongAxis(float dst_origin,
                             float dst_size,
                             float* origin,
@@ -45,9 +77,9 @@ CGRect RectF::ToCGRect() const {
 #endif
 
 void RectF::Inset(const InsetsF& insets) {
-  origin_ += Vector2dF(insets.left(), insets.top());
-  set_width(width() - insets.width());
-  set_height(height() - insets.height());
+  const Float4 v = Float4{x(), y(), width(), height()} + InsetLanes(insets);
+  // SetRect() clamps the size as set_width() and set_height().
+  SetRect(v[0], v[1], v[2], v[3]);
 }
 
 void RectF::Offset(float horizontal, float vertical) {
@@ -143,25 +175,9 @@ void RectF::Union(const RectF& rect) {
 }
 
 void RectF::UnionEvenIfEmpty(const RectF& rect) {
-  float rx = std::min(x(), rect.x());
-  float ry = std::min(y(), rect.y());
-  float rr = std::max(right(), rect.right());
-  float rb = std::max(bottom(), rect.bottom());
-
-  SetRect(rx, ry, rr - rx, rb - ry);
-
-  // Due to floating errors and SizeF::clamp(), the new rect may not fully
-  // contain the original rects at the right/bottom side. Expand the rect in
-  // the case.
-  constexpr auto kFloatMax = std::numeric_limits<float>::max();
-  if (right() < rr && width() < kFloatMax) [[unlikely]] {
-    size_.SetToNextWidth();
-    DCHECK_GE(right(), rr);
-  }
-  if (bottom() < rb && height() < kFloatMax) [[unlikely]] {
-    size_.SetToNextHeight();
-    DCHECK_GE(bottom(), rb);
-  }
+  SetByBoundsContaining(*this, std::min(x(), rect.x()), std::min(y(), rect.y()),
+                        std::max(right(), rect.right()),
+                        std::max(bottom(), rect.bottom()));
 }
 
 void RectF::Subtract(const RectF& rect) {
@@ -286,13 +302,129 @@ RectF UnionRects(const RectF& a, const RectF& b) {
 }
 
 RectF UnionRects(base::span<const RectF> rects) {
-  RectF result;
+  // Reduces {x, y, -right, -bottom} of the non-empty rects with a single
+  // vector min per rect, and only computes the result rect at the end.
+  const RectF* first = nullptr;
+  Float4 bounds;
   for (const RectF& rect : rects) {
-    result.Union(rect);
+    if (rect.IsEmpty()) {
+      continue;
+    }
+    Float4 v = {rect.x(), rect.y(), -rect.right(), -rect.bottom()};
+    if (!first) {
+      first = &rect;
+      bounds = v;
+    } else {
+      bounds = v < bounds ? v : bounds;
+    }
   }
+  // As with successive Union() calls, a single non-empty rect is the result
+  // as is, and without any, the result is the last rect.
+  if (!first) {
+    return rects.empty() ? RectF() : rects.back();
+  }
+  if (bounds[0] == first->x() && bounds[1] == first->y() &&
+      bounds[2] == -first->right() && bounds[3] == -first->bottom()) {
+    return *first;
+  }
+  RectF result;
+  SetByBoundsContaining(result, bounds[0], bounds[1], -bounds[2], -bounds[3]);
   return result;
 }
 
+namespace {
+
+// The components of 4 rects, in the lanes of vectors.
+struct RectF4 {
+  explicit RectF4(base::span<const RectF, 4> rects)
+      : x{rects[0].x(), rects[1].x(), rects[2].x(), rects[3].x()},
+        y{rects[0].y(), rects[1].y(), rects[2].y(), rects[3].y()},
+        width{rects[0].width(), rects[1].width(), rects[2].width(),
+              rects[3].width()},
+        height{rects[0].height(), rects[1].height(), rects[2].height(),
+               rects[3].height()} {}
+
+  // The same as RectF::IsEmpty() for each rect. Sizes are clamped to be
+  // non-negative and not NaN.
+  FloatBoolean4 IsNotEmpty() const { return (width != 0) & (height != 0); }
+
+  Float4 x;
+  Float4 y;
+  Float4 width;
+  Float4 height;
+};
+
+}  // namespace
+
+void IntersectsMany(const RectF& clip,
+                    base::span<const RectF> rects,
+                    base::span<bool> intersects) {
+  CheckBatchSpans(rects, intersects);
+  if (clip.IsEmpty()) {
+    std::ranges::fill(intersects, false);
+    return;
+  }
+
+  size_t i = 0;
+  for (; i + 4 <= rects.size(); i += 4) {
+    RectF4 r(rects.subspan(i).first<4>());
+    // The same comparisons as RectF::Intersects().
+    FloatBoolean4 result = r.IsNotEmpty() & (r.x < clip.right()) &
+                           (r.x + r.width > clip.x()) &
+                           (r.y < clip.bottom()) &
+                           (r.y + r.height > clip.y());
+    for (size_t j = 0; j < 4; ++j) {
+      intersects[i + j] = result[j];
+    }
+  }
+  for (; i < rects.size(); ++i) {
+    intersects[i] = clip.Intersects(rects[i]);
+  }
+}
+
+void IntersectMany(const RectF& clip, base::span<RectF> rects) {
+  if (clip.IsEmpty()) {
+    std::ranges::fill(rects, RectF());
+    return;
+  }
+
+  const Float4 clip_x = Float4{} + clip.x();
+  const Float4 clip_y = Float4{} + clip.y();
+  const Float4 clip_right = Float4{} + clip.right();
+  const Float4 clip_bottom = Float4{} + clip.bottom();
+  size_t i = 0;
+  for (; i + 4 <= rects.size(); i += 4) {
+    RectF4 r(base::span<const RectF>(rects).subspan(i).first<4>());
+    // The same std::max() and std::min() as RectF::Intersect().
+    Float4 right = r.x + r.width;
+    Float4 bottom = r.y + r.height;
+    Float4 rx = r.x < clip_x ? clip_x : r.x;
+    Float4 ry = r.y < clip_y ? clip_y : r.y;
+    Float4 rr = clip_right < right ? clip_right : right;
+    Float4 rb = clip_bottom < bottom ? clip_bottom : bottom;
+    FloatBoolean4 empty = ~r.IsNotEmpty() | (rx >= rr) | (ry >= rb);
+    for (size_t j = 0; j < 4; ++j) {
+      if (!empty[j]) {
+        rects[i + j].SetRect(rx[j], ry[j], rr[j] - rx[j], rb[j] - ry[j]);
+      } else {
+        rects[i + j].SetRect(0, 0, 0, 0);
+      }
+    }
+  }
+  for (; i < rects.size(); ++i) {
+    rects[i].Intersect(clip);
+  }
+}
+
+void InsetRects(base::span<RectF> rects, const InsetsF& insets) {
+  const Float4 lanes = InsetLanes(insets);
+  for (RectF& rect : rects) {
+    const Float4 v =
+        Float4{rect.x(), rect.y(), rect.width(), rect.height()} + lanes;
+    rect.SetRect(v[0], v[1], v[2], v[3]);
+  }
+}
+
 RectF UnionRectsEvenIfEmpty(const RectF& a, const RectF& b) {
   RectF result = a;
   result.UnionEvenIfEmpty(b);
@@ -273,6 +273,22 @@ COMPONENT_EXPORT(GEOMETRY)
 RectF UnionRectsEvenIfEmpty(const RectF& a, const RectF& b);
 COMPONENT_EXPORT(GEOMETRY) RectF SubtractRects(const RectF& a, const RectF& b);
 
+// Calls rects[i].Inset(insets) for each rect, e.g. to apply margins to a list
+// of rects, with the insets in Float4 lanes once for all the rects.
+COMPONENT_EXPORT(GEOMETRY)
+void InsetRects(base::span<RectF> rects, const InsetsF& insets);
+
+// Sets each intersects[i] to clip.Intersects(rects[i]), comparing several
+// rects at once with vector instructions. Both spans must have the same size.
+COMPONENT_EXPORT(GEOMETRY)
+void IntersectsMany(const RectF& clip,
+                    base::span<const RectF> rects,
+                    base::span<bool> intersects);
+// Calls rects[i].Intersect(clip) for each rect, with vector instructions,
+// and with the same results.
+COMPONENT_EXPORT(GEOMETRY)
+void IntersectMany(const RectF& clip, base::span<RectF> rects);
+
 inline RectF ScaleRect(const RectF& r, float x_scale, float y_scale) {
   return RectF(r.x() * x_scale, r.y() * y_scale,
        r.width() * x_scale, r.height() * y_scale);
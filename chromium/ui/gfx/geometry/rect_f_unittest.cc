@@ -4,7 +4,9 @@
 
 #include "ui/gfx/geometry/rect_f.h"
 
+#include <array>
 #include <cmath>
+#include <vector>
 
 #include "ui/gfx/geometry/insets_f.h"
 #include "ui/gfx/geometry/rect_f.h"
@@ -160,6 +162,83 @@ TEST(RectFTest, Union) {
       UnionRects(RectF(2.2f, 3.3f, 4.4f, 5.5f), RectF(8.8f, 9.9f, 2.2f, 0)));
 }
 
+TEST(RectFTest, UnionSpan) {
+  EXPECT_RECTF_EQ(RectF(), UnionRects(base::span<const RectF>()));
+  // Without non-empty rects, the result is the last rect, as with Union().
+  EXPECT_RECTF_EQ(RectF(8.5f, 9, 0, 2),
+                  UnionRects(std::vector<RectF>{RectF(1, 2, 3, 0),
+                                                RectF(8.5f, 9, 0, 2)}));
+  EXPECT_RECTF_EQ(RectF(1.1f, 2.2f, 3.3f, 4.4f),
+                  UnionRects(std::vector<RectF>{RectF(1.1f, 2.2f, 3.3f, 4.4f),
+                                                RectF(2, 3, 0, 1)}));
+
+  // Values that are exact in floats, so that the result is the same as with
+  // successive Union() calls.
+  const std::vector<RectF> rects = {
+      RectF(8, 9, 0, 2),       RectF(3.5f, 4, 5, 6.25f), RectF(-5, 7, 2, 1),
+      RectF(2, 3.75f, 4, 5),   RectF(100, 100, 0, 0),    RectF(0, -20, 1, 30),
+      RectF(8, 9, 20.5f, 0),   RectF(1, 1, 1, 1)};
+  for (size_t size = 0; size <= rects.size(); ++size) {
+    auto span = base::span(rects).first(size);
+    RectF expected;
+    for (const RectF& rect : span) {
+      expected.Union(rect);
+    }
+    SCOPED_TRACE(size);
+    EXPECT_RECTF_EQ(expected, UnionRects(span));
+  }
+
+  // Otherwise the result still contains all the rects.
+  const std::vector<RectF> inexact = {RectF(1.1f, 2.2f, 3.3f, 4.4f),
+                                      RectF(1e8f, 0.1f, 1.7f, 0.3f),
+                                      RectF(-0.3f, 5.5f, 0.7f, 1e-3f)};
+  RectF result = UnionRects(inexact);
+  for (const RectF& rect : inexact) {
+    EXPECT_TRUE(result.Contains(rect)) << rect.ToString();
+  }
+}
+
+TEST(RectFTest, IntersectMany) {
+  const RectF clip(10, 20, 30.5f, 40.25f);
+  // Rects touching the clip, empty, overlapping, containing and inside it.
+  std::vector<RectF> rects = {RectF(0, 0, 10, 20),
+                              RectF(0, 0, 11, 21),
+                              RectF(15, 25, 0, 10),
+                              RectF(15, 25, 5, 5),
+                              RectF(40.5f, 20, 1, 1),
+                              RectF(39, 59, 10, 10),
+                              RectF(-100, -100, 1e3f, 1e3f),
+                              RectF(10, 60.25f, 5, 5),
+                              RectF(12.3f, 45.6f, 7.8f, 9.1f),
+                              RectF(1e8f, 20, 1, 1)};
+
+  std::vector<bool> expected_intersects;
+  std::vector<RectF> expected_rects;
+  for (const RectF& rect : rects) {
+    expected_intersects.push_back(clip.Intersects(rect));
+    RectF expected = rect;
+    expected.Intersect(clip);
+    expected_rects.push_back(expected);
+  }
+
+  std::array<bool, 10> intersects;
+  ASSERT_EQ(intersects.size(), rects.size());
+  IntersectsMany(clip, rects, intersects);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    EXPECT_EQ(expected_intersects[i], intersects[i]) << rects[i].ToString();
+  }
+  IntersectMany(clip, rects);
+  EXPECT_EQ(expected_rects, rects);
+
+  // An empty clip intersects nothing.
+  IntersectsMany(RectF(10, 20, 0, 5), rects, intersects);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    EXPECT_FALSE(intersects[i]);
+  }
+  IntersectMany(RectF(10, 20, 0, 5), rects);
+  EXPECT_EQ(std::vector<RectF>(rects.size()), rects);
+}
+
 TEST(RectFTest, UnionEvenIfEmpty) {
   EXPECT_RECTF_EQ(RectF(), UnionRectsEvenIfEmpty(RectF(), RectF()));
   EXPECT_RECTF_EQ(RectF(0, 0, 3.3f, 4.4f),
@@ -447,6 +526,26 @@ TEST(RectFTest, InsetClamped) {
   EXPECT_RECTF_EQ(RectF(10, 20, 60, 80), r);
 }
 
+TEST(RectFTest, InsetRects) {
+  std::vector<RectF> rects = {RectF(10, 20, 30, 40), RectF(),
+                              RectF(-1e30f, 0.5f, 2e30f, 1e-3f),
+                              RectF(1.25f, -7, 0.5f, 0.75f)};
+  for (const InsetsF& insets :
+       {InsetsF(0.25f), InsetsF::TLBR(30, 20, 50, 40), InsetsF(-1e20f),
+        InsetsF::TLBR(-1, 0.3f, 0.001f, 2)}) {
+    std::vector<RectF> inset = rects;
+    InsetRects(inset, insets);
+    for (size_t i = 0; i < rects.size(); ++i) {
+      // One side at a time.
+      RectF expected = rects[i];
+      expected.Offset(insets.left(), insets.top());
+      expected.set_width(expected.width() - insets.width());
+      expected.set_height(expected.height() - insets.height());
+      EXPECT_EQ(expected, inset[i]) << insets.ToString() << " " << i;
+    }
+  }
+}
+
 TEST(RectFTest, InclusiveIntersect) {
   RectF rect(11, 12, 0, 0);
   EXPECT_TRUE(rect.InclusiveIntersect(RectF(11, 12, 13, 14)));
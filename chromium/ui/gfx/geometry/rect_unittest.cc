@@ -6,13 +6,17 @@
 
 #include <stddef.h>
 
+#include <algorithm>
 #include <array>
 #include <limits>
+#include <vector>
 
+#include "base/numerics/clamped_math.h"
 #include "build/build_config.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/insets.h"
 #include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/test/geometry_edge_cases.h"
 #include "ui/gfx/geometry/test/geometry_util.h"
 
 #if BUILDFLAG(IS_WIN)
@@ -152,6 +156,28 @@ TEST(RectTest, Union) {
   EXPECT_EQ(Rect(2, 3, 4, 5), UnionRects(Rect(2, 3, 4, 5), Rect(8, 9, 2, 0)));
 }
 
+TEST(RectTest, UnionSpan) {
+  EXPECT_EQ(Rect(), UnionRects(base::span<const Rect>()));
+  // Without non-empty rects, the result is the last rect, as with Union().
+  EXPECT_EQ(Rect(8, 9, 0, 2),
+            UnionRects(std::vector<Rect>{Rect(1, 2, 3, 0), Rect(8, 9, 0, 2)}));
+
+  const std::vector<Rect> rects = {
+      Rect(8, 9, 0, 2),  Rect(3, 4, 5, 6),      Rect(-5, 7, 2, 1),
+      Rect(2, 3, 4, 5),  Rect(100, 100, 0, 0),  Rect(0, -20, 1, 30),
+      Rect(8, 9, 20, 0), Rect(kMaxInt - 5, 0, 10, 10)};
+  for (size_t size = 0; size <= rects.size(); ++size) {
+    auto span = base::span(rects).first(size);
+    Rect expected;
+    for (const Rect& rect : span) {
+      expected.Union(rect);
+    }
+    EXPECT_EQ(expected, UnionRects(span)) << size;
+  }
+  // The width saturates at the end.
+  EXPECT_EQ(Rect(-5, -20, kMaxInt, 30), UnionRects(rects));
+}
+
 TEST(RectTest, UnionEvenIfEmpty) {
   EXPECT_EQ(Rect(), UnionRectsEvenIfEmpty(Rect(), Rect()));
   EXPECT_EQ(Rect(0, 0, 3, 4), UnionRectsEvenIfEmpty(Rect(), Rect(3, 4, 0, 0)));
@@ -549,6 +575,50 @@ TEST(RectTest, Offset) {
              Vector2d(2 - kMaxInt, 2 - kMaxInt)));
 }
 
+TEST(RectTest, OffsetAndInsetSaturation) {
+  // The scalar computations of Offset() and Inset(), with the same
+  // saturation.
+  const auto clamp_size = [](int origin, int size) {
+    int end = base::ClampAdd(origin, size);
+    return std::max(0, end - origin);
+  };
+  const auto offset = [&](const Rect& r, int dx, int dy) {
+    int x = base::ClampAdd(r.x(), dx);
+    int y = base::ClampAdd(r.y(), dy);
+    return std::array<int, 4>{x, y, clamp_size(x, r.width()),
+                              clamp_size(y, r.height())};
+  };
+  const auto inset = [&](const Rect& r, const Insets& insets) {
+    int x = base::ClampAdd(r.x(), insets.left());
+    int y = base::ClampAdd(r.y(), insets.top());
+    return std::array<int, 4>{
+        x, y, clamp_size(x, base::ClampSub(r.width(), insets.width())),
+        clamp_size(y, base::ClampSub(r.height(), insets.height()))};
+  };
+  const auto components = [](const Rect& r) {
+    return std::array<int, 4>{r.x(), r.y(), r.width(), r.height()};
+  };
+
+  const int values[] = {kMinInt,     kMinInt + 1, kMinInt / 2, -100, -1, 0,
+                        1,           100,         kMaxInt / 2, kMaxInt - 1,
+                        kMaxInt};
+  for (int a : values) {
+    for (int b : values) {
+      Rect rect(a, b, b, a);
+      for (int c : values) {
+        SCOPED_TRACE(testing::Message() << rect.ToString() << " " << c);
+        Rect offset_rect = rect;
+        offset_rect.Offset(c, a);
+        EXPECT_EQ(offset(rect, c, a), components(offset_rect));
+        Insets insets = Insets::TLBR(a, c, b, c);
+        Rect inset_rect = rect;
+        inset_rect.Inset(insets);
+        EXPECT_EQ(inset(rect, insets), components(inset_rect));
+      }
+    }
+  }
+}
+
 TEST(RectTest, Corners) {
   Rect i(1, 2, 3, 4);
   EXPECT_EQ(Point(1, 2), i.origin());
@@ -830,6 +900,25 @@ TEST(RectTest, InsetOutsetClamped) {
   EXPECT_EQ(Rect(kMinInt, kMinInt, kMaxInt, kMaxInt), r);
 }
 
+TEST(RectTest, InsetRects) {
+  std::vector<Rect> rects = {Rect(10, 20, 30, 40),
+                             Rect(),
+                             Rect(kMinInt, 0, kMaxInt, 5),
+                             Rect(kMaxInt - 10, kMaxInt - 10, 10, 10),
+                             Rect(-5, -5, 3, 100)};
+  for (const Insets& insets :
+       {Insets(3), Insets::TLBR(30, 20, 50, 40), Insets(-kMaxInt),
+        Insets::TLBR(kMinInt, kMaxInt, 7, -2), Outsets(20).ToInsets()}) {
+    std::vector<Rect> inset = rects;
+    InsetRects(inset, insets);
+    for (size_t i = 0; i < rects.size(); ++i) {
+      Rect expected = rects[i];
+      expected.Inset(insets);
+      EXPECT_EQ(expected, inset[i]) << insets.ToString() << " " << i;
+    }
+  }
+}
+
 TEST(RectTest, SetByBounds) {
   Rect r;
   r.SetByBounds(1, 2, 30, 40);
@@ -886,4 +975,32 @@ TEST(RectTest, MaximumCoveredRect) {
             MaximumCoveredRect(Rect(10, 20, 40, 50), Rect(20, 30, 40, 50)));
 }
 
+// The edges of the edge cases, and of the results of operations on them, don't
+// overflow.
+TEST(RectTest, EdgeCases) {
+  for (const RectEdgeCase& edge_case : GetRectEdgeCases()) {
+    SCOPED_TRACE(edge_case.name);
+    Rect rect = edge_case.rect;
+    EXPECT_GE(rect.right(), rect.x());
+    EXPECT_GE(rect.bottom(), rect.y());
+    if (!rect.IsEmpty()) {
+      EXPECT_EQ(rect, UnionRects(rect, rect));
+      EXPECT_EQ(rect, IntersectRects(rect, rect));
+    }
+    rect.Outset(kMaxInt);
+    EXPECT_GE(rect.right(), rect.x());
+    EXPECT_GE(rect.bottom(), rect.y());
+  }
+
+  for (const RectFEdgeCase& edge_case : GetRectFEdgeCases()) {
+    SCOPED_TRACE(edge_case.name);
+    Rect enclosing = ToEnclosingRect(edge_case.rect);
+    EXPECT_GE(enclosing.right(), enclosing.x());
+    EXPECT_GE(enclosing.bottom(), enclosing.y());
+    Rect enclosed = ToEnclosedRect(edge_case.rect);
+    EXPECT_GE(enclosed.right(), enclosed.x());
+    EXPECT_GE(enclosed.bottom(), enclosed.y());
+  }
+}
+
 }  // namespace gfx
@@ -0,0 +1,311 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/region.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+
+#include "base/check_op.h"
+#include "base/containers/span.h"
+#include "base/notreached.h"
+#include "ui/gfx/geometry/point.h"
+
+namespace gfx {
+
+namespace {
+
+// Past the end of any coordinate, so that sweeps don't need a special case
+// for exhausted lists.
+constexpr int64_t kEnd = std::numeric_limits<int64_t>::max();
+
+}  // namespace
+
+Region::Region() = default;
+
+Region::Region(const Rect& rect) {
+  if (rect.IsEmpty()) {
+    return;
+  }
+  spans_.push_back({rect.x(), rect.right()});
+  bands_.push_back({rect.y(), rect.bottom(), 0, 1});
+  bounds_ = rect;
+}
+
+Region::Region(const Region& other) = default;
+Region::Region(Region&& other) = default;
+Region::~Region() = default;
+
+Region& Region::operator=(const Region& other) = default;
+Region& Region::operator=(Region&& other) = default;
+
+void Region::set_max_rects(size_t max_rects) {
+  DCHECK_GE(max_rects, 1u);
+  max_rects_ = max_rects;
+}
+
+std::vector<Rect> Region::GetRects() const {
+  std::vector<Rect> rects;
+  rects.reserve(spans_.size());
+  for (const Band& band : bands_) {
+    for (size_t i = band.begin; i < band.end; ++i) {
+      Rect rect;
+      rect.SetByBounds(spans_[i].left, band.top, spans_[i].right, band.bottom);
+      rects.push_back(rect);
+    }
+  }
+  return rects;
+}
+
+bool Region::Contains(const Point& point) const {
+  if (!bounds_.Contains(point)) {
+    return false;
+  }
+  auto band = std::ranges::upper_bound(bands_, point.y(), {}, &Band::bottom);
+  if (band == bands_.end() || band->top > point.y()) {
+    return false;
+  }
+  auto spans = base::span(spans_).subspan(band->begin, band->end - band->begin);
+  auto span = std::ranges::upper_bound(spans, point.x(), {}, &Span::right);
+  return span != spans.end() && span->left <= point.x();
+}
+
+bool Region::Contains(const Rect& rect) const {
+  if (rect.IsEmpty()) {
+    return true;
+  }
+  if (!bounds_.Contains(rect)) {
+    return false;
+  }
+  // The bands over |rect| must be contiguous, and each must have a span
+  // containing it horizontally.
+  auto band = std::ranges::upper_bound(bands_, rect.y(), {}, &Band::bottom);
+  int y = rect.y();
+  for (; band != bands_.end() && y < rect.bottom(); ++band) {
+    if (band->top > y) {
+      return false;
+    }
+    auto spans =
+        base::span(spans_).subspan(band->begin, band->end - band->begin);
+    auto span = std::ranges::upper_bound(spans, rect.x(), {}, &Span::right);
+    if (span == spans.end() || span->left > rect.x() ||
+        span->right < rect.right()) {
+      return false;
+    }
+    y = band->bottom;
+  }
+  return y >= rect.bottom();
+}
+
+bool Region::Intersects(const Rect& rect) const {
+  if (!bounds_.Intersects(rect)) {
+    return false;
+  }
+  auto band = std::ranges::upper_bound(bands_, rect.y(), {}, &Band::bottom);
+  for (; band != bands_.end() && band->top < rect.bottom(); ++band) {
+    auto spans =
+        base::span(spans_).subspan(band->begin, band->end - band->begin);
+    auto span = std::ranges::upper_bound(spans, rect.x(), {}, &Span::right);
+    if (span != spans.end() && span->left < rect.right()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void Region::Clear() {
+  bands_.clear();
+  spans_.clear();
+  bounds_ = Rect();
+}
+
+void Region::Union(const Rect& rect) {
+  if (rect.IsEmpty() || Contains(rect)) {
+    return;
+  }
+  if (rect.Contains(bounds_)) {
+    size_t max_rects = max_rects_;
+    *this = Region(rect);
+    max_rects_ = max_rects;
+    return;
+  }
+  Combine(Region(rect), Operation::kUnion);
+}
+
+void Region::Union(const Region& region) {
+  if (region.IsEmpty()) {
+    return;
+  }
+  Combine(region, Operation::kUnion);
+}
+
+void Region::Intersect(const Rect& rect) {
+  if (rect.Contains(bounds_)) {
+    return;
+  }
+  Combine(Region(rect), Operation::kIntersect);
+}
+
+void Region::Intersect(const Region& region) {
+  Combine(region, Operation::kIntersect);
+}
+
+void Region::Subtract(const Rect& rect) {
+  if (!Intersects(rect)) {
+    return;
+  }
+  Combine(Region(rect), Operation::kSubtract);
+}
+
+void Region::Subtract(const Region& region) {
+  if (!bounds_.Intersects(region.bounds_)) {
+    return;
+  }
+  Combine(region, Operation::kSubtract);
+}
+
+std::string Region::ToString() const {
+  std::string result = "{";
+  for (const Rect& rect : GetRects()) {
+    if (result.size() > 1) {
+      result += ", ";
+    }
+    result += rect.ToString();
+  }
+  return result + "}";
+}
+
+void Region::Combine(const Region& other, Operation operation) {
+  const auto is_inside = [operation](bool in_a, bool in_b) {
+    switch (operation) {
+      case Operation::kUnion:
+        return in_a || in_b;
+      case Operation::kIntersect:
+        return in_a && in_b;
+      case Operation::kSubtract:
+        return in_a && !in_b;
+    }
+    NOTREACHED();
+  };
+  Region result;
+  result.spans_.reserve(spans_.size() + other.spans_.size());
+  result.bands_.reserve(bands_.size() + other.bands_.size());
+
+  // Sweeps down the bands of both regions. Between consecutive band edges,
+  // the spans of each region are constant, and are combined with a sweep
+  // across their edges.
+  size_t ia = 0;
+  size_t ib = 0;
+  int64_t y = std::min(bands_.empty() ? kEnd : bands_[0].top,
+                       other.bands_.empty() ? kEnd : other.bands_[0].top);
+  while (y != kEnd) {
+    const Band* band_a = ia < bands_.size() ? &bands_[ia] : nullptr;
+    const Band* band_b = ib < other.bands_.size() ? &other.bands_[ib] : nullptr;
+    const bool in_band_a = band_a && band_a->top <= y;
+    const bool in_band_b = band_b && band_b->top <= y;
+    const int64_t next_a =
+        band_a ? (in_band_a ? band_a->bottom : band_a->top) : kEnd;
+    const int64_t next_b =
+        band_b ? (in_band_b ? band_b->bottom : band_b->top) : kEnd;
+    const int64_t next_y = std::min(next_a, next_b);
+
+    if (in_band_a || in_band_b) {
+      base::span<const Span> a;
+      if (in_band_a) {
+        a = base::span(spans_).subspan(band_a->begin,
+                                       band_a->end - band_a->begin);
+      }
+      base::span<const Span> b;
+      if (in_band_b) {
+        b = base::span(other.spans_)
+                .subspan(band_b->begin, band_b->end - band_b->begin);
+      }
+      const size_t begin = result.spans_.size();
+      size_t i = 0;
+      size_t j = 0;
+      bool in_a = false;
+      bool in_b = false;
+      bool inside = false;
+      int64_t left = 0;
+      while (i < a.size() || j < b.size()) {
+        const int64_t xa =
+            i < a.size() ? (in_a ? a[i].right : a[i].left) : kEnd;
+        const int64_t xb =
+            j < b.size() ? (in_b ? b[j].right : b[j].left) : kEnd;
+        const int64_t x = std::min(xa, xb);
+        if (xa == x) {
+          in_a = !in_a;
+          i += !in_a;
+        }
+        if (xb == x) {
+          in_b = !in_b;
+          j += !in_b;
+        }
+        const bool now_inside = is_inside(in_a, in_b);
+        if (now_inside && !inside) {
+          left = x;
+        } else if (!now_inside && inside) {
+          result.spans_.push_back(
+              {static_cast<int>(left), static_cast<int>(x)});
+        }
+        inside = now_inside;
+      }
+      DCHECK(!inside);
+      result.AppendBand(y, next_y, begin);
+    }
+
+    if (in_band_a && next_a == next_y) {
+      ++ia;
+    }
+    if (in_band_b && next_b == next_y) {
+      ++ib;
+    }
+    y = next_y;
+  }
+
+  bands_ = std::move(result.bands_);
+  spans_ = std::move(result.spans_);
+  UpdateBounds();
+  if (spans_.size() > max_rects_) {
+    Rect bounds = bounds_;
+    spans_.assign(1, {bounds.x(), bounds.right()});
+    bands_.assign(1, {bounds.y(), bounds.bottom(), 0, 1});
+  }
+}
+
+void Region::AppendBand(int top, int bottom, size_t begin) {
+  const size_t end = spans_.size();
+  if (begin == end) {
+    return;
+  }
+  if (!bands_.empty()) {
+    Band& last = bands_.back();
+    if (last.bottom == top && last.end - last.begin == end - begin &&
+        std::equal(spans_.begin() + last.begin, spans_.begin() + last.end,
+                   spans_.begin() + begin)) {
+      last.bottom = bottom;
+      spans_.resize(begin);
+      return;
+    }
+  }
+  bands_.push_back({top, bottom, begin, end});
+}
+
+void Region::UpdateBounds() {
+  if (bands_.empty()) {
+    bounds_ = Rect();
+    return;
+  }
+  int left = std::numeric_limits<int>::max();
+  int right = std::numeric_limits<int>::min();
+  for (const Band& band : bands_) {
+    left = std::min(left, spans_[band.begin].left);
+    right = std::max(right, spans_[band.end - 1].right);
+  }
+  bounds_.SetByBounds(left, bands_.front().top, right, bands_.back().bottom);
+}
+
+}  // namespace gfx
@@ -0,0 +1,111 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_REGION_H_
+#define UI_GFX_GEOMETRY_REGION_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+#include "base/component_export.h"
+#include "ui/gfx/geometry/rect.h"
+
+namespace gfx {
+
+class Point;
+
+// A set of integer points, represented as a sorted list of horizontal bands,
+// each with a sorted list of disjoint x spans. Unlike Rect::Subtract() and
+// Rect::Union(), which return the bounding rect of the result, the operations
+// are exact, as long as the result has at most max_rects() rects. Beyond that,
+// the region becomes its bounds, a superset of the exact result, so that the
+// cost of the operations stays bounded. That is suitable for damage, but not
+// for occlusion, which must not grow.
+class COMPONENT_EXPORT(GEOMETRY) Region {
+ public:
+  static constexpr size_t kDefaultMaxRects = 256;
+
+  Region();
+  explicit Region(const Rect& rect);
+  Region(const Region& other);
+  Region(Region&& other);
+  ~Region();
+
+  Region& operator=(const Region& other);
+  Region& operator=(Region&& other);
+
+  bool IsEmpty() const { return bands_.empty(); }
+  // Returns the smallest rect containing the region.
+  const Rect& bounds() const { return bounds_; }
+
+  // The maximum number of rects, at least 1. Setting it doesn't change the
+  // region until the next operation.
+  size_t max_rects() const { return max_rects_; }
+  void set_max_rects(size_t max_rects);
+
+  // Returns the number of rects of GetRects().
+  size_t GetRectCount() const { return spans_.size(); }
+  // Returns disjoint rects whose union is the region, sorted by y and then
+  // by x. Rects in the same band have the same y and height.
+  std::vector<Rect> GetRects() const;
+
+  bool Contains(const Point& point) const;
+  bool Contains(const Rect& rect) const;
+  bool Intersects(const Rect& rect) const;
+
+  void Clear();
+  void Union(const Rect& rect);
+  void Union(const Region& region);
+  void Intersect(const Rect& rect);
+  void Intersect(const Region& region);
+  void Subtract(const Rect& rect);
+  void Subtract(const Region& region);
+
+  std::string ToString() const;
+
+  friend bool operator==(const Region& a, const Region& b) {
+    return a.bands_ == b.bands_ && a.spans_ == b.spans_;
+  }
+
+ private:
+  enum class Operation { kUnion, kIntersect, kSubtract };
+
+  struct Span {
+    int left;
+    int right;
+    friend bool operator==(const Span&, const Span&) = default;
+  };
+
+  // The points from |top| to |bottom|, covered by the spans from |begin| to
+  // |end| of spans_.
+  struct Band {
+    int top;
+    int bottom;
+    size_t begin;
+    size_t end;
+    friend bool operator==(const Band&, const Band&) = default;
+  };
+
+  void Combine(const Region& other, Operation operation);
+  // Appends a band with the spans from |begin| to the end of spans_, or
+  // merges it into the last band if that has the same spans and abuts it.
+  void AppendBand(int top, int bottom, size_t begin);
+  // Sets bounds_ from bands_ and spans_.
+  void UpdateBounds();
+
+  // Bands are sorted by y and don't overlap, and the spans of each band are
+  // sorted by x and neither overlap nor abut. No band is empty, and adjacent
+  // bands that abut have different spans, so that each region has a single
+  // representation.
+  std::vector<Band> bands_;
+  std::vector<Span> spans_;
+  Rect bounds_;
+  size_t max_rects_ = kDefaultMaxRects;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_REGION_H_
@@ -0,0 +1,173 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/region.h"
+
+#include <array>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/point.h"
+
+namespace gfx {
+
+namespace {
+
+TEST(RegionTest, Empty) {
+  Region region;
+  EXPECT_TRUE(region.IsEmpty());
+  EXPECT_EQ(Rect(), region.bounds());
+  EXPECT_EQ(0u, region.GetRectCount());
+  EXPECT_FALSE(region.Contains(Point()));
+  EXPECT_TRUE(region.Contains(Rect()));
+  EXPECT_FALSE(region.Intersects(Rect(0, 0, 10, 10)));
+  EXPECT_TRUE(Region(Rect(10, 10, 0, 5)).IsEmpty());
+  EXPECT_EQ(Region(), Region(Rect(10, 10, 0, 5)));
+}
+
+TEST(RegionTest, Subtract) {
+  // Subtracting the center of a rect leaves a frame of 4 rects, while
+  // Rect::Subtract() can't remove anything.
+  Region region(Rect(0, 0, 30, 30));
+  region.Subtract(Rect(10, 10, 10, 10));
+  EXPECT_EQ((std::vector<Rect>{Rect(0, 0, 30, 10), Rect(0, 10, 10, 10),
+                               Rect(20, 10, 10, 10), Rect(0, 20, 30, 10)}),
+            region.GetRects());
+  EXPECT_EQ(Rect(0, 0, 30, 30), region.bounds());
+  EXPECT_TRUE(region.Contains(Point(5, 15)));
+  EXPECT_FALSE(region.Contains(Point(15, 15)));
+  EXPECT_TRUE(region.Contains(Rect(0, 0, 10, 30)));
+  EXPECT_FALSE(region.Contains(Rect(0, 0, 11, 30)));
+  EXPECT_FALSE(region.Intersects(Rect(10, 10, 10, 10)));
+  EXPECT_TRUE(region.Intersects(Rect(19, 19, 2, 2)));
+
+  // Filling it back merges the bands.
+  region.Union(Rect(10, 10, 10, 10));
+  EXPECT_EQ(Region(Rect(0, 0, 30, 30)), region);
+  EXPECT_EQ(1u, region.GetRectCount());
+
+  region.Subtract(Rect(-10, -10, 50, 50));
+  EXPECT_TRUE(region.IsEmpty());
+}
+
+TEST(RegionTest, UnionAndIntersect) {
+  Region region(Rect(0, 0, 10, 10));
+  region.Union(Rect(10, 0, 10, 10));
+  EXPECT_EQ(Region(Rect(0, 0, 20, 10)), region);
+  region.Union(Rect(5, 20, 10, 10));
+  EXPECT_EQ(2u, region.GetRectCount());
+  EXPECT_EQ(Rect(0, 0, 20, 30), region.bounds());
+  EXPECT_FALSE(region.Contains(Point(5, 15)));
+
+  Region other(Rect(0, 5, 8, 20));
+  region.Intersect(other);
+  EXPECT_EQ((std::vector<Rect>{Rect(0, 5, 8, 5), Rect(5, 20, 3, 5)}),
+            region.GetRects());
+
+  region.Intersect(Rect(100, 100, 1, 1));
+  EXPECT_TRUE(region.IsEmpty());
+}
+
+TEST(RegionTest, MaxRects) {
+  Region region;
+  region.set_max_rects(4);
+  for (int i = 0; i < 4; ++i) {
+    region.Union(Rect(i * 20, i * 20, 10, 10));
+  }
+  EXPECT_EQ(4u, region.GetRectCount());
+  // One more rect exceeds the cap, and the region becomes its bounds.
+  region.Union(Rect(80, 80, 10, 10));
+  EXPECT_EQ(Region(Rect(0, 0, 90, 90)), region);
+  EXPECT_EQ(4u, region.max_rects());
+}
+
+TEST(RegionTest, MatchesPixels) {
+  // Compares random sequences of operations with the same operations on a
+  // grid of points.
+  constexpr int kSize = 24;
+  using Pixels = std::array<std::array<bool, kSize>, kSize>;
+  auto to_pixels = [](const Rect& rect) {
+    Pixels pixels = {};
+    for (int y = rect.y(); y < rect.bottom(); ++y) {
+      for (int x = rect.x(); x < rect.right(); ++x) {
+        pixels[y][x] = true;
+      }
+    }
+    return pixels;
+  };
+
+  uint32_t seed = 1;
+  auto random = [&seed](int max) {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int>((seed >> 16) % max);
+  };
+  auto random_rect = [&random]() {
+    int x = random(kSize);
+    int y = random(kSize);
+    return Rect(x, y, random(kSize - x + 1), random(kSize - y + 1));
+  };
+
+  for (int trial = 0; trial < 50; ++trial) {
+    Region region;
+    Pixels pixels = {};
+    for (int step = 0; step < 20; ++step) {
+      Region other;
+      Pixels other_pixels = {};
+      for (int i = 0; i < 3; ++i) {
+        Rect rect = random_rect();
+        other.Union(rect);
+        Pixels rect_pixels = to_pixels(rect);
+        for (int y = 0; y < kSize; ++y) {
+          for (int x = 0; x < kSize; ++x) {
+            other_pixels[y][x] |= rect_pixels[y][x];
+          }
+        }
+      }
+      int operation = random(3);
+      for (int y = 0; y < kSize; ++y) {
+        for (int x = 0; x < kSize; ++x) {
+          bool a = pixels[y][x];
+          bool b = other_pixels[y][x];
+          pixels[y][x] = operation == 0 ? a || b : operation == 1 ? a && b
+                                                                  : a && !b;
+        }
+      }
+      if (operation == 0) {
+        region.Union(other);
+      } else if (operation == 1) {
+        region.Intersect(other);
+      } else {
+        region.Subtract(other);
+      }
+
+      Pixels region_pixels = {};
+      for (const Rect& rect : region.GetRects()) {
+        EXPECT_TRUE(region.bounds().Contains(rect));
+        Pixels rect_pixels = to_pixels(rect);
+        for (int y = 0; y < kSize; ++y) {
+          for (int x = 0; x < kSize; ++x) {
+            // The rects are disjoint.
+            EXPECT_FALSE(region_pixels[y][x] && rect_pixels[y][x]);
+            region_pixels[y][x] |= rect_pixels[y][x];
+          }
+        }
+      }
+      ASSERT_EQ(pixels, region_pixels) << region.ToString();
+      for (int y = 0; y < kSize; ++y) {
+        for (int x = 0; x < kSize; ++x) {
+          ASSERT_EQ(pixels[y][x], region.Contains(Point(x, y)));
+        }
+      }
+      Rect rect = random_rect();
+      Region intersection = region;
+      intersection.Intersect(rect);
+      EXPECT_EQ(!intersection.IsEmpty(), region.Intersects(rect));
+      EXPECT_EQ(intersection == Region(rect), region.Contains(rect));
+    }
+  }
+}
+
+}  // namespace
+
+}  // namespace gfx
@@ -32,84 +32,104 @@ bool IsResizingHorizontally(ResizeEdge resize_edge) {
 
 }  // namespace
 
-void SizeRectToAspectRatioWithExcludedMargin(
-    ResizeEdge resize_edge,
-    float aspect_ratio,
-    const Size& original_min_window_size,
-    std::optional<Size> max_window_size,
-    const Size& excluded_margin,
-    Rect& rect) {
+AspectRatioResizer::AspectRatioResizer(ResizeEdge resize_edge,
+                                       float aspect_ratio,
+                                       const Size& min_window_size,
+                                       std::optional<Size> max_window_size,
+                                       const Size& excluded_margin)
+    : resize_edge_(resize_edge),
+      is_resizing_horizontally_(IsResizingHorizontally(resize_edge)),
+      aspect_ratio_(aspect_ratio),
+      excluded_margin_(excluded_margin),
+      min_window_size_(min_window_size),
+      max_window_size_(max_window_size),
+      // Also remove the margin from the minimum size, since it'll get added
+      // back at the end.
+      min_content_size_(min_window_size - excluded_margin) {
   DCHECK_GT(aspect_ratio, 0.0f);
   if (max_window_size.has_value()) {
-    DCHECK_GE(max_window_size->width(), original_min_window_size.width());
-    DCHECK_GE(max_window_size->height(), original_min_window_size.height());
+    DCHECK_GE(max_window_size->width(), min_window_size.width());
+    DCHECK_GE(max_window_size->height(), min_window_size.height());
     DCHECK_GE(max_window_size->width(), excluded_margin.width());
     DCHECK_GE(max_window_size->height(), excluded_margin.height());
-    DCHECK(Rect(rect.origin(), *max_window_size).Contains(rect))
-        << rect.ToString() << " is larger than the maximum size "
-        << max_window_size->ToString();
-  }
-  DCHECK(rect.Contains(Rect(rect.origin(), original_min_window_size)))
-      << rect.ToString() << " is smaller than the minimum size "
-      << original_min_window_size.ToString();
-
-  // Compute the aspect ratio with the excluded margin removed from both the
-  // rectangle and the maximum size. Note that the edge we ask for doesn't
-  // really matter; we'll position the resulting rectangle correctly later.
-  Size new_size(rect.width() - excluded_margin.width(),
-                rect.height() - excluded_margin.height());
-  if (max_window_size) {
-    max_window_size.emplace(
+    // Compute the aspect ratio with the excluded margin removed from both the
+    // rectangle and the maximum size.
+    max_content_size_.emplace(
         max_window_size->width() - excluded_margin.width(),
         max_window_size->height() - excluded_margin.height());
   }
 
-  // Also remove the margin from the minimum size, since it'll get added back at
-  // the end.
-  const Size min_window_size = original_min_window_size - excluded_margin;
-
-  if (IsResizingHorizontally(resize_edge)) {
-    new_size.set_height(base::ClampRound(new_size.width() / aspect_ratio));
-    if (min_window_size.height() > new_size.height() ||
-        (max_window_size.has_value() &&
-         new_size.height() > max_window_size->height())) {
-      if (max_window_size.has_value()) {
-        new_size.set_height(std::clamp(new_size.height(),
-                                       min_window_size.height(),
-                                       max_window_size->height()));
-      } else {
-        new_size.set_height(min_window_size.height());
-      }
-      new_size.set_width(base::ClampRound(new_size.height() * aspect_ratio));
-    }
-  } else {
-    new_size.set_width(base::ClampRound(new_size.height() * aspect_ratio));
-    if (min_window_size.width() > new_size.width() ||
-        (max_window_size.has_value() &&
-         new_size.width() > max_window_size->width())) {
-      if (max_window_size.has_value()) {
-        new_size.set_width(std::clamp(new_size.width(), min_window_size.width(),
-                                      max_window_size->width()));
-      } else {
-        new_size.set_width(min_window_size.width());
-      }
-      new_size.set_height(base::ClampRound(new_size.width() / aspect_ratio));
-    }
+  min_clamped_window_size_ = GetWindowSize(GetClampedSize(min_content_size_));
+  if (max_content_size_.has_value()) {
+    max_clamped_window_size_ =
+        GetWindowSize(GetClampedSize(*max_content_size_));
   }
+}
 
+Size AspectRatioResizer::GetClampedSize(const Size& limit) const {
+  if (is_resizing_horizontally_) {
+    return Size(base::ClampRound(limit.height() * aspect_ratio_),
+                limit.height());
+  }
+  return Size(limit.width(), base::ClampRound(limit.width() / aspect_ratio_));
+}
+
+Size AspectRatioResizer::GetWindowSize(Size content_size) const {
   // The dimensions might still be outside of the allowed ranges at this point.
   // This happens when the aspect ratio makes it impossible to fit |rect|
   // within the size limits without letter-/pillarboxing.
-  if (max_window_size.has_value())
-    new_size.SetToMin(*max_window_size);
+  if (max_content_size_.has_value()) {
+    content_size.SetToMin(*max_content_size_);
+  }
 
   // The minimum size also excludes any excluded margin, so the content area has
   // to make up the adjusted difference.
-  new_size.SetToMax(min_window_size);
+  content_size.SetToMax(min_content_size_);
 
   // Now add the excluded margin back to the total size, so that the total size
   // is aligned with the resize edge.
-  new_size.Enlarge(excluded_margin.width(), excluded_margin.height());
+  content_size.Enlarge(excluded_margin_.width(), excluded_margin_.height());
+  return content_size;
+}
+
+void AspectRatioResizer::SizeRect(Rect& rect) const {
+  if (max_window_size_.has_value()) {
+    DCHECK(Rect(rect.origin(), *max_window_size_).Contains(rect))
+        << rect.ToString() << " is larger than the maximum size "
+        << max_window_size_->ToString();
+  }
+  DCHECK(rect.Contains(Rect(rect.origin(), min_window_size_)))
+      << rect.ToString() << " is smaller than the minimum size "
+      << min_window_size_.ToString();
+
+  // Only the dimension being dragged is kept; the other follows it, or is
+  // clamped to the size limits, for which the window size is precomputed.
+  const Size content_size(rect.width() - excluded_margin_.width(),
+                          rect.height() - excluded_margin_.height());
+  Size new_size;
+  if (is_resizing_horizontally_) {
+    const int height =
+        std::max(0, base::ClampRound(content_size.width() / aspect_ratio_));
+    if (min_content_size_.height() > height) {
+      new_size = min_clamped_window_size_;
+    } else if (max_content_size_.has_value() &&
+               height > max_content_size_->height()) {
+      new_size = max_clamped_window_size_;
+    } else {
+      new_size = GetWindowSize(Size(content_size.width(), height));
+    }
+  } else {
+    const int width =
+        std::max(0, base::ClampRound(content_size.height() * aspect_ratio_));
+    if (min_content_size_.width() > width) {
+      new_size = min_clamped_window_size_;
+    } else if (max_content_size_.has_value() &&
+               width > max_content_size_->width()) {
+      new_size = max_clamped_window_size_;
+    } else {
+      new_size = GetWindowSize(Size(width, content_size.height()));
+    }
+  }
 
   // |rect| bounds before sizing to aspect ratio.
   int left = rect.x();
@@ -117,7 +137,7 @@ void SizeRectToAspectRatioWithExcludedMargin(
   int right = rect.right();
   int bottom = rect.bottom();
 
-  switch (resize_edge) {
+  switch (resize_edge_) {
     case ResizeEdge::kRight:
     case ResizeEdge::kBottom:
       right = new_size.width() + left;
@@ -149,6 +169,18 @@ void SizeRectToAspectRatioWithExcludedMargin(
   rect.SetByBounds(left, top, right, bottom);
 }
 
+void SizeRectToAspectRatioWithExcludedMargin(
+    ResizeEdge resize_edge,
+    float aspect_ratio,
+    const Size& min_window_size,
+    std::optional<Size> max_window_size,
+    const Size& excluded_margin,
+    Rect& rect) {
+  AspectRatioResizer(resize_edge, aspect_ratio, min_window_size,
+                     std::move(max_window_size), excluded_margin)
+      .SizeRect(rect);
+}
+
 void SizeRectToAspectRatio(ResizeEdge resize_edge,
                            float aspect_ratio,
                            const Size& min_window_size,
@@ -8,11 +8,11 @@
 #include <optional>
 
 #include "base/component_export.h"
+#include "ui/gfx/geometry/size.h"
 
 namespace gfx {
 
 class Rect;
-class Size;
 
 enum class ResizeEdge {
   kBottom,
@@ -52,6 +52,52 @@ void COMPONENT_EXPORT(GEOMETRY)
                                             const Size& excluded_margin,
                                             Rect& rect);
 
+// SizeRectToAspectRatioWithExcludedMargin() for the rects of a resize drag,
+// which all have the same edge, aspect ratio, limits and margin. The limits
+// without the margin, and the sizes that a rect gets when its other dimension
+// is clamped to them, are computed once when the drag starts, so that each
+// pointer move only rounds the dimension that follows the one being dragged.
+// E.g.
+//   AspectRatioResizer resizer(edge, aspect_ratio, min_size, max_size);
+//   // For each pointer move:
+//   resizer.SizeRect(bounds);
+class COMPONENT_EXPORT(GEOMETRY) AspectRatioResizer {
+ public:
+  AspectRatioResizer(ResizeEdge resize_edge,
+                     float aspect_ratio,
+                     const Size& min_window_size,
+                     std::optional<Size> max_window_size,
+                     const Size& excluded_margin = Size());
+
+  // Updates |rect| as SizeRectToAspectRatioWithExcludedMargin() with the
+  // arguments of the constructor does.
+  void SizeRect(Rect& rect) const;
+
+ private:
+  // The content size when the dimension that follows the dragged one is
+  // clamped to that of |limit|.
+  Size GetClampedSize(const Size& limit) const;
+
+  // The size of the window for |content_size|, limited to the min and max
+  // sizes, with the margin added back.
+  Size GetWindowSize(Size content_size) const;
+
+  ResizeEdge resize_edge_;
+  bool is_resizing_horizontally_;
+  float aspect_ratio_;
+  Size excluded_margin_;
+  Size min_window_size_;
+  std::optional<Size> max_window_size_;
+  // The limits without the margin.
+  Size min_content_size_;
+  std::optional<Size> max_content_size_;
+  // The window sizes when the dimension that follows the dragged one is
+  // clamped to the min or max content size. The latter is only set when there
+  // is a max size.
+  Size min_clamped_window_size_;
+  Size max_clamped_window_size_;
+};
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_RESIZE_UTILS_H_
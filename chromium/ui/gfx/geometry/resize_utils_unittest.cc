@@ -98,6 +98,43 @@ TEST_P(ResizeUtilsTest, SizeRectToAspectRatioWithExcludedMargin) {
   }
 }
 
+TEST_P(ResizeUtilsTest, AspectRatioResizer) {
+  const AspectRatioResizer resizer(GetParam().resize_edge,
+                                   GetParam().aspect_ratio, GetParam().min_size,
+                                   GetParam().max_size);
+  // The resizer is reused for the rects of a drag.
+  for (int i = 0; i < 2; ++i) {
+    Rect rect = GetParam().input_rect;
+    resizer.SizeRect(rect);
+    EXPECT_EQ(rect, GetParam().expected_output_rect) << GetParam().ToString();
+  }
+}
+
+TEST(AspectRatioResizerTest, Drag) {
+  const Size excluded_margin(2, 4);
+  const AspectRatioResizer resizer(ResizeEdge::kRight, kAspectRatioHorizontal,
+                                   kMinSizeHorizontal, kMaxSizeHorizontal,
+                                   excluded_margin);
+  for (int width = kMinSizeHorizontal.width();
+       width <= kMaxSizeHorizontal.width(); ++width) {
+    Rect rect(100, 100, width, kMaxSizeHorizontal.height());
+    Rect expected = rect;
+    SizeRectToAspectRatioWithExcludedMargin(
+        ResizeEdge::kRight, kAspectRatioHorizontal, kMinSizeHorizontal,
+        kMaxSizeHorizontal, excluded_margin, expected);
+    resizer.SizeRect(rect);
+    EXPECT_EQ(expected, rect) << width;
+    // The content height follows the width up to the max height without the
+    // margin, 21, beyond which the size is that of the max height.
+    const int content_height = (width - 1) / 2;
+    if (content_height > 21) {
+      EXPECT_EQ(Rect(100, 100, 44, 25), rect) << width;
+    } else {
+      EXPECT_EQ(Rect(100, 100, width, content_height + 4), rect) << width;
+    }
+  }
+}
+
 const SizingParams kSizeRectToSquareAspectRatioTestCases[] = {
     // Dragging the top resizer up.
     {ResizeEdge::kTop, kAspectRatioSquare, kMinSizeHorizontal,
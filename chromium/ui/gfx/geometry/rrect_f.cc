@@ -76,32 +76,6 @@ float RRectF::GetSimpleRadius() const {
   return result.x();
 }
 
-RRectF::Type RRectF::GetType() const {
-  SkPoint rad;
-  switch (skrrect_.getType()) {
-    case SkRRect::kEmpty_Type:
-      return Type::kEmpty;
-    case SkRRect::kRect_Type:
-      return Type::kRect;
-    case SkRRect::kSimple_Type:
-      rad = skrrect_.getSimpleRadii();
-      if (rad.x() == rad.y()) {
-        return Type::kSingle;
-      }
-      return Type::kSimple;
-    case SkRRect::kOval_Type:
-      rad = skrrect_.getSimpleRadii();
-      if (rad.x() == rad.y()) {
-        return Type::kSingle;
-      }
-      return Type::kOval;
-    case SkRRect::kNinePatch_Type:
-    case SkRRect::kComplex_Type:
-    default:
-      return Type::kComplex;
-  }
-}
-
 gfx::Vector2dF RRectF::GetCornerRadii(Corner corner) const {
   SkPoint result = skrrect_.radii(SkRRect::Corner(corner));
   return gfx::Vector2dF(result.x(), result.y());
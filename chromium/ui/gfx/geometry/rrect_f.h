@@ -8,9 +8,12 @@
 #include <memory>
 #include <string>
 
+#include "base/compiler_specific.h"
 #include "base/component_export.h"
 #include "base/containers/span.h"
 #include "third_party/skia/include/core/SkRRect.h"
+#include "ui/gfx/geometry/double4.h"
+#include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/rounded_corners_f.h"
 #include "ui/gfx/geometry/skia_conversions.h"
@@ -110,7 +113,27 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) RRectF {
               // radii all equal to height/2, and x_rad != y_rad.
     kComplex,  // Non-zero width and height, and arbitrary (non-equal) radii.
   };
-  Type GetType() const;
+  // SkRRect keeps its type up to date, so this is cheap.
+  Type GetType() const {
+    switch (skrrect_.getType()) {
+      case SkRRect::kEmpty_Type:
+        return Type::kEmpty;
+      case SkRRect::kRect_Type:
+        return Type::kRect;
+      case SkRRect::kSimple_Type:
+      case SkRRect::kOval_Type: {
+        const SkVector radii = skrrect_.getSimpleRadii();
+        if (radii.x() == radii.y()) {
+          return Type::kSingle;
+        }
+        return skrrect_.isOval() ? Type::kOval : Type::kSimple;
+      }
+      case SkRRect::kNinePatch_Type:
+      case SkRRect::kComplex_Type:
+      default:
+        return Type::kComplex;
+    }
+  }
 
   bool IsEmpty() const { return GetType() == Type::kEmpty; }
   bool HasRoundedCorners() const {
@@ -136,10 +159,35 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) RRectF {
     SetCornerRadii(corner, radii.x(), radii.y());
   }
 
+  // Returns true if |point| is inside the bounds and corner radii of this
+  // RRectF, edges included, and if this RRectF is not empty.
+  bool Contains(const PointF& point) const {
+    const SkRect& bounds = skrrect_.rect();
+    if (skrrect_.isEmpty() ||
+        !(point.x() >= bounds.fLeft && point.x() <= bounds.fRight &&
+          point.y() >= bounds.fTop && point.y() <= bounds.fBottom)) {
+      return false;
+    }
+    return skrrect_.isRect() ||
+           CornersContain(Float4{point.x(), point.x(), point.x(), point.x()},
+                          Float4{point.y(), point.y(), point.y(), point.y()});
+  }
   // Returns true if |rect| is inside the bounds and corner radii of this
-  // RRectF, and if both this RRectF and rect are not empty.
+  // RRectF, and if both this RRectF and rect are not empty. This is the same as
+  // SkRRect::contains().
   bool Contains(const RectF& rect) const {
-    return skrrect_.contains(gfx::RectFToSkRect(rect));
+    const SkRect sk_rect = gfx::RectFToSkRect(rect);
+    if (!skrrect_.rect().contains(sk_rect)) {
+      return false;
+    }
+    // Each corner of |rect| is tested against the corner of the same lane. It
+    // can only be beyond the center of another corner if a corner of |rect|
+    // nearer to that one is too, and that one would be outside if it was.
+    return skrrect_.isRect() ||
+           CornersContain(Float4{sk_rect.fLeft, sk_rect.fRight, sk_rect.fRight,
+                                 sk_rect.fLeft},
+                          Float4{sk_rect.fTop, sk_rect.fTop, sk_rect.fBottom,
+                                 sk_rect.fBottom});
   }
 
   // Returns the bounding box that contains the specified rounded corner.
@@ -179,6 +227,38 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) RRectF {
                                                float error = 0.001f);
 
  private:
+  // Returns whether each point, with its coordinates in the lanes of |x| and
+  // |y| ordered like Corner, is in the ellipse of the corner of its lane if
+  // it's beyond the center of that ellipse in both directions.
+  ALWAYS_INLINE bool CornersContain(Float4 x, Float4 y) const {
+    const SkRect& bounds = skrrect_.rect();
+    const SkVector upper_left = skrrect_.radii(SkRRect::kUpperLeft_Corner);
+    const SkVector upper_right = skrrect_.radii(SkRRect::kUpperRight_Corner);
+    const SkVector lower_right = skrrect_.radii(SkRRect::kLowerRight_Corner);
+    const SkVector lower_left = skrrect_.radii(SkRRect::kLowerLeft_Corner);
+    const Float4 radius_x = {upper_left.fX, upper_right.fX, lower_right.fX,
+                             lower_left.fX};
+    const Float4 radius_y = {upper_left.fY, upper_right.fY, lower_right.fY,
+                             lower_left.fY};
+    // The directions from the centers of the ellipses to the corners.
+    const Float4 sign_x = {-1, 1, 1, -1};
+    const Float4 sign_y = {-1, -1, 1, 1};
+    const Float4 corner_x = {bounds.fLeft, bounds.fRight, bounds.fRight,
+                             bounds.fLeft};
+    const Float4 corner_y = {bounds.fTop, bounds.fTop, bounds.fBottom,
+                             bounds.fBottom};
+    const Float4 dx = (x - (corner_x - radius_x * sign_x)) * sign_x;
+    const Float4 dy = (y - (corner_y - radius_y * sign_y)) * sign_y;
+    // As in SkRRect, (dx, dy) is in the ellipse with radii (rx, ry) if
+    // dx^2 * ry^2 + dy^2 * rx^2 <= (rx * ry)^2.
+    const Float4 radii_product = radius_x * radius_y;
+    const FloatBoolean4 outside =
+        (dx > 0.f) & (dy > 0.f) &
+        ((dx * dx) * (radius_y * radius_y) + (dy * dy) * (radius_x * radius_x) >
+         radii_product * radii_product);
+    return AllTrue(outside == 0);
+  }
+
   void GetAllRadii(base::span<SkVector, 4> radii) const;
 
   gfx::RoundedCornersF GetRoundedCorners() const;
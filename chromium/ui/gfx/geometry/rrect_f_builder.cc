@@ -4,8 +4,26 @@
 
 #include "ui/gfx/geometry/rrect_f_builder.h"
 
+#include "base/check_op.h"
+#include "third_party/skia/include/core/SkRRect.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/skia_conversions.h"
+
 namespace gfx {
 
+namespace {
+
+// Whether the radii of |corners| are equal and positive, and don't need to be
+// scaled to fit in |rect|.
+bool HasEqualRadiiThatFit(const RectF& rect, const RoundedCornersF& corners) {
+  const float radius = corners.upper_left();
+  return radius > 0.f && corners.upper_right() == radius &&
+         corners.lower_right() == radius && corners.lower_left() == radius &&
+         radius + radius <= rect.width() && radius + radius <= rect.height();
+}
+
+}  // namespace
+
 RRectFBuilder::RRectFBuilder() = default;
 RRectFBuilder::RRectFBuilder(RRectFBuilder&& other) = default;
 
@@ -15,4 +33,32 @@ RRectF RRectFBuilder::Build() {
                 lower_left_x_, lower_left_y_);
 }
 
+// static
+void RRectFBuilder::BuildMany(base::span<const RectF> rects,
+                              base::span<const RoundedCornersF> corners,
+                              base::span<RRectF> output) {
+  CheckBatchSpans(rects, output);
+  CheckBatchSpans(corners, output);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    const RectF& rect = rects[i];
+    const RoundedCornersF& radii = corners[i];
+    if (rect.IsEmpty()) {
+      output[i] = RRectF();
+      continue;
+    }
+    SkRRect rrect;
+    if (radii.IsEmpty()) {
+      rrect.setRect(RectFToSkRect(rect));
+    } else if (HasEqualRadiiThatFit(rect, radii)) {
+      // The same as setRectRadii(), without checking each corner.
+      rrect.setRectXY(RectFToSkRect(rect), radii.upper_left(),
+                      radii.upper_left());
+    } else {
+      output[i] = RRectF(rect, radii);
+      continue;
+    }
+    output[i] = RRectF(rrect);
+  }
+}
+
 }  // namespace gfx
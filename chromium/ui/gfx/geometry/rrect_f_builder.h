@@ -6,6 +6,7 @@
 #define UI_GFX_GEOMETRY_RRECT_F_BUILDER_H_
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/rrect_f.h"
 
 namespace gfx {
@@ -111,6 +112,15 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) RRectFBuilder {
 
   RRectF Build();
 
+  // Sets each of |output| to RRectF(rect, corners) of the rect and corners at
+  // the same index of |rects| and |corners|, which must have the same size.
+  // Skia's radii normalization is skipped for the rects without radii and
+  // those with equal radii that fit, which compositor rounded quads usually
+  // have.
+  static void BuildMany(base::span<const RectF> rects,
+                        base::span<const RoundedCornersF> corners,
+                        base::span<RRectF> output);
+
  private:
   float x_ = 0.f;
   float y_ = 0.f;
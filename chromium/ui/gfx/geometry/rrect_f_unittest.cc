@@ -5,8 +5,10 @@
 #include "ui/gfx/geometry/rrect_f.h"
 
 #include <algorithm>
+#include <iterator>
 
 #include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/rounded_corners_f.h"
 #include "ui/gfx/geometry/rrect_f_builder.h"
@@ -213,6 +215,43 @@ TEST(RRectFTest, Contains) {
   EXPECT_FALSE(a.Contains(b));
 }
 
+TEST(RRectFTest, ContainsPoint) {
+  // Corners with radii of 10x20, 20x10, 30x30 and 5x5.
+  RRectF a(0, 0, 100, 100, 10, 20, 20, 10, 30, 30, 5, 5);
+  EXPECT_TRUE(a.Contains(PointF(50, 50)));
+  EXPECT_TRUE(a.Contains(PointF(50, 0)));
+  EXPECT_TRUE(a.Contains(PointF(0, 50)));
+  EXPECT_TRUE(a.Contains(PointF(100, 50)));
+  EXPECT_FALSE(a.Contains(PointF(100.5f, 50)));
+  EXPECT_FALSE(a.Contains(PointF(50, -0.5f)));
+
+  EXPECT_FALSE(a.Contains(PointF(0, 0)));
+  EXPECT_FALSE(a.Contains(PointF(2, 2)));
+  EXPECT_TRUE(a.Contains(PointF(5, 5)));
+  EXPECT_FALSE(a.Contains(PointF(99, 1)));
+  EXPECT_TRUE(a.Contains(PointF(90, 5)));
+  EXPECT_FALSE(a.Contains(PointF(95, 95)));
+  EXPECT_TRUE(a.Contains(PointF(85, 85)));
+  EXPECT_FALSE(a.Contains(PointF(0.5f, 99.5f)));
+  EXPECT_TRUE(a.Contains(PointF(2, 98)));
+
+  RRectF rect(0, 0, 10, 10, 0);
+  EXPECT_TRUE(rect.Contains(PointF(0, 0)));
+  EXPECT_TRUE(rect.Contains(PointF(10, 10)));
+  EXPECT_FALSE(RRectF().Contains(PointF()));
+}
+
+TEST(RRectFTest, ContainsRectInCorners) {
+  RRectF a(0, 0, 100, 100, 10, 20, 20, 10, 30, 30, 5, 5);
+  EXPECT_TRUE(a.Contains(RectF(10, 10, 80, 80)));
+  EXPECT_FALSE(a.Contains(RectF(1, 10, 50, 50)));
+  EXPECT_FALSE(a.Contains(RectF(50, 50, 45, 45)));
+  // All of the rect is beyond the center of the upper-left corner.
+  EXPECT_TRUE(a.Contains(RectF(5, 5, 1, 1)));
+  EXPECT_FALSE(a.Contains(RectF(1, 1, 1, 1)));
+  EXPECT_FALSE(a.Contains(RectF(50, 50, 0, 0)));
+}
+
 TEST(RRectFTest, HasRoundedCorners) {
   RRectF a;
   EXPECT_FALSE(a.HasRoundedCorners());
@@ -432,4 +471,29 @@ TEST(RRectFTest, BuildFromRadiusAndCorners) {
   EXPECT_EQ(a, b);
 }
 
+TEST(RRectFTest, BuildMany) {
+  const RectF rects[] = {RectF(),
+                         RectF(40, 50, 60, 70),
+                         RectF(40, 50, 60, 70),
+                         RectF(40, 50, 60, 70),
+                         RectF(40, 50, 60, 70),
+                         RectF(0, 0, 20, 10)};
+  // The last two need their radii scaled.
+  const RoundedCornersF corners[] = {RoundedCornersF(5),
+                                     RoundedCornersF(),
+                                     RoundedCornersF(15),
+                                     RoundedCornersF(1.5f, 2.5f, 3.5f, 4.5f),
+                                     RoundedCornersF(40),
+                                     RoundedCornersF(8)};
+  RRectF output[std::size(rects)];
+  RRectFBuilder::BuildMany(rects, corners, output);
+  for (size_t i = 0; i < std::size(rects); ++i) {
+    EXPECT_EQ(RRectF(rects[i], corners[i]), output[i]) << i;
+  }
+  EXPECT_EQ(RRectF::Type::kEmpty, output[0].GetType());
+  EXPECT_EQ(RRectF::Type::kRect, output[1].GetType());
+  EXPECT_EQ(RRectF::Type::kSingle, output[2].GetType());
+  EXPECT_EQ(RRectF::Type::kComplex, output[3].GetType());
+}
+
 }  // namespace gfx
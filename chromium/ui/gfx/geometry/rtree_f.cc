@@ -0,0 +1,298 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/rtree_f.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <utility>
+
+#include "base/check_op.h"
+#include "base/numerics/safe_conversions.h"
+#include "ui/gfx/geometry/point_f.h"
+
+namespace gfx {
+
+namespace {
+
+constexpr uint32_t kNoParent = std::numeric_limits<uint32_t>::max();
+
+bool HasNaNOrigin(const RectF& rect) {
+  return std::isnan(rect.x()) || std::isnan(rect.y());
+}
+
+// The sort key of a center coordinate. NaN, e.g. of a rect with a NaN origin,
+// sorts after every number, so that the keys are strictly weakly ordered.
+float SortKey(float center) {
+  return std::isnan(center) ? std::numeric_limits<float>::infinity() : center;
+}
+
+// Sorts |items| in Sort-Tile-Recursive order: into vertical slices by the x
+// of their centers, and each slice by the y of their centers, so that each
+// run of kMaxChildren items is compact. Returns the starts of the runs,
+// followed by the size of |items|.
+template <typename T, typename GetRect>
+std::vector<uint32_t> SortTileRecursive(std::vector<T>& items,
+                                        GetRect get_rect) {
+  constexpr size_t kMaxChildren = RTreeF::kMaxChildren;
+  const auto center_x = [&get_rect](const T& item) {
+    return SortKey(get_rect(item).CenterPoint().x());
+  };
+  const auto center_y = [&get_rect](const T& item) {
+    return SortKey(get_rect(item).CenterPoint().y());
+  };
+
+  const size_t num_groups = (items.size() + kMaxChildren - 1) / kMaxChildren;
+  const size_t num_slices = static_cast<size_t>(
+      std::ceil(std::sqrt(static_cast<double>(num_groups))));
+  const size_t slice_size = num_slices * kMaxChildren;
+
+  std::ranges::sort(items, {}, center_x);
+  std::vector<uint32_t> starts;
+  starts.reserve(num_groups + 1);
+  for (size_t slice = 0; slice < items.size(); slice += slice_size) {
+    const size_t slice_end = std::min(items.size(), slice + slice_size);
+    std::ranges::sort(items.begin() + slice, items.begin() + slice_end, {},
+                      center_y);
+    for (size_t start = slice; start < slice_end; start += kMaxChildren) {
+      starts.push_back(base::checked_cast<uint32_t>(start));
+    }
+  }
+  starts.push_back(base::checked_cast<uint32_t>(items.size()));
+  return starts;
+}
+
+}  // namespace
+
+RTreeF::RTreeF() = default;
+
+RTreeF::RTreeF(const std::vector<RectF>& rects) {
+  std::vector<Entry> entries;
+  entries.reserve(rects.size());
+  for (size_t i = 0; i < rects.size(); ++i) {
+    entries.push_back({rects[i], base::checked_cast<uint32_t>(i), 0});
+  }
+  Build(std::move(entries));
+}
+
+RTreeF::RTreeF(const RTreeF& other) = default;
+RTreeF::RTreeF(RTreeF&& other) = default;
+RTreeF::~RTreeF() = default;
+
+RTreeF& RTreeF::operator=(const RTreeF& other) = default;
+RTreeF& RTreeF::operator=(RTreeF&& other) = default;
+
+RectF RTreeF::GetBounds() const {
+  return nodes_.empty() ? RectF() : nodes_.back().bounds;
+}
+
+std::vector<size_t> RTreeF::SearchContaining(const PointF& point) const {
+  std::vector<size_t> results;
+  if (nodes_.empty()) {
+    return results;
+  }
+  std::vector<uint32_t> stack = {static_cast<uint32_t>(nodes_.size() - 1)};
+  while (!stack.empty()) {
+    const uint32_t node_index = stack.back();
+    stack.pop_back();
+    const Node& node = nodes_[node_index];
+    if (!node.bounds.Contains(point)) {
+      continue;
+    }
+    if (!IsLeaf(node_index)) {
+      for (uint32_t child = node.begin; child < node.end; ++child) {
+        stack.push_back(child);
+      }
+      continue;
+    }
+    for (uint32_t i = node.begin; i < node.end; ++i) {
+      if (entries_[i].rect.Contains(point)) {
+        results.push_back(entries_[i].index);
+      }
+    }
+  }
+  return results;
+}
+
+std::vector<size_t> RTreeF::SearchIntersecting(const RectF& rect) const {
+  std::vector<size_t> results;
+  if (nodes_.empty()) {
+    return results;
+  }
+  std::vector<uint32_t> stack = {static_cast<uint32_t>(nodes_.size() - 1)};
+  while (!stack.empty()) {
+    const uint32_t node_index = stack.back();
+    stack.pop_back();
+    const Node& node = nodes_[node_index];
+    if (!node.bounds.Intersects(rect)) {
+      continue;
+    }
+    if (!IsLeaf(node_index)) {
+      for (uint32_t child = node.begin; child < node.end; ++child) {
+        stack.push_back(child);
+      }
+      continue;
+    }
+    for (uint32_t i = node.begin; i < node.end; ++i) {
+      if (entries_[i].rect.Intersects(rect)) {
+        results.push_back(entries_[i].index);
+      }
+    }
+  }
+  return results;
+}
+
+std::optional<size_t> RTreeF::FindNearest(const PointF& point) const {
+  if (nodes_.empty()) {
+    return std::nullopt;
+  }
+  // Visits the nodes in order of their distance, which is at most that of
+  // any of their rects, until the nearest node is farther than the nearest
+  // rect found.
+  using QueueEntry = std::pair<float, uint32_t>;
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>>
+      queue;
+  const uint32_t root = static_cast<uint32_t>(nodes_.size() - 1);
+  queue.emplace(nodes_[root].bounds.ManhattanDistanceToPoint(point), root);
+  float best_distance = std::numeric_limits<float>::infinity();
+  std::optional<size_t> best_index;
+  while (!queue.empty()) {
+    const auto [distance, node_index] = queue.top();
+    queue.pop();
+    if (distance > best_distance) {
+      break;
+    }
+    const Node& node = nodes_[node_index];
+    if (!IsLeaf(node_index)) {
+      for (uint32_t child = node.begin; child < node.end; ++child) {
+        float child_distance =
+            nodes_[child].bounds.ManhattanDistanceToPoint(point);
+        if (child_distance <= best_distance) {
+          queue.emplace(child_distance, child);
+        }
+      }
+      continue;
+    }
+    for (uint32_t i = node.begin; i < node.end; ++i) {
+      const Entry& entry = entries_[i];
+      // Its distance would be 0, as the comparisons with NaN are false.
+      if (HasNaNOrigin(entry.rect)) {
+        continue;
+      }
+      float entry_distance = entry.rect.ManhattanDistanceToPoint(point);
+      if (!best_index || entry_distance < best_distance ||
+          (entry_distance == best_distance && entry.index < *best_index)) {
+        best_distance = entry_distance;
+        best_index = entry.index;
+      }
+    }
+  }
+  return best_index;
+}
+
+void RTreeF::Update(size_t index, const RectF& rect) {
+  DCHECK_LT(index, size());
+  Entry& entry = entries_[positions_[index]];
+  entry.rect = rect;
+  for (uint32_t node = entry.leaf; node != kNoParent;
+       node = nodes_[node].parent) {
+    RectF bounds =
+        ComputeBounds(nodes_[node].begin, nodes_[node].end, IsLeaf(node));
+    if (bounds == nodes_[node].bounds) {
+      break;
+    }
+    nodes_[node].bounds = bounds;
+  }
+}
+
+void RTreeF::Rebuild() {
+  std::vector<Entry> entries = std::move(entries_);
+  Build(std::move(entries));
+}
+
+void RTreeF::Build(std::vector<Entry> entries) {
+  entries_ = std::move(entries);
+  nodes_.clear();
+  num_leaves_ = 0;
+  positions_.assign(entries_.size(), 0);
+  if (entries_.empty()) {
+    return;
+  }
+
+  std::vector<uint32_t> starts =
+      SortTileRecursive(entries_, [](const Entry& entry) -> const RectF& {
+        return entry.rect;
+      });
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    positions_[entries_[i].index] = base::checked_cast<uint32_t>(i);
+  }
+  std::vector<Node> level;
+  for (size_t i = 0; i + 1 < starts.size(); ++i) {
+    level.push_back({ComputeBounds(starts[i], starts[i + 1], /*is_leaf=*/true),
+                     starts[i], starts[i + 1], kNoParent});
+  }
+  num_leaves_ = base::checked_cast<uint32_t>(level.size());
+
+  // Each level is sorted before it's placed in nodes_, after the levels
+  // below, and then grouped into the level above.
+  bool is_leaf_level = true;
+  while (true) {
+    if (level.size() > 1) {
+      starts = SortTileRecursive(
+          level, [](const Node& node) -> const RectF& { return node.bounds; });
+    }
+    const uint32_t level_begin = base::checked_cast<uint32_t>(nodes_.size());
+    for (uint32_t i = 0; i < level.size(); ++i) {
+      const Node& node = level[i];
+      for (uint32_t child = node.begin; child < node.end; ++child) {
+        if (is_leaf_level) {
+          entries_[child].leaf = level_begin + i;
+        } else {
+          nodes_[child].parent = level_begin + i;
+        }
+      }
+      nodes_.push_back(node);
+    }
+    if (level.size() == 1) {
+      break;
+    }
+
+    std::vector<Node> parents;
+    for (size_t i = 0; i + 1 < starts.size(); ++i) {
+      const uint32_t begin = level_begin + starts[i];
+      const uint32_t end = level_begin + starts[i + 1];
+      parents.push_back({ComputeBounds(begin, end, /*is_leaf=*/false), begin,
+                         end, kNoParent});
+    }
+    level = std::move(parents);
+    is_leaf_level = false;
+  }
+}
+
+RectF RTreeF::ComputeBounds(uint32_t begin,
+                            uint32_t end,
+                            bool is_leaf) const {
+  DCHECK_LT(begin, end);
+  std::optional<RectF> bounds;
+  for (uint32_t i = begin; i < end; ++i) {
+    const RectF& rect = is_leaf ? entries_[i].rect : nodes_[i].bounds;
+    // Rects with a NaN origin would make the bounds NaN.
+    if (HasNaNOrigin(rect)) {
+      continue;
+    }
+    if (bounds) {
+      bounds->UnionEvenIfEmpty(rect);
+    } else {
+      bounds = rect;
+    }
+  }
+  return bounds.value_or(is_leaf ? entries_[begin].rect
+                                 : nodes_[begin].bounds);
+}
+
+}  // namespace gfx
@@ -0,0 +1,106 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_RTREE_F_H_
+#define UI_GFX_GEOMETRY_RTREE_F_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <optional>
+#include <vector>
+
+#include "base/component_export.h"
+#include "ui/gfx/geometry/rect_f.h"
+
+namespace gfx {
+
+class PointF;
+
+// A static R-tree over a collection of rects, for point, overlap and
+// nearest-rect queries that would otherwise be linear scans. It's bulk
+// loaded with the Sort-Tile-Recursive algorithm, and its nodes and rects are
+// stored in flat arrays in tree order. Rects can be moved with Update(), which
+// only refits the bounds of their ancestors, so the tree gets slower to query
+// as rects move far; Rebuild() reloads it from the current rects.
+//
+// Queries return the indices of the rects in the vector given to the
+// constructor, and use the same semantics as the RectF methods named in their
+// comments, including those for empty rects. Rects with a NaN origin contain
+// and intersect nothing, are never the nearest, and are left out of the
+// bounds.
+class COMPONENT_EXPORT(GEOMETRY) RTreeF {
+ public:
+  // The maximum number of children of each node.
+  static constexpr size_t kMaxChildren = 8;
+
+  RTreeF();
+  explicit RTreeF(const std::vector<RectF>& rects);
+  RTreeF(const RTreeF& other);
+  RTreeF(RTreeF&& other);
+  ~RTreeF();
+
+  RTreeF& operator=(const RTreeF& other);
+  RTreeF& operator=(RTreeF&& other);
+
+  size_t size() const { return entries_.size(); }
+  bool empty() const { return entries_.empty(); }
+  const RectF& rect(size_t index) const {
+    return entries_[positions_[index]].rect;
+  }
+  // Returns the bounds of all the rects, as with UnionEvenIfEmpty(), or a rect
+  // with a NaN origin if they all have one.
+  RectF GetBounds() const;
+
+  // Returns the indices of the rects for which RectF::Contains(point) is true,
+  // in no particular order.
+  std::vector<size_t> SearchContaining(const PointF& point) const;
+  // Returns the indices of the rects for which RectF::Intersects(rect) is
+  // true, in no particular order.
+  std::vector<size_t> SearchIntersecting(const RectF& rect) const;
+  // Returns the index of the rect with the smallest
+  // RectF::ManhattanDistanceToPoint(point), the smallest index among equally
+  // near rects, or nullopt if the tree is empty.
+  std::optional<size_t> FindNearest(const PointF& point) const;
+
+  // Replaces the rect with |index|, and refits the bounds of its ancestors.
+  void Update(size_t index, const RectF& rect);
+  // Rebuilds the tree from the current rects.
+  void Rebuild();
+
+ private:
+  struct Entry {
+    RectF rect;
+    uint32_t index;
+    // The leaf node containing the entry.
+    uint32_t leaf;
+  };
+
+  // Leaves cover the entries from |begin| to |end|, and other nodes cover the
+  // nodes from |begin| to |end|.
+  struct Node {
+    RectF bounds;
+    uint32_t begin;
+    uint32_t end;
+    uint32_t parent;
+  };
+
+  void Build(std::vector<Entry> entries);
+  bool IsLeaf(uint32_t node) const { return node < num_leaves_; }
+  // Returns the union of the rects of the entries (if |is_leaf|) or nodes
+  // from |begin| to |end|.
+  RectF ComputeBounds(uint32_t begin, uint32_t end, bool is_leaf) const;
+
+  // Entries in tree order.
+  std::vector<Entry> entries_;
+  // The position in entries_ of each index.
+  std::vector<uint32_t> positions_;
+  // The leaves come first, and then each level up to the root, which is last.
+  std::vector<Node> nodes_;
+  uint32_t num_leaves_ = 0;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_RTREE_F_H_
@@ -0,0 +1,164 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/rtree_f.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/test/geometry_util.h"
+
+namespace gfx {
+
+namespace {
+
+class RTreeFTest : public testing::Test {
+ protected:
+  float RandomFloat(float max) {
+    seed_ = seed_ * 1103515245 + 12345;
+    return (seed_ >> 8) % 0x10000 / static_cast<float>(0x10000) * max;
+  }
+
+  RectF RandomRect() {
+    // Some rects are empty.
+    return RectF(RandomFloat(1000), RandomFloat(1000),
+                 std::max(0.f, RandomFloat(60) - 5),
+                 std::max(0.f, RandomFloat(60) - 5));
+  }
+
+  std::vector<RectF> RandomRects(size_t count) {
+    std::vector<RectF> rects;
+    for (size_t i = 0; i < count; ++i) {
+      rects.push_back(RandomRect());
+    }
+    return rects;
+  }
+
+  // Checks the queries of |tree| against linear scans of |rects|.
+  void ExpectMatchesLinearScan(const RTreeF& tree,
+                               const std::vector<RectF>& rects) {
+    ASSERT_EQ(rects.size(), tree.size());
+    for (int i = 0; i < 50; ++i) {
+      PointF point(RandomFloat(1100) - 50, RandomFloat(1100) - 50);
+      RectF query(point, SizeF(RandomFloat(100), RandomFloat(100)));
+
+      std::vector<size_t> containing;
+      std::vector<size_t> intersecting;
+      std::optional<size_t> nearest;
+      for (size_t j = 0; j < rects.size(); ++j) {
+        if (rects[j].Contains(point)) {
+          containing.push_back(j);
+        }
+        if (rects[j].Intersects(query)) {
+          intersecting.push_back(j);
+        }
+        // Rects with a NaN origin contain, intersect and are nearest to
+        // nothing.
+        if (std::isnan(rects[j].x()) || std::isnan(rects[j].y())) {
+          continue;
+        }
+        if (!nearest || rects[j].ManhattanDistanceToPoint(point) <
+                            rects[*nearest].ManhattanDistanceToPoint(point)) {
+          nearest = j;
+        }
+      }
+
+      std::vector<size_t> results = tree.SearchContaining(point);
+      std::ranges::sort(results);
+      EXPECT_EQ(containing, results);
+      results = tree.SearchIntersecting(query);
+      std::ranges::sort(results);
+      EXPECT_EQ(intersecting, results);
+      EXPECT_EQ(nearest, tree.FindNearest(point));
+    }
+  }
+
+ private:
+  uint32_t seed_ = 1;
+};
+
+TEST_F(RTreeFTest, Empty) {
+  RTreeF tree;
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(RectF(), tree.GetBounds());
+  EXPECT_TRUE(tree.SearchContaining(PointF()).empty());
+  EXPECT_TRUE(tree.SearchIntersecting(RectF(0, 0, 10, 10)).empty());
+  EXPECT_EQ(std::nullopt, tree.FindNearest(PointF()));
+}
+
+TEST_F(RTreeFTest, Small) {
+  RTreeF tree({RectF(0, 0, 10, 10), RectF(5, 5, 10, 10), RectF(20, 0, 0, 5)});
+  EXPECT_EQ(3u, tree.size());
+  EXPECT_RECTF_EQ(RectF(0, 0, 20, 15), tree.GetBounds());
+  EXPECT_EQ(RectF(5, 5, 10, 10), tree.rect(1));
+
+  std::vector<size_t> results = tree.SearchContaining(PointF(7, 7));
+  std::ranges::sort(results);
+  EXPECT_EQ((std::vector<size_t>{0, 1}), results);
+  // Right and bottom edges are outside, and empty rects contain nothing.
+  EXPECT_TRUE(tree.SearchContaining(PointF(15, 10)).empty());
+  EXPECT_TRUE(tree.SearchContaining(PointF(20, 1)).empty());
+  EXPECT_EQ((std::vector<size_t>{1}),
+            tree.SearchIntersecting(RectF(12, 12, 1, 1)));
+  EXPECT_TRUE(tree.SearchIntersecting(RectF(19, 0, 5, 5)).empty());
+
+  // Empty rects still have a distance.
+  EXPECT_EQ(2u, tree.FindNearest(PointF(21, 2)));
+  // Ties go to the smallest index.
+  EXPECT_EQ(0u, tree.FindNearest(PointF(7, 7)));
+}
+
+TEST_F(RTreeFTest, MatchesLinearScan) {
+  for (size_t count : {1u, 7u, 8u, 9u, 64u, 65u, 1000u}) {
+    SCOPED_TRACE(count);
+    std::vector<RectF> rects = RandomRects(count);
+    RTreeF tree(rects);
+    ExpectMatchesLinearScan(tree, rects);
+  }
+}
+
+TEST_F(RTreeFTest, UpdateAndRebuild) {
+  std::vector<RectF> rects = RandomRects(500);
+  RTreeF tree(rects);
+  for (size_t i = 0; i < rects.size(); i += 3) {
+    rects[i] = RandomRect();
+    tree.Update(i, rects[i]);
+    EXPECT_EQ(rects[i], tree.rect(i));
+  }
+  ExpectMatchesLinearScan(tree, rects);
+
+  // Moving a rect out grows the bounds, and moving it back shrinks them.
+  RectF bounds = tree.GetBounds();
+  tree.Update(7, RectF(2000, 2000, 10, 10));
+  EXPECT_TRUE(tree.GetBounds().Contains(RectF(2000, 2000, 10, 10)));
+  tree.Update(7, rects[7]);
+  EXPECT_RECTF_EQ(bounds, tree.GetBounds());
+
+  tree.Rebuild();
+  ExpectMatchesLinearScan(tree, rects);
+}
+
+TEST_F(RTreeFTest, NaNOrigins) {
+  // Rects with a NaN origin have NaN centers, which sort after the others.
+  // They contain and intersect nothing, and aren't the nearest.
+  constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+  std::vector<RectF> rects = RandomRects(300);
+  for (size_t i = 1; i < rects.size(); i += 7) {
+    rects[i].set_x(kNaN);
+  }
+  for (size_t i = 3; i < rects.size(); i += 11) {
+    rects[i].set_y(kNaN);
+  }
+  RTreeF tree(rects);
+  ExpectMatchesLinearScan(tree, rects);
+}
+
+}  // namespace
+
+}  // namespace gfx
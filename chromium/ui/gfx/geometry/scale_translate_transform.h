@@ -0,0 +1,178 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_SCALE_TRANSLATE_TRANSFORM_H_
+#define UI_GFX_GEOMETRY_SCALE_TRANSLATE_TRANSFORM_H_
+
+#include <algorithm>
+
+#include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/clamp_float_geometry.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/vector2d_f.h"
+
+namespace gfx {
+
+// Value types for code that knows at compile time that it only deals with 2d
+// translations, or 2d scales and translations. Unlike Transform, they don't
+// branch on the kind of the matrix, and they are 8 and 16 bytes instead of
+// 136. They convert implicitly and losslessly into Transform, so callers can
+// use them up to the point where a general Transform is needed.
+//
+// All operations give the same results as the corresponding Transform
+// operations on the converted transforms, including ClampFloatGeometry().
+
+// Maps p to p + translation.
+class TranslateTransform {
+ public:
+  constexpr TranslateTransform() = default;
+  constexpr TranslateTransform(float tx, float ty) : tx_(tx), ty_(ty) {}
+  constexpr explicit TranslateTransform(const Vector2dF& translation)
+      : TranslateTransform(translation.x(), translation.y()) {}
+
+  constexpr Vector2dF translation() const { return Vector2dF(tx_, ty_); }
+
+  constexpr bool IsIdentity() const { return tx_ == 0 && ty_ == 0; }
+
+  // this = this * other.
+  constexpr void PreConcat(const TranslateTransform& other) {
+    tx_ += other.tx_;
+    ty_ += other.ty_;
+  }
+  // this = other * this.
+  constexpr void PostConcat(const TranslateTransform& other) {
+    PreConcat(other);
+  }
+
+  constexpr PointF MapPoint(const PointF& p) const {
+    return PointF(ClampFloatGeometry(p.x() + tx_),
+                  ClampFloatGeometry(p.y() + ty_));
+  }
+  constexpr RectF MapRect(const RectF& r) const {
+    if (IsIdentity()) {
+      return r;
+    }
+    return RectF(MapPoint(r.origin()),
+                 SizeF(ClampFloatGeometry(r.width()),
+                       ClampFloatGeometry(r.height())));
+  }
+
+  constexpr operator Transform() const {
+    return Transform::MakeTranslation(tx_, ty_);
+  }
+
+  friend constexpr bool operator==(const TranslateTransform&,
+                                   const TranslateTransform&) = default;
+
+ private:
+  float tx_ = 0;
+  float ty_ = 0;
+};
+
+// Maps p to p * scale + translation.
+class ScaleTranslateTransform {
+ public:
+  constexpr ScaleTranslateTransform() = default;
+  constexpr ScaleTranslateTransform(float sx, float sy, float tx, float ty)
+      : sx_(sx), sy_(sy), tx_(tx), ty_(ty) {}
+  constexpr explicit ScaleTranslateTransform(const AxisTransform2d& axis_2d)
+      : ScaleTranslateTransform(axis_2d.scale().x(),
+                                axis_2d.scale().y(),
+                                axis_2d.translation().x(),
+                                axis_2d.translation().y()) {}
+  // NOLINTNEXTLINE(google-explicit-constructor)
+  constexpr ScaleTranslateTransform(const TranslateTransform& translate)
+      : ScaleTranslateTransform(1,
+                                1,
+                                translate.translation().x(),
+                                translate.translation().y()) {}
+
+  constexpr Vector2dF scale() const { return Vector2dF(sx_, sy_); }
+  constexpr Vector2dF translation() const { return Vector2dF(tx_, ty_); }
+
+  constexpr bool IsIdentity() const {
+    return sx_ == 1 && sy_ == 1 && tx_ == 0 && ty_ == 0;
+  }
+
+  // this = this * other. Same as AxisTransform2d::PreConcat().
+  constexpr void PreConcat(const ScaleTranslateTransform& other) {
+    tx_ += other.tx_ * sx_;
+    ty_ += other.ty_ * sy_;
+    sx_ *= other.sx_;
+    sy_ *= other.sy_;
+  }
+  // this = other * this. Same as AxisTransform2d::PostConcat().
+  constexpr void PostConcat(const ScaleTranslateTransform& other) {
+    sx_ *= other.sx_;
+    sy_ *= other.sy_;
+    tx_ = tx_ * other.sx_ + other.tx_;
+    ty_ = ty_ * other.sy_ + other.ty_;
+  }
+
+  constexpr PointF MapPoint(const PointF& p) const {
+    return PointF(MapX(p.x()), MapY(p.y()));
+  }
+  constexpr RectF MapRect(const RectF& r) const {
+    if (IsIdentity()) {
+      return r;
+    }
+    if (sx_ >= 0 && sy_ >= 0) {
+      return RectF(MapX(r.x()), MapY(r.y()),
+                   ClampFloatGeometry(r.width() * sx_),
+                   ClampFloatGeometry(r.height() * sy_));
+    }
+    // Same as the bounding box of the four mapped corners.
+    float x1 = MapX(r.x());
+    float x2 = MapX(r.right());
+    float y1 = MapY(r.y());
+    float y2 = MapY(r.bottom());
+    float left = std::min(x1, x2);
+    float top = std::min(y1, y2);
+    return RectF(left, top, std::max(x1, x2) - left, std::max(y1, y2) - top);
+  }
+
+  constexpr AxisTransform2d ToAxisTransform2d() const {
+    return AxisTransform2d::FromScaleAndTranslation(scale(), translation());
+  }
+  constexpr operator Transform() const {
+    return Transform(ToAxisTransform2d());
+  }
+
+  friend constexpr bool operator==(const ScaleTranslateTransform&,
+                                   const ScaleTranslateTransform&) = default;
+
+ private:
+  constexpr float MapX(float x) const {
+    return ClampFloatGeometry(x * sx_ + tx_);
+  }
+  constexpr float MapY(float y) const {
+    return ClampFloatGeometry(y * sy_ + ty_);
+  }
+
+  float sx_ = 1;
+  float sy_ = 1;
+  float tx_ = 0;
+  float ty_ = 0;
+};
+
+// Returns lhs * rhs.
+constexpr TranslateTransform operator*(const TranslateTransform& lhs,
+                                       const TranslateTransform& rhs) {
+  TranslateTransform result = lhs;
+  result.PreConcat(rhs);
+  return result;
+}
+constexpr ScaleTranslateTransform operator*(
+    const ScaleTranslateTransform& lhs,
+    const ScaleTranslateTransform& rhs) {
+  ScaleTranslateTransform result = lhs;
+  result.PreConcat(rhs);
+  return result;
+}
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_SCALE_TRANSLATE_TRANSFORM_H_
@@ -0,0 +1,80 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/scale_translate_transform.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/test/geometry_util.h"
+
+namespace gfx {
+
+namespace {
+
+static_assert(sizeof(TranslateTransform) == 8);
+static_assert(sizeof(ScaleTranslateTransform) == 16);
+
+constexpr ScaleTranslateTransform kComposed =
+    ScaleTranslateTransform(2, 3, 10, 20) * TranslateTransform(1, 2);
+static_assert(kComposed == ScaleTranslateTransform(2, 3, 12, 26));
+static_assert(kComposed.MapPoint(PointF(1, 1)) == PointF(14, 29));
+static_assert((TranslateTransform(1, 2) * TranslateTransform(3, 4))
+                  .MapRect(RectF(1, 1, 5, 6)) == RectF(5, 7, 5, 6));
+
+TEST(ScaleTranslateTransformTest, MatchesTransform) {
+  const RectF rects[] = {RectF(1.25f, 2.5f, 30, 40), RectF(-5, -6, 0, 7),
+                         RectF(1e30f, -1e30f, 1e30f, 1e30f)};
+  const PointF points[] = {PointF(1.25f, -2.5f), PointF(3e38f, -3e38f)};
+
+  for (const ScaleTranslateTransform& transform :
+       {ScaleTranslateTransform(), ScaleTranslateTransform(1, 1, 10, -20),
+        ScaleTranslateTransform(2.5f, 0.5f, -3, 4),
+        ScaleTranslateTransform(-2, 3, 5, 6),
+        ScaleTranslateTransform(2, -3, 5, 6),
+        ScaleTranslateTransform(0, 0, 1, 1)}) {
+    Transform converted = transform;
+    SCOPED_TRACE(converted.ToString());
+    EXPECT_FALSE(converted.IsFullMatrixForTesting());
+    EXPECT_EQ(transform.IsIdentity(), converted.IsIdentity());
+    for (const RectF& rect : rects) {
+      EXPECT_EQ(converted.MapRect(rect), transform.MapRect(rect));
+    }
+    for (const PointF& point : points) {
+      EXPECT_EQ(converted.MapPoint(point), transform.MapPoint(point));
+    }
+
+    ScaleTranslateTransform other(3, -0.25f, 7, 8);
+    Transform pre = converted;
+    pre.PreConcat(other);
+    EXPECT_EQ(pre, transform * other);
+    Transform post = converted;
+    post.PostConcat(other);
+    ScaleTranslateTransform post_concat = transform;
+    post_concat.PostConcat(other);
+    EXPECT_EQ(post, post_concat);
+  }
+}
+
+TEST(ScaleTranslateTransformTest, TranslateMatchesTransform) {
+  const RectF rects[] = {RectF(1.25f, 2.5f, 30, 40),
+                         RectF(1e30f, -1e30f, 3e38f, 1e30f)};
+  for (const TranslateTransform& transform :
+       {TranslateTransform(), TranslateTransform(10, -20.5f),
+        TranslateTransform(3e38f, 0)}) {
+    Transform converted = transform;
+    SCOPED_TRACE(converted.ToString());
+    EXPECT_EQ(Transform(ScaleTranslateTransform(transform)), converted);
+    for (const RectF& rect : rects) {
+      EXPECT_EQ(converted.MapRect(rect), transform.MapRect(rect));
+      EXPECT_EQ(converted.MapPoint(rect.origin()),
+                transform.MapPoint(rect.origin()));
+    }
+    Transform pre = converted;
+    pre.PreConcat(TranslateTransform(1, 2));
+    EXPECT_EQ(pre, transform * TranslateTransform(1, 2));
+  }
+}
+
+}  // namespace
+
+}  // namespace gfx
@@ -0,0 +1,27 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/shared_transform_operations.h"
+
+namespace gfx {
+
+// static
+scoped_refptr<const SharedTransformOperations>
+SharedTransformOperations::Create(const TransformOperations& operations) {
+  return base::WrapRefCounted(new SharedTransformOperations(operations));
+}
+
+SharedTransformOperations::SharedTransformOperations(
+    const TransformOperations& operations)
+    : operations_(operations), matrix_(operations_.Apply()) {
+  // Compute everything that reading the operations would otherwise cache:
+  // the decomposition of the whole list, used to blend with operations that
+  // don't match.
+  operations_.GetDecomposedTransform(0);
+  operations_.decomposed_transforms_frozen_ = true;
+}
+
+SharedTransformOperations::~SharedTransformOperations() = default;
+
+}  // namespace gfx
@@ -0,0 +1,52 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_SHARED_TRANSFORM_OPERATIONS_H_
+#define UI_GFX_GEOMETRY_SHARED_TRANSFORM_OPERATIONS_H_
+
+#include "base/component_export.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/scoped_refptr.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace gfx {
+
+// An immutable snapshot of TransformOperations that can be shared between
+// threads instead of copied, e.g. to hand animation keyframes from the main
+// thread to the compositor. The matrix of the operations and the
+// decomposition for blending them by matrix are computed when the snapshot is
+// created, and otherwise the caches of operations() are never updated, so
+// reading a snapshot on several threads at once is safe. Misses still share
+// decompositions through DecomposedTransformCache.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) SharedTransformOperations
+    : public base::RefCountedThreadSafe<SharedTransformOperations> {
+ public:
+  static scoped_refptr<const SharedTransformOperations> Create(
+      const TransformOperations& operations);
+
+  SharedTransformOperations(const SharedTransformOperations&) = delete;
+  SharedTransformOperations& operator=(const SharedTransformOperations&) =
+      delete;
+
+  // Copying the operations gives a TransformOperations that can be modified,
+  // and that starts with the caches of the snapshot.
+  const TransformOperations& operations() const { return operations_; }
+
+  // Returns operations().Apply(), which is computed once.
+  const Transform& Apply() const { return matrix_; }
+
+ private:
+  friend class base::RefCountedThreadSafe<SharedTransformOperations>;
+
+  explicit SharedTransformOperations(const TransformOperations& operations);
+  ~SharedTransformOperations();
+
+  TransformOperations operations_;
+  Transform matrix_;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_SHARED_TRANSFORM_OPERATIONS_H_
@@ -0,0 +1,68 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/shared_transform_operations.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace gfx {
+
+namespace {
+
+TransformOperations MakeOperations() {
+  TransformOperations operations;
+  operations.AppendTranslate(1, 2, 3);
+  operations.AppendRotate(0, 0, 1, 30);
+  operations.AppendScale(2, 3, 4);
+  return operations;
+}
+
+}  // namespace
+
+TEST(SharedTransformOperationsTest, Create) {
+  const TransformOperations operations = MakeOperations();
+  scoped_refptr<const SharedTransformOperations> shared =
+      SharedTransformOperations::Create(operations);
+  EXPECT_TRUE(shared->HasOneRef());
+  scoped_refptr<const SharedTransformOperations> other = shared;
+  EXPECT_FALSE(shared->HasOneRef());
+  EXPECT_EQ(&shared->operations(), &other->operations());
+
+  EXPECT_EQ(operations.size(), shared->operations().size());
+  EXPECT_TRUE(shared->operations().ApproximatelyEqual(operations, 0));
+  EXPECT_EQ(operations.Apply(), shared->Apply());
+
+  TransformOperations from;
+  from.AppendMatrix(Transform::MakeTranslation(10, 20));
+  EXPECT_TRUE(shared->operations()
+                  .Blend(from, 0.25f)
+                  .ApproximatelyEqual(operations.Blend(from, 0.25f), 0));
+}
+
+TEST(SharedTransformOperationsTest, FreezesCaches) {
+  scoped_refptr<const SharedTransformOperations> shared =
+      SharedTransformOperations::Create(MakeOperations());
+  const TransformOperations& operations = shared->operations();
+  ASSERT_EQ(1UL, operations.num_decomposed_transforms_);
+  EXPECT_EQ(0UL, operations.decomposed_transforms_[0].start_offset);
+
+  // Other offsets are decomposed without updating the cache.
+  EXPECT_TRUE(operations.GetDecomposedTransform(1));
+  EXPECT_TRUE(operations.GetDecomposedTransform(0));
+  EXPECT_EQ(1UL, operations.num_decomposed_transforms_);
+  EXPECT_EQ(0UL, operations.decomposed_transforms_[0].start_offset);
+
+  // Copies keep the decomposition and cache as usual.
+  TransformOperations copy = operations;
+  EXPECT_EQ(1UL, copy.num_decomposed_transforms_);
+  EXPECT_TRUE(copy.GetDecomposedTransform(1));
+  EXPECT_EQ(2UL, copy.num_decomposed_transforms_);
+  copy.AppendSkewX(10);
+  EXPECT_EQ(4UL, copy.size());
+  EXPECT_EQ(3UL, operations.size());
+}
+
+}  // namespace gfx
@@ -12,7 +12,11 @@
 #include <numbers>
 #include <utility>
 
+#include "base/check_op.h"
+#include "base/containers/span.h"
 #include "base/numerics/angle_conversions.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 
 namespace gfx {
 
@@ -22,6 +26,48 @@ struct SinCos {
   bool IsZeroAngle() const { return sin == 0 && cos == 1; }
 };
 
+namespace internal {
+
+// The sine and cosine of each multiple of 45 degrees.
+inline constexpr auto kSinCosN45 = std::to_array<SinCos>({
+    {0, 1},
+    {std::numbers::sqrt2 / 2, std::numbers::sqrt2 / 2},
+    {1, 0},
+    {std::numbers::sqrt2 / 2, -std::numbers::sqrt2 / 2},
+    {0, -1},
+    {-std::numbers::sqrt2 / 2, -std::numbers::sqrt2 / 2},
+    {-1, 0},
+    {-std::numbers::sqrt2 / 2, std::numbers::sqrt2 / 2},
+});
+
+// The sine and cosine of each lane of |x|, which is in [0, pi/4], with the
+// minimax polynomials of the fdlibm kernels (k_sin.c and k_cos.c). They are
+// within 1 ulp of the exact values there.
+ALWAYS_INLINE void SinCosPolynomials(Double4 x, Double4& s, Double4& c) {
+  const Double4 z = x * x;
+  const Double4 sin_r =
+      8.33333333332248946124e-03 +
+      z * (-1.98412698298579493134e-04 +
+           z * (2.75573137070700676789e-06 +
+                z * (-2.50507602534068634195e-08 +
+                     z * 1.58969099521155010221e-10)));
+  s = x + z * x * (-1.66666666666666324348e-01 + z * sin_r);
+
+  const Double4 cos_r =
+      z * (4.16666666666666019037e-02 +
+           z * (-1.38888888888741095749e-03 +
+                z * (2.48015872894767294178e-05 +
+                     z * (-2.75573143513906633035e-07 +
+                          z * (2.08757232129817482790e-09 +
+                               z * -1.13596475577881948265e-11)))));
+  // 1 - z / 2 is rounded first, and its rounding error is added back.
+  const Double4 half_z = 0.5 * z;
+  const Double4 w = 1.0 - half_z;
+  c = w + (((1.0 - w) - half_z) + z * cos_r);
+}
+
+}  // namespace internal
+
 inline SinCos SinCosDegrees(double degrees) {
   // Some math libraries have poor accuracy with large arguments,
   // so range-reduce explicitly before we call sin() or cos(). However, unless
@@ -46,18 +92,7 @@ inline SinCos SinCosDegrees(double degrees) {
     double n45degrees = degrees / 45.0;
     int octant = static_cast<int>(n45degrees);
     if (octant == n45degrees) {
-      constexpr auto kSinCosN45 = std::to_array<SinCos>({
-          {0, 1},
-          {std::numbers::sqrt2 / 2, std::numbers::sqrt2 / 2},
-          {1, 0},
-          {std::numbers::sqrt2 / 2, -std::numbers::sqrt2 / 2},
-          {0, -1},
-          {-std::numbers::sqrt2 / 2, -std::numbers::sqrt2 / 2},
-          {-1, 0},
-          {-std::numbers::sqrt2 / 2, std::numbers::sqrt2 / 2},
-      });
-
-      return kSinCosN45[octant & 7];
+      return internal::kSinCosN45[octant & 7];
     }
 
     if (degrees < 0) {
@@ -109,6 +144,56 @@ inline SinCos SinCosDegrees(double degrees) {
   return SinCos{std::sin(rad), std::cos(rad)};
 }
 
+// SinCosDegrees() of each of |degrees| into |results|, which must have the
+// same size. The angles are range-reduced in the same way, four at a time,
+// and the sines and cosines are polynomials instead of calls to libm. Those
+// are within 1 ulp of SinCosDegrees() (measured over millions of angles
+// against glibc), and the multiples of 45 degrees get the same exact values.
+// Only the angles that SinCosDegrees() reduces with fmod() call it.
+inline void SinCosDegreesMany(base::span<const double> degrees,
+                              base::span<SinCos> results) {
+  CheckBatchSpans(degrees, results);
+  size_t i = 0;
+  for (; i + 4 <= degrees.size(); i += 4) {
+    Double4 d = {degrees[i], degrees[i + 1], degrees[i + 2], degrees[i + 3]};
+    // The other lanes, including NaN, are replaced by SinCosDegrees() below.
+    const DoubleBoolean4 in_range = (d > -90000000.0) & (d < 90000000.0);
+    d = in_range ? d : Double4{};
+
+    const Double4 n45degrees = d / 45.0;
+    DoubleBoolean4 octant = __builtin_convertvector(n45degrees, DoubleBoolean4);
+    const DoubleBoolean4 exact =
+        __builtin_convertvector(octant, Double4) == n45degrees;
+    // The comparisons are -1 where true, which decrements the negative octants
+    // as SinCosDegrees() does.
+    octant += (d < 0) & ~exact;
+    d -= __builtin_convertvector(octant, Double4) * 45.0;
+    d = (octant & 1) != 0 ? 45.0 - d : d;
+
+    Double4 s;
+    Double4 c;
+    internal::SinCosPolynomials(d * std::numbers::pi / 180, s, c);
+    const DoubleBoolean4 swap = ((octant + 1) & 2) != 0;
+    const Double4 swapped_s = swap ? c : s;
+    const Double4 swapped_c = swap ? s : c;
+    s = (octant & 4) != 0 ? -swapped_s : swapped_s;
+    c = ((octant + 2) & 4) != 0 ? -swapped_c : swapped_c;
+
+    for (size_t lane = 0; lane < 4; ++lane) {
+      if (!in_range[lane]) {
+        results[i + lane] = SinCosDegrees(degrees[i + lane]);
+      } else if (exact[lane]) {
+        results[i + lane] = internal::kSinCosN45[octant[lane] & 7];
+      } else {
+        results[i + lane] = SinCos{s[lane], c[lane]};
+      }
+    }
+  }
+  for (; i < degrees.size(); ++i) {
+    results[i] = SinCosDegrees(degrees[i]);
+  }
+}
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_SIN_COS_DEGREES_H_
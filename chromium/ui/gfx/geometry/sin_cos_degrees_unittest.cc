@@ -8,6 +8,12 @@
 
 #include <math.h>
 
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace gfx {
@@ -50,5 +56,54 @@ TEST(SinCosDegreesTest, HugeValues) {
   EXPECT_NEAR(SinCosDegrees(360e10 + 20).cos, cos(20 * (M_PI / 180.0)), 1e-6);
 }
 
+// The distance in ulp between |a| and |b|, which have the same sign.
+int64_t UlpDistance(double a, double b) {
+  int64_t a_bits;
+  int64_t b_bits;
+  memcpy(&a_bits, &a, sizeof(a));
+  memcpy(&b_bits, &b, sizeof(b));
+  return std::abs(a_bits - b_bits);
+}
+
+TEST(SinCosDegreesTest, Many) {
+  std::vector<double> degrees;
+  for (int d = -3600; d <= 3600; d += 7) {
+    degrees.push_back(d * 0.1);
+  }
+  for (int turn = -2; turn <= 2; ++turn) {
+    for (int n45 = 0; n45 < 8; ++n45) {
+      degrees.push_back(turn * 360 + n45 * 45);
+    }
+  }
+  degrees.insert(degrees.end(),
+                 {1e-300, -1e-9, 89999999.5, -90000000.0, 360e10 + 20,
+                  std::numeric_limits<double>::infinity(),
+                  std::numeric_limits<double>::quiet_NaN(), 33.3});
+
+  std::vector<SinCos> results(degrees.size());
+  SinCosDegreesMany(degrees, results);
+  for (size_t i = 0; i < degrees.size(); ++i) {
+    const SinCos expected = SinCosDegrees(degrees[i]);
+    if (std::isnan(expected.sin)) {
+      EXPECT_TRUE(std::isnan(results[i].sin)) << degrees[i];
+      EXPECT_TRUE(std::isnan(results[i].cos)) << degrees[i];
+      continue;
+    }
+    if (std::fmod(degrees[i], 45) == 0) {
+      EXPECT_EQ(expected.sin, results[i].sin) << degrees[i];
+      EXPECT_EQ(expected.cos, results[i].cos) << degrees[i];
+    }
+    // Values of either sign around 0 compare as more than 1 ulp apart, so
+    // those are compared with EXPECT_NEAR instead.
+    if (std::abs(expected.sin) > 1e-300 && std::abs(expected.cos) > 1e-300) {
+      EXPECT_LE(UlpDistance(expected.sin, results[i].sin), 1) << degrees[i];
+      EXPECT_LE(UlpDistance(expected.cos, results[i].cos), 1) << degrees[i];
+    } else {
+      EXPECT_NEAR(expected.sin, results[i].sin, 1e-15) << degrees[i];
+      EXPECT_NEAR(expected.cos, results[i].cos, 1e-15) << degrees[i];
+    }
+  }
+}
+
 }  // namespace
 }  // namespace gfx
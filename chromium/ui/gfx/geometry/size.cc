@@ -4,7 +4,14 @@
 
 #include "ui/gfx/geometry/size.h"
 
+#include <array>
+#include <limits>
+#include <span>
+
+#include "base/check_op.h"
+#include "base/numerics/checked_math.h"
 #include "base/numerics/clamped_math.h"
+#include "base/numerics/clamped_vec.h"
 #include "base/numerics/safe_math.h"
 #include "base/strings/stringprintf.h"
 #include "build/build_config.h"
@@ -20,6 +27,27 @@
 
 namespace gfx {
 
+namespace {
+
+// The number of sizes whose areas are computed into a buffer on the stack at
+// a time, for the span reductions of base/numerics.
+constexpr size_t kAreaChunkSize = 64u;
+
+using AreaChunk = std::array<uint64_t, kAreaChunkSize>;
+
+// Stores the areas of |sizes|, of which there are at most kAreaChunkSize, in
+// |areas|, and returns the span of them. The products of the non-negative
+// ints are exact in uint64_t, so this loop has no checks.
+std::span<const uint64_t> GetAreas(base::span<const Size> sizes,
+                                   AreaChunk& areas) {
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    areas[i] = sizes[i].Area64();
+  }
+  return std::span<const uint64_t>(areas).first(sizes.size());
+}
+
+}  // namespace
+
 #if BUILDFLAG(IS_APPLE)
 Size::Size(const CGSize& s) : Size(s.width, s.height) {}
 #endif
@@ -110,4 +138,89 @@ Size ScaleToRoundedSize(const Size& size, float scale) {
   return ToRoundedSize(ScaleSize(gfx::SizeF(size), scale, scale));
 }
 
+std::optional<uint64_t> GetCheckedTotalArea(base::span<const Size> sizes) {
+  base::CheckedNumeric<uint64_t> total = 0;
+  AreaChunk areas;
+  for (size_t i = 0; i < sizes.size(); i += kAreaChunkSize) {
+    const std::optional<uint64_t> sum = base::CheckedSum(
+        GetAreas(sizes.subspan(i, std::min(kAreaChunkSize, sizes.size() - i)),
+                 areas));
+    if (!sum) {
+      return std::nullopt;
+    }
+    total += *sum;
+  }
+  uint64_t result;
+  return total.AssignIfValid(&result) ? std::optional<uint64_t>(result)
+                                      : std::nullopt;
+}
+
+std::optional<uint64_t> GetCheckedTotalByteSize(base::span<const Size> sizes,
+                                                size_t bytes_per_pixel) {
+  // The sum of the byte sizes overflows iff the product of the total area
+  // does, so the bytes per pixel is multiplied once.
+  const std::optional<uint64_t> area = GetCheckedTotalArea(sizes);
+  if (!area) {
+    return bytes_per_pixel ? std::nullopt : std::optional<uint64_t>(0);
+  }
+  uint64_t result;
+  return base::CheckMul(*area, bytes_per_pixel).AssignIfValid(&result)
+             ? std::optional<uint64_t>(result)
+             : std::nullopt;
+}
+
+std::optional<uint64_t> GetCheckedTotalByteSize(
+    base::span<const Size> sizes,
+    base::span<const uint32_t> bytes_per_pixel) {
+  CHECK_EQ(sizes.size(), bytes_per_pixel.size());
+  base::CheckedNumeric<uint64_t> total = 0;
+  AreaChunk areas;
+  AreaChunk chunk_bytes_per_pixel;
+  for (size_t i = 0; i < sizes.size(); i += kAreaChunkSize) {
+    const size_t count = std::min(kAreaChunkSize, sizes.size() - i);
+    for (size_t j = 0; j < count; ++j) {
+      chunk_bytes_per_pixel[j] = bytes_per_pixel[i + j];
+    }
+    const std::optional<uint64_t> sum = base::CheckedDot(
+        GetAreas(sizes.subspan(i, count), areas),
+        std::span<const uint64_t>(chunk_bytes_per_pixel).first(count));
+    if (!sum) {
+      return std::nullopt;
+    }
+    total += *sum;
+  }
+  uint64_t result;
+  return total.AssignIfValid(&result) ? std::optional<uint64_t>(result)
+                                      : std::nullopt;
+}
+
+uint64_t GetClampedTotalArea(base::span<const Size> sizes) {
+  using Lanes = base::ClampedVec<uint64_t, 4>;
+  Lanes sums;
+  AreaChunk areas;
+  uint64_t tail = 0;
+  for (size_t i = 0; i < sizes.size(); i += kAreaChunkSize) {
+    const std::span<const uint64_t> chunk = GetAreas(
+        sizes.subspan(i, std::min(kAreaChunkSize, sizes.size() - i)), areas);
+    size_t j = 0;
+    for (; j + Lanes::kLanes <= chunk.size(); j += Lanes::kLanes) {
+      sums += Lanes::Load(chunk.subspan(j).first<Lanes::kLanes>());
+    }
+    for (; j < chunk.size(); ++j) {
+      tail = base::ClampAdd(tail, chunk[j]);
+    }
+  }
+  for (size_t lane = 0; lane < Lanes::kLanes; ++lane) {
+    tail = base::ClampAdd(tail, sums[lane]);
+  }
+  return tail;
+}
+
+uint64_t GetClampedTotalByteSize(base::span<const Size> sizes,
+                                 size_t bytes_per_pixel) {
+  // Saturation is monotonic, so clamping the total area first doesn't change
+  // the result.
+  return base::ClampMul(GetClampedTotalArea(sizes), uint64_t{bytes_per_pixel});
+}
+
 }  // namespace gfx
@@ -5,11 +5,16 @@
 #ifndef UI_GFX_GEOMETRY_SIZE_H_
 #define UI_GFX_GEOMETRY_SIZE_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <algorithm>
 #include <iosfwd>
+#include <optional>
 #include <string>
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "base/numerics/safe_math.h"
 #include "build/build_config.h"
 
@@ -116,6 +121,32 @@ inline Size TransposeSize(const Size& s) {
   return Size(s.height(), s.width());
 }
 
+// The sum of the areas of |sizes|, e.g. of the textures or tiles of a frame,
+// or std::nullopt if it overflows uint64_t. Unlike a sum of GetCheckedArea(),
+// the areas are exact in uint64_t and are summed in one pass with a single
+// overflow flag.
+COMPONENT_EXPORT(GEOMETRY)
+std::optional<uint64_t> GetCheckedTotalArea(base::span<const Size> sizes);
+
+// The sum of the byte sizes of |sizes| with |bytes_per_pixel|, or with the
+// element of |bytes_per_pixel| at the same index, which must have the same
+// size as |sizes|, or std::nullopt if it overflows uint64_t.
+COMPONENT_EXPORT(GEOMETRY)
+std::optional<uint64_t> GetCheckedTotalByteSize(base::span<const Size> sizes,
+                                                size_t bytes_per_pixel);
+COMPONENT_EXPORT(GEOMETRY)
+std::optional<uint64_t> GetCheckedTotalByteSize(
+    base::span<const Size> sizes,
+    base::span<const uint32_t> bytes_per_pixel);
+
+// The saturating versions of the functions above, which return the max
+// uint64_t instead of std::nullopt, for budgets that only compare the total.
+COMPONENT_EXPORT(GEOMETRY)
+uint64_t GetClampedTotalArea(base::span<const Size> sizes);
+COMPONENT_EXPORT(GEOMETRY)
+uint64_t GetClampedTotalByteSize(base::span<const Size> sizes,
+                                 size_t bytes_per_pixel);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_SIZE_H_
@@ -4,10 +4,35 @@
 
 #include "ui/gfx/geometry/size_conversions.h"
 
+#include <stddef.h>
+
+#include "base/check_op.h"
 #include "base/numerics/safe_conversions.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 
 namespace gfx {
 
+namespace {
+
+// Converts |sizes| into |results| two at a time, in the lanes of a Float4.
+template <Int4 (*Convert)(Float4)>
+void ConvertSizes(base::span<const SizeF> sizes, base::span<Size> results) {
+  CheckBatchSpans(sizes, results);
+  for (size_t i = 0; i < sizes.size(); i += 2) {
+    const bool has_pair = i + 1 < sizes.size();
+    const SizeF& second = sizes[has_pair ? i + 1 : i];
+    const Int4 converted = Convert(Float4{sizes[i].width(), sizes[i].height(),
+                                          second.width(), second.height()});
+    results[i] = Size(converted[0], converted[1]);
+    if (has_pair) {
+      results[i + 1] = Size(converted[2], converted[3]);
+    }
+  }
+}
+
+}  // namespace
+
 Size ToFlooredSize(const SizeF& size) {
   return Size(base::ClampFloor(size.width()), base::ClampFloor(size.height()));
 }
@@ -20,5 +45,42 @@ Size ToRoundedSize(const SizeF& size) {
   return Size(base::ClampRound(size.width()), base::ClampRound(size.height()));
 }
 
+void ToFlooredSizes(base::span<const SizeF> sizes, base::span<Size> results) {
+  ConvertSizes<ClampFloorToInt4>(sizes, results);
+}
+
+void ToCeiledSizes(base::span<const SizeF> sizes, base::span<Size> results) {
+  ConvertSizes<ClampCeilToInt4>(sizes, results);
+}
+
+void ToRoundedSizes(base::span<const SizeF> sizes, base::span<Size> results) {
+  ConvertSizes<ClampRoundToInt4>(sizes, results);
+}
+
+void ScaleToCeiledSizes(base::span<const Size> sizes,
+                        float x_scale,
+                        float y_scale,
+                        base::span<Size> results) {
+  CheckBatchSpans(sizes, results);
+  if (x_scale == 1.f && y_scale == 1.f) {
+    results.copy_from(sizes);
+    return;
+  }
+  for (size_t i = 0; i < sizes.size(); i += 2) {
+    const bool has_pair = i + 1 < sizes.size();
+    // The scaling is done by SizeF, which clamps the results as the scalar
+    // function does.
+    const SizeF first = ScaleSize(SizeF(sizes[i]), x_scale, y_scale);
+    const SizeF second =
+        has_pair ? ScaleSize(SizeF(sizes[i + 1]), x_scale, y_scale) : first;
+    const Int4 ceiled = ClampCeilToInt4(
+        Float4{first.width(), first.height(), second.width(), second.height()});
+    results[i] = Size(ceiled[0], ceiled[1]);
+    if (has_pair) {
+      results[i + 1] = Size(ceiled[2], ceiled[3]);
+    }
+  }
+}
+
 }  // namespace gfx
 
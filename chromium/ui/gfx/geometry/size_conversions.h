@@ -6,6 +6,7 @@
 #define UI_GFX_GEOMETRY_SIZE_CONVERSIONS_H_
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/size.h"
 #include "ui/gfx/geometry/size_f.h"
 
@@ -20,6 +21,23 @@ COMPONENT_EXPORT(GEOMETRY) Size ToCeiledSize(const SizeF& size);
 // Returns a Size with each component from the input SizeF rounded.
 COMPONENT_EXPORT(GEOMETRY) Size ToRoundedSize(const SizeF& size);
 
+// Same as the functions above for each of |sizes|, into |results|, which must
+// have the same size, e.g. for the tiles and textures of a frame. Two sizes are
+// converted at a time, with SIMD rounding and saturation.
+COMPONENT_EXPORT(GEOMETRY)
+void ToFlooredSizes(base::span<const SizeF> sizes, base::span<Size> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToCeiledSizes(base::span<const SizeF> sizes, base::span<Size> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToRoundedSizes(base::span<const SizeF> sizes, base::span<Size> results);
+
+// Sets results[i] to ScaleToCeiledSize(sizes[i], x_scale, y_scale), as above.
+COMPONENT_EXPORT(GEOMETRY)
+void ScaleToCeiledSizes(base::span<const Size> sizes,
+                        float x_scale,
+                        float y_scale,
+                        base::span<Size> results);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_SIZE_CONVERSIONS_H_
@@ -4,6 +4,10 @@
 
 #include "ui/gfx/geometry/size_f.h"
 
+#include <stddef.h>
+
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/size.h"
 #include "ui/gfx/geometry/size_conversions.h"
@@ -63,6 +67,36 @@ TEST(SizeFTest, ToRoundedSize) {
   EXPECT_EQ(Size(11, 11), ToRoundedSize(SizeF(10.9999f, 10.9999f)));
 }
 
+TEST(SizeFTest, ToFlooredCeiledAndRoundedSizes) {
+  const std::vector<SizeF> sizes = {
+      SizeF(0, 0),          SizeF(0.4999f, 10.5f),   SizeF(10.9999f, 0.5f),
+      SizeF(1e10f, 1e-10f), SizeF(2147483520.0f, 3), SizeF(7.5f, 2.5f),
+      SizeF(0.5f, 1.5f)};
+  std::vector<Size> floored(sizes.size());
+  ToFlooredSizes(sizes, floored);
+  std::vector<Size> ceiled(sizes.size());
+  ToCeiledSizes(sizes, ceiled);
+  std::vector<Size> rounded(sizes.size());
+  ToRoundedSizes(sizes, rounded);
+  for (size_t i = 0; i < sizes.size(); ++i) {
+    SCOPED_TRACE(sizes[i].ToString());
+    EXPECT_EQ(ToFlooredSize(sizes[i]), floored[i]);
+    EXPECT_EQ(ToCeiledSize(sizes[i]), ceiled[i]);
+    EXPECT_EQ(ToRoundedSize(sizes[i]), rounded[i]);
+  }
+
+  const std::vector<Size> tiles = {Size(256, 256), Size(0, 17), Size(1, 1),
+                                   Size(1000000000, 3), Size(99, 1)};
+  for (float scale : {1.f, 0.5f, 1.25f, 3.f, 1e-9f}) {
+    std::vector<Size> scaled(tiles.size());
+    ScaleToCeiledSizes(tiles, scale, 2 * scale, scaled);
+    for (size_t i = 0; i < tiles.size(); ++i) {
+      EXPECT_EQ(ScaleToCeiledSize(tiles[i], scale, 2 * scale), scaled[i])
+          << scale << " " << tiles[i].ToString();
+    }
+  }
+}
+
 TEST(SizeFTest, SetToMinMax) {
   SizeF a;
 
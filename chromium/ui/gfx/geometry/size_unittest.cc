@@ -4,6 +4,11 @@
 
 #include "ui/gfx/geometry/size.h"
 
+#include <stdint.h>
+
+#include <limits>
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace gfx {
@@ -121,4 +126,61 @@ TEST(SizeTest, Transpose) {
   EXPECT_EQ(gfx::Size(2, 1), s);
 }
 
+TEST(SizeTest, TotalArea) {
+  // More than one chunk of sizes, with a partial one at the end.
+  std::vector<Size> sizes;
+  std::vector<uint32_t> bytes_per_pixel;
+  uint64_t area = 0;
+  uint64_t bytes = 0;
+  for (int i = 0; i < 1000; ++i) {
+    sizes.emplace_back(i * 37 % 4096, i * 101 % 2048);
+    bytes_per_pixel.push_back(1u << (i % 4));
+    area += sizes.back().Area64();
+    bytes += sizes.back().Area64() * bytes_per_pixel.back();
+  }
+  EXPECT_EQ(area, GetCheckedTotalArea(sizes));
+  EXPECT_EQ(area, GetClampedTotalArea(sizes));
+  EXPECT_EQ(area * 4, GetCheckedTotalByteSize(sizes, 4));
+  EXPECT_EQ(area * 4, GetClampedTotalByteSize(sizes, 4));
+  EXPECT_EQ(bytes, GetCheckedTotalByteSize(sizes, bytes_per_pixel));
+
+  EXPECT_EQ(0u, GetCheckedTotalArea({}));
+  EXPECT_EQ(0u, GetClampedTotalArea({}));
+  EXPECT_EQ(0u, GetCheckedTotalByteSize(sizes, 0));
+  EXPECT_EQ(0u, GetClampedTotalByteSize(sizes, 0));
+}
+
+TEST(SizeTest, TotalAreaOverflow) {
+  const int int_max = std::numeric_limits<int>::max();
+  const uint64_t uint64_max = std::numeric_limits<uint64_t>::max();
+  // The area of each of these is just below 2^62, so that the sum of five of
+  // them overflows.
+  std::vector<Size> sizes(100, Size(10, 10));
+  for (int i = 0; i < 3; ++i) {
+    sizes[70 + i] = Size(int_max, int_max);
+  }
+  const uint64_t area = 97 * 100 + 3 * Size(int_max, int_max).Area64();
+  EXPECT_EQ(area, GetCheckedTotalArea(sizes));
+  EXPECT_EQ(area, GetClampedTotalArea(sizes));
+  // The byte sizes overflow, though the areas don't.
+  EXPECT_EQ(std::nullopt, GetCheckedTotalByteSize(sizes, 2));
+  EXPECT_EQ(uint64_max, GetClampedTotalByteSize(sizes, 2));
+  std::vector<uint32_t> bytes_per_pixel(100, 1);
+  EXPECT_EQ(area, GetCheckedTotalByteSize(sizes, bytes_per_pixel));
+  bytes_per_pixel[72] = 3;
+  EXPECT_EQ(std::nullopt, GetCheckedTotalByteSize(sizes, bytes_per_pixel));
+
+  // The areas overflow, in the middle of a chunk for the checked sum, and in
+  // the reduction of the lanes of the clamped one.
+  sizes[10] = Size(int_max, int_max);
+  sizes[20] = Size(int_max, int_max);
+  EXPECT_EQ(std::nullopt, GetCheckedTotalArea(sizes));
+  EXPECT_EQ(uint64_max, GetClampedTotalArea(sizes));
+  EXPECT_EQ(std::nullopt, GetCheckedTotalByteSize(sizes, 1));
+  EXPECT_EQ(uint64_max, GetClampedTotalByteSize(sizes, 1));
+  // Except when there are no bytes per pixel.
+  EXPECT_EQ(0u, GetCheckedTotalByteSize(sizes, 0));
+  EXPECT_EQ(0u, GetClampedTotalByteSize(sizes, 0));
+}
+
 }  // namespace gfx
@@ -7,19 +7,29 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <array>
+#include <bit>
+#include <type_traits>
+
 #include "base/compiler_specific.h"
 #include "base/containers/span.h"
 #include "base/numerics/safe_conversions.h"
 #include "base/numerics/safe_math.h"
 #include "third_party/skia/include/core/SkM44.h"
 #include "third_party/skia/include/core/SkMatrix.h"
+#include "third_party/skia/include/core/SkPoint.h"
 #include "third_party/skia/include/core/SkRect.h"
+#include "third_party/skia/include/core/SkSize.h"
 #include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/point.h"
+#include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/quad_f.h"
 #include "ui/gfx/geometry/rect.h"
 #include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/size.h"
+#include "ui/gfx/geometry/size_f.h"
 #include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/vector2d_f.h"
 
 namespace gfx {
 
@@ -88,6 +98,74 @@ Size SkISizeToSize(const SkISize& size) {
   return Size(size.width(), size.height());
 }
 
+namespace {
+
+// Returns |from| viewed as an array of To, which must have the same layout as
+// From. The order of the components is checked below.
+template <typename To, typename From>
+base::span<To> ReinterpretSpan(base::span<From> from) {
+  static_assert(sizeof(To) == sizeof(From));
+  static_assert(alignof(To) == alignof(From));
+  static_assert(std::is_trivially_copyable_v<To> &&
+                std::is_trivially_copyable_v<From>);
+  static_assert(std::is_standard_layout_v<To> &&
+                std::is_standard_layout_v<From>);
+  // SAFETY: |from| has from.size() elements of the size of To.
+  return UNSAFE_BUFFERS(
+      base::span<To>(reinterpret_cast<To*>(from.data()), from.size()));
+}
+
+// The components are in the same order, e.g. x before y.
+static_assert(std::bit_cast<SkPoint>(PointF(1, 2)).fX == 1 &&
+              std::bit_cast<SkPoint>(PointF(1, 2)).fY == 2);
+static_assert(std::bit_cast<SkPoint>(Vector2dF(1, 2)).fX == 1 &&
+              std::bit_cast<SkPoint>(Vector2dF(1, 2)).fY == 2);
+static_assert(std::bit_cast<SkIPoint>(Point(1, 2)).fX == 1 &&
+              std::bit_cast<SkIPoint>(Point(1, 2)).fY == 2);
+static_assert(std::bit_cast<SkSize>(SizeF(1, 2)).fWidth == 1 &&
+              std::bit_cast<SkSize>(SizeF(1, 2)).fHeight == 2);
+static_assert(std::bit_cast<SkISize>(Size(1, 2)).fWidth == 1 &&
+              std::bit_cast<SkISize>(Size(1, 2)).fHeight == 2);
+
+}  // namespace
+
+base::span<const SkPoint> PointFsAsSkPoints(base::span<const PointF> points) {
+  return ReinterpretSpan<const SkPoint>(points);
+}
+
+base::span<SkPoint> PointFsAsWritableSkPoints(base::span<PointF> points) {
+  return ReinterpretSpan<SkPoint>(points);
+}
+
+base::span<const PointF> SkPointsAsPointFs(base::span<const SkPoint> points) {
+  return ReinterpretSpan<const PointF>(points);
+}
+
+base::span<PointF> SkPointsAsWritablePointFs(base::span<SkPoint> points) {
+  return ReinterpretSpan<PointF>(points);
+}
+
+base::span<const SkPoint> Vector2dFsAsSkVectors(
+    base::span<const Vector2dF> vectors) {
+  return ReinterpretSpan<const SkPoint>(vectors);
+}
+
+base::span<const SkIPoint> PointsAsSkIPoints(base::span<const Point> points) {
+  return ReinterpretSpan<const SkIPoint>(points);
+}
+
+base::span<const Point> SkIPointsAsPoints(base::span<const SkIPoint> points) {
+  return ReinterpretSpan<const Point>(points);
+}
+
+base::span<const SkSize> SizeFsAsSkSizes(base::span<const SizeF> sizes) {
+  return ReinterpretSpan<const SkSize>(sizes);
+}
+
+base::span<const SkISize> SizesAsSkISizes(base::span<const Size> sizes) {
+  return ReinterpretSpan<const SkISize>(sizes);
+}
+
 void QuadFToSkPoints(const QuadF& quad, base::span<SkPoint, 4> points) {
   points[0] = PointFToSkPoint(quad.p1());
   points[1] = PointFToSkPoint(quad.p2());
@@ -103,12 +181,18 @@ SkMatrix AxisTransform2dToSkMatrix(const AxisTransform2d& transform) {
 }
 
 SkM44 TransformToSkM44(const Transform& matrix) {
-  // The parameters of this SkM44 constructor are in row-major order.
-  return SkM44(
-      matrix.rc(0, 0), matrix.rc(0, 1), matrix.rc(0, 2), matrix.rc(0, 3),
-      matrix.rc(1, 0), matrix.rc(1, 1), matrix.rc(1, 2), matrix.rc(1, 3),
-      matrix.rc(2, 0), matrix.rc(2, 1), matrix.rc(2, 2), matrix.rc(2, 3),
-      matrix.rc(3, 0), matrix.rc(3, 1), matrix.rc(3, 2), matrix.rc(3, 3));
+  if (const AxisTransform2d* axis_2d = matrix.GetStoredAxisTransform2d()) {
+    // The parameters of this SkM44 constructor are in row-major order.
+    const Vector2dF& scale = axis_2d->scale();
+    const Vector2dF& translation = axis_2d->translation();
+    return SkM44(scale.x(), 0, 0, translation.x(),  // row 0
+                 0, scale.y(), 0, translation.y(),  // row 1
+                 0, 0, 1, 0,                        // row 2
+                 0, 0, 0, 1);                       // row 3
+  }
+  std::array<float, 16> col_major;
+  matrix.GetColMajorF(col_major);
+  return SkM44::ColMajor(col_major.data());
 }
 
 Transform SkM44ToTransform(const SkM44& matrix) {
@@ -120,10 +204,20 @@ Transform SkM44ToTransform(const SkM44& matrix) {
 }
 
 SkMatrix TransformToFlattenedSkMatrix(const Transform& matrix) {
+  if (const AxisTransform2d* axis_2d = matrix.GetStoredAxisTransform2d()) {
+    return AxisTransform2dToSkMatrix(*axis_2d);
+  }
+  std::array<float, 16> col_major;
+  matrix.GetColMajorF(col_major);
+  return ColMajorFToFlattenedSkMatrix(col_major);
+}
+
+SkMatrix ColMajorFToFlattenedSkMatrix(base::span<const float, 16> c) {
   // Convert from 4x4 to 3x3 by dropping row 2 (counted from 0) and column 2.
-  return SkMatrix::MakeAll(matrix.rc(0, 0), matrix.rc(0, 1), matrix.rc(0, 3),
-                           matrix.rc(1, 0), matrix.rc(1, 1), matrix.rc(1, 3),
-                           matrix.rc(3, 0), matrix.rc(3, 1), matrix.rc(3, 3));
+  // rc(row, col) is c[col * 4 + row].
+  return SkMatrix::MakeAll(c[0], c[4], c[12],   // row 0
+                           c[1], c[5], c[13],   // row 1
+                           c[3], c[7], c[15]);  // row 3
 }
 
 Transform SkMatrixToTransform(const SkMatrix& matrix) {
@@ -28,6 +28,7 @@ class RectF;
 class Size;
 class SizeF;
 class Transform;
+class Vector2dF;
 
 // Convert between Skia and gfx types.
 COMPONENT_EXPORT(GEOMETRY_SKIA) SkPoint PointToSkPoint(const Point& point);
@@ -45,17 +46,50 @@ COMPONENT_EXPORT(GEOMETRY_SKIA) SkISize SizeToSkISize(const Size& size);
 COMPONENT_EXPORT(GEOMETRY_SKIA) SizeF SkSizeToSizeF(const SkSize& size);
 COMPONENT_EXPORT(GEOMETRY_SKIA) Size SkISizeToSize(const SkISize& size);
 
+// Views arrays of gfx types as arrays of the Skia types with the same layout,
+// and the other way around, without copying, e.g. to hand vertices to Skia.
+// The layouts are checked at compile time. Rects can't be viewed, since RectF
+// and Rect store the size where SkRect and SkIRect store the right and
+// bottom, nor can Skia sizes, which may be negative unlike gfx sizes.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<const SkPoint> PointFsAsSkPoints(base::span<const PointF> points);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<SkPoint> PointFsAsWritableSkPoints(base::span<PointF> points);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<const PointF> SkPointsAsPointFs(base::span<const SkPoint> points);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<PointF> SkPointsAsWritablePointFs(base::span<SkPoint> points);
+// As SkVector, which is SkPoint.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<const SkPoint> Vector2dFsAsSkVectors(
+    base::span<const Vector2dF> vectors);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<const SkIPoint> PointsAsSkIPoints(base::span<const Point> points);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<const Point> SkIPointsAsPoints(base::span<const SkIPoint> points);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<const SkSize> SizeFsAsSkSizes(base::span<const SizeF> sizes);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+base::span<const SkISize> SizesAsSkISizes(base::span<const Size> sizes);
+
 COMPONENT_EXPORT(GEOMETRY_SKIA)
 void QuadFToSkPoints(const QuadF& quad, base::span<SkPoint, 4> points);
 
 COMPONENT_EXPORT(GEOMETRY_SKIA)
 SkMatrix AxisTransform2dToSkMatrix(const AxisTransform2d& transform);
 
+// These convert transforms stored as AxisTransform2d directly, and the others
+// from GetColMajorF(), with a vector narrowing of the entries. See
+// TransformWithCachedFloats for transforms that are converted repeatedly.
 COMPONENT_EXPORT(GEOMETRY_SKIA)
 SkM44 TransformToSkM44(const Transform& tranform);
 COMPONENT_EXPORT(GEOMETRY_SKIA) Transform SkM44ToTransform(const SkM44& matrix);
 COMPONENT_EXPORT(GEOMETRY_SKIA)
 SkMatrix TransformToFlattenedSkMatrix(const Transform& transform);
+// Same as TransformToFlattenedSkMatrix() of the transform whose entries are
+// |col_major|, as from Transform::GetColMajorF().
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+SkMatrix ColMajorFToFlattenedSkMatrix(base::span<const float, 16> col_major);
 COMPONENT_EXPORT(GEOMETRY_SKIA)
 Transform SkMatrixToTransform(const SkMatrix& matrix);
 
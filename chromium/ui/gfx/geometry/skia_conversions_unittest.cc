@@ -4,14 +4,25 @@
 
 #include "ui/gfx/geometry/skia_conversions.h"
 
+#include <stddef.h>
+
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/skia/include/core/SkM44.h"
 #include "third_party/skia/include/core/SkMatrix.h"
+#include "third_party/skia/include/core/SkPoint.h"
 #include "third_party/skia/include/core/SkRect.h"
+#include "third_party/skia/include/core/SkSize.h"
+#include "ui/gfx/geometry/point.h"
+#include "ui/gfx/geometry/point_f.h"
 #include "ui/gfx/geometry/rect.h"
 #include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/size.h"
+#include "ui/gfx/geometry/size_f.h"
 #include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/vector2d_f.h"
+#include "ui/gfx/geometry/vector3d_f.h"
 
 namespace gfx {
 
@@ -92,4 +103,64 @@ TEST(SkiaConversionsTest, TransformSkMatrixConversions) {
   EXPECT_EQ(t, SkMatrixToTransform(m));
 }
 
+TEST(SkiaConversionsTest, SpanViews) {
+  std::vector<PointF> points = {PointF(1.5f, -2), PointF(3, 4.25f)};
+  base::span<const SkPoint> sk_points = PointFsAsSkPoints(points);
+  ASSERT_EQ(points.size(), sk_points.size());
+  // The same memory, not a copy.
+  EXPECT_EQ(static_cast<const void*>(points.data()), sk_points.data());
+  base::span<const PointF> round_trip = SkPointsAsPointFs(sk_points);
+  EXPECT_EQ(static_cast<const void*>(points.data()), round_trip.data());
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(PointFToSkPoint(points[i]), sk_points[i]);
+    EXPECT_EQ(points[i], round_trip[i]);
+  }
+
+  // Writes through the views are seen by the viewed array.
+  PointFsAsWritableSkPoints(points)[1] = SkPoint::Make(7, 8);
+  EXPECT_EQ(PointF(7, 8), points[1]);
+  std::vector<SkPoint> skia_points(1);
+  SkPointsAsWritablePointFs(skia_points)[0] = PointF(-1, 9);
+  EXPECT_EQ(SkPoint::Make(-1, 9), skia_points[0]);
+
+  const std::vector<Vector2dF> vectors = {Vector2dF(5, 6)};
+  EXPECT_EQ(SkVector::Make(5, 6), Vector2dFsAsSkVectors(vectors)[0]);
+
+  const std::vector<Point> int_points = {Point(1, 2), Point(-3, 4)};
+  base::span<const SkIPoint> sk_int_points = PointsAsSkIPoints(int_points);
+  EXPECT_EQ(SkIPoint::Make(-3, 4), sk_int_points[1]);
+  EXPECT_EQ(Point(1, 2), SkIPointsAsPoints(sk_int_points)[0]);
+
+  const std::vector<SizeF> sizes = {SizeF(1.5f, 2)};
+  EXPECT_EQ(SkSize::Make(1.5f, 2), SizeFsAsSkSizes(sizes)[0]);
+  const std::vector<Size> int_sizes = {Size(3, 4)};
+  EXPECT_EQ(SkISize::Make(3, 4), SizesAsSkISizes(int_sizes)[0]);
+}
+
+TEST(SkiaConversionsTest, TransformFastPaths) {
+  Transform full_matrix;
+  full_matrix.Translate3d(1, 2, 3);
+  full_matrix.RotateAbout(Vector3dF(4, 5, 6), 70);
+  full_matrix.ApplyPerspectiveDepth(500);
+  Transform axis_2d_as_full_matrix = Transform::MakeScale(3, -4);
+  axis_2d_as_full_matrix.EnsureFullMatrixForTesting();
+
+  for (const Transform& t :
+       {Transform(), Transform::MakeTranslation(10.5, 20),
+        Transform::MakeScale(3, -4), Transform::Affine(1, 2, 3, 4, 5, 6),
+        full_matrix, axis_2d_as_full_matrix}) {
+    SCOPED_TRACE(t.ToString());
+    // The same as narrowing each entry.
+    EXPECT_EQ(SkM44(t.rc(0, 0), t.rc(0, 1), t.rc(0, 2), t.rc(0, 3),  //
+                    t.rc(1, 0), t.rc(1, 1), t.rc(1, 2), t.rc(1, 3),  //
+                    t.rc(2, 0), t.rc(2, 1), t.rc(2, 2), t.rc(2, 3),  //
+                    t.rc(3, 0), t.rc(3, 1), t.rc(3, 2), t.rc(3, 3)),
+              TransformToSkM44(t));
+    EXPECT_EQ(SkMatrix::MakeAll(t.rc(0, 0), t.rc(0, 1), t.rc(0, 3),  //
+                                t.rc(1, 0), t.rc(1, 1), t.rc(1, 3),  //
+                                t.rc(3, 0), t.rc(3, 1), t.rc(3, 3)),
+              TransformToFlattenedSkMatrix(t));
+  }
+}
+
 }  // namespace gfx
@@ -0,0 +1,124 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/test/geometry_edge_cases.h"
+
+#include <limits>
+
+namespace gfx {
+
+namespace {
+
+constexpr int kMaxInt = std::numeric_limits<int>::max();
+constexpr int kMinInt = std::numeric_limits<int>::min();
+constexpr float kMaxFloat = std::numeric_limits<float>::max();
+
+}  // namespace
+
+std::vector<TransformEdgeCase> GetTransformEdgeCases() {
+  std::vector<TransformEdgeCase> cases;
+
+  cases.push_back({"zero_scale", Transform::MakeScale(0.f), false, 0});
+
+  // A "pure" perspective, with the camera at the origin, which projects no
+  // point.
+  Transform pure_perspective;
+  pure_perspective.ApplyPerspectiveDepth(1.0);
+  pure_perspective.set_rc(3, 3, 0.f);
+  cases.push_back({"pure_perspective", pure_perspective, false, 4});
+
+  // The determinant is 1e-9, so the inverse is huge.
+  cases.push_back({"nearly_singular",
+                   Transform::Affine(1, 1, 1, 1 + 1e-9, 0, 0), true, 0});
+
+  Transform extreme_perspective;
+  extreme_perspective.ApplyPerspectiveDepth(1.0);
+  cases.push_back({"extreme_perspective", extreme_perspective, true, 0});
+
+  // The inverses of layer transforms with perspective, as used to project
+  // points on the screen onto the layers, which are rotated so that some or
+  // all of kEdgeCaseRect is behind the viewer.
+  Transform partly_behind_viewer;
+  partly_behind_viewer.RotateAboutYAxis(60.0);
+  partly_behind_viewer.ApplyPerspectiveDepth(50.0);
+  cases.push_back({"partly_behind_viewer", partly_behind_viewer, true, 2});
+
+  Transform behind_viewer;
+  behind_viewer.RotateAboutXAxis(100.0);
+  behind_viewer.RotateAboutYAxis(100.0);
+  behind_viewer.ApplyPerspectiveDepth(50.0);
+  behind_viewer.Translate(-200, -200);
+  cases.push_back({"behind_viewer", behind_viewer, true, 4});
+
+  // The float determinant overflows.
+  cases.push_back({"huge_scale", Transform::MakeScale(1e30f), false, 0});
+  cases.push_back({"max_translation",
+                   Transform::MakeTranslation(kMaxFloat, kMaxFloat), true, 0});
+  return cases;
+}
+
+std::vector<RectEdgeCase> GetRectEdgeCases() {
+  return {
+      {"max_origin", Rect(kMaxInt - 5, 0, 10, 10)},
+      {"max_size", Rect(0, 0, kMaxInt, kMaxInt)},
+      {"min_origin", Rect(kMinInt, kMinInt, kMaxInt, kMaxInt)},
+      {"max_origin_and_size", Rect(kMaxInt, kMaxInt, kMaxInt, kMaxInt)},
+      {"empty", Rect(8, 9, 20, 0)},
+  };
+}
+
+std::vector<RectFEdgeCase> GetRectFEdgeCases() {
+  constexpr float kMaxIntAsFloat = static_cast<float>(kMaxInt);
+  return {
+      {"max_size", RectF(0, 0, kMaxFloat, kMaxFloat)},
+      {"huge_origin", RectF(1e30f, -1e30f, 10, 10)},
+      {"max_int", RectF(kMaxIntAsFloat, kMaxIntAsFloat, kMaxIntAsFloat,
+                        kMaxIntAsFloat)},
+      {"tiny", RectF(0.5f, 0.5f, 1e-30f, 1e-30f)},
+      {"empty", RectF(1, 2, 0, 0)},
+  };
+}
+
+std::vector<CubicBezierEdgeCase> GetCubicBezierEdgeCases() {
+  constexpr double kMaxDouble = std::numeric_limits<double>::max();
+  return {
+      // The x derivative vanishes at t = 0.5.
+      {"inflection", 1, 0, 0, 1},
+      // The x derivative vanishes at t = 0 and t = 1.
+      {"vertical_gradient", 0, 1, 1, 0},
+      {"overshoot", 0, 4, 1, -3},
+      {"max_y", 0.5, kMaxDouble, 0.5, kMaxDouble},
+      {"lowest_y", 0, -kMaxDouble, 1, 1},
+  };
+}
+
+std::vector<TransformOperationsEdgeCase> GetTransformOperationsEdgeCases() {
+  std::vector<TransformOperationsEdgeCase> cases;
+  auto add = [&cases](const char* name) -> TransformOperationsEdgeCase& {
+    return cases.emplace_back(name);
+  };
+
+  TransformOperationsEdgeCase& zero_axis = add("rotate_about_zero_axis");
+  zero_axis.from.AppendRotate(0, 0, 0, 0);
+  zero_axis.to.AppendRotate(0, 0, 0, 360);
+
+  TransformOperationsEdgeCase& full_turn = add("full_turn");
+  full_turn.from.AppendRotate(1, 1, 1, 0);
+  full_turn.to.AppendRotate(1, 1, 1, 360);
+
+  TransformOperationsEdgeCase& reverse_turn = add("reverse_turn");
+  reverse_turn.from.AppendRotate(-1, 2, 3, 180);
+  reverse_turn.to.AppendRotate(-1, 2, 3, -220);
+
+  TransformOperationsEdgeCase& to_infinity = add("perspective_to_infinity");
+  to_infinity.from.AppendPerspective(800);
+  to_infinity.to.AppendPerspective(std::numeric_limits<float>::infinity());
+
+  TransformOperationsEdgeCase& zero_scale = add("zero_scale");
+  zero_scale.from.AppendScale(0, 0, 0);
+  zero_scale.to.AppendScale(2, -4, 5);
+  return cases;
+}
+
+}  // namespace gfx
@@ -0,0 +1,84 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TEST_GEOMETRY_EDGE_CASES_H_
+#define UI_GFX_GEOMETRY_TEST_GEOMETRY_EDGE_CASES_H_
+
+#include <vector>
+
+#include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/transform_operations.h"
+
+namespace gfx {
+
+// The degenerate inputs that the geometry unit tests check, e.g. singular and
+// near-singular matrices, points behind the viewer and values near the limits
+// of their types. Both the unit tests and geometry_perftests draw from these,
+// so that optimizations are measured against the inputs that take the slow
+// paths, e.g. the bisection of CubicBezier::Solve() and the clamping of
+// Transform::ProjectQuad(), and not only against well-behaved ones.
+//
+// Each case has a name, for test failures and benchmark labels.
+
+// The rect whose corners TransformEdgeCase::clamped_corners counts.
+inline constexpr RectF kEdgeCaseRect(0, 0, 100, 100);
+
+struct TransformEdgeCase {
+  const char* name;
+  Transform transform;
+  bool invertible;
+  // How many corners of kEdgeCaseRect are behind the viewer, so that
+  // Transform::ProjectPoint() clamps them.
+  int clamped_corners;
+};
+
+// Transforms that are singular, nearly singular, have an extreme perspective,
+// map some or all of kEdgeCaseRect behind the viewer, or have components near
+// the limits of float.
+std::vector<TransformEdgeCase> GetTransformEdgeCases();
+
+struct RectEdgeCase {
+  const char* name;
+  Rect rect;
+};
+
+// Rects whose right() or bottom() would overflow int, and empty rects.
+std::vector<RectEdgeCase> GetRectEdgeCases();
+
+struct RectFEdgeCase {
+  const char* name;
+  RectF rect;
+};
+
+// RectFs that are huge, tiny or empty, or don't fit in a Rect.
+std::vector<RectFEdgeCase> GetRectFEdgeCases();
+
+struct CubicBezierEdgeCase {
+  const char* name;
+  double x1;
+  double y1;
+  double x2;
+  double y2;
+};
+
+// Control points of CubicBeziers whose x derivative vanishes somewhere in
+// [0, 1], so that solving for some x falls back to bisection, or whose y
+// control points are huge.
+std::vector<CubicBezierEdgeCase> GetCubicBezierEdgeCases();
+
+struct TransformOperationsEdgeCase {
+  const char* name;
+  TransformOperations from;
+  TransformOperations to;
+};
+
+// Pairs of TransformOperations whose blended bounds are hard to compute, e.g.
+// rotations about a zero axis, full turns and perspectives to infinity.
+std::vector<TransformOperationsEdgeCase> GetTransformOperationsEdgeCases();
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TEST_GEOMETRY_EDGE_CASES_H_
@@ -0,0 +1,108 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/test/geometry_training_workload.h"
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "base/numerics/checked_math.h"
+#include "base/numerics/clamped_math.h"
+#include "base/numerics/safe_conversions.h"
+#include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/cubic_bezier.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/test/geometry_edge_cases.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+namespace {
+
+double RunEdgeCases(const std::vector<TransformEdgeCase>& transforms,
+                    const std::vector<CubicBezierEdgeCase>& beziers,
+                    const std::vector<TransformOperationsEdgeCase>& operations,
+                    const std::vector<RectEdgeCase>& rects,
+                    const std::vector<RectFEdgeCase>& rect_fs) {
+  double checksum = 0;
+  Transform rotation;
+  rotation.Rotate(30);
+  for (const TransformEdgeCase& edge_case : transforms) {
+    const RectF rect = edge_case.transform.MapRect(kEdgeCaseRect);
+    const QuadF quad = edge_case.transform.ProjectQuad(QuadF(kEdgeCaseRect));
+    Transform inverse;
+    checksum += edge_case.transform.GetInverse(&inverse);
+    Transform blended = rotation;
+    checksum += blended.Blend(edge_case.transform, 0.25);
+    checksum += rect.x() + quad.p3().y() + inverse.rc(0, 0) + blended.rc(0, 1);
+  }
+  // As animations do on successive frames.
+  for (const CubicBezierEdgeCase& edge_case : beziers) {
+    const CubicBezier curve(edge_case.x1, edge_case.y1, edge_case.x2,
+                            edge_case.y2);
+    for (int i = 0; i <= 100; ++i) {
+      checksum += curve.Solve(i / 100.0);
+    }
+  }
+  const BoxF box(200, 500, 100, 100, 300, 200);
+  for (const TransformOperationsEdgeCase& edge_case : operations) {
+    BoxF bounds;
+    checksum += edge_case.to.BlendedBoundsForBox(box, edge_case.from, -0.25f,
+                                                 1.25f, &bounds);
+    checksum += bounds.x() +
+                edge_case.to.Blend(edge_case.from, 0.5f).Apply().rc(0, 0);
+  }
+  for (const RectEdgeCase& edge_case : rects) {
+    Rect outset = edge_case.rect;
+    outset.Outset(10);
+    checksum += outset.right();
+  }
+  for (const RectFEdgeCase& edge_case : rect_fs) {
+    checksum += ToEnclosingRect(edge_case.rect).bottom();
+  }
+  return checksum;
+}
+
+// The clamped and checked arithmetic of the conversions of geometry, on
+// values of which some overflow.
+double RunNumerics(std::span<const GeometryTraceCall> trace_calls) {
+  double checksum = 0;
+  for (const GeometryTraceCall& call : trace_calls) {
+    const float x = call.rect.x() * 1e6f;
+    const int value = base::saturated_cast<int>(x);
+    checksum += static_cast<int>(
+        base::ClampAdd(value, base::ClampRound(call.rect.width())));
+    checksum += static_cast<int>(base::ClampMul(value, 3));
+    checksum += static_cast<int32_t>(
+        (base::CheckedNumeric<int32_t>(value) * 1000).ValueOrDefault(0));
+  }
+  return checksum;
+}
+
+}  // namespace
+
+double RunGeometryTrainingWorkload(
+    std::span<const GeometryTraceCall> trace_calls,
+    int rounds) {
+  const std::vector<TransformEdgeCase> transforms = GetTransformEdgeCases();
+  const std::vector<CubicBezierEdgeCase> beziers = GetCubicBezierEdgeCases();
+  const std::vector<TransformOperationsEdgeCase> operations =
+      GetTransformOperationsEdgeCases();
+  const std::vector<RectEdgeCase> rects = GetRectEdgeCases();
+  const std::vector<RectFEdgeCase> rect_fs = GetRectFEdgeCases();
+
+  double checksum = 0;
+  for (int round = 0; round < rounds; ++round) {
+    for (const GeometryTraceCall& call : trace_calls) {
+      checksum += ReplayGeometryCall(call);
+    }
+    checksum += RunEdgeCases(transforms, beziers, operations, rects, rect_fs);
+    checksum += RunNumerics(trace_calls);
+  }
+  return checksum;
+}
+
+}  // namespace gfx
@@ -0,0 +1,30 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TEST_GEOMETRY_TRAINING_WORKLOAD_H_
+#define UI_GFX_GEOMETRY_TEST_GEOMETRY_TRAINING_WORKLOAD_H_
+
+#include <span>
+
+#include "ui/gfx/geometry/geometry_trace.h"
+
+namespace gfx {
+
+// A workload to train the PGO and BOLT profiles of the geometry code with,
+// so that its hot paths, e.g. Matrix44::SetConcat() and
+// CubicBezier::SolveCurveX(), are laid out for their own calls. Each round
+// replays |trace_calls|, from a recorded trace or MakeSyntheticGeometryTrace(),
+// for the common paths in the mix that pages have, then the cases of
+// test/geometry_edge_cases.h once, for the slow paths, and the clamped and
+// checked arithmetic that the conversions of the results use.
+//
+// Returns a checksum of the results, so that the calls can't be optimized
+// away.
+double RunGeometryTrainingWorkload(
+    std::span<const GeometryTraceCall> trace_calls,
+    int rounds);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TEST_GEOMETRY_TRAINING_WORKLOAD_H_
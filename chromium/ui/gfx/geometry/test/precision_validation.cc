@@ -0,0 +1,271 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/test/precision_validation.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+
+#include "base/strings/stringprintf.h"
+#include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/sin_cos_degrees.h"
+#include "ui/gfx/geometry/test/geometry_edge_cases.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/transform_f.h"
+#include "ui/gfx/geometry/transform_operations.h"
+#include "ui/gfx/geometry/vector3d_f.h"
+
+namespace gfx {
+
+namespace {
+
+// Generates the random inputs.
+class RandomInputs {
+ public:
+  explicit RandomInputs(uint32_t seed) : engine_(seed) {}
+
+  double Uniform(double min, double max) {
+    return std::uniform_real_distribution<double>(min, max)(engine_);
+  }
+
+  RectF MakeRect() {
+    return RectF(Uniform(-1000, 1000), Uniform(-1000, 1000), Uniform(0, 1000),
+                 Uniform(0, 1000));
+  }
+
+  Vector3dF MakeAxis() {
+    return Vector3dF(Uniform(-1, 1), Uniform(-1, 1), Uniform(-1, 1));
+  }
+
+  // Returns a transform with a random translation, rotation and scale, in 2d
+  // or 3d, and with or without perspective.
+  Transform MakeTransform() {
+    Transform transform;
+    const int kind = std::uniform_int_distribution<int>(0, 2)(engine_);
+    if (kind == 2) {
+      transform.ApplyPerspectiveDepth(Uniform(100, 2000));
+    }
+    transform.Translate3d(Uniform(-500, 500), Uniform(-500, 500),
+                          kind ? Uniform(-100, 100) : 0);
+    if (kind) {
+      transform.RotateAbout(MakeAxis(), Uniform(-80, 80));
+    } else {
+      transform.Rotate(Uniform(-180, 180));
+    }
+    transform.Scale(Uniform(0.1, 4), Uniform(0.1, 4));
+    return transform;
+  }
+
+ private:
+  std::mt19937 engine_;
+};
+
+// Returns the error of |value| relative to |reference|, or the absolute error
+// where |reference| is smaller than 1.
+double RelativeError(double value, double reference) {
+  if (value == reference) {
+    return 0;
+  }
+  return std::abs(value - reference) / std::max(1.0, std::abs(reference));
+}
+
+double RectError(const RectF& rect, const RectF& reference) {
+  return std::max({RelativeError(rect.x(), reference.x()),
+                   RelativeError(rect.y(), reference.y()),
+                   RelativeError(rect.right(), reference.right()),
+                   RelativeError(rect.bottom(), reference.bottom())});
+}
+
+void AddTransformFSample(const Transform& transform,
+                         const RectF& rect,
+                         PrecisionReport& report) {
+  const RectF reference = transform.MapRect(rect);
+  const RectF mapped = TransformF(transform).MapRect(rect);
+  report.Add(RectError(mapped, reference),
+             ToEnclosingRect(mapped) != ToEnclosingRect(reference));
+}
+
+void AddCubicBezierSample(const CubicBezierLUT& table,
+                          double x,
+                          PrecisionReport& report) {
+  const double reference = table.bezier().Solve(x);
+  const double value = table.Solve(x);
+  report.Add(RelativeError(value, reference),
+             std::lround(value * kPrecisionTravelPixels) !=
+                 std::lround(reference * kPrecisionTravelPixels));
+}
+
+// Returns the rounded output of SinCos samples.
+Rect RotatedRect(const SinCos& sin_cos) {
+  const Transform rotation = Transform::Affine(sin_cos.cos, sin_cos.sin,
+                                               -sin_cos.sin, sin_cos.cos, 0, 0);
+  return ToEnclosingRect(rotation.MapRect(RectF(1000, 0, 100, 100)));
+}
+
+BoxF BlendedBounds(const TransformOperations& from,
+                   const TransformOperations& to,
+                   double tolerance) {
+  const BoxF box(200, 500, 100, 100, 300, 200);
+  BoxF bounds;
+  if (!to.BlendedBoundsForBox(box, from, 0, 1, &bounds, tolerance)) {
+    return BoxF();
+  }
+  return bounds;
+}
+
+void AddRotationBoundsSample(const TransformOperations& from,
+                             const TransformOperations& to,
+                             double tolerance,
+                             PrecisionReport& report) {
+  const BoxF reference = BlendedBounds(from, to, 0);
+  const BoxF bounds = BlendedBounds(from, to, tolerance);
+  const double error = std::max(
+      {std::abs(bounds.x() - reference.x()),
+       std::abs(bounds.y() - reference.y()),
+       std::abs(bounds.z() - reference.z()),
+       std::abs(bounds.right() - reference.right()),
+       std::abs(bounds.bottom() - reference.bottom()),
+       std::abs(bounds.front() - reference.front())});
+  auto extent = [](const BoxF& box) {
+    return ToEnclosingRect(RectF(box.x(), box.y(), box.width(), box.height()));
+  };
+  report.Add(error, extent(bounds) != extent(reference));
+}
+
+}  // namespace
+
+void PrecisionReport::Add(double error, bool rounded_diverged) {
+  ++samples;
+  max_error = std::max(max_error, error);
+  total_error += error;
+  rounded_divergences += rounded_diverged;
+}
+
+std::string PrecisionReport::ToString() const {
+  return base::StringPrintf(
+      "%s: samples=%zu max_error=%g mean_error=%g rounded_divergences=%zu",
+      name.c_str(), samples, max_error, mean_error(), rounded_divergences);
+}
+
+PrecisionReport ValidateTransformF(const PrecisionValidationOptions& options) {
+  PrecisionReport report;
+  report.name = "transform_f";
+  RandomInputs random(options.seed);
+  for (size_t i = 0; i < options.random_samples; ++i) {
+    const Transform transform = random.MakeTransform();
+    AddTransformFSample(transform, random.MakeRect(), report);
+    AddTransformFSample(transform, kEdgeCaseRect, report);
+  }
+  for (const TransformEdgeCase& edge_case : GetTransformEdgeCases()) {
+    AddTransformFSample(edge_case.transform, kEdgeCaseRect, report);
+  }
+  return report;
+}
+
+PrecisionReport ValidateCubicBezierLUT(
+    const PrecisionValidationOptions& options,
+    size_t size,
+    CubicBezierLUT::Interpolation interpolation) {
+  PrecisionReport report;
+  report.name = base::StringPrintf(
+      "cubic_bezier_lut_%zu_%s", size,
+      interpolation == CubicBezierLUT::Interpolation::kLinear ? "linear"
+                                                              : "hermite");
+  RandomInputs random(options.seed);
+  // 100 random curves share the samples.
+  constexpr size_t kCurves = 100;
+  for (size_t i = 0; i < kCurves; ++i) {
+    const CubicBezierLUT table(
+        CubicBezier(random.Uniform(0, 1), random.Uniform(-1, 2),
+                    random.Uniform(0, 1), random.Uniform(-1, 2)),
+        size, interpolation);
+    for (size_t j = 0; j < options.random_samples / kCurves; ++j) {
+      AddCubicBezierSample(table, random.Uniform(0, 1), report);
+    }
+  }
+  for (const CubicBezierEdgeCase& edge_case : GetCubicBezierEdgeCases()) {
+    // Curves that overflow to huge values aren't tabulated in practice.
+    if (std::max(std::abs(edge_case.y1), std::abs(edge_case.y2)) > 1e6) {
+      continue;
+    }
+    const CubicBezierLUT table(
+        CubicBezier(edge_case.x1, edge_case.y1, edge_case.x2, edge_case.y2),
+        size, interpolation);
+    for (int i = 0; i <= 100; ++i) {
+      AddCubicBezierSample(table, i / 100.0, report);
+    }
+  }
+  return report;
+}
+
+PrecisionReport ValidateSinCosDegreesMany(
+    const PrecisionValidationOptions& options) {
+  PrecisionReport report;
+  report.name = "sin_cos_degrees_many";
+  RandomInputs random(options.seed);
+  std::vector<double> degrees;
+  for (size_t i = 0; i < options.random_samples; ++i) {
+    degrees.push_back(i % 2 ? random.Uniform(-720, 720)
+                            : random.Uniform(-9e7, 9e7));
+  }
+  for (int i = -16; i <= 16; ++i) {
+    degrees.push_back(45.0 * i);
+  }
+  std::vector<SinCos> results(degrees.size());
+  SinCosDegreesMany(degrees, results);
+  for (size_t i = 0; i < degrees.size(); ++i) {
+    const SinCos reference = SinCosDegrees(degrees[i]);
+    report.Add(std::max(std::abs(results[i].sin - reference.sin),
+                        std::abs(results[i].cos - reference.cos)),
+               RotatedRect(results[i]) != RotatedRect(reference));
+  }
+  return report;
+}
+
+PrecisionReport ValidateConservativeRotationBounds(
+    const PrecisionValidationOptions& options,
+    double tolerance) {
+  PrecisionReport report;
+  report.name =
+      base::StringPrintf("conservative_rotation_bounds_%g", tolerance);
+  RandomInputs random(options.seed);
+  for (size_t i = 0; i < options.random_samples; ++i) {
+    const Vector3dF axis = random.MakeAxis();
+    const double from_degrees = random.Uniform(-360, 360);
+    TransformOperations from;
+    from.AppendRotate(axis.x(), axis.y(), axis.z(), from_degrees);
+    TransformOperations to;
+    to.AppendRotate(axis.x(), axis.y(), axis.z(),
+                    from_degrees + random.Uniform(-180, 180));
+    AddRotationBoundsSample(from, to, tolerance, report);
+  }
+  for (const TransformOperationsEdgeCase& edge_case :
+       GetTransformOperationsEdgeCases()) {
+    AddRotationBoundsSample(edge_case.from, edge_case.to, tolerance, report);
+  }
+  return report;
+}
+
+std::vector<PrecisionReport> RunPrecisionValidation(
+    const PrecisionValidationOptions& options) {
+  std::vector<PrecisionReport> reports;
+  reports.push_back(ValidateTransformF(options));
+  for (size_t size : {16u, 64u}) {
+    for (auto interpolation : {CubicBezierLUT::Interpolation::kLinear,
+                               CubicBezierLUT::Interpolation::kCubicHermite}) {
+      reports.push_back(ValidateCubicBezierLUT(options, size, interpolation));
+    }
+  }
+  reports.push_back(ValidateSinCosDegreesMany(options));
+  for (double tolerance : {0.5, 2.0}) {
+    reports.push_back(ValidateConservativeRotationBounds(options, tolerance));
+  }
+  return reports;
+}
+
+}  // namespace gfx
@@ -0,0 +1,94 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TEST_PRECISION_VALIDATION_H_
+#define UI_GFX_GEOMETRY_TEST_PRECISION_VALIDATION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "ui/gfx/geometry/cubic_bezier.h"
+
+namespace gfx {
+
+// A harness that runs the fast paths of gfx geometry which trade accuracy for
+// speed against the double precision implementations that they approximate,
+// over randomized inputs and the edge cases of geometry_edge_cases.h, and
+// reports how far they diverge:
+// - TransformF::MapRect() against Transform::MapRect();
+// - CubicBezierLUT::Solve() against CubicBezier::Solve();
+// - SinCosDegreesMany() against SinCosDegrees();
+// - TransformOperations::BlendedBoundsForBox() of rotations with a tolerance
+//   against the exact bounds.
+// Besides the error, each reports how often it changes the rounded output
+// that the callers use, e.g. ToEnclosingRect() of a mapped rect, as a
+// difference that disappears in rounding doesn't matter to them.
+
+struct PrecisionReport {
+  // Adds a sample whose error is |error| and whose rounded output differs
+  // from that of the reference if |rounded_diverged|.
+  void Add(double error, bool rounded_diverged);
+
+  double mean_error() const { return samples ? total_error / samples : 0; }
+
+  // Returns e.g. "transform_f: samples=1000 max_error=1e-07
+  // mean_error=1e-08 rounded_divergences=2".
+  std::string ToString() const;
+
+  std::string name;
+  size_t samples = 0;
+  // The errors are relative to the reference values, or absolute where those
+  // are smaller than 1, unless the function says otherwise.
+  double max_error = 0;
+  double total_error = 0;
+  size_t rounded_divergences = 0;
+};
+
+struct PrecisionValidationOptions {
+  // The random inputs are the same for the same seed.
+  uint32_t seed = 0;
+  size_t random_samples = 1000;
+};
+
+// Maps random rects and kEdgeCaseRect with random 2d, 3d and perspective
+// transforms, and kEdgeCaseRect with the TransformEdgeCases. The rounded
+// output is ToEnclosingRect() of the mapped rect.
+PrecisionReport ValidateTransformF(const PrecisionValidationOptions& options);
+
+// Solves random x in [0, 1] for random curves, and evenly spaced x for the
+// CubicBezierEdgeCases whose y aren't huge, with tables of |size| entries.
+// The rounded output is the pixel of a translation by the value over
+// kPrecisionTravelPixels.
+inline constexpr double kPrecisionTravelPixels = 1000;
+PrecisionReport ValidateCubicBezierLUT(
+    const PrecisionValidationOptions& options,
+    size_t size,
+    CubicBezierLUT::Interpolation interpolation);
+
+// Computes the sines and cosines of random angles, within a few turns and up
+// to the range that isn't reduced with fmod(), and of the multiples of 45
+// degrees. The error is absolute. The rounded output is ToEnclosingRect() of
+// a 100x100 rect 1000 pixels from the origin, rotated by the angle.
+PrecisionReport ValidateSinCosDegreesMany(
+    const PrecisionValidationOptions& options);
+
+// Bounds a box rotated about random axes through random arcs, and blended
+// with the TransformOperationsEdgeCases, with |tolerance|. The error is the
+// absolute difference of the sides of the boxes, which the tolerance bounds.
+// The rounded output is ToEnclosingRect() of the x and y extent.
+PrecisionReport ValidateConservativeRotationBounds(
+    const PrecisionValidationOptions& options,
+    double tolerance);
+
+// Runs all of the above, with tables of 16 and 64 entries of both
+// interpolations, and tolerances of 0.5 and 2 pixels.
+std::vector<PrecisionReport> RunPrecisionValidation(
+    const PrecisionValidationOptions& options);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TEST_PRECISION_VALIDATION_H_
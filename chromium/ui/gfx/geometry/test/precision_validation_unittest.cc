@@ -0,0 +1,64 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/test/precision_validation.h"
+
+#include <limits>
+#include <string>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace gfx {
+
+// Records the reports in the test results, e.g. in the XML of
+// --gtest_output=xml, to compare the fast paths across devices.
+TEST(PrecisionValidationTest, RecordReports) {
+  for (const PrecisionReport& report : RunPrecisionValidation({})) {
+    SCOPED_TRACE(report.name);
+    EXPECT_GT(report.samples, 0u);
+    EXPECT_LE(report.mean_error(), report.max_error);
+    ::testing::Test::RecordProperty(report.name, report.ToString());
+  }
+}
+
+TEST(PrecisionValidationTest, SameSeedSameReport) {
+  PrecisionValidationOptions options;
+  options.seed = 42;
+  options.random_samples = 100;
+  const std::string report = ValidateTransformF(options).ToString();
+  EXPECT_EQ(report, ValidateTransformF(options).ToString());
+  options.seed = 43;
+  EXPECT_NE(report, ValidateTransformF(options).ToString());
+}
+
+// The documented bounds of the fast paths hold.
+TEST(PrecisionValidationTest, Bounds) {
+  const PrecisionValidationOptions options;
+
+  PrecisionReport sin_cos = ValidateSinCosDegreesMany(options);
+  EXPECT_LE(sin_cos.max_error, std::numeric_limits<double>::epsilon());
+  EXPECT_EQ(0u, sin_cos.rounded_divergences);
+
+  for (double tolerance : {0.5, 2.0}) {
+    PrecisionReport bounds =
+        ValidateConservativeRotationBounds(options, tolerance);
+    // The boxes are floats.
+    EXPECT_LE(bounds.max_error, tolerance * (1 + 1e-4)) << tolerance;
+  }
+
+  EXPECT_LT(ValidateTransformF(options).max_error, 1e-4);
+
+  // Hermite interpolation is more accurate for the same size.
+  for (size_t size : {16u, 64u}) {
+    EXPECT_LT(ValidateCubicBezierLUT(
+                  options, size, CubicBezierLUT::Interpolation::kCubicHermite)
+                  .mean_error(),
+              ValidateCubicBezierLUT(options, size,
+                                     CubicBezierLUT::Interpolation::kLinear)
+                  .mean_error())
+        << size;
+  }
+}
+
+}  // namespace gfx
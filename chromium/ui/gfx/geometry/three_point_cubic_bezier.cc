@@ -5,13 +5,34 @@
 #include "ui/gfx/geometry/three_point_cubic_bezier.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 
 #include "base/check_op.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
 
 namespace gfx {
 
+namespace {
+
+template <typename Curve>
+double SolveThreePoint(const Curve& first_curve,
+                       const Curve& second_curve,
+                       double midpointx,
+                       double midpointy,
+                       double x) {
+  const bool in_first_curve = x < midpointx;
+  const double scaled_x = (x - (in_first_curve ? 0.0 : midpointx)) /
+                          (in_first_curve ? midpointx : (1 - midpointx));
+  if (in_first_curve) {
+    return first_curve.Solve(scaled_x) * midpointy;
+  }
+  return second_curve.Solve(scaled_x) * (1 - midpointy) + midpointy;
+}
+
+}  // namespace
+
 ThreePointCubicBezier::ThreePointCubicBezier(double p1x,
                                              double p1y,
                                              double p2x,
@@ -31,19 +52,86 @@ ThreePointCubicBezier::ThreePointCubicBezier(double p1x,
                     (p4x - midpointx) / (1 - midpointx),
                     (p4y - midpointy) / (1 - midpointy)),
       midpointx_(midpointx),
-      midpointy_(midpointy) {}
+      midpointy_(midpointy),
+      first_x_scale_(1 / midpointx),
+      second_x_scale_(1 / (1 - midpointx)),
+      second_y_scale_(1 - midpointy) {}
 
 ThreePointCubicBezier::ThreePointCubicBezier(
     const ThreePointCubicBezier& other) = default;
 
 double ThreePointCubicBezier::Solve(double x) const {
-  const bool in_first_curve = x < midpointx_;
-  const double scaled_x = (x - (in_first_curve ? 0.0 : midpointx_)) /
-                          (in_first_curve ? midpointx_ : (1 - midpointx_));
-  if (in_first_curve) {
-    return first_curve_.Solve(scaled_x) * midpointy_;
+  if (x < midpointx_) {
+    return first_curve_.Solve(x * first_x_scale_) * midpointy_;
+  }
+  return second_curve_.Solve((x - midpointx_) * second_x_scale_) *
+             second_y_scale_ +
+         midpointy_;
+}
+
+void ThreePointCubicBezier::SolveMany(base::span<const double> x,
+                                      base::span<double> y) const {
+  CheckBatchSpans(x, y);
+
+  // Splits the x values by curve in chunks, to solve each curve's values
+  // together without allocating.
+  constexpr size_t kChunkSize = 32;
+  std::array<double, kChunkSize> first_x;
+  std::array<double, kChunkSize> first_y;
+  std::array<size_t, kChunkSize> first_index;
+  std::array<double, kChunkSize> second_x;
+  std::array<double, kChunkSize> second_y;
+  std::array<size_t, kChunkSize> second_index;
+  for (size_t start = 0; start < x.size(); start += kChunkSize) {
+    const size_t end = std::min(x.size(), start + kChunkSize);
+    size_t first_size = 0;
+    size_t second_size = 0;
+    for (size_t i = start; i < end; ++i) {
+      if (x[i] < midpointx_) {
+        first_index[first_size] = i;
+        first_x[first_size++] = x[i] * first_x_scale_;
+      } else {
+        second_index[second_size] = i;
+        second_x[second_size++] = (x[i] - midpointx_) * second_x_scale_;
+      }
+    }
+    first_curve_.SolveMany(base::span(first_x).first(first_size),
+                           base::span(first_y).first(first_size));
+    second_curve_.SolveMany(base::span(second_x).first(second_size),
+                            base::span(second_y).first(second_size));
+    for (size_t i = 0; i < first_size; ++i) {
+      y[first_index[i]] = first_y[i] * midpointy_;
+    }
+    for (size_t i = 0; i < second_size; ++i) {
+      y[second_index[i]] = second_y[i] * second_y_scale_ + midpointy_;
+    }
   }
-  return second_curve_.Solve(scaled_x) * (1 - midpointy_) + midpointy_;
+}
+
+CompactThreePointCubicBezier::CompactThreePointCubicBezier(double p1x,
+                                                           double p1y,
+                                                           double p2x,
+                                                           double p2y,
+                                                           double midpointx,
+                                                           double midpointy,
+                                                           double p3x,
+                                                           double p3y,
+                                                           double p4x,
+                                                           double p4y)
+    : first_curve_(p1x / midpointx,
+                   p1y / midpointy,
+                   p2x / midpointx,
+                   p2y / midpointy),
+      second_curve_((p3x - midpointx) / (1 - midpointx),
+                    (p3y - midpointy) / (1 - midpointy),
+                    (p4x - midpointx) / (1 - midpointx),
+                    (p4y - midpointy) / (1 - midpointy)),
+      midpointx_(midpointx),
+      midpointy_(midpointy) {}
+
+double CompactThreePointCubicBezier::Solve(double x) const {
+  return SolveThreePoint(first_curve_, second_curve_, midpointx_, midpointy_,
+                         x);
 }
 
 }  // namespace gfx
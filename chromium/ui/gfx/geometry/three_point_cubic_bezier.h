@@ -6,6 +6,7 @@
 #define UI_GFX_GEOMETRY_THREE_POINT_CUBIC_BEZIER_H_
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/cubic_bezier.h"
 
 namespace gfx {
@@ -33,6 +34,9 @@ class COMPONENT_EXPORT(GEOMETRY) ThreePointCubicBezier {
 
   // Evaluates y at the given x.
   double Solve(double x) const;
+  // Sets each y[i] to Solve(x[i]), with the same result. The x values of each
+  // curve are solved together with CubicBezier::SolveMany().
+  void SolveMany(base::span<const double> x, base::span<double> y) const;
 
  private:
   CubicBezier first_curve_;
@@ -40,6 +44,39 @@ class COMPONENT_EXPORT(GEOMETRY) ThreePointCubicBezier {
 
   double midpointx_;
   double midpointy_;
+
+  // Precomputed to map x into each curve and y out of it with multiplications
+  // instead of divisions.
+  double first_x_scale_;
+  double second_x_scale_;
+  double second_y_scale_;
+};
+
+// The same curve as ThreePointCubicBezier, made of CompactCubicBeziers and
+// with the midpoint in floats, for holding many curves.
+class COMPONENT_EXPORT(GEOMETRY) CompactThreePointCubicBezier {
+ public:
+  // See ThreePointCubicBezier.
+  CompactThreePointCubicBezier(double p1x,
+                               double p1y,
+                               double p2x,
+                               double p2y,
+                               double midpointx,
+                               double midpointy,
+                               double p3x,
+                               double p3y,
+                               double p4x,
+                               double p4y);
+
+  // Evaluates y at the given x.
+  double Solve(double x) const;
+
+ private:
+  CompactCubicBezier first_curve_;
+  CompactCubicBezier second_curve_;
+
+  float midpointx_;
+  float midpointy_;
 };
 
 }  // namespace gfx
@@ -5,6 +5,7 @@
 #include "ui/gfx/geometry/three_point_cubic_bezier.h"
 
 #include <cmath>
+#include <vector>
 
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -40,5 +41,36 @@ TEST(ThreePointCubicBezierTest, Basic) {
   EXPECT_NEAR(function.Solve(1), 1, epsilon);
 }
 
+TEST(ThreePointCubicBezierTest, SolveMany) {
+  ThreePointCubicBezier function(0.05, 0, 0.133333, 0.06, 0.166666, 0.4,
+                                 0.208333, 0.82, 0.25, 1);
+  std::vector<double> x;
+  // More than one chunk, with values of both curves interleaved.
+  for (int i = -10; i <= 110; ++i) {
+    x.push_back(i / 100.0);
+    x.push_back(1 - i / 100.0);
+  }
+
+  std::vector<double> y(x.size());
+  function.SolveMany(x, y);
+  for (size_t i = 0; i < x.size(); ++i) {
+    EXPECT_EQ(function.Solve(x[i]), y[i]) << x[i];
+  }
+}
+
+TEST(ThreePointCubicBezierTest, Compact) {
+  EXPECT_LE(4 * sizeof(CompactThreePointCubicBezier),
+            sizeof(ThreePointCubicBezier));
+
+  ThreePointCubicBezier function(0.125, 0.0, 0.375, 0.5, 0.5, 0.5, 0.625, 0.5,
+                                 0.875, 1);
+  CompactThreePointCubicBezier compact(0.125, 0.0, 0.375, 0.5, 0.5, 0.5, 0.625,
+                                       0.5, 0.875, 1);
+  for (int i = 0; i <= 100; ++i) {
+    double x = i / 100.0;
+    EXPECT_NEAR(function.Solve(x), compact.Solve(x), 1e-6) << x;
+  }
+}
+
 }  // namespace
 }  // namespace gfx
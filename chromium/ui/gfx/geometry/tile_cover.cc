@@ -0,0 +1,235 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/tile_cover.h"
+
+#include <algorithm>
+
+#include "base/check_op.h"
+#include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/rect_f.h"
+
+namespace gfx {
+
+namespace {
+
+// Divides rounding toward negative infinity, for |b| > 0.
+int FloorDivide(int a, int b) {
+  int quotient = a / b;
+  return quotient - (a % b < 0);
+}
+
+int NumTiles(int length, int tile_length) {
+  return length > 0 ? FloorDivide(length - 1, tile_length) + 1 : 0;
+}
+
+}  // namespace
+
+TileCover::TileCover(const Rect& bounds, const Size& tile_size, int border)
+    : bounds_(bounds),
+      tile_size_(tile_size),
+      border_(border),
+      num_tiles_x_(NumTiles(bounds.width(), tile_size.width())),
+      num_tiles_y_(NumTiles(bounds.height(), tile_size.height())) {
+  DCHECK(!tile_size.IsEmpty());
+  DCHECK_GE(border, 0);
+}
+
+TileCover::TileCover(const TileCover& other) = default;
+
+TileCover::~TileCover() = default;
+
+TileCover& TileCover::operator=(const TileCover& other) = default;
+
+int TileCover::TileXIndexFromPosition(int x) const {
+  return std::clamp(FloorDivide(x - bounds_.x(), tile_size_.width()), 0,
+                    std::max(num_tiles_x_ - 1, 0));
+}
+
+int TileCover::TileYIndexFromPosition(int y) const {
+  return std::clamp(FloorDivide(y - bounds_.y(), tile_size_.height()), 0,
+                    std::max(num_tiles_y_ - 1, 0));
+}
+
+Rect TileCover::TileRect(int i, int j) const {
+  DCHECK_GE(i, 0);
+  DCHECK_LT(i, num_tiles_x_);
+  DCHECK_GE(j, 0);
+  DCHECK_LT(j, num_tiles_y_);
+  Rect rect(bounds_.x() + i * tile_size_.width(),
+            bounds_.y() + j * tile_size_.height(), tile_size_.width(),
+            tile_size_.height());
+  rect.Intersect(bounds_);
+  return rect;
+}
+
+Rect TileCover::TileRectWithBorder(int i, int j) const {
+  Rect rect = TileRect(i, j);
+  rect.Outset(border_);
+  rect.Intersect(bounds_);
+  return rect;
+}
+
+TileCover::Iterator::Iterator(const TileCover& cover,
+                              const Rect& rect,
+                              Order order)
+    : Iterator(cover, rect, std::nullopt, order) {}
+
+TileCover::Iterator::Iterator(const TileCover& cover,
+                              const QuadF& quad,
+                              Order order)
+    : Iterator(cover, ToEnclosingRect(quad.BoundingBox()), quad, order) {}
+
+TileCover::Iterator::Iterator(const TileCover& cover,
+                              const Rect& rect,
+                              std::optional<QuadF> quad,
+                              Order order)
+    : cover_(cover),
+      query_rect_(IntersectRects(rect, cover.bounds())),
+      quad_(quad),
+      order_(order) {
+  if (query_rect_.IsEmpty()) {
+    done_ = true;
+    return;
+  }
+
+  // The tiles whose rects with border intersect the rect: those from the
+  // tile containing its left edge or reaching it with the border, to the
+  // tile containing its right edge or reaching it with the border.
+  const Rect& bounds = cover_.bounds();
+  const Size& tile_size = cover_.tile_size();
+  const int border = cover_.border();
+  left_ = std::max(
+      FloorDivide(query_rect_.x() - bounds.x() - border, tile_size.width()),
+      0);
+  top_ = std::max(
+      FloorDivide(query_rect_.y() - bounds.y() - border, tile_size.height()),
+      0);
+  right_ = std::min(FloorDivide(query_rect_.right() - 1 - bounds.x() + border,
+                                tile_size.width()),
+                    cover_.num_tiles_x() - 1);
+  bottom_ =
+      std::min(FloorDivide(query_rect_.bottom() - 1 - bounds.y() + border,
+                           tile_size.height()),
+               cover_.num_tiles_y() - 1);
+
+  if (order_ == Order::kRow) {
+    x_ = left_;
+    y_ = top_;
+  } else {
+    center_x_ =
+        cover_.TileXIndexFromPosition(query_rect_.CenterPoint().x());
+    center_y_ =
+        cover_.TileYIndexFromPosition(query_rect_.CenterPoint().y());
+    max_ring_ = std::max({center_x_ - left_, right_ - center_x_,
+                          center_y_ - top_, bottom_ - center_y_});
+    // The center is ring 0, a single tile, after which StartSpiralEdge()
+    // starts ring 1.
+    x_ = edge_last_ = center_x_;
+    y_ = center_y_;
+    edge_horizontal_ = true;
+    edge_ = 4;
+  }
+  if (quad_ && !quad_->IntersectsRect(RectF(this->rect()))) {
+    ++*this;
+  }
+}
+
+TileCover::Iterator::Iterator(const Iterator& other) = default;
+
+TileCover::Iterator::~Iterator() = default;
+
+TileCover::Iterator& TileCover::Iterator::operator=(const Iterator& other) =
+    default;
+
+TileCover::Iterator& TileCover::Iterator::operator++() {
+  DCHECK(!done_);
+  do {
+    Advance();
+  } while (!done_ && quad_ && !quad_->IntersectsRect(RectF(rect())));
+  return *this;
+}
+
+void TileCover::Iterator::Advance() {
+  if (order_ == Order::kRow) {
+    if (++x_ > right_) {
+      x_ = left_;
+      done_ = ++y_ > bottom_;
+    }
+    return;
+  }
+  int& index = edge_horizontal_ ? x_ : y_;
+  if (index == edge_last_) {
+    StartSpiralEdge();
+  } else {
+    index += edge_step_;
+  }
+}
+
+void TileCover::Iterator::StartSpiralEdge() {
+  while (true) {
+    if (edge_ == 4) {
+      edge_ = 0;
+      if (++ring_ > max_ring_) {
+        done_ = true;
+        return;
+      }
+    }
+    // Each edge of ring k has 2k tiles, and ends before the next corner.
+    const int k = ring_;
+    int fixed;
+    int first;
+    int last;
+    switch (edge_++) {
+      case 0:
+        edge_horizontal_ = true;
+        fixed = center_y_ - k;
+        first = center_x_ - k;
+        last = center_x_ + k - 1;
+        break;
+      case 1:
+        edge_horizontal_ = false;
+        fixed = center_x_ + k;
+        first = center_y_ - k;
+        last = center_y_ + k - 1;
+        break;
+      case 2:
+        edge_horizontal_ = true;
+        fixed = center_y_ + k;
+        first = center_x_ + k;
+        last = center_x_ - k + 1;
+        break;
+      default:
+        edge_horizontal_ = false;
+        fixed = center_x_ - k;
+        first = center_y_ + k;
+        last = center_y_ - k + 1;
+        break;
+    }
+    const int fixed_min = edge_horizontal_ ? top_ : left_;
+    const int fixed_max = edge_horizontal_ ? bottom_ : right_;
+    if (fixed < fixed_min || fixed > fixed_max) {
+      continue;
+    }
+    const int min = edge_horizontal_ ? left_ : top_;
+    const int max = edge_horizontal_ ? right_ : bottom_;
+    edge_step_ = first < last ? 1 : -1;
+    if (edge_step_ > 0) {
+      first = std::max(first, min);
+      last = std::min(last, max);
+    } else {
+      first = std::min(first, max);
+      last = std::max(last, min);
+    }
+    if ((last - first) * edge_step_ < 0) {
+      continue;
+    }
+    edge_last_ = last;
+    (edge_horizontal_ ? x_ : y_) = first;
+    (edge_horizontal_ ? y_ : x_) = fixed;
+    return;
+  }
+}
+
+}  // namespace gfx
@@ -0,0 +1,141 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TILE_COVER_H_
+#define UI_GFX_GEOMETRY_TILE_COVER_H_
+
+#include <optional>
+
+#include "base/component_export.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/size.h"
+
+namespace gfx {
+
+// A grid of tiles of tile_size() covering bounds(), for splitting rects into
+// tiles to raster or upload. Tile (i, j) is the rect at
+// bounds().origin() + (i * tile_size().width(), j * tile_size().height()),
+// clipped to bounds(). With a border, each tile is also extended by border()
+// into its neighbours, e.g. for the texels that filtering samples.
+//
+// Iterators enumerate the tiles intersecting a rect or a quad, in row order
+// or in a spiral around the tile at their center, without allocating:
+//
+//   for (TileCover::Iterator it(cover, visible_rect); it; ++it) {
+//     Raster(it.index_x(), it.index_y(), it.rect(), it.visible_rect());
+//   }
+class COMPONENT_EXPORT(GEOMETRY) TileCover {
+ public:
+  enum class Order {
+    // Row by row, from left to right.
+    kRow,
+    // From the tile at the center, clockwise in rings of growing distance.
+    kSpiral,
+  };
+
+  // Defined below, since it holds a TileCover.
+  class Iterator;
+
+  // |tile_size| must not be empty, and |border| must not be negative.
+  TileCover(const Rect& bounds, const Size& tile_size, int border = 0);
+  TileCover(const TileCover& other);
+  ~TileCover();
+
+  TileCover& operator=(const TileCover& other);
+
+  const Rect& bounds() const { return bounds_; }
+  const Size& tile_size() const { return tile_size_; }
+  int border() const { return border_; }
+  int num_tiles_x() const { return num_tiles_x_; }
+  int num_tiles_y() const { return num_tiles_y_; }
+
+  // Returns the index of the column or row of the tile containing |x| or
+  // |y|, clamped to the tiles.
+  int TileXIndexFromPosition(int x) const;
+  int TileYIndexFromPosition(int y) const;
+
+  // Returns the rect of tile (i, j), without or with the border, clipped to
+  // bounds().
+  Rect TileRect(int i, int j) const;
+  Rect TileRectWithBorder(int i, int j) const;
+
+ private:
+  Rect bounds_;
+  Size tile_size_;
+  int border_;
+  int num_tiles_x_;
+  int num_tiles_y_;
+};
+
+class COMPONENT_EXPORT(GEOMETRY) TileCover::Iterator {
+ public:
+  // Iterates over the tiles whose rect() intersects |rect|.
+  Iterator(const TileCover& cover,
+           const Rect& rect,
+           Order order = Order::kRow);
+  // Iterates over the tiles whose rect() intersects |quad|, as
+  // QuadF::IntersectsRect() computes.
+  Iterator(const TileCover& cover,
+           const QuadF& quad,
+           Order order = Order::kRow);
+  Iterator(const Iterator& other);
+  ~Iterator();
+
+  Iterator& operator=(const Iterator& other);
+
+  explicit operator bool() const { return !done_; }
+  Iterator& operator++();
+
+  int index_x() const { return x_; }
+  int index_y() const { return y_; }
+  // Returns the rect of the tile, with the border.
+  Rect rect() const { return cover_.TileRectWithBorder(x_, y_); }
+  // Returns the part of rect() in the rect iterated over, or in the
+  // enclosing rect of the quad.
+  Rect visible_rect() const { return IntersectRects(rect(), query_rect_); }
+
+ private:
+  Iterator(const TileCover& cover,
+           const Rect& rect,
+           std::optional<QuadF> quad,
+           Order order);
+
+  // Moves to the next tile of the index range, in the order.
+  void Advance();
+  // Moves to the start of the next non-empty edge of the spiral, within the
+  // index range.
+  void StartSpiralEdge();
+
+  TileCover cover_;
+  Rect query_rect_;
+  std::optional<QuadF> quad_;
+  Order order_;
+  bool done_ = false;
+
+  // The range of indices of the tiles intersecting |query_rect_|.
+  int left_ = 0;
+  int top_ = 0;
+  int right_ = -1;
+  int bottom_ = -1;
+
+  int x_ = 0;
+  int y_ = 0;
+
+  // The state of the spiral: the tile at its center, its current ring, and
+  // the next edge of the ring, from top to left. On the current edge, the
+  // index along it moves by |edge_step_| up to |edge_last_|.
+  int center_x_ = 0;
+  int center_y_ = 0;
+  int ring_ = 0;
+  int max_ring_ = 0;
+  int edge_ = 0;
+  int edge_last_ = 0;
+  int edge_step_ = 0;
+  bool edge_horizontal_ = false;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TILE_COVER_H_
@@ -0,0 +1,164 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/tile_cover.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+
+namespace gfx {
+
+namespace {
+
+using Indices = std::vector<std::pair<int, int>>;
+
+Indices Iterate(TileCover::Iterator it) {
+  Indices indices;
+  for (; it; ++it) {
+    indices.emplace_back(it.index_x(), it.index_y());
+  }
+  return indices;
+}
+
+// Returns the tiles whose rects with border intersect |rect|, in row order.
+Indices IntersectingTiles(const TileCover& cover, const Rect& rect) {
+  Indices indices;
+  for (int j = 0; j < cover.num_tiles_y(); ++j) {
+    for (int i = 0; i < cover.num_tiles_x(); ++i) {
+      if (cover.TileRectWithBorder(i, j).Intersects(rect)) {
+        indices.emplace_back(i, j);
+      }
+    }
+  }
+  return indices;
+}
+
+Indices Sorted(Indices indices) {
+  std::ranges::sort(indices, [](const auto& a, const auto& b) {
+    return std::pair(a.second, a.first) < std::pair(b.second, b.first);
+  });
+  return indices;
+}
+
+}  // namespace
+
+TEST(TileCoverTest, Tiles) {
+  TileCover cover(Rect(10, 20, 250, 130), Size(100, 50), 2);
+  EXPECT_EQ(3, cover.num_tiles_x());
+  EXPECT_EQ(3, cover.num_tiles_y());
+  EXPECT_EQ(Rect(10, 20, 100, 50), cover.TileRect(0, 0));
+  EXPECT_EQ(Rect(210, 120, 50, 30), cover.TileRect(2, 2));
+  EXPECT_EQ(Rect(10, 20, 102, 52), cover.TileRectWithBorder(0, 0));
+  EXPECT_EQ(Rect(108, 68, 104, 54), cover.TileRectWithBorder(1, 1));
+  EXPECT_EQ(Rect(208, 118, 52, 32), cover.TileRectWithBorder(2, 2));
+
+  EXPECT_EQ(0, cover.TileXIndexFromPosition(-100));
+  EXPECT_EQ(0, cover.TileXIndexFromPosition(109));
+  EXPECT_EQ(1, cover.TileXIndexFromPosition(110));
+  EXPECT_EQ(2, cover.TileXIndexFromPosition(1000));
+  EXPECT_EQ(1, cover.TileYIndexFromPosition(70));
+
+  TileCover empty(Rect(10, 10, 0, 100), Size(10, 10));
+  EXPECT_EQ(0, empty.num_tiles_x());
+  EXPECT_FALSE(TileCover::Iterator(empty, Rect(0, 0, 100, 100)));
+}
+
+TEST(TileCoverTest, RowOrder) {
+  TileCover cover(Rect(0, 0, 100, 100), Size(10, 10));
+  EXPECT_EQ(Indices({{1, 1}, {2, 1}, {1, 2}, {2, 2}}),
+            Iterate(TileCover::Iterator(cover, Rect(15, 15, 10, 10))));
+  // Tiles that only touch the rect don't intersect it.
+  EXPECT_EQ(Indices({{1, 1}}),
+            Iterate(TileCover::Iterator(cover, Rect(10, 10, 10, 10))));
+  EXPECT_TRUE(Iterate(TileCover::Iterator(cover, Rect(5, 5, 0, 10))).empty());
+  EXPECT_TRUE(
+      Iterate(TileCover::Iterator(cover, Rect(200, 0, 10, 10))).empty());
+
+  // A border reaches the neighbouring tiles.
+  TileCover bordered(Rect(0, 0, 100, 100), Size(10, 10), 1);
+  EXPECT_EQ(Indices({{0, 0}, {1, 0}, {2, 0}, {0, 1}, {1, 1}, {2, 1},
+                     {0, 2}, {1, 2}, {2, 2}}),
+            Iterate(TileCover::Iterator(bordered, Rect(10, 10, 10, 10))));
+}
+
+TEST(TileCoverTest, VisibleRect) {
+  TileCover cover(Rect(0, 0, 100, 100), Size(30, 30), 1);
+  TileCover::Iterator it(cover, Rect(20, 20, 20, 20));
+  ASSERT_TRUE(it);
+  EXPECT_EQ(0, it.index_x());
+  EXPECT_EQ(0, it.index_y());
+  EXPECT_EQ(Rect(0, 0, 31, 31), it.rect());
+  EXPECT_EQ(Rect(20, 20, 11, 11), it.visible_rect());
+}
+
+TEST(TileCoverTest, SpiralOrder) {
+  TileCover cover(Rect(0, 0, 100, 100), Size(10, 10));
+  // Ring 0, then ring 1 clockwise from the top left.
+  EXPECT_EQ(Indices({{5, 5}, {4, 4}, {5, 4}, {6, 4}, {6, 5}, {6, 6}, {5, 6},
+                     {4, 6}, {4, 5}}),
+            Iterate(TileCover::Iterator(cover, Rect(45, 45, 20, 20),
+                                        TileCover::Order::kSpiral)));
+}
+
+TEST(TileCoverTest, MatchesLinearScan) {
+  const Rect bounds(-17, 23, 313, 211);
+  const Rect rects[] = {Rect(-100, -100, 1000, 1000), Rect(0, 50, 1, 1),
+                        Rect(100, 30, 200, 7),        Rect(-17, 23, 40, 300),
+                        Rect(250, 200, 100, 100),     Rect(60, 60, 90, 150)};
+  for (int border : {0, 3, 12}) {
+    TileCover cover(bounds, Size(32, 24), border);
+    for (const Rect& rect : rects) {
+      SCOPED_TRACE(rect.ToString() + " border " + std::to_string(border));
+      Indices expected = IntersectingTiles(cover, rect);
+      EXPECT_EQ(expected, Iterate(TileCover::Iterator(cover, rect)));
+
+      Indices spiral = Iterate(
+          TileCover::Iterator(cover, rect, TileCover::Order::kSpiral));
+      EXPECT_EQ(expected, Sorted(spiral));
+      if (spiral.empty()) {
+        continue;
+      }
+      // The rings grow from the tile at the center.
+      int center_x = cover.TileXIndexFromPosition(
+          IntersectRects(rect, bounds).CenterPoint().x());
+      int center_y = cover.TileYIndexFromPosition(
+          IntersectRects(rect, bounds).CenterPoint().y());
+      int ring = 0;
+      for (const auto& [x, y] : spiral) {
+        int tile_ring = std::max(abs(x - center_x), abs(y - center_y));
+        EXPECT_GE(tile_ring, ring);
+        ring = tile_ring;
+      }
+    }
+  }
+}
+
+TEST(TileCoverTest, Quad) {
+  TileCover cover(Rect(0, 0, 100, 100), Size(10, 10));
+  // A diamond, whose bounding box covers tiles of its corners that it
+  // doesn't intersect.
+  QuadF quad(PointF(50, 20), PointF(80, 50), PointF(50, 80), PointF(20, 50));
+  for (auto order : {TileCover::Order::kRow, TileCover::Order::kSpiral}) {
+    Indices indices = Iterate(TileCover::Iterator(cover, quad, order));
+    Indices expected;
+    for (const auto& index : IntersectingTiles(cover, Rect(20, 20, 60, 60))) {
+      if (quad.IntersectsRect(
+              RectF(cover.TileRect(index.first, index.second)))) {
+        expected.push_back(index);
+      }
+    }
+    EXPECT_LT(expected.size(), 36u);
+    EXPECT_EQ(expected, Sorted(indices));
+  }
+}
+
+}  // namespace gfx
@@ -4,20 +4,31 @@
 
 #include "ui/gfx/geometry/transform.h"
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
 #include <ostream>
+#include <tuple>
+#include <utility>
 
 #include "base/check_op.h"
 #include "base/compiler_specific.h"
 #include "base/containers/span.h"
 #include "base/notreached.h"
 #include "base/numerics/angle_conversions.h"
+#include "base/numerics/safe_conversions.h"
+#include "base/numerics/wrapping_math.h"
 #include "base/strings/stringprintf.h"
 #include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
 #include "ui/gfx/geometry/box_f.h"
 #include "ui/gfx/geometry/clamp_float_geometry.h"
 #include "ui/gfx/geometry/decomposed_transform.h"
+#include "ui/gfx/geometry/decomposed_transform_cache.h"
 #include "ui/gfx/geometry/double4.h"
+#include "ui/gfx/geometry/float3_array.h"
 #include "ui/gfx/geometry/point3_f.h"
 #include "ui/gfx/geometry/point_conversions.h"
 #include "ui/gfx/geometry/quad_f.h"
@@ -26,6 +37,7 @@
 #include "ui/gfx/geometry/rect_conversions.h"
 #include "ui/gfx/geometry/sin_cos_degrees.h"
 #include "ui/gfx/geometry/transform_util.h"
+#include "ui/gfx/geometry/vector2d.h"
 #include "ui/gfx/geometry/vector3d_f.h"
 
 namespace gfx {
@@ -34,10 +46,33 @@ namespace {
 
 const double kEpsilon = std::numeric_limits<float>::epsilon();
 
+// To represent infinity and ensure the bounding box of ProjectQuad() is
+// accurate in both float, int and blink::LayoutUnit, projected points behind
+// the viewer are clamped to a large but not-too-large number.
+constexpr double kProjectionBigNumber =
+    1 << (std::numeric_limits<float>::digits - 1);
+
 double TanDegrees(double degrees) {
   return std::tan(base::DegToRad(degrees));
 }
 
+// Hashes the bits of |components|, with -0 as 0 so that they agree with
+// operator==.
+size_t HashComponents(base::span<const double> components) {
+  constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15u;
+  uint64_t hash = components.size();
+  for (double component : components) {
+    const uint64_t bits =
+        component == 0 ? 0u : std::bit_cast<uint64_t>(component);
+    hash = base::WrappingMul(base::RotateLeft(hash, 5) ^ bits, kMultiplier);
+  }
+  // The finalizer of MurmurHash3, so that the low bits depend on all of them.
+  hash ^= hash >> 33;
+  hash = base::WrappingMul(hash, uint64_t{0xff51afd7ed558ccdu});
+  hash ^= hash >> 33;
+  return static_cast<size_t>(hash);
+}
+
 inline bool ApproximatelyZero(double x, double tolerance) {
   return std::abs(x) <= tolerance;
 }
@@ -53,6 +88,375 @@ Matrix44 AxisTransform2dToMatrix44(const AxisTransform2d& axis_2d) {
                   axis_2d.translation().x(), axis_2d.translation().y(), 0, 1);
 }
 
+Matrix44 AffineTransform2dToMatrix44(const AffineTransform2d& affine_2d) {
+  return Matrix44(affine_2d.a(), affine_2d.b(), 0, 0,  // col 0
+                  affine_2d.c(), affine_2d.d(), 0, 0,  // col 1
+                  0, 0, 1, 0,                          // col 2
+                  affine_2d.e(), affine_2d.f(), 0, 1);
+}
+
+// See Matrix44Preserves2dAxisAlignment() below.
+bool Preserves2dAxisAlignment(double r0c0,
+                              double r0c1,
+                              double r1c0,
+                              double r1c1) {
+  int num_non_zero_in_row_0 = 0;
+  int num_non_zero_in_row_1 = 0;
+  int num_non_zero_in_col_0 = 0;
+  int num_non_zero_in_col_1 = 0;
+
+  if (std::abs(r0c0) > kEpsilon) {
+    num_non_zero_in_row_0++;
+    num_non_zero_in_col_0++;
+  }
+
+  if (std::abs(r0c1) > kEpsilon) {
+    num_non_zero_in_row_0++;
+    num_non_zero_in_col_1++;
+  }
+
+  if (std::abs(r1c0) > kEpsilon) {
+    num_non_zero_in_row_1++;
+    num_non_zero_in_col_0++;
+  }
+
+  if (std::abs(r1c1) > kEpsilon) {
+    num_non_zero_in_row_1++;
+    num_non_zero_in_col_1++;
+  }
+
+  return num_non_zero_in_row_0 <= 1 && num_non_zero_in_row_1 <= 1 &&
+         num_non_zero_in_col_0 <= 1 && num_non_zero_in_col_1 <= 1;
+}
+
+bool Matrix44Preserves2dAxisAlignment(const Matrix44& matrix) {
+  // Check whether an axis aligned 2-dimensional rect would remain axis-aligned
+  // after being transformed by |matrix| (and implicitly projected by
+  // dropping any non-zero z-values).
+  //
+  // The 4th column can be ignored because translations don't affect axis
+  // alignment. The 3rd column can be ignored because we are assuming 2d
+  // inputs, where z-values will be zero. The 3rd row can also be ignored
+  // because we are assuming 2d outputs, and any resulting z-value is dropped
+  // anyway. For the inner 2x2 portion, the only effects that keep a rect axis
+  // aligned are (1) swapping axes and (2) scaling axes. This can be checked by
+  // verifying only 1 element of every column and row is non-zero.  Degenerate
+  // cases that project the x or y dimension to zero are considered to preserve
+  // axis alignment.
+  //
+  // If the matrix does have perspective component that is affected by x or y
+  // values: The current implementation conservatively assumes that axis
+  // alignment is not preserved.
+
+  bool has_x_or_y_perspective = matrix.rc(3, 0) != 0 || matrix.rc(3, 1) != 0;
+
+  return Preserves2dAxisAlignment(matrix.rc(0, 0), matrix.rc(0, 1),
+                                  matrix.rc(1, 0), matrix.rc(1, 1)) &&
+         !has_x_or_y_perspective;
+}
+
+// Returns the same as QuadF(p1, p2', p2, p1').BoundingBox() where p1' and p2'
+// are the other two corners of the axis-aligned rect with corners p1 and p2.
+RectF BoundingBoxOfCorners(const PointF& p1, const PointF& p2) {
+  float left = std::min(p1.x(), p2.x());
+  float top = std::min(p1.y(), p2.y());
+  return RectF(left, top, std::max(p1.x(), p2.x()) - left,
+               std::max(p1.y(), p2.y()) - top);
+}
+
+// Returns true if |t| maps each axis to itself or to the other axis with a
+// scale of 1 or -1 and an integer translation, i.e. if it's a multiple of a
+// quarter turn, possibly flipped, that maps integer rects to integer rects.
+bool IsIntegerQuarterTurn(const AffineTransform2d& t) {
+  auto is_unit = [](double v) { return v == 1 || v == -1; };
+  if (!(t.b() == 0 && t.c() == 0 && is_unit(t.a()) && is_unit(t.d())) &&
+      !(t.a() == 0 && t.d() == 0 && is_unit(t.b()) && is_unit(t.c()))) {
+    return false;
+  }
+  for (double translation : {t.e(), t.f()}) {
+    if (!base::IsValueInRangeForNumericType<int>(translation) ||
+        static_cast<int>(translation) != translation) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Maps |rect| through |t|, which must be IsIntegerQuarterTurn(), by swapping
+// and negating its edges in int64_t. The result is exact up to the
+// saturation to int, while mapping RectF(rect) loses precision for large
+// coordinates.
+Rect MapRectByIntegerQuarterTurn(const AffineTransform2d& t, const Rect& rect) {
+  DCHECK(IsIntegerQuarterTurn(t));
+  const bool swaps_axes = t.a() == 0;
+  const int64_t left = rect.x();
+  const int64_t right = left + rect.width();
+  const int64_t top = rect.y();
+  const int64_t bottom = top + rect.height();
+  int64_t x_min = swaps_axes ? top : left;
+  int64_t x_max = swaps_axes ? bottom : right;
+  int64_t y_min = swaps_axes ? left : top;
+  int64_t y_max = swaps_axes ? right : bottom;
+  if ((swaps_axes ? t.c() : t.a()) < 0) {
+    std::tie(x_min, x_max) = std::pair(-x_max, -x_min);
+  }
+  if ((swaps_axes ? t.b() : t.d()) < 0) {
+    std::tie(y_min, y_max) = std::pair(-y_max, -y_min);
+  }
+  const int64_t tx = static_cast<int>(t.e());
+  const int64_t ty = static_cast<int>(t.f());
+  Rect result;
+  result.SetByBounds(base::saturated_cast<int>(x_min + tx),
+                     base::saturated_cast<int>(y_min + ty),
+                     base::saturated_cast<int>(x_max + tx),
+                     base::saturated_cast<int>(y_max + ty));
+  return result;
+}
+
+// Concatenates |m|, which must be Matrix44::IsScaleOrTranslation(), i.e. a
+// translation after a scale, to |matrix| without a general multiply. These
+// are the most common full matrix concatenations in layer trees.
+void PreConcatScaleOrTranslation(Matrix44& matrix, const Matrix44& m) {
+  DCHECK(m.IsScaleOrTranslation());
+  matrix.PreTranslate3d(m.rc(0, 3), m.rc(1, 3), m.rc(2, 3));
+  matrix.PreScale3d(m.rc(0, 0), m.rc(1, 1), m.rc(2, 2));
+}
+void PostConcatScaleOrTranslation(Matrix44& matrix, const Matrix44& m) {
+  DCHECK(m.IsScaleOrTranslation());
+  matrix.PostScale3d(m.rc(0, 0), m.rc(1, 1), m.rc(2, 2));
+  matrix.PostTranslate3d(m.rc(0, 3), m.rc(1, 3), m.rc(2, 3));
+}
+
+// The number of points that Transform::MapPoints() and MapPoints3d() map
+// before clamping their coordinates.
+constexpr size_t kMapPointsGroupSize = 16;
+
+// Maps lane i of (|x|, |y|) through the full |matrix| as
+// Transform::MapPoint() does.
+ALWAYS_INLINE void MapPointsInLanes(const Matrix44& matrix,
+                                    bool has_perspective,
+                                    Double4 x,
+                                    Double4 y,
+                                    Float4& result_x,
+                                    Float4& result_y) {
+  Double4 px = x * matrix.rc(0, 0) + y * matrix.rc(0, 1) + matrix.rc(0, 3);
+  Double4 py = x * matrix.rc(1, 0) + y * matrix.rc(1, 1) + matrix.rc(1, 3);
+  if (has_perspective) {
+    // Without perspective, w is 1 or NaN, and neither is divided by.
+    Double4 w = x * matrix.rc(3, 0) + y * matrix.rc(3, 1) + matrix.rc(3, 3);
+    Double4 abs_w = w < 0 ? -w : w;
+    auto divide = (w != 1.0) & (abs_w >= std::numeric_limits<double>::min()) &
+                  (abs_w <= std::numeric_limits<double>::max());
+    Double4 w_inverse = 1.0 / w;
+    px = divide ? px * w_inverse : px;
+    py = divide ? py * w_inverse : py;
+  }
+  result_x = ClampFloatGeometry4(px);
+  result_y = ClampFloatGeometry4(py);
+}
+
+// Maps lane i of (|x|, |y|, |z|) through the full |matrix| as
+// Transform::MapPoint(const Point3F&) does.
+ALWAYS_INLINE void MapPoint3dInLanes(const Matrix44& matrix,
+                                     Double4 x,
+                                     Double4 y,
+                                     Double4 z,
+                                     Float4& result_x,
+                                     Float4& result_y,
+                                     Float4& result_z) {
+  const Double4 kOne = Double4{} + 1;
+  Double4 w = kOne;
+  matrix.MapVector4InLanes(x, y, z, w);
+  // Divide by w where it's not 1 and normal, as MapPointInternal() does,
+  // and by 1 elsewhere, which doesn't change the result.
+  const Double4 abs_w = w < 0 ? -w : w;
+  const Double4 w_inverse =
+      (w != 1.0) & (abs_w >= std::numeric_limits<double>::min()) &
+              (abs_w <= std::numeric_limits<double>::max())
+          ? kOne / w
+          : kOne;
+  result_x = ClampFloatGeometry4(x * w_inverse);
+  result_y = ClampFloatGeometry4(y * w_inverse);
+  result_z = ClampFloatGeometry4(z * w_inverse);
+}
+
+// The 8 corners of a box in two groups of lanes: the corners at z() in
+// group 0 and those at front() in group 1, in the order (x(), y()),
+// (right(), y()), (x(), bottom()) and (right(), bottom()).
+struct BoxCornersInLanes {
+  explicit BoxCornersInLanes(const BoxF& box) {
+    const float right = box.x() + box.width();
+    const float bottom = box.y() + box.height();
+    const float front = box.z() + box.depth();
+    for (int group = 0; group < 2; ++group) {
+      x[group] = Float4{box.x(), right, box.x(), right};
+      y[group] = Float4{box.y(), box.y(), bottom, bottom};
+    }
+    z[0] = Float4{} + box.z();
+    z[1] = Float4{} + front;
+  }
+
+  Float4 x[2];
+  Float4 y[2];
+  Float4 z[2];
+};
+
+ALWAYS_INLINE float HorizontalMin(Float4 v) {
+  const Float4 swapped = {v[2], v[3], v[0], v[1]};
+  v = swapped < v ? swapped : v;
+  return std::min(v[0], v[1]);
+}
+
+ALWAYS_INLINE float HorizontalMax(Float4 v) {
+  const Float4 swapped = {v[2], v[3], v[0], v[1]};
+  v = swapped > v ? swapped : v;
+  return std::max(v[0], v[1]);
+}
+
+// Returns the smallest box containing the corners in |corners|.
+ALWAYS_INLINE BoxF BoundsOfCorners(const BoxCornersInLanes& corners) {
+  const auto lane_min = [](Float4 a, Float4 b) { return a < b ? a : b; };
+  const auto lane_max = [](Float4 a, Float4 b) { return a > b ? a : b; };
+  const float min_x = HorizontalMin(lane_min(corners.x[0], corners.x[1]));
+  const float min_y = HorizontalMin(lane_min(corners.y[0], corners.y[1]));
+  const float min_z = HorizontalMin(lane_min(corners.z[0], corners.z[1]));
+  const float max_x = HorizontalMax(lane_max(corners.x[0], corners.x[1]));
+  const float max_y = HorizontalMax(lane_max(corners.y[0], corners.y[1]));
+  const float max_z = HorizontalMax(lane_max(corners.z[0], corners.z[1]));
+  return BoxF(min_x, min_y, min_z, max_x - min_x, max_y - min_y,
+              max_z - min_z);
+}
+
+// Maps the rects in the lanes of |x|, |y|, |width| and |height| through the
+// full |matrix|, replacing them with the same results as
+// MapQuad(QuadF(rect)).BoundingBox().
+void MapRectsInLanes(const Matrix44& matrix,
+                     bool has_perspective,
+                     Float4& x,
+                     Float4& y,
+                     Float4& width,
+                     Float4& height) {
+  Double4 left = __builtin_convertvector(x, Double4);
+  Double4 top = __builtin_convertvector(y, Double4);
+  Double4 right = __builtin_convertvector(x + width, Double4);
+  Double4 bottom = __builtin_convertvector(y + height, Double4);
+
+  Float4 corner_x[4];
+  Float4 corner_y[4];
+  MapPointsInLanes(matrix, has_perspective, left, top, corner_x[0],
+                   corner_y[0]);
+  MapPointsInLanes(matrix, has_perspective, right, top, corner_x[1],
+                   corner_y[1]);
+  MapPointsInLanes(matrix, has_perspective, right, bottom, corner_x[2],
+                   corner_y[2]);
+  MapPointsInLanes(matrix, has_perspective, left, bottom, corner_x[3],
+                   corner_y[3]);
+
+  Float4 min_x = corner_x[0];
+  Float4 max_x = corner_x[0];
+  Float4 min_y = corner_y[0];
+  Float4 max_y = corner_y[0];
+  for (int i = 1; i < 4; ++i) {
+    min_x = corner_x[i] < min_x ? corner_x[i] : min_x;
+    max_x = corner_x[i] > max_x ? corner_x[i] : max_x;
+    min_y = corner_y[i] < min_y ? corner_y[i] : min_y;
+    max_y = corner_y[i] > max_y ? corner_y[i] : max_y;
+  }
+  x = min_x;
+  y = min_y;
+  width = max_x - min_x;
+  height = max_y - min_y;
+}
+
+// A point in homogeneous 2d coordinates.
+struct HomogeneousPointF {
+  double x;
+  double y;
+  double w;
+};
+
+using ClippedPolygon =
+    std::array<HomogeneousPointF, Transform::kMaxClippedQuadVertices>;
+
+// Clips the first |size| points of |polygon| to the half-space where
+// a * x + b * y + c * w >= d, with one pass of Sutherland-Hodgman, and
+// returns the number of points left.
+size_t ClipPolygonToHalfSpace(ClippedPolygon& polygon,
+                              size_t size,
+                              double a,
+                              double b,
+                              double c,
+                              double d) {
+  const auto distance = [&](const HomogeneousPointF& p) {
+    return a * p.x + b * p.y + c * p.w - d;
+  };
+  ClippedPolygon clipped;
+  size_t clipped_size = 0;
+  const auto add_point = [&](const HomogeneousPointF& point) {
+    CHECK_LT(clipped_size, clipped.size());
+    clipped[clipped_size++] = point;
+  };
+  for (size_t i = 0; i < size; ++i) {
+    const HomogeneousPointF& p = polygon[i];
+    const HomogeneousPointF& q = polygon[(i + 1) % size];
+    const double p_distance = distance(p);
+    const double q_distance = distance(q);
+    if (p_distance >= 0) {
+      add_point(p);
+    }
+    if ((p_distance >= 0) != (q_distance >= 0)) {
+      const double t = p_distance / (p_distance - q_distance);
+      add_point({p.x + t * (q.x - p.x), p.y + t * (q.y - p.y),
+                 p.w + t * (q.w - p.w)});
+    }
+  }
+  polygon = clipped;
+  return clipped_size;
+}
+
+// Projects the points in the lanes of (|x|, |y|) through the full |matrix| as
+// Transform::ProjectPoint() does, except for the check of rc(2, 2), which the
+// caller does once for all lanes. Returns the clamped lanes as a bit mask.
+int ProjectPointsInLanes(const Matrix44& matrix,
+                         Double4 x,
+                         Double4 y,
+                         Float4& result_x,
+                         Float4& result_y) {
+  Double4 z = -(matrix.rc(2, 0) * x + matrix.rc(2, 1) * y + matrix.rc(2, 3)) /
+              matrix.rc(2, 2);
+  Double4 abs_z = z < 0 ? -z : z;
+  auto z_is_finite = abs_z <= std::numeric_limits<double>::max();
+
+  Double4 w = Double4{1, 1, 1, 1};
+  matrix.MapVector4InLanes(x, y, z, w);
+  auto w_is_positive = w > 0;
+
+  // The big number for points behind the viewer, with the sign of the mapped
+  // coordinate as std::copysign() would give.
+  const DoubleBoolean4 kSignBit = DoubleBoolean4{} + INT64_MIN;
+  const DoubleBoolean4 kBig =
+      std::bit_cast<DoubleBoolean4>(Double4{} + kProjectionBigNumber);
+  Double4 big_x =
+      std::bit_cast<Double4>((std::bit_cast<DoubleBoolean4>(x) & kSignBit) |
+                             kBig);
+  Double4 big_y =
+      std::bit_cast<Double4>((std::bit_cast<DoubleBoolean4>(y) & kSignBit) |
+                             kBig);
+
+  x = w != 1 ? x / w : x;
+  y = w != 1 ? y / w : y;
+  x = w_is_positive ? x : big_x;
+  y = w_is_positive ? y : big_y;
+  x = z_is_finite ? x : Double4{};
+  y = z_is_finite ? y : Double4{};
+  result_x = ClampFloatGeometry4(x);
+  result_y = ClampFloatGeometry4(y);
+
+  DoubleBoolean4 clamped = ~(z_is_finite & w_is_positive);
+  return (clamped[0] & 1) | (clamped[1] & 2) | (clamped[2] & 4) |
+         (clamped[3] & 8);
+}
+
 template <typename T>
 void AxisTransform2dToColMajor(const AxisTransform2d& axis_2d,
                                base::span<T, 16> a) {
@@ -64,43 +468,109 @@ void AxisTransform2dToColMajor(const AxisTransform2d& axis_2d,
   a[10] = a[15] = 1;
 }
 
+template <typename T>
+void AffineTransform2dToColMajor(const AffineTransform2d& affine_2d,
+                                 base::span<T, 16> a) {
+  a[0] = affine_2d.a();
+  a[1] = affine_2d.b();
+  a[4] = affine_2d.c();
+  a[5] = affine_2d.d();
+  a[12] = affine_2d.e();
+  a[13] = affine_2d.f();
+  a[2] = a[3] = a[6] = a[7] = a[8] = a[9] = a[11] = a[14] = 0;
+  a[10] = a[15] = 1;
+}
+
 }  // namespace
 
-// clang-format off
-Transform::Transform(const Quaternion& q)
-    : Transform(
-          // Col 0.
-          1.0 - 2.0 * (q.y() * q.y() + q.z() * q.z()),
-          2.0 * (q.x() * q.y() + q.z() * q.w()),
-          2.0 * (q.x() * q.z() - q.y() * q.w()),
-          0,
-          // Col 1.
-          2.0 * (q.x() * q.y() - q.z() * q.w()),
-          1.0 - 2.0 * (q.x() * q.x() + q.z() * q.z()),
-          2.0 * (q.y() * q.z() + q.x() * q.w()),
-          0,
-          // Col 2.
-          2.0 * (q.x() * q.z() + q.y() * q.w()),
-          2.0 * (q.y() * q.z() - q.x() * q.w()),
-          1.0 - 2.0 * (q.x() * q.x() + q.y() * q.y()),
-          0,
-          // Col 3.
-          0, 0, 0, 1) {}
-// clang-format on
+Transform::Transform(const Quaternion& q) : Transform() {
+  if (q.x() == 0 && q.y() == 0) {
+    // A rotation about the z axis, whose third row and column are those of
+    // the identity.
+    *this = Transform(
+        AffineTransform2d(1.0 - 2.0 * (q.z() * q.z()), 2.0 * (q.z() * q.w()),
+                          2.0 * (-q.z() * q.w()), 1.0 - 2.0 * (q.z() * q.z()),
+                          0, 0));
+    return;
+  }
+  // clang-format off
+  *this = Transform(
+      // Col 0.
+      1.0 - 2.0 * (q.y() * q.y() + q.z() * q.z()),
+      2.0 * (q.x() * q.y() + q.z() * q.w()),
+      2.0 * (q.x() * q.z() - q.y() * q.w()),
+      0,
+      // Col 1.
+      2.0 * (q.x() * q.y() - q.z() * q.w()),
+      1.0 - 2.0 * (q.x() * q.x() + q.z() * q.z()),
+      2.0 * (q.y() * q.z() + q.x() * q.w()),
+      0,
+      // Col 2.
+      2.0 * (q.x() * q.z() + q.y() * q.w()),
+      2.0 * (q.y() * q.z() - q.x() * q.w()),
+      1.0 - 2.0 * (q.x() * q.x() + q.y() * q.y()),
+      0,
+      // Col 3.
+      0, 0, 0, 1);
+  // clang-format on
+}
 
 Matrix44 Transform::GetFullMatrix() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return AxisTransform2dToMatrix44(axis_2d_);
   }
+  if (representation_ == kAffine2d) {
+    return AffineTransform2dToMatrix44(affine_2d_);
+  }
   return matrix_;
 }
 
-Matrix44& Transform::EnsureFullMatrix() {
-  if (!full_matrix_) [[likely]] {
-    full_matrix_ = true;
-    matrix_ = AxisTransform2dToMatrix44(axis_2d_);
+void Transform::PromoteToFullMatrix() {
+  DCHECK_NE(representation_, kFullMatrix);
+  matrix_ = GetFullMatrix();
+  representation_ = kFullMatrix;
+}
+
+// static
+uint8_t Transform::ComputeKind(const Matrix44& matrix) {
+  uint8_t kind = kKindComputed;
+  if (matrix.IsScaleOrTranslation()) {
+    kind |= kKindScaleOrTranslation;
+    if (matrix.IsIdentityOrTranslation()) {
+      kind |= kKindIdentityOrTranslation;
+      if (matrix.IsIdentity())
+        kind |= kKindIdentity;
+    }
   }
-  return matrix_;
+  if (matrix.IsFlat())
+    kind |= kKindFlat;
+  if (matrix.HasPerspective())
+    kind |= kKindPerspective;
+  if (Matrix44Preserves2dAxisAlignment(matrix))
+    kind |= kKindPreserves2dAxisAlignment;
+  return kind;
+}
+
+size_t Transform::Hash() const {
+  if (representation_ == kAxis2d) [[likely]] {
+    return HashComponents(std::array<double, 4>{
+        axis_2d_.scale().x(), axis_2d_.scale().y(),
+        axis_2d_.translation().x(), axis_2d_.translation().y()});
+  }
+  if (representation_ == kAffine2d) {
+    if (affine_2d_.IsScaleOrTranslation()) {
+      return HashComponents(std::array<double, 4>{
+          affine_2d_.a(), affine_2d_.d(), affine_2d_.e(), affine_2d_.f()});
+    }
+  } else if (HasKind(kKindScaleOrTranslation) && matrix_.rc(2, 2) == 1 &&
+             matrix_.rc(2, 3) == 0) {
+    return HashComponents(std::array<double, 4>{
+        matrix_.rc(0, 0), matrix_.rc(1, 1), matrix_.rc(0, 3),
+        matrix_.rc(1, 3)});
+  }
+  std::array<double, 16> components;
+  GetColMajor(components);
+  return HashComponents(components);
 }
 
 // static
@@ -117,21 +587,30 @@ Transform Transform::ColMajorF(base::span<const float, 16> a) {
               Float4{a[10], a[11], a[14], a[15]} == Float4{1, 0, 0, 1})) {
     return Transform(a[0], a[5], a[12], a[13]);
   }
+  if (AllTrue(Float4{a[2], a[3], a[6], a[7]} == Float4{0, 0, 0, 0} &
+              Float4{a[8], a[9], a[10], a[11]} == Float4{0, 0, 1, 0} &
+              Float4{a[14], a[15], 0, 0} == Float4{0, 1, 0, 0})) {
+    return Affine(a[0], a[1], a[4], a[5], a[12], a[13]);
+  }
   return Transform(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7], a[8], a[9],
                    a[10], a[11], a[12], a[13], a[14], a[15]);
 }
 
 void Transform::GetColMajor(base::span<double, 16> a) const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     AxisTransform2dToColMajor(axis_2d_, a);
+  } else if (representation_ == kAffine2d) {
+    AffineTransform2dToColMajor(affine_2d_, a);
   } else {
     matrix_.GetColMajor(a);
   }
 }
 
 void Transform::GetColMajorF(base::span<float, 16> a) const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     AxisTransform2dToColMajor(axis_2d_, a);
+  } else if (representation_ == kAffine2d) {
+    AffineTransform2dToColMajor(affine_2d_, a);
   } else {
     matrix_.GetColMajorF(a);
   }
@@ -141,21 +620,27 @@ void Transform::RotateAboutXAxis(double degrees) {
   SinCos sin_cos = SinCosDegrees(degrees);
   if (sin_cos.IsZeroAngle())
     return;
-  EnsureFullMatrix().RotateAboutXAxisSinCos(sin_cos.sin, sin_cos.cos);
+  EnsureFullMatrix(FullMatrixPromotion::kRotate)
+      ->RotateAboutXAxisSinCos(sin_cos.sin, sin_cos.cos);
 }
 
 void Transform::RotateAboutYAxis(double degrees) {
   SinCos sin_cos = SinCosDegrees(degrees);
   if (sin_cos.IsZeroAngle())
     return;
-  EnsureFullMatrix().RotateAboutYAxisSinCos(sin_cos.sin, sin_cos.cos);
+  EnsureFullMatrix(FullMatrixPromotion::kRotate)
+      ->RotateAboutYAxisSinCos(sin_cos.sin, sin_cos.cos);
 }
 
 void Transform::RotateAboutZAxis(double degrees) {
   SinCos sin_cos = SinCosDegrees(degrees);
   if (sin_cos.IsZeroAngle())
     return;
-  EnsureFullMatrix().RotateAboutZAxisSinCos(sin_cos.sin, sin_cos.cos);
+  if (representation_ == kFullMatrix) {
+    MutableFullMatrix()->RotateAboutZAxisSinCos(sin_cos.sin, sin_cos.cos);
+  } else {
+    EnsureAffine2d().RotateSinCos(sin_cos.sin, sin_cos.cos);
+  }
 }
 
 void Transform::RotateAbout(double x, double y, double z, double degrees) {
@@ -172,7 +657,14 @@ void Transform::RotateAbout(double x, double y, double z, double degrees) {
     y *= scale;
     z *= scale;
   }
-  EnsureFullMatrix().RotateUnitSinCos(x, y, z, sin_cos.sin, sin_cos.cos);
+  // Matrix44::RotateUnitSinCos() also takes z == 1 as a rotation about the z
+  // axis.
+  if (z == 1.0 && representation_ != kFullMatrix) {
+    EnsureAffine2d().RotateSinCos(sin_cos.sin, sin_cos.cos);
+    return;
+  }
+  EnsureFullMatrix(FullMatrixPromotion::kRotate)
+      ->RotateUnitSinCos(x, y, z, sin_cos.sin, sin_cos.cos);
 }
 
 void Transform::RotateAbout(const Vector3dF& axis, double degrees) {
@@ -180,25 +672,32 @@ void Transform::RotateAbout(const Vector3dF& axis, double degrees) {
 }
 
 double Transform::Determinant() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return axis_2d_.Determinant();
   }
+  if (representation_ == kAffine2d) {
+    return affine_2d_.Determinant();
+  }
   return matrix_.Determinant();
 }
 
 void Transform::Scale(float x, float y) {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     axis_2d_.PreScale(Vector2dF(x, y));
+  } else if (representation_ == kAffine2d) {
+    affine_2d_.PreScale(x, y);
   } else {
-    matrix_.PreScale(x, y);
+    MutableFullMatrix()->PreScale(x, y);
   }
 }
 
 void Transform::PostScale(float x, float y) {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     axis_2d_.PostScale(Vector2dF(x, y));
+  } else if (representation_ == kAffine2d) {
+    affine_2d_.PostScale(x, y);
   } else {
-    matrix_.PostScale(x, y);
+    MutableFullMatrix()->PostScale(x, y);
   }
 }
 
@@ -206,14 +705,14 @@ void Transform::Scale3d(float x, float y, float z) {
   if (z == 1)
     Scale(x, y);
   else
-    EnsureFullMatrix().PreScale3d(x, y, z);
+    EnsureFullMatrix(FullMatrixPromotion::kScale3d)->PreScale3d(x, y, z);
 }
 
 void Transform::PostScale3d(float x, float y, float z) {
   if (z == 1)
     PostScale(x, y);
   else
-    EnsureFullMatrix().PostScale3d(x, y, z);
+    EnsureFullMatrix(FullMatrixPromotion::kScale3d)->PostScale3d(x, y, z);
 }
 
 void Transform::Translate(const Vector2dF& offset) {
@@ -221,10 +720,12 @@ void Transform::Translate(const Vector2dF& offset) {
 }
 
 void Transform::Translate(float x, float y) {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     axis_2d_.PreTranslate(Vector2dF(x, y));
+  } else if (representation_ == kAffine2d) {
+    affine_2d_.PreTranslate(x, y);
   } else {
-    matrix_.PreTranslate(x, y);
+    MutableFullMatrix()->PreTranslate(x, y);
   }
 }
 
@@ -233,10 +734,12 @@ void Transform::PostTranslate(const Vector2dF& offset) {
 }
 
 void Transform::PostTranslate(float x, float y) {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     axis_2d_.PostTranslate(Vector2dF(x, y));
+  } else if (representation_ == kAffine2d) {
+    affine_2d_.PostTranslate(x, y);
   } else {
-    matrix_.PostTranslate(x, y);
+    MutableFullMatrix()->PostTranslate(x, y);
   }
 }
 
@@ -248,7 +751,8 @@ void Transform::PostTranslate3d(float x, float y, float z) {
   if (z == 0)
     PostTranslate(x, y);
   else
-    EnsureFullMatrix().PostTranslate3d(x, y, z);
+    EnsureFullMatrix(FullMatrixPromotion::kTranslate3d)
+        ->PostTranslate3d(x, y, z);
 }
 
 void Transform::Translate3d(const Vector3dF& offset) {
@@ -259,59 +763,114 @@ void Transform::Translate3d(float x, float y, float z) {
   if (z == 0)
     Translate(x, y);
   else
-    EnsureFullMatrix().PreTranslate3d(x, y, z);
+    EnsureFullMatrix(FullMatrixPromotion::kTranslate3d)
+        ->PreTranslate3d(x, y, z);
 }
 
 void Transform::Skew(double degrees_x, double degrees_y) {
   if (!degrees_x && !degrees_y)
     return;
-  EnsureFullMatrix().Skew(TanDegrees(degrees_x), TanDegrees(degrees_y));
+  if (representation_ == kFullMatrix) {
+    MutableFullMatrix()->Skew(TanDegrees(degrees_x), TanDegrees(degrees_y));
+  } else {
+    EnsureAffine2d().Skew(TanDegrees(degrees_x), TanDegrees(degrees_y));
+  }
 }
 
 void Transform::ApplyPerspectiveDepth(double depth) {
   if (depth == 0)
     return;
 
-  EnsureFullMatrix().ApplyPerspectiveDepth(depth);
+  EnsureFullMatrix(FullMatrixPromotion::kApplyPerspectiveDepth)
+      ->ApplyPerspectiveDepth(depth);
 }
 
 void Transform::PreConcat(const Transform& transform) {
-  if (!transform.full_matrix_) [[likely]] {
+  if (transform.representation_ == kAxis2d) [[likely]] {
     PreConcat(transform.axis_2d_);
-  } else if (!full_matrix_) [[likely]] {
+  } else if (transform.representation_ == kAffine2d) {
+    PreConcat(transform.affine_2d_);
+  } else if (representation_ == kAxis2d) [[likely]] {
+    CountPromotion(FullMatrixPromotion::kConcat);
     AxisTransform2d self = axis_2d_;
     *this = transform;
     PostConcat(self);
+  } else if (transform.IsIdentity()) {
+    return;
+  } else if (transform.IsScaleOrTranslation()) {
+    PreConcatScaleOrTranslation(
+        *EnsureFullMatrix(FullMatrixPromotion::kConcat), transform.matrix_);
+  } else if (IsIdentity()) {
+    *this = transform;
+  } else if (representation_ == kFullMatrix && IsScaleOrTranslation()) {
+    Matrix44 self = matrix_;
+    *this = transform;
+    PostConcatScaleOrTranslation(*MutableFullMatrix(), self);
   } else {
-    matrix_.PreConcat(transform.matrix_);
+    EnsureFullMatrix(FullMatrixPromotion::kConcat)
+        ->PreConcat(transform.matrix_);
   }
 }
 
 void Transform::PostConcat(const Transform& transform) {
-  if (!transform.full_matrix_) [[likely]] {
+  if (transform.representation_ == kAxis2d) [[likely]] {
     PostConcat(transform.axis_2d_);
-  } else if (!full_matrix_) [[likely]] {
+  } else if (transform.representation_ == kAffine2d) {
+    PostConcat(transform.affine_2d_);
+  } else if (representation_ == kAxis2d) [[likely]] {
+    CountPromotion(FullMatrixPromotion::kConcat);
     AxisTransform2d self = axis_2d_;
     *this = transform;
     PreConcat(self);
+  } else if (transform.IsIdentity()) {
+    return;
+  } else if (transform.IsScaleOrTranslation()) {
+    PostConcatScaleOrTranslation(
+        *EnsureFullMatrix(FullMatrixPromotion::kConcat), transform.matrix_);
+  } else if (IsIdentity()) {
+    *this = transform;
+  } else if (representation_ == kFullMatrix && IsScaleOrTranslation()) {
+    Matrix44 self = matrix_;
+    *this = transform;
+    PreConcatScaleOrTranslation(*MutableFullMatrix(), self);
   } else {
-    matrix_.PostConcat(transform.matrix_);
+    EnsureFullMatrix(FullMatrixPromotion::kConcat)
+        ->PostConcat(transform.matrix_);
   }
 }
 
 Transform Transform::operator*(const Transform& transform) const {
-  if (!transform.full_matrix_) [[likely]] {
+  if (transform.representation_ == kAxis2d) [[likely]] {
     Transform result = *this;
     result.PreConcat(transform.axis_2d_);
     return result;
   }
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     Transform result = transform;
     result.PostConcat(axis_2d_);
     return result;
   }
+  if (representation_ == kAffine2d || transform.representation_ == kAffine2d) {
+    Transform result = *this;
+    result.PreConcat(transform);
+    return result;
+  }
+  if (transform.IsIdentity())
+    return *this;
+  if (IsIdentity())
+    return transform;
+  if (IsScaleOrTranslation()) {
+    Transform result = transform;
+    PostConcatScaleOrTranslation(*result.MutableFullMatrix(), matrix_);
+    return result;
+  }
+  if (transform.IsScaleOrTranslation()) {
+    Transform result = *this;
+    PreConcatScaleOrTranslation(*result.MutableFullMatrix(), transform.matrix_);
+    return result;
+  }
   Transform result(Matrix44::kUninitialized);
-  result.matrix_.SetConcat(matrix_, transform.matrix_);
+  result.MutableFullMatrix()->SetConcat(matrix_, transform.matrix_);
   return result;
 }
 
@@ -325,12 +884,43 @@ void Transform::PostConcat(const AxisTransform2d& transform) {
   PostTranslate(transform.translation());
 }
 
+void Transform::PreConcat(const AffineTransform2d& transform) {
+  if (representation_ == kAxis2d) [[likely]] {
+    // As Matrix44 would, post-concatenating the float components.
+    AxisTransform2d self = axis_2d_;
+    *this = Transform(transform);
+    PostConcat(self);
+  } else if (representation_ == kAffine2d) {
+    affine_2d_.PreConcat(transform);
+  } else {
+    MutableFullMatrix()->PreConcat(AffineTransform2dToMatrix44(transform));
+  }
+}
+
+void Transform::PostConcat(const AffineTransform2d& transform) {
+  if (representation_ == kAxis2d) [[likely]] {
+    AxisTransform2d self = axis_2d_;
+    *this = Transform(transform);
+    PreConcat(self);
+  } else if (representation_ == kAffine2d) {
+    affine_2d_.PostConcat(transform);
+  } else {
+    MutableFullMatrix()->PostConcat(AffineTransform2dToMatrix44(transform));
+  }
+}
+
 bool Transform::IsApproximatelyIdentityOrTranslation(double tolerance) const {
   DCHECK_GE(tolerance, 0);
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return ApproximatelyOne(axis_2d_.scale().x(), tolerance) &&
            ApproximatelyOne(axis_2d_.scale().y(), tolerance);
   }
+  if (representation_ == kAffine2d) {
+    return ApproximatelyOne(affine_2d_.a(), tolerance) &&
+           ApproximatelyZero(affine_2d_.b(), tolerance) &&
+           ApproximatelyZero(affine_2d_.c(), tolerance) &&
+           ApproximatelyOne(affine_2d_.d(), tolerance);
+  }
 
   if (!ApproximatelyOne(matrix_.rc(0, 0), tolerance) ||
       !ApproximatelyZero(matrix_.rc(1, 0), tolerance) ||
@@ -358,7 +948,7 @@ bool Transform::IsApproximatelyIdentityOrIntegerTranslation(
   if (!IsApproximatelyIdentityOrTranslation(tolerance))
     return false;
 
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     for (float t : {axis_2d_.translation().x(), axis_2d_.translation().y()}) {
       if (!base::IsValueInRangeForNumericType<int>(t) ||
           std::abs(std::round(t) - t) > tolerance)
@@ -367,7 +957,7 @@ bool Transform::IsApproximatelyIdentityOrIntegerTranslation(
     return true;
   }
 
-  for (double t : {matrix_.rc(0, 3), matrix_.rc(1, 3), matrix_.rc(2, 3)}) {
+  for (double t : {rc(0, 3), rc(1, 3), rc(2, 3)}) {
     if (!base::IsValueInRangeForNumericType<int>(t) ||
         std::abs(std::round(t) - t) > tolerance)
       return false;
@@ -376,23 +966,23 @@ bool Transform::IsApproximatelyIdentityOrIntegerTranslation(
 }
 
 bool Transform::Is2dProportionalUpscaleAndOr2dTranslation() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return axis_2d_.scale().x() >= 1 &&
            axis_2d_.scale().x() == axis_2d_.scale().y();
   }
 
-  return matrix_.IsScaleOrTranslation() &&
+  return IsScaleOrTranslation() &&
          // Check proportional upscale.
-         matrix_.rc(0, 0) >= 1 && matrix_.rc(1, 1) == matrix_.rc(0, 0) &&
+         rc(0, 0) >= 1 && rc(1, 1) == rc(0, 0) &&
          // Check no scale/translation in z axis.
-         matrix_.rc(2, 2) == 1 && matrix_.rc(2, 3) == 0;
+         rc(2, 2) == 1 && rc(2, 3) == 0;
 }
 
 bool Transform::IsIdentityOrIntegerTranslation() const {
   if (!IsIdentityOrTranslation())
     return false;
 
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     for (float t : {axis_2d_.translation().x(), axis_2d_.translation().y()}) {
       if (!base::IsValueInRangeForNumericType<int>(t) ||
           static_cast<int>(t) != t) {
@@ -402,7 +992,7 @@ bool Transform::IsIdentityOrIntegerTranslation() const {
     return true;
   }
 
-  for (double t : {matrix_.rc(0, 3), matrix_.rc(1, 3), matrix_.rc(2, 3)}) {
+  for (double t : {rc(0, 3), rc(1, 3), rc(2, 3)}) {
     if (!base::IsValueInRangeForNumericType<int>(t) || static_cast<int>(t) != t)
       return false;
   }
@@ -413,8 +1003,27 @@ bool Transform::IsIdentityOrInteger2dTranslation() const {
   return IsIdentityOrIntegerTranslation() && rc(2, 3) == 0;
 }
 
+std::optional<Vector2d> Transform::ToInteger2dTranslation() const {
+  if (!IsIdentityOrTranslation())
+    return std::nullopt;
+
+  double tx, ty;
+  if (representation_ == kAxis2d) [[likely]] {
+    tx = axis_2d_.translation().x();
+    ty = axis_2d_.translation().y();
+  } else {
+    tx = rc(0, 3);
+    ty = rc(1, 3);
+  }
+  for (double t : {tx, ty}) {
+    if (!base::IsValueInRangeForNumericType<int>(t) || static_cast<int>(t) != t)
+      return std::nullopt;
+  }
+  return Vector2d(static_cast<int>(tx), static_cast<int>(ty));
+}
+
 bool Transform::Creates3d() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ != kFullMatrix) [[likely]] {
     return false;
   }
   return matrix_.rc(2, 0) != 0 || matrix_.rc(2, 1) != 0 ||
@@ -422,7 +1031,7 @@ bool Transform::Creates3d() const {
 }
 
 bool Transform::IsBackFaceVisible() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ != kFullMatrix) [[likely]] {
     return false;
   }
 
@@ -477,8 +1086,8 @@ bool Transform::IsBackFaceVisible() const {
 }
 
 bool Transform::GetInverse(Transform* transform) const {
-  if (!full_matrix_) [[likely]] {
-    transform->full_matrix_ = false;
+  if (representation_ == kAxis2d) [[likely]] {
+    transform->representation_ = kAxis2d;
     if (axis_2d_.IsInvertible()) {
       transform->axis_2d_ = axis_2d_;
       transform->axis_2d_.Invert();
@@ -488,8 +1097,15 @@ bool Transform::GetInverse(Transform* transform) const {
     return false;
   }
 
-  if (matrix_.GetInverse(transform->matrix_)) {
-    transform->full_matrix_ = true;
+  if (representation_ == kAffine2d) {
+    AffineTransform2d inverse;
+    if (affine_2d_.GetInverse(inverse)) {
+      *transform = Transform(inverse);
+      return true;
+    }
+  } else if (matrix_.GetInverse(transform->matrix_)) {
+    transform->representation_ = kFullMatrix;
+    transform->kind_ = ComputeKind(transform->matrix_);
     return true;
   }
 
@@ -514,7 +1130,7 @@ Transform Transform::InverseOrIdentity() const {
 }
 
 bool Transform::Preserves2dAffine() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ != kFullMatrix) [[likely]] {
     return true;
   }
 
@@ -547,62 +1163,18 @@ bool Transform::Preserves2dAffine() const {
 }
 
 bool Transform::Preserves2dAxisAlignment() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return true;
   }
-
-  // Check whether an axis aligned 2-dimensional rect would remain axis-aligned
-  // after being transformed by this matrix (and implicitly projected by
-  // dropping any non-zero z-values).
-  //
-  // The 4th column can be ignored because translations don't affect axis
-  // alignment. The 3rd column can be ignored because we are assuming 2d
-  // inputs, where z-values will be zero. The 3rd row can also be ignored
-  // because we are assuming 2d outputs, and any resulting z-value is dropped
-  // anyway. For the inner 2x2 portion, the only effects that keep a rect axis
-  // aligned are (1) swapping axes and (2) scaling axes. This can be checked by
-  // verifying only 1 element of every column and row is non-zero.  Degenerate
-  // cases that project the x or y dimension to zero are considered to preserve
-  // axis alignment.
-  //
-  // If the matrix does have perspective component that is affected by x or y
-  // values: The current implementation conservatively assumes that axis
-  // alignment is not preserved.
-
-  bool has_x_or_y_perspective = matrix_.rc(3, 0) != 0 || matrix_.rc(3, 1) != 0;
-
-  int num_non_zero_in_row_0 = 0;
-  int num_non_zero_in_row_1 = 0;
-  int num_non_zero_in_col_0 = 0;
-  int num_non_zero_in_col_1 = 0;
-
-  if (std::abs(matrix_.rc(0, 0)) > kEpsilon) {
-    num_non_zero_in_row_0++;
-    num_non_zero_in_col_0++;
-  }
-
-  if (std::abs(matrix_.rc(0, 1)) > kEpsilon) {
-    num_non_zero_in_row_0++;
-    num_non_zero_in_col_1++;
-  }
-
-  if (std::abs(matrix_.rc(1, 0)) > kEpsilon) {
-    num_non_zero_in_row_1++;
-    num_non_zero_in_col_0++;
+  if (representation_ == kAffine2d) {
+    return gfx::Preserves2dAxisAlignment(affine_2d_.a(), affine_2d_.c(),
+                                         affine_2d_.b(), affine_2d_.d());
   }
-
-  if (std::abs(matrix_.rc(1, 1)) > kEpsilon) {
-    num_non_zero_in_row_1++;
-    num_non_zero_in_col_1++;
-  }
-
-  return num_non_zero_in_row_0 <= 1 && num_non_zero_in_row_1 <= 1 &&
-         num_non_zero_in_col_0 <= 1 && num_non_zero_in_col_1 <= 1 &&
-         !has_x_or_y_perspective;
+  return HasKind(kKindPreserves2dAxisAlignment);
 }
 
 bool Transform::NonDegeneratePreserves2dAxisAlignment() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return axis_2d_.scale().x() > kEpsilon && axis_2d_.scale().y() > kEpsilon;
   }
 
@@ -613,13 +1185,13 @@ bool Transform::NonDegeneratePreserves2dAxisAlignment() const {
   //      the upper left 2x2 submatrix, and
   //  (2) that the w perspective value is positive.
 
-  bool has_x_or_y_perspective = matrix_.rc(3, 0) != 0 || matrix_.rc(3, 1) != 0;
-  bool positive_w_perspective = matrix_.rc(3, 3) > kEpsilon;
+  bool has_x_or_y_perspective = rc(3, 0) != 0 || rc(3, 1) != 0;
+  bool positive_w_perspective = rc(3, 3) > kEpsilon;
 
-  bool have_0_0 = std::abs(matrix_.rc(0, 0)) > kEpsilon;
-  bool have_0_1 = std::abs(matrix_.rc(0, 1)) > kEpsilon;
-  bool have_1_0 = std::abs(matrix_.rc(1, 0)) > kEpsilon;
-  bool have_1_1 = std::abs(matrix_.rc(1, 1)) > kEpsilon;
+  bool have_0_0 = std::abs(rc(0, 0)) > kEpsilon;
+  bool have_0_1 = std::abs(rc(0, 1)) > kEpsilon;
+  bool have_1_0 = std::abs(rc(1, 0)) > kEpsilon;
+  bool have_1_1 = std::abs(rc(1, 1)) > kEpsilon;
 
   return have_0_0 == have_1_1 && have_0_1 == have_1_0 && have_0_0 != have_0_1 &&
          !has_x_or_y_perspective && positive_w_perspective;
@@ -627,7 +1199,7 @@ bool Transform::NonDegeneratePreserves2dAxisAlignment() const {
 
 void Transform::Transpose() {
   if (!IsScale2d())
-    EnsureFullMatrix().Transpose();
+    EnsureFullMatrix(FullMatrixPromotion::kTranspose)->Transpose();
 }
 
 void Transform::ApplyTransformOrigin(float x, float y, float z) {
@@ -636,60 +1208,71 @@ void Transform::ApplyTransformOrigin(float x, float y, float z) {
 }
 
 void Transform::Zoom(float zoom_factor) {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     axis_2d_.Zoom(zoom_factor);
+  } else if (representation_ == kAffine2d) {
+    affine_2d_.Zoom(zoom_factor);
   } else {
-    matrix_.Zoom(zoom_factor);
+    MutableFullMatrix()->Zoom(zoom_factor);
   }
 }
 
 void Transform::Flatten() {
-  if (full_matrix_) [[unlikely]] {
-    matrix_.Flatten();
+  if (representation_ == kFullMatrix) [[unlikely]] {
+    MutableFullMatrix()->Flatten();
   }
   DCHECK(IsFlat());
 }
 
 bool Transform::IsFlat() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ != kFullMatrix) [[likely]] {
     return true;
   }
-  return matrix_.IsFlat();
+  return HasKind(kKindFlat);
 }
 
 bool Transform::Is2dTransform() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ != kFullMatrix) [[likely]] {
     return true;
   }
-  return matrix_.Is2dTransform();
+  return HasKind(kKindFlat) && !HasKind(kKindPerspective);
 }
 
 Vector2dF Transform::To2dTranslation() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return Vector2dF(ClampFloatGeometry(axis_2d_.translation().x()),
                      ClampFloatGeometry(axis_2d_.translation().y()));
   }
-  return Vector2dF(ClampFloatGeometry(matrix_.rc(0, 3)),
-                   ClampFloatGeometry(matrix_.rc(1, 3)));
+  return Vector2dF(ClampFloatGeometry(rc(0, 3)), ClampFloatGeometry(rc(1, 3)));
 }
 
 Vector3dF Transform::To3dTranslation() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return Vector3dF(ClampFloatGeometry(axis_2d_.translation().x()),
                      ClampFloatGeometry(axis_2d_.translation().y()), 0);
   }
-  return Vector3dF(ClampFloatGeometry(matrix_.rc(0, 3)),
-                   ClampFloatGeometry(matrix_.rc(1, 3)),
-                   ClampFloatGeometry(matrix_.rc(2, 3)));
+  return Vector3dF(ClampFloatGeometry(rc(0, 3)), ClampFloatGeometry(rc(1, 3)),
+                   ClampFloatGeometry(rc(2, 3)));
 }
 
 Vector2dF Transform::To2dScale() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return Vector2dF(ClampFloatGeometry(axis_2d_.scale().x()),
                      ClampFloatGeometry(axis_2d_.scale().y()));
   }
-  return Vector2dF(ClampFloatGeometry(matrix_.rc(0, 0)),
-                   ClampFloatGeometry(matrix_.rc(1, 1)));
+  return Vector2dF(ClampFloatGeometry(rc(0, 0)), ClampFloatGeometry(rc(1, 1)));
+}
+
+AffineTransform2d Transform::To2dAffine() const {
+  if (representation_ == kAxis2d) [[likely]] {
+    return AffineTransform2d::FromAxisTransform2d(axis_2d_);
+  }
+  if (representation_ == kAffine2d) {
+    return affine_2d_;
+  }
+  return AffineTransform2d(matrix_.rc(0, 0), matrix_.rc(1, 0), matrix_.rc(0, 1),
+                           matrix_.rc(1, 1), matrix_.rc(0, 3),
+                           matrix_.rc(1, 3));
 }
 
 Point Transform::MapPoint(const Point& point) const {
@@ -697,26 +1280,136 @@ Point Transform::MapPoint(const Point& point) const {
 }
 
 PointF Transform::MapPoint(const PointF& point) const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return axis_2d_.MapPoint(point);
   }
+  if (representation_ == kAffine2d) {
+    return affine_2d_.MapPoint(point);
+  }
   return MapPointInternal(matrix_, point);
 }
 
 Point3F Transform::MapPoint(const Point3F& point) const {
-  if (!full_matrix_) [[likely]] {
-    PointF result = axis_2d_.MapPoint(point.AsPointF());
+  if (representation_ != kFullMatrix) [[likely]] {
+    PointF result = MapPoint(point.AsPointF());
     return Point3F(result.x(), result.y(), ClampFloatGeometry(point.z()));
   }
   return MapPointInternal(matrix_, point);
 }
 
+void Transform::MapPoints(base::span<const PointF> points,
+                          base::span<PointF> results) const {
+  CheckBatchSpans(points, results);
+  if (representation_ == kAxis2d) [[likely]] {
+    axis_2d_.MapPoints(points, results);
+    return;
+  }
+  if (representation_ == kAffine2d) {
+    for (size_t i = 0; i < points.size(); ++i) {
+      results[i] = affine_2d_.MapPoint(points[i]);
+    }
+    return;
+  }
+
+  // The points are mapped a group at a time, and the coordinates of each
+  // group are clamped together.
+  std::array<double, kMapPointsGroupSize * 2> mapped;
+  std::array<float, kMapPointsGroupSize * 2> clamped;
+  for (size_t begin = 0; begin < points.size(); begin += kMapPointsGroupSize) {
+    const size_t count = std::min(kMapPointsGroupSize, points.size() - begin);
+    for (size_t i = 0; i < count; ++i) {
+      const PointF& point = points[begin + i];
+      Double4 p = matrix_.MapPoint2dToDouble4(point.x(), point.y());
+      double w = p[3];
+      if (w != 1.0 && std::isnormal(w)) {
+        p *= 1.0 / w;
+      }
+      mapped[i * 2] = p[0];
+      mapped[i * 2 + 1] = p[1];
+    }
+    ClampFloatGeometry(base::span(mapped).first(count * 2),
+                       base::span(clamped).first(count * 2));
+    for (size_t i = 0; i < count; ++i) {
+      results[begin + i] = PointF(clamped[i * 2], clamped[i * 2 + 1]);
+    }
+  }
+}
+
+void Transform::MapPoints3d(base::span<const Point3F> points,
+                            base::span<Point3F> results) const {
+  CheckBatchSpans(points, results);
+  if (representation_ != kFullMatrix) [[likely]] {
+    for (size_t i = 0; i < points.size(); ++i) {
+      PointF result = MapPoint(points[i].AsPointF());
+      results[i] =
+          Point3F(result.x(), result.y(), ClampFloatGeometry(points[i].z()));
+    }
+    return;
+  }
+
+  std::array<double, kMapPointsGroupSize * 3> mapped;
+  std::array<float, kMapPointsGroupSize * 3> clamped;
+  for (size_t begin = 0; begin < points.size(); begin += kMapPointsGroupSize) {
+    const size_t count = std::min(kMapPointsGroupSize, points.size() - begin);
+    for (size_t i = 0; i < count; ++i) {
+      const Point3F& point = points[begin + i];
+      Double4 p =
+          matrix_.MapPoint3dToDouble4(point.x(), point.y(), point.z());
+      double w = p[3];
+      if (w != 1.0 && std::isnormal(w)) {
+        p *= 1.0 / w;
+      }
+      mapped[i * 3] = p[0];
+      mapped[i * 3 + 1] = p[1];
+      mapped[i * 3 + 2] = p[2];
+    }
+    ClampFloatGeometry(base::span(mapped).first(count * 3),
+                       base::span(clamped).first(count * 3));
+    for (size_t i = 0; i < count; ++i) {
+      results[begin + i] = Point3F(clamped[i * 3], clamped[i * 3 + 1],
+                                   clamped[i * 3 + 2]);
+    }
+  }
+}
+
+void Transform::MapPoints3d(Point3FArray& points) const {
+  if (representation_ != kFullMatrix) [[likely]] {
+    for (size_t i = 0; i < points.size(); ++i) {
+      points.Set(i, MapPoint(points.Get(i)));
+    }
+    return;
+  }
+
+  constexpr size_t kLanes = Point3FArray::kLanes;
+  for (size_t i = 0; i < points.padded_size(); i += kLanes) {
+    base::span<float> xs = points.xs().subspan(i, kLanes);
+    base::span<float> ys = points.ys().subspan(i, kLanes);
+    base::span<float> zs = points.zs().subspan(i, kLanes);
+    Float4 x = LoadFloat4(xs.data());
+    Float4 y = LoadFloat4(ys.data());
+    Float4 z = LoadFloat4(zs.data());
+    MapPoint3dInLanes(matrix_, __builtin_convertvector(x, Double4),
+                      __builtin_convertvector(y, Double4),
+                      __builtin_convertvector(z, Double4), x, y, z);
+    StoreFloat4(x, xs.data());
+    StoreFloat4(y, ys.data());
+    StoreFloat4(z, zs.data());
+  }
+}
+
 Vector3dF Transform::MapVector(const Vector3dF& vector) const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return Vector3dF(ClampFloatGeometry(vector.x() * axis_2d_.scale().x()),
                      ClampFloatGeometry(vector.y() * axis_2d_.scale().y()),
                      ClampFloatGeometry(vector.z()));
   }
+  if (representation_ == kAffine2d) {
+    const AffineTransform2d& m = affine_2d_;
+    return Vector3dF(
+        ClampFloatGeometry(vector.x() * m.a() + vector.y() * m.c()),
+        ClampFloatGeometry(vector.x() * m.b() + vector.y() * m.d()),
+        ClampFloatGeometry(vector.z()));
+  }
   double p[4] = {vector.x(), vector.y(), vector.z(), 0};
   matrix_.MapVector4(p);
   return Vector3dF(ClampFloatGeometry(p[0]), ClampFloatGeometry(p[1]),
@@ -725,13 +1418,21 @@ Vector3dF Transform::MapVector(const Vector3dF& vector) const {
 
 void Transform::TransformVector4(base::span<float, 4> vector) const {
   DCHECK(!vector.empty());
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     vector[0] = vector[0] * axis_2d_.scale().x() +
                 vector[3] * axis_2d_.translation().x();
     vector[1] = vector[1] * axis_2d_.scale().y() +
                 vector[3] * axis_2d_.translation().y();
     for (int i = 0; i < 4; i++)
       vector[i] = ClampFloatGeometry(vector[i]);
+  } else if (representation_ == kAffine2d) {
+    const AffineTransform2d& m = affine_2d_;
+    const double x = vector[0];
+    const double y = vector[1];
+    vector[0] = ClampFloatGeometry(x * m.a() + y * m.c() + vector[3] * m.e());
+    vector[1] = ClampFloatGeometry(x * m.b() + y * m.d() + vector[3] * m.f());
+    vector[2] = ClampFloatGeometry(vector[2]);
+    vector[3] = ClampFloatGeometry(vector[3]);
   } else {
     std::array<double, 4> v = {vector[0], vector[1], vector[2], vector[3]};
     matrix_.MapVector4(v.data());
@@ -741,11 +1442,18 @@ void Transform::TransformVector4(base::span<float, 4> vector) const {
 }
 
 std::optional<PointF> Transform::InverseMapPoint(const PointF& point) const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     if (!axis_2d_.IsInvertible())
       return std::nullopt;
     return axis_2d_.InverseMapPoint(point);
   }
+  if (representation_ == kAffine2d) {
+    AffineTransform2d inverse;
+    if (!affine_2d_.GetInverse(inverse)) {
+      return std::nullopt;
+    }
+    return inverse.MapPoint(point);
+  }
   Matrix44 inverse(Matrix44::kUninitialized);
   if (!matrix_.GetInverse(inverse))
     return std::nullopt;
@@ -760,11 +1468,12 @@ std::optional<Point> Transform::InverseMapPoint(const Point& point) const {
 }
 
 std::optional<Point3F> Transform::InverseMapPoint(const Point3F& point) const {
-  if (!full_matrix_) [[likely]] {
-    if (!axis_2d_.IsInvertible())
+  if (representation_ != kFullMatrix) [[likely]] {
+    std::optional<PointF> result = InverseMapPoint(point.AsPointF());
+    if (!result) {
       return std::nullopt;
-    PointF result = axis_2d_.InverseMapPoint(point.AsPointF());
-    return Point3F(result.x(), result.y(), ClampFloatGeometry(point.z()));
+    }
+    return Point3F(result->x(), result->y(), ClampFloatGeometry(point.z()));
   }
   Matrix44 inverse(Matrix44::kUninitialized);
   if (!matrix_.GetInverse(inverse))
@@ -776,19 +1485,106 @@ RectF Transform::MapRect(const RectF& rect) const {
   if (IsIdentity())
     return rect;
 
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     if (axis_2d_.scale().x() >= 0 && axis_2d_.scale().y() >= 0) {
       return axis_2d_.MapRect(rect);
     }
   }
+  if (Preserves2dAxisAlignment()) {
+    // Each mapped x (y) only depends on one source coordinate, so the two
+    // opposite corners give the same bounds as all four.
+    return BoundingBoxOfCorners(MapPoint(rect.origin()),
+                                MapPoint(rect.bottom_right()));
+  }
+  if (representation_ == kAffine2d) {
+    return affine_2d_.MapRect(rect);
+  }
 
   return MapQuad(QuadF(rect)).BoundingBox();
 }
 
+void Transform::MapRects(base::span<const RectF> rects,
+                         base::span<RectF> results) const {
+  CheckBatchSpans(rects, results);
+  size_t i = 0;
+  // MapRect() doesn't clamp the result for identity.
+  if (representation_ == kAxis2d && axis_2d_.scale().x() >= 0 &&
+      axis_2d_.scale().y() >= 0 && !IsIdentity()) [[likely]] {
+    axis_2d_.MapRects(rects, results);
+    return;
+  }
+  if (representation_ == kFullMatrix && !IsIdentity()) {
+    bool has_perspective = HasPerspective();
+    for (; i + 4 <= rects.size(); i += 4) {
+      Float4 x, y, width, height;
+      for (size_t j = 0; j < 4; ++j) {
+        x[j] = rects[i + j].x();
+        y[j] = rects[i + j].y();
+        width[j] = rects[i + j].width();
+        height[j] = rects[i + j].height();
+      }
+      MapRectsInLanes(matrix_, has_perspective, x, y, width, height);
+      for (size_t j = 0; j < 4; ++j) {
+        results[i + j] = RectF(x[j], y[j], width[j], height[j]);
+      }
+    }
+  }
+  for (; i < rects.size(); ++i) {
+    results[i] = MapRect(rects[i]);
+  }
+}
+
+void Transform::MapRects(base::span<float> x,
+                         base::span<float> y,
+                         base::span<float> width,
+                         base::span<float> height) const {
+  // Each of the spans is both an input and an output.
+  CheckBatchSpans(base::span<const float>(x), y);
+  CheckBatchSpans(base::span<const float>(x), width);
+  CheckBatchSpans(base::span<const float>(x), height);
+  size_t i = 0;
+  // MapRect() doesn't clamp the result for identity.
+  if (representation_ == kFullMatrix && !IsIdentity()) {
+    bool has_perspective = HasPerspective();
+    for (; i + 4 <= x.size(); i += 4) {
+      Float4 x4 = LoadFloat4(x.subspan(i, 4u).data());
+      Float4 y4 = LoadFloat4(y.subspan(i, 4u).data());
+      Float4 width4 = LoadFloat4(width.subspan(i, 4u).data());
+      Float4 height4 = LoadFloat4(height.subspan(i, 4u).data());
+      MapRectsInLanes(matrix_, has_perspective, x4, y4, width4, height4);
+      for (size_t j = 0; j < 4; ++j) {
+        // Let RectF apply its clamping of tiny sizes.
+        RectF result(x4[j], y4[j], width4[j], height4[j]);
+        x[i + j] = result.x();
+        y[i + j] = result.y();
+        width[i + j] = result.width();
+        height[i + j] = result.height();
+      }
+    }
+  }
+  for (; i < x.size(); ++i) {
+    RectF result = MapRect(RectF(x[i], y[i], width[i], height[i]));
+    x[i] = result.x();
+    y[i] = result.y();
+    width[i] = result.width();
+    height[i] = result.height();
+  }
+}
+
 Rect Transform::MapRect(const Rect& rect) const {
   if (IsIdentity())
     return rect;
 
+  if (std::optional<Vector2d> translation = ToInteger2dTranslation())
+    return rect + *translation;
+
+  if (representation_ != kFullMatrix) {
+    AffineTransform2d affine = To2dAffine();
+    if (IsIntegerQuarterTurn(affine)) {
+      return MapRectByIntegerQuarterTurn(affine, rect);
+    }
+  }
+
   return ToEnclosingRect(MapRect(RectF(rect)));
 }
 
@@ -796,7 +1592,7 @@ std::optional<RectF> Transform::InverseMapRect(const RectF& rect) const {
   if (IsIdentity())
     return rect;
 
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     if (!axis_2d_.IsInvertible())
       return std::nullopt;
     if (axis_2d_.scale().x() > 0 && axis_2d_.scale().y() > 0)
@@ -807,6 +1603,9 @@ std::optional<RectF> Transform::InverseMapRect(const RectF& rect) const {
   if (!GetInverse(&inverse))
     return std::nullopt;
 
+  if (inverse.representation_ == kAffine2d) {
+    return inverse.affine_2d_.MapRect(rect);
+  }
   return inverse.MapQuad(QuadF(rect)).BoundingBox();
 }
 
@@ -814,6 +1613,20 @@ std::optional<Rect> Transform::InverseMapRect(const Rect& rect) const {
   if (IsIdentity())
     return rect;
 
+  if (std::optional<Vector2d> translation = ToInteger2dTranslation())
+    return rect - *translation;
+
+  if (representation_ != kFullMatrix) {
+    // The inverse of a quarter turn is a quarter turn, but its translation
+    // may not fit in an int.
+    AffineTransform2d affine = To2dAffine();
+    AffineTransform2d inverse;
+    if (IsIntegerQuarterTurn(affine) && affine.GetInverse(inverse) &&
+        IsIntegerQuarterTurn(inverse)) {
+      return MapRectByIntegerQuarterTurn(inverse, rect);
+    }
+  }
+
   if (std::optional<RectF> mapped = InverseMapRect(RectF(rect))) {
     return ToEnclosingRect(mapped.value());
   }
@@ -821,22 +1634,37 @@ std::optional<Rect> Transform::InverseMapRect(const Rect& rect) const {
 }
 
 BoxF Transform::MapBox(const BoxF& box) const {
-  BoxF bounds;
-  bool first_point = true;
-  for (int corner = 0; corner < 8; ++corner) {
-    gfx::Point3F point = box.origin();
-    point += gfx::Vector3dF(corner & 1 ? box.width() : 0.f,
-                            corner & 2 ? box.height() : 0.f,
-                            corner & 4 ? box.depth() : 0.f);
-    point = MapPoint(point);
-    if (first_point) {
-      bounds.set_origin(point);
-      first_point = false;
-    } else {
-      bounds.ExpandTo(point);
+  BoxF result;
+  MapBoxes(base::span_from_ref(box), base::span_from_ref(result));
+  return result;
+}
+
+void Transform::MapBoxes(base::span<const BoxF> boxes,
+                         base::span<BoxF> results) const {
+  CheckBatchSpans(boxes, results);
+  const bool is_full_matrix = representation_ == kFullMatrix;
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    BoxCornersInLanes corners(boxes[i]);
+    for (int group = 0; group < 2; ++group) {
+      Float4& x = corners.x[group];
+      Float4& y = corners.y[group];
+      Float4& z = corners.z[group];
+      if (is_full_matrix) {
+        // Each group of 4 corners is one pass through the matrix.
+        MapPoint3dInLanes(matrix_, __builtin_convertvector(x, Double4),
+                          __builtin_convertvector(y, Double4),
+                          __builtin_convertvector(z, Double4), x, y, z);
+        continue;
+      }
+      for (int lane = 0; lane < 4; ++lane) {
+        const Point3F point = MapPoint(Point3F(x[lane], y[lane], z[lane]));
+        x[lane] = point.x();
+        y[lane] = point.y();
+        z[lane] = point.z();
+      }
     }
+    results[i] = BoundsOfCorners(corners);
   }
-  return bounds;
 }
 
 QuadF Transform::MapQuad(const QuadF& quad) const {
@@ -844,6 +1672,22 @@ QuadF Transform::MapQuad(const QuadF& quad) const {
                MapPoint(quad.p4()));
 }
 
+QuadF Transform::MapRectToQuad(const RectF& rect, bool* is_rectilinear) const {
+  DCHECK(is_rectilinear);
+  *is_rectilinear = Preserves2dAxisAlignment();
+  if (!*is_rectilinear) {
+    return MapQuad(QuadF(rect));
+  }
+  // The other two corners take their coordinates from these, crosswise if
+  // x and y are swapped.
+  const PointF p1 = MapPoint(rect.origin());
+  const PointF p3 = MapPoint(rect.bottom_right());
+  if (representation_ != kAxis2d && (rc(0, 1) || rc(1, 0))) {
+    return QuadF(p1, PointF(p1.x(), p3.y()), p3, PointF(p3.x(), p1.y()));
+  }
+  return QuadF(p1, PointF(p3.x(), p1.y()), p3, PointF(p1.x(), p3.y()));
+}
+
 PointF Transform::ProjectPoint(const PointF& point, bool* clamped) const {
   // This is basically ray-tracing. We have a point in the destination plane
   // with z=0, and we cast a ray parallel to the z-axis from that point to find
@@ -860,9 +1704,13 @@ PointF Transform::ProjectPoint(const PointF& point, bool* clamped) const {
   if (clamped)
     *clamped = false;
 
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     return axis_2d_.MapPoint(point);
   }
+  if (representation_ == kAffine2d) {
+    // The ray intersects the z=0 plane at the point itself.
+    return affine_2d_.MapPoint(point);
+  }
 
   if (!std::isnormal(matrix_.rc(2, 2))) {
     // In this case, the projection plane is parallel to the ray we are trying
@@ -887,14 +1735,10 @@ PointF Transform::ProjectPoint(const PointF& point, bool* clamped) const {
   matrix_.MapVector4(v);
 
   if (v[3] <= 0) {
-    // To represent infinity and ensure the bounding box of ProjectQuad() is
-    // accurate in both float, int and blink::LayoutUnit, we use a large but
-    // not-too-large number here when clamping.
-    constexpr double kBigNumber = 1 << (std::numeric_limits<float>::digits - 1);
     if (clamped)
       *clamped = true;
-    return PointF(std::copysign(kBigNumber, v[0]),
-                  std::copysign(kBigNumber, v[1]));
+    return PointF(std::copysign(kProjectionBigNumber, v[0]),
+                  std::copysign(kProjectionBigNumber, v[1]));
   }
 
   if (v[3] != 1) {
@@ -904,7 +1748,105 @@ PointF Transform::ProjectPoint(const PointF& point, bool* clamped) const {
   return PointF(ClampFloatGeometry(v[0]), ClampFloatGeometry(v[1]));
 }
 
+size_t Transform::ClipQuadToProjection(
+    const QuadF& quad,
+    std::array<PointF, kMaxClippedQuadVertices>& vertices) const {
+  if (representation_ != kFullMatrix) [[likely]] {
+    vertices[0] = MapPoint(quad.p1());
+    vertices[1] = MapPoint(quad.p2());
+    vertices[2] = MapPoint(quad.p3());
+    vertices[3] = MapPoint(quad.p4());
+    return 4;
+  }
+  if (!std::isnormal(matrix_.rc(2, 2))) {
+    // As in ProjectPoint(), no point has a well-defined projection.
+    return 0;
+  }
+
+  // As in ProjectPoint(), but the homogeneous coordinates are kept. The z of
+  // the projected points is affine in their x and y, so that the homogeneous
+  // coordinates are linear along the edges, and can be clipped there.
+  Double4 x{quad.p1().x(), quad.p2().x(), quad.p3().x(), quad.p4().x()};
+  Double4 y{quad.p1().y(), quad.p2().y(), quad.p3().y(), quad.p4().y()};
+  Double4 z =
+      -(matrix_.rc(2, 0) * x + matrix_.rc(2, 1) * y + matrix_.rc(2, 3)) /
+      matrix_.rc(2, 2);
+  Double4 w = Double4{1, 1, 1, 1};
+  matrix_.MapVector4InLanes(x, y, z, w);
+
+  ClippedPolygon polygon;
+  for (size_t i = 0; i < 4; ++i) {
+    polygon[i] = {x[i], y[i], w[i]};
+  }
+  // Clips to w >= epsilon, and then to the square with the big number of
+  // ProjectPoint() as its half size, which the points in front of the viewer
+  // approach as w gets small.
+  size_t size = ClipPolygonToHalfSpace(polygon, 4, 0, 0, 1, kEpsilon);
+  size = ClipPolygonToHalfSpace(polygon, size, -1, 0, kProjectionBigNumber, 0);
+  size = ClipPolygonToHalfSpace(polygon, size, 1, 0, kProjectionBigNumber, 0);
+  size = ClipPolygonToHalfSpace(polygon, size, 0, -1, kProjectionBigNumber, 0);
+  size = ClipPolygonToHalfSpace(polygon, size, 0, 1, kProjectionBigNumber, 0);
+  for (size_t i = 0; i < size; ++i) {
+    const HomogeneousPointF& p = polygon[i];
+    vertices[i] = p.w != 1 ? PointF(ClampFloatGeometry(p.x / p.w),
+                                    ClampFloatGeometry(p.y / p.w))
+                           : PointF(ClampFloatGeometry(p.x),
+                                    ClampFloatGeometry(p.y));
+  }
+  return size;
+}
+
+void Transform::ProjectPoints(base::span<const PointF> points,
+                              base::span<PointF> results,
+                              base::span<bool> clamped) const {
+  CheckBatchSpans(points, results);
+  CHECK(clamped.empty() || clamped.size() == points.size());
+  size_t i = 0;
+  if (representation_ == kFullMatrix && std::isnormal(matrix_.rc(2, 2))) {
+    for (; i + 4 <= points.size(); i += 4) {
+      Double4 x, y;
+      for (size_t j = 0; j < 4; ++j) {
+        x[j] = points[i + j].x();
+        y[j] = points[i + j].y();
+      }
+      Float4 result_x, result_y;
+      int clamped_lanes =
+          ProjectPointsInLanes(matrix_, x, y, result_x, result_y);
+      for (size_t j = 0; j < 4; ++j) {
+        results[i + j] = PointF(result_x[j], result_y[j]);
+        if (!clamped.empty()) {
+          clamped[i + j] = clamped_lanes & (1 << j);
+        }
+      }
+    }
+  }
+  for (; i < points.size(); ++i) {
+    bool point_clamped;
+    results[i] = ProjectPoint(points[i], &point_clamped);
+    if (!clamped.empty()) {
+      clamped[i] = point_clamped;
+    }
+  }
+}
+
 QuadF Transform::ProjectQuad(const QuadF& quad) const {
+  if (representation_ == kFullMatrix && std::isnormal(matrix_.rc(2, 2))) {
+    // Project the four corners at once.
+    Float4 x, y;
+    int clamped = ProjectPointsInLanes(
+        matrix_, Double4{quad.p1().x(), quad.p2().x(), quad.p3().x(),
+                         quad.p4().x()},
+        Double4{quad.p1().y(), quad.p2().y(), quad.p3().y(), quad.p4().y()}, x,
+        y);
+    // If all points on the quad had w < 0, then the entire quad would not be
+    // visible to the projected surface.
+    if (clamped == 0b1111) {
+      return QuadF();
+    }
+    return QuadF(PointF(x[0], y[0]), PointF(x[1], y[1]), PointF(x[2], y[2]),
+                 PointF(x[3], y[3]));
+  }
+
   bool clamped1 = false;
   bool clamped2 = false;
   bool clamped3 = false;
@@ -923,44 +1865,118 @@ QuadF Transform::ProjectQuad(const QuadF& quad) const {
 }
 
 std::optional<DecomposedTransform> Transform::Decompose() const {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     // Consider letting 2d decomposition always succeed.
     if (!axis_2d_.IsInvertible())
       return std::nullopt;
     return axis_2d_.Decompose();
   }
-  return matrix_.Decompose();
+  return GetFullMatrix().Decompose();
 }
 
 // static
 Transform Transform::Compose(const DecomposedTransform& decomp) {
+  return ComposeWithRotation(decomp.translate, decomp.scale, decomp.skew,
+                             decomp.perspective, Transform(decomp.quaternion));
+}
+
+// static
+void Transform::ComposeMany(const DecomposedTransformSpans& decomps,
+                            base::span<Transform> out) {
+  const size_t size = decomps.size();
+  CheckBatchSpans(decomps.translate, out);
+  CheckBatchSpans(decomps.scale, out);
+  CheckBatchSpans(decomps.skew, out);
+  CheckBatchSpans(decomps.perspective, out);
+  CheckBatchSpans(decomps.quaternion, out);
+
+  for (size_t i = 0; i < size; i += 4) {
+    const size_t lanes = std::min<size_t>(4, size - i);
+    // Unused lanes get the identity quaternion.
+    Double4 x = {0, 0, 0, 0};
+    Double4 y = {0, 0, 0, 0};
+    Double4 z = {0, 0, 0, 0};
+    Double4 w = {1, 1, 1, 1};
+    for (size_t lane = 0; lane < lanes; ++lane) {
+      const Quaternion& q = decomps.quaternion[i + lane];
+      x[lane] = q.x();
+      y[lane] = q.y();
+      z[lane] = q.z();
+      w[lane] = q.w();
+    }
+
+    // Same as Transform(const Quaternion&), in lanes.
+    Double4 r0c0 = 1.0 - 2.0 * (y * y + z * z);
+    Double4 r1c0 = 2.0 * (x * y + z * w);
+    Double4 r2c0 = 2.0 * (x * z - y * w);
+    Double4 r0c1 = 2.0 * (x * y - z * w);
+    Double4 r1c1 = 1.0 - 2.0 * (x * x + z * z);
+    Double4 r2c1 = 2.0 * (y * z + x * w);
+    Double4 r0c2 = 2.0 * (x * z + y * w);
+    Double4 r1c2 = 2.0 * (y * z - x * w);
+    Double4 r2c2 = 1.0 - 2.0 * (x * x + y * y);
+
+    for (size_t lane = 0; lane < lanes; ++lane) {
+      // Rotations about the z axis are 2d, as in Transform(const Quaternion&).
+      // clang-format off
+      const Transform rotation =
+          x[lane] == 0 && y[lane] == 0
+              ? Transform(AffineTransform2d(r0c0[lane], r1c0[lane],
+                                            r0c1[lane], r1c1[lane], 0, 0))
+              : Transform(r0c0[lane], r1c0[lane], r2c0[lane], 0,
+                          r0c1[lane], r1c1[lane], r2c1[lane], 0,
+                          r0c2[lane], r1c2[lane], r2c2[lane], 0,
+                          0, 0, 0, 1);
+      // clang-format on
+      const size_t index = i + lane;
+      out[index] = ComposeWithRotation(
+          decomps.translate[index], decomps.scale[index], decomps.skew[index],
+          decomps.perspective[index], rotation);
+    }
+  }
+}
+
+// static
+Transform Transform::ComposeWithRotation(
+    const std::array<double, 3u>& translate,
+    const std::array<double, 3u>& scale,
+    const std::array<double, 3u>& skew,
+    const std::array<double, 4u>& perspective,
+    const Transform& rotation) {
   Transform result;
 
   for (int i = 0; i < 3; i++) {
-    if (decomp.perspective[i] != 0)
-      result.set_rc(3, i, decomp.perspective[i]);
+    if (perspective[i] != 0)
+      result.set_rc(3, i, perspective[i]);
   }
-  if (decomp.perspective[3] != 1)
-    result.set_rc(3, 3, decomp.perspective[3]);
+  if (perspective[3] != 1)
+    result.set_rc(3, 3, perspective[3]);
 
-  result.Translate3d(decomp.translate[0], decomp.translate[1],
-                     decomp.translate[2]);
+  result.Translate3d(translate[0], translate[1], translate[2]);
 
-  result.PreConcat(Transform(decomp.quaternion));
+  result.PreConcat(rotation);
 
-  if (decomp.skew[0] || decomp.skew[1] || decomp.skew[2])
-    result.EnsureFullMatrix().ApplyDecomposedSkews(decomp.skew);
+  if (skew[0] && !skew[1] && !skew[2] &&
+      result.representation_ != kFullMatrix) {
+    // The 2d skew, as Matrix44::ApplyDecomposedSkews() would apply it.
+    result.EnsureAffine2d().Skew(skew[0], 0);
+  } else if (skew[0] || skew[1] || skew[2]) {
+    result.EnsureFullMatrix(FullMatrixPromotion::kCompose)
+        ->ApplyDecomposedSkews(skew);
+  }
 
-  result.Scale3d(decomp.scale[0], decomp.scale[1], decomp.scale[2]);
+  result.Scale3d(scale[0], scale[1], scale[2]);
 
   return result;
 }
 
 bool Transform::Blend(const Transform& from, double progress) {
-  std::optional<DecomposedTransform> to_decomp = Decompose();
+  // The endpoints usually stay the same for all frames of an animation.
+  DecomposedTransformCache& cache = DecomposedTransformCache::GetInstance();
+  std::optional<DecomposedTransform> to_decomp = cache.Decompose(*this);
   if (!to_decomp)
     return false;
-  std::optional<DecomposedTransform> from_decomp = from.Decompose();
+  std::optional<DecomposedTransform> from_decomp = cache.Decompose(from);
   if (!from_decomp)
     return false;
 
@@ -971,10 +1987,11 @@ bool Transform::Blend(const Transform& from, double progress) {
 }
 
 bool Transform::Accumulate(const Transform& other) {
-  std::optional<DecomposedTransform> this_decomp = Decompose();
+  DecomposedTransformCache& cache = DecomposedTransformCache::GetInstance();
+  std::optional<DecomposedTransform> this_decomp = cache.Decompose(*this);
   if (!this_decomp)
     return false;
-  std::optional<DecomposedTransform> other_decomp = other.Decompose();
+  std::optional<DecomposedTransform> other_decomp = cache.Decompose(other);
   if (!other_decomp)
     return false;
 
@@ -985,34 +2002,47 @@ bool Transform::Accumulate(const Transform& other) {
 }
 
 void Transform::Round2dTranslationComponents() {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     axis_2d_ = AxisTransform2d::FromScaleAndTranslation(
         axis_2d_.scale(), Vector2dF(std::round(axis_2d_.translation().x()),
                                     std::round(axis_2d_.translation().y())));
+  } else if (representation_ == kAffine2d) {
+    affine_2d_ = AffineTransform2d(
+        affine_2d_.a(), affine_2d_.b(), affine_2d_.c(), affine_2d_.d(),
+        std::round(affine_2d_.e()), std::round(affine_2d_.f()));
   } else {
-    matrix_.set_rc(0, 3, std::round(matrix_.rc(0, 3)));
-    matrix_.set_rc(1, 3, std::round(matrix_.rc(1, 3)));
+    FullMatrixWriter matrix = MutableFullMatrix();
+    matrix->set_rc(0, 3, std::round(matrix->rc(0, 3)));
+    matrix->set_rc(1, 3, std::round(matrix->rc(1, 3)));
   }
 }
 
 void Transform::Floor2dTranslationComponents() {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     axis_2d_ = AxisTransform2d::FromScaleAndTranslation(
         axis_2d_.scale(), Vector2dF(std::floor(axis_2d_.translation().x()),
                                     std::floor(axis_2d_.translation().y())));
+  } else if (representation_ == kAffine2d) {
+    affine_2d_ = AffineTransform2d(
+        affine_2d_.a(), affine_2d_.b(), affine_2d_.c(), affine_2d_.d(),
+        std::floor(affine_2d_.e()), std::floor(affine_2d_.f()));
   } else {
-    matrix_.set_rc(0, 3, std::floor(matrix_.rc(0, 3)));
-    matrix_.set_rc(1, 3, std::floor(matrix_.rc(1, 3)));
+    FullMatrixWriter matrix = MutableFullMatrix();
+    matrix->set_rc(0, 3, std::floor(matrix->rc(0, 3)));
+    matrix->set_rc(1, 3, std::floor(matrix->rc(1, 3)));
   }
 }
 
 void Transform::RoundToIdentityOrIntegerTranslation() {
-  if (!full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d) [[likely]] {
     axis_2d_ = AxisTransform2d::FromScaleAndTranslation(
         Vector2dF(1, 1), Vector2dF(std::round(axis_2d_.translation().x()),
                                    std::round(axis_2d_.translation().y())));
+  } else if (representation_ == kAffine2d) {
+    affine_2d_ = AffineTransform2d(1, 0, 0, 1, std::round(affine_2d_.e()),
+                                   std::round(affine_2d_.f()));
   } else {
-    matrix_ =
+    *MutableFullMatrix() =
         Matrix44(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0,  // col0-2
                  std::round(matrix_.rc(0, 3)),        // col3
                  std::round(matrix_.rc(1, 3)), std::round(matrix_.rc(2, 3)), 1);
@@ -1021,7 +2051,7 @@ void Transform::RoundToIdentityOrIntegerTranslation() {
 
 PointF Transform::MapPointInternal(const Matrix44& matrix,
                                    const PointF& point) const {
-  DCHECK(full_matrix_);
+  DCHECK_EQ(representation_, kFullMatrix);
 
   double p[2] = {point.x(), point.y()};
 
@@ -1037,7 +2067,7 @@ PointF Transform::MapPointInternal(const Matrix44& matrix,
 
 Point3F Transform::MapPointInternal(const Matrix44& matrix,
                                     const Point3F& point) const {
-  DCHECK(full_matrix_);
+  DCHECK_EQ(representation_, kFullMatrix);
 
   double p[4] = {point.x(), point.y(), point.z(), 1};
 
@@ -1078,7 +2108,8 @@ bool Transform::ApproximatelyEqual(const gfx::Transform& transform,
             diff <= (std::abs(a) + std::abs(b)) * rel_scale_tolerance);
   };
 
-  if (!full_matrix_ && !transform.full_matrix_) [[likely]] {
+  if (representation_ == kAxis2d && transform.representation_ == kAxis2d)
+      [[likely]] {
     return scale_approximately_equal(axis_2d_.scale().x(),
                                      transform.axis_2d_.scale().x()) &&
            scale_approximately_equal(axis_2d_.scale().y(),
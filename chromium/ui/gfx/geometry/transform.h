@@ -5,15 +5,20 @@
 #ifndef UI_GFX_GEOMETRY_TRANSFORM_H_
 #define UI_GFX_GEOMETRY_TRANSFORM_H_
 
+#include <array>
+#include <cstdint>
 #include <iosfwd>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 
 #include "base/compiler_specific.h"
 #include "base/component_export.h"
 #include "base/containers/span.h"
+#include "ui/gfx/geometry/affine_transform2d.h"
 #include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/full_matrix_promotions.h"
 #include "ui/gfx/geometry/matrix44.h"
 
 namespace mojo {
@@ -29,35 +34,47 @@ class RectF;
 class Point;
 class PointF;
 class Point3F;
+template <typename T>
+class Float3Array;
+using Point3FArray = Float3Array<Point3F>;
 class QuadF;
 class Quaternion;
+class Vector2d;
 class Vector2dF;
 class Vector3dF;
 struct DecomposedTransform;
+struct DecomposedTransformSpans;
 
 namespace mojom {
 class TransformDataDataView;
 }  // namespace mojom
 
 // 4x4 Transformation matrix. Depending on the complexity of the matrix, it may
-// be internally stored as an AxisTransform2d (float precision) or a full
-// Matrix44 (4x4 double precision). Which one is used only affects precision and
-// performance.
+// be internally stored as an AxisTransform2d (float precision), an
+// AffineTransform2d (2x3 double precision) or a full Matrix44 (4x4 double
+// precision). Which one is used only affects precision and performance.
 // - On construction (including constructors and static functions returning a
 //   new Transform object), AxisTransform2d will be used if it the matrix will
-//   be 2d scale and/or translation, otherwise Matrix44, with some exceptions
-//   (e.g. ColMajor()) described in the method comments.
+//   be 2d scale and/or translation, AffineTransform2d if it will be another
+//   2d affine transform, e.g. with a 2d rotation or skew, otherwise Matrix44,
+//   with some exceptions (e.g. ColMajor()) described in the method comments.
 // - On mutation, if the matrix has been using AxisTransform2d and the result
 //   can still be 2d scale and/or translation, AxisTransform2d will still be
-//   used, otherwise Matrix44, with some exceptions (e.g. set_rc()) described
-//   in the method comments.
+//   used. Otherwise, if the matrix hasn't been using Matrix44 and the result
+//   can still be 2d affine, AffineTransform2d will be used, otherwise
+//   Matrix44, with some exceptions (e.g. set_rc()) described in the method
+//   comments. The matrix never goes back to a simpler representation.
 // - On assignment, the new matrix will keep the choice of the rhs matrix.
 //
 class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
  public:
   constexpr Transform() : axis_2d_() {}
 
-  explicit Transform(const AxisTransform2d& axis_2d) : axis_2d_(axis_2d) {}
+  constexpr explicit Transform(const AxisTransform2d& axis_2d)
+      : axis_2d_(axis_2d) {}
+
+  constexpr explicit Transform(const AffineTransform2d& affine_2d)
+      : representation_(kAffine2d), affine_2d_(affine_2d) {}
 
   // Creates a transform from explicit 16 matrix elements in row-major order.
   // Always creates a double precision 4x4 matrix.
@@ -90,17 +107,18 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
 
   // Creates a transform from explicit 2d elements. All other matrix elements
   // remain the same as the corresponding elements of an identity matrix.
-  // Always creates a double precision 4x4 matrix.
+  // Always creates a double precision AffineTransform2d.
   static constexpr Transform Affine(double a,    // a.k.a. r0c0 or scale_x
                                     double b,    // a.k.a. r1c0 or tan(skew_y)
                                     double c,    // a.k.a. r0c1 or tan(skew_x)
                                     double d,    // a.k.a  r1c1 or scale_y
                                     double e,    // a.k.a  r0c3 or translation_x
                                     double f) {  // a.k.a  r1c3 or translaiton_y
-    return ColMajor(a, b, 0, 0, c, d, 0, 0, 0, 0, 1, 0, e, f, 0, 1);
+    return Transform(AffineTransform2d(a, b, c, d, e, f));
   }
 
-  // Constructs a transform corresponding to the given quaternion.
+  // Constructs a transform corresponding to the given quaternion. Creates an
+  // AffineTransform2d if it's a rotation about the z axis.
   explicit Transform(const Quaternion& q);
 
   // Creates a transform as a 2d translation.
@@ -130,30 +148,44 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
 
   // Resets this transform to the identity transform.
   void MakeIdentity() {
-    full_matrix_ = false;
+    representation_ = kAxis2d;
     axis_2d_ = AxisTransform2d();
   }
 
   bool operator==(const Transform& rhs) const {
-    if (!full_matrix_ && !rhs.full_matrix_) [[likely]] {
-      return axis_2d_ == rhs.axis_2d_;
+    if (representation_ == rhs.representation_) [[likely]] {
+      switch (representation_) {
+        case kAxis2d:
+          return axis_2d_ == rhs.axis_2d_;
+        case kAffine2d:
+          return affine_2d_ == rhs.affine_2d_;
+        case kFullMatrix:
+          return matrix_ == rhs.matrix_;
+      }
     }
-    if (full_matrix_ && rhs.full_matrix_)
-      return matrix_ == rhs.matrix_;
     return GetFullMatrix() == rhs.GetFullMatrix();
   }
 
+  // Returns a hash of this transform, e.g. for hash map keys. Equal transforms
+  // have the same hash, whatever they are backed by: 2d scale and translation
+  // transforms are hashed from their 4 components, and other transforms from
+  // all 16. See also HashedTransform, which caches the hash.
+  size_t Hash() const;
+
   // Gets a value at |row|, |col| from the matrix.
   constexpr double rc(int row, int col) const {
     DCHECK_LE(static_cast<unsigned>(row), 3u);
     DCHECK_LE(static_cast<unsigned>(col), 3u);
-    if (!full_matrix_) [[likely]] {
+    if (representation_ == kAxis2d) [[likely]] {
       float m[4][4] = {{axis_2d_.scale().x(), 0, 0, axis_2d_.translation().x()},
                        {0, axis_2d_.scale().y(), 0, axis_2d_.translation().y()},
                        {0, 0, 1, 0},
                        {0, 0, 0, 1}};
       return UNSAFE_TODO(m[row][col]);
     }
+    if (representation_ == kAffine2d) {
+      return affine_2d_.rc(row, col);
+    }
     return matrix_.rc(row, col);
   }
 
@@ -162,7 +194,7 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   void set_rc(int row, int col, double v) {
     DCHECK_LE(static_cast<unsigned>(row), 3u);
     DCHECK_LE(static_cast<unsigned>(col), 3u);
-    EnsureFullMatrix().set_rc(row, col, v);
+    EnsureFullMatrix(FullMatrixPromotion::kSetRc)->set_rc(row, col, v);
   }
 
   // Constructs Transform from a double col-major array.
@@ -170,7 +202,8 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   static Transform ColMajor(base::span<const double, 16> a);
 
   // Constructs Transform from a float col-major array. Creates an
-  // AxisTransform2d or a Matrix44 depending on the values. GetColMajorF() and
+  // AxisTransform2d, an AffineTransform2d or a Matrix44 depending on the
+  // values. GetColMajorF() and
   // ColMajorF() are used when passing a Transform through mojo.
   static Transform ColMajorF(base::span<const float, 16> a);
 
@@ -179,6 +212,13 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   void GetColMajorF(base::span<float, 16> a) const;
   double ColMajorData(int index) const { return rc(index % 4, index / 4); }
 
+  // Returns the AxisTransform2d that stores the transform, or null if it's
+  // stored as a more general matrix, which may still be a 2d scale and
+  // translation. Conversions to other matrix types can use it as a fast path.
+  const AxisTransform2d* GetStoredAxisTransform2d() const {
+    return representation_ == kAxis2d ? &axis_2d_ : nullptr;
+  }
+
   // Applies a transformation on the current transformation,
   // i.e. this = this * transform.
   // "Pre" here means |this| is before the operator in the expression.
@@ -200,6 +240,12 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   // i.e. this = transform * this.
   void PostConcat(const AxisTransform2d& transform);
 
+  // Applies a 2d affine transform on the current transformation,
+  // i.e. this = this * transform, or this = transform * this, without
+  // promoting a 2d transform to a full matrix.
+  void PreConcat(const AffineTransform2d& transform);
+  void PostConcat(const AffineTransform2d& transform);
+
   // Applies the current transformation on a scaling and assigns the result
   // to |this|, i.e. this = this * scaling.
   void Scale(float scale) { Scale(scale, scale); }
@@ -252,28 +298,36 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   void ApplyPerspectiveDepth(double depth);
 
   // Returns true if this is the identity matrix.
-  // This function modifies a mutable variable in |matrix_|.
   bool IsIdentity() const {
-    if (!full_matrix_) [[likely]] {
+    if (representation_ == kAxis2d) [[likely]] {
       return axis_2d_ == AxisTransform2d();
     }
-    return matrix_.IsIdentity();
+    if (representation_ == kAffine2d) {
+      return affine_2d_.IsIdentity();
+    }
+    return HasKind(kKindIdentity);
   }
 
   // Returns true if the matrix is either identity or pure translation.
   bool IsIdentityOrTranslation() const {
-    if (!full_matrix_) [[likely]] {
+    if (representation_ == kAxis2d) [[likely]] {
       return axis_2d_.scale() == Vector2dF(1, 1);
     }
-    return matrix_.IsIdentityOrTranslation();
+    if (representation_ == kAffine2d) {
+      return affine_2d_.IsIdentityOrTranslation();
+    }
+    return HasKind(kKindIdentityOrTranslation);
   }
 
   // Returns true if the matrix is either the identity or a 2d translation.
   bool IsIdentityOr2dTranslation() const {
-    if (!full_matrix_) [[likely]] {
+    if (representation_ == kAxis2d) [[likely]] {
       return axis_2d_.scale() == Vector2dF(1, 1);
     }
-    return matrix_.IsIdentityOrTranslation() && matrix_.rc(2, 3) == 0;
+    if (representation_ == kAffine2d) {
+      return affine_2d_.IsIdentityOrTranslation();
+    }
+    return HasKind(kKindIdentityOrTranslation) && matrix_.rc(2, 3) == 0;
   }
 
   // Returns true if the matrix is either identity or pure translation,
@@ -283,11 +337,15 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
 
   // Returns true if the matrix is either a positive scale and/or a translation.
   bool IsPositiveScaleOrTranslation() const {
-    if (!full_matrix_) [[likely]] {
+    if (representation_ == kAxis2d) [[likely]] {
       return axis_2d_.scale().x() > 0.0 && axis_2d_.scale().y() > 0.0;
     }
+    if (representation_ == kAffine2d) {
+      return affine_2d_.IsScaleOrTranslation() && affine_2d_.a() > 0.0 &&
+             affine_2d_.d() > 0.0;
+    }
 
-    if (!matrix_.IsScaleOrTranslation())
+    if (!HasKind(kKindScaleOrTranslation))
       return false;
     return matrix_.rc(0, 0) > 0.0 && matrix_.rc(1, 1) > 0.0 &&
            matrix_.rc(2, 2) > 0.0;
@@ -305,6 +363,13 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   bool IsIdentityOrIntegerTranslation() const;
   bool IsIdentityOrInteger2dTranslation() const;
 
+  // Returns the x and y translation components as integers if the matrix is
+  // identity or pure translation and they can be represented as integers, or
+  // std::nullopt otherwise. The z translation may be anything, since it
+  // doesn't affect the mapping of points in the z=0 plane. This classifies
+  // the transforms for which MapRect(const Rect&) only offsets the rect.
+  std::optional<Vector2d> ToInteger2dTranslation() const;
+
   // Returns whether this matrix can transform a z=0 plane to something
   // containing points where z != 0. This is primarily intended for metrics.
   bool Creates3d() const;
@@ -312,19 +377,28 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   // Returns true if the matrix has only x and y scaling components, including
   // identity.
   bool IsScale2d() const {
-    if (!full_matrix_) [[likely]] {
+    if (representation_ == kAxis2d) [[likely]] {
       return axis_2d_.translation().IsZero();
     }
-    return matrix_.IsScale() && matrix_.rc(2, 2) == 1;
+    if (representation_ == kAffine2d) {
+      return affine_2d_.IsScaleOrTranslation() && affine_2d_.e() == 0 &&
+             affine_2d_.f() == 0;
+    }
+    return HasKind(kKindScaleOrTranslation) && matrix_.rc(0, 3) == 0 &&
+           matrix_.rc(1, 3) == 0 && matrix_.rc(2, 3) == 0 &&
+           matrix_.rc(2, 2) == 1;
   }
 
   // Returns true if the matrix is has only scaling and translation components,
   // including identity.
   bool IsScaleOrTranslation() const {
-    if (!full_matrix_) [[likely]] {
+    if (representation_ == kAxis2d) [[likely]] {
       return true;
     }
-    return matrix_.IsScaleOrTranslation();
+    if (representation_ == kAffine2d) {
+      return affine_2d_.IsScaleOrTranslation();
+    }
+    return HasKind(kKindScaleOrTranslation);
   }
 
   // Returns true if, for 2d rects on the x/y plane, this matrix can be
@@ -344,17 +418,20 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   // Returns true if the matrix has any perspective component that would
   // change the w-component of a homogeneous point.
   bool HasPerspective() const {
-    if (!full_matrix_) [[likely]] {
+    if (representation_ != kFullMatrix) [[likely]] {
       return false;
     }
-    return matrix_.HasPerspective();
+    return HasKind(kKindPerspective);
   }
 
   // Returns true if this transform is non-singular.
   bool IsInvertible() const {
-    if (!full_matrix_) [[likely]] {
+    if (representation_ == kAxis2d) [[likely]] {
       return axis_2d_.IsInvertible();
     }
+    if (representation_ == kAffine2d) {
+      return affine_2d_.IsInvertible();
+    }
     return matrix_.IsInvertible();
   }
 
@@ -422,6 +499,10 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   // ClampFloatGeometry().
   Vector2dF To2dScale() const;
 
+  // Returns the 2d affine components of the matrix, i.e. those of Affine(),
+  // ignoring the other components. It's exact for 2d affine transforms.
+  AffineTransform2d To2dAffine() const;
+
   // Returns the point with the transformation applied to |point|, clamped
   // with ClampFloatGeometry().
   [[nodiscard]] Point3F MapPoint(const Point3F& point) const;
@@ -429,6 +510,18 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   [[nodiscard]] PointF MapPoint(const PointF& point) const;
   [[nodiscard]] Point MapPoint(const Point& point) const;
 
+  // Maps each point of |points| as MapPoint() does and stores the results in
+  // |results|, which must have the same size as |points|. The matrix type is
+  // checked once for the whole batch instead of once per point. |points| and
+  // |results| may refer to the same memory.
+  void MapPoints(base::span<const PointF> points,
+                 base::span<PointF> results) const;
+  void MapPoints3d(base::span<const Point3F> points,
+                   base::span<Point3F> results) const;
+  // Same as above for each element of |points| in place. A full matrix maps
+  // the Float4 lanes of Point3FArray::kLanes points at a time.
+  void MapPoints3d(Point3FArray& points) const;
+
   // Returns the vector with the transformation applied to |vector|, clamped
   // with ClampFloatGeometry(). It differs from MapPoint() by that the
   // translation and perspective components of the matrix are ignored.
@@ -454,24 +547,59 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   // Returns the rect that is the smallest axis aligned bounding rect
   // containing the transformed rect, clamped with ClampFloatGeometry().
   [[nodiscard]] RectF MapRect(const RectF& rect) const;
+  // For the transforms of ToInteger2dTranslation(), this only offsets |rect|
+  // with saturated int adds, so it's exact even where RectF loses precision.
+  // Likewise, 2d multiples of 90deg rotations and flips with integer
+  // translations, e.g. Make90degRotation(), map the edges of |rect| exactly.
   [[nodiscard]] Rect MapRect(const Rect& rect) const;
 
+  // Maps each rect of |rects| as MapRect() does and stores the results in
+  // |results|, which must have the same size as |rects|. For a full matrix,
+  // and for positive scales and translations, four rects are mapped at a time
+  // with vector operations. |rects| and |results| may refer to the same
+  // memory.
+  void MapRects(base::span<const RectF> rects,
+                base::span<RectF> results) const;
+  // Same as above, but the rects are stored as separate arrays of x, y, width
+  // and height that are mapped in place. All spans must have the same size,
+  // and the sizes must be valid for RectF, e.g. taken from RectF::size().
+  void MapRects(base::span<float> x,
+                base::span<float> y,
+                base::span<float> width,
+                base::span<float> height) const;
+
   // Applies the reverse transformation on the given rect. Returns
   // `std::nullopt` if the transformation cannot be inverted, or the rect that
   // is the smallest axis aligned bounding rect containing the transformed rect,
   // clamped with ClampFloatGeometry().
   [[nodiscard]] std::optional<RectF> InverseMapRect(const RectF& rect) const;
+  // Like MapRect(const Rect&), this only offsets |rect| for the transforms of
+  // ToInteger2dTranslation(), and is exact for integer quarter turns.
   [[nodiscard]] std::optional<Rect> InverseMapRect(const Rect& rect) const;
 
   // Returns the box with transformation applied on the given box. The returned
   // box will be the smallest axis aligned bounding box containing the
   // transformed box, clamped with ClampFloatGeometry().
   [[nodiscard]] BoxF MapBox(const BoxF& box) const;
+  // Maps each box of |boxes| as MapBox() does and stores the results in
+  // |results|, which must have the same size as |boxes| and may refer to the
+  // same memory. The matrix type is checked once for the whole batch, and the
+  // corners of each box are mapped through a full matrix 4 at a time.
+  void MapBoxes(base::span<const BoxF> boxes, base::span<BoxF> results) const;
 
   // Applies transformation on the given quad by applying the transformation
   // on each point of the quad.
   [[nodiscard]] QuadF MapQuad(const QuadF& quad) const;
 
+  // Returns the same as MapQuad(QuadF(rect)), and sets |*is_rectilinear| to
+  // whether the result is known to be rectilinear from the type of the matrix,
+  // i.e. to Preserves2dAxisAlignment(). If so, only two corners are mapped,
+  // and the quad has the corners of its BoundingBox() exactly, so callers
+  // needn't check QuadF::IsRectilinear(). Otherwise, the quad may still be
+  // rectilinear, within the tolerance of QuadF::IsRectilinear().
+  [[nodiscard]] QuadF MapRectToQuad(const RectF& rect,
+                                    bool* is_rectilinear) const;
+
   // Maps a point on the z=0 plane into a point on the plane with which the
   // transform applied, by extending a ray perpendicular to the source plane and
   // computing the local x,y position of the point where that ray intersects
@@ -494,10 +622,38 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   [[nodiscard]] PointF ProjectPoint(const PointF& point,
                                     bool* clamped = nullptr) const;
 
+  // Projects each point of |points| with ProjectPoint() and stores the
+  // results in |results|, which must have the same size as |points|. If
+  // |clamped| is not empty, it must also have the same size, and receives the
+  // clamped flag of each point. For a full matrix, four points are projected
+  // at a time with vector operations. |points| and |results| may refer to the
+  // same memory.
+  void ProjectPoints(base::span<const PointF> points,
+                     base::span<PointF> results,
+                     base::span<bool> clamped = {}) const;
+
   // Projects the four corners of the quad with ProjectPoint(). Returns an
   // empty quad if all of the vertices are clamped.
   [[nodiscard]] QuadF ProjectQuad(const QuadF& quad) const;
 
+  // The maximum number of vertices of ClipQuadToProjection(): each of the
+  // five planes it clips a convex quad by adds at most one.
+  static constexpr size_t kMaxClippedQuadVertices = 9;
+
+  // Projects |quad|, which must be convex, as ProjectQuad() does, but instead
+  // of clamping the points that project from behind the viewer, clips it in
+  // homogeneous coordinates to the part where w is at least a small epsilon,
+  // and whose projection is within the big number that ProjectPoint() clamps
+  // them to. Stores the vertices of the clipped polygon in order in
+  // |vertices| and returns their number, which is 0 if none of the quad is in
+  // front of the viewer. The vertices in range are the same as those of
+  // ProjectQuad(), and the others are where the edges leave the range, so
+  // that the bounds of the polygon are tight, unlike those of ProjectQuad()
+  // when the quad is partly behind the viewer.
+  size_t ClipQuadToProjection(
+      const QuadF& quad,
+      std::array<PointF, kMaxClippedQuadVertices>& vertices) const;
+
   // Decomposes |this| into |decomp|. Returns nullopt if |this| can't be
   // decomposed. |decomp| must be identity on input.
   //
@@ -518,17 +674,25 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
   // https://www.w3.org/TR/css-transforms-2/#recomposing-to-a-3d-matrix
   static Transform Compose(const DecomposedTransform& decomp);
 
+  // Same as calling Compose() for each transform in |decomps| into the
+  // corresponding element of |out|, with the quaternions converted to
+  // rotation matrices several at a time. |out| must have the same size as
+  // |decomps|.
+  static void ComposeMany(const DecomposedTransformSpans& decomps,
+                          base::span<Transform> out);
+
   // Decomposes |this| and |from|, interpolates the decomposed values, and
   // sets |this| to the reconstituted result. Returns false and leaves |this|
   // unchanged if either matrix can't be decomposed.
   // Uses routines described in this spec:
   // https://www.w3.org/TR/css-transforms-2/#matrix-interpolation
   //
-  // Note: this call is expensive for complex transforms since we need to
-  // decompose the transforms. If you're going to be calling this rapidly
-  // (e.g., in an animation) for complex transforms, you should decompose once
-  // using Decompose() and reuse your DecomposedTransform with
-  // BlendDecomposedTransforms() (see transform_util.h).
+  // Note: this call needs the decompositions of both transforms. They are
+  // looked up in DecomposedTransformCache, so repeated calls with the same
+  // endpoints (e.g., in an animation) only decompose them once while they stay
+  // in the cache. To avoid the lookups too, decompose once using Decompose()
+  // and reuse your DecomposedTransform with BlendDecomposedTransforms() (see
+  // transform_util.h).
   bool Blend(const Transform& from, double progress);
 
   // Decomposes |this| and |from|, accumulates the decomposed values, and
@@ -588,8 +752,13 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
     return ApproximatelyEqual(transform, 1.0f, 0.1f, 0.0f);
   }
 
-  void EnsureFullMatrixForTesting() { EnsureFullMatrix(); }
-  bool IsFullMatrixForTesting() const { return full_matrix_; }
+  void EnsureFullMatrixForTesting() {
+    EnsureFullMatrix(FullMatrixPromotion::kForTesting);
+  }
+  bool IsAffine2dForTesting() const { return representation_ == kAffine2d; }
+  bool IsFullMatrixForTesting() const {
+    return representation_ == kFullMatrix;
+  }
 
   // Returns a string in the format of "[ row0\n, row1\n, row2\n, row3 ]\n".
   std::string ToString() const;
@@ -599,6 +768,8 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
 
  private:
   friend struct mojo::UnionTraits<gfx::mojom::TransformDataDataView, Transform>;
+  friend class DecomposedTransformCache;
+  friend class TransformWithCachedInverse;
 
   // Used internally to construct Transform with parameters in col-major order.
   // clang-format off
@@ -606,11 +777,17 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
                       double r0c1, double r1c1, double r2c1, double r3c1,
                       double r0c2, double r1c2, double r2c2, double r3c2,
                       double r0c3, double r1c3, double r2c3, double r3c3)
-      : full_matrix_(true),
+      : representation_(kFullMatrix),
         matrix_(r0c0, r1c0, r2c0, r3c0,
                 r0c1, r1c1, r2c1, r3c1,
                 r0c2, r1c2, r2c2, r3c2,
-                r0c3, r1c3, r2c3, r3c3) {}
+                r0c3, r1c3, r2c3, r3c3) {
+    // ComputeKind() isn't constexpr. HasKind() handles the unset |kind_| of
+    // a constant.
+    if (!std::is_constant_evaluated()) {
+      kind_ = ComputeKind(matrix_);
+    }
+  }
   // clang-format on
 
   constexpr Transform(float scale_x,
@@ -623,21 +800,113 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) Transform {
 
   // Used internally to construct a Transform with uninitialized full matrix.
   explicit Transform(Matrix44::UninitializedTag tag)
-      : full_matrix_(true), matrix_(tag) {}
+      : representation_(kFullMatrix), matrix_(tag) {}
 
   PointF MapPointInternal(const Matrix44& matrix, const PointF& point) const;
   Point3F MapPointInternal(const Matrix44& matrix, const Point3F& point) const;
 
+  // The common part of Compose() and ComposeMany(). |rotation| is
+  // Transform(quaternion).
+  static Transform ComposeWithRotation(const std::array<double, 3u>& translate,
+                                       const std::array<double, 3u>& scale,
+                                       const std::array<double, 3u>& skew,
+                                       const std::array<double, 4u>& perspective,
+                                       const Transform& rotation);
+
   Matrix44 GetFullMatrix() const;
-  Matrix44& EnsureFullMatrix();
 
-  // axis_2d_ is used if full_matrix_ is false, otherwise matrix_ is used.
-  // See the class documentation for more details about how we use them.
-  bool full_matrix_ = false;
+  // Gives write access to |matrix_|, and classifies it into |kind_| when it
+  // goes out of scope, i.e. at the end of the full expression for a temporary.
+  // This keeps |kind_| up to date for the const predicates, which therefore
+  // never write and are safe to call concurrently. Use it for all writes to
+  // |matrix_|.
+  class FullMatrixWriter {
+   public:
+    explicit FullMatrixWriter(Transform& transform) : transform_(transform) {
+      DCHECK_EQ(transform_.representation_, kFullMatrix);
+    }
+    FullMatrixWriter(const FullMatrixWriter&) = delete;
+    FullMatrixWriter& operator=(const FullMatrixWriter&) = delete;
+    ~FullMatrixWriter() {
+      transform_.kind_ = ComputeKind(transform_.matrix_);
+    }
+
+    Matrix44& operator*() const { return transform_.matrix_; }
+    Matrix44* operator->() const { return &transform_.matrix_; }
+
+   private:
+    Transform& transform_;
+  };
+  // Both of the following return a FullMatrixWriter. EnsureFullMatrix()
+  // counts the promotions from axis_2d_ or affine_2d_ for |reason|, see
+  // full_matrix_promotions.h; it's always inlined so that the counted caller
+  // is that of the promoting method.
+  ALWAYS_INLINE FullMatrixWriter EnsureFullMatrix(FullMatrixPromotion reason) {
+    if (representation_ != kFullMatrix) [[likely]] {
+      CountPromotion(reason);
+      PromoteToFullMatrix();
+    }
+    return FullMatrixWriter(*this);
+  }
+  FullMatrixWriter MutableFullMatrix() { return FullMatrixWriter(*this); }
+  // Returns affine_2d_, converting axis_2d_ to it first. Must not be called
+  // for a full matrix.
+  AffineTransform2d& EnsureAffine2d() {
+    DCHECK_NE(representation_, kFullMatrix);
+    if (representation_ == kAxis2d) {
+      representation_ = kAffine2d;
+      affine_2d_ = AffineTransform2d::FromAxisTransform2d(axis_2d_);
+    }
+    return affine_2d_;
+  }
+
+  // Bits of |kind_|, which classifies |matrix_| when representation_ is
+  // kFullMatrix, so that the predicates above become a bit test. It's computed
+  // whenever |matrix_| is written (see FullMatrixWriter), except for constant
+  // Transforms, for which HasKind() computes it on each query instead. It's
+  // not used for axis_2d_ and affine_2d_, whose predicates are already cheap.
+  enum KindBits : uint8_t {
+    kKindComputed = 1 << 0,
+    kKindIdentity = 1 << 1,
+    kKindIdentityOrTranslation = 1 << 2,
+    kKindScaleOrTranslation = 1 << 3,
+    kKindFlat = 1 << 4,
+    kKindPerspective = 1 << 5,
+    kKindPreserves2dAxisAlignment = 1 << 6,
+  };
+  bool HasKind(uint8_t bits) const {
+    DCHECK_EQ(representation_, kFullMatrix);
+    const uint8_t kind =
+        (kind_ & kKindComputed) ? kind_ : ComputeKind(matrix_);
+    return kind & bits;
+  }
+  static uint8_t ComputeKind(const Matrix44& matrix);
+
+  // Sets matrix_ to axis_2d_ or affine_2d_.
+  void PromoteToFullMatrix();
+  // Counts a promotion from axis_2d_ or affine_2d_ for |reason|, for the
+  // caller of the promoting method, if kCountFullMatrixPromotions.
+  ALWAYS_INLINE static void CountPromotion(FullMatrixPromotion reason) {
+    if constexpr (kCountFullMatrixPromotions) {
+      CountFullMatrixPromotion(reason, __builtin_return_address(0));
+    }
+  }
+
+  // Which of axis_2d_, affine_2d_ and matrix_ is used. See the class
+  // documentation for more details about how we use them.
+  enum Representation : uint8_t {
+    kAxis2d,
+    kAffine2d,
+    kFullMatrix,
+  };
+  Representation representation_ = kAxis2d;
+  // Lives in the padding after representation_, so it doesn't grow Transform.
+  uint8_t kind_ = 0;
   union {
     // Each constructor must explicitly initialize one of the following,
-    // according to the value of full_matrix_.
+    // according to the value of representation_.
     AxisTransform2d axis_2d_;
+    AffineTransform2d affine_2d_;
     Matrix44 matrix_;
   };
 };
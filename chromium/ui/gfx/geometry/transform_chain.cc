@@ -0,0 +1,78 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_chain.h"
+
+#include "base/check_op.h"
+
+namespace gfx {
+
+TransformChain::TransformChain() = default;
+TransformChain::TransformChain(const TransformChain&) = default;
+TransformChain& TransformChain::operator=(const TransformChain&) = default;
+TransformChain::~TransformChain() = default;
+
+int TransformChain::AddNode(int parent_id, const Transform& local) {
+  CHECK_GE(parent_id, kRootParentId);
+  CHECK_LT(parent_id, static_cast<int>(nodes_.size()));
+  nodes_.push_back(Node{.parent_id = parent_id, .local = local});
+  return static_cast<int>(nodes_.size()) - 1;
+}
+
+void TransformChain::SetLocal(int id, const Transform& local) {
+  Node& node = GetNode(id);
+  node.local = local;
+  node.version = 0;
+}
+
+const Transform& TransformChain::ToRoot(int id) {
+  // Whether a memoized product is still valid depends on all ancestors, so
+  // collect the whole chain, then validate it from the root down. Only the
+  // nodes below the first changed one are recomputed.
+  path_.clear();
+  for (int i = id; i != kRootParentId; i = GetNode(i).parent_id) {
+    path_.push_back(i);
+  }
+
+  const Node* parent = nullptr;
+  for (auto it = path_.rbegin(); it != path_.rend(); ++it) {
+    Node& node = nodes_[*it];
+    uint64_t parent_version = parent ? parent->version : 0;
+    if (node.version == 0 || node.parent_version != parent_version) {
+      if (!parent) {
+        node.to_root = node.local;
+      } else {
+        node.to_root = parent->to_root;
+        // PreConcat() is cheap for AxisTransform2d and for translations, which
+        // are the most common local transforms.
+        if (!node.local.IsIdentity()) {
+          node.to_root.PreConcat(node.local);
+        }
+      }
+      node.version = ++last_version_;
+      node.parent_version = parent_version;
+    }
+    parent = &node;
+  }
+  return parent->to_root;
+}
+
+void TransformChain::Clear() {
+  nodes_.clear();
+  last_version_ = 0;
+}
+
+const TransformChain::Node& TransformChain::GetNode(int id) const {
+  CHECK_GE(id, 0);
+  CHECK_LT(id, static_cast<int>(nodes_.size()));
+  return nodes_[id];
+}
+
+TransformChain::Node& TransformChain::GetNode(int id) {
+  CHECK_GE(id, 0);
+  CHECK_LT(id, static_cast<int>(nodes_.size()));
+  return nodes_[id];
+}
+
+}  // namespace gfx
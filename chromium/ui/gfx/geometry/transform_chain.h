@@ -0,0 +1,79 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TRANSFORM_CHAIN_H_
+#define UI_GFX_GEOMETRY_TRANSFORM_CHAIN_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "base/component_export.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+// Accumulates transforms along the ancestor chains of a tree of nodes, such
+// as a property tree, and memoizes the product from each node to the root:
+//
+//   ToRoot(id) = ToRoot(parent(id)) * local(id)
+//
+// Nodes are identified by the dense ids returned by AddNode(). Changing the
+// local transform of a node only invalidates the products of that node and
+// its descendants, and they are recomputed lazily by the next ToRoot() query
+// that reaches them. Sibling subtrees share the memoized products of their
+// common ancestors.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) TransformChain {
+ public:
+  // The parent id of root nodes.
+  static constexpr int kRootParentId = -1;
+
+  TransformChain();
+  TransformChain(const TransformChain&);
+  TransformChain& operator=(const TransformChain&);
+  ~TransformChain();
+
+  // Adds a node with |local| transform under |parent_id|, which must be
+  // kRootParentId or an id returned by an earlier call, and returns the id of
+  // the new node. Ids are assigned in increasing order from 0.
+  int AddNode(int parent_id, const Transform& local);
+
+  size_t size() const { return nodes_.size(); }
+  int parent_id(int id) const { return GetNode(id).parent_id; }
+  const Transform& local(int id) const { return GetNode(id).local; }
+
+  // Replaces the local transform of node |id|.
+  void SetLocal(int id, const Transform& local);
+
+  // Returns the product of the local transforms from the root down to node
+  // |id|, i.e. the transform that maps from the space of |id| to the space of
+  // its root. The reference is valid until the next non-const call.
+  const Transform& ToRoot(int id);
+
+  // Removes all nodes.
+  void Clear();
+
+ private:
+  struct Node {
+    int parent_id;
+    Transform local;
+    Transform to_root;
+    // Identifies the current value of |to_root|. 0 means |to_root| is
+    // invalid.
+    uint64_t version = 0;
+    // The version of the parent's |to_root| that |to_root| was computed from.
+    uint64_t parent_version = 0;
+  };
+
+  const Node& GetNode(int id) const;
+  Node& GetNode(int id);
+
+  std::vector<Node> nodes_;
+  uint64_t last_version_ = 0;
+  // Scratch storage for ToRoot() to avoid reallocation.
+  std::vector<int> path_;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TRANSFORM_CHAIN_H_
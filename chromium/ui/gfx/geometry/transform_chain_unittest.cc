@@ -0,0 +1,83 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_chain.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/test/geometry_util.h"
+#include "ui/gfx/geometry/vector3d_f.h"
+
+namespace gfx {
+
+namespace {
+
+// Computes the product from the root down to |id| without memoization.
+Transform NaiveToRoot(const TransformChain& chain, int id) {
+  std::vector<int> path;
+  for (int i = id; i != TransformChain::kRootParentId;
+       i = chain.parent_id(i)) {
+    path.push_back(i);
+  }
+  Transform result;
+  for (auto it = path.rbegin(); it != path.rend(); ++it) {
+    result.PreConcat(chain.local(*it));
+  }
+  return result;
+}
+
+Transform GetRotation(double degrees) {
+  Transform transform;
+  transform.RotateAbout(Vector3dF(1, 2, 3), degrees);
+  return transform;
+}
+
+TEST(TransformChainTest, ToRoot) {
+  TransformChain chain;
+  int root = chain.AddNode(TransformChain::kRootParentId,
+                           Transform::MakeScale(2));
+  int a = chain.AddNode(root, Transform::MakeTranslation(10, 20));
+  int b = chain.AddNode(a, GetRotation(30));
+  int c = chain.AddNode(a, Transform());
+  int d = chain.AddNode(c, Transform::MakeScale(3, -4));
+  int other_root = chain.AddNode(TransformChain::kRootParentId,
+                                 GetRotation(-45));
+  EXPECT_EQ(0, root);
+  EXPECT_EQ(6u, chain.size());
+
+  for (int id : {d, b, root, c, a, other_root}) {
+    EXPECT_EQ(NaiveToRoot(chain, id), chain.ToRoot(id));
+  }
+}
+
+TEST(TransformChainTest, SetLocalInvalidatesDescendants) {
+  TransformChain chain;
+  int root = chain.AddNode(TransformChain::kRootParentId,
+                           Transform::MakeTranslation(1, 2));
+  int a = chain.AddNode(root, GetRotation(10));
+  int b = chain.AddNode(a, Transform::MakeScale(2));
+  int sibling = chain.AddNode(root, Transform::MakeTranslation(5, 6));
+
+  Transform sibling_to_root = chain.ToRoot(sibling);
+  EXPECT_EQ(NaiveToRoot(chain, b), chain.ToRoot(b));
+
+  chain.SetLocal(a, GetRotation(20));
+  EXPECT_EQ(NaiveToRoot(chain, b), chain.ToRoot(b));
+  EXPECT_EQ(NaiveToRoot(chain, a), chain.ToRoot(a));
+  EXPECT_EQ(sibling_to_root, chain.ToRoot(sibling));
+
+  // A change of the root is seen by descendants that were computed before.
+  chain.SetLocal(root, Transform::MakeScale(3, 4));
+  EXPECT_EQ(NaiveToRoot(chain, sibling), chain.ToRoot(sibling));
+  EXPECT_EQ(NaiveToRoot(chain, b), chain.ToRoot(b));
+  EXPECT_EQ(Transform::MakeScale(3, 4), chain.ToRoot(root));
+
+  chain.Clear();
+  EXPECT_EQ(0u, chain.size());
+}
+
+}  // namespace
+
+}  // namespace gfx
@@ -0,0 +1,139 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_f.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "base/strings/stringprintf.h"
+#include "ui/gfx/geometry/clamp_float_geometry.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+namespace {
+
+// Divides the x, y and z components of |p| by its w component, following the
+// same rules as Transform::MapPoint().
+ALWAYS_INLINE Float4 DivideByW(Float4 p) {
+  float w = p[3];
+  if (w != 1.0f && std::isnormal(w)) {
+    p *= 1.0f / w;
+  }
+  return p;
+}
+
+}  // namespace
+
+TransformF::TransformF(const Transform& transform) {
+  transform.GetColMajorF(
+      base::span(UNSAFE_TODO(&matrix_[0][0]), base::fixed_extent<16>()));
+}
+
+// static
+TransformF TransformF::ColMajor(base::span<const float, 16> a) {
+  TransformF result;
+  base::span(UNSAFE_TODO(&result.matrix_[0][0]), base::fixed_extent<16>())
+      .copy_from(a);
+  return result;
+}
+
+void TransformF::GetColMajor(base::span<float, 16> a) const {
+  a.copy_from(
+      base::span(UNSAFE_TODO(&matrix_[0][0]), base::fixed_extent<16>()));
+}
+
+bool TransformF::IsScaleOrTranslation() const {
+  return AllTrue(Float4{matrix_[0][1], matrix_[0][2], matrix_[0][3],
+                        matrix_[1][0]} == Float4{0, 0, 0, 0}) &&
+         AllTrue(Float4{matrix_[1][2], matrix_[1][3], matrix_[2][0],
+                        matrix_[2][1]} == Float4{0, 0, 0, 0}) &&
+         matrix_[2][3] == 0 && matrix_[3][3] == 1;
+}
+
+void TransformF::SetConcat(const TransformF& x, const TransformF& y) {
+  Float4 c0 = x.Col(0);
+  Float4 c1 = x.Col(1);
+  Float4 c2 = x.Col(2);
+  Float4 c3 = x.Col(3);
+
+  // Each result column only depends on the columns of |x| loaded above and
+  // the same column of |y|, so |this| may be |x| or |y|.
+  for (int i = 0; i < 4; i++) {
+    Float4 mc = y.Col(i);
+    SetCol(i, c0 * mc[0] + c1 * mc[1] + c2 * mc[2] + c3 * mc[3]);
+  }
+}
+
+PointF TransformF::MapPoint(const PointF& point) const {
+  Float4 p = DivideByW(Col(0) * point.x() + Col(1) * point.y() + Col(3));
+  return PointF(ClampFloatGeometry(p[0]), ClampFloatGeometry(p[1]));
+}
+
+Point3F TransformF::MapPoint(const Point3F& point) const {
+  Float4 p = DivideByW(Col(0) * point.x() + Col(1) * point.y() +
+                       Col(2) * point.z() + Col(3));
+  return Point3F(ClampFloatGeometry(p[0]), ClampFloatGeometry(p[1]),
+                 ClampFloatGeometry(p[2]));
+}
+
+RectF TransformF::MapRect(const RectF& rect) const {
+  if (IsScaleOrTranslation()) {
+    // Only the x and y scale and translation components are non-trivial, so
+    // the corners map independently in each axis.
+    float x0 = rect.x() * matrix_[0][0] + matrix_[3][0];
+    float x1 = rect.right() * matrix_[0][0] + matrix_[3][0];
+    float y0 = rect.y() * matrix_[1][1] + matrix_[3][1];
+    float y1 = rect.bottom() * matrix_[1][1] + matrix_[3][1];
+    float left = ClampFloatGeometry(std::min(x0, x1));
+    float top = ClampFloatGeometry(std::min(y0, y1));
+    return RectF(left, top, ClampFloatGeometry(std::max(x0, x1)) - left,
+                 ClampFloatGeometry(std::max(y0, y1)) - top);
+  }
+
+  // Map the four corners with one Float4 per row: lanes are the corners
+  // (x, y), (right, y), (right, bottom), (x, bottom).
+  Float4 xs = {rect.x(), rect.right(), rect.right(), rect.x()};
+  Float4 ys = {rect.y(), rect.y(), rect.bottom(), rect.bottom()};
+  Float4 mx = xs * matrix_[0][0] + ys * matrix_[1][0] + matrix_[3][0];
+  Float4 my = xs * matrix_[0][1] + ys * matrix_[1][1] + matrix_[3][1];
+  Float4 mw = xs * matrix_[0][3] + ys * matrix_[1][3] + matrix_[3][3];
+
+  std::array<PointF, 4> corners;
+  for (int i = 0; i < 4; i++) {
+    float w = mw[i];
+    float x = mx[i];
+    float y = my[i];
+    if (w != 1.0f && std::isnormal(w)) {
+      x /= w;
+      y /= w;
+    }
+    corners[i] = PointF(ClampFloatGeometry(x), ClampFloatGeometry(y));
+  }
+  return QuadF(corners[0], corners[1], corners[2], corners[3]).BoundingBox();
+}
+
+Transform TransformF::ToTransform() const {
+  return Transform::ColMajorF(
+      base::span(UNSAFE_TODO(&matrix_[0][0]), base::fixed_extent<16>()));
+}
+
+std::string TransformF::ToString() const {
+  return base::StringPrintf(
+      "[ %g %g %g %g\n"
+      "  %g %g %g %g\n"
+      "  %g %g %g %g\n"
+      "  %g %g %g %g ]\n",
+      rc(0, 0), rc(0, 1), rc(0, 2), rc(0, 3), rc(1, 0), rc(1, 1), rc(1, 2),
+      rc(1, 3), rc(2, 0), rc(2, 1), rc(2, 2), rc(2, 3), rc(3, 0), rc(3, 1),
+      rc(3, 2), rc(3, 3));
+}
+
+}  // namespace gfx
@@ -0,0 +1,126 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TRANSFORM_F_H_
+#define UI_GFX_GEOMETRY_TRANSFORM_F_H_
+
+#include <string>
+
+#include "base/check_op.h"
+#include "base/compiler_specific.h"
+#include "base/component_export.h"
+#include "base/containers/span.h"
+#include "ui/gfx/geometry/double4.h"
+
+namespace gfx {
+
+class Point3F;
+class PointF;
+class RectF;
+class Transform;
+
+// A single precision 4x4 transformation matrix, for code that stores many
+// transforms (e.g. one per draw quad) and is bound by memory bandwidth rather
+// than by precision. It is 64 bytes, half the size of a full-matrix Transform,
+// and each column fits in one Float4.
+//
+// This only provides the operations needed to consume stored transforms.
+// Build the transform with gfx::Transform, convert it with the explicit
+// constructor, and promote it back with ToTransform() when more is needed.
+//
+// Like Transform, this uses column vector convention, and the results of
+// the Map* methods are clamped with ClampFloatGeometry().
+class COMPONENT_EXPORT(GEOMETRY_SKIA) TransformF {
+ public:
+  constexpr TransformF()
+      : matrix_{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}} {}
+
+  // Converts |transform| to single precision. Components of a full double
+  // precision matrix may lose precision.
+  explicit TransformF(const Transform& transform);
+
+  // Creates a transform from a float col-major array.
+  static TransformF ColMajor(base::span<const float, 16> a);
+
+  bool operator==(const TransformF& other) const {
+    return AllTrue(Col(0) == other.Col(0)) && AllTrue(Col(1) == other.Col(1)) &&
+           AllTrue(Col(2) == other.Col(2)) && AllTrue(Col(3) == other.Col(3));
+  }
+
+  // Gets a value at |row|, |col| from the matrix.
+  constexpr float rc(int row, int col) const {
+    DCHECK_LE(static_cast<unsigned>(row), 3u);
+    DCHECK_LE(static_cast<unsigned>(col), 3u);
+    return UNSAFE_TODO(matrix_[col][row]);
+  }
+
+  // Sets a value in the matrix at |row|, |col|.
+  void set_rc(int row, int col, float value) {
+    DCHECK_LE(static_cast<unsigned>(row), 3u);
+    DCHECK_LE(static_cast<unsigned>(col), 3u);
+    UNSAFE_TODO(matrix_[col][row]) = value;
+  }
+
+  void GetColMajor(base::span<float, 16> a) const;
+
+  bool IsIdentity() const { return *this == TransformF(); }
+  bool IsScaleOrTranslation() const;
+  bool HasPerspective() const {
+    return !AllTrue(Float4{matrix_[0][3], matrix_[1][3], matrix_[2][3],
+                           matrix_[3][3]} == Float4{0, 0, 0, 1});
+  }
+
+  // this = this * transform.
+  void PreConcat(const TransformF& transform) { SetConcat(*this, transform); }
+  // this = transform * this.
+  void PostConcat(const TransformF& transform) { SetConcat(transform, *this); }
+
+  // Returns |this| * |other|.
+  TransformF operator*(const TransformF& other) const {
+    TransformF result;
+    result.SetConcat(*this, other);
+    return result;
+  }
+
+  // Returns the point with the transformation applied to |point|, clamped
+  // with ClampFloatGeometry(). The 2d version maps [x, y, 0] and discards
+  // the z result.
+  [[nodiscard]] PointF MapPoint(const PointF& point) const;
+  [[nodiscard]] Point3F MapPoint(const Point3F& point) const;
+
+  // Returns the smallest axis aligned bounding rect containing the
+  // transformed rect, clamped with ClampFloatGeometry().
+  [[nodiscard]] RectF MapRect(const RectF& rect) const;
+
+  // Promotes this to a double precision Transform. This is lossless.
+  Transform ToTransform() const;
+
+  // Returns a string in the format of "[ row0\n, row1\n, row2\n, row3 ]\n".
+  std::string ToString() const;
+
+ private:
+  // this = a * b.
+  void SetConcat(const TransformF& a, const TransformF& b);
+
+  ALWAYS_INLINE Float4 Col(int i) const {
+    return LoadFloat4(UNSAFE_TODO(matrix_[i]));
+  }
+  ALWAYS_INLINE void SetCol(int i, Float4 v) {
+    StoreFloat4(v, UNSAFE_TODO(matrix_[i]));
+  }
+
+  // This is indexed by [col][row].
+  float matrix_[4][4];
+};
+
+static_assert(sizeof(TransformF) == 16 * sizeof(float));
+
+// This is declared here for use in gtest-based unit tests but is defined in
+// the //ui/gfx:test_support target. Depend on that to use this in your unit
+// test. This should not be used in production code - call ToString() instead.
+void PrintTo(const TransformF& transform, ::std::ostream* os);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TRANSFORM_F_H_
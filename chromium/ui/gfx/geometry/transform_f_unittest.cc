@@ -0,0 +1,118 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_f.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/test/geometry_util.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+namespace {
+
+Transform GetTestTransform() {
+  Transform transform;
+  transform.Translate3d(1.25f, 2.75f, 3.875f);
+  transform.RotateAbout(Vector3dF(1, 2, 3), 30);
+  transform.Scale3d(3, 4, 5);
+  transform.ApplyPerspectiveDepth(100);
+  return transform;
+}
+
+TEST(TransformFTest, Size) {
+  EXPECT_EQ(64u, sizeof(TransformF));
+}
+
+TEST(TransformFTest, Identity) {
+  TransformF transform;
+  EXPECT_TRUE(transform.IsIdentity());
+  EXPECT_TRUE(transform.IsScaleOrTranslation());
+  EXPECT_FALSE(transform.HasPerspective());
+  EXPECT_TRUE(transform.ToTransform().IsIdentity());
+  EXPECT_EQ(transform, TransformF(Transform()));
+}
+
+TEST(TransformFTest, RoundTrip) {
+  for (const Transform& transform :
+       {Transform::MakeTranslation(10, 20), Transform::MakeScale(3, -4),
+        Transform::Affine(1, 2, 3, 4, 5, 6), GetTestTransform()}) {
+    SCOPED_TRACE(transform.ToString());
+    TransformF transform_f(transform);
+    for (int row = 0; row < 4; ++row) {
+      for (int col = 0; col < 4; ++col) {
+        EXPECT_EQ(static_cast<float>(transform.rc(row, col)),
+                  transform_f.rc(row, col));
+      }
+    }
+    // Promotion is lossless.
+    Transform promoted = transform_f.ToTransform();
+    EXPECT_EQ(transform_f, TransformF(promoted));
+    EXPECT_TRANSFORM_NEAR(transform, promoted, 1e-5);
+  }
+
+  // 2d scale and translation are promoted to the compact representation.
+  EXPECT_FALSE(TransformF(Transform::MakeTranslation(10, 20))
+                   .ToTransform()
+                   .IsFullMatrixForTesting());
+}
+
+TEST(TransformFTest, Concat) {
+  Transform a = GetTestTransform();
+  Transform b = Transform::Affine(1, 2, 3, 4, 5, 6);
+  b.RotateAboutXAxis(20);
+
+  TransformF a_f(a);
+  TransformF b_f(b);
+  EXPECT_TRANSFORM_NEAR(a * b, (a_f * b_f).ToTransform(), 1e-4);
+
+  TransformF pre = a_f;
+  pre.PreConcat(b_f);
+  EXPECT_EQ(a_f * b_f, pre);
+
+  TransformF post = a_f;
+  post.PostConcat(b_f);
+  EXPECT_EQ(b_f * a_f, post);
+
+  TransformF self = a_f;
+  self.PreConcat(self);
+  EXPECT_EQ(a_f * a_f, self);
+}
+
+TEST(TransformFTest, MapPoint) {
+  Transform transform = GetTestTransform();
+  TransformF transform_f(transform);
+  PointF point(12.5f, 34.5f);
+  EXPECT_POINTF_NEAR(transform.MapPoint(point), transform_f.MapPoint(point),
+                     1e-4);
+  Point3F point_3d(12.5f, 34.5f, 56.5f);
+  EXPECT_POINT3F_NEAR(transform.MapPoint(point_3d),
+                      transform_f.MapPoint(point_3d), 1e-4);
+
+  // 0 and NaN in perspective should be ignored, as in Transform.
+  TransformF zero_w(Transform::MakeTranslation(10, 20));
+  zero_w.set_rc(3, 3, 0);
+  EXPECT_EQ(PointF(12, 24), zero_w.MapPoint(PointF(2, 4)));
+  zero_w.set_rc(3, 3, std::numeric_limits<float>::quiet_NaN());
+  EXPECT_EQ(PointF(12, 24), zero_w.MapPoint(PointF(2, 4)));
+}
+
+TEST(TransformFTest, MapRect) {
+  RectF rect(1.5f, 2.5f, 30, 40);
+  for (const Transform& transform :
+       {Transform(), Transform::MakeTranslation(10, 20),
+        Transform::MakeScale(3, -4), Transform::Make90degRotation(),
+        Transform::Affine(1, 2, 3, 4, 5, 6), GetTestTransform()}) {
+    SCOPED_TRACE(transform.ToString());
+    EXPECT_RECTF_NEAR(transform.MapRect(rect),
+                      TransformF(transform).MapRect(rect), 1e-4);
+  }
+}
+
+}  // namespace
+
+}  // namespace gfx
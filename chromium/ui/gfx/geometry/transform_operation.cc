@@ -9,6 +9,7 @@
 #include <array>
 #include <limits>
 #include <numbers>
+#include <optional>
 #include <utility>
 
 #include "base/check_op.h"
@@ -317,28 +318,21 @@ static void FindCandidatesInPlane(float px,
   }
 }
 
-static void BoundingBoxForArc(const gfx::Point3F& point,
-                              const TransformOperation* from,
-                              const TransformOperation* to,
-                              SkScalar min_progress,
-                              SkScalar max_progress,
-                              gfx::BoxF* box) {
+// Computes the axis and the range of angles of the rotation that results from
+// blending |from| and |to| with progress in [min_progress, max_progress].
+// Returns false if the axis is zero.
+static bool BlendedArc(const TransformOperation* from,
+                       const TransformOperation* to,
+                       SkScalar min_progress,
+                       SkScalar max_progress,
+                       gfx::Vector3dF* axis,
+                       float* min_degrees,
+                       float* max_degrees) {
   const TransformOperation* exemplar = from ? from : to;
-  gfx::Vector3dF axis(exemplar->rotate.axis.x, exemplar->rotate.axis.y,
-                      exemplar->rotate.axis.z);
-
-  const bool x_is_zero = axis.x() == 0.f;
-  const bool y_is_zero = axis.y() == 0.f;
-  const bool z_is_zero = axis.z() == 0.f;
-
-  // We will have at most 6 angles to test (excluding from->angle and
-  // to->angle).
-  static const int kMaxNumCandidates = 6;
-  std::array<double, kMaxNumCandidates> candidates;
-  int num_candidates = kMaxNumCandidates;
-
-  if (x_is_zero && y_is_zero && z_is_zero)
-    return;
+  *axis = gfx::Vector3dF(exemplar->rotate.axis.x, exemplar->rotate.axis.y,
+                         exemplar->rotate.axis.z);
+  if (axis->IsZero())
+    return false;
 
   SkScalar from_angle = from ? from->rotate.angle : 0.f;
   SkScalar to_angle = to ? to->rotate.angle : 0.f;
@@ -349,16 +343,42 @@ static void BoundingBoxForArc(const gfx::Point3F& point,
   if (from && to) {
     gfx::Vector3dF other_axis(to->rotate.axis.x, to->rotate.axis.y,
                               to->rotate.axis.z);
-    if (gfx::DotProduct(axis, other_axis) < 0.f)
+    if (gfx::DotProduct(*axis, other_axis) < 0.f)
       to_angle *= -1.f;
   }
 
-  float min_degrees =
+  *min_degrees =
       SkScalarToFloat(BlendSkScalars(from_angle, to_angle, min_progress));
-  float max_degrees =
+  *max_degrees =
       SkScalarToFloat(BlendSkScalars(from_angle, to_angle, max_progress));
-  if (max_degrees < min_degrees)
-    std::swap(min_degrees, max_degrees);
+  if (*max_degrees < *min_degrees)
+    std::swap(*min_degrees, *max_degrees);
+  return true;
+}
+
+static void BoundingBoxForArc(const gfx::Point3F& point,
+                              const TransformOperation* from,
+                              const TransformOperation* to,
+                              SkScalar min_progress,
+                              SkScalar max_progress,
+                              gfx::BoxF* box) {
+  gfx::Vector3dF axis;
+  float min_degrees;
+  float max_degrees;
+  if (!BlendedArc(from, to, min_progress, max_progress, &axis, &min_degrees,
+                  &max_degrees)) {
+    return;
+  }
+
+  const bool x_is_zero = axis.x() == 0.f;
+  const bool y_is_zero = axis.y() == 0.f;
+  const bool z_is_zero = axis.z() == 0.f;
+
+  // We will have at most 6 angles to test (excluding from->angle and
+  // to->angle).
+  static const int kMaxNumCandidates = 6;
+  std::array<double, kMaxNumCandidates> candidates;
+  int num_candidates = kMaxNumCandidates;
 
   gfx::Transform from_transform;
   from_transform.RotateAbout(axis, min_degrees);
@@ -451,7 +471,8 @@ bool TransformOperation::BlendedBoundsForBox(const gfx::BoxF& box,
                                              const TransformOperation* to,
                                              SkScalar min_progress,
                                              SkScalar max_progress,
-                                             gfx::BoxF* bounds) {
+                                             gfx::BoxF* bounds,
+                                             SkScalar tolerance) {
   bool is_identity_from = IsOperationIdentity(from);
   bool is_identity_to = IsOperationIdentity(to);
   if (is_identity_from && is_identity_to) {
@@ -499,6 +520,21 @@ bool TransformOperation::BlendedBoundsForBox(const gfx::BoxF& box,
         return false;
       }
 
+      if (tolerance > 0) {
+        gfx::Vector3dF axis;
+        float min_degrees;
+        float max_degrees;
+        if (BlendedArc(from, to, min_progress, max_progress, &axis,
+                       &min_degrees, &max_degrees)) {
+          if (std::optional<BoxF> conservative_bounds =
+                  ConservativeBoundsForRotatedBox(box, axis, min_degrees,
+                                                  max_degrees, tolerance)) {
+            *bounds = *conservative_bounds;
+            return true;
+          }
+        }
+      }
+
       bool first_point = true;
       for (int i = 0; i < 8; ++i) {
         gfx::Point3F corner = box.origin();
@@ -73,7 +73,8 @@ struct COMPONENT_EXPORT(GEOMETRY_SKIA) TransformOperation {
                                   const TransformOperation* to,
                                   SkScalar min_progress,
                                   SkScalar max_progress,
-                                  gfx::BoxF* bounds);
+                                  gfx::BoxF* bounds,
+                                  SkScalar tolerance = 0);
 };
 
 }  // namespace gfx
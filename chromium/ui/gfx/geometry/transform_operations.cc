@@ -11,6 +11,7 @@
 
 #include "base/numerics/angle_conversions.h"
 #include "ui/gfx/geometry/box_f.h"
+#include "ui/gfx/geometry/decomposed_transform_cache.h"
 #include "ui/gfx/geometry/transform_util.h"
 #include "ui/gfx/geometry/vector3d_f.h"
 
@@ -18,15 +19,18 @@ namespace gfx {
 
 TransformOperations::TransformOperations() = default;
 
-TransformOperations::TransformOperations(const TransformOperations& other) {
-  operations_ = other.operations_;
-}
+TransformOperations::TransformOperations(const TransformOperations& other)
+    : operations_(other.operations_),
+      decomposed_transforms_(other.decomposed_transforms_),
+      num_decomposed_transforms_(other.num_decomposed_transforms_) {}
 
 TransformOperations::~TransformOperations() = default;
 
 TransformOperations& TransformOperations::operator=(
     const TransformOperations& other) {
   operations_ = other.operations_;
+  decomposed_transforms_ = other.decomposed_transforms_;
+  num_decomposed_transforms_ = other.num_decomposed_transforms_;
   return *this;
 }
 
@@ -59,7 +63,8 @@ bool TransformOperations::BlendedBoundsForBox(const BoxF& box,
                                               const TransformOperations& from,
                                               SkScalar min_progress,
                                               SkScalar max_progress,
-                                              BoxF* bounds) const {
+                                              BoxF* bounds,
+                                              SkScalar tolerance) const {
   *bounds = box;
 
   bool from_identity = from.IsIdentity();
@@ -85,7 +90,8 @@ bool TransformOperations::BlendedBoundsForBox(const BoxF& box,
         to_identity ? nullptr : &operations_[operation_index];
     if (!TransformOperation::BlendedBoundsForBox(*bounds, from_op, to_op,
                                                  min_progress, max_progress,
-                                                 &bounds_for_operation)) {
+                                                 &bounds_for_operation,
+                                                 tolerance)) {
       return false;
     }
     *bounds = bounds_for_operation;
@@ -227,7 +233,7 @@ void TransformOperations::AppendTranslate(SkScalar x, SkScalar y, SkScalar z) {
   to_add.translate.y = y;
   to_add.translate.z = z;
   operations_.push_back(to_add);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 void TransformOperations::AppendRotate(SkScalar x,
@@ -242,7 +248,7 @@ void TransformOperations::AppendRotate(SkScalar x,
   to_add.rotate.angle = degrees;
   to_add.Bake();
   operations_.push_back(to_add);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 void TransformOperations::AppendScale(SkScalar x, SkScalar y, SkScalar z) {
@@ -253,7 +259,7 @@ void TransformOperations::AppendScale(SkScalar x, SkScalar y, SkScalar z) {
   to_add.scale.z = z;
   to_add.Bake();
   operations_.push_back(to_add);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 void TransformOperations::AppendSkewX(SkScalar x) {
@@ -263,7 +269,7 @@ void TransformOperations::AppendSkewX(SkScalar x) {
   to_add.skew.y = 0;
   to_add.Bake();
   operations_.push_back(to_add);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 void TransformOperations::AppendSkewY(SkScalar y) {
@@ -273,7 +279,7 @@ void TransformOperations::AppendSkewY(SkScalar y) {
   to_add.skew.y = y;
   to_add.Bake();
   operations_.push_back(to_add);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 void TransformOperations::AppendSkew(SkScalar x, SkScalar y) {
@@ -283,7 +289,7 @@ void TransformOperations::AppendSkew(SkScalar x, SkScalar y) {
   to_add.skew.y = y;
   to_add.Bake();
   operations_.push_back(to_add);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 void TransformOperations::AppendPerspective(std::optional<SkScalar> depth) {
@@ -297,7 +303,7 @@ void TransformOperations::AppendPerspective(std::optional<SkScalar> depth) {
   }
   to_add.Bake();
   operations_.push_back(to_add);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 void TransformOperations::AppendMatrix(const Transform& matrix) {
@@ -305,7 +311,7 @@ void TransformOperations::AppendMatrix(const Transform& matrix) {
   to_add.matrix = matrix;
   to_add.type = TransformOperation::TRANSFORM_OPERATION_MATRIX;
   operations_.push_back(to_add);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 void TransformOperations::AppendIdentity() {
@@ -314,7 +320,7 @@ void TransformOperations::AppendIdentity() {
 
 void TransformOperations::Append(const TransformOperation& operation) {
   operations_.push_back(operation);
-  decomposed_transforms_.clear();
+  num_decomposed_transforms_ = 0;
 }
 
 bool TransformOperations::IsIdentity() const {
@@ -360,31 +366,50 @@ bool TransformOperations::BlendInternal(const TransformOperations& from,
   }
 
   if (matching_prefix_length < num_operations) {
-    if (!ComputeDecomposedTransform(matching_prefix_length) ||
-        !from.ComputeDecomposedTransform(matching_prefix_length)) {
+    std::optional<DecomposedTransform> to_decomp =
+        GetDecomposedTransform(matching_prefix_length);
+    if (!to_decomp) {
       return false;
     }
-    DecomposedTransform matrix_transform = BlendDecomposedTransforms(
-        *decomposed_transforms_[matching_prefix_length].get(),
-        *from.decomposed_transforms_[matching_prefix_length].get(), progress);
+    std::optional<DecomposedTransform> from_decomp =
+        from.GetDecomposedTransform(matching_prefix_length);
+    if (!from_decomp) {
+      return false;
+    }
+    DecomposedTransform matrix_transform =
+        BlendDecomposedTransforms(*to_decomp, *from_decomp, progress);
     result->AppendMatrix(Transform::Compose(matrix_transform));
   }
   return true;
 }
 
-bool TransformOperations::ComputeDecomposedTransform(
+std::optional<DecomposedTransform> TransformOperations::GetDecomposedTransform(
     size_t start_offset) const {
-  auto it = decomposed_transforms_.find(start_offset);
-  if (it == decomposed_transforms_.end()) {
-    Transform transform = ApplyRemaining(start_offset);
-    if (std::optional<DecomposedTransform> decomp = transform.Decompose()) {
-      decomposed_transforms_[start_offset] =
-          std::make_unique<DecomposedTransform>(*decomp);
-    } else {
-      return false;
+  for (size_t i = 0; i < num_decomposed_transforms_; ++i) {
+    if (decomposed_transforms_[i].start_offset == start_offset) {
+      if (decomposed_transforms_frozen_) {
+        return decomposed_transforms_[i].decomposed;
+      }
+      std::rotate(decomposed_transforms_.begin(),
+                  decomposed_transforms_.begin() + i,
+                  decomposed_transforms_.begin() + i + 1);
+      return decomposed_transforms_[0].decomposed;
     }
   }
-  return true;
+
+  std::optional<DecomposedTransform> decomp =
+      DecomposedTransformCache::GetInstance().Decompose(
+          ApplyRemaining(start_offset));
+  if (!decomp || decomposed_transforms_frozen_) {
+    return decomp;
+  }
+  num_decomposed_transforms_ =
+      std::min(num_decomposed_transforms_ + 1, kDecomposedTransformsCacheSize);
+  std::rotate(decomposed_transforms_.begin(),
+              decomposed_transforms_.begin() + num_decomposed_transforms_ - 1,
+              decomposed_transforms_.begin() + num_decomposed_transforms_);
+  decomposed_transforms_[0] = {start_offset, *decomp};
+  return decomp;
 }
 
 }  // namespace gfx
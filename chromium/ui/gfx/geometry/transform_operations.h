@@ -5,21 +5,21 @@
 #ifndef UI_GFX_GEOMETRY_TRANSFORM_OPERATIONS_H_
 #define UI_GFX_GEOMETRY_TRANSFORM_OPERATIONS_H_
 
-#include <memory>
+#include <array>
 #include <optional>
-#include <unordered_map>
 #include <vector>
 
 #include "base/check_op.h"
 #include "base/component_export.h"
 #include "base/gtest_prod_util.h"
+#include "ui/gfx/geometry/decomposed_transform.h"
 #include "ui/gfx/geometry/transform.h"
 #include "ui/gfx/geometry/transform_operation.h"
 
 namespace gfx {
 
 class BoxF;
-struct DecomposedTransform;
+class SharedTransformOperations;
 
 // Transform operations are a decomposed transformation matrix. It can be
 // applied to obtain a Transform at any time, and can be blended
@@ -62,11 +62,17 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) TransformOperations {
   // exist when it is transformed by the result of calling Blend on |from| and
   // with progress in the range [min_progress, max_progress]. If this region
   // cannot be computed, returns false.
+  //
+  // If |tolerance| is positive, the bounds of rotations may be computed by
+  // sampling the rotated corners instead of finding the exact extrema of their
+  // arcs. That is cheaper, and the bounds of each rotation still contain the
+  // exact ones and exceed them by at most |tolerance| on each side.
   bool BlendedBoundsForBox(const BoxF& box,
                            const TransformOperations& from,
                            SkScalar min_progress,
                            SkScalar max_progress,
-                           BoxF* bounds) const;
+                           BoxF* bounds,
+                           SkScalar tolerance = 0) const;
 
   // Returns true if these operations are only translations.
   bool IsTranslation() const;
@@ -121,7 +127,9 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) TransformOperations {
                           SkScalar tolerance) const;
 
  private:
+  friend class SharedTransformOperations;
   FRIEND_TEST_ALL_PREFIXES(TransformOperationsTest, TestDecompositionCache);
+  FRIEND_TEST_ALL_PREFIXES(SharedTransformOperationsTest, FreezesCaches);
 
   bool BlendInternal(const TransformOperations& from,
                      SkScalar progress,
@@ -129,11 +137,29 @@ class COMPONENT_EXPORT(GEOMETRY_SKIA) TransformOperations {
 
   std::vector<TransformOperation> operations_;
 
-  bool ComputeDecomposedTransform(size_t start_offset) const;
-
-  // For efficiency, we cache the decomposed transforms.
-  mutable std::unordered_map<size_t, std::unique_ptr<DecomposedTransform>>
+  // Returns the decomposition of ApplyRemaining(start_offset), or nullopt if
+  // it can't be decomposed.
+  std::optional<DecomposedTransform> GetDecomposedTransform(
+      size_t start_offset) const;
+
+  // For efficiency, we cache the decomposed transforms of the most recently
+  // used start offsets, usually just 0 or the length of a matching prefix.
+  // The cache is copied with the operations, and misses go through the
+  // process-wide DecomposedTransformCache, so that different copies of the
+  // same operations share their decompositions.
+  struct CachedDecomposition {
+    size_t start_offset = 0;
+    DecomposedTransform decomposed;
+  };
+  static constexpr size_t kDecomposedTransformsCacheSize = 2;
+  // Ordered from the most to the least recently used.
+  mutable std::array<CachedDecomposition, kDecomposedTransformsCacheSize>
       decomposed_transforms_;
+  mutable size_t num_decomposed_transforms_ = 0;
+  // Set for the operations of a SharedTransformOperations, which may be read
+  // on several threads at once, so that GetDecomposedTransform() doesn't
+  // update the cache. Not copied, so copies cache as usual.
+  bool decomposed_transforms_frozen_ = false;
 };
 
 }  // namespace gfx
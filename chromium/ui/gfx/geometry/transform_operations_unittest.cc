@@ -15,6 +15,7 @@
 #include "ui/gfx/animation/tween.h"
 #include "ui/gfx/geometry/box_f.h"
 #include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/test/geometry_edge_cases.h"
 #include "ui/gfx/geometry/test/geometry_util.h"
 #include "ui/gfx/geometry/vector3d_f.h"
 
@@ -1316,6 +1317,60 @@ TEST(TransformOperationTest, BlendedBoundsForRotationEmpiricalTests) {
   }
 }
 
+TEST(TransformOperationTest, BlendedBoundsForRotationWithTolerance) {
+  // With a tolerance, the bounds contain the exact bounds and exceed them by
+  // at most the tolerance on each side.
+  struct {
+    Vector3dF axis;
+    float from_degrees;
+    float to_degrees;
+  } rotations[] = {{Vector3dF(0, 0, 1), 0, 90},
+                   {Vector3dF(1, 1, 1), 30, 390},
+                   {Vector3dF(1, 2, 3), -45, 120},
+                   {Vector3dF(0, -1, 0), 10, 20}};
+  const BoxF box(1, 2, 3, 10, 20, 5);
+  // Allows for float rounding of the exact bounds.
+  const float kEpsilon = 1e-4f;
+
+  for (const auto& rotation : rotations) {
+    TransformOperations operations_from;
+    operations_from.AppendRotate(rotation.axis.x(), rotation.axis.y(),
+                                 rotation.axis.z(), rotation.from_degrees);
+    TransformOperations operations_to;
+    operations_to.AppendRotate(rotation.axis.x(), rotation.axis.y(),
+                               rotation.axis.z(), rotation.to_degrees);
+    BoxF exact;
+    ASSERT_TRUE(operations_to.BlendedBoundsForBox(box, operations_from, -0.25f,
+                                                  1.f, &exact));
+    for (float tolerance : {0.5f, 5.f, 100.f}) {
+      SCOPED_TRACE(testing::Message()
+                   << rotation.axis.ToString() << " " << rotation.from_degrees
+                   << " " << rotation.to_degrees << " " << tolerance);
+      BoxF bounds;
+      ASSERT_TRUE(operations_to.BlendedBoundsForBox(
+          box, operations_from, -0.25f, 1.f, &bounds, tolerance));
+      EXPECT_LE(bounds.x(), exact.x() + kEpsilon);
+      EXPECT_LE(bounds.y(), exact.y() + kEpsilon);
+      EXPECT_LE(bounds.z(), exact.z() + kEpsilon);
+      EXPECT_GE(bounds.right(), exact.right() - kEpsilon);
+      EXPECT_GE(bounds.bottom(), exact.bottom() - kEpsilon);
+      EXPECT_GE(bounds.front(), exact.front() - kEpsilon);
+      EXPECT_GE(bounds.x(), exact.x() - tolerance - kEpsilon);
+      EXPECT_GE(bounds.y(), exact.y() - tolerance - kEpsilon);
+      EXPECT_GE(bounds.z(), exact.z() - tolerance - kEpsilon);
+      EXPECT_LE(bounds.right(), exact.right() + tolerance + kEpsilon);
+      EXPECT_LE(bounds.bottom(), exact.bottom() + tolerance + kEpsilon);
+      EXPECT_LE(bounds.front(), exact.front() + tolerance + kEpsilon);
+    }
+
+    // A tolerance that needs too many samples gives the exact bounds.
+    BoxF bounds;
+    ASSERT_TRUE(operations_to.BlendedBoundsForBox(box, operations_from, -0.25f,
+                                                  1.f, &bounds, 1e-6f));
+    EXPECT_EQ(exact, bounds);
+  }
+}
+
 TEST(TransformOperationTest, PerspectiveMatrixAndTransformBlendingEquivalency) {
   TransformOperations from_operations;
   from_operations.AppendPerspective(200);
@@ -1374,6 +1429,16 @@ TEST(TransformOperationTest, BlendedBoundsForPerspective) {
   }
 }
 
+TEST(TransformOperationTest, BlendedBoundsForEdgeCases) {
+  for (const TransformOperationsEdgeCase& edge_case :
+       GetTransformOperationsEdgeCases()) {
+    SCOPED_TRACE(edge_case.name);
+    EmpiricallyTestBoundsContainment(edge_case.from, edge_case.to, 0.f, 1.f);
+    EmpiricallyTestBoundsContainment(edge_case.from, edge_case.to, -.25f,
+                                     1.25f);
+  }
+}
+
 TEST(TransformOperationTest, BlendedBoundsForSkew) {
   struct {
     float from_x;
@@ -1722,55 +1787,68 @@ TEST(TransformOperationsTest, ApproximateEquality) {
 // it needs to be friend of TransformOperations.
 TEST(TransformOperationsTest, TestDecompositionCache) {
   TransformOperations transforms;
-  EXPECT_EQ(0UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(0));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
+  EXPECT_EQ(0UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(0));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
 
   // Reset cache when appending a scale transform.
   transforms.AppendScale(2.f, 2.f, 2.f);
-  EXPECT_EQ(0UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(1));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(1));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(0));
-  EXPECT_EQ(2UL, transforms.decomposed_transforms_.size());
+  EXPECT_EQ(0UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(1));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(1));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(0));
+  EXPECT_EQ(2UL, transforms.num_decomposed_transforms_);
+  EXPECT_EQ(0UL, transforms.decomposed_transforms_[0].start_offset);
+
+  // The least recently used offset is evicted.
+  EXPECT_TRUE(transforms.GetDecomposedTransform(1));
+  EXPECT_EQ(1UL, transforms.decomposed_transforms_[0].start_offset);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(2));
+  EXPECT_EQ(2UL, transforms.num_decomposed_transforms_);
+  EXPECT_EQ(2UL, transforms.decomposed_transforms_[0].start_offset);
+  EXPECT_EQ(1UL, transforms.decomposed_transforms_[1].start_offset);
+
+  // Copies keep the cache.
+  TransformOperations copy = transforms;
+  EXPECT_EQ(2UL, copy.num_decomposed_transforms_);
 
   // Reset cache when appending a rotation transform.
   transforms.AppendRotate(1, 0, 0, 45);
-  EXPECT_EQ(0UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(0));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
+  EXPECT_EQ(0UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(0));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
 
   // Reset cache when appending a translation transform.
   transforms.AppendTranslate(1, 1, 1);
-  EXPECT_EQ(0UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(0));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
+  EXPECT_EQ(0UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(0));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
 
   // Reset cache when appending a skew transform.
   transforms.AppendSkew(1, 0);
-  EXPECT_EQ(0UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(0));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
+  EXPECT_EQ(0UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(0));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
 
   // Reset cache when appending a perspective transform.
   transforms.AppendPerspective(800);
-  EXPECT_EQ(0UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(0));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
+  EXPECT_EQ(0UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(0));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
 
   // Reset cache when appending a matrix transform.
   transforms.AppendMatrix(gfx::Transform());
-  EXPECT_EQ(0UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(0));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
+  EXPECT_EQ(0UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(0));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
 
   // Reset cache when appending a generic transform operation.
   transforms.Append(TransformOperation());
-  EXPECT_EQ(0UL, transforms.decomposed_transforms_.size());
-  EXPECT_TRUE(transforms.ComputeDecomposedTransform(0));
-  EXPECT_EQ(1UL, transforms.decomposed_transforms_.size());
+  EXPECT_EQ(0UL, transforms.num_decomposed_transforms_);
+  EXPECT_TRUE(transforms.GetDecomposedTransform(0));
+  EXPECT_EQ(1UL, transforms.num_decomposed_transforms_);
 }
 
 TEST(TransformOperationTest, BlendSkewMismatch) {
@@ -0,0 +1,178 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Microbenchmarks of the hot paths of gfx::Transform, for the
+// geometry_perftests target. Each benchmark runs for every transform kind in
+// TransformKind. Run with --benchmark_format=json (or --benchmark_out=<file>
+// --benchmark_out_format=json) to get results that can be diffed across
+// versions, e.g. with tools/compare.py of google_benchmark.
+
+#include <array>
+#include <optional>
+
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+#include "ui/gfx/geometry/decomposed_transform.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/transform.h"
+#include "ui/gfx/geometry/vector3d_f.h"
+
+namespace gfx {
+
+namespace {
+
+enum class TransformKind {
+  kIdentity,
+  kTranslate,
+  kScale,
+  kAffine2d,
+  k3d,
+  kPerspective,
+};
+constexpr int kNumTransformKinds = 6;
+
+const char* TransformKindName(TransformKind kind) {
+  switch (kind) {
+    case TransformKind::kIdentity:
+      return "identity";
+    case TransformKind::kTranslate:
+      return "translate";
+    case TransformKind::kScale:
+      return "scale";
+    case TransformKind::kAffine2d:
+      return "affine_2d";
+    case TransformKind::k3d:
+      return "3d";
+    case TransformKind::kPerspective:
+      return "perspective";
+  }
+}
+
+// Returns a transform of |kind|. |variant| gives a slightly different
+// transform of the same kind, so that binary operations don't operate on
+// two identical operands.
+Transform MakeTransform(TransformKind kind, int variant = 0) {
+  float v = variant + 1;
+  Transform transform;
+  switch (kind) {
+    case TransformKind::kIdentity:
+      break;
+    case TransformKind::kTranslate:
+      transform.Translate(10 * v, 20 * v);
+      break;
+    case TransformKind::kScale:
+      transform.Translate(10 * v, 20 * v);
+      transform.Scale(1.5f * v, 2.5f);
+      break;
+    case TransformKind::kAffine2d:
+      transform.Translate(10 * v, 20 * v);
+      transform.Rotate(30 * v);
+      transform.Scale(1.5f, 2.5f * v);
+      break;
+    case TransformKind::k3d:
+      transform.Translate3d(10 * v, 20 * v, 30);
+      transform.RotateAbout(Vector3dF(1, 2, 3), 40 * v);
+      transform.Scale3d(1.5f, 2.5f, 3.5f * v);
+      break;
+    case TransformKind::kPerspective:
+      transform.ApplyPerspectiveDepth(500 * v);
+      transform.RotateAboutYAxis(30 * v);
+      transform.RotateAboutXAxis(-20);
+      transform.Translate(10, 20);
+      break;
+  }
+  return transform;
+}
+
+TransformKind GetKind(benchmark::State& state) {
+  auto kind = static_cast<TransformKind>(state.range(0));
+  state.SetLabel(TransformKindName(kind));
+  return kind;
+}
+
+void BM_PreConcat(benchmark::State& state) {
+  TransformKind kind = GetKind(state);
+  const Transform base = MakeTransform(kind);
+  const Transform other = MakeTransform(kind, 1);
+  for (auto _ : state) {
+    Transform transform = base;
+    transform.PreConcat(other);
+    benchmark::DoNotOptimize(transform);
+  }
+}
+
+void BM_PostConcat(benchmark::State& state) {
+  TransformKind kind = GetKind(state);
+  const Transform base = MakeTransform(kind);
+  const Transform other = MakeTransform(kind, 1);
+  for (auto _ : state) {
+    Transform transform = base;
+    transform.PostConcat(other);
+    benchmark::DoNotOptimize(transform);
+  }
+}
+
+void BM_MapRect(benchmark::State& state) {
+  const Transform transform = MakeTransform(GetKind(state));
+  RectF rect(1.5f, 2.5f, 100, 200);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(rect);
+    benchmark::DoNotOptimize(transform.MapRect(rect));
+  }
+}
+
+void BM_GetInverse(benchmark::State& state) {
+  const Transform transform = MakeTransform(GetKind(state));
+  for (auto _ : state) {
+    Transform inverse;
+    benchmark::DoNotOptimize(transform.GetInverse(&inverse));
+    benchmark::DoNotOptimize(inverse);
+  }
+}
+
+void BM_DecomposeCompose(benchmark::State& state) {
+  const Transform transform = MakeTransform(GetKind(state));
+  for (auto _ : state) {
+    std::optional<DecomposedTransform> decomp = transform.Decompose();
+    benchmark::DoNotOptimize(decomp);
+    if (decomp) {
+      benchmark::DoNotOptimize(Transform::Compose(*decomp));
+    }
+  }
+}
+
+void BM_Blend(benchmark::State& state) {
+  TransformKind kind = GetKind(state);
+  const Transform from = MakeTransform(kind);
+  const Transform to = MakeTransform(kind, 1);
+  for (auto _ : state) {
+    Transform transform = to;
+    benchmark::DoNotOptimize(transform.Blend(from, 0.25));
+    benchmark::DoNotOptimize(transform);
+  }
+}
+
+void BM_ProjectQuad(benchmark::State& state) {
+  const Transform transform = MakeTransform(GetKind(state));
+  QuadF quad(RectF(1.5f, 2.5f, 100, 200));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(quad);
+    benchmark::DoNotOptimize(transform.ProjectQuad(quad));
+  }
+}
+
+#define TRANSFORM_BENCHMARK(name) \
+  BENCHMARK(name)->ArgName("kind")->DenseRange(0, kNumTransformKinds - 1)
+
+TRANSFORM_BENCHMARK(BM_PreConcat);
+TRANSFORM_BENCHMARK(BM_PostConcat);
+TRANSFORM_BENCHMARK(BM_MapRect);
+TRANSFORM_BENCHMARK(BM_GetInverse);
+TRANSFORM_BENCHMARK(BM_DecomposeCompose);
+TRANSFORM_BENCHMARK(BM_Blend);
+TRANSFORM_BENCHMARK(BM_ProjectQuad);
+
+}  // namespace
+
+}  // namespace gfx
@@ -0,0 +1,171 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_serialization.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+#include "base/numerics/safe_conversions.h"
+#include "ui/gfx/geometry/axis_transform2d.h"
+#include "ui/gfx/geometry/vector2d_f.h"
+
+namespace gfx {
+
+namespace {
+
+// The kinds of transforms, in the low bits of the tag byte.
+enum Kind : uint8_t {
+  kIdentity,
+  kTranslation,
+  kScaleAndTranslation,
+  kAffine,
+  kMatrix,
+  kNumKinds,
+};
+
+// The number of components that each kind needs.
+constexpr std::array<size_t, kNumKinds> kNumComponents = {0u, 2u, 4u, 6u, 16u};
+
+// Set in the tag byte if the components are encoded as floats.
+constexpr uint8_t kFloatComponents = 0x80u;
+
+struct Encoding {
+  Kind kind;
+  bool float_components;
+  // The first kNumComponents[kind] are used.
+  std::array<double, 16> components;
+
+  size_t num_components() const { return kNumComponents[kind]; }
+  size_t size() const {
+    return 1u + num_components() *
+                    (float_components ? sizeof(float) : sizeof(double));
+  }
+};
+
+bool IsExactlyFloat(double value) {
+  return base::IsValueInRangeForNumericType<float>(value) &&
+         static_cast<float>(value) == value;
+}
+
+Encoding Encode(const Transform& transform) {
+  std::array<double, 16> m;
+  transform.GetColMajor(m);
+
+  Encoding encoding;
+  const bool is_2d = m[2] == 0 && m[3] == 0 && m[6] == 0 && m[7] == 0 &&
+                     m[8] == 0 && m[9] == 0 && m[10] == 1 && m[11] == 0 &&
+                     m[14] == 0 && m[15] == 1;
+  if (!is_2d) {
+    encoding.kind = kMatrix;
+    encoding.components = m;
+  } else if (m[1] != 0 || m[4] != 0) {
+    encoding.kind = kAffine;
+    encoding.components = {m[0], m[1], m[4], m[5], m[12], m[13]};
+  } else if (m[0] != 1 || m[5] != 1) {
+    encoding.kind = kScaleAndTranslation;
+    encoding.components = {m[0], m[5], m[12], m[13]};
+  } else if (m[12] != 0 || m[13] != 0) {
+    encoding.kind = kTranslation;
+    encoding.components = {m[12], m[13]};
+  } else {
+    encoding.kind = kIdentity;
+  }
+  encoding.float_components = std::all_of(
+      encoding.components.begin(),
+      encoding.components.begin() + encoding.num_components(), IsExactlyFloat);
+  return encoding;
+}
+
+}  // namespace
+
+size_t GetSerializedTransformSize(const Transform& transform) {
+  return Encode(transform).size();
+}
+
+bool WriteTransform(const Transform& transform, base::SpanWriter& writer) {
+  const Encoding encoding = Encode(transform);
+  if (writer.remaining() < encoding.size()) {
+    return false;
+  }
+  const uint8_t tag =
+      encoding.kind | (encoding.float_components ? kFloatComponents : 0u);
+  writer.WriteLittleEndian(tag);
+  const size_t count = encoding.num_components();
+  if (encoding.float_components) {
+    std::array<float, 16> components;
+    for (size_t i = 0; i < count; ++i) {
+      components[i] = static_cast<float>(encoding.components[i]);
+    }
+    writer.WriteFloatsLittleEndian(std::span(components).first(count));
+  } else {
+    writer.WriteDoublesLittleEndian(
+        std::span(encoding.components).first(count));
+  }
+  return true;
+}
+
+std::optional<Transform> ReadTransform(base::SpanReader& reader) {
+  // The whole encoding is checked before it's read, so that |reader| doesn't
+  // move on failure.
+  const std::span<const uint8_t> bytes = reader.remaining_span();
+  if (bytes.empty()) {
+    return std::nullopt;
+  }
+  Encoding encoding;
+  const uint8_t tag = bytes[0];
+  if ((tag & ~kFloatComponents) >= kNumKinds) {
+    return std::nullopt;
+  }
+  encoding.kind = static_cast<Kind>(tag & ~kFloatComponents);
+  encoding.float_components = tag & kFloatComponents;
+  if (bytes.size() < encoding.size()) {
+    return std::nullopt;
+  }
+
+  reader.Skip(1u);
+  const size_t count = encoding.num_components();
+  std::array<float, 16> floats;
+  std::array<double, 16>& c = encoding.components;
+  if (encoding.float_components) {
+    reader.ReadFloatsLittleEndian(std::span(floats).first(count));
+    std::copy_n(floats.begin(), count, c.begin());
+  } else {
+    reader.ReadDoublesLittleEndian(std::span(c).first(count));
+  }
+
+  switch (encoding.kind) {
+    case kIdentity:
+      return Transform();
+    case kTranslation:
+    case kScaleAndTranslation: {
+      const bool has_scale = encoding.kind == kScaleAndTranslation;
+      const double scale_x = has_scale ? c[0] : 1.0;
+      const double scale_y = has_scale ? c[1] : 1.0;
+      const double translate_x = has_scale ? c[2] : c[0];
+      const double translate_y = has_scale ? c[3] : c[1];
+      if (encoding.float_components) {
+        return Transform(AxisTransform2d::FromScaleAndTranslation(
+            Vector2dF(scale_x, scale_y), Vector2dF(translate_x, translate_y)));
+      }
+      return Transform::Affine(scale_x, 0, 0, scale_y, translate_x,
+                               translate_y);
+    }
+    case kAffine:
+      return Transform::Affine(c[0], c[1], c[2], c[3], c[4], c[5]);
+    case kMatrix:
+      if (encoding.float_components) {
+        return Transform::ColMajorF(floats);
+      }
+      return Transform::ColMajor(c);
+    case kNumKinds:
+      break;
+  }
+  return std::nullopt;
+}
+
+}  // namespace gfx
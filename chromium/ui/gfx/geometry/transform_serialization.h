@@ -0,0 +1,54 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TRANSFORM_SERIALIZATION_H_
+#define UI_GFX_GEOMETRY_TRANSFORM_SERIALIZATION_H_
+
+#include <stddef.h>
+
+#include <optional>
+
+#include "base/component_export.h"
+#include "base/numerics/span_reader_writer.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+// A compact binary encoding of Transforms, for IPC and recordings, which most
+// often hold identity, translation or scale and translation transforms.
+// Instead of the 16 doubles of GetColMajor(), a transform is encoded as a tag
+// byte, which gives its kind, followed by only the components that the kind
+// needs, in little endian:
+// - identity: none;
+// - 2d translation: the x and y translations;
+// - 2d scale and translation: the x and y scales, then the translations;
+// - 2d affine: the a to f arguments of Transform::Affine();
+// - anything else: the 16 components in col-major order.
+// The components are encoded as floats if they all are exactly floats, as
+// those of transforms backed by AxisTransform2d always are, and as doubles
+// otherwise. Decoding them gives a transform equal to the encoded one, backed
+// by AxisTransform2d if the components are floats and fit in one, and by a
+// full matrix otherwise, so the common kinds are decoded without a Matrix44.
+// Zero components are decoded as 0, whatever their sign.
+
+// The size of the largest encoding, that of a full matrix of doubles.
+inline constexpr size_t kMaxSerializedTransformSize = 1u + 16u * sizeof(double);
+
+// Returns the size of the encoding of |transform|.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+size_t GetSerializedTransformSize(const Transform& transform);
+
+// Writes the encoding of |transform| into |writer|. Returns false, without
+// writing anything, if it doesn't fit.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+bool WriteTransform(const Transform& transform, base::SpanWriter& writer);
+
+// Reads a transform from its encoding in |reader|. Returns nullopt, without
+// moving |reader|, if the encoding isn't valid or is truncated.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+std::optional<Transform> ReadTransform(base::SpanReader& reader);
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TRANSFORM_SERIALIZATION_H_
@@ -0,0 +1,146 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_serialization.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <span>
+
+#include "base/numerics/span_reader_writer.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+namespace {
+
+// Writes and reads back |transform|, and checks the size of its encoding.
+std::optional<Transform> RoundTrip(const Transform& transform,
+                                   size_t expected_size) {
+  std::array<uint8_t, kMaxSerializedTransformSize> buffer;
+  base::SpanWriter writer(buffer);
+  EXPECT_EQ(expected_size, GetSerializedTransformSize(transform));
+  EXPECT_TRUE(WriteTransform(transform, writer));
+  EXPECT_EQ(expected_size, writer.num_written());
+
+  base::SpanReader reader{std::span(buffer).first(writer.num_written())};
+  std::optional<Transform> result = ReadTransform(reader);
+  EXPECT_EQ(0u, reader.remaining());
+  return result;
+}
+
+}  // namespace
+
+TEST(TransformSerializationTest, AxisTransforms) {
+  std::optional<Transform> result = RoundTrip(Transform(), 1u);
+  ASSERT_TRUE(result);
+  EXPECT_TRUE(result->IsIdentity());
+  EXPECT_FALSE(result->IsFullMatrixForTesting());
+
+  const Transform translation = Transform::MakeTranslation(1.5f, -20);
+  result = RoundTrip(translation, 1u + 2u * sizeof(float));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(translation, *result);
+  EXPECT_FALSE(result->IsFullMatrixForTesting());
+
+  Transform scale_and_translation = Transform::MakeScale(2, 0.25f);
+  scale_and_translation.PostTranslate(Vector2dF(100, 200));
+  result = RoundTrip(scale_and_translation, 1u + 4u * sizeof(float));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(scale_and_translation, *result);
+  EXPECT_FALSE(result->IsFullMatrixForTesting());
+
+  // Full matrices of the same kinds are decoded as AxisTransform2d if their
+  // components are floats.
+  Transform full = scale_and_translation;
+  full.EnsureFullMatrixForTesting();
+  result = RoundTrip(full, 1u + 4u * sizeof(float));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(full, *result);
+  EXPECT_FALSE(result->IsFullMatrixForTesting());
+}
+
+TEST(TransformSerializationTest, DoubleComponents) {
+  const Transform translation = Transform::Affine(1, 0, 0, 1, 0.1, 3);
+  std::optional<Transform> result =
+      RoundTrip(translation, 1u + 2u * sizeof(double));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(translation, *result);
+  EXPECT_TRUE(result->IsAffine2dForTesting());
+
+  const Transform scale = Transform::Affine(1e300, 0, 0, 2, 0, 0);
+  result = RoundTrip(scale, 1u + 4u * sizeof(double));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(scale, *result);
+
+  // NaNs aren't floats equal to themselves, so they're encoded as doubles.
+  const Transform nan = Transform::Affine(
+      1, 0, 0, std::numeric_limits<double>::quiet_NaN(), 0, 0);
+  result = RoundTrip(nan, 1u + 4u * sizeof(double));
+  ASSERT_TRUE(result);
+  EXPECT_TRUE(std::isnan(result->rc(1, 1)));
+}
+
+TEST(TransformSerializationTest, AffineAndMatrix) {
+  const Transform affine = Transform::Affine(1, 2, 3, 4, 5, 6);
+  std::optional<Transform> result = RoundTrip(affine, 1u + 6u * sizeof(float));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(affine, *result);
+
+  Transform rotation;
+  rotation.RotateAboutZAxis(30);
+  result = RoundTrip(rotation, 1u + 6u * sizeof(double));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(rotation, *result);
+
+  const Transform matrix = Transform::ColMajor(1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+                                               11, 12, 13, 14, 15, 16);
+  result = RoundTrip(matrix, 1u + 16u * sizeof(float));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(matrix, *result);
+
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(3);
+  result = RoundTrip(perspective, kMaxSerializedTransformSize);
+  ASSERT_TRUE(result);
+  EXPECT_EQ(perspective, *result);
+}
+
+TEST(TransformSerializationTest, Failures) {
+  const Transform transform = Transform::MakeTranslation(1, 2);
+  std::array<uint8_t, 8u> buffer = {};
+  base::SpanWriter short_writer{std::span(buffer).first(4u)};
+  EXPECT_FALSE(WriteTransform(transform, short_writer));
+  EXPECT_EQ(0u, short_writer.num_written());
+
+  base::SpanWriter writer(buffer);
+  EXPECT_FALSE(WriteTransform(transform, writer));
+  EXPECT_EQ(0u, writer.num_written());
+  EXPECT_TRUE(WriteTransform(Transform(), writer));
+  EXPECT_EQ(1u, writer.num_written());
+
+  // A truncated encoding, an unknown kind and no encoding at all.
+  std::array<uint8_t, 9u> encoding = {};
+  base::SpanWriter encoding_writer(encoding);
+  ASSERT_TRUE(WriteTransform(transform, encoding_writer));
+  base::SpanReader truncated{std::span(encoding).first(8u)};
+  EXPECT_FALSE(ReadTransform(truncated));
+  EXPECT_EQ(8u, truncated.remaining());
+
+  encoding[0] = 0x7f;
+  base::SpanReader unknown(encoding);
+  EXPECT_FALSE(ReadTransform(unknown));
+  EXPECT_EQ(9u, unknown.remaining());
+
+  base::SpanReader empty{std::span(encoding).first(0u)};
+  EXPECT_FALSE(ReadTransform(empty));
+}
+
+}  // namespace gfx
@@ -12,6 +12,7 @@
 #include <numbers>
 #include <optional>
 #include <ostream>
+#include <vector>
 
 #include "base/compiler_specific.h"
 #include "base/containers/span.h"
@@ -22,9 +23,12 @@
 #include "ui/gfx/geometry/axis_transform2d.h"
 #include "ui/gfx/geometry/box_f.h"
 #include "ui/gfx/geometry/decomposed_transform.h"
+#include "ui/gfx/geometry/float3_array.h"
 #include "ui/gfx/geometry/point.h"
 #include "ui/gfx/geometry/point3_f.h"
 #include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/quaternion.h"
+#include "ui/gfx/geometry/test/geometry_edge_cases.h"
 #include "ui/gfx/geometry/test/geometry_util.h"
 #include "ui/gfx/geometry/vector3d_f.h"
 
@@ -1690,6 +1694,53 @@ TEST(XFormTest, DecomposeAndCompose) {
   EXPECT_EQ(0, ComputeDecompRecompError(transform(-1, -1, 1, 1, 2)));
 }
 
+TEST(XFormTest, ComposeMany) {
+  std::vector<DecomposedTransform> decomps(7);
+  decomps[1].translate = {10, -20, 0};
+  decomps[2].translate = {1, 2, 3};
+  decomps[2].quaternion = Quaternion::FromAxisAngle(1, 2, 3, 0.5);
+  decomps[3].scale = {2, -3, 4};
+  decomps[3].skew = {0.5, 0, 0.25};
+  decomps[3].quaternion = Quaternion::FromAxisAngle(0, 0, 1, 1);
+  decomps[4].perspective = {0, 0, -0.002, 1};
+  decomps[4].quaternion = Quaternion::FromAxisAngle(0, 1, 0, -2);
+  decomps[5] = *Transform::RowMajor(2, 3, 4, 5, 6, 7, 8, 9, 1, 2, 3, 4, 0.1,
+                                    0.2, 0.3, 1)
+                    .Decompose();
+  // A 2d rotation, which is composed without a full matrix.
+  decomps[6].translate = {5, 6, 0};
+  decomps[6].scale = {2, 3, 1};
+  decomps[6].quaternion = Quaternion::FromAxisAngle(0, 0, 1, 0.75);
+  ASSERT_TRUE(Transform::Compose(decomps[6]).IsAffine2dForTesting());
+
+  // Fewer than all of |decomps| leaves some lanes unused.
+  for (size_t size : {size_t{1}, size_t{4}, decomps.size()}) {
+    std::vector<std::array<double, 3u>> translate;
+    std::vector<std::array<double, 3u>> scale;
+    std::vector<std::array<double, 3u>> skew;
+    std::vector<std::array<double, 4u>> perspective;
+    std::vector<Quaternion> quaternion;
+    for (size_t i = 0; i < size; ++i) {
+      translate.push_back(decomps[i].translate);
+      scale.push_back(decomps[i].scale);
+      skew.push_back(decomps[i].skew);
+      perspective.push_back(decomps[i].perspective);
+      quaternion.push_back(decomps[i].quaternion);
+    }
+    std::vector<Transform> out(size);
+    Transform::ComposeMany({translate, scale, skew, perspective, quaternion},
+                           out);
+    for (size_t i = 0; i < size; ++i) {
+      SCOPED_TRACE(decomps[i].ToString());
+      const Transform composed = Transform::Compose(decomps[i]);
+      EXPECT_EQ(composed, out[i]);
+      EXPECT_EQ(composed.IsAffine2dForTesting(), out[i].IsAffine2dForTesting());
+      EXPECT_EQ(composed.IsFullMatrixForTesting(),
+                out[i].IsFullMatrixForTesting());
+    }
+  }
+}
+
 TEST(XFormTest, IsIdentityOr2dTranslation) {
   EXPECT_TRUE(Transform().IsIdentityOr2dTranslation());
   EXPECT_TRUE(Transform::MakeTranslation(10, 0).IsIdentityOr2dTranslation());
@@ -1757,6 +1808,23 @@ TEST(XFormTest, Integer2dTranslation) {
   EXPECT_FALSE(transform.IsIdentityOrInteger2dTranslation());
 }
 
+TEST(XFormTest, ToInteger2dTranslation) {
+  EXPECT_EQ(Vector2d(), Transform().ToInteger2dTranslation());
+  EXPECT_EQ(Vector2d(1, -2),
+            Transform::MakeTranslation(1, -2).ToInteger2dTranslation());
+  // A z translation needs a full matrix, and doesn't matter.
+  Transform transform;
+  transform.Translate3d(1, 2, 3.5);
+  EXPECT_EQ(Vector2d(1, 2), transform.ToInteger2dTranslation());
+
+  EXPECT_FALSE(Transform::MakeTranslation(1.5, 2).ToInteger2dTranslation());
+  EXPECT_FALSE(Transform::MakeTranslation(1, -2.25).ToInteger2dTranslation());
+  EXPECT_FALSE(Transform::MakeScale(2).ToInteger2dTranslation());
+  float max_int = static_cast<float>(std::numeric_limits<int>::max());
+  EXPECT_FALSE(Transform::MakeTranslation(max_int + 1000.5f, 0)
+                   .ToInteger2dTranslation());
+}
+
 TEST(XFormTest, Inverse) {
   {
     Transform identity;
@@ -2183,6 +2251,51 @@ TEST(XFormTest, PreConcat) {
   EXPECT_ROW3_EQ(2414.0f, 2718.0f, 3022.0f, 3326.0f, A);
 }
 
+TEST(XFormTest, ConcatFullScaleOrTranslation) {
+  // The reference product, computed component by component.
+  auto multiply = [](const Transform& a, const Transform& b) {
+    Transform result;
+    for (int row = 0; row < 4; ++row) {
+      for (int col = 0; col < 4; ++col) {
+        double sum = 0;
+        for (int k = 0; k < 4; ++k) {
+          sum += a.rc(row, k) * b.rc(k, col);
+        }
+        result.set_rc(row, col, sum);
+      }
+    }
+    return result;
+  };
+
+  Transform translation;
+  translation.Translate3d(5, -6, 7);
+  Transform scale_translation = translation;
+  scale_translation.Scale3d(2, 3, 4);
+  for (const Transform& scale_or_translation :
+       {translation, scale_translation}) {
+    SCOPED_TRACE(scale_or_translation.ToString());
+    ASSERT_TRUE(scale_or_translation.IsFullMatrixForTesting());
+    const Transform general = GetTestMatrix1();
+    EXPECT_EQ(multiply(general, scale_or_translation),
+              general * scale_or_translation);
+    EXPECT_EQ(multiply(scale_or_translation, general),
+              scale_or_translation * general);
+
+    Transform transform = general;
+    transform.PreConcat(scale_or_translation);
+    EXPECT_EQ(multiply(general, scale_or_translation), transform);
+    transform = general;
+    transform.PostConcat(scale_or_translation);
+    EXPECT_EQ(multiply(scale_or_translation, general), transform);
+    transform = scale_or_translation;
+    transform.PreConcat(general);
+    EXPECT_EQ(multiply(scale_or_translation, general), transform);
+    transform = scale_or_translation;
+    transform.PostConcat(general);
+    EXPECT_EQ(multiply(general, scale_or_translation), transform);
+  }
+}
+
 TEST(XFormTest, verifyMakeIdentiy) {
   Transform A = GetTestMatrix1();
   A.MakeIdentity();
@@ -3059,6 +3172,33 @@ TEST(XFormTest, To2dScale) {
   }
 }
 
+TEST(XFormTest, To2dAffine) {
+  EXPECT_EQ(AffineTransform2d(), Transform().To2dAffine());
+  EXPECT_EQ(AffineTransform2d(2, 0, 0, 3, 4, 5),
+            Transform::Affine(2, 0, 0, 3, 4, 5).To2dAffine());
+  EXPECT_EQ(AffineTransform2d(2, 0, 0, 3, 4, 5),
+            (Transform::MakeTranslation(4, 5) * Transform::MakeScale(2, 3))
+                .To2dAffine());
+  EXPECT_EQ(AffineTransform2d(1, 2, 3, 4, 5, 6),
+            Transform::Affine(1, 2, 3, 4, 5, 6).To2dAffine());
+
+  // Other components of full matrices are ignored.
+  Transform full = Transform::Affine(1, 2, 3, 4, 5, 6);
+  full.RotateAboutXAxis(30);
+  EXPECT_EQ(AffineTransform2d(full.rc(0, 0), full.rc(1, 0), full.rc(0, 1),
+                              full.rc(1, 1), full.rc(0, 3), full.rc(1, 3)),
+            full.To2dAffine());
+
+  // Concatenating it keeps a 2d transform off the full matrix.
+  Transform transform = Transform::MakeScale(2, 3);
+  transform.PreConcat(AffineTransform2d(1, 2, 3, 4, 5, 6));
+  EXPECT_TRUE(transform.IsAffine2dForTesting());
+  EXPECT_EQ(Transform::MakeScale(2, 3) * Transform::Affine(1, 2, 3, 4, 5, 6),
+            transform);
+  transform.PostConcat(AffineTransform2d(1, 2, 3, 4, 5, 6));
+  EXPECT_TRUE(transform.IsAffine2dForTesting());
+}
+
 TEST(XFormTest, Flatten) {
   Transform A = GetTestMatrix1();
   EXPECT_FALSE(A.IsFlat());
@@ -3521,6 +3661,37 @@ TEST(XFormTest, MapIntRect) {
 
   auto singular = Transform::MakeScale(0.f);
   EXPECT_EQ(Rect(0, 0, 0, 0), singular.MapRect(Rect(1, 2, 3, 4)));
+
+  // Integer translations are exact beyond the precision of floats, and
+  // saturate.
+  auto integer_translation = Transform::MakeTranslation(2, -3);
+  EXPECT_EQ(Rect(100000003, -2, 5, 7),
+            integer_translation.MapRect(Rect(100000001, 1, 5, 7)));
+  Transform translation_3d;
+  translation_3d.Translate3d(2, -3, 0.5);
+  EXPECT_EQ(Rect(100000003, -2, 5, 7),
+            translation_3d.MapRect(Rect(100000001, 1, 5, 7)));
+  integer_translation = Transform::MakeTranslation(100, 0);
+  int max_int = std::numeric_limits<int>::max();
+  EXPECT_EQ(Rect(max_int, 0, 0, 5),
+            integer_translation.MapRect(Rect(max_int - 10, 0, 5, 5)));
+
+  // So are quarter turns and flips with integer translations.
+  auto rotation = Transform::Make90degRotation();
+  EXPECT_EQ(Rect(-6, 1, 4, 3), rotation.MapRect(Rect(1, 2, 3, 4)));
+  Transform full_rotation = rotation;
+  full_rotation.EnsureFullMatrixForTesting();
+  EXPECT_EQ(Rect(-6, 1, 4, 3), full_rotation.MapRect(Rect(1, 2, 3, 4)));
+  rotation.PostTranslate(2, -3);
+  EXPECT_EQ(Rect(-6, 99999998, 7, 5),
+            rotation.MapRect(Rect(100000001, 1, 5, 7)));
+  EXPECT_EQ(Rect(-100000006, 1, 5, 7),
+            Transform::MakeScale(-1, 1).MapRect(Rect(100000001, 1, 5, 7)));
+  EXPECT_EQ(Rect(0, max_int - 4, 5, 4),
+            Transform::Make270degRotation().MapRect(
+                Rect(std::numeric_limits<int>::min(), 0, 5, 5)));
+  rotation.Scale(2, 2);
+  EXPECT_EQ(Rect(-10, -1, 8, 6), rotation.MapRect(Rect(1, 2, 3, 4)));
 }
 
 TEST(XFormTest, TransformRectReverse) {
@@ -3550,6 +3721,15 @@ TEST(XFormTest, InverseMapIntRect) {
 
   auto singular = Transform::MakeScale(0.f);
   EXPECT_FALSE(singular.InverseMapRect(Rect(1, 2, 3, 4)));
+
+  auto integer_translation = Transform::MakeTranslation(2, -3);
+  EXPECT_EQ(Rect(99999999, 4, 5, 7),
+            integer_translation.InverseMapRect(Rect(100000001, 1, 5, 7)));
+
+  auto rotation = Transform::Make90degRotation();
+  rotation.PostTranslate(2, -3);
+  EXPECT_EQ(Rect(100000001, 1, 5, 7),
+            rotation.InverseMapRect(Rect(-6, 99999998, 7, 5)));
 }
 
 TEST(XFormTest, MapQuad) {
@@ -3576,6 +3756,59 @@ TEST(XFormTest, MapQuad) {
             rotate.MapQuad(q));
 }
 
+TEST(XFormTest, MapRectToQuad) {
+  const RectF rects[] = {RectF(1.25f, 2.5f, 30, 40), RectF(-5, -6, 0, 7),
+                         RectF(1e30f, -1e30f, 1e30f, 1e30f)};
+  Transform full_rotate = Transform::Make90degRotation();
+  full_rotate.Translate(3, -4);
+  full_rotate.Scale(2, 0.5f);
+  full_rotate.EnsureFullMatrixForTesting();
+  Transform w_scale;
+  w_scale.set_rc(3, 3, 2);
+  Transform rotate;
+  rotate.Rotate(30);
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(100);
+  perspective.RotateAboutYAxis(30);
+  const struct {
+    Transform transform;
+    bool is_rectilinear;
+  } kCases[] = {
+      {Transform(), true},
+      {Transform::MakeTranslation(3.25f, 7.75f), true},
+      {Transform::MakeScale(-1, 2), true},
+      {Transform::Make90degRotation(), true},
+      {Transform::Make180degRotation(), true},
+      {Transform::Make270degRotation(), true},
+      {full_rotate, true},
+      {w_scale, true},
+      {rotate, false},
+      {perspective, false},
+  };
+  for (const auto& test : kCases) {
+    SCOPED_TRACE(test.transform.ToString());
+    for (const RectF& rect : rects) {
+      SCOPED_TRACE(rect.ToString());
+      bool is_rectilinear = !test.is_rectilinear;
+      QuadF quad = test.transform.MapRectToQuad(rect, &is_rectilinear);
+      EXPECT_EQ(test.is_rectilinear, is_rectilinear);
+      EXPECT_EQ(test.transform.MapQuad(QuadF(rect)), quad);
+      EXPECT_EQ(quad.BoundingBox(), test.transform.MapRect(rect));
+      if (is_rectilinear) {
+        // Each edge is exactly horizontal or vertical.
+        EXPECT_TRUE((quad.p1().y() == quad.p2().y() &&
+                     quad.p2().x() == quad.p3().x() &&
+                     quad.p3().y() == quad.p4().y() &&
+                     quad.p4().x() == quad.p1().x()) ||
+                    (quad.p1().x() == quad.p2().x() &&
+                     quad.p2().y() == quad.p3().y() &&
+                     quad.p3().x() == quad.p4().x() &&
+                     quad.p4().y() == quad.p1().y()));
+      }
+    }
+  }
+}
+
 TEST(XFormTest, MapBox) {
   Transform translation;
   translation.Translate3d(3.f, 7.f, 6.f);
@@ -3585,6 +3818,50 @@ TEST(XFormTest, MapBox) {
   EXPECT_EQ(expected, transformed);
 }
 
+TEST(XFormTest, MapBoxes) {
+  const std::vector<BoxF> boxes = {
+      BoxF(1, 2, 3, 4, 5, 6), BoxF(-10, 0.5f, -2, 0, 3, 7),
+      BoxF(1e37f, -1e37f, 0, 1e38f, 1, 1), BoxF(0, 0, -50, 20, 30, 100)};
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(40);
+  perspective.RotateAboutYAxis(30);
+  Transform rotation;
+  rotation.RotateAboutXAxis(25);
+  rotation.Translate3d(1, -2, 3);
+  for (const Transform& transform :
+       {Transform(), Transform::MakeTranslation(3, 4),
+        Transform::MakeScale(-2, 0.5f), rotation, perspective}) {
+    SCOPED_TRACE(transform.ToString());
+    std::vector<BoxF> results(boxes.size());
+    transform.MapBoxes(boxes, results);
+    for (size_t i = 0; i < boxes.size(); ++i) {
+      // The bounds of the corners mapped one at a time.
+      const BoxF& box = boxes[i];
+      Point3F min = transform.MapPoint(box.origin());
+      Point3F max = min;
+      for (int corner = 1; corner < 8; ++corner) {
+        const Point3F point = transform.MapPoint(
+            Point3F(corner & 1 ? box.right() : box.x(),
+                    corner & 2 ? box.bottom() : box.y(),
+                    corner & 4 ? box.front() : box.z()));
+        min.SetPoint(std::min(min.x(), point.x()), std::min(min.y(), point.y()),
+                     std::min(min.z(), point.z()));
+        max.SetPoint(std::max(max.x(), point.x()), std::max(max.y(), point.y()),
+                     std::max(max.z(), point.z()));
+      }
+      const BoxF expected(min, max.x() - min.x(), max.y() - min.y(),
+                          max.z() - min.z());
+      EXPECT_EQ(expected, results[i]) << i;
+      EXPECT_EQ(expected, transform.MapBox(box)) << i;
+    }
+
+    // In place.
+    std::vector<BoxF> in_place = boxes;
+    transform.MapBoxes(in_place, in_place);
+    EXPECT_EQ(results, in_place);
+  }
+}
+
 TEST(XFormTest, Round2dTranslationComponents) {
   Transform translation;
   Transform expected;
@@ -3805,6 +4082,243 @@ TEST(XFormTest, MapPoint) {
             transform.MapPoint(Point3F(12.5f, 34.5f, 56.5f)));
 }
 
+TEST(XFormTest, MapPoints) {
+  const PointF points[] = {PointF(12.5f, 34.5f), PointF(2, 4), PointF(-3, 0),
+                           PointF(1e30f, -1e30f)};
+  const Point3F points_3d[] = {Point3F(12.5f, 34.5f, 56.5f), Point3F(2, 3, 4),
+                               Point3F(-3, 0, 7), Point3F(1e30f, -1e30f, 1)};
+
+  Transform perspective;
+  perspective.set_rc(3, 0, 0.5);
+  perspective.set_rc(3, 1, 2);
+  perspective.set_rc(3, 2, 0.75);
+  Transform zero_w = Transform::MakeTranslation(10, 20);
+  zero_w.set_rc(3, 3, 0);
+  Transform rotation;
+  rotation.RotateAbout(Vector3dF(4, 5, 6), 70);
+
+  for (const Transform& transform :
+       {Transform(), Transform::MakeTranslation(10, 20),
+        Transform::MakeScale(3, -4), GetTestMatrix1(), perspective, zero_w,
+        rotation}) {
+    SCOPED_TRACE(transform.ToString());
+    PointF results[std::size(points)];
+    transform.MapPoints(points, results);
+    for (size_t i = 0; i < std::size(points); ++i) {
+      EXPECT_EQ(transform.MapPoint(points[i]), results[i]);
+    }
+
+    Point3F results_3d[std::size(points_3d)];
+    transform.MapPoints3d(points_3d, results_3d);
+    for (size_t i = 0; i < std::size(points_3d); ++i) {
+      EXPECT_EQ(transform.MapPoint(points_3d[i]), results_3d[i]);
+    }
+
+    // In-place mapping.
+    std::array<PointF, std::size(points)> in_place;
+    std::ranges::copy(points, in_place.begin());
+    transform.MapPoints(in_place, in_place);
+    EXPECT_TRUE(std::ranges::equal(results, in_place));
+  }
+}
+
+TEST(XFormTest, MapPointsInGroups) {
+  // Enough points for several groups and a remainder, some of which map
+  // beyond the range that the results are clamped to.
+  std::vector<PointF> points;
+  std::vector<Point3F> points_3d;
+  for (int i = 0; i < 37; ++i) {
+    const float value = i % 5 ? i * 1.25f : (i % 2 ? 1e37f : -1e37f);
+    points.emplace_back(value, -value);
+    points_3d.emplace_back(value, 2 * value, -value);
+  }
+
+  Transform transform = GetTestMatrix1();
+  transform.set_rc(3, 0, 0.01);
+  std::vector<PointF> results(points.size());
+  transform.MapPoints(points, results);
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(transform.MapPoint(points[i]), results[i]) << i;
+  }
+
+  std::vector<Point3F> results_3d(points_3d.size());
+  transform.MapPoints3d(points_3d, results_3d);
+  for (size_t i = 0; i < points_3d.size(); ++i) {
+    EXPECT_EQ(transform.MapPoint(points_3d[i]), results_3d[i]) << i;
+  }
+
+  // The same in the lanes of a Point3FArray, and for a 2d transform.
+  for (const Transform& t : {transform, Transform::MakeScale(2, -3)}) {
+    Point3FArray array;
+    for (const Point3F& point : points_3d) {
+      array.push_back(point);
+    }
+    t.MapPoints3d(array);
+    ASSERT_EQ(points_3d.size(), array.size());
+    for (size_t i = 0; i < points_3d.size(); ++i) {
+      EXPECT_EQ(t.MapPoint(points_3d[i]), array.Get(i)) << i;
+    }
+  }
+}
+
+TEST(XFormTest, ClassificationFollowsMutation) {
+  // The classification of a full matrix is cached, so each query below must
+  // observe the preceding mutation.
+  Transform transform;
+  transform.EnsureFullMatrixForTesting();
+  EXPECT_TRUE(transform.IsIdentity());
+  EXPECT_TRUE(transform.Is2dTransform());
+
+  transform.Translate3d(1, 2, 3);
+  EXPECT_FALSE(transform.IsIdentity());
+  EXPECT_TRUE(transform.IsIdentityOrTranslation());
+  EXPECT_FALSE(transform.IsIdentityOr2dTranslation());
+  EXPECT_FALSE(transform.IsFlat());
+
+  transform.Scale(2, -3);
+  EXPECT_FALSE(transform.IsIdentityOrTranslation());
+  EXPECT_TRUE(transform.IsScaleOrTranslation());
+  EXPECT_FALSE(transform.IsPositiveScaleOrTranslation());
+  EXPECT_TRUE(transform.Preserves2dAxisAlignment());
+
+  transform.Rotate(30);
+  EXPECT_FALSE(transform.IsScaleOrTranslation());
+  EXPECT_FALSE(transform.Preserves2dAxisAlignment());
+
+  transform.set_rc(3, 0, 0.5);
+  EXPECT_TRUE(transform.HasPerspective());
+  EXPECT_FALSE(transform.Is2dTransform());
+
+  Transform copy = transform;
+  EXPECT_TRUE(copy.HasPerspective());
+  transform.Flatten();
+  EXPECT_TRUE(transform.IsFlat());
+  EXPECT_FALSE(copy.IsFlat());
+
+  Transform inverse;
+  ASSERT_TRUE(Transform::MakeTranslation(1, 2).GetInverse(&inverse));
+  ASSERT_TRUE(copy.GetInverse(&inverse));
+  EXPECT_TRUE(inverse.HasPerspective());
+  EXPECT_FALSE(inverse.IsIdentityOrTranslation());
+
+  transform.MakeIdentity();
+  EXPECT_TRUE(transform.IsIdentity());
+}
+
+TEST(XFormTest, MapRectScaleTranslationFullMatrix) {
+  const RectF rects[] = {RectF(1.25f, 2.5f, 30, 40), RectF(-5, -6, 0, 7),
+                         RectF(1e30f, -1e30f, 1e30f, 1e30f)};
+  Transform transform = Transform::MakeTranslation(10.5f, -20);
+  transform.Scale(-3, 0.25f);
+  transform.EnsureFullMatrixForTesting();
+  for (const RectF& rect : rects) {
+    SCOPED_TRACE(rect.ToString());
+    EXPECT_EQ(transform.MapQuad(QuadF(rect)).BoundingBox(),
+              transform.MapRect(rect));
+  }
+}
+
+TEST(XFormTest, MapRects) {
+  const RectF rects[] = {
+      RectF(1.25f, 2.5f, 30, 40), RectF(-5, -6, 0, 7), RectF(0, 0, 1e-7f, 1),
+      RectF(1e30f, -1e30f, 1e30f, 1e30f), RectF(3, 4, 5, 6),
+      RectF(-100, 50, 20.5f, 0.25f)};
+
+  Transform perspective;
+  perspective.set_rc(3, 0, 0.5);
+  perspective.set_rc(3, 1, -2);
+  perspective.set_rc(3, 2, 0.75);
+  Transform rotation;
+  rotation.RotateAbout(Vector3dF(4, 5, 6), 70);
+  Transform full_identity;
+  full_identity.EnsureFullMatrixForTesting();
+  Transform full_scale = Transform::MakeScale(-2, 3);
+  full_scale.EnsureFullMatrixForTesting();
+
+  for (const Transform& transform :
+       {Transform(), full_identity, Transform::MakeTranslation(10, 20),
+        Transform::MakeScale(0.5f, 2), Transform::MakeScale(3, -4), full_scale,
+        GetTestMatrix1(), perspective, rotation}) {
+    SCOPED_TRACE(transform.ToString());
+    RectF results[std::size(rects)];
+    transform.MapRects(rects, results);
+    for (size_t i = 0; i < std::size(rects); ++i) {
+      EXPECT_EQ(transform.MapRect(rects[i]), results[i]);
+    }
+
+    // In-place mapping.
+    std::array<RectF, std::size(rects)> in_place;
+    std::ranges::copy(rects, in_place.begin());
+    transform.MapRects(in_place, in_place);
+    EXPECT_TRUE(std::ranges::equal(results, in_place));
+
+    // Structure-of-arrays mapping.
+    float x[std::size(rects)];
+    float y[std::size(rects)];
+    float width[std::size(rects)];
+    float height[std::size(rects)];
+    for (size_t i = 0; i < std::size(rects); ++i) {
+      x[i] = rects[i].x();
+      y[i] = rects[i].y();
+      width[i] = rects[i].width();
+      height[i] = rects[i].height();
+    }
+    transform.MapRects(x, y, width, height);
+    for (size_t i = 0; i < std::size(rects); ++i) {
+      EXPECT_EQ(results[i], RectF(x[i], y[i], width[i], height[i]));
+    }
+  }
+}
+
+TEST(XFormTest, ProjectPoints) {
+  const PointF points[] = {PointF(12.5f, 34.5f), PointF(-200, 100),
+                           PointF(0, 0),         PointF(1e30f, -1e30f),
+                           PointF(300, -400),    PointF(-3, 7)};
+
+  Transform perspective;
+  perspective.ApplyPerspectiveDepth(100);
+  perspective.RotateAboutYAxis(60);
+  perspective.RotateAboutXAxis(-30);
+  Transform parallel_plane;
+  parallel_plane.RotateAboutYAxis(90);
+  Transform huge_z;
+  huge_z.set_rc(2, 0, 1e300);
+  huge_z.set_rc(2, 2, 1e-300);
+
+  for (const Transform& transform :
+       {Transform(), Transform::MakeScale(2, -3), GetTestMatrix1(),
+        perspective, parallel_plane, huge_z}) {
+    SCOPED_TRACE(transform.ToString());
+    PointF results[std::size(points)];
+    bool clamped[std::size(points)];
+    transform.ProjectPoints(points, results, clamped);
+    for (size_t i = 0; i < std::size(points); ++i) {
+      bool expected_clamped;
+      EXPECT_EQ(transform.ProjectPoint(points[i], &expected_clamped),
+                results[i]);
+      EXPECT_EQ(expected_clamped, clamped[i]);
+    }
+
+    std::array<PointF, std::size(points)> in_place;
+    std::ranges::copy(points, in_place.begin());
+    transform.ProjectPoints(in_place, in_place);
+    EXPECT_TRUE(std::ranges::equal(results, in_place));
+
+    for (size_t i = 0; i + 4 <= std::size(points); ++i) {
+      QuadF quad(points[i], points[i + 1], points[i + 2], points[i + 3]);
+      bool c1, c2, c3, c4;
+      QuadF expected(transform.ProjectPoint(quad.p1(), &c1),
+                     transform.ProjectPoint(quad.p2(), &c2),
+                     transform.ProjectPoint(quad.p3(), &c3),
+                     transform.ProjectPoint(quad.p4(), &c4));
+      if (c1 && c2 && c3 && c4) {
+        expected = QuadF();
+      }
+      EXPECT_EQ(expected, transform.ProjectQuad(quad));
+    }
+  }
+}
+
 TEST(XFormTest, InverseMapPoint) {
   Transform transform;
   transform.Translate(1, 2);
@@ -4105,6 +4619,70 @@ TEST(XFormTest, ProjectQuad) {
   EXPECT_EQ(q1.p4().y(), kProjectionClampedBigNumber);
 }
 
+TEST(XFormTest, ClipQuadToProjection) {
+  std::array<PointF, Transform::kMaxClippedQuadVertices> vertices;
+  QuadF q(PointF(1.25f, 2.5f), PointF(3.75f, 4.f), PointF(23.f, 45.f),
+          PointF(12.f, 67.f));
+
+  // Without perspective, the result is the projected quad.
+  for (Transform transform :
+       {Transform(), Transform::MakeTranslation(3.25f, 7.75f),
+        Transform::MakeScale(-2, 3)}) {
+    SCOPED_TRACE(transform.ToString());
+    for (bool full_matrix : {false, true}) {
+      if (full_matrix) {
+        transform.EnsureFullMatrixForTesting();
+      }
+      ASSERT_EQ(4u, transform.ClipQuadToProjection(q, vertices));
+      EXPECT_EQ(transform.ProjectQuad(q),
+                QuadF(vertices[0], vertices[1], vertices[2], vertices[3]));
+    }
+  }
+
+  Transform transform;
+  transform.set_rc(2, 2, 0);
+  EXPECT_EQ(0u, transform.ClipQuadToProjection(q, vertices));
+
+  transform.MakeIdentity();
+  transform.RotateAboutYAxis(60);
+  transform.ApplyPerspectiveDepth(2);
+  EXPECT_EQ(0u, transform.ClipQuadToProjection(q, vertices));
+
+  // Two points are in front of the viewer, and the edges from them to the
+  // other two are clipped, as are the parts whose projection is out of range.
+  q.set_p1(PointF(-1.25f, -2.5f));
+  q.set_p2(PointF(-3.75f, 4.f));
+  q.set_p3(PointF(23.f, -45.f));
+  size_t num_vertices = transform.ClipQuadToProjection(q, vertices);
+  ASSERT_EQ(6u, num_vertices);
+  EXPECT_EQ(transform.ProjectPoint(q.p1()), vertices[0]);
+  EXPECT_EQ(transform.ProjectPoint(q.p2()), vertices[1]);
+  for (size_t i = 2; i < num_vertices; ++i) {
+    EXPECT_LE(std::abs(vertices[i].x()), kProjectionClampedBigNumber);
+    EXPECT_LE(std::abs(vertices[i].y()), kProjectionClampedBigNumber);
+  }
+
+  // A strip whose right end is behind the viewer becomes a wedge, which is
+  // less tall than the projected quad.
+  QuadF strip(PointF(-1, -1), PointF(10, -1), PointF(10, 1), PointF(-1, 1));
+  ASSERT_EQ(4u, transform.ClipQuadToProjection(strip, vertices));
+  EXPECT_EQ(transform.ProjectPoint(strip.p1()), vertices[0]);
+  EXPECT_EQ(transform.ProjectPoint(strip.p4()), vertices[3]);
+  EXPECT_EQ(kProjectionClampedBigNumber, vertices[1].x());
+  EXPECT_EQ(kProjectionClampedBigNumber, vertices[2].x());
+  EXPECT_FLOAT_EQ(-vertices[1].y(), vertices[2].y());
+  EXPECT_LT(2 * vertices[2].y(),
+            transform.ProjectQuad(strip).BoundingBox().height() / 2);
+
+  // One point is behind the viewer, and its corner is cut off.
+  q.set_p3(PointF(-23.f, -45.f));
+  q.set_p4(PointF(12.f, 67.f));
+  ASSERT_EQ(5u, transform.ClipQuadToProjection(q, vertices));
+  EXPECT_EQ(transform.ProjectPoint(q.p1()), vertices[0]);
+  EXPECT_EQ(transform.ProjectPoint(q.p2()), vertices[1]);
+  EXPECT_EQ(transform.ProjectPoint(q.p3()), vertices[2]);
+}
+
 TEST(XFormTest, ToString) {
   auto zeros =
       Transform::ColMajor(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
@@ -4249,6 +4827,110 @@ TEST(XFormTest, ApproximatelyEqual) {
   }
 }
 
+TEST(XFormTest, Affine2dRepresentation) {
+  Transform rotation;
+  rotation.Rotate(30);
+  EXPECT_TRUE(rotation.IsAffine2dForTesting());
+  Transform skew;
+  skew.Skew(10, 20);
+  EXPECT_TRUE(skew.IsAffine2dForTesting());
+  EXPECT_TRUE(Transform::Affine(1, 2, 3, 4, 5, 6).IsAffine2dForTesting());
+  EXPECT_TRUE(
+      Transform(Quaternion(0, 0, std::sin(0.25), std::cos(0.25)))
+          .IsAffine2dForTesting());
+
+  // 2d operations keep the affine representation.
+  Transform transform = rotation;
+  transform.Translate(10, 20);
+  transform.Scale(2, 3);
+  transform.PreConcat(skew);
+  transform.PostConcat(Transform::MakeTranslation(1, 2));
+  transform.Zoom(2);
+  EXPECT_TRUE(transform.IsAffine2dForTesting());
+  Transform inverse;
+  ASSERT_TRUE(transform.GetInverse(&inverse));
+  EXPECT_TRUE(inverse.IsAffine2dForTesting());
+  EXPECT_TRUE((transform * inverse).IsAffine2dForTesting());
+
+  // 3d operations and perspective promote to a full matrix.
+  Transform rotate_x = rotation;
+  rotate_x.RotateAboutXAxis(10);
+  EXPECT_TRUE(rotate_x.IsFullMatrixForTesting());
+  Transform translate_3d = rotation;
+  translate_3d.Translate3d(1, 2, 3);
+  EXPECT_TRUE(translate_3d.IsFullMatrixForTesting());
+  Transform perspective = rotation;
+  perspective.ApplyPerspectiveDepth(100);
+  EXPECT_TRUE(perspective.IsFullMatrixForTesting());
+}
+
+TEST(XFormTest, Affine2dMatchesFullMatrix) {
+  Transform affine;
+  affine.Translate(15, -30);
+  affine.Rotate(37);
+  affine.Skew(12, 0);
+  affine.Scale(1.5f, -0.75f);
+  ASSERT_TRUE(affine.IsAffine2dForTesting());
+  Transform full = affine;
+  full.EnsureFullMatrixForTesting();
+  EXPECT_EQ(full, affine);
+
+  const PointF point(12.5f, -7.25f);
+  EXPECT_EQ(full.MapPoint(point), affine.MapPoint(point));
+  EXPECT_EQ(full.MapPoint(Point3F(1, 2, 3)), affine.MapPoint(Point3F(1, 2, 3)));
+  EXPECT_EQ(full.MapVector(Vector3dF(1, 2, 3)),
+            affine.MapVector(Vector3dF(1, 2, 3)));
+  const RectF rect(-20, 10, 30.5f, 40.25f);
+  EXPECT_EQ(full.MapRect(rect), affine.MapRect(rect));
+  EXPECT_EQ(full.ProjectQuad(QuadF(rect)), affine.ProjectQuad(QuadF(rect)));
+  EXPECT_EQ(full.Preserves2dAxisAlignment(),
+            affine.Preserves2dAxisAlignment());
+  EXPECT_EQ(full.Determinant(), affine.Determinant());
+  EXPECT_EQ(full.IsBackFaceVisible(), affine.IsBackFaceVisible());
+
+  Transform full_inverse;
+  Transform affine_inverse;
+  ASSERT_TRUE(full.GetInverse(&full_inverse));
+  ASSERT_TRUE(affine.GetInverse(&affine_inverse));
+  EXPECT_EQ(full_inverse, affine_inverse);
+  EXPECT_EQ(full.InverseMapPoint(point), affine.InverseMapPoint(point));
+  EXPECT_EQ(full.InverseMapRect(rect), affine.InverseMapRect(rect));
+
+  Transform full_concat = full;
+  full_concat.PreConcat(full_inverse);
+  Transform affine_concat = affine;
+  affine_concat.PreConcat(affine_inverse);
+  EXPECT_EQ(full_concat, affine_concat);
+  EXPECT_EQ(full.Decompose(), affine.Decompose());
+}
+
+TEST(XFormTest, EdgeCases) {
+  const QuadF quad(kEdgeCaseRect);
+  for (const TransformEdgeCase& edge_case : GetTransformEdgeCases()) {
+    SCOPED_TRACE(edge_case.name);
+    const Transform& transform = edge_case.transform;
+    EXPECT_EQ(edge_case.invertible, transform.IsInvertible());
+
+    int clamped_corners = 0;
+    for (const PointF& corner : {quad.p1(), quad.p2(), quad.p3(), quad.p4()}) {
+      bool clamped = false;
+      PointF projected = transform.ProjectPoint(corner, &clamped);
+      EXPECT_TRUE(std::isfinite(projected.x()) && std::isfinite(projected.y()))
+          << projected.ToString();
+      clamped_corners += clamped;
+    }
+    EXPECT_EQ(edge_case.clamped_corners, clamped_corners);
+    if (clamped_corners == 4) {
+      EXPECT_EQ(QuadF(), transform.ProjectQuad(quad));
+    }
+
+    RectF mapped = transform.MapRect(kEdgeCaseRect);
+    EXPECT_FALSE(std::isnan(mapped.x()) || std::isnan(mapped.y()) ||
+                 std::isnan(mapped.width()) || std::isnan(mapped.height()))
+        << mapped.ToString();
+  }
+}
+
 }  // namespace
 
 }  // namespace gfx
@@ -6,15 +6,23 @@
 #include "ui/gfx/geometry/transform_util.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <numbers>
 #include <ostream>
 #include <string>
 
-#include "base/check.h"
+#include "base/check_op.h"
+#include "base/numerics/angle_conversions.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/box_f.h"
 #include "ui/gfx/geometry/clamp_float_geometry.h"
+#include "ui/gfx/geometry/dip_util.h"
 #include "ui/gfx/geometry/point3_f.h"
 #include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/rect_conversions.h"
 #include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/vector3d_f.h"
 
 namespace gfx {
 
@@ -30,6 +38,37 @@ void Combine(std::array<double, n>& out,
     out[i] = a[i] * scale_a + b[i] * scale_b;
 }
 
+// Blends all the components except the quaternion.
+void BlendNonRotationComponents(DecomposedTransform& out,
+                                const DecomposedTransform& to,
+                                const DecomposedTransform& from,
+                                double progress) {
+  double scalea = progress;
+  double scaleb = 1.0 - progress;
+  Combine<3>(out.translate, to.translate, from.translate, scalea, scaleb);
+  Combine<3>(out.scale, to.scale, from.scale, scalea, scaleb);
+  Combine<3>(out.skew, to.skew, from.skew, scalea, scaleb);
+  Combine<4>(out.perspective, to.perspective, from.perspective, scalea, scaleb);
+}
+
+// Returns |transform| as an AxisTransform2d if it's a 2d scale and
+// translation.
+std::optional<AxisTransform2d> ToAxisTransform2d(const Transform& transform) {
+  if (!transform.IsScaleOrTranslation()) {
+    return std::nullopt;
+  }
+  return AxisTransform2d::FromScaleAndTranslation(transform.To2dScale(),
+                                                  transform.To2dTranslation());
+}
+
+// Returns |transform| followed by the conversion to pixels.
+Transform ToPixelTransform(const Transform& transform,
+                           float device_scale_factor) {
+  Transform to_pixels = transform;
+  to_pixels.PostScale(device_scale_factor);
+  return to_pixels;
+}
+
 }  // namespace
 
 Transform GetScaleTransform(const Point& anchor, float scale) {
@@ -43,16 +82,35 @@ DecomposedTransform BlendDecomposedTransforms(const DecomposedTransform& to,
                                               const DecomposedTransform& from,
                                               double progress) {
   DecomposedTransform out;
-  double scalea = progress;
-  double scaleb = 1.0 - progress;
-  Combine<3>(out.translate, to.translate, from.translate, scalea, scaleb);
-  Combine<3>(out.scale, to.scale, from.scale, scalea, scaleb);
-  Combine<3>(out.skew, to.skew, from.skew, scalea, scaleb);
-  Combine<4>(out.perspective, to.perspective, from.perspective, scalea, scaleb);
+  BlendNonRotationComponents(out, to, from, progress);
   out.quaternion = from.quaternion.Slerp(to.quaternion, progress);
   return out;
 }
 
+// static
+std::optional<TransformBlendPlan> TransformBlendPlan::Create(
+    const Transform& from,
+    const Transform& to) {
+  std::optional<DecomposedTransform> to_decomp = to.Decompose();
+  if (!to_decomp)
+    return std::nullopt;
+  std::optional<DecomposedTransform> from_decomp = from.Decompose();
+  if (!from_decomp)
+    return std::nullopt;
+  return TransformBlendPlan(*from_decomp, *to_decomp);
+}
+
+TransformBlendPlan::TransformBlendPlan(const DecomposedTransform& from,
+                                       const DecomposedTransform& to)
+    : from_(from), to_(to), slerp_(from.quaternion, to.quaternion) {}
+
+Transform TransformBlendPlan::Evaluate(double progress) const {
+  DecomposedTransform out;
+  BlendNonRotationComponents(out, to_, from_, progress);
+  out.quaternion = slerp_.Evaluate(progress);
+  return Transform::Compose(out);
+}
+
 DecomposedTransform AccumulateDecomposedTransforms(
     const DecomposedTransform& a,
     const DecomposedTransform& b) {
@@ -183,4 +241,125 @@ float ComputeApproximateMaxScale(const Transform& transform) {
   return std::max(unit.width(), unit.height());
 }
 
+std::optional<BoxF> ConservativeBoundsForRotatedBox(const BoxF& box,
+                                                    const Vector3dF& axis,
+                                                    double min_degrees,
+                                                    double max_degrees,
+                                                    double tolerance) {
+  DCHECK_GT(tolerance, 0);
+  DCHECK_LE(min_degrees, max_degrees);
+  Vector3dF normal;
+  if (!axis.GetNormalized(&normal)) {
+    // Transform::RotateAbout() ignores a zero axis.
+    return box;
+  }
+  const double nx = normal.x();
+  const double ny = normal.y();
+  const double nz = normal.z();
+
+  // A corner p rotated by t about |normal| is c + u * cos(t) + v * sin(t),
+  // where c is the center of its circle, u = p - c, and v = normal x u.
+  struct Arc {
+    std::array<double, 3> c;
+    std::array<double, 3> u;
+    std::array<double, 3> v;
+    double radius;
+  };
+  std::array<Arc, 8> arcs;
+  double max_radius = 0;
+  for (int i = 0; i < 8; ++i) {
+    const double px = box.x() + (i & 1 ? box.width() : 0.f);
+    const double py = box.y() + (i & 2 ? box.height() : 0.f);
+    const double pz = box.z() + (i & 4 ? box.depth() : 0.f);
+    const double d = px * nx + py * ny + pz * nz;
+    Arc& arc = arcs[i];
+    arc.c = {nx * d, ny * d, nz * d};
+    arc.u = {px - arc.c[0], py - arc.c[1], pz - arc.c[2]};
+    arc.v = {ny * arc.u[2] - nz * arc.u[1], nz * arc.u[0] - nx * arc.u[2],
+             nx * arc.u[1] - ny * arc.u[0]};
+    arc.radius = std::hypot(arc.u[0], arc.u[1], arc.u[2]);
+    max_radius = std::max(max_radius, arc.radius);
+  }
+
+  // Any point of an arc of angle s is within r * (1 - cos(s / 2)) of the
+  // chord between its ends, so sampling at steps of at most s and outsetting
+  // the samples by that distance bounds the arc.
+  const double span = std::min(base::DegToRad(max_degrees - min_degrees),
+                               2 * std::numbers::pi);
+  int samples = 1;
+  if (tolerance < 2 * max_radius) {
+    const double max_step = 2 * std::acos(1 - tolerance / max_radius);
+    const double steps = std::ceil(span / max_step);
+    if (steps >= kMaxRotatedBoxBoundsSamples) {
+      return std::nullopt;
+    }
+    samples = std::max(1, static_cast<int>(steps));
+  }
+  const double step = span / samples;
+  const double deviation = 1 - std::cos(step / 2);
+
+  std::array<double, 3> min = {HUGE_VAL, HUGE_VAL, HUGE_VAL};
+  std::array<double, 3> max = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
+  const double min_radians = base::DegToRad(min_degrees);
+  for (int k = 0; k <= samples; ++k) {
+    const double t = min_radians + k * step;
+    const double cos_t = std::cos(t);
+    const double sin_t = std::sin(t);
+    for (const Arc& arc : arcs) {
+      const double outset = arc.radius * deviation;
+      for (int j = 0; j < 3; ++j) {
+        const double p = arc.c[j] + arc.u[j] * cos_t + arc.v[j] * sin_t;
+        min[j] = std::min(min[j], p - outset);
+        max[j] = std::max(max[j], p + outset);
+      }
+    }
+  }
+
+  BoxF bounds(Point3F(min[0], min[1], min[2]), 0, 0, 0);
+  bounds.ExpandTo(Point3F(max[0], max[1], max[2]));
+  return bounds;
+}
+
+Rect MapRectToEnclosingPixels(const Transform& transform,
+                              const RectF& rect_in_dips,
+                              float device_scale_factor) {
+  if (std::optional<AxisTransform2d> axis = ToAxisTransform2d(transform)) {
+    return MapRectToEnclosingPixels(*axis, rect_in_dips, device_scale_factor);
+  }
+  return ToEnclosingRect(
+      ToPixelTransform(transform, device_scale_factor).MapRect(rect_in_dips));
+}
+
+void MapRectsToEnclosingPixels(const Transform& transform,
+                               base::span<const RectF> rects_in_dips,
+                               float device_scale_factor,
+                               base::span<Rect> rects_in_pixels) {
+  CheckBatchSpans(rects_in_dips, rects_in_pixels);
+  if (std::optional<AxisTransform2d> axis = ToAxisTransform2d(transform)) {
+    MapRectsToEnclosingPixels(*axis, rects_in_dips, device_scale_factor,
+                              rects_in_pixels);
+    return;
+  }
+  const Transform to_pixels = ToPixelTransform(transform, device_scale_factor);
+  for (size_t i = 0; i < rects_in_dips.size(); ++i) {
+    rects_in_pixels[i] = ToEnclosingRect(to_pixels.MapRect(rects_in_dips[i]));
+  }
+}
+
+std::optional<Rect> InverseMapRectToEnclosingDips(const Transform& transform,
+                                                  const Rect& rect_in_pixels,
+                                                  float device_scale_factor) {
+  if (std::optional<AxisTransform2d> axis = ToAxisTransform2d(transform)) {
+    return InverseMapRectToEnclosingDips(*axis, rect_in_pixels,
+                                         device_scale_factor);
+  }
+  std::optional<RectF> rect_in_dips =
+      ToPixelTransform(transform, device_scale_factor)
+          .InverseMapRect(RectF(rect_in_pixels));
+  if (!rect_in_dips) {
+    return std::nullopt;
+  }
+  return ToEnclosingRect(*rect_in_dips);
+}
+
 }  // namespace gfx
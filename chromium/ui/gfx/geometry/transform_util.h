@@ -8,6 +8,7 @@
 #include <optional>
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/axis_transform2d.h"
 #include "ui/gfx/geometry/decomposed_transform.h"
 #include "ui/gfx/geometry/point.h"
@@ -15,7 +16,10 @@
 
 namespace gfx {
 
+class BoxF;
+class Rect;
 class RectF;
+class Vector3dF;
 
 // Returns a scale transform at |anchor| point.
 COMPONENT_EXPORT(GEOMETRY_SKIA)
@@ -31,6 +35,30 @@ DecomposedTransform BlendDecomposedTransforms(const DecomposedTransform& to,
                                               const DecomposedTransform& from,
                                               double progress);
 
+// Interpolates between two fixed transforms as Transform::Blend() does, with
+// the work that only depends on the endpoints done once in Create(): both
+// endpoints are decomposed, and the quaternion slerp data is precomputed.
+// Each Evaluate() then only blends the components and composes the result,
+// which is useful for animations that evaluate once per frame.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) TransformBlendPlan {
+ public:
+  // Returns nullopt if either transform can't be decomposed, i.e. when
+  // Transform::Blend() would fail.
+  static std::optional<TransformBlendPlan> Create(const Transform& from,
+                                                  const Transform& to);
+
+  // Returns the same as |to| after to.Blend(from, progress).
+  Transform Evaluate(double progress) const;
+
+ private:
+  TransformBlendPlan(const DecomposedTransform& from,
+                     const DecomposedTransform& to);
+
+  DecomposedTransform from_;
+  DecomposedTransform to_;
+  QuaternionSlerpPlan slerp_;
+};
+
 // Accumulates the decomposed components |to| with |from| using the
 // routines described in
 // https://www.w3.org/TR/css-transforms-2/#combining-transform-lists
@@ -79,6 +107,43 @@ Vector2dF ComputeTransform2dScaleComponents(const Transform& transform,
 COMPONENT_EXPORT(GEOMETRY_SKIA)
 float ComputeApproximateMaxScale(const Transform& transform);
 
+// Returns a box containing |box| rotated about |axis| by every angle from
+// |min_degrees| to |max_degrees|, computed by sampling the arcs of the
+// corners instead of finding their extrema. The result contains the exact
+// bounds and exceeds them by at most |tolerance| (which must be positive) on
+// each side. Returns nullopt if that would need more than
+// kMaxRotatedBoxBoundsSamples samples, in which case the exact bounds are
+// cheaper.
+inline constexpr int kMaxRotatedBoxBoundsSamples = 32;
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+std::optional<BoxF> ConservativeBoundsForRotatedBox(const BoxF& box,
+                                                    const Vector3dF& axis,
+                                                    double min_degrees,
+                                                    double max_degrees,
+                                                    double tolerance);
+
+// Returns ToEnclosingRect(ConvertRectToPixels(transform.MapRect(rect_in_dips),
+// device_scale_factor)), up to float rounding, with the device scale factor
+// folded into |transform|. Scales and translations use the versions for
+// AxisTransform2d in dip_util.h, which don't build an intermediate RectF.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+Rect MapRectToEnclosingPixels(const Transform& transform,
+                              const RectF& rect_in_dips,
+                              float device_scale_factor);
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+void MapRectsToEnclosingPixels(const Transform& transform,
+                               base::span<const RectF> rects_in_dips,
+                               float device_scale_factor,
+                               base::span<Rect> rects_in_pixels);
+
+// The reverse of the above: returns the enclosing rect in dips of
+// |rect_in_pixels| mapped back through |transform|, or std::nullopt if
+// |transform| isn't invertible.
+COMPONENT_EXPORT(GEOMETRY_SKIA)
+std::optional<Rect> InverseMapRectToEnclosingDips(const Transform& transform,
+                                                  const Rect& rect_in_pixels,
+                                                  float device_scale_factor);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_TRANSFORM_UTIL_H_
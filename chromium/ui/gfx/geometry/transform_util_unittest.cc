@@ -8,13 +8,17 @@
 
 #include <algorithm>
 #include <limits>
+#include <optional>
+#include <utility>
 
 #include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/dip_util.h"
 #include "ui/gfx/geometry/point.h"
 #include "ui/gfx/geometry/point3_f.h"
 #include "ui/gfx/geometry/rect.h"
 #include "ui/gfx/geometry/rect_f.h"
 #include "ui/gfx/geometry/test/geometry_util.h"
+#include "ui/gfx/geometry/vector3d_f.h"
 
 namespace gfx {
 namespace {
@@ -70,6 +74,36 @@ TEST(TransformUtilTest, BlendOppositeQuaternions) {
   EXPECT_FALSE(std::isnan(result.quaternion.w()));
 }
 
+TEST(TransformUtilTest, TransformBlendPlan) {
+  Transform from;
+  from.Translate3d(1, 2, 3);
+  from.RotateAbout(Vector3dF(1, 2, 3), 30);
+  from.Scale(2, 3);
+  Transform to;
+  to.ApplyPerspectiveDepth(500);
+  to.RotateAboutYAxis(-120);
+  to.Skew(10, 20);
+  Transform affine = Transform::Affine(1, 2, 3, 4, 5, 6);
+
+  for (const auto& [a, b] : {std::make_pair(from, to), std::make_pair(to, from),
+                             std::make_pair(from, from),
+                             std::make_pair(Transform(), affine),
+                             std::make_pair(Transform::MakeScale(2),
+                                            Transform::MakeTranslation(3, 4))}) {
+    std::optional<TransformBlendPlan> plan = TransformBlendPlan::Create(a, b);
+    ASSERT_TRUE(plan);
+    for (double progress : {-0.5, 0.0, 0.25, 0.5, 1.0, 1.5}) {
+      SCOPED_TRACE(progress);
+      Transform expected = b;
+      ASSERT_TRUE(expected.Blend(a, progress));
+      EXPECT_EQ(expected, plan->Evaluate(progress));
+    }
+  }
+
+  EXPECT_FALSE(TransformBlendPlan::Create(from, Transform::MakeScale(0)));
+  EXPECT_FALSE(TransformBlendPlan::Create(Transform::MakeScale(0), to));
+}
+
 TEST(TransformUtilTest, AccumulateDecomposedTransforms) {
   DecomposedTransform a{{2.5, -3.25, 4.75},
                         {4.5, -5.25, 6.75},
@@ -273,5 +307,32 @@ TEST(TransformUtilTest, Transform2dScaleComponents) {
   }
 }
 
+TEST(TransformUtilTest, MapRectToEnclosingPixels) {
+  const RectF rect(1.25f, 2.5f, 3.f, 4.5f);
+  const Rect rect_in_pixels(3, -5, 7, 11);
+  const Transform scale_translation =
+      Transform::MakeTranslation(3.25f, -2.f) * Transform::MakeScale(1.5f);
+  const auto axis = AxisTransform2d::FromScaleAndTranslation(
+      Vector2dF(1.5f, 1.5f), Vector2dF(3.25f, -2.f));
+  EXPECT_EQ(MapRectToEnclosingPixels(axis, rect, 2.f),
+            MapRectToEnclosingPixels(scale_translation, rect, 2.f));
+  EXPECT_EQ(InverseMapRectToEnclosingDips(axis, rect_in_pixels, 2.f),
+            InverseMapRectToEnclosingDips(scale_translation, rect_in_pixels,
+                                          2.f));
+
+  const Transform rotation = Transform::Make90degRotation();
+  EXPECT_EQ(Rect(-14, 2, 9, 7), MapRectToEnclosingPixels(rotation, rect, 2.f));
+  EXPECT_EQ(Rect(1, 2, 4, 5),
+            InverseMapRectToEnclosingDips(rotation, Rect(-14, 2, 9, 7), 2.f));
+  const RectF rects[] = {rect, RectF(-3, 4, 0, 5)};
+  Rect results[2];
+  MapRectsToEnclosingPixels(rotation, rects, 2.f, results);
+  EXPECT_EQ(MapRectToEnclosingPixels(rotation, rects[0], 2.f), results[0]);
+  EXPECT_EQ(MapRectToEnclosingPixels(rotation, rects[1], 2.f), results[1]);
+
+  EXPECT_FALSE(InverseMapRectToEnclosingDips(Transform::MakeScale(0, 1),
+                                             rect_in_pixels, 2.f));
+}
+
 }  // namespace
 }  // namespace gfx
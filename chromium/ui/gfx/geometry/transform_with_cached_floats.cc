@@ -0,0 +1,21 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_with_cached_floats.h"
+
+#include "third_party/skia/include/core/SkM44.h"
+#include "third_party/skia/include/core/SkMatrix.h"
+#include "ui/gfx/geometry/skia_conversions.h"
+
+namespace gfx {
+
+SkM44 TransformWithCachedFloats::ToSkM44() const {
+  return SkM44::ColMajor(col_major_f_.data());
+}
+
+SkMatrix TransformWithCachedFloats::ToFlattenedSkMatrix() const {
+  return ColMajorFToFlattenedSkMatrix(col_major_f_);
+}
+
+}  // namespace gfx
@@ -0,0 +1,54 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TRANSFORM_WITH_CACHED_FLOATS_H_
+#define UI_GFX_GEOMETRY_TRANSFORM_WITH_CACHED_FLOATS_H_
+
+#include <array>
+
+#include "base/component_export.h"
+#include "ui/gfx/geometry/transform.h"
+
+class SkM44;
+class SkMatrix;
+
+namespace gfx {
+
+// Wraps a Transform and the float copy of its entries, for code that converts
+// the same transform to Skia or to floats for many draw ops. The entries are
+// narrowed once when the transform is set, after which each conversion only
+// copies floats.
+//
+// The wrapped transform can only be replaced with set_transform(), which
+// updates the float copy.
+//
+// The results are the same as those of TransformToSkM44(),
+// TransformToFlattenedSkMatrix() and Transform::GetColMajorF().
+class COMPONENT_EXPORT(GEOMETRY_SKIA) TransformWithCachedFloats {
+ public:
+  TransformWithCachedFloats() : TransformWithCachedFloats(Transform()) {}
+  explicit TransformWithCachedFloats(const Transform& transform) {
+    set_transform(transform);
+  }
+
+  const Transform& transform() const { return transform_; }
+  void set_transform(const Transform& transform) {
+    transform_ = transform;
+    transform_.GetColMajorF(col_major_f_);
+  }
+
+  // The entries of transform() in column-major order.
+  const std::array<float, 16>& col_major_f() const { return col_major_f_; }
+
+  SkM44 ToSkM44() const;
+  SkMatrix ToFlattenedSkMatrix() const;
+
+ private:
+  Transform transform_;
+  std::array<float, 16> col_major_f_;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TRANSFORM_WITH_CACHED_FLOATS_H_
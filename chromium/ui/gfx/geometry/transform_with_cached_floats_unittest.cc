@@ -0,0 +1,48 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_with_cached_floats.h"
+
+#include <array>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/skia/include/core/SkM44.h"
+#include "third_party/skia/include/core/SkMatrix.h"
+#include "ui/gfx/geometry/skia_conversions.h"
+#include "ui/gfx/geometry/vector3d_f.h"
+
+namespace gfx {
+
+namespace {
+
+TEST(TransformWithCachedFloatsTest, MatchesConversions) {
+  Transform full_matrix;
+  full_matrix.Translate3d(1, 2, 3);
+  full_matrix.RotateAbout(Vector3dF(4, 5, 6), 70);
+  full_matrix.ApplyPerspectiveDepth(500);
+  Transform axis_2d_as_full_matrix = Transform::MakeScale(3, -4);
+  axis_2d_as_full_matrix.EnsureFullMatrixForTesting();
+
+  TransformWithCachedFloats cached;
+  EXPECT_EQ(Transform(), cached.transform());
+  for (const Transform& transform :
+       {Transform(), Transform::MakeTranslation(10.5, 20),
+        Transform::MakeScale(3, -4), Transform::Affine(1, 2, 3, 4, 5, 6),
+        full_matrix, axis_2d_as_full_matrix}) {
+    SCOPED_TRACE(transform.ToString());
+    cached.set_transform(transform);
+    EXPECT_EQ(transform, cached.transform());
+
+    std::array<float, 16> col_major;
+    transform.GetColMajorF(col_major);
+    EXPECT_EQ(col_major, cached.col_major_f());
+    EXPECT_EQ(TransformToSkM44(transform), cached.ToSkM44());
+    EXPECT_EQ(TransformToFlattenedSkMatrix(transform),
+              cached.ToFlattenedSkMatrix());
+  }
+}
+
+}  // namespace
+
+}  // namespace gfx
@@ -0,0 +1,78 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_with_cached_inverse.h"
+
+#include "base/check_op.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/quad_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+
+namespace gfx {
+
+bool TransformWithCachedInverse::EnsureInverse() const {
+  DCHECK_EQ(transform_.representation_, Transform::kFullMatrix);
+  if (inverse_state_ == InverseState::kUnknown) {
+    inverse_state_ = transform_.GetInverse(&inverse_)
+                         ? InverseState::kInvertible
+                         : InverseState::kNotInvertible;
+  }
+  return inverse_state_ == InverseState::kInvertible;
+}
+
+bool TransformWithCachedInverse::IsInvertible() const {
+  if (transform_.representation_ != Transform::kFullMatrix) [[likely]] {
+    return transform_.IsInvertible();
+  }
+  return EnsureInverse();
+}
+
+bool TransformWithCachedInverse::GetInverse(Transform* transform) const {
+  if (transform_.representation_ != Transform::kFullMatrix) [[likely]] {
+    return transform_.GetInverse(transform);
+  }
+  if (!EnsureInverse()) {
+    transform->MakeIdentity();
+    return false;
+  }
+  *transform = inverse_;
+  return true;
+}
+
+std::optional<PointF> TransformWithCachedInverse::InverseMapPoint(
+    const PointF& point) const {
+  if (transform_.representation_ != Transform::kFullMatrix) [[likely]] {
+    return transform_.InverseMapPoint(point);
+  }
+  if (!EnsureInverse()) {
+    return std::nullopt;
+  }
+  return inverse_.MapPoint(point);
+}
+
+std::optional<Point3F> TransformWithCachedInverse::InverseMapPoint(
+    const Point3F& point) const {
+  if (transform_.representation_ != Transform::kFullMatrix) [[likely]] {
+    return transform_.InverseMapPoint(point);
+  }
+  if (!EnsureInverse()) {
+    return std::nullopt;
+  }
+  return inverse_.MapPoint(point);
+}
+
+std::optional<RectF> TransformWithCachedInverse::InverseMapRect(
+    const RectF& rect) const {
+  if (transform_.representation_ != Transform::kFullMatrix ||
+      transform_.IsIdentity()) [[likely]] {
+    return transform_.InverseMapRect(rect);
+  }
+  if (!EnsureInverse()) {
+    return std::nullopt;
+  }
+  return inverse_.MapQuad(QuadF(rect)).BoundingBox();
+}
+
+}  // namespace gfx
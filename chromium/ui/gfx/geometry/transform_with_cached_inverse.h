@@ -0,0 +1,121 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef UI_GFX_GEOMETRY_TRANSFORM_WITH_CACHED_INVERSE_H_
+#define UI_GFX_GEOMETRY_TRANSFORM_WITH_CACHED_INVERSE_H_
+
+#include <optional>
+
+#include "base/component_export.h"
+#include "ui/gfx/geometry/transform.h"
+
+namespace gfx {
+
+class Point3F;
+class PointF;
+class RectF;
+
+// Wraps a Transform and lazily caches its inverse, for code that repeatedly
+// maps points or rects back through the same transform, e.g. hit testing.
+// The inverse of a full matrix is computed at most once per mutation, after
+// which each inverse mapping costs one matrix-vector multiply. Transforms
+// stored as AxisTransform2d are inverted on the fly as by Transform, because
+// that is already cheap.
+//
+// The wrapped transform can only be mutated through the methods of this
+// class, each of which invalidates the cached inverse.
+//
+// The results are the same as those of the corresponding Transform methods.
+class COMPONENT_EXPORT(GEOMETRY_SKIA) TransformWithCachedInverse {
+ public:
+  TransformWithCachedInverse() = default;
+  explicit TransformWithCachedInverse(const Transform& transform)
+      : transform_(transform) {}
+
+  const Transform& transform() const { return transform_; }
+
+  void set_transform(const Transform& transform) {
+    transform_ = transform;
+    Invalidate();
+  }
+  void MakeIdentity() {
+    transform_.MakeIdentity();
+    Invalidate();
+  }
+  void set_rc(int row, int col, double v) {
+    transform_.set_rc(row, col, v);
+    Invalidate();
+  }
+  void PreConcat(const Transform& transform) {
+    transform_.PreConcat(transform);
+    Invalidate();
+  }
+  void PostConcat(const Transform& transform) {
+    transform_.PostConcat(transform);
+    Invalidate();
+  }
+  void Translate(float x, float y) {
+    transform_.Translate(x, y);
+    Invalidate();
+  }
+  void Translate3d(float x, float y, float z) {
+    transform_.Translate3d(x, y, z);
+    Invalidate();
+  }
+  void PostTranslate(float x, float y) {
+    transform_.PostTranslate(x, y);
+    Invalidate();
+  }
+  void Scale(float x, float y) {
+    transform_.Scale(x, y);
+    Invalidate();
+  }
+  void Scale3d(float x, float y, float z) {
+    transform_.Scale3d(x, y, z);
+    Invalidate();
+  }
+  void PostScale(float x, float y) {
+    transform_.PostScale(x, y);
+    Invalidate();
+  }
+  void Rotate(double degrees) {
+    transform_.Rotate(degrees);
+    Invalidate();
+  }
+
+  // These are the same as the Transform methods with the same names, except
+  // that the inverse is computed at most once.
+  bool IsInvertible() const;
+  [[nodiscard]] bool GetInverse(Transform* transform) const;
+  [[nodiscard]] std::optional<PointF> InverseMapPoint(
+      const PointF& point) const;
+  [[nodiscard]] std::optional<Point3F> InverseMapPoint(
+      const Point3F& point) const;
+  [[nodiscard]] std::optional<RectF> InverseMapRect(const RectF& rect) const;
+
+  bool HasCachedInverseForTesting() const {
+    return inverse_state_ != InverseState::kUnknown;
+  }
+
+ private:
+  enum class InverseState : uint8_t {
+    kUnknown,
+    kInvertible,
+    kNotInvertible,
+  };
+
+  void Invalidate() { inverse_state_ = InverseState::kUnknown; }
+
+  // Computes |inverse_| if needed. Must only be called for full matrices.
+  // Returns true if the transform is invertible.
+  bool EnsureInverse() const;
+
+  Transform transform_;
+  mutable Transform inverse_;
+  mutable InverseState inverse_state_ = InverseState::kUnknown;
+};
+
+}  // namespace gfx
+
+#endif  // UI_GFX_GEOMETRY_TRANSFORM_WITH_CACHED_INVERSE_H_
@@ -0,0 +1,92 @@
+// Copyright 2026 The Chromium Authors
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "ui/gfx/geometry/transform_with_cached_inverse.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "ui/gfx/geometry/point3_f.h"
+#include "ui/gfx/geometry/point_f.h"
+#include "ui/gfx/geometry/rect_f.h"
+#include "ui/gfx/geometry/test/geometry_util.h"
+
+namespace gfx {
+
+namespace {
+
+Transform GetTestTransform() {
+  Transform transform;
+  transform.Translate3d(1, 2, 3);
+  transform.RotateAbout(Vector3dF(4, 5, 6), 70);
+  transform.Scale3d(7, 8, 9);
+  transform.Skew(30, 70);
+  transform.ApplyPerspectiveDepth(500);
+  return transform;
+}
+
+TEST(TransformWithCachedInverseTest, MatchesTransform) {
+  Transform singular = Transform::MakeScale(0, 1);
+  singular.EnsureFullMatrixForTesting();
+
+  const PointF point(12.34f, 56.78f);
+  const Point3F point_3d(14, 15, 16);
+  const RectF rect(1, 2, 30, 40);
+  for (const Transform& transform :
+       {Transform(), Transform::MakeTranslation(10, 20),
+        Transform::MakeScale(3, -4), Transform::MakeScale(0, 1),
+        Transform::Affine(1, 2, 3, 4, 5, 6), GetTestTransform(), singular}) {
+    SCOPED_TRACE(transform.ToString());
+    TransformWithCachedInverse cached(transform);
+    // Query twice to exercise both computing and reusing the cache.
+    for (int i = 0; i < 2; ++i) {
+      EXPECT_EQ(transform.IsInvertible(), cached.IsInvertible());
+      EXPECT_EQ(transform.InverseMapPoint(point),
+                cached.InverseMapPoint(point));
+      EXPECT_EQ(transform.InverseMapPoint(point_3d),
+                cached.InverseMapPoint(point_3d));
+      EXPECT_EQ(transform.InverseMapRect(rect), cached.InverseMapRect(rect));
+
+      Transform expected_inverse;
+      Transform inverse;
+      EXPECT_EQ(transform.GetInverse(&expected_inverse),
+                cached.GetInverse(&inverse));
+      EXPECT_EQ(expected_inverse, inverse);
+    }
+  }
+}
+
+TEST(TransformWithCachedInverseTest, MutationInvalidatesCache) {
+  TransformWithCachedInverse cached(GetTestTransform());
+  EXPECT_FALSE(cached.HasCachedInverseForTesting());
+  EXPECT_TRUE(cached.IsInvertible());
+  EXPECT_TRUE(cached.HasCachedInverseForTesting());
+
+  Transform expected = GetTestTransform();
+  expected.Translate(5, 6);
+  cached.Translate(5, 6);
+  EXPECT_FALSE(cached.HasCachedInverseForTesting());
+  EXPECT_EQ(expected, cached.transform());
+  EXPECT_EQ(expected.InverseMapPoint(PointF(1, 2)),
+            cached.InverseMapPoint(PointF(1, 2)));
+
+  // Making the matrix singular must be reflected by the next query.
+  cached.set_rc(0, 0, 0);
+  cached.set_rc(0, 1, 0);
+  cached.set_rc(0, 2, 0);
+  cached.set_rc(0, 3, 0);
+  EXPECT_FALSE(cached.IsInvertible());
+  EXPECT_FALSE(cached.InverseMapPoint(PointF(1, 2)));
+
+  cached.MakeIdentity();
+  EXPECT_TRUE(cached.IsInvertible());
+  EXPECT_EQ(PointF(1, 2), cached.InverseMapPoint(PointF(1, 2)));
+
+  cached.set_transform(GetTestTransform());
+  EXPECT_FALSE(cached.HasCachedInverseForTesting());
+  EXPECT_EQ(GetTestTransform().InverseMapRect(RectF(1, 2, 3, 4)),
+            cached.InverseMapRect(RectF(1, 2, 3, 4)));
+}
+
+}  // namespace
+
+}  // namespace gfx
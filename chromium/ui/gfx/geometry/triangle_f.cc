@@ -4,23 +4,27 @@
 
 #include "ui/gfx/geometry/triangle_f.h"
 
+#include <cmath>
+
+#include "base/check_op.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 #include "ui/gfx/geometry/vector2d_f.h"
 
 namespace gfx {
 
-bool PointIsInTriangle(const PointF& point,
-                       const PointF& r1,
-                       const PointF& r2,
-                       const PointF& r3) {
-  // Compute the barycentric coordinates (u, v, w) of |point| relative to the
+TriangleF::TriangleF(const PointF& r1, const PointF& r2, const PointF& r3)
+    : r3_(r3) {
+  // Compute the barycentric coordinates (u, v, w) of a point relative to the
   // triangle (r1, r2, r3) by the solving the system of equations:
   //   1) point = u * r1 + v * r2 + w * r3
   //   2) u + v + w = 1
   // This algorithm comes from Christer Ericson's Real-Time Collision Detection.
+  // Instead of dividing by the determinant of the system for each point, its
+  // sign is folded into the coefficients, and w >= 0 becomes u + v <= 1.
 
   Vector2dF r31 = r1 - r3;
   Vector2dF r32 = r2 - r3;
-  Vector2dF r3p = point - r3;
 
   // Promote to doubles so all the math below is done with doubles, because
   // otherwise it gets incorrect results on arm64.
@@ -30,13 +34,50 @@ bool PointIsInTriangle(const PointF& point,
   double r32y = r32.y();
 
   double denom = r32y * r31x - r32x * r31y;
-  double u = (r32y * r3p.x() - r32x * r3p.y()) / denom;
-  double v = (r31x * r3p.y() - r31y * r3p.x()) / denom;
-  double w = 1.0 - u - v;
+  double sign = denom < 0 ? -1 : 1;
+  u_x_ = sign * r32y;
+  u_y_ = sign * -r32x;
+  v_x_ = sign * -r31y;
+  v_y_ = sign * r31x;
+  scale_ = std::abs(denom) > 0 ? std::abs(denom) : -1;
+}
+
+bool TriangleF::Contains(const PointF& point) const {
+  Vector2dF d = point - r3_;
+  double u = u_x_ * d.x() + u_y_ * d.y();
+  double v = v_x_ * d.x() + v_y_ * d.y();
+  return (u >= 0) && (v >= 0) && (u + v <= scale_);
+}
+
+void TriangleF::ContainsMany(base::span<const PointF> points,
+                             base::span<bool> contains) const {
+  CheckBatchSpans(points, contains);
+  size_t i = 0;
+  for (; i + 4 <= points.size(); i += 4) {
+    // The same operations as Contains(), on four points.
+    Float4 x = {points[i].x(), points[i + 1].x(), points[i + 2].x(),
+                points[i + 3].x()};
+    Float4 y = {points[i].y(), points[i + 1].y(), points[i + 2].y(),
+                points[i + 3].y()};
+    Double4 dx = __builtin_convertvector(x - r3_.x(), Double4);
+    Double4 dy = __builtin_convertvector(y - r3_.y(), Double4);
+    Double4 u = u_x_ * dx + u_y_ * dy;
+    Double4 v = v_x_ * dx + v_y_ * dy;
+    DoubleBoolean4 result = (u >= 0) & (v >= 0) & (u + v <= scale_);
+    for (size_t j = 0; j < 4; ++j) {
+      contains[i + j] = result[j];
+    }
+  }
+  for (; i < points.size(); ++i) {
+    contains[i] = Contains(points[i]);
+  }
+}
 
-  // Use the barycentric coordinates to test if |point| is inside the
-  // triangle (r1, r2, r2).
-  return (u >= 0) && (v >= 0) && (w >= 0);
+bool PointIsInTriangle(const PointF& point,
+                       const PointF& r1,
+                       const PointF& r2,
+                       const PointF& r3) {
+  return TriangleF(r1, r2, r3).Contains(point);
 }
 
-}  // namespace gfx
\ No newline at end of file
+}  // namespace gfx
@@ -6,10 +6,43 @@
 #define UI_GFX_GEOMETRY_TRIANGLE_F_H_
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/point_f.h"
 
 namespace gfx {
 
+// A triangle with the setup of the containment test precomputed, for testing
+// many points against the same triangle, e.g. for hit testing meshes.
+class COMPONENT_EXPORT(GEOMETRY) TriangleF {
+ public:
+  TriangleF(const PointF& r1, const PointF& r2, const PointF& r3);
+
+  // Returns true if |point| is in the triangle or on its edges. Degenerate
+  // triangles, whose vertices are collinear, contain no points.
+  bool Contains(const PointF& point) const;
+
+  // Sets each element of |contains| to Contains() of the point at the same
+  // index of |points|, testing four points at once with vector instructions.
+  // Both spans must have the same size.
+  void ContainsMany(base::span<const PointF> points,
+                    base::span<bool> contains) const;
+
+ private:
+  // For a point p, with d = p - r3, the barycentric coordinates u and v of p,
+  // multiplied by |scale_|, are
+  //   u_x_ * d.x() + u_y_ * d.y() and v_x_ * d.x() + v_y_ * d.y(),
+  // so p is in the triangle if both are non-negative and their sum is at
+  // most |scale_|.
+  PointF r3_;
+  double u_x_;
+  double u_y_;
+  double v_x_;
+  double v_y_;
+  // The absolute value of the determinant of the barycentric system, or -1
+  // for degenerate triangles, so that no point passes the test.
+  double scale_;
+};
+
 COMPONENT_EXPORT(GEOMETRY)
 bool PointIsInTriangle(const PointF& point,
                        const PointF& r1,
@@ -17,4 +50,4 @@ bool PointIsInTriangle(const PointF& point,
                        const PointF& r3);
 }
 
-#endif  // UI_GFX_GEOMETRY_TRIANGLE_F_H_
\ No newline at end of file
+#endif  // UI_GFX_GEOMETRY_TRIANGLE_F_H_
@@ -5,6 +5,8 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <array>
+#include <vector>
 
 #include "build/build_config.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -41,4 +43,48 @@ TEST(TriangleTest, PointIsInTriangleVertex) {
   EXPECT_TRUE(PointIsInTriangle(kPointA, kPointA, kPointB, kPointC));
 }
 
-}  // namespace gfx
\ No newline at end of file
+TEST(TriangleTest, TriangleF) {
+  // Both orientations.
+  for (const TriangleF& triangle : {TriangleF(kPointA, kPointB, kPointC),
+                                    TriangleF(kPointA, kPointC, kPointB)}) {
+    EXPECT_TRUE(triangle.Contains(PointF(2, 2)));
+    EXPECT_FALSE(triangle.Contains(PointF(0, 0)));
+    EXPECT_TRUE(triangle.Contains(PointF(1, 3)));
+    EXPECT_TRUE(triangle.Contains(PointF(5.5f, 5.5f)));
+    EXPECT_FALSE(triangle.Contains(PointF(5.5f, 5.6f)));
+    EXPECT_TRUE(triangle.Contains(kPointA));
+    EXPECT_TRUE(triangle.Contains(kPointB));
+    EXPECT_TRUE(triangle.Contains(kPointC));
+  }
+
+  // Degenerate triangles contain nothing, not even their vertices.
+  TriangleF line(PointF(0, 0), PointF(1, 1), PointF(2, 2));
+  EXPECT_FALSE(line.Contains(PointF(1, 1)));
+  EXPECT_FALSE(line.Contains(PointF(0, 0)));
+  TriangleF point(kPointA, kPointA, kPointA);
+  EXPECT_FALSE(point.Contains(kPointA));
+}
+
+TEST(TriangleTest, TriangleFContainsMany) {
+  TriangleF triangle(PointF(1.3f, 1.4f), PointF(-0.8f, 4.4f),
+                     PointF(1.8f, 6.1f));
+  std::vector<PointF> points;
+  for (int i = -2; i <= 32; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      points.emplace_back(i * 0.1f - 0.8f, 1.4f + j * 2.3f + i * 0.01f);
+    }
+  }
+  std::array<bool, 105> contains;
+  ASSERT_EQ(contains.size(), points.size());
+  triangle.ContainsMany(points, contains);
+  size_t num_contained = 0;
+  for (size_t i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(triangle.Contains(points[i]), contains[i])
+        << points[i].ToString();
+    num_contained += contains[i];
+  }
+  EXPECT_GT(num_contained, 0u);
+  EXPECT_LT(num_contained, points.size());
+}
+
+}  // namespace gfx
@@ -4,10 +4,36 @@
 
 #include "ui/gfx/geometry/vector2d_conversions.h"
 
+#include <stddef.h>
+
+#include "base/check_op.h"
 #include "base/numerics/safe_conversions.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
 
 namespace gfx {
 
+namespace {
+
+// Converts |vectors| into |results| two at a time, in the lanes of a Float4.
+template <Int4 (*Convert)(Float4)>
+void ConvertVector2ds(base::span<const Vector2dF> vectors,
+                      base::span<Vector2d> results) {
+  CheckBatchSpans(vectors, results);
+  for (size_t i = 0; i < vectors.size(); i += 2) {
+    const bool has_pair = i + 1 < vectors.size();
+    const Vector2dF& second = vectors[has_pair ? i + 1 : i];
+    const Int4 converted =
+        Convert(Float4{vectors[i].x(), vectors[i].y(), second.x(), second.y()});
+    results[i] = Vector2d(converted[0], converted[1]);
+    if (has_pair) {
+      results[i + 1] = Vector2d(converted[2], converted[3]);
+    }
+  }
+}
+
+}  // namespace
+
 Vector2d ToFlooredVector2d(const Vector2dF& vector2d) {
   return Vector2d(base::ClampFloor(vector2d.x()),
                   base::ClampFloor(vector2d.y()));
@@ -22,5 +48,20 @@ Vector2d ToRoundedVector2d(const Vector2dF& vector2d) {
                   base::ClampRound(vector2d.y()));
 }
 
+void ToFlooredVector2ds(base::span<const Vector2dF> vectors,
+                        base::span<Vector2d> results) {
+  ConvertVector2ds<ClampFloorToInt4>(vectors, results);
+}
+
+void ToCeiledVector2ds(base::span<const Vector2dF> vectors,
+                       base::span<Vector2d> results) {
+  ConvertVector2ds<ClampCeilToInt4>(vectors, results);
+}
+
+void ToRoundedVector2ds(base::span<const Vector2dF> vectors,
+                        base::span<Vector2d> results) {
+  ConvertVector2ds<ClampRoundToInt4>(vectors, results);
+}
+
 }  // namespace gfx
 
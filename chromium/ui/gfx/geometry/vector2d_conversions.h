@@ -6,6 +6,7 @@
 #define UI_GFX_GEOMETRY_VECTOR2D_CONVERSIONS_H_
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 #include "ui/gfx/geometry/vector2d.h"
 #include "ui/gfx/geometry/vector2d_f.h"
 
@@ -22,6 +23,19 @@ COMPONENT_EXPORT(GEOMETRY) Vector2d ToCeiledVector2d(const Vector2dF& vector2d);
 COMPONENT_EXPORT(GEOMETRY)
 Vector2d ToRoundedVector2d(const Vector2dF& vector2d);
 
+// Same as the functions above for each of |vectors|, into |results|, which must
+// have the same size. Two vectors are converted at a time, with SIMD rounding
+// and saturation.
+COMPONENT_EXPORT(GEOMETRY)
+void ToFlooredVector2ds(base::span<const Vector2dF> vectors,
+                        base::span<Vector2d> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToCeiledVector2ds(base::span<const Vector2dF> vectors,
+                       base::span<Vector2d> results);
+COMPONENT_EXPORT(GEOMETRY)
+void ToRoundedVector2ds(base::span<const Vector2dF> vectors,
+                        base::span<Vector2d> results);
+
 }  // namespace gfx
 
 #endif  // UI_GFX_GEOMETRY_VECTOR2D_CONVERSIONS_H_
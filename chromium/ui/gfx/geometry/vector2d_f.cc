@@ -4,14 +4,81 @@
 
 #include "ui/gfx/geometry/vector2d_f.h"
 
+#include <algorithm>
 #include <cmath>
 
+#include "base/check_op.h"
+#include "base/compiler_specific.h"
 #include "base/strings/stringprintf.h"
 #include "base/trace_event/typed_macros.h"
 #include "build/build_config.h"
+#include "ui/gfx/geometry/batch/batch_spans.h"
+#include "ui/gfx/geometry/double4.h"
+
+#if defined(ARCH_CPU_X86_64)
+#include <immintrin.h>
+#elif defined(ARCH_CPU_ARM64)
+#include <arm_neon.h>
+#endif
 
 namespace gfx {
 
+namespace {
+
+constexpr size_t kLanes = 4;
+
+// Returns 1 / sqrt(v) in the lanes, for |v| positive and normal, within a
+// relative error of about 3e-7, from the reciprocal square root estimate of
+// the CPU and Newton steps e' = e * (3 - v * e * e) / 2.
+ALWAYS_INLINE Float4 ReciprocalSqrt(Float4 v) {
+#if defined(ARCH_CPU_X86_64)
+  // The estimate is within 1.5 * 2^-12, which one step takes to about 2^-23.
+  const Float4 e = _mm_rsqrt_ps(v);
+  return e * (1.5f - 0.5f * v * e * e);
+#elif defined(ARCH_CPU_ARM64)
+  // The estimate is within about 2^-8, which needs two steps; vrsqrtsq_f32()
+  // computes (3 - a * b) / 2.
+  float values[kLanes];
+  StoreFloat4(v, values);
+  const float32x4_t neon_v = vld1q_f32(values);
+  float32x4_t e = vrsqrteq_f32(neon_v);
+  e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(neon_v, e), e));
+  e = vmulq_f32(e, vrsqrtsq_f32(vmulq_f32(neon_v, e), e));
+  vst1q_f32(values, e);
+  return LoadFloat4(values);
+#else
+  Float4 result;
+  for (size_t lane = 0; lane < kLanes; ++lane) {
+    result[lane] = 1 / std::sqrt(v[lane]);
+  }
+  return result;
+#endif
+}
+
+// Loads vectors[i, i + count) into the lanes of |x| and |y|, with zero vectors
+// in the other lanes.
+ALWAYS_INLINE void LoadVectors(base::span<const Vector2dF> vectors,
+                               size_t i,
+                               size_t count,
+                               Float4& x,
+                               Float4& y) {
+  x = Float4{};
+  y = Float4{};
+  for (size_t lane = 0; lane < count; ++lane) {
+    x[lane] = vectors[i + lane].x();
+    y[lane] = vectors[i + lane].y();
+  }
+}
+
+// Returns the reciprocals of the square roots of |lengths_squared|, with 0 for
+// zero vectors, which get an estimate of infinity and NaNs from the Newton
+// steps.
+ALWAYS_INLINE Float4 ReciprocalLengths(Float4 lengths_squared) {
+  return lengths_squared > 0 ? ReciprocalSqrt(lengths_squared) : Float4{};
+}
+
+}  // namespace
+
 std::string Vector2dF::ToString() const {
   return base::StringPrintf("[%g %g]", x_, y_);
 }
@@ -70,6 +137,62 @@ Vector2dF ScaleVector2d(const Vector2dF& v, float x_scale, float y_scale) {
   return scaled_v;
 }
 
+void LengthsSquared(base::span<const Vector2dF> vectors,
+                    base::span<double> results) {
+  CheckBatchSpans(vectors, results);
+  for (size_t i = 0; i < vectors.size(); ++i) {
+    results[i] = vectors[i].LengthSquared();
+  }
+}
+
+void Lengths(base::span<const Vector2dF> vectors,
+             base::span<float> results,
+             VectorLengthMode mode) {
+  CheckBatchSpans(vectors, results);
+  if (mode == VectorLengthMode::kExact) {
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      results[i] = vectors[i].Length();
+    }
+    return;
+  }
+  for (size_t i = 0; i < vectors.size(); i += kLanes) {
+    const size_t count = std::min(kLanes, vectors.size() - i);
+    Float4 x, y;
+    LoadVectors(vectors, i, count, x, y);
+    const Float4 lengths_squared = x * x + y * y;
+    // sqrt(v) = v / sqrt(v), which is 0 for the zero vectors.
+    const Float4 lengths = lengths_squared * ReciprocalLengths(lengths_squared);
+    for (size_t lane = 0; lane < count; ++lane) {
+      results[i + lane] = lengths[lane];
+    }
+  }
+}
+
+void NormalizeVectors(base::span<const Vector2dF> vectors,
+                      base::span<Vector2dF> results,
+                      VectorLengthMode mode) {
+  CheckBatchSpans(vectors, results);
+  if (mode == VectorLengthMode::kExact) {
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      results[i] = NormalizeVector2d(vectors[i]);
+    }
+    return;
+  }
+  for (size_t i = 0; i < vectors.size(); i += kLanes) {
+    const size_t count = std::min(kLanes, vectors.size() - i);
+    // All the lanes are loaded before |results|, which may be |vectors|, are
+    // written.
+    Float4 x, y;
+    LoadVectors(vectors, i, count, x, y);
+    const Float4 inverse_lengths = ReciprocalLengths(x * x + y * y);
+    const Float4 normal_x = x * inverse_lengths;
+    const Float4 normal_y = y * inverse_lengths;
+    for (size_t lane = 0; lane < count; ++lane) {
+      results[i + lane] = Vector2dF(normal_x[lane], normal_y[lane]);
+    }
+  }
+}
+
 float Vector2dF::SlopeAngleRadians() const {
 #if BUILDFLAG(IS_APPLE)
   // atan2f(...) returns less accurate results on Mac.
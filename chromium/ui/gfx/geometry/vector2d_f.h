@@ -14,6 +14,7 @@
 #include <string>
 
 #include "base/component_export.h"
+#include "base/containers/span.h"
 
 namespace perfetto {
 class TracedValue;
@@ -141,6 +142,34 @@ inline Vector2dF NormalizeVector2d(const Vector2dF& v) {
   return normal;
 }
 
+// How the batch functions below compute the lengths of vectors.
+enum class VectorLengthMode {
+  // One vector at a time, with the same results as Vector2dF::Length() and
+  // NormalizeVector2d().
+  kExact,
+  // 4 vectors at a time, from a hardware estimate of the reciprocal square
+  // root refined with Newton's method. The results are within a relative
+  // error of 1e-6 of the exact ones for vectors of length between 1e-18 and
+  // 1e18, whose squares are normal floats; zero vectors have length 0 and are
+  // normalized to zero vectors, instead of the NaNs of NormalizeVector2d().
+  kFast,
+};
+
+// These set results[i] to the function of vectors[i], and |results| must have
+// the size of |vectors|, e.g. for the velocities of a history of input events.
+COMPONENT_EXPORT(GEOMETRY)
+void LengthsSquared(base::span<const Vector2dF> vectors,
+                    base::span<double> results);
+COMPONENT_EXPORT(GEOMETRY)
+void Lengths(base::span<const Vector2dF> vectors,
+             base::span<float> results,
+             VectorLengthMode mode = VectorLengthMode::kExact);
+// |results| may be |vectors|.
+COMPONENT_EXPORT(GEOMETRY)
+void NormalizeVectors(base::span<const Vector2dF> vectors,
+                      base::span<Vector2dF> results,
+                      VectorLengthMode mode = VectorLengthMode::kExact);
+
 // This is declared here for use in gtest-based unit tests but is defined in
 // the //ui/gfx:test_support target. Depend on that to use this in your unit
 // test. This should not be used in production code - call ToString() instead.
@@ -5,9 +5,15 @@
 
 #include "ui/gfx/geometry/vector2d_f.h"
 
+#include <stddef.h>
+
+#include <cmath>
+#include <vector>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "ui/gfx/geometry/test/geometry_util.h"
 #include "ui/gfx/geometry/vector2d.h"
+#include "ui/gfx/geometry/vector2d_conversions.h"
 
 namespace gfx {
 
@@ -125,6 +131,68 @@ TEST(Vector2dFTest, Length) {
   EXPECT_FLOAT_EQ(kFloatMax, Vector2dF(kFloatMax, kFloatMax).Length());
 }
 
+TEST(Vector2dFTest, BatchLengthsAndNormalize) {
+  // Not a multiple of the 4 lanes of the fast mode, at various scales.
+  std::vector<Vector2dF> vectors = {Vector2dF(3, 4), Vector2dF(-5, 12),
+                                    Vector2dF(0, 0), Vector2dF(1, 0),
+                                    Vector2dF(0, -1e-18f)};
+  for (int i = 0; i < 40; ++i) {
+    const float scale = std::pow(10.0f, static_cast<float>(i % 37 - 18));
+    vectors.emplace_back(scale * std::cos(i * 0.7f),
+                         scale * std::sin(i * 0.7f) * (i % 3));
+  }
+
+  std::vector<double> lengths_squared(vectors.size());
+  LengthsSquared(vectors, lengths_squared);
+  std::vector<float> lengths(vectors.size());
+  Lengths(vectors, lengths);
+  std::vector<float> fast_lengths(vectors.size());
+  Lengths(vectors, fast_lengths, VectorLengthMode::kFast);
+  std::vector<Vector2dF> normals(vectors.size());
+  NormalizeVectors(vectors, normals);
+  std::vector<Vector2dF> fast_normals(vectors.size());
+  NormalizeVectors(vectors, fast_normals, VectorLengthMode::kFast);
+
+  for (size_t i = 0; i < vectors.size(); ++i) {
+    SCOPED_TRACE(vectors[i].ToString());
+    EXPECT_EQ(vectors[i].LengthSquared(), lengths_squared[i]);
+    EXPECT_EQ(vectors[i].Length(), lengths[i]);
+    // As documented in the header.
+    EXPECT_NEAR(lengths[i], fast_lengths[i], 1e-6f * lengths[i]);
+    if (vectors[i].IsZero()) {
+      EXPECT_TRUE(std::isnan(normals[i].x()));
+      EXPECT_EQ(Vector2dF(), fast_normals[i]);
+      continue;
+    }
+    const Vector2dF normal = NormalizeVector2d(vectors[i]);
+    EXPECT_EQ(normal, normals[i]);
+    EXPECT_NEAR(normal.x(), fast_normals[i].x(), 1e-6f);
+    EXPECT_NEAR(normal.y(), fast_normals[i].y(), 1e-6f);
+  }
+
+  // In place.
+  std::vector<Vector2dF> in_place = vectors;
+  NormalizeVectors(in_place, in_place, VectorLengthMode::kFast);
+  EXPECT_EQ(fast_normals, in_place);
+}
+
+TEST(Vector2dFTest, ToFlooredCeiledAndRoundedVector2ds) {
+  const std::vector<Vector2dF> vectors = {
+      Vector2dF(-0.5f, 0.5f), Vector2dF(-1.25f, 3e9f), Vector2dF(-3e9f, 7.75f)};
+  std::vector<Vector2d> floored(vectors.size());
+  ToFlooredVector2ds(vectors, floored);
+  std::vector<Vector2d> ceiled(vectors.size());
+  ToCeiledVector2ds(vectors, ceiled);
+  std::vector<Vector2d> rounded(vectors.size());
+  ToRoundedVector2ds(vectors, rounded);
+  for (size_t i = 0; i < vectors.size(); ++i) {
+    SCOPED_TRACE(vectors[i].ToString());
+    EXPECT_EQ(ToFlooredVector2d(vectors[i]), floored[i]);
+    EXPECT_EQ(ToCeiledVector2d(vectors[i]), ceiled[i]);
+    EXPECT_EQ(ToRoundedVector2d(vectors[i]), rounded[i]);
+  }
+}
+
 TEST(Vector2dFTest, SlopeAngleRadians) {
   // The function is required to be very accurate, so we use a smaller
   // tolerance than EXPECT_FLOAT_EQ().